@@ -91,6 +91,7 @@ CPUGeneratorImpl::CPUGeneratorImpl(uint64_t seed_in)
 void CPUGeneratorImpl::set_current_seed(uint64_t seed) {
   next_float_normal_sample_.reset();
   next_double_normal_sample_.reset();
+  philox_offset_ = 0;
   engine_ = mt19937(seed);
 }
 
@@ -280,6 +281,24 @@ uint64_t CPUGeneratorImpl::random64() {
   return detail::make64BitsFrom32Bits(random1, random2);
 }
 
+/**
+ * Reserves a block of `increment` Philox counter offsets and returns the
+ * (seed, offset) pair at the start of the block, mirroring what
+ * CUDAGeneratorImpl::philox_engine_inputs does for CUDA. Batched fills seed
+ * a per-thread at::Philox4_32 from this pair so sampling proceeds without
+ * touching the mt19937 engine (and thus without holding the generator lock
+ * for the duration of the fill). The reservation counter restarts from zero
+ * on set_current_seed and is not part of the serialized generator state.
+ *
+ * See Note [Acquire lock when using random generators]
+ */
+std::pair<uint64_t, uint64_t> CPUGeneratorImpl::philox_engine_inputs(
+    uint64_t increment) {
+  const uint64_t offset = philox_offset_;
+  philox_offset_ += increment;
+  return std::make_pair(engine_.seed(), offset);
+}
+
 /**
  * Get the cached normal random in float
  */
@@ -347,6 +366,7 @@ CPUGeneratorImpl* CPUGeneratorImpl::clone_impl() const {
   gen->set_engine(engine_);
   gen->set_next_float_normal_sample(next_float_normal_sample_);
   gen->set_next_double_normal_sample(next_double_normal_sample_);
+  gen->philox_offset_ = philox_offset_;
   return gen;
 }
 
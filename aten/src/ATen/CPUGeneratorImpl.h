@@ -5,6 +5,8 @@
 #include <c10/core/GeneratorImpl.h>
 #include <c10/util/Optional.h>
 
+#include <utility>
+
 namespace at {
 
 struct TORCH_API CPUGeneratorImpl : public c10::GeneratorImpl {
@@ -24,6 +26,7 @@ struct TORCH_API CPUGeneratorImpl : public c10::GeneratorImpl {
   static c10::DeviceType device_type();
   uint32_t random();
   uint64_t random64();
+  std::pair<uint64_t, uint64_t> philox_engine_inputs(uint64_t increment);
   std::optional<float> next_float_normal_sample();
   std::optional<double> next_double_normal_sample();
   void set_next_float_normal_sample(std::optional<float> randn);
@@ -34,6 +37,7 @@ struct TORCH_API CPUGeneratorImpl : public c10::GeneratorImpl {
  private:
   CPUGeneratorImpl* clone_impl() const override;
   at::mt19937 engine_;
+  uint64_t philox_offset_ = 0;
   std::optional<float> next_float_normal_sample_;
   std::optional<double> next_double_normal_sample_;
 };
@@ -85,6 +85,14 @@ void Context::setDeterministicFillUninitializedMemory(bool b) {
   _deterministic_fill_uninitialized_memory = b;
 }
 
+bool Context::parallelCpuRandomFill() const {
+  return _parallel_cpu_random_fill;
+}
+
+void Context::setParallelCpuRandomFill(bool b) {
+  _parallel_cpu_random_fill = b;
+}
+
 void Context::alertNotDeterministic(c10::string_view const& caller) {
   if (globalContext().deterministicAlgorithms()) {
     if (globalContext().deterministicAlgorithmsWarnOnly()) {
@@ -529,4 +537,22 @@ void Context::setAllowFP16ReductionCPU(bool b) {
   }
   allow_fp16_reduction_cpu = b;
 }
+
+bool Context::allowBF16ReductionCPU() const {
+  return allow_bf16_reduction_cpu;
+}
+
+void Context::setAllowBF16ReductionCPU(bool b) {
+  if ( b && !allow_bf16_reduction_cpu) {
+    // Check that CPU supports bf16 reductions
+#if defined(__aarch64__) && !defined(C10_MOBILE)
+    if (!cpuinfo_initialize() || !cpuinfo_has_arm_bf16())
+      throw std::runtime_error("BFloat16 arithmetic is not supported by the CPU!");
+#endif
+    // On x86 the flag is only consumed by oneDNN-backed GEMMs, which keep
+    // f32 accumulation when the ISA has no bf16 accumulate path, so no
+    // capability check is needed here.
+  }
+  allow_bf16_reduction_cpu = b;
+}
 } // namespace at
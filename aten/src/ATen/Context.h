@@ -256,6 +256,13 @@ class TORCH_API Context {
   void setDeterministicAlgorithms(bool, bool);
   bool deterministicFillUninitializedMemory() const;
   void setDeterministicFillUninitializedMemory(bool);
+  // When enabled, CPU random fills draw from a per-call Philox counter range
+  // reserved on the generator (see CPUGeneratorImpl::philox_engine_inputs)
+  // instead of sampling the shared mt19937 engine under its mutex. This makes
+  // fills parallel and lock-free but changes the random values produced for a
+  // given seed relative to the default stream, so it is opt-in.
+  bool parallelCpuRandomFill() const;
+  void setParallelCpuRandomFill(bool);
 
   // Note [Writing Nondeterministic Operations]
   // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
@@ -335,6 +342,8 @@ class TORCH_API Context {
   void unsetDefaultMobileCPUAllocator();
   bool allowFP16ReductionCPU() const;
   void setAllowFP16ReductionCPU(bool);
+  bool allowBF16ReductionCPU() const;
+  void setAllowBF16ReductionCPU(bool);
 
  private:
   void initCUDAIfNeeded(c10::DeviceType p) {
@@ -364,6 +373,7 @@ class TORCH_API Context {
   bool _deterministic_algorithms = false;
   bool _deterministic_algorithms_warn_only = false;
   bool _deterministic_fill_uninitialized_memory = true;
+  bool _parallel_cpu_random_fill = false;
   bool enabled_flashSDP = true;
   bool enabled_mem_efficientSDP = true;
   bool enabled_mathSDP = true;
@@ -404,6 +414,7 @@ class TORCH_API Context {
   std::optional<at::QEngine> quantized_engine = c10::nullopt;
   bool enable_sparse_tensor_invariant_checks = false;
   bool allow_fp16_reduction_cpu = false;
+  bool allow_bf16_reduction_cpu = false;
 
   Allocator* prev_allocator_ptr_{nullptr};
 };
@@ -1,5 +1,8 @@
 #include <ATen/DLConvertor.h>
 #include <ATen/Functions.h>
+#include <c10/util/irange.h>
+
+#include <atomic>
 
 using namespace std;
 namespace at {
@@ -257,9 +260,7 @@ static void deleter(DLManagedTensor* arg) {
   delete static_cast<ATenDLMTensor*>(arg->manager_ctx);
 }
 
-// This function returns a shared_ptr to memory managed DLpack tensor
-// constructed out of ATen tensor
-DLManagedTensor* toDLPack(const Tensor& src) {
+static Tensor normalizeStrides(const Tensor& src) {
   // create a new tensor with possibly normalized strides
   // gh-83069
   auto shape = src.sizes();
@@ -269,26 +270,82 @@ DLManagedTensor* toDLPack(const Tensor& src) {
       strides[i] = 1;
     }
   }
+  return src.as_strided(shape, strides, src.storage_offset());
+}
 
-  auto view = src.as_strided(shape, strides, src.storage_offset());
-  ATenDLMTensor* atDLMTensor(new ATenDLMTensor);
-  atDLMTensor->handle = view;
-  atDLMTensor->tensor.manager_ctx = atDLMTensor;
-  atDLMTensor->tensor.deleter = &deleter;
-  atDLMTensor->tensor.dl_tensor.data = view.data_ptr();
+static void fillDLTensor(const Tensor& src, const Tensor& view, DLTensor& out) {
+  out.data = view.data_ptr();
   c10::DeviceIndex device_id = 0;
   if (src.is_cuda()) {
     device_id = src.get_device();
   }
-  atDLMTensor->tensor.dl_tensor.device = getDLDevice(src, device_id);
-  atDLMTensor->tensor.dl_tensor.ndim = src.dim();
-  atDLMTensor->tensor.dl_tensor.dtype = getDLDataType(src);
-  atDLMTensor->tensor.dl_tensor.shape = view.sizes().data();
-  atDLMTensor->tensor.dl_tensor.strides = view.strides().data();
-  atDLMTensor->tensor.dl_tensor.byte_offset = 0;
+  out.device = getDLDevice(src, device_id);
+  out.ndim = src.dim();
+  out.dtype = getDLDataType(src);
+  out.shape = view.sizes().data();
+  out.strides = view.strides().data();
+  out.byte_offset = 0;
+}
+
+// This function returns a shared_ptr to memory managed DLpack tensor
+// constructed out of ATen tensor
+DLManagedTensor* toDLPack(const Tensor& src) {
+  auto view = normalizeStrides(src);
+  ATenDLMTensor* atDLMTensor(new ATenDLMTensor);
+  atDLMTensor->handle = view;
+  atDLMTensor->tensor.manager_ctx = atDLMTensor;
+  atDLMTensor->tensor.deleter = &deleter;
+  fillDLTensor(src, atDLMTensor->handle, atDLMTensor->tensor.dl_tensor);
   return &(atDLMTensor->tensor);
 }
 
+// Pool backing one toDLPackBatch call: a single heap block holds the handles
+// keeping the storages alive plus all the DLManagedTensor records. Every
+// record's deleter drops the outstanding count and the last one frees the
+// pool, so consumers may delete the records independently.
+// NOLINTNEXTLINE(cppcoreguidelines-pro-type-member-init)
+struct ATenDLBatch {
+  std::vector<Tensor> handles;
+  std::vector<DLManagedTensor> tensors;
+  std::atomic<size_t> outstanding;
+};
+
+static void batch_deleter(DLManagedTensor* arg) {
+  auto* batch = static_cast<ATenDLBatch*>(arg->manager_ctx);
+  if (batch->outstanding.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+    delete batch;
+  }
+}
+
+std::vector<DLManagedTensor*> toDLPackBatch(TensorList src) {
+  std::vector<DLManagedTensor*> result;
+  if (src.empty()) {
+    return result;
+  }
+  auto* batch = new ATenDLBatch;
+  batch->handles.reserve(src.size());
+  batch->tensors.resize(src.size());
+  batch->outstanding.store(src.size(), std::memory_order_relaxed);
+  result.reserve(src.size());
+  for (const auto i : c10::irange(src.size())) {
+    batch->handles.push_back(normalizeStrides(src[i]));
+    auto& managed = batch->tensors[i];
+    managed.manager_ctx = batch;
+    managed.deleter = &batch_deleter;
+    fillDLTensor(src[i], batch->handles[i], managed.dl_tensor);
+    result.push_back(&managed);
+  }
+  return result;
+}
+
+void toDLPackBorrowed(const Tensor& src, DLManagedTensor& out) {
+  out.manager_ctx = nullptr;
+  out.deleter = nullptr;
+  // No owning view is created here, so the gh-83069 stride normalization does
+  // not apply: the record points straight into src's metadata.
+  fillDLTensor(src, src, out.dl_tensor);
+}
+
 Tensor fromDLPack(DLManagedTensor* src) {
   auto deleter = [src](void* self) {
     if (src->deleter) {
@@ -317,4 +374,20 @@ Tensor fromDLPack(DLManagedTensor* src, std::function<void(void*)> deleter) {
       at::device(device).dtype(stype),
       {device});
 }
+
+Tensor fromDLPackBorrowed(const DLManagedTensor* src) {
+  Device device = getATenDevice(src->dl_tensor.device, src->dl_tensor.data);
+  ScalarType stype = toScalarType(src->dl_tensor.dtype);
+  if (!src->dl_tensor.strides) {
+    return at::from_blob(
+        src->dl_tensor.data,
+        IntArrayRef(src->dl_tensor.shape, src->dl_tensor.ndim),
+        at::device(device).dtype(stype));
+  }
+  return at::from_blob(
+      src->dl_tensor.data,
+      IntArrayRef(src->dl_tensor.shape, src->dl_tensor.ndim),
+      IntArrayRef(src->dl_tensor.strides, src->dl_tensor.ndim),
+      at::device(device).dtype(stype));
+}
 } // namespace at
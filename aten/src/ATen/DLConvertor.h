@@ -22,4 +22,24 @@ fromDLPack(DLManagedTensor* src, std::function<void(void*)> deleter);
 TORCH_API DLDataType getDLDataType(const Tensor& t);
 TORCH_API DLDevice getDLContext(const Tensor& tensor, const int64_t& device_id);
 
+// Batched variant of toDLPack: wraps every tensor in src using a single
+// allocation shared by all the DLManagedTensor records. Each returned record
+// has a working deleter and the shared block is freed when the last record
+// is deleted, so consumers may release the records independently and in any
+// order.
+TORCH_API std::vector<DLManagedTensor*> toDLPackBatch(TensorList src);
+
+// Borrowed (non-owning) conversion for short-lived views: fills a
+// caller-provided record without allocating or taking a reference on the
+// tensor. The caller must keep src alive (and unmodified in metadata) for as
+// long as the record is in use; the record's deleter is null. Unlike
+// toDLPack, sizes and strides are exported as-is, pointing into src's own
+// metadata.
+TORCH_API void toDLPackBorrowed(const Tensor& src, DLManagedTensor& out);
+
+// Borrowed import counterpart: aliases the DLPack tensor's memory without
+// taking over its lifetime; src's deleter is never called and src must
+// outlive the returned tensor.
+TORCH_API Tensor fromDLPackBorrowed(const DLManagedTensor* src);
+
 } // namespace at
@@ -1,8 +1,11 @@
 #include <ATen/MapAllocator.h>
 
+#include <algorithm>
 #include <atomic>
 #include <random>
 #include <string>
+#include <thread>
+#include <vector>
 #if ATOMIC_INT_LOCK_FREE == 2
 #define AT_ATOMIC_IPC_REFCOUNT 1
 #endif
@@ -59,6 +62,50 @@ constexpr const char* unknown_filename = "filename not specified";
 #ifdef _WIN32
 constexpr const char* unknown_eventname = "eventname not specified";
 #endif
+
+#ifndef _WIN32
+/* Page in a freshly created mapping by reading one byte per page, splitting
+ * the region across threads. Faulting pages serially from the consumer is
+ * the dominant cost of first-touching very large shared storages; doing it
+ * here keeps the kernel's page-in work off the critical path. */
+void prefault_mapped_region(void* base, size_t size) {
+  const auto page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+  if (base == nullptr || size == 0 || page_size == 0) {
+    return;
+  }
+  // One thread per 256MB of mapping, capped by the hardware thread count;
+  // small mappings are touched inline.
+  constexpr size_t bytes_per_thread = static_cast<size_t>(256) << 20;
+  size_t num_threads = std::min<size_t>(
+      (size + bytes_per_thread - 1) / bytes_per_thread,
+      std::max(std::thread::hardware_concurrency(), 1u));
+  const size_t num_pages = (size + page_size - 1) / page_size;
+  auto touch_range = [&](size_t begin_page, size_t end_page) {
+    const volatile char* data = static_cast<const volatile char*>(base);
+    for (size_t page = begin_page; page < end_page; page++) {
+      (void)data[page * page_size];
+    }
+  };
+  if (num_threads <= 1) {
+    touch_range(0, num_pages);
+    return;
+  }
+  const size_t pages_per_thread = (num_pages + num_threads - 1) / num_threads;
+  std::vector<std::thread> threads;
+  threads.reserve(num_threads);
+  for (size_t t = 0; t < num_threads; t++) {
+    const size_t begin_page = t * pages_per_thread;
+    const size_t end_page = std::min(begin_page + pages_per_thread, num_pages);
+    if (begin_page >= end_page) {
+      break;
+    }
+    threads.emplace_back(touch_range, begin_page, end_page);
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+}
+#endif
 }  // namespace (anonymous)
 
 MapAllocator::MapAllocator(WithFd, c10::string_view filename, int fd, int flags, size_t size)
@@ -331,6 +378,22 @@ MapAllocator::MapAllocator(WithFd, c10::string_view filename, int fd, int flags,
     posix_fadvise(fd, 0, static_cast<off_t>(size), POSIX_FADV_SEQUENTIAL);
 #endif
 
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+    if (flags_ & ALLOCATOR_MAPPED_HUGEPAGES) {
+      /* Ask for transparent huge pages to cut TLB misses on large storages
+       * with random access patterns. MAP_HUGETLB is deliberately not used:
+       * it requires a preallocated hugetlbfs pool and fails the whole mmap
+       * when the pool is exhausted, whereas this is purely advisory. */
+      madvise(base_ptr_, size_, MADV_HUGEPAGE);
+    }
+#endif
+
+    if (flags_ & ALLOCATOR_MAPPED_PREFAULT) {
+      /* after the hugepage advice so khugepaged can back the faulted range
+       * with huge pages right away */
+      prefault_mapped_region(base_ptr_, size_);
+    }
+
     if (flags_ & ALLOCATOR_MAPPED_KEEPFD) {
       fd_ = fd;
     } else {
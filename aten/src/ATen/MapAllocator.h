@@ -12,7 +12,13 @@ enum MappedAllocatorModes {
   ALLOCATOR_MAPPED_NOCREATE = 8,
   ALLOCATOR_MAPPED_KEEPFD = 16,
   ALLOCATOR_MAPPED_FROMFD = 32,
-  ALLOCATOR_MAPPED_UNLINK = 64
+  ALLOCATOR_MAPPED_UNLINK = 64,
+  // Advise the kernel to back the mapping with (transparent) huge pages.
+  // Best-effort: silently ignored on platforms without madvise(MADV_HUGEPAGE).
+  ALLOCATOR_MAPPED_HUGEPAGES = 128,
+  // Touch every page of the mapping with multiple threads at map time so
+  // large shared storages don't pay the page-in cost on first access.
+  ALLOCATOR_MAPPED_PREFAULT = 256
 };
 
 // Sentinel value/type to help distinguish the file descriptor constructor from
@@ -11,6 +11,7 @@ class TORCH_API PTThreadPool : public c10::ThreadPool {
       : c10::ThreadPool(pool_size, numa_node_id, []() {
           c10::setThreadName("PTThreadPool");
           at::init_num_threads();
+          at::internal::apply_thread_pool_cpu_affinity();
         }) {}
 };
 
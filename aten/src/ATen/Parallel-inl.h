@@ -4,8 +4,56 @@
 #include <c10/util/ParallelGuard.h>
 #include <c10/util/SmallVector.h>
 
+#include <atomic>
+#include <chrono>
+
 namespace at {
 
+namespace internal {
+
+// Refines a caller-provided grain size from measured per-element cost.
+// Callers mostly pass at::internal::GRAIN_SIZE (32768), which assumes a
+// loop body costing roughly 1 ns per element; expensive bodies then get
+// needlessly coarse chunks and cheap ones get split too finely. One state
+// object exists per parallel_for/parallel_reduce instantiation (a lambda
+// type is unique to its call site), so the moving average tracks a single
+// kernel. Updates are racy on purpose: concurrent samples can only jitter
+// the average, never corrupt it. Only consulted when
+// adaptive_grain_enabled() is set; calc_num_tasks_and_chunk_size still
+// performs the actual splitting with whatever grain is suggested.
+class AdaptiveGrainState {
+ public:
+  // Target wall time per chunk; matches what the default grain size yields
+  // under the 1 ns/element assumption.
+  static constexpr int64_t kTargetChunkNs = 32768;
+
+  int64_t suggest(int64_t fallback_grain) {
+    const int64_t ps = per_element_ps_.load(std::memory_order_relaxed);
+    if (ps <= 0) {
+      return fallback_grain;
+    }
+    const int64_t grain = kTargetChunkNs * 1000 / ps;
+    return std::min(std::max(grain, int64_t(1)), int64_t(1) << 30);
+  }
+
+  void update(int64_t numel, int64_t ns) {
+    if (numel <= 0 || ns <= 0) {
+      return;
+    }
+    const int64_t sample_ps = std::max(ns * 1000 / numel, int64_t(1));
+    const int64_t cur = per_element_ps_.load(std::memory_order_relaxed);
+    const int64_t next = cur <= 0 ? sample_ps : cur + (sample_ps - cur) / 4;
+    per_element_ps_.store(next, std::memory_order_relaxed);
+  }
+
+ private:
+  // Exponential moving average of the measured cost, in picoseconds per
+  // element; 0 until the first parallel run has been timed.
+  std::atomic<int64_t> per_element_ps_{0};
+};
+
+} // namespace internal
+
 template <class F>
 inline void parallel_for(
     const int64_t begin,
@@ -19,10 +67,14 @@ inline void parallel_for(
 
 #ifdef INTRA_OP_PARALLEL
   at::internal::lazy_init_num_threads();
+  static internal::AdaptiveGrainState adaptive_grain;
+  const bool adaptive = internal::adaptive_grain_enabled();
+  const int64_t effective_grain =
+      adaptive ? adaptive_grain.suggest(grain_size) : grain_size;
   const auto numiter = end - begin;
   const bool use_parallel =
-      (numiter > grain_size && numiter > 1 && !at::in_parallel_region() &&
-       at::get_num_threads() > 1);
+      (numiter > effective_grain && numiter > 1 &&
+       !at::in_parallel_region() && at::get_num_threads() > 1);
   if (!use_parallel) {
     internal::ThreadIdGuard tid_guard(0);
     c10::ParallelGuard guard(true);
@@ -31,9 +83,18 @@ inline void parallel_for(
   }
 
   internal::invoke_parallel(
-      begin, end, grain_size, [&](int64_t begin, int64_t end) {
+      begin, end, effective_grain, [&](int64_t begin, int64_t end) {
         c10::ParallelGuard guard(true);
-        f(begin, end);
+        if (adaptive) {
+          const auto start = std::chrono::steady_clock::now();
+          f(begin, end);
+          const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                              std::chrono::steady_clock::now() - start)
+                              .count();
+          adaptive_grain.update(end - begin, ns);
+        } else {
+          f(begin, end);
+        }
       });
 #else
   internal::ThreadIdGuard tid_guard(0);
@@ -57,9 +118,13 @@ inline scalar_t parallel_reduce(
 
 #ifdef INTRA_OP_PARALLEL
   at::internal::lazy_init_num_threads();
+  static internal::AdaptiveGrainState adaptive_grain;
+  const bool adaptive = internal::adaptive_grain_enabled();
+  const int64_t effective_grain =
+      adaptive ? adaptive_grain.suggest(grain_size) : grain_size;
   const auto max_threads = at::get_num_threads();
   const bool use_parallel =
-      ((end - begin) > grain_size && !at::in_parallel_region() &&
+      ((end - begin) > effective_grain && !at::in_parallel_region() &&
        max_threads > 1);
   if (!use_parallel) {
     internal::ThreadIdGuard tid_guard(0);
@@ -71,11 +136,20 @@ inline scalar_t parallel_reduce(
   internal::invoke_parallel(
       begin,
       end,
-      grain_size,
+      effective_grain,
       [&](const int64_t my_begin, const int64_t my_end) {
         const auto tid = at::get_thread_num();
         c10::ParallelGuard guard(true);
-        results[tid] = f(my_begin, my_end, ident);
+        if (adaptive) {
+          const auto start = std::chrono::steady_clock::now();
+          results[tid] = f(my_begin, my_end, ident);
+          const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                              std::chrono::steady_clock::now() - start)
+                              .count();
+          adaptive_grain.update(my_end - my_begin, ns);
+        } else {
+          results[tid] = f(my_begin, my_end, ident);
+        }
       });
 
   scalar_t result = ident;
@@ -3,6 +3,7 @@
 #include <c10/macros/Macros.h>
 #include <functional>
 #include <string>
+#include <vector>
 
 namespace at {
 
@@ -39,6 +40,12 @@ inline void lazy_init_num_threads() {
 
 TORCH_API void set_thread_num(int);
 
+// True when ATEN_ADAPTIVE_GRAIN_SIZE is set in the environment. With it,
+// parallel_for/parallel_reduce refine the caller-provided grain size using
+// the measured per-element cost of previous runs (see AdaptiveGrainState in
+// Parallel-inl.h).
+TORCH_API bool adaptive_grain_enabled();
+
 class TORCH_API ThreadIdGuard {
  public:
   ThreadIdGuard(int new_id) : old_id_(at::get_thread_num()) {
@@ -135,10 +142,28 @@ TORCH_API void set_num_interop_threads(int);
 // Returns the number of threads used for inter-op parallelism
 TORCH_API int get_num_interop_threads();
 
+// Restricts the worker threads of the ATen thread pools (the intra-op pool
+// with the native parallel backend and the at::launch inter-op pool) to the
+// given set of CPU cores. Keeps operator threads off cores reserved for
+// other processes or other model instances sharing the machine. Like
+// set_num_threads, this has to be called before the pools have spun up;
+// with the OpenMP backend, intra-op threads are managed by OpenMP and
+// should be placed via OMP_PLACES/GOMP_CPU_AFFINITY instead. Only
+// effective on Linux.
+TORCH_API void set_thread_pool_cpu_affinity(const std::vector<int>& cpus);
+
+// Returns the CPU core set configured via set_thread_pool_cpu_affinity;
+// empty if the pool threads are unrestricted
+TORCH_API std::vector<int> get_thread_pool_cpu_affinity();
+
 // Launches inter-op parallel task
 TORCH_API void launch(std::function<void()> func);
 namespace internal {
 void launch_no_thread_state(std::function<void()> fn);
+
+// Applies the configured pool CPU affinity to the calling thread;
+// called during pool thread initialization
+TORCH_API void apply_thread_pool_cpu_affinity();
 } // namespace internal
 
 // Launches intra-op parallel task
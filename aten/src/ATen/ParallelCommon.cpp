@@ -46,6 +46,20 @@ size_t get_env_num_threads(const char* var_name, size_t def_value = 0) {
 
 } // namespace
 
+namespace internal {
+
+bool adaptive_grain_enabled() {
+  static const bool enabled = [] {
+    if (auto* value = std::getenv("ATEN_ADAPTIVE_GRAIN_SIZE")) {
+      return std::stoi(value) != 0;
+    }
+    return false;
+  }();
+  return enabled;
+}
+
+} // namespace internal
+
 std::string get_parallel_info() {
   std::ostringstream ss;
 
@@ -54,6 +68,15 @@ std::string get_parallel_info() {
   ss << "\tat::get_num_interop_threads() : "
      << at::get_num_interop_threads() << '\n';
 
+  auto pool_affinity = at::get_thread_pool_cpu_affinity();
+  if (!pool_affinity.empty()) {
+    ss << "\tat::get_thread_pool_cpu_affinity() :";
+    for (const auto cpu : pool_affinity) {
+      ss << ' ' << cpu;
+    }
+    ss << '\n';
+  }
+
   ss << at::get_openmp_version() << '\n';
 #ifdef _OPENMP
   ss << "\tomp_get_max_threads() : " << omp_get_max_threads() << '\n';
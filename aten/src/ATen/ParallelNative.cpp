@@ -153,11 +153,11 @@ void invoke_parallel(
     std::exception_ptr eptr;
     std::mutex mutex;
     std::atomic_size_t remaining{0};
+    std::atomic_size_t next_task{0};
     std::condition_variable cv;
   } state;
 
-  auto task = [f, &state, begin, end, chunk_size]
-      (int /* unused */, size_t task_id) {
+  auto run_chunk = [&f, &state, begin, end, chunk_size](size_t task_id) {
     int64_t local_start = begin + task_id * chunk_size;
     if (local_start < end) {
       int64_t local_end = std::min(end, (int64_t)(chunk_size + local_start));
@@ -170,6 +170,23 @@ void invoke_parallel(
         }
       }
     }
+  };
+
+  // Submit one pool task per participating worker and let workers claim
+  // chunks with a single atomic increment each. Previously every chunk was
+  // enqueued as its own closure, so fine-grained loops serialized on the
+  // pool's shared queue mutex at high core counts; with claiming, the queue
+  // is touched once per worker regardless of how many chunks the loop is
+  // split into, and faster workers naturally pick up the remaining chunks.
+  auto worker = [&run_chunk, &state, num_tasks]
+      (int /* unused */, size_t /* unused */) {
+    while (true) {
+      auto task_id = state.next_task.fetch_add(1, std::memory_order_relaxed);
+      if (task_id >= num_tasks) {
+        break;
+      }
+      run_chunk(task_id);
+    }
     {
       std::unique_lock<std::mutex> lk(state.mutex);
       if (--state.remaining == 0) {
@@ -177,8 +194,10 @@ void invoke_parallel(
       }
     }
   };
-  state.remaining = num_tasks;
-  _run_with_pool(std::move(task), num_tasks);
+  const size_t num_workers =
+      std::min(num_tasks, static_cast<size_t>(get_num_threads()));
+  state.remaining = num_workers;
+  _run_with_pool(worker, num_workers);
 
   // Wait for all tasks to finish.
   {
@@ -5,6 +5,14 @@
 #include <ATen/ThreadLocalState.h>
 
 #include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <mutex>
+#include <vector>
+
+#if defined(__linux__)
+#include <sched.h>
+#endif
 
 namespace at {
 
@@ -12,6 +20,14 @@ namespace {
 const int NOT_SET = -1;
 const int CONSUMED = -2;
 
+// CPU cores the pool worker threads are pinned to; empty means unrestricted.
+// Guarded by affinity_mutex; affinity_consumed flips once the first pool
+// thread has initialized, after which the setting can no longer change
+// (existing threads would not pick it up).
+std::mutex affinity_mutex;
+std::vector<int> pool_cpu_affinity;
+std::atomic<bool> affinity_consumed{false};
+
 // Number of inter-op threads set by the user;
 // NOT_SET -> positive value -> CONSUMED
 // (CONSUMED - thread pool is initialized)
@@ -69,7 +85,49 @@ int get_num_interop_threads() {
   }
 }
 
+void set_thread_pool_cpu_affinity(const std::vector<int>& cpus) {
+  TORCH_CHECK(!cpus.empty(), "Expected a non-empty set of CPU cores");
+  for (const auto cpu : cpus) {
+    TORCH_CHECK(cpu >= 0, "Expected non-negative CPU core ids, got ", cpu);
+  }
+  TORCH_CHECK(!affinity_consumed.load(),
+      "Error: cannot set thread pool CPU affinity after parallel work "
+      "has started");
+  std::lock_guard<std::mutex> lock(affinity_mutex);
+  pool_cpu_affinity = cpus;
+}
+
+std::vector<int> get_thread_pool_cpu_affinity() {
+  std::lock_guard<std::mutex> lock(affinity_mutex);
+  return pool_cpu_affinity;
+}
+
 namespace internal {
+void apply_thread_pool_cpu_affinity() {
+  std::vector<int> cpus;
+  {
+    std::lock_guard<std::mutex> lock(affinity_mutex);
+    cpus = pool_cpu_affinity;
+  }
+  affinity_consumed.store(true);
+  if (cpus.empty()) {
+    return;
+  }
+#if defined(__linux__)
+  cpu_set_t cpu_set;
+  CPU_ZERO(&cpu_set);
+  for (const auto cpu : cpus) {
+    CPU_SET(cpu, &cpu_set);
+  }
+  if (sched_setaffinity(0, sizeof(cpu_set_t), &cpu_set) != 0) {
+    TORCH_WARN("Failed to set thread pool CPU affinity: ",
+        std::strerror(errno));
+  }
+#else
+  TORCH_WARN_ONCE("Thread pool CPU affinity is only supported on Linux");
+#endif
+}
+
 void launch_no_thread_state(std::function<void()> fn) {
 #if AT_EXPERIMENTAL_SINGLE_THREAD_POOL
   intraop_launch(std::move(fn));
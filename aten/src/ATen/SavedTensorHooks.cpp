@@ -41,6 +41,20 @@ void SavedTensorDefaultHooks::enable() {
   return prior;
 }
 
+/* static */ bool SavedTensorDefaultHooks::set_offload_to_cpu(bool offload) {
+  // See NOTE: [Native CPU offload of saved tensors]
+  if (offload) {
+    assertSavedTensorHooksNotDisabled();
+  }
+  bool prior = tls.offload_to_cpu;
+  tls.offload_to_cpu = offload;
+  return prior;
+}
+
+/* static */ bool SavedTensorDefaultHooks::get_offload_to_cpu() {
+  return tls.offload_to_cpu;
+}
+
 const std::optional<std::string>& SavedTensorDefaultHooks::get_disabled_error_message() {
   return tls.disabled_error_message;
 }
@@ -25,6 +25,9 @@ struct TORCH_API SavedTensorDefaultHooksTLS {
 
   // See NOTE: [Deferring tensor pack/unpack hooks until runtime]
   bool is_tracing = false;
+
+  // See NOTE: [Native CPU offload of saved tensors]
+  bool offload_to_cpu = false;
 };
 
 } // namespace impl
@@ -57,6 +60,16 @@ struct TORCH_API SavedTensorDefaultHooks {
   // To do so, we disable these hooks during tracing. See
   // https://github.com/pytorch/pytorch/issues/113263.
   static bool set_tracing(bool is_tracing);
+
+  // NOTE: [Native CPU offload of saved tensors]
+  // When enabled, saved tensors on accelerator devices are packed by a
+  // native C++ hook that stages them into pinned CPU memory with an async
+  // D2H copy on a side stream, and unpacked with an event-ordered async
+  // H2D copy (see torch/csrc/autograd/cpu_offload_saved_variable_hooks.h).
+  // Explicit Python saved-tensor hooks take precedence when both are set.
+  // Returns the previous value.
+  static bool set_offload_to_cpu(bool offload);
+  static bool get_offload_to_cpu();
 };
 
 } // namespace at
@@ -973,6 +973,133 @@ void TensorIteratorBase::build_ternary_op(
       .add_owned_const_input(c));
 }
 
+// Specialized setup for the by far most common elementwise case: a binary op
+// on two defined, same-dtype, same-shape, contiguous CPU tensors with a
+// matching (or undefined) output. For sub-1000-element tensors the generic
+// build's shape/stride coalescing and dtype computation cost more than the
+// kernel itself, so this path skips compute_shape/compute_strides/
+// reorder_dimensions entirely: BINARY_OP_CONFIG's broadcasting, type
+// promotion and dimension reordering all degenerate to no-ops here, and the
+// iterator can be produced directly in its final 1-d coalesced form (the
+// same form fast_set_up would arrive at), from which cpu_kernel_vec takes
+// its contiguous fast path.
+bool TensorIteratorBase::fast_build_binary_op(
+    const TensorBase& out,
+    const TensorBase& a,
+    const TensorBase& b,
+    bool borrow_tensors) {
+  if (!a.defined() || !b.defined()) {
+    return false;
+  }
+  // Restricted to CPU: there is no dispatch-avoiding benefit on accelerators
+  // and no device/stream bookkeeping to reason about here.
+  if (!a.device().is_cpu() || b.device() != a.device()) {
+    return false;
+  }
+  if (a.layout() != kStrided || b.layout() != kStrided) {
+    return false;
+  }
+  if (a.scalar_type() != b.scalar_type()) {
+    return false;
+  }
+  if (!a.sizes().equals(b.sizes())) {
+    return false;
+  }
+  if (!a.is_contiguous(MemoryFormat::Contiguous) ||
+      !b.is_contiguous(MemoryFormat::Contiguous)) {
+    return false;
+  }
+  // Conjugate/negative views and named tensors take the generic path, which
+  // knows how to propagate them.
+  if (a.is_conj() || a.is_neg() || b.is_conj() || b.is_neg() ||
+      a.has_names() || b.has_names()) {
+    return false;
+  }
+  if (out.defined()) {
+    if (out.device() != a.device() || out.layout() != kStrided ||
+        out.scalar_type() != a.scalar_type() ||
+        !out.sizes().equals(a.sizes()) ||
+        !out.is_contiguous(MemoryFormat::Contiguous) || out.is_conj() ||
+        out.is_neg() || out.has_names()) {
+      return false;
+    }
+    // Same checks as compute_mem_overlaps (BINARY_OP_CONFIG sets
+    // set_check_mem_overlap); internal overlap is impossible for a
+    // contiguous output.
+    if (!out.is_same(a)) {
+      assert_no_partial_overlap(out, a);
+    }
+    if (!out.is_same(b)) {
+      assert_no_partial_overlap(out, b);
+    }
+  }
+
+  is_reduction_ = false;
+  enforce_linear_iteration_ = false;
+  all_ops_same_shape_ = true;
+  num_outputs_ = 1;
+  common_device_ = a.device();
+  common_dtype_ = a.scalar_type();
+  shape_ = DimVector(a.sizes());
+
+  if (borrow_tensors) {
+    operands_.emplace_back(c10::MaybeOwned<TensorBase>::borrowed(out));
+    operands_.emplace_back(c10::MaybeOwned<TensorBase>::borrowed(a));
+    operands_.emplace_back(c10::MaybeOwned<TensorBase>::borrowed(b));
+  } else {
+    operands_.emplace_back(
+        c10::MaybeOwned<TensorBase>::owned(std::in_place, out));
+    operands_.emplace_back(c10::MaybeOwned<TensorBase>::owned(std::in_place, a));
+    operands_.emplace_back(c10::MaybeOwned<TensorBase>::owned(std::in_place, b));
+  }
+  operands_[1].is_const = true;
+  operands_[2].is_const = true;
+
+  auto& output_op = operands_[0];
+  output_op.is_output = true;
+  if (out.defined()) {
+    output_op.is_read_write = out.is_same(a) || out.is_same(b);
+  } else {
+    // Functional call: allocate the output below, exactly as fast_set_up's
+    // CONTIGUOUS case would.
+    output_op.will_resize = true;
+    output_op.target_dtype = common_dtype_;
+    output_op.current_dtype = common_dtype_;
+    output_op.device = common_device_;
+  }
+  set_output_raw_strided(
+      0,
+      shape_,
+      {},
+      original_options(output_op).memory_format(MemoryFormat::Contiguous),
+      names_);
+
+  // Collapse to the 1-d coalesced form directly.
+  if (ndim() > 1) {
+    has_coalesced_dimensions_ = true;
+  }
+  if (ndim() >= 1) {
+    shape_[0] = numel();
+    shape_.resize(1);
+  }
+  for (auto& op : operands_) {
+    auto element_size_in_bytes = op.tensor_base().element_size();
+    op.stride_bytes.resize(ndim());
+    if (ndim() > 0) {
+      op.stride_bytes[0] = element_size_in_bytes;
+    }
+    TORCH_INTERNAL_ASSERT(op.tensor_base().defined());
+    if (op.is_const) {
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+      op.data = const_cast<void*>(op.tensor_base().const_data_ptr());
+    } else {
+      op.data = op.tensor_base().mutable_data_ptr();
+    }
+  }
+  view_offsets_ = DimVector(ndim() ? ndim() : 1, 0);
+  return true;
+}
+
 // This cannot be a function because TensorIteratorConfig is not
 // copyable or movable, so it can't be returned from the function.
 #define BINARY_OP_CONFIG()                              \
@@ -984,6 +1111,9 @@ void TensorIteratorBase::build_ternary_op(
     .enforce_safe_casting_to_output(true)               \
 
 void TensorIteratorBase::build_binary_op(const TensorBase& out, const TensorBase& a, const TensorBase& b) {
+  if (fast_build_binary_op(out, a, b, /*borrow_tensors=*/false)) {
+    return;
+  }
   build(BINARY_OP_CONFIG()
       .add_owned_output(out)
       .add_owned_const_input(a)
@@ -992,6 +1122,9 @@ void TensorIteratorBase::build_binary_op(const TensorBase& out, const TensorBase
 
 void TensorIteratorBase::build_borrowing_binary_op(
     const TensorBase& out, const TensorBase& a, const TensorBase& b) {
+  if (fast_build_binary_op(out, a, b, /*borrow_tensors=*/true)) {
+    return;
+  }
   build(BINARY_OP_CONFIG()
       .add_output(out)
       .add_const_input(a)
@@ -1485,6 +1618,17 @@ FastSetupType TensorIteratorBase::compute_fast_setup_type(const TensorIteratorCo
 
 TensorIteratorBase::TensorIteratorBase() = default;
 
+namespace {
+
+// Per-thread so no locking is needed; iterator builds are thread-local by
+// construction and serving threads each converge on their own hot shapes.
+internal::IterationPlanCache& iteration_plan_cache() {
+  static thread_local internal::IterationPlanCache cache;
+  return cache;
+}
+
+} // namespace
+
 void TensorIteratorBase::build(TensorIteratorConfig& config) {
   // populate some persistent configuration fields
   is_reduction_ = config.is_reduction_;
@@ -1509,12 +1653,63 @@ void TensorIteratorBase::build(TensorIteratorConfig& config) {
   if (!fast_set_up(config)) {
     // compute each tensor's stride after broadcasting
     compute_strides(config);
-    // re-order dimensions to improve coalescing
-    reorder_dimensions();
-    // allocate the output tensor if it's not provided
-    allocate_or_resize_outputs();
-    // coalesce adjacent dimensions when possible
-    if (!is_meta_) coalesce_dimensions();
+    // Reordering and coalescing only depend on the broadcast shape, the
+    // operands' byte strides and the flags hashed into the key below, so
+    // their outcome can be replayed from the per-thread plan cache when an
+    // identical iterator was built before. Restricted to iterators whose
+    // outputs are already allocated: allocate_or_resize_outputs consumes
+    // the pre-coalesce perm_/shape_ when it has to materialize an output.
+    bool outputs_allocated = !is_meta_ && ndim() > 1;
+    for (const auto i : c10::irange(num_outputs_)) {
+      auto& op = operands_[i];
+      outputs_allocated &= op.tensor_base().defined() && !op.will_resize;
+    }
+    internal::IterationPlanCache::Entry* plan = nullptr;
+    c10::SmallVector<int64_t, 32> plan_key;
+    if (outputs_allocated) {
+      plan_key.push_back(
+          (enforce_linear_iteration_ ? 1 : 0) | (is_reduction_ ? 2 : 0));
+      plan_key.push_back(ntensors());
+      plan_key.push_back(ndim());
+      plan_key.append(shape_.begin(), shape_.end());
+      for (auto& op : operands_) {
+        plan_key.push_back(
+            (op.is_output ? 1 : 0) | (op.stride_bytes.empty() ? 2 : 0));
+        plan_key.append(op.stride_bytes.begin(), op.stride_bytes.end());
+      }
+      plan = iteration_plan_cache().find(plan_key);
+    }
+    if (plan != nullptr) {
+      // notify set_output about the (unchanged) outputs before clobbering
+      // shape_ with its coalesced form, mirroring the normal stage order.
+      allocate_or_resize_outputs();
+      perm_ = plan->perm;
+      shape_ = plan->shape;
+      for (const auto i : c10::irange(ntensors())) {
+        auto& stride_bytes = operands_[i].stride_bytes;
+        stride_bytes.assign(
+            plan->strides.begin() + i * ndim(),
+            plan->strides.begin() + (i + 1) * ndim());
+      }
+      has_coalesced_dimensions_ = true;
+    } else {
+      // re-order dimensions to improve coalescing
+      reorder_dimensions();
+      // allocate the output tensor if it's not provided
+      allocate_or_resize_outputs();
+      // coalesce adjacent dimensions when possible
+      if (!is_meta_) coalesce_dimensions();
+      if (outputs_allocated) {
+        auto& entry = iteration_plan_cache().evict(plan_key);
+        entry.shape = shape_;
+        entry.perm = perm_;
+        entry.strides.clear();
+        for (auto& op : operands_) {
+          entry.strides.append(
+              op.stride_bytes.begin(), op.stride_bytes.end());
+        }
+      }
+    }
   }
 
   if (is_meta_) return;
@@ -634,6 +634,15 @@ struct TORCH_API TensorIteratorBase : public impl::MetaBase {
   void compute_names(const TensorIteratorConfig&);
   void propagate_names_to_outputs();
   void coalesce_dimensions();
+  // Specialized setup for two same-dtype contiguous same-shape CPU inputs;
+  // returns false (leaving the iterator untouched) when the operands don't
+  // qualify and the generic build must run. See the comment on the
+  // implementation for what it skips.
+  bool fast_build_binary_op(
+      const TensorBase& out,
+      const TensorBase& a,
+      const TensorBase& b,
+      bool borrow_tensors);
 
  protected:
   /// Records the "computation" shape of the output tensor. The computation
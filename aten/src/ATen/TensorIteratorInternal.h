@@ -3,6 +3,8 @@
 #include <c10/util/SmallBuffer.h>
 #include <c10/util/irange.h>
 
+#include <array>
+
 namespace at {
 
 struct DimCounter {
@@ -20,6 +22,60 @@ struct DimCounter {
 
 namespace internal {
 
+// Memoizes the outcome of TensorIteratorBase's dimension reordering and
+// coalescing (perm_, final shape_, final per-operand stride_bytes). Both
+// stages are pure functions of the broadcast shape, the per-operand byte
+// strides and a few config flags, so the key below fully determines the
+// plan and no op identity is needed. Serving workloads that hit the same
+// operator with the same shapes every call replay the stored plan instead
+// of re-running the insertion sort and coalescing loop. One small
+// fixed-size LRU per thread (see TensorIterator.cpp); entries are
+// verified by full key comparison, never by hash alone.
+struct IterationPlanCache {
+  struct Entry {
+    c10::SmallVector<int64_t, 32> key;
+    DimVector shape;
+    DimVector perm;
+    // Final stride_bytes of all operands, flattened as ntensors
+    // consecutive runs of shape.size() values.
+    c10::SmallVector<int64_t, 16> strides;
+    uint64_t stamp{0};
+  };
+
+  static constexpr size_t kEntries = 8;
+
+  Entry* find(ArrayRef<int64_t> key) {
+    for (auto& entry : entries_) {
+      if (!entry.key.empty() && key.equals(entry.key)) {
+        entry.stamp = ++clock_;
+        return &entry;
+      }
+    }
+    return nullptr;
+  }
+
+  // Returns the least recently used slot for the caller to fill in.
+  Entry& evict(ArrayRef<int64_t> key) {
+    Entry* slot = &entries_[0];
+    for (auto& entry : entries_) {
+      if (entry.key.empty()) {
+        slot = &entry;
+        break;
+      }
+      if (entry.stamp < slot->stamp) {
+        slot = &entry;
+      }
+    }
+    slot->key.assign(key.begin(), key.end());
+    slot->stamp = ++clock_;
+    return *slot;
+  }
+
+ private:
+  std::array<Entry, kEntries> entries_;
+  uint64_t clock_{0};
+};
+
 inline void get_data_ptrs(
     char** ptrs,
     ArrayRef<char*> base,
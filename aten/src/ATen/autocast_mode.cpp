@@ -1,5 +1,6 @@
 #include <ATen/autocast_mode.h>
 
+#include <atomic>
 #include <mutex>
 #include <ATen/CachedTensorUtils.h>
 #include <c10/util/flat_hash_map.h>
@@ -42,6 +43,28 @@ static ska::flat_hash_map<TensorImpl*, val_type>& get_cached_casts() {
 }
 std::mutex cached_casts_mutex;
 
+// Opt-in persistent cast cache that survives autocast scope exits, so frozen
+// weights are cast once for the lifetime of the process instead of once per
+// forward pass. Staleness is detected through the tensor's version counter,
+// which every in-place mutation bumps: the cached value additionally stores
+// the source's version at cast time and a mismatch triggers a re-cast.
+// Tensors without a version counter (created in InferenceMode) can't be
+// tracked this way and skip the persistent cache.
+//
+// Unlike cache_enabled, which follows the Python-side context manager and is
+// thread-local, the persistent cache is deliberately process-wide: it is
+// meant to be turned on once by serving code and shared by all threads.
+using persistent_val_type = std::tuple<weakref_type, uint32_t, Tensor>;
+
+static ska::flat_hash_map<TensorImpl*, persistent_val_type>&
+get_persistent_cached_casts() {
+  static ska::flat_hash_map<TensorImpl*, persistent_val_type>
+      persistent_cached_casts;
+  return persistent_cached_casts;
+}
+std::mutex persistent_cached_casts_mutex;
+std::atomic<bool> persistent_cache_enabled{false};
+
 
 // nesting tracks the nesting depth of the Python-side context manager.
 // When the autocast context manager exits to a nesting level that's outside
@@ -89,6 +112,22 @@ void clear_cache() {
   get_cached_casts().clear();
 }
 
+void clear_persistent_cache() {
+  const std::lock_guard<std::mutex> lock(persistent_cached_casts_mutex);
+  get_persistent_cached_casts().clear();
+}
+
+bool is_autocast_persistent_cache_enabled() {
+  return persistent_cache_enabled.load(std::memory_order_relaxed);
+}
+
+void set_autocast_persistent_cache_enabled(bool enabled) {
+  persistent_cache_enabled.store(enabled, std::memory_order_relaxed);
+  if (!enabled) {
+    clear_persistent_cache();
+  }
+}
+
 int increment_nesting() {
   return ++nesting;
 }
@@ -119,6 +158,29 @@ void set_autocast_cache_enabled(bool enabled) {
 // extern thread_local in the header.
 Tensor cached_cast(at::ScalarType to_type, const Tensor& arg, DeviceType device_type) {
   if (is_eligible(arg, device_type) && (arg.scalar_type() != to_type)) {
+    // Persistent cache: unlike the scoped cache below, this doesn't require
+    // requires_grad (inference weights are typically frozen) because the
+    // version counter check makes caching mutated tensors safe.
+    // See persistent_cached_casts declaration above for detailed strategy.
+    if (persistent_cache_enabled.load(std::memory_order_relaxed) &&
+        to_type == get_lower_precision_fp_from_device_type(device_type) &&
+        arg.scalar_type() == at::kFloat && !arg.is_view() &&
+        arg.unsafeGetTensorImpl()->version_counter().enabled() &&
+        !at::caching::is_cached_tensor(arg)) {
+      auto* impl = arg.unsafeGetTensorImpl();
+      auto version = impl->version_counter().current_version();
+      const std::lock_guard<std::mutex> lock(persistent_cached_casts_mutex);
+      auto it = get_persistent_cached_casts().find(impl);
+      if (it != get_persistent_cached_casts().end() &&
+          std::get<1>(it->second) == version) {
+        return std::get<2>(it->second);
+      }
+      auto casted_arg = arg.to(to_type);
+      get_persistent_cached_casts()[impl] = persistent_val_type{
+          weakref_type(arg.getIntrusivePtr()), version, casted_arg};
+      return casted_arg;
+    }
+
     // Heuristic:  Do what Apex does, and cache lower_precision_fp casts of fp32 model weights (leaves).
     // See cached_casts declaration above for detailed strategy.
     bool can_try_cache = (to_type == get_lower_precision_fp_from_device_type(device_type) &&
@@ -21,6 +21,11 @@ TORCH_API int increment_nesting();
 TORCH_API int decrement_nesting();
 TORCH_API bool is_autocast_cache_enabled();
 TORCH_API void set_autocast_cache_enabled(bool enabled);
+// Opt-in cast cache that survives autocast scope exits and is invalidated
+// through the source tensor's version counter; see autocast_mode.cpp.
+TORCH_API void clear_persistent_cache();
+TORCH_API bool is_autocast_persistent_cache_enabled();
+TORCH_API void set_autocast_persistent_cache_enabled(bool enabled);
 
 // deprecated CUDA-specific autocast APIs
 C10_DEPRECATED_MESSAGE(
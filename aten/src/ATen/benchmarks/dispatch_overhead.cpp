@@ -0,0 +1,105 @@
+#include <ATen/ATen.h>
+#include <ATen/TensorIterator.h>
+#include <ATen/core/dispatch/Dispatcher.h>
+#include <ATen/native/BinaryOps.h>
+#include <ATen/ops/add_cpu_dispatch.h>
+
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+// Decomposes the wall time of a dispatched elementwise op into framework
+// phases by measuring progressively shallower entry points into the same
+// computation:
+//
+//   add_out_boxed        boxed dispatcher call (findSchemaOrThrow + callBoxed)
+//   add_out_dispatched   regular typed call through the dispatcher
+//   add_out_direct       at::cpu::add_out, skipping dispatch entirely
+//   add_iterator_setup   TensorIterator construction for the same inputs
+//   add_kernel_only      the CPU kernel invoked on a prebuilt TensorIterator
+//
+// Subtracting successive rows attributes time to boxing, dispatch,
+// TensorIterator setup and the kernel itself, so framework-overhead
+// regressions show up per release instead of in production traces. All
+// variants reuse a preallocated output so allocator time does not pollute
+// the comparison.
+
+static void add_out_boxed(benchmark::State& state) {
+  const int64_t numel = state.range(0);
+  at::Tensor a = at::rand({numel});
+  at::Tensor b = at::rand({numel});
+  at::Tensor out = at::empty({numel});
+
+  auto op = c10::Dispatcher::singleton().findSchemaOrThrow("aten::add", "out");
+  std::vector<c10::IValue> stack;
+  for (auto _ : state) {
+    stack.emplace_back(a);
+    stack.emplace_back(b);
+    stack.emplace_back(at::Scalar(1));
+    stack.emplace_back(out);
+    op.callBoxed(&stack);
+    stack.clear();
+  }
+}
+
+static void add_out_dispatched(benchmark::State& state) {
+  const int64_t numel = state.range(0);
+  at::Tensor a = at::rand({numel});
+  at::Tensor b = at::rand({numel});
+  at::Tensor out = at::empty({numel});
+
+  for (auto _ : state) {
+    at::add_out(out, a, b);
+  }
+}
+
+static void add_out_direct(benchmark::State& state) {
+  const int64_t numel = state.range(0);
+  at::Tensor a = at::rand({numel});
+  at::Tensor b = at::rand({numel});
+  at::Tensor out = at::empty({numel});
+
+  for (auto _ : state) {
+    at::cpu::add_out(out, a, b);
+  }
+}
+
+static void add_iterator_setup(benchmark::State& state) {
+  const int64_t numel = state.range(0);
+  at::Tensor a = at::rand({numel});
+  at::Tensor b = at::rand({numel});
+  at::Tensor out = at::empty({numel});
+
+  for (auto _ : state) {
+    auto iter = at::TensorIterator::borrowing_binary_op(out, a, b);
+    benchmark::DoNotOptimize(iter);
+  }
+}
+
+static void add_kernel_only(benchmark::State& state) {
+  const int64_t numel = state.range(0);
+  at::Tensor a = at::rand({numel});
+  at::Tensor b = at::rand({numel});
+  at::Tensor out = at::empty({numel});
+
+  auto iter = at::TensorIterator::borrowing_binary_op(out, a, b);
+  for (auto _ : state) {
+    at::native::add_stub(at::kCPU, iter, 1);
+  }
+}
+
+static void GenerateSizes(benchmark::internal::Benchmark* b) {
+  b->ArgName("N");
+  // Framework overhead dominates at small sizes; the large sizes anchor the
+  // kernel-bound end of the range.
+  for (int64_t n = 1; n <= 65536; n *= 16) {
+    b->Arg(n);
+  }
+}
+
+BENCHMARK(add_out_boxed)->Apply(GenerateSizes);
+BENCHMARK(add_out_dispatched)->Apply(GenerateSizes);
+BENCHMARK(add_out_direct)->Apply(GenerateSizes);
+BENCHMARK(add_iterator_setup)->Apply(GenerateSizes);
+BENCHMARK(add_kernel_only)->Apply(GenerateSizes);
+BENCHMARK_MAIN();
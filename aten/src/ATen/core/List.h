@@ -22,6 +22,13 @@ struct Type;
 namespace detail {
 
 struct ListImpl final : public c10::intrusive_ptr_target {
+  // Note: IValue is an incomplete type here. This header is reached from
+  // ivalue_inl.h, so completing IValue first would be circular. That rules
+  // out small-buffer storage (e.g. SmallVector<IValue, N>), which needs
+  // sizeof(IValue) at this point; short-list workloads therefore pay one
+  // heap allocation for the ListImpl and one for the vector buffer. Tuples
+  // avoid this via ivalue::TupleElements, which can live after IValue's
+  // definition because nothing in List<T> depends on it.
   using list_type = std::vector<IValue>;
 
   explicit TORCH_API ListImpl(list_type list_, TypePtr elementType_);
@@ -392,6 +392,8 @@ void OperatorEntry::updateDispatchTableEntry_(const c10::Dispatcher& dispatcher,
   }
   dispatchTable_[dispatch_ix] = computeDispatchTableEntry(dispatcher, dispatch_key);
   dispatchKeyExtractor_.setOperatorHasFallthroughForKey(dispatch_key, dispatchTable_[dispatch_ix].isFallthrough());
+  // Invalidate per-thread dispatch index caches; see lookup().
+  dispatch_table_version_.fetch_add(1, std::memory_order_release);
 }
 
 // synchronizes the dispatch table entries for a given dispatch key *and its
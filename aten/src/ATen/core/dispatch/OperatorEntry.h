@@ -16,8 +16,9 @@
 #include <ATen/core/dispatch/RegistrationHandleRAII.h>
 #include <ATen/core/enum_tag.h>
 
-#include <list>
 #include <array>
+#include <atomic>
+#include <list>
 
 #ifdef C10_MOBILE
 #define C10_DISPATCHER_ONE_KERNEL_PER_DISPATCH_KEY
@@ -29,6 +30,39 @@ class Dispatcher;
 
 namespace impl {
 
+// A per-thread, direct-mapped cache of (operator, dispatch key set) ->
+// dispatch table index. Microbatch workloads issue thousands of tiny ops
+// whose arguments produce the same DispatchKeySet call after call (e.g.
+// CPU/float/strided), so the bit-twiddling in
+// getDispatchTableIndexForDispatchKeySet is pure overhead on the hot path.
+// Entries carry the operator's dispatch table version and are revalidated
+// against it on every hit, so kernel (de)registration invalidates stale
+// entries without any cross-thread synchronization on the cache itself.
+struct DispatchIndexCache final {
+  struct Entry {
+    const void* op = nullptr;
+    uint64_t key_set_repr = 0;
+    uint64_t version = 0;
+    int index = -1;
+  };
+  // Power of two; 64 entries cover the working set of hot ops per thread
+  // while keeping the cache within a few cache lines.
+  static constexpr size_t kNumEntries = 64;
+
+  Entry& entry_for(const void* op, uint64_t key_set_repr) {
+    const auto hash =
+        (reinterpret_cast<uintptr_t>(op) >> 4) ^ static_cast<uintptr_t>(key_set_repr);
+    return entries_[hash & (kNumEntries - 1)];
+  }
+
+  std::array<Entry, kNumEntries> entries_;
+};
+
+inline DispatchIndexCache& dispatch_index_cache() {
+  thread_local DispatchIndexCache cache;
+  return cache;
+}
+
 // This data structure represents a kernel that was registered to us from a
 // user.  Unlike KernelFunction, AnnotatedKernel contains some extra metadata
 // about the kernel that isn't necessary for actual dispatching (this is why
@@ -172,7 +206,24 @@ public:
   [[noreturn]] void reportError(DispatchKey dispatchKey) const;
 
   const KernelFunction& lookup(DispatchKeySet ks) const {
-    const auto idx = ks.getDispatchTableIndexForDispatchKeySet();
+    // Fast path: reuse the table index computed the last time this thread
+    // dispatched this operator with the same key set. The entry is validated
+    // against dispatch_table_version_, which is bumped on every dispatch
+    // table update, so (de)registrations can never serve a stale index.
+    const auto key_set_repr = ks.raw_repr();
+    auto& cache_entry = dispatch_index_cache().entry_for(this, key_set_repr);
+    const auto version =
+        dispatch_table_version_.load(std::memory_order_acquire);
+    int idx = -1;
+    if (C10_LIKELY(
+            cache_entry.op == this &&
+            cache_entry.key_set_repr == key_set_repr &&
+            cache_entry.version == version)) {
+      idx = cache_entry.index;
+    } else {
+      idx = ks.getDispatchTableIndexForDispatchKeySet();
+      cache_entry = {this, key_set_repr, version, idx};
+    }
     if (C10_UNLIKELY(idx == -1)) {
       reportError(ks.highestPriorityTypeId());
     }
@@ -226,6 +277,9 @@ private:
     std::vector<at::Tag> tags_;
   #endif
   std::array<KernelFunction, c10::num_runtime_entries> dispatchTable_;
+  // Bumped on every dispatchTable_ update; validates per-thread
+  // DispatchIndexCache entries in lookup().
+  std::atomic<uint64_t> dispatch_table_version_{0};
   DispatchKeyExtractor dispatchKeyExtractor_;
   // Pointer to the torch.ops.ns.op.overload object for speed
   c10::PyHandleCache py_cache_;
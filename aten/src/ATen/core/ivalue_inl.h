@@ -23,6 +23,7 @@
 #include <c10/core/impl/DeviceGuardImplInterface.h>
 #include <c10/util/FunctionRef.h>
 #include <c10/util/Logging.h>
+#include <c10/util/SmallVector.h>
 #include <c10/util/hash.h>
 #include <c10/util/intrusive_ptr.h>
 #include <c10/util/irange.h>
@@ -952,8 +953,8 @@ struct C10_EXPORT ivalue::Future final : c10::intrusive_ptr_target {
       events_.push_back(std::move(event));
     }
 
-    std::vector<FutureCallback> cbs;
-    cbs.swap(callbacks_);
+    auto cbs = std::move(callbacks_);
+    callbacks_.clear();
     lock.unlock();
 
     finished_cv_.notify_all();
@@ -1166,8 +1167,11 @@ struct C10_EXPORT ivalue::Future final : c10::intrusive_ptr_target {
         "The callback must have signature void(Future&)");
 
     // The synchronization performed below shouldn't be needed when the future
-    // is not used by the callback.
-    if (uses_future) {
+    // is not used by the callback. It is also unnecessary for CPU-only
+    // futures, which have no streams to set up or synchronize with; skipping
+    // it keeps chained continuations on the completing thread at near-zero
+    // cost per link.
+    if (uses_future && !devices_.empty()) {
       c10::OptionalDeviceGuard deviceGuard(currentDevice_);
 
       std::vector<c10::Stream> streams;
@@ -1216,8 +1220,8 @@ struct C10_EXPORT ivalue::Future final : c10::intrusive_ptr_target {
     completed_ = true;
     eptr_ = std::move(eptr);
 
-    std::vector<FutureCallback> cbs;
-    cbs.swap(callbacks_);
+    auto cbs = std::move(callbacks_);
+    callbacks_.clear();
     lock.unlock();
 
     finished_cv_.notify_all();
@@ -1363,7 +1367,9 @@ struct C10_EXPORT ivalue::Future final : c10::intrusive_ptr_target {
 
   IValue value_; // when finished the value
   TypePtr type_;
-  std::vector<FutureCallback> callbacks_;
+  // Inline capacity of one covers the common then()-chain case, where each
+  // future has exactly one continuation, without a heap allocation per link.
+  c10::SmallVector<FutureCallback, 1> callbacks_;
   std::exception_ptr eptr_;
 
   // An upcast pointer to a virtual class which allows us to manipulate events,
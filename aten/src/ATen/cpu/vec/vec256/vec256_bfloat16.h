@@ -1096,7 +1096,21 @@ inline Vectorized<type> convert_float_##name(const Vectorized<float>& a, const V
   convert(arr, arr2, K); \
   return Vectorized<type>::loadu(arr2); \
 }
+#if defined(__aarch64__) && !defined(C10_MOBILE) && !defined(__CUDACC__)
+inline std::tuple<Vectorized<float>, Vectorized<float>> convert_bfloat16_float(const Vectorized<BFloat16>& a) {
+  static_assert(Vectorized<BFloat16>::size() == 2 * Vectorized<float>::size());
+  uint16x8x2_t arr = a;
+  return std::make_tuple(
+      bf16_register_to_float(arr.val[0]), bf16_register_to_float(arr.val[1]));
+}
+inline Vectorized<BFloat16> convert_float_bfloat16(const Vectorized<float>& a, const Vectorized<float>& b) {
+  static_assert(Vectorized<BFloat16>::size() == 2 * Vectorized<float>::size());
+  return Vectorized<BFloat16>(
+      float_to_bf16_register(a), float_to_bf16_register(b));
+}
+#else
 CONVERT_NON_VECTORIZED_INIT(BFloat16, bfloat16);
+#endif
 #if defined(__aarch64__) && !defined(C10_MOBILE) && !defined(__CUDACC__)
 inline std::tuple<Vectorized<float>, Vectorized<float>> convert_half_float(const Vectorized<Half>& a) {
   static_assert(Vectorized<Half>::size() == 2 * Vectorized<float>::size());
@@ -1173,7 +1187,21 @@ inline void load_fp32_from_##name(const type *data, Vectorized<float>& out1, Vec
   data += Vectorized<float>::size(); \
   load_fp32_from_##name(data, out2); \
 }
+#if defined(__aarch64__) && !defined(C10_MOBILE) && !defined(__CUDACC__)
+inline void load_fp32_from_bf16(const BFloat16 *data, Vectorized<float>& out) {
+  out = bf16_register_to_float(
+      vld1q_u16(reinterpret_cast<const uint16_t*>(data)));
+}
+
+inline void load_fp32_from_bf16(const BFloat16 *data, Vectorized<float>& out1, Vectorized<float>& out2) {
+  uint16x8x2_t values =
+      vld1q_u16_x2(reinterpret_cast<const uint16_t*>(data));
+  out1 = bf16_register_to_float(values.val[0]);
+  out2 = bf16_register_to_float(values.val[1]);
+}
+#else
 LOAD_FP32_NON_VECTORIZED_INIT(BFloat16, bf16);
+#endif
 LOAD_FP32_NON_VECTORIZED_INIT(Half, fp16);
 
 #endif
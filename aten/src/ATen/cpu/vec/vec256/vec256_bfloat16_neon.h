@@ -0,0 +1,799 @@
+#pragma once
+
+// DO NOT DEFINE STATIC DATA IN THIS HEADER!
+// See Note [Do not compile initializers with AVX]
+
+#include <ATen/cpu/vec/intrinsics.h>
+#include <ATen/cpu/vec/vec256/vec256_float_neon.h>
+#include <ATen/cpu/vec/vec_base.h>
+#include <c10/util/BFloat16.h>
+#include <c10/util/irange.h>
+
+namespace at::vec {
+// See Note [CPU_CAPABILITY namespace]
+inline namespace CPU_CAPABILITY {
+
+// Right now contains only aarch64 implementation.
+// See vec256_half_neon.h for the reasons aarch32 is not supported.
+//
+// NEON has no BFloat16 arithmetic (the BF16 extension only adds dot
+// product and matrix-multiply instructions), so a register holds raw
+// bf16 bit patterns and every operation widens to fp32, computes there,
+// and narrows back. Since bf16 is the upper half of the fp32 bit
+// pattern, widening is a zero-extending shift, which still beats the
+// scalar store/convert/load fallback by a wide margin.
+#if !defined(C10_MOBILE) && defined(__aarch64__)
+
+#ifdef __BIG_ENDIAN__
+#error "Big endian is not supported."
+#endif
+
+// Widen one register of eight bf16 lanes to eight fp32 lanes.
+inline Vectorized<float> bf16_register_to_float(uint16x8_t reg) {
+  float32x4_t lo = vreinterpretq_f32_u32(vshll_n_u16(vget_low_u16(reg), 16));
+  float32x4_t hi = vreinterpretq_f32_u32(vshll_n_u16(vget_high_u16(reg), 16));
+  return Vectorized<float>(lo, hi);
+}
+
+// Narrow eight fp32 lanes back to one register of bf16 lanes.
+inline uint16x8_t float_to_bf16_register(const Vectorized<float>& v) {
+#ifdef __ARM_FEATURE_BF16_VECTOR_ARITHMETIC
+  return vreinterpretq_u16_bf16(
+      vcvtq_high_bf16_f32(vcvtq_low_bf16_f32(v.get_low()), v.get_high()));
+#else
+  // Round to nearest even, matching c10::BFloat16's
+  // round_to_nearest_even: add 0x7FFF plus the LSB of the truncated
+  // result, then truncate; NaN maps to the canonical quiet NaN.
+  auto round = [](float32x4_t f) {
+    uint32x4_t bits = vreinterpretq_u32_f32(f);
+    uint32x4_t lsb = vandq_u32(vshrq_n_u32(bits, 16), vdupq_n_u32(1));
+    uint32x4_t rounded = vaddq_u32(bits, vaddq_u32(lsb, vdupq_n_u32(0x7FFF)));
+    uint32x4_t nan_mask = vmvnq_u32(vceqq_f32(f, f));
+    rounded = vbslq_u32(nan_mask, vdupq_n_u32(UINT32_C(0x7FC0) << 16), rounded);
+    return vmovn_u32(vshrq_n_u32(rounded, 16));
+  };
+  return vcombine_u16(round(v.get_low()), round(v.get_high()));
+#endif
+}
+
+template <int index, bool mask_val>
+struct BlendBF16Regs {
+  static uint16x8_t impl(
+      const uint16x8_t& a,
+      const uint16x8_t& b,
+      uint16x8_t& res);
+};
+
+template <int index>
+struct BlendBF16Regs<index, true> {
+  static uint16x8_t impl(
+      const uint16x8_t& a,
+      const uint16x8_t& b,
+      uint16x8_t& res) {
+    return vsetq_lane_u16(vgetq_lane_u16(b, index), res, index);
+  }
+};
+
+template <int index>
+struct BlendBF16Regs<index, false> {
+  static uint16x8_t impl(
+      const uint16x8_t& a,
+      const uint16x8_t& b,
+      uint16x8_t& res) {
+    return vsetq_lane_u16(vgetq_lane_u16(a, index), res, index);
+  }
+};
+
+template <>
+class Vectorized<c10::BFloat16> {
+ private:
+  uint16x8x2_t values;
+
+ public:
+  // value_type should be c10::BFloat16 to fit interface with vec_base.h
+  using value_type = c10::BFloat16;
+  using size_type = int;
+  static constexpr size_type size() {
+    static_assert(sizeof(uint16x8x2_t) == 16 * sizeof(value_type));
+    return 16;
+  }
+
+ private:
+  // We use these private map functions to implement various methods
+  Vectorized<c10::BFloat16> map2(
+      const Vectorized<c10::BFloat16>& second,
+      c10::BFloat16 (*const f)(c10::BFloat16, c10::BFloat16)) const {
+    __at_align__ c10::BFloat16 tmp_first[size()];
+    __at_align__ c10::BFloat16 tmp_second[size()];
+    store(tmp_first); // store this to tmp_first
+    second.store(tmp_second);
+    for (const auto i : c10::irange(size())) {
+      tmp_first[i] = f(tmp_first[i], tmp_second[i]);
+    }
+    return loadu(tmp_first);
+  }
+
+  Vectorized<c10::BFloat16> map_with_vec_float_method(
+      Vectorized<float> (Vectorized<float>::*m)() const) const {
+    Vectorized<float> mv0 = (bf16_register_to_float(values.val[0]).*m)();
+    Vectorized<float> mv1 = (bf16_register_to_float(values.val[1]).*m)();
+    return Vectorized<c10::BFloat16>(
+        float_to_bf16_register(mv0), float_to_bf16_register(mv1));
+  }
+
+  Vectorized<c10::BFloat16> map2_with_vec_float_method(
+      const Vectorized<c10::BFloat16>& second,
+      Vectorized<float> (Vectorized<float>::*m)(const Vectorized<float>&)
+          const) const {
+    Vectorized<float> mv0 = (bf16_register_to_float(values.val[0]).*m)(
+        bf16_register_to_float(second.values.val[0]));
+    Vectorized<float> mv1 = (bf16_register_to_float(values.val[1]).*m)(
+        bf16_register_to_float(second.values.val[1]));
+    return Vectorized<c10::BFloat16>(
+        float_to_bf16_register(mv0), float_to_bf16_register(mv1));
+  }
+
+  // Comparisons are run in fp32 and the lane masks narrowed back to 16
+  // bits; rounding a mask through a bf16 convert would corrupt it.
+  template <typename Op>
+  Vectorized<c10::BFloat16> compare_with_fp32(
+      const Vectorized<c10::BFloat16>& other,
+      Op op) const {
+    auto narrow_mask = [](const Vectorized<float>& m) {
+      return vcombine_u16(
+          vmovn_u32(vreinterpretq_u32_f32(m.get_low())),
+          vmovn_u32(vreinterpretq_u32_f32(m.get_high())));
+    };
+    uint16x8_t r0 = narrow_mask(op(
+        bf16_register_to_float(values.val[0]),
+        bf16_register_to_float(other.values.val[0])));
+    uint16x8_t r1 = narrow_mask(op(
+        bf16_register_to_float(values.val[1]),
+        bf16_register_to_float(other.values.val[1])));
+    return Vectorized<c10::BFloat16>(r0, r1);
+  }
+
+ public:
+  // constructor
+  Vectorized() {}
+  Vectorized(uint16x8x2_t v) : values(v) {}
+
+  // A ctor that accepts c10::BFloat16 is needed to fit interface with
+  // vec_base.h; the register holds the raw bits of the value.
+  Vectorized(c10::BFloat16 val)
+      : values{vdupq_n_u16(val.x), vdupq_n_u16(val.x)} {}
+  Vectorized(
+      c10::BFloat16 val0,
+      c10::BFloat16 val1,
+      c10::BFloat16 val2,
+      c10::BFloat16 val3,
+      c10::BFloat16 val4,
+      c10::BFloat16 val5,
+      c10::BFloat16 val6,
+      c10::BFloat16 val7,
+      c10::BFloat16 val8,
+      c10::BFloat16 val9,
+      c10::BFloat16 val10,
+      c10::BFloat16 val11,
+      c10::BFloat16 val12,
+      c10::BFloat16 val13,
+      c10::BFloat16 val14,
+      c10::BFloat16 val15) {
+    __at_align__ uint16_t buffer[size()] = {
+        val0.x,
+        val1.x,
+        val2.x,
+        val3.x,
+        val4.x,
+        val5.x,
+        val6.x,
+        val7.x,
+        val8.x,
+        val9.x,
+        val10.x,
+        val11.x,
+        val12.x,
+        val13.x,
+        val14.x,
+        val15.x};
+    values = vld1q_u16_x2(buffer);
+  }
+  Vectorized(uint16x8_t val0, uint16x8_t val1) : values{val0, val1} {}
+  operator uint16x8x2_t() const {
+    return values;
+  }
+  template <int64_t mask>
+  static Vectorized<c10::BFloat16> blend(
+      const Vectorized<c10::BFloat16>& a,
+      const Vectorized<c10::BFloat16>& b) {
+    Vectorized<c10::BFloat16> vec;
+    // 0.
+    vec.values.val[0] = BlendBF16Regs<0, (mask & 0x01) != 0>::impl(
+        a.values.val[0], b.values.val[0], vec.values.val[0]);
+    vec.values.val[0] = BlendBF16Regs<1, (mask & 0x02) != 0>::impl(
+        a.values.val[0], b.values.val[0], vec.values.val[0]);
+    vec.values.val[0] = BlendBF16Regs<2, (mask & 0x04) != 0>::impl(
+        a.values.val[0], b.values.val[0], vec.values.val[0]);
+    vec.values.val[0] = BlendBF16Regs<3, (mask & 0x08) != 0>::impl(
+        a.values.val[0], b.values.val[0], vec.values.val[0]);
+
+    vec.values.val[0] = BlendBF16Regs<4, (mask & 0x10) != 0>::impl(
+        a.values.val[0], b.values.val[0], vec.values.val[0]);
+    vec.values.val[0] = BlendBF16Regs<5, (mask & 0x20) != 0>::impl(
+        a.values.val[0], b.values.val[0], vec.values.val[0]);
+    vec.values.val[0] = BlendBF16Regs<6, (mask & 0x40) != 0>::impl(
+        a.values.val[0], b.values.val[0], vec.values.val[0]);
+    vec.values.val[0] = BlendBF16Regs<7, (mask & 0x80) != 0>::impl(
+        a.values.val[0], b.values.val[0], vec.values.val[0]);
+
+    // 1.
+    vec.values.val[1] = BlendBF16Regs<0, (mask & 0x100) != 0>::impl(
+        a.values.val[1], b.values.val[1], vec.values.val[1]);
+    vec.values.val[1] = BlendBF16Regs<1, (mask & 0x200) != 0>::impl(
+        a.values.val[1], b.values.val[1], vec.values.val[1]);
+    vec.values.val[1] = BlendBF16Regs<2, (mask & 0x400) != 0>::impl(
+        a.values.val[1], b.values.val[1], vec.values.val[1]);
+    vec.values.val[1] = BlendBF16Regs<3, (mask & 0x800) != 0>::impl(
+        a.values.val[1], b.values.val[1], vec.values.val[1]);
+
+    vec.values.val[1] = BlendBF16Regs<4, (mask & 0x1000) != 0>::impl(
+        a.values.val[1], b.values.val[1], vec.values.val[1]);
+    vec.values.val[1] = BlendBF16Regs<5, (mask & 0x2000) != 0>::impl(
+        a.values.val[1], b.values.val[1], vec.values.val[1]);
+    vec.values.val[1] = BlendBF16Regs<6, (mask & 0x4000) != 0>::impl(
+        a.values.val[1], b.values.val[1], vec.values.val[1]);
+    vec.values.val[1] = BlendBF16Regs<7, (mask & 0x8000) != 0>::impl(
+        a.values.val[1], b.values.val[1], vec.values.val[1]);
+
+    return vec;
+  }
+  static Vectorized<c10::BFloat16> blendv(
+      const Vectorized<c10::BFloat16>& a,
+      const Vectorized<c10::BFloat16>& b,
+      const Vectorized<c10::BFloat16>& mask) {
+    // NB: This requires that each value, i.e., each uint value,
+    // of the mask either all be zeros or all be 1s.
+    // We perhaps need some kind of an assert?
+    // But that will affect performance.
+    Vectorized<c10::BFloat16> vec;
+    vec.values.val[0] =
+        vbslq_u16(mask.values.val[0], b.values.val[0], a.values.val[0]);
+    vec.values.val[1] =
+        vbslq_u16(mask.values.val[1], b.values.val[1], a.values.val[1]);
+    return vec;
+  }
+  template <typename step_t>
+  static Vectorized<c10::BFloat16> arange(
+      c10::BFloat16 base = 0.0f,
+      step_t step = static_cast<step_t>(1)) {
+    const Vectorized<c10::BFloat16> base_vec(base);
+    const Vectorized<c10::BFloat16> step_vec(step);
+    const Vectorized<c10::BFloat16> step_sizes(
+        0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+    return fmadd(step_sizes, step_vec, base_vec);
+  }
+  static Vectorized<c10::BFloat16> set(
+      const Vectorized<c10::BFloat16>& a,
+      const Vectorized<c10::BFloat16>& b,
+      int64_t count = size()) {
+    uint16_t pre_mask[16] = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+    for (int i = 0; i < count; i++) {
+      pre_mask[i] = 0xFFFF;
+    }
+    uint16x8x2_t mask = vld1q_u16_x2(pre_mask);
+
+    Vectorized<c10::BFloat16> vec(
+        vbslq_u16(mask.val[0], b.values.val[0], a.values.val[0]),
+        vbslq_u16(mask.val[1], b.values.val[1], a.values.val[1]));
+
+    return vec;
+  }
+  static Vectorized<c10::BFloat16> loadu(
+      const void* ptr,
+      int64_t count = size()) {
+    if (count == size()) {
+      return vld1q_u16_x2(reinterpret_cast<const uint16_t*>(ptr));
+    } else if (count == (size() >> 1)) {
+      Vectorized<c10::BFloat16> res;
+      res.values.val[0] = vld1q_u16(reinterpret_cast<const uint16_t*>(ptr));
+      std::memset(&res.values.val[1], 0, sizeof(res.values.val[1]));
+      return res;
+    }
+    __at_align__ uint16_t tmp_values[size()];
+    for (const auto i : c10::irange(size())) {
+      tmp_values[i] = 0;
+    }
+    std::memcpy(
+        tmp_values,
+        reinterpret_cast<const uint16_t*>(ptr),
+        count * sizeof(uint16_t));
+    return vld1q_u16_x2(tmp_values);
+  }
+  void store(void* ptr, int64_t count = size()) const {
+    if (count == size()) {
+      vst1q_u16_x2(reinterpret_cast<uint16_t*>(ptr), values);
+      return;
+    } else if (count == (size() >> 1)) {
+      vst1q_u16(reinterpret_cast<uint16_t*>(ptr), values.val[0]);
+    } else {
+      uint16_t tmp_values[size()];
+      vst1q_u16_x2(tmp_values, values);
+      std::memcpy(ptr, tmp_values, count * sizeof(uint16_t));
+    }
+  }
+  inline const uint16x8_t& get_low() const {
+    return values.val[0];
+  }
+  inline uint16x8_t& get_low() {
+    return values.val[0];
+  }
+  inline const uint16x8_t& get_high() const {
+    return values.val[1];
+  }
+  inline uint16x8_t& get_high() {
+    return values.val[1];
+  }
+  // Very slow implementation of indexing.
+  // Only required because vec256_qint refers to this.
+  // Once we specialize that implementation for ARM
+  // this should be removed. TODO (kimishpatel)
+  c10::BFloat16 operator[](int idx) const {
+    __at_align__ c10::BFloat16 tmp[size()];
+    store(tmp);
+    return tmp[idx];
+  }
+  c10::BFloat16 operator[](int idx) {
+    __at_align__ c10::BFloat16 tmp[size()];
+    store(tmp);
+    return tmp[idx];
+  }
+  // For boolean version where we want to if any 1/all zero
+  // etc. can be done faster in a different way.
+  int zero_mask() const {
+    __at_align__ c10::BFloat16 tmp[size()];
+    store(tmp);
+    int mask = 0;
+    for (int i = 0; i < size(); ++i) {
+      if (tmp[i] == 0) {
+        mask |= (1 << i);
+      }
+    }
+    return mask;
+  }
+  Vectorized<c10::BFloat16> isnan() const {
+    // NaN iff the exponent is all ones and the mantissa is non-zero,
+    // i.e. the bits with the sign cleared compare above +inf.
+    auto nan_mask = [](uint16x8_t v) {
+      return vcgtq_u16(vandq_u16(v, vdupq_n_u16(0x7FFF)), vdupq_n_u16(0x7F80));
+    };
+    return Vectorized<c10::BFloat16>(
+        nan_mask(values.val[0]), nan_mask(values.val[1]));
+  }
+  bool has_inf_nan() const {
+    auto inf_nan_mask = [](uint16x8_t v) {
+      return vcgeq_u16(vandq_u16(v, vdupq_n_u16(0x7FFF)), vdupq_n_u16(0x7F80));
+    };
+    return vmaxvq_u16(vorrq_u16(
+               inf_nan_mask(values.val[0]), inf_nan_mask(values.val[1]))) != 0;
+  }
+  Vectorized<c10::BFloat16> map(
+      c10::BFloat16 (*const f)(c10::BFloat16)) const {
+    __at_align__ c10::BFloat16 tmp[size()];
+    store(tmp);
+    for (const auto i : c10::irange(size())) {
+      tmp[i] = f(tmp[i]);
+    }
+    return loadu(tmp);
+  }
+  Vectorized<c10::BFloat16> abs() const {
+    return Vectorized<c10::BFloat16>(
+        vandq_u16(values.val[0], vdupq_n_u16(0x7FFF)),
+        vandq_u16(values.val[1], vdupq_n_u16(0x7FFF)));
+  }
+  Vectorized<c10::BFloat16> angle() const {
+    auto zero = Vectorized<c10::BFloat16>(0.0f);
+    auto pi = Vectorized<c10::BFloat16>(c10::pi<c10::BFloat16>);
+    auto tmp = blendv(zero, pi, *this < zero);
+    return blendv(tmp, *this, isnan());
+  }
+  Vectorized<c10::BFloat16> real() const {
+    return *this;
+  }
+  Vectorized<c10::BFloat16> imag() const {
+    return Vectorized<c10::BFloat16>(0.0f);
+  }
+  Vectorized<c10::BFloat16> conj() const {
+    return *this;
+  }
+
+  // Sleef does not support BF16, so math functions are applied by
+  // converting to FP32, applying the math function, and then converting
+  // back. The scalar c10::BFloat16 operations go through exactly the
+  // same FP32 round trip, so results bit-match the scalar path.
+  Vectorized<c10::BFloat16> acos() const {
+    return map_with_vec_float_method(&Vectorized<float>::acos);
+  }
+  Vectorized<c10::BFloat16> acosh() const {
+    return map_with_vec_float_method(&Vectorized<float>::acosh);
+  }
+  Vectorized<c10::BFloat16> asin() const {
+    return map_with_vec_float_method(&Vectorized<float>::asin);
+  }
+  Vectorized<c10::BFloat16> atan() const {
+    return map_with_vec_float_method(&Vectorized<float>::atan);
+  }
+  Vectorized<c10::BFloat16> atanh() const {
+    return map_with_vec_float_method(&Vectorized<float>::atanh);
+  }
+  Vectorized<c10::BFloat16> atan2(const Vectorized<c10::BFloat16>& exp) const {
+    return map2_with_vec_float_method(exp, &Vectorized<float>::atan2);
+  }
+  Vectorized<c10::BFloat16> copysign(
+      const Vectorized<c10::BFloat16>& sign) const {
+    return map2_with_vec_float_method(sign, &Vectorized<float>::copysign);
+  }
+  Vectorized<c10::BFloat16> erf() const {
+    return map_with_vec_float_method(&Vectorized<float>::erf);
+  }
+  Vectorized<c10::BFloat16> erfc() const {
+    return map_with_vec_float_method(&Vectorized<float>::erfc);
+  }
+  Vectorized<c10::BFloat16> erfinv() const {
+    return map_with_vec_float_method(&Vectorized<float>::erfinv);
+  }
+  Vectorized<c10::BFloat16> exp() const {
+    return map_with_vec_float_method(&Vectorized<float>::exp);
+  }
+  Vectorized<c10::BFloat16> exp2() const {
+    return map_with_vec_float_method(&Vectorized<float>::exp2);
+  }
+  Vectorized<c10::BFloat16> expm1() const {
+    return map_with_vec_float_method(&Vectorized<float>::expm1);
+  }
+  Vectorized<c10::BFloat16> exp_u20() const {
+    return map_with_vec_float_method(&Vectorized<float>::exp_u20);
+  }
+  Vectorized<c10::BFloat16> fmod(const Vectorized<c10::BFloat16>& q) const {
+    // This function is questionable with a conversion, so we use map2
+    return map2(q, std::fmod);
+  }
+  Vectorized<c10::BFloat16> hypot(const Vectorized<c10::BFloat16>& b) const {
+    return map2_with_vec_float_method(b, &Vectorized<float>::hypot);
+  }
+  Vectorized<c10::BFloat16> i0() const {
+    return map_with_vec_float_method(&Vectorized<float>::i0);
+  }
+  Vectorized<c10::BFloat16> i0e() const {
+    return map_with_vec_float_method(&Vectorized<float>::i0e);
+  }
+  Vectorized<c10::BFloat16> digamma() const {
+    return map_with_vec_float_method(&Vectorized<float>::digamma);
+  }
+  Vectorized<c10::BFloat16> igamma(const Vectorized<c10::BFloat16>& x) const {
+    return map2_with_vec_float_method(x, &Vectorized<float>::igamma);
+  }
+  Vectorized<c10::BFloat16> igammac(const Vectorized<c10::BFloat16>& x) const {
+    return map2_with_vec_float_method(x, &Vectorized<float>::igammac);
+  }
+  Vectorized<c10::BFloat16> log() const {
+    return map_with_vec_float_method(&Vectorized<float>::log);
+  }
+  Vectorized<c10::BFloat16> log10() const {
+    return map_with_vec_float_method(&Vectorized<float>::log10);
+  }
+  Vectorized<c10::BFloat16> log1p() const {
+    return map_with_vec_float_method(&Vectorized<float>::log1p);
+  }
+  Vectorized<c10::BFloat16> log2() const {
+    return map_with_vec_float_method(&Vectorized<float>::log2);
+  }
+  Vectorized<c10::BFloat16> nextafter(const Vectorized<c10::BFloat16>& b) const {
+    // This function does not make sense with conversion, so we use map2
+    return map2(b, std::nextafter);
+  }
+  Vectorized<c10::BFloat16> frac() const;
+  Vectorized<c10::BFloat16> sin() const {
+    return map_with_vec_float_method(&Vectorized<float>::sin);
+  }
+  Vectorized<c10::BFloat16> sinh() const {
+    return map_with_vec_float_method(&Vectorized<float>::sinh);
+  }
+  Vectorized<c10::BFloat16> cos() const {
+    return map_with_vec_float_method(&Vectorized<float>::cos);
+  }
+  Vectorized<c10::BFloat16> cosh() const {
+    return map_with_vec_float_method(&Vectorized<float>::cosh);
+  }
+  Vectorized<c10::BFloat16> ceil() const {
+    return map_with_vec_float_method(&Vectorized<float>::ceil);
+  }
+  Vectorized<c10::BFloat16> floor() const {
+    return map_with_vec_float_method(&Vectorized<float>::floor);
+  }
+  Vectorized<c10::BFloat16> neg() const {
+    return Vectorized<c10::BFloat16>(
+        veorq_u16(values.val[0], vdupq_n_u16(0x8000)),
+        veorq_u16(values.val[1], vdupq_n_u16(0x8000)));
+  }
+  inline Vectorized<c10::BFloat16> round() const {
+    return map_with_vec_float_method(&Vectorized<float>::round);
+  }
+  inline Vectorized<c10::BFloat16> tan() const {
+    return map_with_vec_float_method(&Vectorized<float>::tan);
+  }
+  inline Vectorized<c10::BFloat16> tanh() const {
+    return map_with_vec_float_method(&Vectorized<float>::tanh);
+  }
+  Vectorized<c10::BFloat16> trunc() const {
+    return map_with_vec_float_method(&Vectorized<float>::trunc);
+  }
+  Vectorized<c10::BFloat16> lgamma() const {
+    return map_with_vec_float_method(&Vectorized<float>::lgamma);
+  }
+  Vectorized<c10::BFloat16> sqrt() const {
+    return map_with_vec_float_method(&Vectorized<float>::sqrt);
+  }
+  Vectorized<c10::BFloat16> reciprocal() const {
+    return map_with_vec_float_method(&Vectorized<float>::reciprocal);
+  }
+  Vectorized<c10::BFloat16> rsqrt() const {
+    return map_with_vec_float_method(&Vectorized<float>::rsqrt);
+  }
+  Vectorized<c10::BFloat16> pow(const Vectorized<c10::BFloat16>& exp) const {
+    return map2_with_vec_float_method(exp, &Vectorized<float>::pow);
+  }
+  Vectorized<c10::BFloat16> operator==(
+      const Vectorized<c10::BFloat16>& other) const {
+    return compare_with_fp32(
+        other, [](const Vectorized<float>& x, const Vectorized<float>& y) {
+          return x == y;
+        });
+  }
+
+  Vectorized<c10::BFloat16> operator!=(
+      const Vectorized<c10::BFloat16>& other) const {
+    return compare_with_fp32(
+        other, [](const Vectorized<float>& x, const Vectorized<float>& y) {
+          return x != y;
+        });
+  }
+
+  Vectorized<c10::BFloat16> operator<(
+      const Vectorized<c10::BFloat16>& other) const {
+    return compare_with_fp32(
+        other, [](const Vectorized<float>& x, const Vectorized<float>& y) {
+          return x < y;
+        });
+  }
+
+  Vectorized<c10::BFloat16> operator<=(
+      const Vectorized<c10::BFloat16>& other) const {
+    return compare_with_fp32(
+        other, [](const Vectorized<float>& x, const Vectorized<float>& y) {
+          return x <= y;
+        });
+  }
+
+  Vectorized<c10::BFloat16> operator>(
+      const Vectorized<c10::BFloat16>& other) const {
+    return compare_with_fp32(
+        other, [](const Vectorized<float>& x, const Vectorized<float>& y) {
+          return x > y;
+        });
+  }
+
+  Vectorized<c10::BFloat16> operator>=(
+      const Vectorized<c10::BFloat16>& other) const {
+    return compare_with_fp32(
+        other, [](const Vectorized<float>& x, const Vectorized<float>& y) {
+          return x >= y;
+        });
+  }
+
+  Vectorized<c10::BFloat16> eq(const Vectorized<c10::BFloat16>& other) const;
+  Vectorized<c10::BFloat16> ne(const Vectorized<c10::BFloat16>& other) const;
+  Vectorized<c10::BFloat16> gt(const Vectorized<c10::BFloat16>& other) const;
+  Vectorized<c10::BFloat16> ge(const Vectorized<c10::BFloat16>& other) const;
+  Vectorized<c10::BFloat16> lt(const Vectorized<c10::BFloat16>& other) const;
+  Vectorized<c10::BFloat16> le(const Vectorized<c10::BFloat16>& other) const;
+}; // Vectorized<c10::BFloat16>
+
+template <>
+Vectorized<c10::BFloat16> inline operator+(
+    const Vectorized<c10::BFloat16>& a,
+    const Vectorized<c10::BFloat16>& b) {
+  Vectorized<float> r0 =
+      bf16_register_to_float(a.get_low()) + bf16_register_to_float(b.get_low());
+  Vectorized<float> r1 = bf16_register_to_float(a.get_high()) +
+      bf16_register_to_float(b.get_high());
+  return Vectorized<c10::BFloat16>(
+      float_to_bf16_register(r0), float_to_bf16_register(r1));
+}
+
+template <>
+Vectorized<c10::BFloat16> inline operator-(
+    const Vectorized<c10::BFloat16>& a,
+    const Vectorized<c10::BFloat16>& b) {
+  Vectorized<float> r0 =
+      bf16_register_to_float(a.get_low()) - bf16_register_to_float(b.get_low());
+  Vectorized<float> r1 = bf16_register_to_float(a.get_high()) -
+      bf16_register_to_float(b.get_high());
+  return Vectorized<c10::BFloat16>(
+      float_to_bf16_register(r0), float_to_bf16_register(r1));
+}
+
+template <>
+Vectorized<c10::BFloat16> inline operator*(
+    const Vectorized<c10::BFloat16>& a,
+    const Vectorized<c10::BFloat16>& b) {
+  Vectorized<float> r0 =
+      bf16_register_to_float(a.get_low()) * bf16_register_to_float(b.get_low());
+  Vectorized<float> r1 = bf16_register_to_float(a.get_high()) *
+      bf16_register_to_float(b.get_high());
+  return Vectorized<c10::BFloat16>(
+      float_to_bf16_register(r0), float_to_bf16_register(r1));
+}
+
+template <>
+Vectorized<c10::BFloat16> inline operator/(
+    const Vectorized<c10::BFloat16>& a,
+    const Vectorized<c10::BFloat16>& b) {
+  Vectorized<float> r0 =
+      bf16_register_to_float(a.get_low()) / bf16_register_to_float(b.get_low());
+  Vectorized<float> r1 = bf16_register_to_float(a.get_high()) /
+      bf16_register_to_float(b.get_high());
+  return Vectorized<c10::BFloat16>(
+      float_to_bf16_register(r0), float_to_bf16_register(r1));
+}
+
+// frac. Implement this here so we can use subtraction
+inline Vectorized<c10::BFloat16> Vectorized<c10::BFloat16>::frac() const {
+  return *this - this->trunc();
+}
+
+// Implements the IEEE 754 201X `maximum` operation, which propagates NaN if
+// either input is a NaN.
+template <>
+Vectorized<c10::BFloat16> inline maximum(
+    const Vectorized<c10::BFloat16>& a,
+    const Vectorized<c10::BFloat16>& b) {
+  Vectorized<float> r0 = maximum(
+      bf16_register_to_float(a.get_low()), bf16_register_to_float(b.get_low()));
+  Vectorized<float> r1 = maximum(
+      bf16_register_to_float(a.get_high()),
+      bf16_register_to_float(b.get_high()));
+  return Vectorized<c10::BFloat16>(
+      float_to_bf16_register(r0), float_to_bf16_register(r1));
+}
+
+// Implements the IEEE 754 201X `minimum` operation, which propagates NaN if
+// either input is a NaN.
+template <>
+Vectorized<c10::BFloat16> inline minimum(
+    const Vectorized<c10::BFloat16>& a,
+    const Vectorized<c10::BFloat16>& b) {
+  Vectorized<float> r0 = minimum(
+      bf16_register_to_float(a.get_low()), bf16_register_to_float(b.get_low()));
+  Vectorized<float> r1 = minimum(
+      bf16_register_to_float(a.get_high()),
+      bf16_register_to_float(b.get_high()));
+  return Vectorized<c10::BFloat16>(
+      float_to_bf16_register(r0), float_to_bf16_register(r1));
+}
+
+template <>
+Vectorized<c10::BFloat16> inline clamp(
+    const Vectorized<c10::BFloat16>& a,
+    const Vectorized<c10::BFloat16>& min,
+    const Vectorized<c10::BFloat16>& max) {
+  return minimum(max, maximum(min, a));
+}
+
+template <>
+Vectorized<c10::BFloat16> inline clamp_max(
+    const Vectorized<c10::BFloat16>& a,
+    const Vectorized<c10::BFloat16>& max) {
+  return minimum(max, a);
+}
+
+template <>
+Vectorized<c10::BFloat16> inline clamp_min(
+    const Vectorized<c10::BFloat16>& a,
+    const Vectorized<c10::BFloat16>& min) {
+  return maximum(min, a);
+}
+
+template <>
+Vectorized<c10::BFloat16> inline operator&(
+    const Vectorized<c10::BFloat16>& a,
+    const Vectorized<c10::BFloat16>& b) {
+  return Vectorized<c10::BFloat16>(
+      vandq_u16(a.get_low(), b.get_low()), vandq_u16(a.get_high(), b.get_high()));
+}
+
+template <>
+Vectorized<c10::BFloat16> inline operator|(
+    const Vectorized<c10::BFloat16>& a,
+    const Vectorized<c10::BFloat16>& b) {
+  return Vectorized<c10::BFloat16>(
+      vorrq_u16(a.get_low(), b.get_low()), vorrq_u16(a.get_high(), b.get_high()));
+}
+
+template <>
+Vectorized<c10::BFloat16> inline operator^(
+    const Vectorized<c10::BFloat16>& a,
+    const Vectorized<c10::BFloat16>& b) {
+  return Vectorized<c10::BFloat16>(
+      veorq_u16(a.get_low(), b.get_low()), veorq_u16(a.get_high(), b.get_high()));
+}
+
+inline Vectorized<c10::BFloat16> Vectorized<c10::BFloat16>::eq(
+    const Vectorized<c10::BFloat16>& other) const {
+  return (*this == other) & Vectorized<c10::BFloat16>(1.0f);
+}
+
+inline Vectorized<c10::BFloat16> Vectorized<c10::BFloat16>::ne(
+    const Vectorized<c10::BFloat16>& other) const {
+  return (*this != other) & Vectorized<c10::BFloat16>(1.0f);
+}
+
+inline Vectorized<c10::BFloat16> Vectorized<c10::BFloat16>::gt(
+    const Vectorized<c10::BFloat16>& other) const {
+  return (*this > other) & Vectorized<c10::BFloat16>(1.0f);
+}
+
+inline Vectorized<c10::BFloat16> Vectorized<c10::BFloat16>::ge(
+    const Vectorized<c10::BFloat16>& other) const {
+  return (*this >= other) & Vectorized<c10::BFloat16>(1.0f);
+}
+
+inline Vectorized<c10::BFloat16> Vectorized<c10::BFloat16>::lt(
+    const Vectorized<c10::BFloat16>& other) const {
+  return (*this < other) & Vectorized<c10::BFloat16>(1.0f);
+}
+
+inline Vectorized<c10::BFloat16> Vectorized<c10::BFloat16>::le(
+    const Vectorized<c10::BFloat16>& other) const {
+  return (*this <= other) & Vectorized<c10::BFloat16>(1.0f);
+}
+
+// The fused product is computed in fp32 with a single rounding at the
+// end, like the AVX2 bfloat16 implementation.
+template <>
+Vectorized<c10::BFloat16> inline fmadd(
+    const Vectorized<c10::BFloat16>& a,
+    const Vectorized<c10::BFloat16>& b,
+    const Vectorized<c10::BFloat16>& c) {
+  Vectorized<float> r0 = fmadd(
+      bf16_register_to_float(a.get_low()),
+      bf16_register_to_float(b.get_low()),
+      bf16_register_to_float(c.get_low()));
+  Vectorized<float> r1 = fmadd(
+      bf16_register_to_float(a.get_high()),
+      bf16_register_to_float(b.get_high()),
+      bf16_register_to_float(c.get_high()));
+  return Vectorized<c10::BFloat16>(
+      float_to_bf16_register(r0), float_to_bf16_register(r1));
+}
+
+template <>
+Vectorized<c10::BFloat16> inline fmsub(
+    const Vectorized<c10::BFloat16>& a,
+    const Vectorized<c10::BFloat16>& b,
+    const Vectorized<c10::BFloat16>& c) {
+  Vectorized<float> r0 = fmsub(
+      bf16_register_to_float(a.get_low()),
+      bf16_register_to_float(b.get_low()),
+      bf16_register_to_float(c.get_low()));
+  Vectorized<float> r1 = fmsub(
+      bf16_register_to_float(a.get_high()),
+      bf16_register_to_float(b.get_high()),
+      bf16_register_to_float(c.get_high()));
+  return Vectorized<c10::BFloat16>(
+      float_to_bf16_register(r0), float_to_bf16_register(r1));
+}
+
+#endif /* defined(aarch64) && !defined(C10_MOBILE) */
+
+} // namespace CPU_CAPABILITY
+} // namespace at::vec
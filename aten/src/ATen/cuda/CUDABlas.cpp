@@ -13,6 +13,9 @@
 #include <c10/macros/Export.h>
 #include <c10/util/irange.h>
 
+#include <mutex>
+#include <unordered_map>
+
 #ifdef USE_ROCM
 #include <hipblaslt/hipblaslt-ext.hpp>
 // until hipblas has an API to accept flags, we must use rocblas here
@@ -234,6 +237,17 @@ namespace at::cuda::blas {
     CUDABLAS_NONNEGINT_CHECK(bgemm<Dtype>, num_batches);  \
   } while (0)
 
+#define BGEMM_BATCHED_CHECK_ARGVALUES(Dtype)           \
+  do {                                                 \
+    CUDABLAS_NONNEGINT_CHECK(bgemm_batched<Dtype>, m); \
+    CUDABLAS_NONNEGINT_CHECK(bgemm_batched<Dtype>, n); \
+    CUDABLAS_NONNEGINT_CHECK(bgemm_batched<Dtype>, k); \
+    CUDABLAS_POSINT_CHECK(bgemm_batched<Dtype>, lda);  \
+    CUDABLAS_POSINT_CHECK(bgemm_batched<Dtype>, ldb);  \
+    CUDABLAS_POSINT_CHECK(bgemm_batched<Dtype>, ldc);  \
+    CUDABLAS_NONNEGINT_CHECK(bgemm_batched<Dtype>, num_batches);  \
+  } while (0)
+
 
 namespace {
 // Following the pattern of CuSparseDescriptor
@@ -316,6 +330,113 @@ class CuBlasLtMatmulPreference : public CuBlasLtDescriptor<
     TORCH_CUDABLAS_CHECK(::cublasLtMatmulPreferenceSetAttribute(descriptor(), attr, &value, sizeof(T)));
   }
 };
+
+// cublasLtMatmulAlgoGetHeuristic costs tens of microseconds of CPU time per
+// call, which is significant for the small GEMMs of eager-mode
+// linear+activation stacks. Heuristic results only depend on the problem
+// specification, not the operand pointers, so they are cached keyed by the
+// full problem (device, types, transposes, shapes, leading dims, epilogue
+// and pointer alignments).
+struct CuBlasLtHeuristicCacheKey {
+  int device;
+  cudaDataType_t abcType;
+  cublasComputeType_t computeType;
+  bool transa;
+  bool transb;
+  uint64_t m;
+  uint64_t n;
+  uint64_t k;
+  uint64_t lda;
+  uint64_t ldb;
+  uint64_t ldd;
+  uint32_t epilogue;
+  uint32_t a_alignment;
+  uint32_t b_alignment;
+  uint32_t c_alignment;
+  uint32_t d_alignment;
+
+  bool operator==(const CuBlasLtHeuristicCacheKey& other) const {
+    return device == other.device && abcType == other.abcType &&
+        computeType == other.computeType && transa == other.transa &&
+        transb == other.transb && m == other.m && n == other.n &&
+        k == other.k && lda == other.lda && ldb == other.ldb &&
+        ldd == other.ldd && epilogue == other.epilogue &&
+        a_alignment == other.a_alignment && b_alignment == other.b_alignment &&
+        c_alignment == other.c_alignment && d_alignment == other.d_alignment;
+  }
+};
+
+struct CuBlasLtHeuristicCacheKeyHash {
+  size_t operator()(const CuBlasLtHeuristicCacheKey& key) const {
+    auto hash = std::hash<uint64_t>();
+    size_t seed = hash(key.m);
+    const uint64_t fields[] = {
+        static_cast<uint64_t>(key.device),
+        static_cast<uint64_t>(key.abcType),
+        static_cast<uint64_t>(key.computeType),
+        static_cast<uint64_t>(key.transa) | (static_cast<uint64_t>(key.transb) << 1),
+        key.n,
+        key.k,
+        key.lda,
+        key.ldb,
+        key.ldd,
+        static_cast<uint64_t>(key.epilogue),
+        static_cast<uint64_t>(key.a_alignment) |
+            (static_cast<uint64_t>(key.b_alignment) << 16) |
+            (static_cast<uint64_t>(key.c_alignment) << 32) |
+            (static_cast<uint64_t>(key.d_alignment) << 48)};
+    for (const auto field : fields) {
+      seed ^= hash(field) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+    }
+    return seed;
+  }
+};
+
+cublasLtMatmulHeuristicResult_t lookupOrRunLtHeuristic(
+    const CuBlasLtHeuristicCacheKey& key,
+    cublasLtHandle_t ltHandle,
+    const CuBlasLtMatmulDescriptor& computeDesc,
+    const CuBlasLtMatrixLayout& Adesc,
+    const CuBlasLtMatrixLayout& Bdesc,
+    const CuBlasLtMatrixLayout& Cdesc,
+    const CuBlasLtMatmulPreference& preference) {
+  static std::mutex cache_mutex;
+  static std::unordered_map<
+      CuBlasLtHeuristicCacheKey,
+      cublasLtMatmulHeuristicResult_t,
+      CuBlasLtHeuristicCacheKeyHash>
+      cache;
+  {
+    std::lock_guard<std::mutex> guard(cache_mutex);
+    auto it = cache.find(key);
+    if (it != cache.end()) {
+      return it->second;
+    }
+  }
+
+  cublasLtMatmulHeuristicResult_t heuristicResult = {};
+  int returnedResult = 0;
+  TORCH_CUDABLAS_CHECK(cublasLtMatmulAlgoGetHeuristic(
+      ltHandle,
+      computeDesc.descriptor(),
+      Adesc.descriptor(),
+      Bdesc.descriptor(),
+      Cdesc.descriptor(),
+      Cdesc.descriptor(),
+      preference.descriptor(),
+      1,
+      &heuristicResult,
+      &returnedResult));
+  if (returnedResult == 0) {
+    TORCH_CUDABLAS_CHECK(CUBLAS_STATUS_NOT_SUPPORTED);
+  }
+
+  {
+    std::lock_guard<std::mutex> guard(cache_mutex);
+    cache.emplace(key, heuristicResult);
+  }
+  return heuristicResult;
+}
 } // namespace
 
 
@@ -589,6 +710,88 @@ void bgemm_internal_cublas<at::BFloat16>(CUDABLAS_BGEMM_ARGTYPES(at::BFloat16))
                                   CUBLAS_GEMM_DEFAULT_TENSOR_OP));
 }
 
+template <>
+void bgemm_batched<double>(CUDABLAS_BGEMM_BATCHED_ARGTYPES(double)) {
+  // See Note [Writing Nondeterministic Operations]
+  globalContext().alertCuBLASConfigNotDeterministic();
+  cublasHandle_t handle = at::cuda::getCurrentCUDABlasHandle();
+  cublasOperation_t opa = _cublasOpFromChar(transa);
+  cublasOperation_t opb = _cublasOpFromChar(transb);
+  _cublasAdjustLdLevel3(transa, transb, m, n, k, &lda, &ldb, &ldc);
+  BGEMM_BATCHED_CHECK_ARGVALUES(double);
+  TORCH_CUDABLAS_CHECK(cublasDgemmBatched(
+      handle, opa, opb, m, n, k, &alpha, a_array, lda, b_array, ldb, &beta, c_array, ldc, num_batches));
+}
+
+template <>
+void bgemm_batched<float>(CUDABLAS_BGEMM_BATCHED_ARGTYPES(float)) {
+  // See Note [Writing Nondeterministic Operations]
+  globalContext().alertCuBLASConfigNotDeterministic();
+  cublasHandle_t handle = at::cuda::getCurrentCUDABlasHandle();
+  cublasOperation_t opa = _cublasOpFromChar(transa);
+  cublasOperation_t opb = _cublasOpFromChar(transb);
+  _cublasAdjustLdLevel3(transa, transb, m, n, k, &lda, &ldb, &ldc);
+  BGEMM_BATCHED_CHECK_ARGVALUES(float);
+  TORCH_CUDABLAS_CHECK(cublasSgemmBatched(
+      handle, opa, opb, m, n, k, &alpha, a_array, lda, b_array, ldb, &beta, c_array, ldc, num_batches));
+}
+
+template <>
+void bgemm_batched<at::Half>(CUDABLAS_BGEMM_BATCHED_ARGTYPES(at::Half)) {
+  // See Note [Writing Nondeterministic Operations]
+  globalContext().alertCuBLASConfigNotDeterministic();
+  cublasHandle_t handle = at::cuda::getCurrentCUDABlasHandle();
+  cublasOperation_t opa = _cublasOpFromChar(transa);
+  cublasOperation_t opb = _cublasOpFromChar(transb);
+  _cublasAdjustLdLevel3(transa, transb, m, n, k, &lda, &ldb, &ldc);
+  BGEMM_BATCHED_CHECK_ARGVALUES(at::Half);
+  float falpha = alpha;
+  float fbeta = beta;
+#if defined(USE_ROCM)
+  auto compute_type = CUBLAS_COMPUTE_32F;
+#else
+  auto compute_type = CUDA_R_32F;
+#endif
+  TORCH_CUDABLAS_CHECK(cublasGemmBatchedEx(
+      handle, opa, opb, (int)m, (int)n, (int)k,
+      (void*)&falpha,
+      reinterpret_cast<const void* const*>(a_array), CUDA_R_16F, (int)lda,
+      reinterpret_cast<const void* const*>(b_array), CUDA_R_16F, (int)ldb,
+      (void*)&fbeta,
+      reinterpret_cast<void* const*>(c_array), CUDA_R_16F, (int)ldc,
+      (int)num_batches,
+      compute_type,
+      CUBLAS_GEMM_DEFAULT_TENSOR_OP));
+}
+
+template <>
+void bgemm_batched<at::BFloat16>(CUDABLAS_BGEMM_BATCHED_ARGTYPES(at::BFloat16)) {
+  // See Note [Writing Nondeterministic Operations]
+  globalContext().alertCuBLASConfigNotDeterministic();
+  cublasHandle_t handle = at::cuda::getCurrentCUDABlasHandle();
+  cublasOperation_t opa = _cublasOpFromChar(transa);
+  cublasOperation_t opb = _cublasOpFromChar(transb);
+  _cublasAdjustLdLevel3(transa, transb, m, n, k, &lda, &ldb, &ldc);
+  BGEMM_BATCHED_CHECK_ARGVALUES(at::BFloat16);
+  const float falpha = alpha;
+  const float fbeta = beta;
+#if defined(USE_ROCM)
+  auto compute_type = CUBLAS_COMPUTE_32F;
+#else
+  auto compute_type = CUDA_R_32F;
+#endif
+  TORCH_CUDABLAS_CHECK(cublasGemmBatchedEx(
+      handle, opa, opb, (int)m, (int)n, (int)k,
+      (void*)&falpha,
+      reinterpret_cast<const void* const*>(a_array), CUDA_R_16BF, (int)lda,
+      reinterpret_cast<const void* const*>(b_array), CUDA_R_16BF, (int)ldb,
+      (void*)&fbeta,
+      reinterpret_cast<void* const*>(c_array), CUDA_R_16BF, (int)ldc,
+      (int)num_batches,
+      compute_type,
+      CUBLAS_GEMM_DEFAULT_TENSOR_OP));
+}
+
 template <>
 void bgemm_internal<double>(CUDABLAS_BGEMM_ARGTYPES(double))
 {
@@ -1179,7 +1382,7 @@ void gemm<at::BFloat16>(CUDABLAS_GEMM_ARGTYPES(at::BFloat16)) {
 
 
 template <typename Dtype>
-void gemm_and_bias(
+void gemm_and_bias_internal(
     bool transpose_mat1,
     bool transpose_mat2,
     int64_t m,
@@ -1261,23 +1464,29 @@ void gemm_and_bias(
   auto workspace = allocator.allocate(workspaceSize);
   TORCH_CHECK(workspace.get() != nullptr, "OOM trying to allocate workspace for cublaslt");
 
-  cublasLtMatmulHeuristicResult_t heuristicResult = {};
-  int returnedResult = 0;
   cublasLtHandle_t ltHandle = at::cuda::getCurrentCUDABlasLtHandle();
-  TORCH_CUDABLAS_CHECK(cublasLtMatmulAlgoGetHeuristic(
-      ltHandle,
-      computeDesc.descriptor(),
-      Adesc.descriptor(),
-      Bdesc.descriptor(),
-      Cdesc.descriptor(),
-      Cdesc.descriptor(),
-      preference.descriptor(),
-      1,
-      &heuristicResult,
-      &returnedResult));
-  if (returnedResult == 0) {
-    TORCH_CUDABLAS_CHECK(CUBLAS_STATUS_NOT_SUPPORTED);
-  }
+  CuBlasLtHeuristicCacheKey cacheKey = {};
+  cacheKey.device = static_cast<int>(c10::cuda::current_device());
+  cacheKey.abcType = abcType;
+  cacheKey.computeType = computeType;
+  cacheKey.transa = transpose_mat1;
+  cacheKey.transb = transpose_mat2;
+  cacheKey.m = static_cast<uint64_t>(m);
+  cacheKey.n = static_cast<uint64_t>(n);
+  cacheKey.k = static_cast<uint64_t>(k);
+  cacheKey.lda = static_cast<uint64_t>(mat1_ld);
+  cacheKey.ldb = static_cast<uint64_t>(mat2_ld);
+  cacheKey.ldd = static_cast<uint64_t>(result_ld);
+  cacheKey.epilogue = static_cast<uint32_t>(
+      bias != nullptr ? epilogue : CUBLASLT_EPILOGUE_DEFAULT);
+#ifndef USE_ROCM
+  cacheKey.a_alignment = a_alignment;
+  cacheKey.b_alignment = b_alignment;
+  cacheKey.c_alignment = c_alignment;
+  cacheKey.d_alignment = d_alignment;
+#endif
+  cublasLtMatmulHeuristicResult_t heuristicResult = lookupOrRunLtHeuristic(
+      cacheKey, ltHandle, computeDesc, Adesc, Bdesc, Cdesc, preference);
 
   cublasStatus_t cublasStatus = cublasLtMatmul(
       ltHandle,
@@ -1324,6 +1533,154 @@ void gemm_and_bias(
       scaleType);
 }
 
+template void gemm_and_bias_internal(
+    bool transpose_mat1,
+    bool transpose_mat2,
+    int64_t m,
+    int64_t n,
+    int64_t k,
+    at::opmath_type<double> alpha_val,
+    const double* mat1_ptr,
+    int64_t mat1_ld,
+    const double* mat2_ptr,
+    int64_t mat2_ld,
+    const double* bias,
+    double* result_ptr,
+    int64_t result_ld,
+    GEMMAndBiasActivationEpilogue activation);
+
+template void gemm_and_bias_internal(
+    bool transpose_mat1,
+    bool transpose_mat2,
+    int64_t m,
+    int64_t n,
+    int64_t k,
+    at::opmath_type<float> alpha_val,
+    const float* mat1_ptr,
+    int64_t mat1_ld,
+    const float* mat2_ptr,
+    int64_t mat2_ld,
+    const float* bias,
+    float* result_ptr,
+    int64_t result_ld,
+    GEMMAndBiasActivationEpilogue activation);
+
+template void gemm_and_bias_internal(
+    bool transpose_mat1,
+    bool transpose_mat2,
+    int64_t m,
+    int64_t n,
+    int64_t k,
+    at::opmath_type<at::Half> alpha_val,
+    const at::Half* mat1_ptr,
+    int64_t mat1_ld,
+    const at::Half* mat2_ptr,
+    int64_t mat2_ld,
+    const at::Half* bias,
+    at::Half* result_ptr,
+    int64_t result_ld,
+    GEMMAndBiasActivationEpilogue activation);
+
+template void gemm_and_bias_internal(
+    bool transpose_mat1,
+    bool transpose_mat2,
+    int64_t m,
+    int64_t n,
+    int64_t k,
+    at::opmath_type<at::BFloat16> alpha_val,
+    const at::BFloat16* mat1_ptr,
+    int64_t mat1_ld,
+    const at::BFloat16* mat2_ptr,
+    int64_t mat2_ld,
+    const at::BFloat16* bias,
+    at::BFloat16* result_ptr,
+    int64_t result_ld,
+    GEMMAndBiasActivationEpilogue activation);
+
+template <typename Dtype>
+inline void gemm_and_bias_tunable(
+    bool transpose_mat1,
+    bool transpose_mat2,
+    int64_t m,
+    int64_t n,
+    int64_t k,
+    at::opmath_type<Dtype> alpha_val,
+    const Dtype* mat1_ptr,
+    int64_t mat1_ld,
+    const Dtype* mat2_ptr,
+    int64_t mat2_ld,
+    const Dtype* bias,
+    Dtype* result_ptr,
+    int64_t result_ld,
+    GEMMAndBiasActivationEpilogue activation) {
+  tunable::GemmAndBiasParams<Dtype> params;
+  params.transa = transpose_mat1 ? 't' : 'n';
+  params.transb = transpose_mat2 ? 't' : 'n';
+  params.m = m;
+  params.n = n;
+  params.k = k;
+  params.alpha = alpha_val;
+  params.a = mat1_ptr;
+  params.lda = mat1_ld;
+  params.b = mat2_ptr;
+  params.ldb = mat2_ld;
+  params.bias = bias;
+  params.c = result_ptr;
+  params.ldc = result_ld;
+  params.activation = activation;
+
+  if (transpose_mat1 && transpose_mat2) {
+    static tunable::GemmAndBiasTunableOp<Dtype, tunable::BlasOp::T, tunable::BlasOp::T> gemm{};
+    gemm(&params);
+  }
+  else if (transpose_mat1 && !transpose_mat2) {
+    static tunable::GemmAndBiasTunableOp<Dtype, tunable::BlasOp::T, tunable::BlasOp::N> gemm{};
+    gemm(&params);
+  }
+  else if (!transpose_mat1 && transpose_mat2) {
+    static tunable::GemmAndBiasTunableOp<Dtype, tunable::BlasOp::N, tunable::BlasOp::T> gemm{};
+    gemm(&params);
+  }
+  else if (!transpose_mat1 && !transpose_mat2) {
+    static tunable::GemmAndBiasTunableOp<Dtype, tunable::BlasOp::N, tunable::BlasOp::N> gemm{};
+    gemm(&params);
+  }
+  else {
+    TORCH_CHECK(false, "unreachable");
+  }
+}
+
+template <typename Dtype>
+void gemm_and_bias(
+    bool transpose_mat1,
+    bool transpose_mat2,
+    int64_t m,
+    int64_t n,
+    int64_t k,
+    at::opmath_type<Dtype> alpha_val,
+    const Dtype* mat1_ptr,
+    int64_t mat1_ld,
+    const Dtype* mat2_ptr,
+    int64_t mat2_ld,
+    const Dtype* bias,
+    Dtype* result_ptr,
+    int64_t result_ld,
+    GEMMAndBiasActivationEpilogue activation) {
+  auto tuning_ctx = at::cuda::tunable::getTuningContext();
+  if (tuning_ctx->IsTunableOpEnabled()) {
+    gemm_and_bias_tunable<Dtype>(
+        transpose_mat1, transpose_mat2, m, n, k, alpha_val,
+        mat1_ptr, mat1_ld, mat2_ptr, mat2_ld, bias,
+        result_ptr, result_ld, activation);
+  }
+  else {
+    gemm_and_bias_internal<Dtype>(
+        transpose_mat1, transpose_mat2, m, n, k, alpha_val,
+        mat1_ptr, mat1_ld, mat2_ptr, mat2_ld, bias,
+        result_ptr, result_ld, activation);
+  }
+}
+
 template void gemm_and_bias(
     bool transpose_mat1,
     bool transpose_mat2,
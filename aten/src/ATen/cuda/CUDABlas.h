@@ -107,6 +107,23 @@ void gemm_and_bias(
     int64_t result_ld,
     GEMMAndBiasActivationEpilogue activation = GEMMAndBiasActivationEpilogue::None);
 
+template <typename Dtype>
+void gemm_and_bias_internal(
+    bool transpose_mat1,
+    bool transpose_mat2,
+    int64_t m,
+    int64_t n,
+    int64_t k,
+    at::opmath_type<Dtype> alpha_val,
+    const Dtype* mat1_ptr,
+    int64_t mat1_ld,
+    const Dtype* mat2_ptr,
+    int64_t mat2_ld,
+    const Dtype* bias,
+    Dtype* result_ptr,
+    int64_t result_ld,
+    GEMMAndBiasActivationEpilogue activation = GEMMAndBiasActivationEpilogue::None);
+
 void int8_gemm(
     bool transpose_mat1,
     bool transpose_mat2,
@@ -188,6 +205,33 @@ void bgemm_internal<at::Half>(CUDABLAS_BGEMM_ARGTYPES(at::Half));
 template <>
 void bgemm_internal<at::BFloat16>(CUDABLAS_BGEMM_ARGTYPES(at::BFloat16));
 
+// Batched GEMM over device arrays of matrix pointers (cublas<T>gemmBatched
+// style). Every matrix in the batch shares transa/transb, m/n/k and the
+// leading dimensions; only the pointers differ, so this covers batches of
+// equal-shape matrices that are not evenly strided in memory. a_array,
+// b_array and c_array must each point to device memory holding num_batches
+// matrix pointers.
+#define CUDABLAS_BGEMM_BATCHED_ARGTYPES(Dtype)                                             \
+  char transa, char transb, int64_t m, int64_t n, int64_t k, at::opmath_type<Dtype> alpha, \
+      const Dtype* const* a_array, int64_t lda,                                            \
+      const Dtype* const* b_array, int64_t ldb,                                            \
+      at::opmath_type<Dtype> beta, Dtype* const* c_array, int64_t ldc,                     \
+      int64_t num_batches
+
+template <typename Dtype>
+inline void bgemm_batched(CUDABLAS_BGEMM_BATCHED_ARGTYPES(Dtype)) {
+  static_assert(false&&sizeof(Dtype),"at::cuda::blas::bgemm_batched: not implemented");
+}
+
+template <>
+void bgemm_batched<double>(CUDABLAS_BGEMM_BATCHED_ARGTYPES(double));
+template <>
+void bgemm_batched<float>(CUDABLAS_BGEMM_BATCHED_ARGTYPES(float));
+template <>
+void bgemm_batched<at::Half>(CUDABLAS_BGEMM_BATCHED_ARGTYPES(at::Half));
+template <>
+void bgemm_batched<at::BFloat16>(CUDABLAS_BGEMM_BATCHED_ARGTYPES(at::BFloat16));
+
 #define CUDABLAS_TRSM_ARGTYPES(Dtype)                                  \
   cublasHandle_t handle, cublasSideMode_t side, cublasFillMode_t uplo, \
       cublasOperation_t trans, cublasDiagType_t diag, int m, int n,    \
@@ -0,0 +1,51 @@
+#include <ATen/cuda/CUDAEvent.h>
+
+#include <c10/cuda/CUDAMacros.h>
+
+#include <array>
+#include <mutex>
+#include <vector>
+
+namespace at::cuda::detail {
+namespace {
+
+// The pool is intentionally leaked: returning events to it never touches the
+// CUDA runtime, and destroying the cached events during static destruction
+// would race with CUDA runtime teardown. The driver reclaims them at process
+// exit.
+struct EventPool {
+  std::array<std::mutex, C10_COMPILE_TIME_MAX_GPUS> mutexes;
+  std::array<std::vector<cudaEvent_t>, C10_COMPILE_TIME_MAX_GPUS> freelists;
+};
+
+EventPool& pool() {
+  static EventPool* pool = new EventPool();
+  return *pool;
+}
+
+} // namespace
+
+cudaEvent_t acquirePooledEvent(DeviceIndex device_index) {
+  auto& p = pool();
+  {
+    std::lock_guard<std::mutex> lock(p.mutexes[device_index]);
+    auto& freelist = p.freelists[device_index];
+    if (!freelist.empty()) {
+      cudaEvent_t event = freelist.back();
+      freelist.pop_back();
+      return event;
+    }
+  }
+  // Caller has made `device_index` current, see the declaration.
+  cudaEvent_t event = nullptr;
+  AT_CUDA_CHECK(cudaEventCreateWithFlags(&event, cudaEventDisableTiming));
+  return event;
+}
+
+void releasePooledEvent(DeviceIndex device_index, cudaEvent_t event) {
+  auto& p = pool();
+  std::lock_guard<std::mutex> lock(p.mutexes[device_index]);
+  p.freelists[device_index].push_back(event);
+}
+
+} // namespace at::cuda::detail
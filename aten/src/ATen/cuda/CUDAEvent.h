@@ -15,6 +15,19 @@
 
 namespace at::cuda {
 
+namespace detail {
+// Global per-device freelist backing default-flags (cudaEventDisableTiming)
+// CUDAEvents. Creating and destroying a cudaEvent_t per use is expensive
+// enough to show up in traces of event-heavy code (allocator, profiler,
+// c10d), so the raw handles are recycled instead of destroyed. Acquire
+// expects the caller to have made `device_index` current (it may create a
+// fresh event); release never makes a CUDA call.
+TORCH_CUDA_CPP_API cudaEvent_t acquirePooledEvent(DeviceIndex device_index);
+TORCH_CUDA_CPP_API void releasePooledEvent(
+    DeviceIndex device_index,
+    cudaEvent_t event);
+} // namespace detail
+
 /*
 * CUDAEvents are movable not copyable wrappers around CUDA's events.
 *
@@ -49,7 +62,11 @@ struct TORCH_CUDA_CPP_API CUDAEvent {
         if (C10_UNLIKELY(interp)) {
           (*interp)->trace_gpu_event_deletion(at::kCUDA, reinterpret_cast<uintptr_t>(event_));
         }
-        AT_CUDA_CHECK(cudaEventDestroy(event_));
+        if (from_pool_) {
+          detail::releasePooledEvent(device_index_, event_);
+        } else {
+          AT_CUDA_CHECK(cudaEventDestroy(event_));
+        }
       }
     } catch (...) { /* No throw */ }
   }
@@ -92,6 +109,9 @@ struct TORCH_CUDA_CPP_API CUDAEvent {
 
     cudaError_t err = cudaEventQuery(event_);
     if (err == cudaSuccess) {
+      // The event has completed, which is a synchronization boundary for any
+      // lazily-checked device-side assertion failures
+      C10_CUDA_DSA_SYNC_CHECK();
       return true;
     } else if (err != cudaErrorNotReady) {
       C10_CUDA_CHECK(err);
@@ -167,6 +187,7 @@ struct TORCH_CUDA_CPP_API CUDAEvent {
           (*interp)->trace_gpu_event_synchronization(at::kCUDA, reinterpret_cast<uintptr_t>(event_));
       }
       AT_CUDA_CHECK(cudaEventSynchronize(event_));
+      C10_CUDA_DSA_SYNC_CHECK();
     }
   }
 
@@ -185,13 +206,21 @@ private:
   unsigned int flags_ = cudaEventDisableTiming;
   bool is_created_ = false;
   bool was_recorded_ = false;
+  bool from_pool_ = false;
   DeviceIndex device_index_ = -1;
   cudaEvent_t event_{};
 
   void createEvent(DeviceIndex device_index) {
     device_index_ = device_index;
     CUDAGuard guard(device_index_);
-    AT_CUDA_CHECK(cudaEventCreateWithFlags(&event_, flags_));
+    if (flags_ == cudaEventDisableTiming) {
+      // The common case (no timing, no IPC) is served from the global
+      // per-device pool; events with other flags are created per use.
+      event_ = detail::acquirePooledEvent(device_index_);
+      from_pool_ = true;
+    } else {
+      AT_CUDA_CHECK(cudaEventCreateWithFlags(&event_, flags_));
+    }
     const c10::impl::PyInterpreter* interp = c10::impl::GPUTrace::get_trace();
     if (C10_UNLIKELY(interp)) {
       (*interp)->trace_gpu_event_creation(at::kCUDA, reinterpret_cast<uintptr_t>(event_));
@@ -203,6 +232,7 @@ private:
     std::swap(flags_, other.flags_);
     std::swap(is_created_, other.is_created_);
     std::swap(was_recorded_, other.was_recorded_);
+    std::swap(from_pool_, other.from_pool_);
     std::swap(device_index_, other.device_index_);
     std::swap(event_, other.event_);
   }
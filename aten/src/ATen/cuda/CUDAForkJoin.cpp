@@ -0,0 +1,67 @@
+#include <ATen/cuda/CUDAForkJoin.h>
+#include <ATen/cuda/Exceptions.h>
+#include <c10/cuda/CUDACachingAllocator.h>
+#include <c10/cuda/CUDAGuard.h>
+
+namespace at::cuda {
+
+CUDAForkJoinScope::CUDAForkJoinScope(size_t max_streams)
+    : parent_stream_(getCurrentCUDAStream()),
+      fork_event_(cudaEventDisableTiming),
+      max_streams_(max_streams) {
+  TORCH_CHECK(max_streams_ > 0, "CUDAForkJoinScope needs at least one stream");
+  fork_event_.record(parent_stream_);
+}
+
+CUDAForkJoinScope::~CUDAForkJoinScope() {
+  if (!joined_) {
+    try {
+      join();
+    } catch (...) {
+      // Matching the event/stream RAII types, destruction must not throw;
+      // an error here surfaces on the next synchronizing call anyway.
+    }
+  }
+}
+
+void CUDAForkJoinScope::fork(TensorList inputs, const std::function<void()>& fn) {
+  TORCH_CHECK(!joined_, "CUDAForkJoinScope was already joined");
+  // Lease streams lazily so scopes with fewer branches than max_streams
+  // don't touch the rest of the pool.
+  if (next_stream_ == streams_.size() && streams_.size() < max_streams_) {
+    streams_.push_back(
+        getStreamFromPool(/* isHighPriority */ false, parent_stream_.device_index()));
+    // Order the new stream after everything the parent had queued when the
+    // scope was created.
+    fork_event_.block(streams_.back());
+  }
+  auto stream = streams_[next_stream_ % streams_.size()];
+  next_stream_ = (next_stream_ + 1) % streams_.size();
+
+  c10::cuda::CUDAStreamGuard guard(stream);
+  for (const auto& input : inputs) {
+    if (input.defined() && input.is_cuda()) {
+      c10::cuda::CUDACachingAllocator::recordStream(
+          input.storage().data_ptr(), stream);
+    }
+  }
+  fn();
+}
+
+void CUDAForkJoinScope::join(TensorList outputs) {
+  TORCH_CHECK(!joined_, "CUDAForkJoinScope was already joined");
+  joined_ = true;
+  for (auto& stream : streams_) {
+    CUDAEvent event(cudaEventDisableTiming);
+    event.record(stream);
+    event.block(parent_stream_);
+  }
+  for (const auto& output : outputs) {
+    if (output.defined() && output.is_cuda()) {
+      c10::cuda::CUDACachingAllocator::recordStream(
+          output.storage().data_ptr(), parent_stream_);
+    }
+  }
+}
+
+} // namespace at::cuda
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <ATen/core/Tensor.h>
+#include <ATen/cuda/CUDAEvent.h>
+#include <c10/cuda/CUDAStream.h>
+
+#include <functional>
+#include <vector>
+
+namespace at::cuda {
+
+// Cooperative fork/join execution of independent branches over a small pool
+// of side streams, replacing hand-managed side streams for branch-level
+// parallelism in eager mode.
+//
+// Usage:
+//   at::cuda::CUDAForkJoinScope scope;
+//   scope.fork({x1}, [&] { y1 = f(x1); }); // runs on a pooled side stream
+//   scope.fork({x2}, [&] { y2 = g(x2); });
+//   scope.join({y1, y2}); // parent stream waits on both branches
+//
+// Ordering: every branch waits (on-device, via an event) for all work that
+// was submitted to the parent stream before the scope was created, and
+// join() makes the parent stream wait for every branch. The CPU is never
+// blocked.
+//
+// Memory safety: the caching allocator associates each allocation with the
+// stream it was made on and reuses it based on that stream's progress, so
+// every tensor crossing the scope boundary must be declared. Tensors read by
+// a branch are passed to fork(), tensors produced by branches and consumed
+// afterwards are passed to join(); both are marked with recordStream so
+// their memory is not reused until the cross-stream work has completed.
+class TORCH_CUDA_CPP_API CUDAForkJoinScope {
+ public:
+  explicit CUDAForkJoinScope(size_t max_streams = 4);
+  // Joins outstanding branches if join() has not been called.
+  ~CUDAForkJoinScope();
+
+  CUDAForkJoinScope(const CUDAForkJoinScope&) = delete;
+  CUDAForkJoinScope& operator=(const CUDAForkJoinScope&) = delete;
+  CUDAForkJoinScope(CUDAForkJoinScope&&) = delete;
+  CUDAForkJoinScope& operator=(CUDAForkJoinScope&&) = delete;
+
+  // Submits fn on the next side stream (round-robin over the pool). inputs
+  // are the tensors fn reads that were produced outside the scope. Must be
+  // called from the thread that created the scope.
+  void fork(TensorList inputs, const std::function<void()>& fn);
+
+  // Makes the parent stream wait for every branch and records outputs (the
+  // tensors produced inside branches that will be consumed afterwards) on
+  // the parent stream. No further fork() calls are allowed after join().
+  void join(TensorList outputs = {});
+
+ private:
+  CUDAStream parent_stream_;
+  // Records the parent stream's state at scope creation; every side stream
+  // waits on it before running its first branch.
+  CUDAEvent fork_event_;
+  // Side streams leased from the pool, grown lazily up to max_streams_.
+  std::vector<CUDAStream> streams_;
+  size_t max_streams_;
+  size_t next_stream_{0};
+  bool joined_{false};
+};
+
+} // namespace at::cuda
@@ -4,10 +4,13 @@
 #include <ATen/Functions.h>
 #include <c10/cuda/CUDACachingAllocator.h>
 #include <c10/cuda/CUDAFunctions.h>
+#include <c10/cuda/CUDAGuard.h>
+#include <c10/util/irange.h>
 
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
+#include <sstream>
 #include <thread>
 #include <vector>
 
@@ -328,4 +331,64 @@ CUDAGraph::~CUDAGraph() {
   reset();
 }
 
+std::string CUDAGraphCache::shapeKey(const std::vector<Tensor>& inputs) {
+  std::ostringstream key;
+  for (const auto& t : inputs) {
+    key << t.device() << ';' << t.scalar_type() << ';';
+    for (auto s : t.sizes()) {
+      key << s << ',';
+    }
+    key << ';';
+    for (auto s : t.strides()) {
+      key << s << ',';
+    }
+    key << '|';
+  }
+  return key.str();
+}
+
+std::vector<Tensor> CUDAGraphCache::run(
+    const GraphFn& fn,
+    const std::vector<Tensor>& inputs) {
+  auto key = shapeKey(inputs);
+  auto it = graphs_.find(key);
+  if (it == graphs_.end()) {
+    auto entry = std::make_unique<Entry>();
+    entry->static_inputs.reserve(inputs.size());
+    for (const auto& t : inputs) {
+      entry->static_inputs.push_back(t.clone());
+    }
+    // Capture may not run on the default stream.
+    auto capture_stream = c10::cuda::getStreamFromPool();
+    {
+      c10::cuda::CUDAStreamGuard guard(capture_stream);
+      // Warmup pass outside of capture so one-time lazy initialization
+      // (cuBLAS handles, autotuning, kernel compilation) is not baked into
+      // the graph.
+      fn(entry->static_inputs);
+      c10::cuda::device_synchronize();
+      // Each signature gets its own private mempool (the default for
+      // capture_begin); signatures replay in arbitrary order relative to
+      // one another, so sharing a pool across them would not be safe.
+      entry->graph.capture_begin();
+      entry->static_outputs = fn(entry->static_inputs);
+      entry->graph.capture_end();
+    }
+    it = graphs_.emplace(std::move(key), std::move(entry)).first;
+    return it->second->static_outputs;
+  }
+  auto& entry = *it->second;
+  TORCH_CHECK(
+      inputs.size() == entry.static_inputs.size(),
+      "CUDAGraphCache::run called with ",
+      inputs.size(),
+      " inputs but the cached capture for this signature has ",
+      entry.static_inputs.size());
+  for (const auto i : c10::irange(inputs.size())) {
+    entry.static_inputs[i].copy_(inputs[i], /*non_blocking=*/true);
+  }
+  entry.graph.replay();
+  return entry.static_outputs;
+}
+
 } // namespace at::cuda
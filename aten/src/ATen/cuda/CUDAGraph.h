@@ -6,6 +6,11 @@
 #include <c10/cuda/CUDAStream.h>
 #include <c10/util/flat_hash_map.h>
 
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
 namespace at {
 
 struct Generator;
@@ -89,5 +94,45 @@ struct TORCH_CUDA_CPP_API CUDAGraph {
   int capture_dev_;
 };
 
+// Shape-keyed cache of captured CUDA graphs.
+//
+// Wraps a callable so that each distinct input signature (device, dtype,
+// sizes, strides per tensor) is captured once into its own CUDAGraph with a
+// private mempool and replayed on every subsequent call, turning per-step
+// launch overhead into a single cudaGraphLaunch. The cache owns static
+// input/output buffers per signature; on a hit, the provided inputs are
+// copied into the static buffers before replay.
+struct TORCH_CUDA_CPP_API CUDAGraphCache {
+  using GraphFn = std::function<std::vector<Tensor>(const std::vector<Tensor>&)>;
+
+  // Runs fn on inputs. The first call with a given signature runs fn twice
+  // on a side stream (a warmup pass so one-time lazy initialization is not
+  // baked into the graph, then the capture pass); later calls copy inputs
+  // into the cached static buffers and replay. The returned tensors are the
+  // cached static outputs: they are overwritten by the next call with the
+  // same signature, so clone them if they must outlive it.
+  std::vector<Tensor> run(const GraphFn& fn, const std::vector<Tensor>& inputs);
+
+  // Number of distinct signatures captured so far.
+  size_t size() const {
+    return graphs_.size();
+  }
+
+  void clear() {
+    graphs_.clear();
+  }
+
+ private:
+  struct Entry {
+    CUDAGraph graph;
+    std::vector<Tensor> static_inputs;
+    std::vector<Tensor> static_outputs;
+  };
+
+  static std::string shapeKey(const std::vector<Tensor>& inputs);
+
+  ska::flat_hash_map<std::string, std::unique_ptr<Entry>> graphs_;
+};
+
 } // namespace cuda
 } // namespace at
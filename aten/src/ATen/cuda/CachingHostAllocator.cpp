@@ -6,8 +6,12 @@
 #include <ATen/detail/CUDAHooksInterface.h>
 #include <c10/core/thread_pool.h>
 #include <c10/cuda/CUDAAllocatorConfig.h>
+#include <c10/cuda/CUDAFunctions.h>
+#include <c10/util/numa.h>
 
 #include <cuda_runtime_api.h>
+#include <cctype>
+#include <fstream>
 #include <future>
 
 namespace at::cuda {
@@ -66,10 +70,59 @@ class EventPool {
   std::vector<PerDevicePool> pools_;
 };
 
-using Block = HostBlock<CUDAStream>;
+// Best-effort NUMA node of a CUDA device, resolved once per device from its
+// PCI bus id via sysfs. Returns -1 when the node is unknown (e.g. non-Linux,
+// single-socket, or lookup failure).
+int getDeviceNumaNode(DeviceIndex device) {
+  static std::mutex cache_mutex;
+  static ska::flat_hash_map<DeviceIndex, int> cache;
+  {
+    std::lock_guard<std::mutex> g(cache_mutex);
+    auto it = cache.find(device);
+    if (it != cache.end()) {
+      return it->second;
+    }
+  }
+
+  int node = -1;
+  char bus_id[32] = {};
+  if (cudaDeviceGetPCIBusId(bus_id, sizeof(bus_id), device) == cudaSuccess) {
+    // sysfs spells the bus id in lowercase hex.
+    for (char* c = bus_id; *c != '\0'; ++c) {
+      *c = static_cast<char>(std::tolower(static_cast<unsigned char>(*c)));
+    }
+    std::ifstream numa_file(
+        std::string("/sys/bus/pci/devices/") + bus_id + "/numa_node");
+    if (!(numa_file >> node)) {
+      node = -1;
+    }
+  } else {
+    (void)cudaGetLastError(); // clear CUDA error
+  }
+
+  std::lock_guard<std::mutex> g(cache_mutex);
+  cache.emplace(device, node);
+  return node;
+}
+
+// Remembers which pool the block came from, so deallocation can be routed
+// back to the owning pool when several per-NUMA-node pools are in use.
+struct CUDAHostBlock : public HostBlock<CUDAStream> {
+  using HostBlock<CUDAStream>::HostBlock;
+  size_t pool_index_{0};
+};
+
+using Block = CUDAHostBlock;
 
 struct CUDACachingHostAllocatorImpl
-    : public CachingHostAllocatorImpl<CUDAStream, EventPool::Event> {
+    : public CachingHostAllocatorImpl<
+          CUDAStream,
+          EventPool::Event,
+          CUDAHostBlock> {
+ public:
+  explicit CUDACachingHostAllocatorImpl(int numa_node = -1)
+      : numa_node_(numa_node) {}
+
  private:
   void allocate_host_memory(size_t size, void** ptr) override {
     // Pinned memory pointers allocated by any device can be directly used by
@@ -177,6 +230,14 @@ struct CUDACachingHostAllocatorImpl
     // can minimize the cost for the cuda global lock.
     *ptr = malloc(roundSize);
 
+    // Bind the range to this pool's NUMA node before the pages are faulted
+    // in, so the pre-fault below places them node-local to the devices this
+    // pool serves. (The cudaHostAlloc path offers no such control; its pages
+    // are placed by the driver.)
+    if (numa_node_ >= 0) {
+      c10::NUMAMove(*ptr, roundSize, numa_node_);
+    }
+
     // Parallelize the mapping/registering of pages to reduce wall time
     size_t pageSize = (1 << 12); // 4kB pages
     size_t numMapThreads = c10::cuda::CUDACachingAllocator::
@@ -221,20 +282,91 @@ struct CUDACachingHostAllocatorImpl
     // Register the mapped pages using cudaHostRegister
     registerPages(*ptr, roundSize);
   }
+
+  // NUMA node this pool allocates on; -1 means no affinity.
+  int numa_node_{-1};
 };
 
 void raw_local_deleter(void* ptr);
 
+// On multi-socket machines, pinned buffers faulted in on the wrong NUMA node
+// cost a large fraction of the attainable H2D bandwidth. When NUMA is
+// enabled, we therefore keep one pinned pool per node in addition to the
+// node-agnostic fallback pool (impl_), and route each allocation to the pool
+// of the current device's node -- the device the transfer will target in the
+// common pin_memory pattern. Every pool retains the usual event-deferred
+// recycling, so buffers are only reused for devices on their own node.
 struct CUDACachingHostAllocator final
     : public CachingHostAllocatorInterface<CUDACachingHostAllocatorImpl> {
+  CUDACachingHostAllocator() {
+    pools_.push_back(impl_.get());
+    if (c10::IsNUMAEnabled()) {
+      int num_nodes = c10::GetNumNUMANodes();
+      for (int node = 0; node < num_nodes; node++) {
+        numa_pools_.push_back(
+            std::make_unique<CUDACachingHostAllocatorImpl>(node));
+        pools_.push_back(numa_pools_.back().get());
+      }
+    }
+  }
+
   at::DataPtr allocate(size_t size) override {
-    auto ptr_and_ctx = impl_->allocate(size);
+    size_t pool_index = pool_index_for_current_device();
+    auto ptr_and_ctx = pools_[pool_index]->allocate(size);
+    if (ptr_and_ctx.second) {
+      reinterpret_cast<Block*>(ptr_and_ctx.second)->pool_index_ = pool_index;
+    }
     return {
         ptr_and_ctx.first,
         ptr_and_ctx.second,
         &raw_local_deleter,
         at::DeviceType::CPU};
   }
+
+  void free(void* ctx) {
+    if (!ctx) {
+      return;
+    }
+    // free is correctly paired with allocate, so the ctx is a live block and
+    // its pool index can be trusted.
+    auto* block = reinterpret_cast<Block*>(ctx);
+    pools_[block->pool_index_]->free(ctx);
+  }
+
+  bool record_event(void* ptr, void* ctx, CUDAStream stream) {
+    // The ctx may come from an arbitrary tensor rather than one of our
+    // blocks, so it cannot be dereferenced for routing; each pool validates
+    // membership itself.
+    for (auto* pool : pools_) {
+      if (pool->record_event(ptr, ctx, stream)) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  void empty_cache() {
+    for (auto* pool : pools_) {
+      pool->empty_cache();
+    }
+  }
+
+ private:
+  size_t pool_index_for_current_device() {
+    if (numa_pools_.empty()) {
+      return 0;
+    }
+    int node = getDeviceNumaNode(c10::cuda::current_device());
+    if (node < 0 || static_cast<size_t>(node) >= numa_pools_.size()) {
+      return 0;
+    }
+    return static_cast<size_t>(node) + 1;
+  }
+
+  // Per-NUMA-node pools; empty when NUMA is unavailable or disabled.
+  std::vector<std::unique_ptr<CUDACachingHostAllocatorImpl>> numa_pools_;
+  // All pools: the node-agnostic impl_ at index 0, then one per node.
+  std::vector<CUDACachingHostAllocatorImpl*> pools_;
 };
 
 CUDACachingHostAllocator caching_host_allocator;
@@ -23,6 +23,13 @@
 #include <c10/util/Float8_e5m2fnuz.h>
 #include <c10/util/StringUtil.h>
 
+#ifndef AT_PER_OPERATOR_HEADERS
+#include <ATen/Functions.h>
+#else
+#include <ATen/ops/from_blob.h>
+#include <ATen/ops/gelu.h>
+#endif
+
 #ifdef USE_ROCM
 #include <rocm-core/rocm_version.h>
 #endif
@@ -48,6 +55,63 @@ class DefaultGemmOp : public Callable<GemmParams<T>> {
     }
 };
 
+template <typename T>
+class DefaultGemmAndBiasOp : public Callable<GemmAndBiasParams<T>> {
+  public:
+    TuningStatus Call(const GemmAndBiasParams<T>* params) override {
+      at::cuda::blas::gemm_and_bias_internal<T>(
+          params->transa == 't' || params->transa == 'T',
+          params->transb == 't' || params->transb == 'T',
+          params->m, params->n, params->k,
+          params->alpha,
+          params->a, params->lda,
+          params->b, params->ldb,
+          params->bias,
+          params->c, params->ldc,
+          params->activation);
+      return OK;
+    }
+};
+
+// Computes the same result as the fused gemm_and_bias_internal using a plain
+// gemm followed by tensor-op epilogues. Registered as a candidate so tuning
+// can pick whichever of the fused cublasLt path or the cublas path wins for a
+// given problem.
+template <typename T>
+class UnfusedGemmAndBiasOp : public Callable<GemmAndBiasParams<T>> {
+  public:
+    TuningStatus Call(const GemmAndBiasParams<T>* params) override {
+      at::cuda::blas::gemm_internal<T>(
+          params->transa, params->transb,
+          params->m, params->n, params->k,
+          params->alpha,
+          params->a, params->lda,
+          params->b, params->ldb,
+          /*beta=*/at::opmath_type<T>(0),
+          params->c, params->ldc);
+      // gemm_and_bias_internal applies the epilogue only when a bias is given
+      if (params->bias != nullptr) {
+        auto options = at::TensorOptions()
+            .dtype(c10::CppTypeToScalarType<T>::value)
+            .device(at::kCUDA);
+        // the result is column-major m x n with leading dimension ldc
+        at::Tensor c = at::from_blob(
+            params->c, {params->n, params->m}, {params->ldc, 1}, options);
+        at::Tensor bias = at::from_blob(
+            const_cast<T*>(params->bias), {params->m}, options);
+        c.add_(bias);
+        if (params->activation == at::cuda::blas::GEMMAndBiasActivationEpilogue::RELU) {
+          c.relu_();
+        }
+        else if (params->activation == at::cuda::blas::GEMMAndBiasActivationEpilogue::GELU) {
+          // the cublasLt epilogue uses the tanh approximation
+          at::gelu_(c, "tanh");
+        }
+      }
+      return OK;
+    }
+};
+
 template <typename T>
 class DefaultGemmStridedBatchedOp : public Callable<GemmStridedBatchedParams<T>> {
   public:
@@ -269,6 +333,27 @@ class GemmTunableOp : public TunableOp<GemmParams<T>, StreamTimer> {
   }
 };
 
+template <typename T, BlasOp ALayout, BlasOp BLayout>
+class GemmAndBiasTunableOp : public TunableOp<GemmAndBiasParams<T>, StreamTimer> {
+ public:
+  GemmAndBiasTunableOp() {
+    this->RegisterOp(std::string("Default"), std::make_unique<DefaultGemmAndBiasOp<T>>());
+    this->RegisterOp(std::string("Unfused"), std::make_unique<UnfusedGemmAndBiasOp<T>>());
+
+#ifdef USE_ROCM
+    // the Default candidate is the hipblaslt epilogue path and the Unfused
+    // candidate goes through gemm_internal, i.e. rocblas
+    AddRocblasValidator();
+    AddHipblasltValidator();
+    AddRocmValidator();
+#endif
+  }
+
+  std::string Signature() override {
+    return c10::str("GemmAndBiasTunableOp_", TypeName<T>(T{}), "_", BlasOpToString(ALayout), BlasOpToString(BLayout));
+  }
+};
+
 template <typename T, BlasOp ALayout, BlasOp BLayout>
 class GemmStridedBatchedTunableOp : public TunableOp<GemmStridedBatchedParams<T>, StreamTimer> {
  public:
@@ -17,6 +17,10 @@
 #include <c10/util/llvmMathExtras.h>
 #include <c10/util/irange.h>
 
+#include <chrono>
+#include <mutex>
+#include <unordered_map>
+
 namespace at::functorch {
 
 bool kVmapFallbackWarningEnabled = true;
@@ -39,6 +43,60 @@ void setVmapFallbackEnabled(bool enabled) {
   kVmapFallbackEnabled = enabled;
 }
 
+bool kVmapFallbackStatsEnabled = false;
+
+namespace {
+struct FallbackStatsEntry {
+  int64_t calls = 0;
+  int64_t total_ns = 0;
+};
+std::mutex fallback_stats_mutex;
+std::unordered_map<std::string, FallbackStatsEntry> fallback_stats;
+} // namespace
+
+bool isVmapFallbackStatsEnabled() {
+  return kVmapFallbackStatsEnabled;
+}
+
+void setVmapFallbackStatsEnabled(bool enabled) {
+  kVmapFallbackStatsEnabled = enabled;
+}
+
+std::vector<VmapFallbackStat> getVmapFallbackStats() {
+  std::vector<VmapFallbackStat> result;
+  {
+    std::lock_guard<std::mutex> guard(fallback_stats_mutex);
+    result.reserve(fallback_stats.size());
+    for (const auto& entry : fallback_stats) {
+      result.push_back({entry.first, entry.second.calls, entry.second.total_ns});
+    }
+  }
+  std::sort(result.begin(), result.end(),
+      [](const VmapFallbackStat& a, const VmapFallbackStat& b) {
+        return a.total_ns > b.total_ns;
+      });
+  return result;
+}
+
+void resetVmapFallbackStats() {
+  std::lock_guard<std::mutex> guard(fallback_stats_mutex);
+  fallback_stats.clear();
+}
+
+static void recordFallbackStat(
+    const c10::FunctionSchema& schema,
+    std::chrono::steady_clock::time_point start) {
+  if (!kVmapFallbackStatsEnabled) {
+    return;
+  }
+  const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::steady_clock::now() - start).count();
+  std::lock_guard<std::mutex> guard(fallback_stats_mutex);
+  auto& entry = fallback_stats[toString(schema.operator_name())];
+  entry.calls++;
+  entry.total_ns += ns;
+}
+
 // Given a linear index, return the actual index.
 // Example: Given linear_idx = 3, sizes = [5, 2], we would return [1, 0]
 static at::SmallVector<indexing::TensorIndex,kVmapStaticDimVecSize>
@@ -98,6 +156,7 @@ static void warnFallback(const c10::FunctionSchema& schema, bool is_inplace, boo
 static void batchedTensorInplaceForLoopFallback(const c10::OperatorHandle& op, torch::jit::Stack* stack) {
   const auto& schema = op.schema();
   warnFallback(schema, /*in_place*/true);
+  const auto start_time = std::chrono::steady_clock::now();
 
   const auto num_arguments = schema.arguments().size();
   const auto arguments = torch::jit::last(stack, num_arguments);
@@ -212,6 +271,7 @@ static void batchedTensorInplaceForLoopFallback(const c10::OperatorHandle& op, t
   // Return the tensor that was written to in-place
   torch::jit::drop(stack, num_arguments);
   torch::jit::push(stack, self);
+  recordFallbackStat(schema, start_time);
 }
 
 static Tensor safeStack(TensorList tensors) {
@@ -283,6 +343,7 @@ void batchedTensorForLoopFallback(const c10::OperatorHandle& op, torch::jit::Sta
               "Batching rule not implemented for ", schema.operator_name(), ". ",
               "The fallback path does not support operations with no returns.");
   warnFallback(schema, /*in_place*/false);
+  const auto start_time = std::chrono::steady_clock::now();
 
   const auto arguments_begin = stack->size() - num_arguments;
 
@@ -394,6 +455,7 @@ void batchedTensorForLoopFallback(const c10::OperatorHandle& op, torch::jit::Sta
         stack,
         input_physical_views.front().getPhysicalToLogicalMap().apply(flat_output.view(output_sizes)));
   }
+  recordFallbackStat(schema, start_time);
 }
 
 void batchedNestedTensorForLoopFallback(const c10::OperatorHandle& op, torch::jit::Stack* stack) {
@@ -424,6 +486,7 @@ void batchedNestedTensorForLoopFallback(const c10::OperatorHandle& op, torch::ji
               "Nested batching rule not implemented for ", schema.operator_name(), ". ",
               "The fallback path does not support operations with no returns.");
   warnFallback(schema, /*in_place*/false, /*is_nested*/true);
+  const auto start_time = std::chrono::steady_clock::now();
 
   const auto arguments_begin = stack->size() - num_arguments;
 
@@ -507,6 +570,7 @@ void batchedNestedTensorForLoopFallback(const c10::OperatorHandle& op, torch::ji
     // NB: NTs only support batching over dim 0
     torch::jit::push(stack, makeBatched(out_nt, 0, maybeCurrentDynamicLayer()->layerId()));
   }
+  recordFallbackStat(schema, start_time);
 }
 
 void vmapErrorFallback(const c10::OperatorHandle& op, torch::jit::Stack* stack) {
@@ -44,6 +44,21 @@ TORCH_API void setVmapFallbackWarningEnabled(bool enabled);
 TORCH_API bool isVmapFallbackEnabled();
 TORCH_API void setVmapFallbackEnabled(bool enabled);
 
+// Optional instrumentation for the vmap fallback. When enabled, every
+// fallback hit records the operator name, the number of calls, and the time
+// spent in the per-sample loop, so users can see which missing batching
+// rules cost them the most.
+struct VmapFallbackStat {
+  std::string op_name;
+  int64_t calls;
+  int64_t total_ns;
+};
+TORCH_API bool isVmapFallbackStatsEnabled();
+TORCH_API void setVmapFallbackStatsEnabled(bool enabled);
+// Returns the recorded stats, most expensive (by total time) first.
+TORCH_API std::vector<VmapFallbackStat> getVmapFallbackStats();
+TORCH_API void resetVmapFallbackStats();
+
 template <typename A> A vector_to_result(const std::vector<IValue>& buffer) {
   return buffer[0].to<A>();
 }
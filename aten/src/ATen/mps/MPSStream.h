@@ -95,6 +95,10 @@ private:
   dispatch_queue_t _serialQueue = nullptr;
   // CommitAndContinue is enabled by default
   bool _enableCommitAndContinue = true;
+  // number of ops encoded into the current command buffer since the last
+  // commit; used by COMMIT_ADAPTIVE to keep the GPU fed (see constructor)
+  uint32_t _pendingOps = 0;
+  uint32_t _commitThreshold = 0;
 
   // use synchronize() to access any of these commit functions outside MPSStream
   void commit();
@@ -27,6 +27,16 @@ MPSStream::MPSStream(Stream stream) : _stream(stream) {
   }
   _executionDescriptor.enableCommitAndContinue = _enableCommitAndContinue;
 
+  // With CommitAndContinue, committing every few ops just pipelines the
+  // already-encoded work to the GPU while encoding continues on the CPU.
+  // COMMIT_ADAPTIVE otherwise only commits under memory pressure, which can
+  // leave the GPU idle behind a large unsubmitted command buffer. The
+  // threshold is the number of encoded ops per submission (0 disables it).
+  static const char* commit_threshold_str = getenv("PYTORCH_MPS_COMMIT_THRESHOLD");
+  if (_enableCommitAndContinue) {
+    _commitThreshold = commit_threshold_str ? strtol(commit_threshold_str, nullptr, 0) : 100;
+  }
+
   // Choose level which optimizes for GPU
   _compilationDescriptor.optimizationLevel = MPSGraphOptimizationLevel0;
   _executionDescriptor.compilationDescriptor = _compilationDescriptor;
@@ -69,8 +79,11 @@ void MPSStream::synchronize(SyncType syncType) {
       commit();
       break;
     case SyncType::COMMIT_ADAPTIVE:
-      // the adaptive commit only commits if we hit the low watermark memory threshold
-      if (getIMPSAllocator()->getLowWatermarkValue() <= 1) {
+      // the adaptive commit only commits if we hit the low watermark memory
+      // threshold, or if enough ops accumulated in the current command buffer
+      // to be worth submitting to the GPU (see constructor)
+      if (getIMPSAllocator()->getLowWatermarkValue() <= 1 ||
+          (_commitThreshold > 0 && _pendingOps >= _commitThreshold)) {
         commit();
       }
       break;
@@ -91,6 +104,7 @@ void MPSStream::commit() {
   } else {
     flush();
   }
+  _pendingOps = 0;
 }
 
 void MPSStream::commitAndWait() {
@@ -108,6 +122,7 @@ void MPSStream::commitAndWait() {
     [_commandBuffer release];
     _commandBuffer = nil;
   }
+  _pendingOps = 0;
 }
 
 void MPSStream::commitAndContinue() {
@@ -120,6 +135,8 @@ void MPSStream::endKernelCoalescing() {
     [_commandEncoder endEncoding];
     [_commandEncoder release];
     _commandEncoder = nil;
+    // one encoder holds a batch of coalesced kernels; count it as one op
+    _pendingOps++;
   }
 }
 
@@ -156,6 +173,7 @@ void MPSStream::fill(id<MTLBuffer> buffer, uint8_t value, size_t length, size_t
 
       [blitEncoder fillBuffer:buffer range:NSMakeRange(offset, length) value:value];
       [blitEncoder endEncoding];
+      _pendingOps++;
       synchronize(syncType);
     }
   });
@@ -190,6 +208,7 @@ void MPSStream::copy(id<MTLBuffer> srcBuffer,
         bytes_remains -= bytes_to_copy;
       }
       [blitEncoder endEncoding];
+      _pendingOps++;
 
       // profilerId has a value only if copy profiling is enabled
       if (profileId) {
@@ -234,6 +253,7 @@ void MPSStream::executeMPSGraph(MPSGraph* mpsGraph, NSDictionary* feeds, NSDicti
                    targetOperations:nil
                   resultsDictionary:results
                 executionDescriptor:_executionDescriptor];
+    _pendingOps++;
 
     SyncType _syncType = syncType;
     // if commitAndContinue is disabled, we need to always commit manually after encoding
@@ -111,6 +111,22 @@ CBLAS_TRANSPOSE to_apple_accelerate_transpose(TransposeType trans) {
 }  // namespace (anonymous)
 
 DEFINE_DISPATCH(gemm_stub);
+DEFINE_DISPATCH(small_gemm_batched_stub);
+
+bool could_use_small_gemm_batched(
+    at::ScalarType type,
+    int64_t batch_size, int64_t m, int64_t n, int64_t k) {
+  // Each matrix must fit comfortably in L1 so the microkernel keeps its
+  // accumulators in registers, and the batch must be large enough that
+  // per-call BLAS setup is the dominant cost. The dimension threshold of 64
+  // has not been thoroughly benchmarked and may depend on the CPU.
+  constexpr int64_t max_dim = 64;
+  constexpr int64_t min_batch = 16;
+  return (type == kFloat || type == kDouble) &&
+      batch_size >= min_batch &&
+      m >= 1 && n >= 1 && k >= 1 &&
+      m <= max_dim && n <= max_dim && k <= max_dim;
+}
 
 void gemm(
     TransposeType transa, TransposeType transb,
@@ -574,6 +590,19 @@ void gemm_batched_with_stride(
     return gemm(transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
   }
 
+  if constexpr (std::is_same_v<scalar_t, float> || std::is_same_v<scalar_t, double>) {
+    if (could_use_small_gemm_batched(
+            c10::CppTypeToScalarType<scalar_t>::value, batch_size, m, n, k)) {
+      internal::normalize_last_dims(transa, transb, m, n, k, &lda, &ldb, &ldc);
+      small_gemm_batched_stub(
+          kCPU, c10::CppTypeToScalarType<scalar_t>::value,
+          transa, transb, batch_size, m, n, k, alpha,
+          a, lda, batch_stride_a, b, ldb, batch_stride_b,
+          beta, c, ldc, batch_stride_c);
+      return;
+    }
+  }
+
   if constexpr (AT_MKL_ENABLED() && is_blas_library_type<scalar_t>::value) {
     internal::normalize_last_dims(transa, transb, m, n, k, &lda, &ldb, &ldc);
     if (use_blas_gemm(transa, transb, m, n, k, lda, ldb, ldc)) {
@@ -144,6 +144,30 @@ void gemm_batched_with_stride(
     scalar_t beta,
     scalar_t *c, int64_t ldc, int64_t batch_stride_c);
 
+using small_gemm_batched_fn = void(*)(
+    at::ScalarType type,
+    TransposeType transa, TransposeType transb,
+    int64_t batch_size, int64_t m, int64_t n, int64_t k,
+    const Scalar& alpha,
+    const void *a, int64_t lda, int64_t batch_stride_a,
+    const void *b, int64_t ldb, int64_t batch_stride_b,
+    const Scalar& beta,
+    void *c, int64_t ldc, int64_t batch_stride_c);
+
+// Batch-parallel kernel for large batches of small GEMMs, where a BLAS
+// library call per matrix is dominated by call setup cost. Partitions the
+// batch dimension with at::parallel_for and runs a tiled microkernel per
+// matrix. Registered in cpu/BlasKernel.cpp.
+DECLARE_DISPATCH(small_gemm_batched_fn, small_gemm_batched_stub);
+
+// Whether gemm_batched_with_stride will route this problem shape to
+// small_gemm_batched_stub instead of a per-batch BLAS call. Also used by
+// bmm/baddbmm to take the batched-gemm path even when no BLAS library is
+// available.
+bool could_use_small_gemm_batched(
+    at::ScalarType type,
+    int64_t batch_size, int64_t m, int64_t n, int64_t k);
+
 using axpy_fn = void(*)(at::ScalarType type, int64_t n, const Scalar& a, const void *x, int64_t incx, void *y, int64_t incy);
 
 DECLARE_DISPATCH(axpy_fn, axpy_stub);
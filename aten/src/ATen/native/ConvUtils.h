@@ -96,6 +96,7 @@ enum class ConvBackend {
   CudaDepthwise3d,
   Cudnn,
   CudnnTranspose,
+  DirectNhwc2d,
   Empty,
   Miopen,
   MiopenDepthwise,
@@ -7,6 +7,7 @@
 #include <ATen/native/ConvUtils.h>
 #include <ATen/native/Pool.h>
 #include <ATen/native/cpu/DepthwiseConvKernel.h>
+#include <ATen/native/cpu/DirectConv2dKernel.h>
 #include <ATen/native/utils/ParamUtils.h>
 #include <ATen/native/xnnpack/Engine.h>
 #include <c10/core/GradMode.h>
@@ -393,6 +394,44 @@ struct ConvParams {
 #endif
   }
 
+  // Small-spatial channels-last shapes (late-stage CNN feature maps) at
+  // batch 1 are latency bound, and both im2col + GEMM and the GEMM-library
+  // backends pick throughput-oriented blockings for them. See
+  // Note [Direct NHWC convolution] in cpu/DirectConv2dKernel.cpp.
+  bool use_cpu_direct_nhwc(const at::Tensor& input, const at::Tensor& weight) const {
+    constexpr int64_t max_kernel_size = 7;
+    constexpr int64_t max_output_plane = 8 * 8;
+    if (!((input.ndimension() == 4) &&
+          (weight.ndimension() == 4) &&
+          (input.layout() == c10::kStrided) &&
+          (weight.layout() == c10::kStrided) &&
+          (input.device().is_cpu()) &&
+          (input.scalar_type() == at::kFloat) &&
+          (weight.device().is_cpu()) &&
+          (weight.scalar_type() == at::kFloat) &&
+          thnn_conv_use_channels_last(input, weight) &&
+          !transposed &&
+          (groups == 1) &&
+          !is_dilated() &&
+          !is_padding_neg())) {
+      return false;
+    }
+    for (const auto& s : stride) {
+      if (s != 1 && s != 2) {
+        return false;
+      }
+    }
+    if ((at::symint::size<T>(input, 0) != 1) ||
+        (at::symint::size<T>(weight, 2) > max_kernel_size) ||
+        (at::symint::size<T>(weight, 3) > max_kernel_size)) {
+      return false;
+    }
+    const auto output_size = conv_output_size(
+        at::symint::sizes<T>(input), at::symint::sizes<T>(weight), padding, stride, dilation);
+    return (output_size[2] >= 1) && (output_size[3] >= 1) &&
+        (output_size[2] * output_size[3] <= max_output_plane);
+  }
+
   bool needs_64bit_indexing_no_split(const at::Tensor& input, const at::Tensor& weight) const {
     constexpr int64_t int_max = std::numeric_limits<int>::max();
     auto numel_input = at::symint::numel<T>(input);
@@ -613,6 +652,7 @@ DEFINE_DISPATCH(cudnn_convolution_backward_stub);
 DEFINE_DISPATCH(cudnn_convolution_transpose_backward_stub);
 DEFINE_DISPATCH(slow_conv_transpose3d_backward_stub);
 DEFINE_DISPATCH(convolution_depthwise3x3_winograd_stub);
+DEFINE_DISPATCH(convolution_direct_nhwc_stub);
 DEFINE_DISPATCH(miopen_convolution_backward_stub);
 DEFINE_DISPATCH(miopen_convolution_transpose_backward_stub);
 DEFINE_DISPATCH(miopen_depthwise_convolution_backward_stub);
@@ -1235,6 +1275,10 @@ ConvBackend _select_conv_backend(
     } else {
       return ConvBackend::Miopen;
     }
+  // The direct NHWC kernel is inference only; it beats GEMM-library
+  // heuristics for batch-1 small-spatial shapes, so check it first.
+  } else if (!need_backward && params.use_cpu_direct_nhwc(input, weight)) {
+    return ConvBackend::DirectNhwc2d;
   } else if (params.use_mkldnn(input, weight)) {
     if (params.transposed) {
       return ConvBackend::MkldnnTranspose;
@@ -1441,6 +1485,9 @@ static inline at::MemoryFormat determine_backend_memory_format(
         backend_memory_format = at::MemoryFormat::ChannelsLast;
       }
       break;
+    case ConvBackend::DirectNhwc2d:
+      backend_memory_format = at::MemoryFormat::ChannelsLast;
+      break;
     case ConvBackend::Overrideable:
       if (xpu_conv_use_channels_last(input, weight)) {
         backend_memory_format = (k == 5) ? at::MemoryFormat::ChannelsLast3d : at::MemoryFormat::ChannelsLast;
@@ -1630,6 +1677,15 @@ at::Tensor _convolution(
       output = convolution_depthwise3x3_winograd_stub(
           input.device().type(), input, weight, bias, params.stride, params.padding, params.groups);
       break;
+    case ConvBackend::DirectNhwc2d:
+      check_input_same_type_as_parameters(input, weight, bias);
+      output = convolution_direct_nhwc_stub(
+          input.device().type(),
+          input.contiguous(backend_memory_format),
+          weight.contiguous(backend_memory_format),
+          bias.defined() ? bias.contiguous() : bias,
+          params.stride, params.padding);
+      break;
     case ConvBackend::Xnnpack2d:
       output = xnnpack::convolution2d(
           input, weight, bias, params.padding, params.stride, params.dilation, params.groups);
@@ -2244,6 +2300,9 @@ std::tuple<Tensor, Tensor, Tensor> convolution_backward(
       break;
     }
     // Backward is not supported for these backends.
+    case ConvBackend::DirectNhwc2d:
+      TORCH_CHECK(false, "Backward is not supported for direct NHWC convolution");
+      break;
     case ConvBackend::Winograd3x3Depthwise:
       TORCH_CHECK(false, "Backward is not supported for depthwise 3x3 winograd");
       break;
@@ -7,8 +7,14 @@
 #if !defined(__s390x__) && !defined(__powerpc__)
 #include <cpuinfo.h>
 #endif
+#include <algorithm>
 #include <cstdlib>
 #include <cstring>
+#include <fstream>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <unordered_map>
 
 #ifdef HAVE_ZVECTOR_CPU_DEFINITION
 #include <sys/auxv.h>
@@ -91,8 +97,118 @@ CPUCapability get_cpu_capability() {
   return capability;
 }
 
+// Note [Per-kernel CPU capability overrides]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// ATEN_CPU_CAPABILITY selects one capability level process-wide, but kernels
+// do not all peak at the same level: on AVX-512 parts with aggressive
+// downclocking some kernels regress at AVX-512 while others gain from it.
+// ATEN_CPU_CAPABILITY_OVERRIDES pins individual stubs to a level, e.g.
+//
+//   ATEN_CPU_CAPABILITY_OVERRIDES="norm_stub=avx2,add_stub=default"
+//
+// and ATEN_CPU_CAPABILITY_OVERRIDES_FILE names a file with one
+// `<stub_name>=<capability>` pair per line (`#` starts a comment), so that a
+// table produced by benchmarking each stub once per level (sweeping
+// ATEN_CPU_CAPABILITY offline) can be cached on disk and shipped fleet-wide.
+// Keys are the stub names used with DECLARE_DISPATCH. Overrides can only
+// lower the dispatch level: they are clamped to the detected capability so a
+// stale table cannot select instructions the host does not support. Each
+// stub reads the table at most once, on its first CPU dispatch, after which
+// the chosen pointer is cached as before.
+
+static std::optional<CPUCapability> parse_cpu_capability(const std::string& value) {
+#if defined(HAVE_VSX_CPU_DEFINITION)
+  if (value == "vsx") {
+    return CPUCapability::VSX;
+  }
+#elif defined(HAVE_ZVECTOR_CPU_DEFINITION)
+  if (value == "zvector") {
+    return CPUCapability::ZVECTOR;
+  }
+#else
+#ifdef HAVE_AVX512_CPU_DEFINITION
+  if (value == "avx512") {
+    return CPUCapability::AVX512;
+  }
+#endif
+#ifdef HAVE_AVX2_CPU_DEFINITION
+  if (value == "avx2") {
+    return CPUCapability::AVX2;
+  }
+#endif
+#endif
+  if (value == "default") {
+    return CPUCapability::DEFAULT;
+  }
+  return std::nullopt;
+}
+
+static void parse_capability_override_entry(
+    const std::string& entry,
+    const char* source,
+    std::unordered_map<std::string, CPUCapability>& overrides) {
+  const auto sep = entry.find('=');
+  if (sep != std::string::npos) {
+    const auto capability = parse_cpu_capability(entry.substr(sep + 1));
+    if (capability.has_value()) {
+      overrides[entry.substr(0, sep)] = *capability;
+      return;
+    }
+  }
+  TORCH_WARN("ignoring invalid entry in ", source, ": ", entry);
+}
+
+static std::unordered_map<std::string, CPUCapability> compute_cpu_capability_overrides() {
+  std::unordered_map<std::string, CPUCapability> overrides;
+  if (auto envar = std::getenv("ATEN_CPU_CAPABILITY_OVERRIDES_FILE")) {
+    std::ifstream file(envar);
+    if (!file) {
+      TORCH_WARN("could not open ATEN_CPU_CAPABILITY_OVERRIDES_FILE: ", envar);
+    }
+    std::string line;
+    while (std::getline(file, line)) {
+      line = line.substr(0, line.find('#'));
+      // Trim surrounding whitespace so hand-edited tables are forgiving
+      const auto begin = line.find_first_not_of(" \t\r");
+      if (begin == std::string::npos) {
+        continue;
+      }
+      const auto end = line.find_last_not_of(" \t\r");
+      parse_capability_override_entry(
+          line.substr(begin, end - begin + 1),
+          "ATEN_CPU_CAPABILITY_OVERRIDES_FILE",
+          overrides);
+    }
+  }
+  if (auto envar = std::getenv("ATEN_CPU_CAPABILITY_OVERRIDES")) {
+    std::istringstream stream(envar);
+    std::string entry;
+    while (std::getline(stream, entry, ',')) {
+      if (!entry.empty()) {
+        parse_capability_override_entry(
+            entry, "ATEN_CPU_CAPABILITY_OVERRIDES", overrides);
+      }
+    }
+  }
+  return overrides;
+}
+
+static int effective_cpu_capability(const char* name) {
+  static const std::unordered_map<std::string, CPUCapability> overrides =
+      compute_cpu_capability_overrides();
+  const auto capability = static_cast<int>(get_cpu_capability());
+  if (name != nullptr && !overrides.empty()) {
+    const auto it = overrides.find(name);
+    if (it != overrides.end()) {
+      return std::min(capability, static_cast<int>(it->second));
+    }
+  }
+  return capability;
+}
+
 DispatchResult DispatchStubImpl::try_get_call_ptr(
   const DeviceType device_type
+  , const char *name
   , void *DEFAULT
 #ifdef HAVE_AVX512_CPU_DEFINITION
   , void *AVX512
@@ -125,7 +241,8 @@ DispatchResult DispatchStubImpl::try_get_call_ptr(
       auto fptr = cpu_dispatch_ptr.load(std::memory_order_relaxed);
       if (!fptr) {
         auto result = try_choose_cpu_impl(
-          DEFAULT
+          name
+          , DEFAULT
 #ifdef HAVE_AVX512_CPU_DEFINITION
           , AVX512
 #endif
@@ -169,6 +286,7 @@ DispatchResult DispatchStubImpl::try_get_call_ptr(
 
 void* DispatchStubImpl::get_call_ptr(
   const DeviceType device_type
+  , const char *name
   , void *DEFAULT
 #ifdef HAVE_AVX512_CPU_DEFINITION
   , void *AVX512
@@ -186,6 +304,7 @@ void* DispatchStubImpl::get_call_ptr(
 
   auto result = try_get_call_ptr(
       device_type,
+      name,
       DEFAULT
 #ifdef HAVE_AVX512_CPU_DEFINITION
       ,
@@ -221,7 +340,8 @@ void* DispatchStubImpl::get_call_ptr(
 }
 
 DispatchResult DispatchStubImpl::try_choose_cpu_impl(
-    void *DEFAULT
+    const char *name
+    , void *DEFAULT
 #ifdef HAVE_AVX512_CPU_DEFINITION
     , void *AVX512
 #endif
@@ -236,7 +356,7 @@ DispatchResult DispatchStubImpl::try_choose_cpu_impl(
 #endif
   ){
 
-  auto capability = static_cast<int>(get_cpu_capability());
+  auto capability = effective_cpu_capability(name);
   (void)capability;
 #ifdef HAVE_AVX512_CPU_DEFINITION
   if (capability >= static_cast<int>(CPUCapability::AVX512)) {
@@ -270,7 +390,8 @@ DispatchResult DispatchStubImpl::try_choose_cpu_impl(
 }
 
 void* DispatchStubImpl::choose_cpu_impl(
-  void *DEFAULT
+  const char *name
+  , void *DEFAULT
 #ifdef HAVE_AVX512_CPU_DEFINITION
   , void *AVX512
 #endif
@@ -284,7 +405,7 @@ void* DispatchStubImpl::choose_cpu_impl(
   , void *ZVECTOR
 #endif
 ) {
-  auto capability = static_cast<int>(get_cpu_capability());
+  auto capability = effective_cpu_capability(name);
   (void)capability;
 #ifdef HAVE_AVX512_CPU_DEFINITION
   if (capability >= static_cast<int>(CPUCapability::AVX512)) {
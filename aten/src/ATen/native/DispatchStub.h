@@ -16,6 +16,11 @@
 // the fastest available kernel is chosen based on the features reported by
 // cpuinfo.
 //
+// The process-wide capability picked by get_cpu_capability() can be lowered
+// for individual kernels through ATEN_CPU_CAPABILITY_OVERRIDES (see
+// Note [Per-kernel CPU capability overrides] in DispatchStub.cpp); each stub
+// consults the override table once, on its first CPU dispatch.
+//
 // Example:
 //
 // In native/MyKernel.h:
@@ -98,6 +103,7 @@ struct TORCH_API DispatchStubImpl {
   // try_get_call_ptr() will return the ErrorType and not raise an exception.
   DispatchResult try_get_call_ptr(
     c10::DeviceType device_type
+    , const char *name
     , void *DEFAULT
 #ifdef HAVE_AVX512_CPU_DEFINITION
       , void *AVX512
@@ -116,7 +122,8 @@ struct TORCH_API DispatchStubImpl {
   // Analogous to try_get_call_ptr(), but it will return the ErrorType and not
   // raise an exception.
   DispatchResult try_choose_cpu_impl(
-    void *DEFAULT
+    const char *name
+    , void *DEFAULT
 #ifdef HAVE_AVX512_CPU_DEFINITION
     , void *AVX512
 #endif
@@ -134,6 +141,7 @@ struct TORCH_API DispatchStubImpl {
 
   void* get_call_ptr(
     c10::DeviceType device_type
+    , const char *name
     , void *DEFAULT
 #ifdef HAVE_AVX512_CPU_DEFINITION
       , void *AVX512
@@ -155,7 +163,8 @@ struct TORCH_API DispatchStubImpl {
    * DispatchStubImpl::get_call_ptr() in cpu_dispatch_ptr.
    */
   void* choose_cpu_impl(
-    void *DEFAULT
+    const char *name
+    , void *DEFAULT
 #ifdef HAVE_AVX512_CPU_DEFINITION
     , void *AVX512
 #endif
@@ -199,6 +208,7 @@ private:
   FnPtr get_call_ptr(const c10::DeviceType device_type) {
     return reinterpret_cast<FnPtr>(
       impl.get_call_ptr(device_type
+      , T::stub_name
       , reinterpret_cast<void*>(DEFAULT)
 #ifdef HAVE_AVX512_CPU_DEFINITION
       , reinterpret_cast<void*>(AVX512)
@@ -243,6 +253,7 @@ public:
   // type.
   bool is_device_supported(const c10::DeviceType device_type) {
     auto result = impl.try_get_call_ptr(device_type
+      , T::stub_name
       , reinterpret_cast<void*>(DEFAULT)
 #ifdef HAVE_AVX512_CPU_DEFINITION
       , reinterpret_cast<void*>(AVX512)
@@ -321,6 +332,7 @@ struct RegisterPRIVATEUSE1Dispatch {
     name##_DECLARE_DISPATCH_type() = default;                                              \
     name##_DECLARE_DISPATCH_type(const name##_DECLARE_DISPATCH_type&) = delete;            \
     name##_DECLARE_DISPATCH_type& operator=(const name##_DECLARE_DISPATCH_type&) = delete; \
+    static constexpr const char* stub_name = #name;                                        \
   };                                                                                       \
   extern TORCH_API struct name##_DECLARE_DISPATCH_type name;
 
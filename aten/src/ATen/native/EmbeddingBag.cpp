@@ -54,6 +54,19 @@ namespace {
   const int MODE_SUM = 0;
   const int MODE_MEAN = 1;
   const int MODE_MAX = 2;
+
+  // Software prefetch for upcoming embedding rows; the gather pattern defeats
+  // the hardware prefetcher once the table spills out of the L2 cache.
+  C10_ALWAYS_INLINE void prefetch_row(const void* addr) {
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(addr, /*rw=*/0, /*locality=*/3);
+#else
+    (void)addr;
+#endif
+  }
+
+  // How many lookups to keep in flight in the non-fast-path gather loops.
+  constexpr int64_t kEmbeddingPrefetchDistance = 8;
 }
 
 namespace at::native {
@@ -477,6 +490,13 @@ index_select_add(const Tensor &select_indices,
     auto output_stride1 = output.strides()[1];
     auto numel = add_indices.numel();
     for (const auto i : c10::irange(numel)) {
+      // Prefetch upcoming rows so the axpy below isn't stalled on the gather.
+      if (i + kEmbeddingPrefetchDistance < numel) {
+        auto ahead = select_indices_data[i + kEmbeddingPrefetchDistance];
+        if (ahead >= 0 && ahead < vocab_size && ahead != padding_idx) {
+          prefetch_row(src_data + src_stride0 * ahead);
+        }
+      }
       // We can skip indices equal to padding_idx so they are not included in
       // the reduction
       auto idx = select_indices_data[i];
@@ -859,8 +879,18 @@ index_select_scale_add(const Tensor &select_indices,
     auto scale_stride = scale.strides()[0];
     auto numel = add_indices.numel();
 
-
+    // Keep several lookups in flight: prefetch the rows a few iterations
+    // ahead and use vectorized fused multiply-add when both rows are dense,
+    // so the padded/strided path is not a pure scalar gather.
+    const bool dense_rows = src_stride1 == 1 && output_stride1 == 1;
+    using Vec = vec::Vectorized<float>;
     for (const auto i : c10::irange(numel)) {
+      if (i + kEmbeddingPrefetchDistance < numel) {
+        auto ahead = select_indices_data[i + kEmbeddingPrefetchDistance];
+        if (ahead >= 0 && ahead < vocab_size && ahead != padding_idx) {
+          prefetch_row(src_data + src_stride0 * ahead);
+        }
+      }
       // We can skip indices equal to padding_idx so they are not included in
       // the reduction
       auto idx = select_indices_data[i];
@@ -872,8 +902,21 @@ index_select_scale_add(const Tensor &select_indices,
         auto* src_base = src_data + src_stride0 * idx;
         auto* output_base = output_data + output_stride0 * add_indices_data[i];
         auto scale = scale_data[i * scale_stride];
-        for (const auto j : c10::irange(ddim)) {
-          output_base[j * output_stride1] += src_base[j * src_stride1] * scale;
+        if (dense_rows) {
+          const Vec scale_vec(scale);
+          int64_t j = 0;
+          for (; j + Vec::size() <= ddim; j += Vec::size()) {
+            auto out_vec = Vec::loadu(output_base + j);
+            vec::fmadd(Vec::loadu(src_base + j), scale_vec, out_vec)
+                .store(output_base + j);
+          }
+          for (; j < ddim; j++) {
+            output_base[j] += src_base[j] * scale;
+          }
+        } else {
+          for (const auto j : c10::irange(ddim)) {
+            output_base[j * output_stride1] += src_base[j * src_stride1] * scale;
+          }
         }
       } else if (bag_size.defined()) {
         // Decrement bag_size to reflect that the index is padded
@@ -1562,46 +1605,120 @@ void _embedding_bag_dense_backward_cpu_sum_mean(
     auto next_unique_index_idx =
         compute_counts_uniq(num_weights, indices_data, numel, counts);
 
+    const int64_t ddim = grad.size(1);
+    auto igwd = index_grad_weight.data_ptr<scalar_t>();
+    auto gd = grad.const_data_ptr<scalar_t>();
+    const int64_t num_segments = (int64_t)next_unique_index_idx.size();
+
+    // Accumulates sorted positions [pos_begin, pos_end) of segment `seg` into
+    // `out` (a row accumulator of width ddim).
+    auto accumulate_segment =
+      [&indices_data, &offset2bag_data, &bag_size_data, &per_sample_weights,
+        &mode, &per_sample_weights_data, &per_sample_weights_stride,
+        &scale_grad_by_freq, &counts, &ddim, &gd
+      ](index_t seg, index_t pos_begin, index_t pos_end, scalar_t* out) {
+      for (index_t j = pos_begin; j < pos_end; j++) {
+        index_t source = offset2bag_data[j];
+        double scale = 1.0;
+        if (per_sample_weights) {
+          AT_ASSERT(mode == MODE_SUM);
+          scale = per_sample_weights_data[*per_sample_weights_stride * j];
+        }
+        if (scale_grad_by_freq) {
+          scale /= counts[indices_data[seg]];
+        }
+        if (mode == MODE_MEAN) {
+          auto bag_size = bag_size_data[source];
+          if (bag_size != 0) {
+            scale /= bag_size;
+          }
+        }
+        at::native::cpublas::axpy<scalar_t>(ddim, (scalar_t)scale, gd + ddim * source, 1,
+                    out, 1);
+      }
+    };
+
     auto loop =
-      [&next_unique_index_idx, &indices_data, &offset2bag_data, &bag_size_data, &per_sample_weights,
-        &mode, &per_sample_weights_data, &per_sample_weights_stride, &scale_grad_by_freq,
-        &counts, &grad, &index_grad_weight, &padding_idx
+      [&next_unique_index_idx, &indices_data, &padding_idx, &accumulate_segment,
+        &igwd, &ddim
       ](index_t start, index_t end) {
       for (index_t i = start; i < end; i++) {
-        index_t start = i == 0 ? 0 : next_unique_index_idx[i - 1];
-        index_t index = indices_data[start];
+        index_t seg_begin = i == 0 ? 0 : next_unique_index_idx[i - 1];
+        index_t index = indices_data[seg_begin];
 
         if (index != static_cast<index_t>(padding_idx)) {
-          for (index_t j = start; j < next_unique_index_idx[i]; j++) {
-            index_t source = offset2bag_data[j];
-            double scale = 1.0;
-            if (per_sample_weights) {
-              AT_ASSERT(mode == MODE_SUM);
-              scale = per_sample_weights_data[*per_sample_weights_stride * j];
+          accumulate_segment(
+              i, seg_begin, next_unique_index_idx[i], igwd + ddim * index);
+        }
+      }
+    };
+
+    if (numel > 1000) {
+      // Parallelize over equal chunks of sorted positions rather than over
+      // segments: with skewed (power-law) index distributions a single hot
+      // row would otherwise serialize one thread on its whole segment.
+      // Chunks own the segments that lie fully inside them; a segment
+      // straddling a chunk boundary is summed into a per-chunk scratch row
+      // and the scratch rows are folded in fixed chunk order afterwards, so
+      // each destination row is still written by exactly one owner and the
+      // result is deterministic for a given chunking.
+      const int64_t num_chunks =
+          std::min<int64_t>(at::get_num_threads(), (numel + 999) / 1000);
+      const int64_t chunk_size = (numel + num_chunks - 1) / num_chunks;
+      std::vector<scalar_t> partial(num_chunks * 2 * ddim, scalar_t(0));
+      std::vector<int64_t> partial_seg(num_chunks * 2, -1);
+      at::parallel_for(0, num_chunks, 1,
+        [&next_unique_index_idx, &indices_data, &padding_idx, &accumulate_segment,
+          &igwd, &ddim, &numel, &num_segments, &chunk_size, &partial, &partial_seg
+        ](int64_t chunk_begin_idx, int64_t chunk_end_idx) {
+        for (int64_t c = chunk_begin_idx; c < chunk_end_idx; c++) {
+          index_t chunk_begin = (index_t)(c * chunk_size);
+          index_t chunk_end = (index_t)std::min<int64_t>(numel, (c + 1) * chunk_size);
+          // First segment whose (exclusive) end lies past chunk_begin.
+          int64_t seg = std::upper_bound(
+                            next_unique_index_idx.begin(),
+                            next_unique_index_idx.end(),
+                            chunk_begin) -
+              next_unique_index_idx.begin();
+          for (; seg < num_segments; seg++) {
+            index_t seg_begin = seg == 0 ? 0 : next_unique_index_idx[seg - 1];
+            if (seg_begin >= chunk_end) {
+              break;
             }
-            if (scale_grad_by_freq) {
-              scale /= counts[indices_data[i]];
+            index_t seg_end = next_unique_index_idx[seg];
+            index_t index = indices_data[seg_begin];
+            if (index == static_cast<index_t>(padding_idx)) {
+              continue;
             }
-            if (mode == MODE_MEAN) {
-              auto bag_size = bag_size_data[source];
-              if (bag_size != 0) {
-                scale /= bag_size;
-              }
+            index_t lo = std::max(seg_begin, chunk_begin);
+            index_t hi = std::min(seg_end, chunk_end);
+            if (seg_begin >= chunk_begin && seg_end <= chunk_end) {
+              // Fully owned by this chunk; write the destination row directly.
+              accumulate_segment(seg, lo, hi, igwd + ddim * index);
+            } else {
+              // Boundary segment: slot 0 continues in from the left edge,
+              // slot 1 runs out past the right edge. A segment covering the
+              // whole chunk uses slot 0 only.
+              int64_t slot = c * 2 + (seg_begin < chunk_begin ? 0 : 1);
+              partial_seg[slot] = seg;
+              accumulate_segment(seg, lo, hi, partial.data() + slot * ddim);
             }
-            int64_t ddim = grad.size(1);
-            auto igwd = index_grad_weight.data_ptr<scalar_t>();
-            auto gd = grad.const_data_ptr<scalar_t>();
-            at::native::cpublas::axpy<scalar_t>(ddim, (scalar_t)scale, gd + ddim * source, 1,
-                        igwd + ddim * index, 1);
           }
         }
+      });
+      // Fold the boundary partials in chunk order.
+      for (int64_t slot = 0; slot < num_chunks * 2; slot++) {
+        int64_t seg = partial_seg[slot];
+        if (seg < 0) {
+          continue;
+        }
+        index_t seg_begin = seg == 0 ? 0 : next_unique_index_idx[seg - 1];
+        index_t index = indices_data[seg_begin];
+        at::native::cpublas::axpy<scalar_t>(ddim, scalar_t(1),
+                    partial.data() + slot * ddim, 1, igwd + ddim * index, 1);
       }
-    };
-
-    if (numel > 1000) {
-      at::parallel_for(0, (int64_t)next_unique_index_idx.size(), 0, loop);
     } else {
-      loop(0, (int64_t)next_unique_index_idx.size());
+      loop(0, (index_t)num_segments);
     }
   });
 }
@@ -94,8 +94,41 @@ static void im2col_out_cpu_template(
 
   output.resize_({batch_size, n_output_plane, output_length});
 
+  // Non-overlapping patches (stride == kernel, no padding or dilation) are
+  // a pure relayout of the input: view it as
+  // [batch, channels, out_h, kernel_h, out_w, kernel_w] and let one strided
+  // copy write the column buffer instead of walking the generic
+  // per-element loops. This is the patch-embedding case.
+  const bool non_overlapping = dilation_height == 1 && dilation_width == 1 &&
+      pad_height == 0 && pad_width == 0 && stride_height == kernel_height &&
+      stride_width == kernel_width && input_height % kernel_height == 0 &&
+      input_width % kernel_width == 0;
+
   AT_DISPATCH_FLOATING_AND_COMPLEX_TYPES_AND2(kBFloat16, kHalf,
       input.scalar_type(), "im2col_out_cpu", [&] {
+        if (non_overlapping && output.is_contiguous()) {
+          auto patches = input
+                             .view({batch_size,
+                                    n_input_plane,
+                                    output_height,
+                                    kernel_height,
+                                    output_width,
+                                    kernel_width})
+                             .permute({0, 1, 3, 5, 2, 4});
+          output
+              .view({batch_size,
+                     n_input_plane,
+                     kernel_height,
+                     kernel_width,
+                     output_height,
+                     output_width})
+              .copy_(patches);
+          if (!batched_input) {
+            output.resize_({n_output_plane, output_length});
+          }
+          return;
+        }
+
         Tensor input_n;
         Tensor output_n;
 
@@ -1247,7 +1247,8 @@ Tensor math_addr(const Tensor& self,
   } else {
     out = beta * self + alpha * at::outer(vec1, vec2);
   }
-  auto result_type = c10::promoteTypes(c10::promoteTypes(self.scalar_type(), vec1.scalar_type()), vec2.scalar_type());
+  auto result_type = c10::promoteTypes(
+      {self.scalar_type(), vec1.scalar_type(), vec2.scalar_type()});
   return out.to(c10::TensorOptions().dtype(result_type));
 }
 
@@ -1796,7 +1797,8 @@ static inline void bmm_out_or_baddbmm_(const Tensor& self_or_result_, const Tens
           baddbmm_cpu_kernel<scalar_t, false>(self_or_result, batch1, batch2, beta, alpha);
         });
     }
-  } else if (at::hasMKL() && ((
+  } else if ((at::hasMKL() || cpublas::could_use_small_gemm_batched(
+            self_or_result.scalar_type(), bs, res_rows, res_cols, contraction_size)) && ((
             self_or_result.scalar_type() != kBFloat16 &&
             self_or_result.scalar_type() != kHalf &&
             at::native::is_floating_point(self_or_result)) ||
@@ -1,6 +1,7 @@
 #define TORCH_ASSERT_ONLY_METHOD_OPERATORS
 #include <ATen/core/Tensor.h>
 #include <ATen/Dispatch.h>
+#include <ATen/OpMathType.h>
 #include <ATen/Parallel.h>
 #include <ATen/TensorIndexing.h>
 #include <ATen/TensorMeta.h>
@@ -15,8 +16,12 @@
 #include <ATen/Functions.h>
 #include <ATen/NativeFunctions.h>
 #else
+#include <ATen/ops/_fused_cross_entropy_loss.h>
+#include <ATen/ops/_fused_cross_entropy_loss_backward_native.h>
+#include <ATen/ops/_fused_cross_entropy_loss_native.h>
 #include <ATen/ops/cross_entropy_loss_native.h>
 #include <ATen/ops/empty.h>
+#include <ATen/ops/empty_like.h>
 #include <ATen/ops/log_softmax.h>
 #include <ATen/ops/nll_loss.h>
 #include <ATen/ops/nll_loss2d.h>
@@ -31,6 +36,9 @@
 #include <c10/core/TensorOptions.h>
 #include <c10/util/irange.h>
 
+#include <algorithm>
+#include <cmath>
+#include <tuple>
 #include <utility>
 
 namespace at::meta {
@@ -487,6 +495,164 @@ TORCH_IMPL_FUNC(nll_loss_backward_out_cpu)
       total_weight);
 }
 
+namespace {
+
+// Tile width for streaming max/logsumexp over the class dimension; sized so a
+// tile of the input row stays resident in L1/L2 between the max and sum
+// passes.
+constexpr int64_t FUSED_CROSS_ENTROPY_CHUNK = 8192;
+
+// Minimum class count for routing cross_entropy_loss through the fused path.
+// Below this, the memory spike of materializing log probabilities is small
+// and the existing vectorized log_softmax path wins.
+constexpr int64_t FUSED_CROSS_ENTROPY_MIN_CLASSES = 8192;
+
+bool can_use_fused_cross_entropy_loss(
+    const Tensor& self,
+    const Tensor& target,
+    const std::optional<Tensor>& weight) {
+  if (weight.has_value() && weight->defined()) {
+    return false;
+  }
+  return (self.is_cpu() || self.is_cuda()) && self.dim() == 2 &&
+      target.dim() == 1 && target.scalar_type() == kLong &&
+      target.device() == self.device() &&
+      (self.scalar_type() == kFloat || self.scalar_type() == kDouble ||
+       self.scalar_type() == kHalf || self.scalar_type() == kBFloat16) &&
+      self.sym_size(1) >= FUSED_CROSS_ENTROPY_MIN_CLASSES &&
+      !isTensorSubclassLike(self) && !isTensorSubclassLike(target);
+}
+
+} // namespace
+
+std::tuple<Tensor, Tensor> _fused_cross_entropy_loss_cpu(
+    const Tensor& self,
+    const Tensor& target,
+    int64_t ignore_index) {
+  TORCH_CHECK(self.dim() == 2, "_fused_cross_entropy_loss: input tensor should be 2D");
+  TORCH_CHECK(
+      target.dim() == 1 && target.size(0) == self.size(0),
+      "_fused_cross_entropy_loss: size mismatch (got input: ",
+      self.sizes(),
+      ", target: ",
+      target.sizes(),
+      ")");
+  auto input = self.contiguous();
+  auto target_ = target.contiguous();
+  const int64_t batch_size = input.size(0);
+  const int64_t n_classes = input.size(1);
+  Tensor output = at::empty({batch_size}, input.options());
+  Tensor logsumexp = at::empty(
+      {batch_size}, input.options().dtype(toOpMathType(input.scalar_type())));
+  if (batch_size == 0) {
+    return std::make_tuple(std::move(output), std::move(logsumexp));
+  }
+  AT_DISPATCH_FLOATING_TYPES_AND2(
+      ScalarType::Half,
+      ScalarType::BFloat16,
+      input.scalar_type(),
+      "_fused_cross_entropy_loss_cpu",
+      [&] {
+        using opmath_t = at::opmath_type<scalar_t>;
+        const scalar_t* input_data = input.const_data_ptr<scalar_t>();
+        const int64_t* target_data = target_.const_data_ptr<int64_t>();
+        scalar_t* output_data = output.data_ptr<scalar_t>();
+        opmath_t* lse_data = logsumexp.data_ptr<opmath_t>();
+        at::parallel_for(0, batch_size, 1, [&](int64_t begin, int64_t end) {
+          for (const auto i : c10::irange(begin, end)) {
+            const int64_t cur_target = target_data[i];
+            if (cur_target == ignore_index) {
+              output_data[i] = static_cast<scalar_t>(0);
+              lse_data[i] = static_cast<opmath_t>(0);
+              continue;
+            }
+            TORCH_CHECK_INDEX(
+                cur_target >= 0 && cur_target < n_classes,
+                "Target ",
+                cur_target,
+                " is out of bounds.");
+            const scalar_t* row = input_data + i * n_classes;
+            opmath_t max = -std::numeric_limits<opmath_t>::infinity();
+            opmath_t sum = 0;
+            for (int64_t j = 0; j < n_classes; j += FUSED_CROSS_ENTROPY_CHUNK) {
+              const int64_t chunk_end =
+                  std::min(j + FUSED_CROSS_ENTROPY_CHUNK, n_classes);
+              opmath_t chunk_max = -std::numeric_limits<opmath_t>::infinity();
+              for (const auto l : c10::irange(j, chunk_end)) {
+                chunk_max = std::max(chunk_max, static_cast<opmath_t>(row[l]));
+              }
+              if (chunk_max > max) {
+                sum *= std::exp(max - chunk_max);
+                max = chunk_max;
+              }
+              for (const auto l : c10::irange(j, chunk_end)) {
+                sum += std::exp(static_cast<opmath_t>(row[l]) - max);
+              }
+            }
+            const opmath_t lse = max + std::log(sum);
+            lse_data[i] = lse;
+            output_data[i] = static_cast<scalar_t>(
+                lse - static_cast<opmath_t>(row[cur_target]));
+          }
+        });
+      });
+  return std::make_tuple(std::move(output), std::move(logsumexp));
+}
+
+Tensor _fused_cross_entropy_loss_backward_cpu(
+    const Tensor& grad_output,
+    const Tensor& self,
+    const Tensor& target,
+    const Tensor& logsumexp,
+    int64_t ignore_index) {
+  auto input = self.contiguous();
+  auto target_ = target.contiguous();
+  auto grad_output_ = grad_output.contiguous();
+  auto lse = logsumexp.contiguous();
+  const int64_t batch_size = input.size(0);
+  const int64_t n_classes = input.size(1);
+  Tensor grad_input = at::empty_like(input);
+  if (batch_size == 0) {
+    return grad_input;
+  }
+  AT_DISPATCH_FLOATING_TYPES_AND2(
+      ScalarType::Half,
+      ScalarType::BFloat16,
+      input.scalar_type(),
+      "_fused_cross_entropy_loss_backward_cpu",
+      [&] {
+        using opmath_t = at::opmath_type<scalar_t>;
+        const scalar_t* input_data = input.const_data_ptr<scalar_t>();
+        const int64_t* target_data = target_.const_data_ptr<int64_t>();
+        const scalar_t* grad_output_data = grad_output_.const_data_ptr<scalar_t>();
+        const opmath_t* lse_data = lse.const_data_ptr<opmath_t>();
+        scalar_t* grad_input_data = grad_input.data_ptr<scalar_t>();
+        const int64_t grain =
+            std::max(int64_t(1), at::internal::GRAIN_SIZE / n_classes);
+        at::parallel_for(0, batch_size, grain, [&](int64_t begin, int64_t end) {
+          for (const auto i : c10::irange(begin, end)) {
+            scalar_t* grad_row = grad_input_data + i * n_classes;
+            if (target_data[i] == ignore_index) {
+              std::fill(grad_row, grad_row + n_classes, static_cast<scalar_t>(0));
+              continue;
+            }
+            const scalar_t* row = input_data + i * n_classes;
+            const opmath_t go = static_cast<opmath_t>(grad_output_data[i]);
+            const opmath_t lse_i = lse_data[i];
+            for (const auto j : c10::irange(n_classes)) {
+              opmath_t grad =
+                  go * std::exp(static_cast<opmath_t>(row[j]) - lse_i);
+              if (j == target_data[i]) {
+                grad -= go;
+              }
+              grad_row[j] = static_cast<scalar_t>(grad);
+            }
+          }
+        });
+      });
+  return grad_input;
+}
+
 static Tensor cross_entropy_loss_prob_target(
     const Tensor& self,
     const Tensor& target_,
@@ -646,6 +812,26 @@ Tensor cross_entropy_loss_symint(
     c10::MaybeOwned<Tensor> weight_maybe_owned = at::borrow_from_optional_tensor(weight);
     const Tensor& weight_ = *weight_maybe_owned;
     ret = cross_entropy_loss_label_smoothing(self, target, weight_, reduction, std::move(ignore_index), label_smoothing);
+  } else if (can_use_fused_cross_entropy_loss(self, target, weight)) {
+    // Streams over the class dimension instead of materializing the full
+    // [batch, n_classes] log probabilities; worthwhile for large vocabularies
+    auto losses = std::get<0>(
+        at::_fused_cross_entropy_loss_symint(self, target, ignore_index));
+    switch (reduction) {
+      case Reduction::Mean:
+        // normalized by the number of non-ignored targets to match
+        // nll_loss, yielding nan when every target is ignored
+        ret = losses.sum() / (target != std::move(ignore_index)).sum();
+        break;
+      case Reduction::Sum:
+        ret = losses.sum();
+        break;
+      case Reduction::None:
+        ret = losses;
+        break;
+      default:
+        TORCH_CHECK(false, "Invalid reduction type encountered in cross_entropy: ", reduction);
+    }
   } else {
     auto class_dim = self.dim() == 1 ? 0 : 1;
     ret = at::nll_loss_nd_symint(
@@ -32,6 +32,7 @@
 #include <ATen/ops/_sparse_csr_sum.h>
 #include <ATen/ops/_sparse_sum.h>
 #include <ATen/ops/_sparse_sum_native.h>
+#include <ATen/ops/_tensor_summary_native.h>
 #include <ATen/ops/_to_copy.h>
 #include <ATen/ops/add.h>
 #include <ATen/ops/all_meta.h>
@@ -1258,6 +1259,34 @@ Tensor nansum(const Tensor& self, at::OptionalIntArrayRef dim, bool keepdim, std
   return at::native::nansum_out(self, dim, keepdim, dtype, result);
 }
 
+// Debugging summary: [min, max, mean, nan_count] as a float64 tensor on
+// self's device. NaNs are counted in nan_count and excluded from the other
+// three stats. The result deliberately stays on device so sanity checks can
+// retrieve it with a non-blocking copy plus an event instead of forcing a
+// stream synchronization; the CUDA backend computes all four stats in a
+// single pass (see cuda/TensorSummary.cu).
+Tensor _tensor_summary(const Tensor& self) {
+  TORCH_CHECK(
+      at::isFloatingType(self.scalar_type()),
+      "_tensor_summary: expected a floating point tensor, got ",
+      self.scalar_type());
+  const auto inf = std::numeric_limits<double>::infinity();
+  if (self.numel() == 0) {
+    auto stats = at::empty({4}, self.options().dtype(kDouble));
+    stats[0].fill_(inf);
+    stats[1].fill_(-inf);
+    stats[2].fill_(std::numeric_limits<double>::quiet_NaN());
+    stats[3].fill_(0);
+    return stats;
+  }
+  auto nan_count = self.isnan().sum();
+  auto min = self.nan_to_num(inf).amin();
+  auto max = self.nan_to_num(-inf).amax();
+  auto mean = self.nansum().to(kDouble) / (self.numel() - nan_count);
+  return at::stack(
+      {min.to(kDouble), max.to(kDouble), mean, nan_count.to(kDouble)});
+}
+
 namespace {
 template<typename scalar_t, typename accscalar_t = at::acc_type<scalar_t, false>>
 void inline set_result(Tensor& result, accscalar_t sum)
@@ -4,7 +4,10 @@
 
 namespace at::native {
 
-enum class ReductionType {MAX, MEAN, MIN, SUM, PROD};
+// LOGSUMEXP is currently only produced by segment_reduce; the string-based
+// entry points below keep rejecting "logsumexp" so scatter_reduce and
+// index_reduce do not silently accept a reduction they do not implement.
+enum class ReductionType {MAX, MEAN, MIN, SUM, PROD, LOGSUMEXP};
 
 inline ReductionType get_reduction_enum(const c10::string_view& reduce) {
   if (reduce == "max" || reduce == "amax") {
@@ -73,7 +73,9 @@ void _segment_reduce_lengths_cpu_kernel1(
               scalar_t initial_value;
               if (initial.has_value()) {
                 initial_value = initial.value().to<scalar_t>();
-              } else if (reduction == ReductionType::MAX) {
+              } else if (
+                  reduction == ReductionType::MAX ||
+                  reduction == ReductionType::LOGSUMEXP) {
                 initial_value = -std::numeric_limits<scalar_t>::infinity();
               } else if (
                   reduction == ReductionType::MEAN ||
@@ -84,6 +86,12 @@ void _segment_reduce_lengths_cpu_kernel1(
               } else if (reduction == ReductionType::PROD) {
                 initial_value = 1;
               }
+              // For LOGSUMEXP, initial_value carries the running max and
+              // logsumexp_weight the sum of exponentials rescaled to it;
+              // a provided initial behaves like one extra element.
+              scalar_t logsumexp_weight = initial.has_value()
+                  ? static_cast<scalar_t>(1)
+                  : static_cast<scalar_t>(0);
 
               // ===== step2: apply reduction
               for (const auto j : c10::irange(segment_start, segment_end)) {
@@ -104,6 +112,14 @@ void _segment_reduce_lengths_cpu_kernel1(
                       : std::min<scalar_t>(initial_value, val);
                 } else if (reduction == ReductionType::PROD) {
                   initial_value = initial_value * val;
+                } else if (reduction == ReductionType::LOGSUMEXP) {
+                  if (val <= initial_value) {
+                    logsumexp_weight += std::exp(val - initial_value);
+                  } else {
+                    logsumexp_weight =
+                        logsumexp_weight * std::exp(initial_value - val) + 1;
+                    initial_value = val;
+                  }
                 }
               }
 
@@ -117,6 +133,9 @@ void _segment_reduce_lengths_cpu_kernel1(
                   reduction == ReductionType::MEAN &&
                   segment_length > 0 && !at::_isnan(initial_value)) {
                 initial_value = initial_value / segment_length;
+              } else if (reduction == ReductionType::LOGSUMEXP) {
+                // Empty segments without an initial give -inf + log(0) = -inf.
+                initial_value = initial_value + std::log(logsumexp_weight);
               }
               int64_t output_index = outer_idx * output_stride_axis * output_size_axis
                                      + dim_idx * output_stride_axis + inner_idx;
@@ -309,6 +328,16 @@ void _segment_reduce_cpu_lengths_backward_kernel1(
                     grad_input_data[data_index] = grad_val / values_data[data_index];
                   }
                 }
+              } else if (reduction == ReductionType::LOGSUMEXP) {
+                // d logsumexp(x) / dx_j = exp(x_j - logsumexp(x)); computed
+                // from the forward output in one pass, no mask materialized.
+                const auto& grad_val = grad_data[output_index];
+                for (const auto j : c10::irange(segment_start, segment_end)) {
+                  int64_t data_index = outer_idx * data_stride_axis * data_size_axis
+                                       + j * data_stride_axis + inner_idx;
+                  grad_input_data[data_index] = grad_val *
+                      std::exp(values_data[data_index] - output_data[output_index]);
+                }
               }
             }
           }
@@ -405,7 +434,10 @@ Tensor segment_reduce_kernel(
       lengths_has_value || offsets_has_value,
       "segment_reduce(): Either lengths or offsets must be defined.")
 
-  auto reduction = get_reduction_enum(reduce);
+  // "logsumexp" is specific to segment_reduce; get_reduction_enum keeps
+  // rejecting it on behalf of the scatter/index reduction entry points.
+  auto reduction = reduce == "logsumexp" ? ReductionType::LOGSUMEXP
+                                         : get_reduction_enum(reduce);
   const auto data_contig = data.contiguous();
 
   if (offsets_has_value) {
@@ -501,7 +533,8 @@ Tensor _segment_reduce_backward_kernel(
   const auto grad_contig = grad.contiguous();
   const auto output_contig = output.contiguous();
   const auto data_contig = data.contiguous();
-  auto reduction = get_reduction_enum(reduce);
+  auto reduction = reduce == "logsumexp" ? ReductionType::LOGSUMEXP
+                                         : get_reduction_enum(reduce);
 
   if (offsets_has_value) {
     const auto& offsets_value = offsets.value();
@@ -160,8 +160,10 @@ void host_softmax(
   if (MaskedSoftMax) {
     TORCH_CHECK(mask_type_.has_value(), "Mask Type should be defined");
     int64_t mask_type = mask_type_.value();
-    // If mask_type == 2, then mask_.sizes() must equal input_.sizes()
-    TORCH_CHECK((mask_type == 0) || (mask_type == 1) || (mask_type == 2), "Mask Type should be 0 (src_mask) or 1 (src_key_padding_mask), or 2 (default_mask)");
+    // If mask_type == 2, then mask_.sizes() must equal input_.sizes().
+    // mask_type == 3 is internal to masked_softmax_cpu: a (B, 1, L, L)
+    // attention mask shared across heads.
+    TORCH_CHECK((mask_type == 0) || (mask_type == 1) || (mask_type == 2) || (mask_type == 3), "Mask Type should be 0 (src_mask) or 1 (src_key_padding_mask), or 2 (default_mask)");
   }
 
   int64_t outer_size = 1;
@@ -203,6 +205,12 @@ void host_softmax(
                 // Optimized case: padding mask of shape BxL
                 // outer_idx goes over BxHxL, mask_outer_idx goes over B.
                 mask_outer_idx = outer_idx / (input.size(1) * input.size(2));
+            } else if (mask_type_ == 3) {
+                // Optimized case: per-batch attention mask of shape BxLxL
+                // outer_idx goes over BxHxL, mask_outer_idx goes over BxL.
+                mask_outer_idx =
+                    (outer_idx / (input.size(1) * input.size(2))) * input.size(2) +
+                    outer_idx % input.size(2);
             }
 
             mask_data = mask_data_base + mask_outer_idx * outer_stride + inner_idx;
@@ -578,7 +586,36 @@ Tensor masked_softmax_cpu(const Tensor& input_, const Tensor& mask_, const std::
       mask_.scalar_type() == ScalarType::Bool,
       "Mask should be a boolean tensor");
 
-  if ((mask.dim() != 2) || (input_.dim() != 4)) {
+  // Broadcast attention-mask layouts are handled on the fly instead of
+  // requiring the caller to materialize the expansion.
+  if (input_.dim() == 4 && mask.dim() == 4 &&
+      mask.sizes()[0] == input_.sizes()[0] && mask.sizes()[1] == 1 &&
+      mask.sizes()[3] == input_.sizes()[3]) {
+    if (mask.sizes()[2] == 1) {
+      if (input_.sizes()[2] == input_.sizes()[3]) {
+        // Padding mask of shape (B, 1, 1, L): same data layout as (B, L)
+        mask = mask.view({input_.sizes()[0], input_.sizes()[3]});
+        mask_type = 1;
+      } else {
+        mask = mask.expand(input_.sizes()).contiguous();
+        mask_type = 2;
+      }
+    } else if (mask.sizes()[2] == input_.sizes()[2]) {
+      if (dim_ != input_.dim() - 1) {
+        // We only process the per-batch mask in the optimized way if softmax
+        // is applied along the last dimension, otherwise we need to expand
+        // the mask into a generic 4D one
+        mask = mask.expand(input_.sizes()).contiguous();
+        mask_type = 2;
+      } else {
+        // Attention mask of shape (B, 1, L, L), shared across heads;
+        // mask_type 3 is internal to the CPU kernel (see host_softmax)
+        mask_type = 3;
+      }
+    }
+  }
+
+  if (((mask.dim() != 2) || (input_.dim() != 4)) && mask_type != 3) {
     // Mask types 0 and 1 are only allowed for 2D masks and 4D inputs
     mask_type = 2;
   }
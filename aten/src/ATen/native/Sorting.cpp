@@ -23,9 +23,11 @@
 #include <ATen/Functions.h>
 #include <ATen/NativeFunctions.h>
 #else
+#include <ATen/ops/_streaming_topk_update_native.h>
 #include <ATen/ops/arange.h>
 #include <ATen/ops/argsort_native.h>
 #include <ATen/ops/broadcast_tensors.h>
+#include <ATen/ops/cat.h>
 #include <ATen/ops/empty.h>
 #include <ATen/ops/full.h>
 #include <ATen/ops/full_like.h>
@@ -42,9 +44,12 @@
 #include <ATen/ops/scalar_tensor.h>
 #include <ATen/ops/sort.h>
 #include <ATen/ops/sort_native.h>
+#include <ATen/ops/stack.h>
 #include <ATen/ops/topk_native.h>
 #endif
 
+#include <cmath>
+#include <limits>
 #include <utility>
 
 namespace at::meta {
@@ -261,6 +266,60 @@ Tensor quantile_compute(
                 "quantile() q values must be in the range [0, 1]");
   }
 
+  // For a handful of quantiles over a flattened CPU tensor, compute the
+  // required order statistics with kthvalue (quickselect) instead of
+  // sorting the whole input: O(q * n) instead of O(n log n) and no sorted
+  // copy of the input is materialized. CUDA stays on the sort path since
+  // reading q and the nan mask on the host would synchronize (and e.g.
+  // break CUDA graph capture).
+  constexpr int64_t QUANTILE_SELECTION_MAX_Q = 4;
+  if (self.device().is_cpu() && !orginal_dim && q.numel() > 0 &&
+      q.numel() <= QUANTILE_SELECTION_MAX_Q &&
+      !areAnyTensorSubclassLike({self, q})) {
+    auto flat = self.flatten();
+    const bool has_nan = at::is_scalar_tensor_true(flat.isnan().any());
+    if (!has_nan || !ignore_nan) {
+      if (has_nan) {
+        // Any nan makes every quantile nan.
+        return at::full(
+            out_shape,
+            std::numeric_limits<double>::quiet_NaN(),
+            self.options());
+      }
+      const int64_t last_index = flat.numel() - 1;
+      auto q_double = q.contiguous().toType(kDouble);
+      const double* q_data = q_double.const_data_ptr<double>();
+      std::vector<Tensor> quantiles;
+      quantiles.reserve(q.numel());
+      for (const auto i : c10::irange(q.numel())) {
+        double rank = q_data[i] * last_index;
+        if (interpolation == QUANTILE_INTERPOLATION_MODE::LOWER) {
+          rank = std::floor(rank);
+        } else if (interpolation == QUANTILE_INTERPOLATION_MODE::HIGHER) {
+          rank = std::ceil(rank);
+        } else if (interpolation == QUANTILE_INTERPOLATION_MODE::NEAREST) {
+          // Match Tensor::round_, which rounds halfway cases to even.
+          rank = std::nearbyint(rank);
+        }
+        const auto rank_below = static_cast<int64_t>(rank);
+        const auto rank_above = static_cast<int64_t>(std::ceil(rank));
+        Tensor value = std::get<0>(flat.kthvalue(rank_below + 1));
+        if ((interpolation == QUANTILE_INTERPOLATION_MODE::LINEAR ||
+             interpolation == QUANTILE_INTERPOLATION_MODE::MIDPOINT) &&
+            rank_above != rank_below) {
+          const double weight =
+              interpolation == QUANTILE_INTERPOLATION_MODE::MIDPOINT
+              ? 0.5
+              : rank - static_cast<double>(rank_below);
+          value = value.lerp(std::get<0>(flat.kthvalue(rank_above + 1)), weight);
+        }
+        quantiles.push_back(std::move(value));
+      }
+      Tensor result = q.dim() == 0 ? quantiles[0] : at::stack(quantiles);
+      return result.view(out_shape);
+    }
+  }
+
   // Flatten input if no dim provided else move dim to reduce as last dimension.
   // Sort to efficiently query kth values.
   Tensor sorted;
@@ -843,6 +902,59 @@ TORCH_IMPL_FUNC(topk_out_cpu)
   }
 }
 
+std::tuple<Tensor, Tensor> _streaming_topk_update(
+    const Tensor& values,
+    const Tensor& indices,
+    const Tensor& chunk_values,
+    const Tensor& chunk_indices,
+    int64_t k,
+    bool largest) {
+  TORCH_CHECK(
+      k > 0, "_streaming_topk_update: k must be positive, but got ", k);
+  TORCH_CHECK(
+      values.dim() == 1 && indices.dim() == 1 &&
+          values.size(0) == indices.size(0),
+      "_streaming_topk_update: values and indices must be 1-D with the same "
+      "length");
+  TORCH_CHECK(
+      values.size(0) <= k,
+      "_streaming_topk_update: running state holds ",
+      values.size(0),
+      " elements, which exceeds k=",
+      k);
+  TORCH_CHECK(
+      chunk_values.dim() == 1 && chunk_indices.dim() == 1 &&
+          chunk_values.size(0) == chunk_indices.size(0),
+      "_streaming_topk_update: chunk_values and chunk_indices must be 1-D "
+      "with the same length");
+  TORCH_CHECK(
+      chunk_values.scalar_type() == values.scalar_type(),
+      "_streaming_topk_update: expected chunk of type ",
+      values.scalar_type(),
+      " but got ",
+      chunk_values.scalar_type());
+
+  Tensor cand_values = chunk_values;
+  Tensor cand_indices = chunk_indices;
+  // Once the running state is full, its worst element bounds the final
+  // top-k from below; a vectorized comparison against that bound discards
+  // nearly every chunk element before the merge touches it.
+  if (values.size(0) == k) {
+    const Tensor bound = largest ? values.min() : values.max();
+    const Tensor keep =
+        largest ? cand_values.gt(bound) : cand_values.lt(bound);
+    cand_values = cand_values.masked_select(keep);
+    cand_indices = cand_indices.masked_select(keep);
+  }
+  const Tensor merged_values = at::cat({values, cand_values});
+  const Tensor merged_indices = at::cat({indices, cand_indices});
+  const int64_t kept = std::min(k, merged_values.size(0));
+  auto [top_values, top_pos] =
+      merged_values.topk(kept, /*dim=*/0, largest, /*sorted=*/true);
+  return std::make_tuple(
+      std::move(top_values), merged_indices.index_select(0, top_pos));
+}
+
 std::tuple<Tensor&, Tensor&> median_out_cpu(
     const Tensor& self,
     int64_t dim,
@@ -3,6 +3,7 @@
 
 #include <ATen/core/Tensor.h>
 #include <ATen/Dispatch.h>
+#include <ATen/Parallel.h>
 #include <c10/util/irange.h>
 
 #ifndef AT_PER_OPERATOR_HEADERS
@@ -13,11 +14,54 @@
 #include <ATen/ops/zeros.h>
 #endif
 
+#include <vector>
+
 namespace at::native {
 
 ///////////////// bincount /////////////////
 namespace {
 
+/* Accumulates counts using privatized per-thread buffers which are summed
+ * together bin-by-bin at the end, with both phases parallelized over threads.
+ * Only worthwhile for large inputs; small inputs use the serial loop below.
+ * weights_p may be null, in which case each element contributes a count of 1.
+ */
+template <typename input_t, typename weights_t>
+void _bincount_cpu_parallel(
+    const input_t* self_p,
+    int64_t self_size,
+    const weights_t* weights_p,
+    weights_t* output_p,
+    int64_t nbins) {
+  const int num_threads = at::get_num_threads();
+  std::vector<weights_t> thread_counts(num_threads * nbins, weights_t(0));
+
+  at::parallel_for(
+      0, self_size, at::internal::GRAIN_SIZE, [&](int64_t start, int64_t end) {
+        weights_t* counts = thread_counts.data() + at::get_thread_num() * nbins;
+        if (weights_p) {
+          for (const auto i : c10::irange(start, end)) {
+            counts[self_p[i]] += weights_p[i];
+          }
+        } else {
+          for (const auto i : c10::irange(start, end)) {
+            counts[self_p[i]] += weights_t(1);
+          }
+        }
+      });
+
+  at::parallel_for(
+      0, nbins, at::internal::GRAIN_SIZE, [&](int64_t start, int64_t end) {
+        for (const auto bin : c10::irange(start, end)) {
+          weights_t sum = weights_t(0);
+          for (const auto t : c10::irange(num_threads)) {
+            sum += thread_counts[t * nbins + bin];
+          }
+          output_p[bin] = sum;
+        }
+      });
+}
+
 template <typename input_t, typename weights_t>
 Tensor _bincount_cpu_template(
     const Tensor& self,
@@ -44,6 +88,10 @@ Tensor _bincount_cpu_template(
   nbins = std::max(nbins, minlength); // at least minlength # of bins
 
   const input_t* self_p = self.const_data_ptr<input_t>();
+  /* Privatized accumulation only pays for its per-thread buffers when the
+   * input is large and the bin count is not itself input-sized. */
+  const bool use_parallel = self_size >= at::internal::GRAIN_SIZE &&
+      nbins <= self_size && at::get_num_threads() > 1;
   if (has_weights) {
     output = at::zeros(
         {nbins},
@@ -53,14 +101,23 @@ Tensor _bincount_cpu_template(
         weights.options().pinned_memory_opt());
     weights_t* output_p = output.data_ptr<weights_t>();
     const weights_t* weights_p = weights.const_data_ptr<weights_t>();
-    for (const auto i : c10::irange(self_size)) {
-      output_p[self_p[i]] += weights_p[i];
+    if (use_parallel) {
+      _bincount_cpu_parallel(self_p, self_size, weights_p, output_p, nbins);
+    } else {
+      for (const auto i : c10::irange(self_size)) {
+        output_p[self_p[i]] += weights_p[i];
+      }
     }
   } else {
     output = at::zeros({nbins}, kLong);
     int64_t* output_p = output.data_ptr<int64_t>();
-    for (const auto i : c10::irange(self_size)) {
-      output_p[self_p[i]] += 1L;
+    if (use_parallel) {
+      _bincount_cpu_parallel<input_t, int64_t>(
+          self_p, self_size, nullptr, output_p, nbins);
+    } else {
+      for (const auto i : c10::irange(self_size)) {
+        output_p[self_p[i]] += 1L;
+      }
     }
   }
   return output;
@@ -84,6 +84,8 @@
 #include <ATen/ops/_gather_sparse_backward_native.h>
 #include <ATen/ops/_index_put_impl.h>
 #include <ATen/ops/_index_put_impl_native.h>
+#include <ATen/ops/_moe_combine_native.h>
+#include <ATen/ops/_moe_dispatch_native.h>
 #include <ATen/ops/_sparse_coo_tensor_unsafe.h>
 #include <ATen/ops/_unsafe_index_native.h>
 #include <ATen/ops/_unsafe_index_put_native.h>
@@ -489,6 +491,7 @@ DEFINE_DISPATCH(gather_stub);
 DEFINE_DISPATCH(scatter_stub);
 DEFINE_DISPATCH(scatter_fill_stub);
 DEFINE_DISPATCH(scatter_add_stub);
+DEFINE_DISPATCH(scatter_add_with_sort_stub);
 DEFINE_DISPATCH(scatter_reduce_stub);
 DEFINE_DISPATCH(scatter_scalar_reduce_stub);
 DEFINE_DISPATCH(scatter_reduce_two_stub);
@@ -1481,6 +1484,36 @@ Tensor index_select_backward_symint(const Tensor& grad, c10::SymIntArrayRef self
   return grad.new_zeros_symint(self_sizes, grad.options()).index_add_(dim, index, grad);
 }
 
+// Reference path for the fused MoE token permutation ops. The CUDA
+// kernels do the permutation in one launch with no intermediate
+// buffers; this composite keeps the ops usable on every other backend.
+Tensor _moe_dispatch(const Tensor& self, const Tensor& row_indices) {
+  TORCH_CHECK(self.dim() == 2,
+      "_moe_dispatch: expected a 2-D token tensor, got ", self.dim(), "-D");
+  TORCH_CHECK(row_indices.dim() == 1,
+      "_moe_dispatch: expected 1-D row indices, got ", row_indices.dim(), "-D");
+  return self.index_select(0, row_indices);
+}
+
+Tensor _moe_combine(const Tensor& self, const Tensor& row_indices, const Tensor& combine_weights) {
+  TORCH_CHECK(self.dim() == 2,
+      "_moe_combine: expected a 2-D expert output tensor, got ", self.dim(), "-D");
+  TORCH_CHECK(row_indices.dim() == 2,
+      "_moe_combine: expected [num_tokens, top_k] row indices, got ",
+      row_indices.dim(), "-D");
+  TORCH_CHECK(row_indices.sizes() == combine_weights.sizes(),
+      "_moe_combine: row_indices and combine_weights must have the same shape, got ",
+      row_indices.sizes(), " and ", combine_weights.sizes());
+  TORCH_CHECK(combine_weights.scalar_type() == self.scalar_type(),
+      "_moe_combine: combine_weights must match the expert output dtype, got ",
+      combine_weights.scalar_type(), " and ", self.scalar_type());
+  const auto num_tokens = row_indices.size(0);
+  const auto top_k = row_indices.size(1);
+  auto gathered = self.index_select(0, row_indices.reshape(-1))
+                      .reshape({num_tokens, top_k, self.size(1)});
+  return (gathered * combine_weights.unsqueeze(-1)).sum(1);
+}
+
 Tensor & index_fill_(Tensor & self, int64_t dim, const Tensor & index, const Scalar& source) {
   at::NoNamesGuard guard;
 
@@ -1687,6 +1720,9 @@ static void scatter_reduce_exclude_self_helper(
       case ReductionType::MEAN:
         init_val = (scalar_t)0;
         break;
+      default:
+        init_val = (scalar_t)0;
+        break;
     }
     self.scatter_(dim, index, init_val);
   });
@@ -1903,7 +1939,16 @@ TORCH_IMPL_FUNC(scatter_add)
   // See Note [Enabling Deterministic Operations]
   // Avoid gpuAtomicAdd for CUDA if deterministic mode is turned on
   if (globalContext().deterministicAlgorithms() && self.device().type() == DeviceType::CUDA) {
-    _scatter_via_index_put(self, dim, index, src, mut_out, /*accumulate*/true);
+    // Sort-segment-reduce: radix sort the linear destination indices and
+    // sum duplicate destinations in a fixed order, one write per output
+    // location. Bitwise reproducible, and cheaper than the
+    // _scatter_via_index_put fallback, which materializes a full
+    // [numel, ndim] coordinate tensor and re-linearizes it in index_put.
+    if (self.dim() >= 1) {
+      scatter_add_with_sort_stub(self.device().type(), mut_out, dim, index, src);
+    } else {
+      _scatter_via_index_put(self, dim, index, src, mut_out, /*accumulate*/true);
+    }
   } else {
     if (can_use_expanded_index_path(mut_out, dim, index, src, /*is_scatter_like*/true)) {
       scatter_add_expanded_index_stub(self.device().type(), mut_out, index, src);
@@ -351,6 +351,7 @@ TORCH_PRECOMPUTE_META_FUNC(cat)(const ITensorListRef& tensors, int64_t dim) {
 namespace at::native {
 
 DEFINE_DISPATCH(cat_serial_stub);
+DEFINE_DISPATCH(cat_parallel_stub);
 DEFINE_DISPATCH(stack_serial_stub);
 
 Tensor _reshape_from_tensor(const Tensor& self, const Tensor& shape_tensor) {
@@ -608,6 +609,33 @@ TORCH_IMPL_FUNC(cat_out_cpu)
     return;
   }
 
+  // Multi-threaded contiguous case: one kernel that partitions
+  // (input, outer-slice) pairs across threads, instead of a copy_ dispatch
+  // per input, which dominates when catting many small tensors.
+  // Mirrors the AT_DISPATCH_ALL_TYPES_AND3 set in cat_parallel_kernel.
+  bool parallel_dtype = false;
+  switch (dtype) {
+    case kDouble:
+    case kFloat:
+    case kHalf:
+    case kBFloat16:
+    case kByte:
+    case kChar:
+    case kShort:
+    case kInt:
+    case kLong:
+    case kBool:
+      parallel_dtype = true;
+      break;
+    default:
+      break;
+  }
+  if (!use_serial_kernel && all_contiguous && all_same_dtype &&
+      parallel_dtype && (MemoryFormat::Contiguous == memory_format)) {
+    cat_parallel_stub(kCPU, result, materialized, dim);
+    return;
+  }
+
   int64_t offset = 0;
   if (all_same_sizes_and_stride && result.is_contiguous(memory_format) &&
       all_same_dtype) {
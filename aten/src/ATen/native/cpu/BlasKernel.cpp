@@ -1,6 +1,7 @@
 #define TORCH_ASSERT_NO_OPERATORS
 #include <ATen/Dispatch.h>
 #include <ATen/Parallel.h>
+#include <ATen/cpu/vec/vec.h>
 #include <ATen/native/CPUBlas.h>
 #include <ATen/native/cpu/zmath.h>
 #include <c10/util/irange.h>
@@ -465,6 +466,110 @@ void gemm_core_(
   }
 }
 
+// Vectorized kernel for a single small notrans/notrans GEMM. With m, n and k
+// all capped at 64 (see could_use_small_gemm_batched) a column tile of
+// accumulators stays in registers across the whole k loop, so each element of
+// a and b is loaded exactly once per tile.
+template <typename scalar_t>
+void small_gemm_notrans_(
+    int64_t m, int64_t n, int64_t k,
+    scalar_t alpha,
+    const scalar_t *a, int64_t lda,
+    const scalar_t *b, int64_t ldb,
+    scalar_t beta,
+    scalar_t *c, int64_t ldc) {
+  using Vec = vec::Vectorized<scalar_t>;
+  constexpr int64_t n_tile = 4;
+  for (int64_t j0 = 0; j0 < n; j0 += n_tile) {
+    const int64_t jt = std::min(n_tile, n - j0);
+    int64_t i = 0;
+    for (; i + Vec::size() <= m; i += Vec::size()) {
+      // The SIMD specializations of Vectorized are not zero-initialized by
+      // their default constructor, so fill explicitly.
+      std::array<Vec, n_tile> acc;
+      acc.fill(Vec(scalar_t(0)));
+      for (const auto l : c10::irange(k)) {
+        const Vec a_vec = Vec::loadu(a + l * lda + i);
+        for (const auto jj : c10::irange(jt)) {
+          acc[jj] = vec::fmadd(Vec(b[l + (j0 + jj) * ldb]), a_vec, acc[jj]);
+        }
+      }
+      for (const auto jj : c10::irange(jt)) {
+        scalar_t *c_ = c + (j0 + jj) * ldc + i;
+        if (beta == scalar_t(0)) {
+          (acc[jj] * Vec(alpha)).store(c_);
+        } else {
+          (vec::fmadd(Vec(alpha), acc[jj], Vec::loadu(c_) * Vec(beta))).store(c_);
+        }
+      }
+    }
+    for (; i < m; i++) {
+      for (const auto jj : c10::irange(jt)) {
+        scalar_t acc_value = 0;
+        for (const auto l : c10::irange(k)) {
+          acc_value += a[l * lda + i] * b[l + (j0 + jj) * ldb];
+        }
+        scalar_t *c_ = c + (j0 + jj) * ldc + i;
+        if (beta == scalar_t(0)) {
+          *c_ = alpha * acc_value;
+        } else {
+          *c_ = beta * *c_ + alpha * acc_value;
+        }
+      }
+    }
+  }
+}
+
+template <typename scalar_t>
+void small_gemm_batched_(
+    TransposeType transa, TransposeType transb,
+    int64_t batch_size, int64_t m, int64_t n, int64_t k,
+    scalar_t alpha,
+    const scalar_t *a, int64_t lda, int64_t batch_stride_a,
+    const scalar_t *b, int64_t ldb, int64_t batch_stride_b,
+    scalar_t beta,
+    scalar_t *c, int64_t ldc, int64_t batch_stride_c) {
+  // Each matrix is far too small to be worth splitting, so parallelism comes
+  // solely from partitioning the batch dimension.
+  const int64_t grain_size =
+      std::max(at::internal::GRAIN_SIZE / (m * n * k * 2), (int64_t)1);
+  parallel_for(0, batch_size, grain_size, [&](int64_t begin, int64_t end) {
+    for (const auto batch : c10::irange(begin, end)) {
+      const scalar_t *a_ = a + batch * batch_stride_a;
+      const scalar_t *b_ = b + batch * batch_stride_b;
+      scalar_t *c_ = c + batch * batch_stride_c;
+      if (transa == TransposeType::NoTranspose &&
+          transb == TransposeType::NoTranspose) {
+        small_gemm_notrans_(m, n, k, alpha, a_, lda, b_, ldb, beta, c_, ldc);
+      } else {
+        // Transposed operands are rare on this path; the serial kernels still
+        // benefit from the batch-level partitioning.
+        gemm_core_(transa, transb, m, n, k, alpha, a_, lda, b_, ldb, beta, c_, ldc);
+      }
+    }
+  });
+}
+
+void cpublas_small_gemm_batched_impl(
+    at::ScalarType type,
+    TransposeType transa, TransposeType transb,
+    int64_t batch_size, int64_t m, int64_t n, int64_t k,
+    const Scalar& alpha,
+    const void *a, int64_t lda, int64_t batch_stride_a,
+    const void *b, int64_t ldb, int64_t batch_stride_b,
+    const Scalar& beta,
+    void *c, int64_t ldc, int64_t batch_stride_c) {
+  AT_DISPATCH_FLOATING_TYPES(type, "cpublas_small_gemm_batched_impl", [&]{
+        small_gemm_batched_(
+            transa, transb, batch_size, m, n, k,
+            alpha.to<scalar_t>(),
+            static_cast<const scalar_t *>(a), lda, batch_stride_a,
+            static_cast<const scalar_t *>(b), ldb, batch_stride_b,
+            beta.to<scalar_t>(),
+            static_cast<scalar_t *>(c), ldc, batch_stride_c);
+      });
+}
+
 #if !defined(C10_MOBILE)
 #define _AT_DISPATCH_GEMM_TYPES(TYPE, NAME, ...)                                                \
         AT_DISPATCH_ALL_TYPES_AND_COMPLEX_AND6(                                                 \
@@ -534,6 +639,7 @@ void cpublas_copy_impl(at::ScalarType type, int64_t n, const void *_x, int64_t i
 
 
 REGISTER_DISPATCH(cpublas::gemm_stub, &cpublas::cpublas_gemm_impl);
+REGISTER_DISPATCH(cpublas::small_gemm_batched_stub, &cpublas::cpublas_small_gemm_batched_impl);
 REGISTER_DISPATCH(cpublas::axpy_stub, &cpublas::cpublas_axpy_impl);
 REGISTER_DISPATCH(cpublas::copy_stub, &cpublas::cpublas_copy_impl);
 
@@ -2,6 +2,8 @@
 #include <ATen/core/Tensor.h>
 
 #include <ATen/Dispatch.h>
+#include <ATen/Parallel.h>
+#include <ATen/TensorIterator.h>
 #include <ATen/native/cpu/CatKernel.h>
 #include <ATen/cpu/vec/functional.h>
 #include <ATen/cpu/vec/vec.h>
@@ -61,8 +63,98 @@ void cat_serial_kernel(const Tensor& result, const MaterializedITensorListRef& t
   });
 }
 
+template <typename scalar_t>
+inline void copy_block(scalar_t* dst, const scalar_t* src, int64_t size) {
+  using Vec = vec::Vectorized<scalar_t>;
+  int64_t d = 0;
+  for (; d < size - (size % Vec::size()); d += Vec::size()) {
+    Vec in_vec = Vec::loadu(src + d);
+    in_vec.store(dst + d);
+  }
+  #if !defined(_MSC_VER) && !defined(COMPILING_FOR_MIN_SIZE)
+  # pragma unroll
+  #endif
+  for (; d < size; d++) {
+    dst[d] = src[d];
+  }
+}
+
+// Multi-threaded variant of cat_serial_kernel_impl: the output layout is
+// computed up front and (input, outer-slice) pairs are partitioned across
+// threads, so catting many small inputs costs one parallel region instead
+// of one copy_ dispatch per input.
+template <typename scalar_t>
+void cat_parallel_kernel_impl(const Tensor& result, const MaterializedITensorListRef& tensors, int64_t dim) {
+  TORCH_INTERNAL_ASSERT_DEBUG_ONLY(
+      dim >= 0 && dim < result.dim(), "dim out of range in cat_parallel_kernel_impl");
+  int64_t outer = result.numel() / (result.sizes()[dim] * result.strides()[dim]);
+  scalar_t* result_data = result.data_ptr<scalar_t>();
+  int64_t ninputs = static_cast<int64_t>(tensors.size());
+  std::vector<InputMeta> inputs;
+  inputs.reserve(ninputs);
+  for (const Tensor& tensor : tensors) {
+    inputs.emplace_back(tensor, dim, result.strides()[dim]);
+  }
+
+  // Prefix sums give each input's element offset inside an outer slice.
+  std::vector<int64_t> input_offsets(ninputs + 1, 0);
+  bool same_inner = true;
+  for (const auto j : c10::irange(ninputs)) {
+    input_offsets[j + 1] = input_offsets[j] + inputs[j].inner_size;
+    same_inner = same_inner && inputs[j].inner_size == inputs[0].inner_size;
+  }
+  int64_t slice_size = input_offsets[ninputs];
+  if (slice_size == 0) {
+    return;
+  }
+  int64_t ntasks = outer * ninputs;
+  int64_t grain = std::max<int64_t>(
+      1, at::internal::GRAIN_SIZE / std::max<int64_t>(1, slice_size / ninputs));
+
+  if (same_inner) {
+    // Equal-shape inputs (the stack layout): walk input-major so every
+    // task reads one input's rows as a sequential stream and interleaves
+    // them into the output at a fixed stride of slice_size.
+    const int64_t inner = inputs[0].inner_size;
+    at::parallel_for(0, ntasks, grain, [&](int64_t begin, int64_t end) {
+      while (begin < end) {
+        int64_t j = begin / outer;
+        int64_t i = begin % outer;
+        int64_t rows = std::min(end - begin, outer - i);
+        const scalar_t* src = (const scalar_t*)(inputs[j].data_ptr) + i * inner;
+        scalar_t* dst = result_data + i * slice_size + j * inner;
+        for (const auto r C10_UNUSED : c10::irange(rows)) {
+          copy_block(dst, src, inner);
+          src += inner;
+          dst += slice_size;
+        }
+        begin += rows;
+      }
+    });
+    return;
+  }
+
+  at::parallel_for(0, ntasks, grain, [&](int64_t begin, int64_t end) {
+    for (const auto k : c10::irange(begin, end)) {
+      int64_t i = k / ninputs;
+      int64_t j = k % ninputs;
+      int64_t inner = inputs[j].inner_size;
+      const scalar_t* src = (const scalar_t*)(inputs[j].data_ptr) + i * inner;
+      scalar_t* dst = result_data + i * slice_size + input_offsets[j];
+      copy_block(dst, src, inner);
+    }
+  });
+}
+
+void cat_parallel_kernel(const Tensor& result, const MaterializedITensorListRef& tensors, int64_t dim) {
+  AT_DISPATCH_ALL_TYPES_AND3(kBFloat16, kHalf, kBool, result.scalar_type(), "cat_parallel_kernel", [&]() {
+    cat_parallel_kernel_impl<scalar_t>(result, tensors, dim);
+  });
+}
+
 } // anonymous namespace
 
 REGISTER_DISPATCH(cat_serial_stub, &cat_serial_kernel);
+REGISTER_DISPATCH(cat_parallel_stub, &cat_parallel_kernel);
 
 } // at::native
@@ -9,4 +9,7 @@ namespace at { namespace native {
 using cat_serial_fn = void(*)(const Tensor &, const MaterializedITensorListRef&, int64_t);
 DECLARE_DISPATCH(cat_serial_fn, cat_serial_stub);
 
+using cat_parallel_fn = void(*)(const Tensor &, const MaterializedITensorListRef&, int64_t);
+DECLARE_DISPATCH(cat_parallel_fn, cat_parallel_stub);
+
 }}  // namespace at::native
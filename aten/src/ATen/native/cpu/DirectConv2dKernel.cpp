@@ -0,0 +1,244 @@
+#define TORCH_ASSERT_ONLY_METHOD_OPERATORS
+#include <ATen/native/cpu/DirectConv2dKernel.h>
+#include <ATen/core/Tensor.h>
+#include <ATen/Parallel.h>
+#include <ATen/cpu/vec/functional.h>
+#include <ATen/cpu/vec/vec.h>
+#include <c10/util/flat_hash_map.h>
+#include <c10/util/irange.h>
+
+#ifndef AT_PER_OPERATOR_HEADERS
+#include <ATen/Functions.h>
+#else
+#include <ATen/ops/empty.h>
+#endif
+
+#include <algorithm>
+#include <array>
+#include <mutex>
+
+namespace at::native {
+namespace {
+
+// Note [Direct NHWC convolution]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Late-stage CNN feature maps (7x7 and smaller) at batch 1 are latency
+// bound: im2col rewrites the input kernel_h * kernel_w times before the
+// GEMM ever runs, and GEMM backends pick throughput-oriented blockings for
+// such skinny problems. This kernel computes the convolution directly from
+// the channels-last input instead. For one output pixel and one kernel row,
+// the (kernel_col, channel) loops collapse into a single contiguous dot
+// product: in NHWC both the input row segment and the weight row segment
+// are dense over kernel columns x channels. The register tile spans a small
+// group of output channels, so each input vector load is reused once per
+// accumulator and only the weights stream.
+//
+// Selection is gated in ConvParams::use_cpu_direct_nhwc; the per-shape
+// register tile is chosen once and memoized, see select_oc_unroll below.
+
+using Vec = vec::Vectorized<float>;
+
+struct Arguments final {
+  int64_t in_rows;
+  int64_t in_cols;
+  int64_t channels;
+
+  int64_t kernel_rows;
+  int64_t kernel_cols;
+  int64_t stride_rows;
+  int64_t stride_cols;
+  int64_t pad_rows;
+  int64_t pad_cols;
+
+  int64_t out_rows;
+  int64_t out_cols;
+  int64_t out_channels;
+};
+
+// Serving workloads only ever see a handful of (shape, stride)
+// combinations, so the tile decision is made once per shape and memoized.
+// This is also the single point where measured (rather than modeled)
+// per-shape tuning can slot in later.
+int64_t select_oc_unroll(const Arguments& args) {
+  const uint64_t key = (static_cast<uint64_t>(args.channels) << 40) |
+      (static_cast<uint64_t>(args.out_channels) << 16) |
+      (static_cast<uint64_t>(args.kernel_rows) << 8) |
+      static_cast<uint64_t>(args.kernel_cols);
+
+  static std::mutex mutex;
+  static ska::flat_hash_map<uint64_t, int64_t> cache;
+  std::lock_guard<std::mutex> guard(mutex);
+  const auto it = cache.find(key);
+  if (it != cache.end()) {
+    return it->second;
+  }
+
+  // Long dot products amortize the per-accumulator horizontal reduction, so
+  // a tile of four output channels already keeps the FMA units busy while
+  // staying well inside the vector register budget (accumulators plus the
+  // shared input vector). Short products are reduction bound and want the
+  // widest tile.
+  const int64_t dot_length = args.kernel_cols * args.channels;
+  const int64_t unroll = dot_length < 4 * Vec::size() ? 8 : 4;
+  cache.emplace(key, unroll);
+  return unroll;
+}
+
+// One output pixel, kOcUnroll consecutive output channels. Kernel taps that
+// fall into the padding are clipped from the loop bounds up front, so the
+// inner loops are branch free.
+template <int64_t kOcUnroll>
+void direct_conv2d_pixel(
+    const Arguments& args,
+    const float* input,
+    const float* weight,
+    const float* bias,
+    float* output,
+    int64_t oh,
+    int64_t ow,
+    int64_t oc) {
+  const int64_t channels = args.channels;
+  const int64_t ih0 = oh * args.stride_rows - args.pad_rows;
+  const int64_t iw0 = ow * args.stride_cols - args.pad_cols;
+  const int64_t kh_begin = std::max<int64_t>(-ih0, 0);
+  const int64_t kh_end = std::min(args.kernel_rows, args.in_rows - ih0);
+  const int64_t kw_begin = std::max<int64_t>(-iw0, 0);
+  const int64_t kw_end = std::min(args.kernel_cols, args.in_cols - iw0);
+  const int64_t weight_oc_stride =
+      args.kernel_rows * args.kernel_cols * channels;
+
+  // Adjacent kernel columns address adjacent input pixels regardless of the
+  // stride, so each kernel row contributes one dense span.
+  const int64_t span = std::max<int64_t>(kw_end - kw_begin, 0) * channels;
+  const int64_t vec_span = span - span % Vec::size();
+
+  std::array<Vec, kOcUnroll> acc;
+  std::array<float, kOcUnroll> tail;
+  acc.fill(Vec(0.f));
+  tail.fill(0.f);
+  for (const auto kh : c10::irange(kh_begin, kh_end)) {
+    const float* in_row =
+        input + ((ih0 + kh) * args.in_cols + iw0 + kw_begin) * channels;
+    const float* weight_row = weight +
+        ((oc * args.kernel_rows + kh) * args.kernel_cols + kw_begin) *
+            channels;
+    int64_t i = 0;
+    for (; i < vec_span; i += Vec::size()) {
+      const Vec in = Vec::loadu(in_row + i);
+      for (const auto u : c10::irange(kOcUnroll)) {
+        acc[u] = vec::fmadd(
+            Vec::loadu(weight_row + u * weight_oc_stride + i), in, acc[u]);
+      }
+    }
+    for (; i < span; ++i) {
+      for (const auto u : c10::irange(kOcUnroll)) {
+        tail[u] += in_row[i] * weight_row[u * weight_oc_stride + i];
+      }
+    }
+  }
+
+  float* out = output + (oh * args.out_cols + ow) * args.out_channels + oc;
+  for (const auto u : c10::irange(kOcUnroll)) {
+    out[u] = vec::vec_reduce_all<float>(
+                 [](Vec& x, Vec& y) { return x + y; }, acc[u]) +
+        tail[u] + (bias != nullptr ? bias[oc + u] : 0.f);
+  }
+}
+
+template <int64_t kOcUnroll>
+void direct_conv2d_tile(
+    const Arguments& args,
+    const float* input,
+    const float* weight,
+    const float* bias,
+    float* output,
+    int64_t oc) {
+  for (const auto oh : c10::irange(args.out_rows)) {
+    for (const auto ow : c10::irange(args.out_cols)) {
+      direct_conv2d_pixel<kOcUnroll>(
+          args, input, weight, bias, output, oh, ow, oc);
+    }
+  }
+}
+
+Tensor _convolution_direct_nhwc(
+    const Tensor& input,
+    const Tensor& weight,
+    const Tensor& bias_potentially_undefined,
+    const IntArrayRef stride,
+    const IntArrayRef padding) {
+  const Arguments args{
+      input.size(2),
+      input.size(3),
+      input.size(1),
+      weight.size(2),
+      weight.size(3),
+      stride[0],
+      stride[1],
+      padding[0],
+      padding[1],
+      (input.size(2) + 2 * padding[0] - weight.size(2)) / stride[0] + 1,
+      (input.size(3) + 2 * padding[1] - weight.size(3)) / stride[1] + 1,
+      weight.size(0),
+  };
+  const int64_t batch = input.size(0);
+
+  Tensor output = at::empty(
+      {batch, args.out_channels, args.out_rows, args.out_cols},
+      input.options().memory_format(at::MemoryFormat::ChannelsLast));
+
+  const float* const input_ptr = input.const_data_ptr<float>();
+  const float* const weight_ptr = weight.const_data_ptr<float>();
+  const float* const bias_ptr = bias_potentially_undefined.defined()
+      ? bias_potentially_undefined.const_data_ptr<float>()
+      : nullptr;
+  float* const output_ptr = output.data_ptr<float>();
+
+  const int64_t oc_unroll = select_oc_unroll(args);
+  // Task granularity: one image x one chunk of output channels, so that the
+  // typical serving shape (batch 1, wide out_channels) still spreads across
+  // the intra-op pool.
+  constexpr int64_t kOcChunk = 64;
+  const int64_t oc_chunks = (args.out_channels + kOcChunk - 1) / kOcChunk;
+  at::parallel_for(
+      0, batch * oc_chunks, 1, [&](const int64_t begin, const int64_t end) {
+        for (const auto task : c10::irange(begin, end)) {
+          const int64_t n = task / oc_chunks;
+          const float* in_n =
+              input_ptr + n * args.in_rows * args.in_cols * args.channels;
+          float* out_n = output_ptr +
+              n * args.out_rows * args.out_cols * args.out_channels;
+          int64_t oc = (task % oc_chunks) * kOcChunk;
+          const int64_t oc_end =
+              std::min(oc + kOcChunk, args.out_channels);
+          while (oc < oc_end) {
+            const int64_t left = oc_end - oc;
+            if (oc_unroll == 8 && left >= 8) {
+              direct_conv2d_tile<8>(
+                  args, in_n, weight_ptr, bias_ptr, out_n, oc);
+              oc += 8;
+            } else if (left >= 4) {
+              direct_conv2d_tile<4>(
+                  args, in_n, weight_ptr, bias_ptr, out_n, oc);
+              oc += 4;
+            } else if (left >= 2) {
+              direct_conv2d_tile<2>(
+                  args, in_n, weight_ptr, bias_ptr, out_n, oc);
+              oc += 2;
+            } else {
+              direct_conv2d_tile<1>(
+                  args, in_n, weight_ptr, bias_ptr, out_n, oc);
+              oc += 1;
+            }
+          }
+        }
+      });
+
+  return output;
+}
+
+}  // namespace
+
+ALSO_REGISTER_AVX512_DISPATCH(convolution_direct_nhwc_stub, &_convolution_direct_nhwc);
+
+}  // namespace at::native
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <ATen/native/DispatchStub.h>
+#include <c10/util/ArrayRef.h>
+
+/*
+  Direct NHWC convolution operator for small spatial outputs
+*/
+
+namespace at {
+class Tensor;
+
+namespace native {
+
+using convolution_direct_nhwc_fn =
+    Tensor (*)(const Tensor &, const Tensor &, const Tensor &, IntArrayRef, IntArrayRef);
+
+DECLARE_DISPATCH(convolution_direct_nhwc_fn, convolution_direct_nhwc_stub);
+
+}  // namespace native
+}  // namespace at
@@ -1,12 +1,17 @@
 #pragma once
 
 #include <ATen/CPUApplyUtils.h>
+#include <ATen/CPUGeneratorImpl.h>
+#include <ATen/Context.h>
 #include <ATen/Dispatch.h>
 #include <ATen/Dispatch_v2.h>
 #include <ATen/ExpandBase.h>
+#include <ATen/Parallel.h>
 #include <ATen/core/DistributionsHelper.h>
+#include <ATen/core/PhiloxRNGEngine.h>
 #include <ATen/native/TensorIterator.h>
 #include <ATen/native/cpu/Loops.h>
+#include <algorithm>
 #include <limits>
 #include <mutex>
 
@@ -21,6 +26,63 @@ namespace templates {
 namespace cpu {
 namespace {
 
+// ================================================ Batched Philox fill ===============================================
+
+// Opt-in (see Context::parallelCpuRandomFill) lock-free path for bulk random
+// initialization. Instead of drawing every sample from the shared mt19937
+// engine under the generator mutex, each call reserves a Philox counter range
+// on the generator (CPUGeneratorImpl::philox_engine_inputs, mirroring the
+// CUDA generator) and samples in parallel. Elements are processed in
+// fixed-size chunks, each chunk on its own Philox subsequence, so the values
+// produced for a given seed do not depend on the number of threads.
+
+constexpr int64_t PHILOX_FILL_CHUNK_SIZE = 256;
+// Upper bound on the Philox offsets a chunk can consume: offsets advance per
+// group of four 32-bit outputs and the costliest sample (a double normal)
+// draws at most four 32-bit values per element.
+constexpr uint64_t PHILOX_OFFSETS_PER_FILL = PHILOX_FILL_CHUNK_SIZE;
+
+// Adapter giving at::Philox4_32 the random()/random64() interface the
+// distribution templates expect from a generator.
+struct PhiloxFillRNG {
+  PhiloxFillRNG(uint64_t seed, uint64_t subsequence, uint64_t offset)
+      : engine_(seed, subsequence, offset) {}
+  uint32_t random() {
+    return engine_();
+  }
+  uint64_t random64() {
+    const uint64_t hi = engine_();
+    const uint64_t lo = engine_();
+    return (hi << 32) | lo;
+  }
+
+ private:
+  at::Philox4_32 engine_;
+};
+
+template <typename scalar_t, typename RNG, typename dist_factory_t>
+void philox_fill_parallel(scalar_t* data, int64_t numel, RNG generator, const dist_factory_t& dist_factory) {
+  uint64_t seed = 0;
+  uint64_t offset = 0;
+  {
+    // The lock is only held to reserve this call's counter range.
+    std::lock_guard<std::mutex> lock(generator->mutex_);
+    std::tie(seed, offset) = generator->philox_engine_inputs(PHILOX_OFFSETS_PER_FILL);
+  }
+  const int64_t num_chunks = (numel + PHILOX_FILL_CHUNK_SIZE - 1) / PHILOX_FILL_CHUNK_SIZE;
+  at::parallel_for(0, num_chunks, 1, [&](int64_t begin, int64_t end) {
+    for (const auto chunk : c10::irange(begin, end)) {
+      PhiloxFillRNG rng(seed, static_cast<uint64_t>(chunk), offset);
+      auto dist = dist_factory();
+      const int64_t chunk_begin = chunk * PHILOX_FILL_CHUNK_SIZE;
+      const int64_t chunk_end = std::min(numel, chunk_begin + PHILOX_FILL_CHUNK_SIZE);
+      for (const auto i : c10::irange(chunk_begin, chunk_end)) {
+        data[i] = static_cast<scalar_t>(dist(&rng));
+      }
+    }
+  });
+}
+
 // ==================================================== Random ========================================================
 
 template<typename RNG>
@@ -231,6 +293,16 @@ void normal_fill(const TensorBase &self, const scalar_t mean, const scalar_t std
 template<typename RNG>
 void normal_kernel(const TensorBase &self, double mean, double std, RNG generator) {
   auto size = self.numel();
+  if constexpr (std::is_same_v<RNG, CPUGeneratorImpl*>) {
+    if (at::globalContext().parallelCpuRandomFill() && self.is_contiguous() && size > 0) {
+      AT_DISPATCH_FLOATING_TYPES_AND2(kHalf, kBFloat16, self.scalar_type(), "normal_kernel_cpu", [&] {
+        philox_fill_parallel(self.data_ptr<scalar_t>(), size, generator, [mean, std]() {
+          return at::normal_distribution<double>(mean, std);
+        });
+      });
+      return;
+    }
+  }
   if (self.scalar_type() == ScalarType::Float && size >= 16 && self.is_contiguous()) {
 #ifdef CPU_CAPABILITY_AVX2
     normal_fill_AVX2(self, static_cast<float>(mean), static_cast<float>(std), generator);
@@ -267,9 +339,19 @@ struct NormalKernel {
 template<typename RNG>
 void uniform_kernel(TensorIteratorBase& iter, double from_, double to_, RNG generator) {
   AT_DISPATCH_FLOATING_TYPES_AND2(kHalf, kBFloat16, iter.dtype(), "uniform_kernel_cpu", [&]() {
-    std::lock_guard<std::mutex> lock(generator->mutex_);
     auto from = static_cast<scalar_t>(from_);
     auto to = static_cast<scalar_t>(to_);
+    if constexpr (std::is_same_v<RNG, CPUGeneratorImpl*>) {
+      if (at::globalContext().parallelCpuRandomFill() && iter.ntensors() == 1 &&
+          iter.is_contiguous() && iter.numel() > 0) {
+        philox_fill_parallel(
+            reinterpret_cast<scalar_t*>(iter.data_ptr(0)), iter.numel(), generator, [from, to]() {
+              return at::uniform_real_distribution<scalar_t>(from, to);
+            });
+        return;
+      }
+    }
+    std::lock_guard<std::mutex> lock(generator->mutex_);
     at::uniform_real_distribution<scalar_t> uniform(from, to);
     cpu_serial_kernel(iter, [&uniform, generator]() -> scalar_t {
       return static_cast<scalar_t>(uniform(generator));
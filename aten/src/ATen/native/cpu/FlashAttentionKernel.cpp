@@ -183,6 +183,313 @@ void reshape_attn_mask_to_4d(
                 .expand({attn_mask_size_0, attn_mask_size_1, qSize, kvSize});
 }
 
+// KV-parallel variant of cpu_flash_attention for the case where
+// batchSize * num_head * qSlice alone cannot occupy the thread pool, e.g.
+// batch-1 long-context prefill on many-core hosts. The KV dimension is
+// additionally sharded across threads: every (batch, head, q block, kv shard)
+// unit computes a partial output with its own running max and sum, and a
+// second pass merges the shards of each q block with one more online-softmax
+// rescale.
+template <typename scalar_t, typename mask_t, int64_t q_split_size, int64_t kv_split_size>
+void cpu_flash_attention_kv_parallel(
+    const Tensor& output,
+    const Tensor& logsumexp,
+    const at::Tensor& q,
+    const at::Tensor& k,
+    const at::Tensor& v,
+    double dropout_p,
+    bool is_causal,
+    std::optional<Tensor> attn_mask,
+    std::optional<double> scale) {
+  at::Tensor query = q.transpose(1, 2);
+  at::Tensor key = k.transpose(1, 2);
+  at::Tensor value = v.transpose(1, 2);
+
+  constexpr bool is_reduced_type = is_reduced_floating_point_v<scalar_t>;
+  using accum_t = at::opmath_type<scalar_t>;
+  using Vec = vec::Vectorized<accum_t>;
+  accum_t scaling_factor =
+      sdp::calculate_scale(query, scale).as_float_unchecked();
+
+  int64_t batchSize = query.size(0);
+  int64_t qSize = query.size(1);
+  int64_t kvSize = value.size(1);
+  int64_t num_head = query.size(2);
+  int64_t headSize = query.size(3);
+
+  bool has_attn_mask = attn_mask.has_value() && attn_mask.value().numel();
+  if (has_attn_mask) {
+    reshape_attn_mask_to_4d(attn_mask.value(), batchSize, num_head, qSize, kvSize);
+  }
+
+  // Strides
+  int64_t qStrideB = query.stride(0);
+  int64_t qStrideM = query.stride(1);
+  int64_t qStrideH = query.stride(2);
+  int64_t kStrideB = key.stride(0);
+  int64_t kStrideN = key.stride(1);
+  int64_t kStrideH = key.stride(2);
+  int64_t vStrideB = value.stride(0);
+  int64_t vStrideN = value.stride(1);
+  int64_t vStrideH = value.stride(2);
+  int64_t oStrideB = output.stride(0);
+  int64_t oStrideM = output.stride(1);
+  int64_t oStrideH = output.stride(2);
+  int64_t lStrideB = logsumexp.stride(0);
+  int64_t lStrideM = logsumexp.stride(1);
+  int64_t lStrideH = logsumexp.stride(2);
+  int64_t mStrideB =
+      (has_attn_mask && attn_mask.value().size(0) > 1)
+      ? attn_mask.value().stride(0)
+      : 0;
+  int64_t mStrideH =
+      (has_attn_mask && attn_mask.value().size(1) > 1)
+      ? attn_mask.value().stride(1)
+      : 0;
+  int64_t mStrideM =
+      (has_attn_mask && attn_mask.value().size(2) > 1)
+      ? attn_mask.value().stride(2)
+      : 0;
+  int64_t mStrideN =
+      (has_attn_mask && attn_mask.value().size(3) > 1)
+      ? attn_mask.value().stride(3)
+      : 0;
+
+  int64_t qSplitSize = q_split_size > qSize ? qSize : q_split_size;
+  int64_t kvSplitSize = kv_split_size > kvSize ? kvSize : kv_split_size;
+  int64_t qSlice = (qSize - 1) / qSplitSize + 1;
+  int64_t kvSlice = (kvSize - 1) / kvSplitSize + 1;
+  int64_t num_thread = at::get_num_threads();
+  int64_t nTasks = batchSize * num_head * qSlice;
+  // Shard the KV blocks of each (batch, head, q block) task so that
+  // nTasks * shardsPerTask roughly fills the thread pool; every shard spans
+  // whole kvSplitSize blocks so the causal tail handling stays shard-local.
+  int64_t shardsPerTask =
+      std::min(kvSlice, (num_thread + nTasks - 1) / nTasks);
+  int64_t blocksPerShard = (kvSlice + shardsPerTask - 1) / shardsPerTask;
+  shardsPerTask = (kvSlice + blocksPerShard - 1) / blocksPerShard;
+  int64_t nUnits = nTasks * shardsPerTask;
+
+  const auto dtype = query.scalar_type();
+  const auto accumulate_dtype = toOpMathType(dtype);
+
+  // Per-unit partials; these survive until the merge pass.
+  int64_t size_per_unit =
+      /* dst */ qSplitSize * headSize +
+      /* max */ qSplitSize +
+      /* sum */ qSplitSize;
+  at::Tensor part_buf = at::empty({nUnits, size_per_unit}, query.options().dtype(accumulate_dtype));
+  // Per-thread scratch for the score tile.
+  at::Tensor buf = at::empty({num_thread, qSplitSize * kvSplitSize}, query.options().dtype(accumulate_dtype));
+  at::Tensor buf_reduced = at::empty({num_thread, qSplitSize, is_reduced_type ? kvSplitSize : 0}, query.options());
+
+  // Data ptrs
+  const scalar_t* q_data = query.const_data_ptr<scalar_t>();
+  const scalar_t* k_data = key.const_data_ptr<scalar_t>();
+  const scalar_t* v_data = value.const_data_ptr<scalar_t>();
+  mask_t* mask_data = has_attn_mask
+      ? attn_mask.value().data_ptr<mask_t>()
+      : nullptr;
+  scalar_t* out_data = output.data_ptr<scalar_t>();
+  accum_t* lse_data = logsumexp.data_ptr<accum_t>();
+  accum_t* part_data = part_buf.data_ptr<accum_t>();
+  accum_t* buf_data = buf.data_ptr<accum_t>();
+  scalar_t* buf_reduced_data = is_reduced_type ? buf_reduced.data_ptr<scalar_t>() : nullptr;
+
+  at::parallel_for(0, nUnits, 1, [&](int64_t begin, int64_t end) {
+    int ompIdx = at::get_thread_num();
+    accum_t* qk_data = buf_data + ompIdx * qSplitSize * kvSplitSize;
+    scalar_t* qk_reduced_data = is_reduced_type ? buf_reduced_data + ompIdx * qSplitSize * kvSplitSize : nullptr;
+
+    for (const auto u : c10::irange(begin, end)) {
+      int64_t task = u / shardsPerTask;
+      int64_t shard = u % shardsPerTask;
+      int64_t i = task / (num_head * qSlice);
+      int64_t j = (task / qSlice) % num_head;
+      int64_t m = (task % qSlice) * qSplitSize;
+      int64_t qBlockSize = std::min(qSplitSize, qSize - m);
+      int64_t num_keys = is_causal ? std::min(m + qBlockSize, kvSize) : kvSize;
+      int64_t nStart = shard * blocksPerShard * kvSplitSize;
+      int64_t nEnd = std::min(num_keys, nStart + blocksPerShard * kvSplitSize);
+      if (nStart >= nEnd) {
+        // Causal tail: this shard has no keys; the merge pass skips it.
+        continue;
+      }
+      accum_t* dst_data = part_data + u * size_per_unit;
+      accum_t* qk_max_data = dst_data + qSplitSize * headSize;
+      accum_t* qk_sum_data = qk_max_data + qSplitSize;
+      // Initialize max and sum
+      fill_stub(qk_max_data,
+          -std::numeric_limits<accum_t>::infinity(), qBlockSize);
+      fill_stub(qk_sum_data,
+          static_cast<accum_t>(0), qBlockSize);
+      for (int64_t n = nStart; n < nEnd; n += kvSplitSize) {
+        int64_t kvBlockSize = std::min(kvSplitSize, kvSize - n);
+        // Calculate scale * q @ k.T
+        cpublas::gemm(
+            TransposeType::Transpose,
+            TransposeType::NoTranspose,
+            kvBlockSize,
+            qBlockSize,
+            headSize,
+            static_cast<accum_t>(1),
+            k_data + i * kStrideB + j * kStrideH +
+                n * kStrideN,
+            kStrideN,
+            q_data + i * qStrideB + j * qStrideH +
+                m * qStrideM,
+            qStrideM,
+            static_cast<accum_t>(0),
+            qk_data,
+            kvBlockSize);
+        // Apply causal mask, fill unused with -inf
+        if (is_causal && num_keys - n <= kvSplitSize) {
+          for (const auto row : c10::irange(qBlockSize)) {
+            int64_t last_col = m + row - n;
+            accum_t* row_ptr = qk_data + row * kvBlockSize;
+            fill_stub(row_ptr + last_col + 1,
+                -std::numeric_limits<accum_t>::infinity(),
+                kvBlockSize - last_col - 1);
+          }
+        }
+        // Update attention weights with attention mask
+        // And apply scaling factor
+        // qk <- qk * scaling + attn_mask
+        if (has_attn_mask) {
+          for (int64_t row = 0; row < qBlockSize; ++row) {
+            if (mStrideN == 0) {
+              _scale_attn_mask_fusion_kernel</*is_stride_0*/ true>(
+                qk_data + row * kvBlockSize,
+                mask_data + i * mStrideB + j * mStrideH +
+                    (m + row) * mStrideM,
+                kvBlockSize,
+                qk_data + row * kvBlockSize,
+                scaling_factor);
+            } else {
+              _scale_attn_mask_fusion_kernel</*is_stride_0*/ false>(
+                qk_data + row * kvBlockSize,
+                mask_data + i * mStrideB + j * mStrideH +
+                    (m + row) * mStrideM + n,
+                kvBlockSize,
+                qk_data + row * kvBlockSize,
+                scaling_factor);
+            }
+          }
+        }
+        // Update coefficients with Softmax
+        accum_t tmp_max = 0, tmp_sum = 0, exp_tmp = 0;
+        for (int64_t row = 0; row < qBlockSize; ++row) {
+          if (has_attn_mask) {
+            // max per row
+            tmp_max = at::vec::reduce_all<accum_t>(
+                [](Vec& x, Vec& y) { return at::vec::maximum(x, y); },
+                qk_data + row * kvBlockSize,
+                kvBlockSize);
+          } else {
+            // apply scaling factor and max per row in fusion
+            _mul_reduce_max_fusion_kernel(
+                qk_data + row * kvBlockSize,
+                scaling_factor,
+                kvBlockSize,
+                qk_data + row * kvBlockSize,
+                tmp_max);
+          }
+          tmp_max = qk_max_data[row] > tmp_max ? qk_max_data[row] : tmp_max;
+          // qk <- exp(qk - max) and sum per row
+          tmp_sum = tmp_max;
+          _exp_reduce_sum_fusion_kernel(
+              qk_data + row * kvBlockSize, kvBlockSize,
+              conditional_data_ptr(qk_data, qk_reduced_data) + row * kvBlockSize,
+              tmp_sum);
+          // exp_tmp <- exp(max[row] - max)
+          exp_tmp = std::exp(qk_max_data[row] - tmp_max);
+          // sum[row] <- sum + exp_tmp * sum[row]
+          qk_sum_data[row] = tmp_sum + exp_tmp * qk_sum_data[row];
+          // max[row] <- max
+          qk_max_data[row] = tmp_max;
+          // dst <- dst * exp_tmp
+          if (n > nStart) {
+            vec::map<accum_t>(
+              [exp_tmp](Vec x) { return x * Vec(exp_tmp); },
+              dst_data + row * headSize, dst_data + row * headSize, headSize);
+          }
+        }
+        // Calculate Softmax(q @ k.T) @ v
+        cpublas::gemm(
+            TransposeType::NoTranspose,
+            TransposeType::NoTranspose,
+            headSize,
+            qBlockSize,
+            kvBlockSize,
+            static_cast<accum_t>(1),
+            v_data + i * vStrideB + j * vStrideH +
+                n * vStrideN,
+            vStrideN,
+            conditional_data_ptr(qk_data, qk_reduced_data),
+            kvBlockSize,
+            n == nStart ? static_cast<accum_t>(0) : static_cast<accum_t>(1),
+            dst_data,
+            headSize);
+      }
+    }
+  });
+
+  // Merge the KV shards of each q block with one more online-softmax rescale,
+  // accumulating into the first shard's partial dst.
+  at::parallel_for(0, nTasks, 1, [&](int64_t begin, int64_t end) {
+    for (const auto task : c10::irange(begin, end)) {
+      int64_t i = task / (num_head * qSlice);
+      int64_t j = (task / qSlice) % num_head;
+      int64_t m = (task % qSlice) * qSplitSize;
+      int64_t qBlockSize = std::min(qSplitSize, qSize - m);
+      int64_t num_keys = is_causal ? std::min(m + qBlockSize, kvSize) : kvSize;
+      accum_t* task_part = part_data + task * shardsPerTask * size_per_unit;
+      accum_t* lse_ptr = lse_data + i * lStrideB + j * lStrideH + m * lStrideM;
+      for (const auto row : c10::irange(qBlockSize)) {
+        accum_t g_max = -std::numeric_limits<accum_t>::infinity();
+        for (const auto s : c10::irange(shardsPerTask)) {
+          if (s * blocksPerShard * kvSplitSize >= num_keys) {
+            break;
+          }
+          accum_t* p_max = task_part + s * size_per_unit + qSplitSize * headSize;
+          g_max = std::max(g_max, p_max[row]);
+        }
+        accum_t g_sum = 0;
+        accum_t* acc = task_part + row * headSize;
+        for (const auto s : c10::irange(shardsPerTask)) {
+          if (s * blocksPerShard * kvSplitSize >= num_keys) {
+            break;
+          }
+          accum_t* p_dst = task_part + s * size_per_unit;
+          accum_t* p_max = p_dst + qSplitSize * headSize;
+          accum_t* p_sum = p_max + qSplitSize;
+          accum_t coeff = std::exp(p_max[row] - g_max);
+          g_sum += coeff * p_sum[row];
+          if (s == 0) {
+            vec::map<accum_t>(
+              [coeff](Vec x) { return x * Vec(coeff); },
+              acc, p_dst + row * headSize, headSize);
+          } else {
+            vec::map2<accum_t>(
+              [coeff](Vec x, Vec y) { return x + Vec(coeff) * y; },
+              acc, acc, p_dst + row * headSize, headSize);
+          }
+        }
+        // dst <- dst / sum[row]
+        // reorder MHA output with strides
+        accum_t sum_reciprocal = 1 / g_sum;
+        vec::map<scalar_t>(
+          [sum_reciprocal](Vec x) { return x * Vec(sum_reciprocal); },
+          out_data + i * oStrideB + j * oStrideH + (m + row) * oStrideM,
+          acc,
+          headSize);
+        // Store logsumexp for backward
+        lse_ptr[row * lStrideM] = g_max + std::log(g_sum);
+      }
+    }
+  });
+}
+
 template <typename scalar_t, typename mask_t, int64_t q_split_size, int64_t kv_split_size>
 void cpu_flash_attention(
     const Tensor& output,
@@ -219,6 +526,21 @@ void cpu_flash_attention(
   int64_t num_head = query.size(2);
   int64_t headSize = query.size(3);
 
+  // With a single long sequence the (batch * heads * q blocks) grid may not
+  // cover the thread pool; shard the KV dimension across threads as well.
+  {
+    int64_t qSplitSize = q_split_size > qSize ? qSize : q_split_size;
+    int64_t kvSplitSize = kv_split_size > kvSize ? kvSize : kv_split_size;
+    int64_t qSlice = (qSize - 1) / qSplitSize + 1;
+    if (batchSize * num_head * qSlice < at::get_num_threads() &&
+        kvSize >= 2 * kvSplitSize) {
+      cpu_flash_attention_kv_parallel<scalar_t, mask_t, q_split_size, kv_split_size>(
+          output, logsumexp, q, k, v,
+          dropout_p, is_causal, std::move(attn_mask), scale);
+      return;
+    }
+  }
+
   bool has_attn_mask = attn_mask.has_value() && attn_mask.value().numel();
   if (has_attn_mask) {
     reshape_attn_mask_to_4d(attn_mask.value(), batchSize, num_head, qSize, kvSize);
@@ -17,6 +17,7 @@
 #endif
 
 #include <algorithm>
+#include <array>
 #include <numeric>
 #include <functional>
 
@@ -120,6 +121,67 @@ void histogramdd_cpu_contiguous(Tensor& hist, const TensorList& bin_edges,
 
     int64_t GRAIN_SIZE = std::max(int64_t(1), HISTOGRAM_GRAIN_SIZE / D);
 
+    /* Specialized fast path for the common 1-D unweighted linear-interpolation
+     * case (torch.histc). Bin indices for a block of elements are computed in a
+     * tight branch-light loop which the compiler can vectorize, then scattered
+     * into this thread's private histogram in a second pass; the scatter itself
+     * is inherently scalar. Falls through to the general implementation below
+     * for every other configuration.
+     */
+    if constexpr (algorithm == LINEAR_INTERPOLATION) {
+        if (D == 1 && !accessor_wt.has_value()) {
+            const auto num_threads = at::get_num_threads();
+            Tensor thread_histograms = at::zeros({num_threads, hist.numel()}, hist.dtype());
+            TORCH_INTERNAL_ASSERT(thread_histograms.is_contiguous());
+
+            const input_t leftmost = leftmost_edge[0];
+            const input_t rightmost = rightmost_edge[0];
+            const int64_t bin_ct = num_bin_edges[0] - 1;
+
+            at::parallel_for(0, N, HISTOGRAM_GRAIN_SIZE, [&](int64_t start, int64_t end) {
+                input_t *hist_local_data = thread_histograms.data_ptr<input_t>()
+                        + thread_histograms.stride(0) * at::get_thread_num();
+
+                constexpr int64_t BLOCK_SIZE = 1024;
+                std::array<int64_t, BLOCK_SIZE> pos_buffer;
+
+                for (int64_t block_start = start; block_start < end; block_start += BLOCK_SIZE) {
+                    const int64_t block_end = std::min(block_start + BLOCK_SIZE, end);
+                    int64_t found = 0;
+
+                    for (const auto i : c10::irange(block_start, block_end)) {
+                        const input_t elt = accessor_in[i][0];
+
+                        // Skips elements which fall outside the specified bins and NaN elements
+                        if (!(elt >= leftmost && elt <= rightmost)) {
+                            continue;
+                        }
+
+                        // Same arithmetic as the general case below, so the two
+                        // paths select identical bins.
+                        int64_t pos = static_cast<int64_t>((elt - leftmost)
+                                * bin_ct
+                                / (rightmost - leftmost));
+
+                        // Unlike other bins, the rightmost bin includes its right boundary
+                        if (pos == bin_ct) {
+                            pos -= 1;
+                        }
+
+                        pos_buffer[found++] = pos;
+                    }
+
+                    for (const auto j : c10::irange(found)) {
+                        hist_local_data[pos_buffer[j]] += static_cast<input_t>(1);
+                    }
+                }
+            });
+
+            at::sum_out(hist, thread_histograms, /*dim=*/{0});
+            return;
+        }
+    }
+
     /* Parallelizes processing of input using at::parallel_for.
      * Each thread accumulates a local result into their own slice of
      * thread_histograms which get summed together at the end.
@@ -1,7 +1,10 @@
 #pragma once
 #include <ATen/native/TensorIterator.h>
+#include <c10/macros/Macros.h>
 #include <c10/util/irange.h>
 
+#include <cstring>
+
 namespace at {
 namespace native {
 
@@ -49,10 +52,37 @@ struct Indexer {
     }
     return offset;
   }
+
+  // Best-effort offset used only for software prefetch: same computation as
+  // get() but without bounds enforcement, so peeking ahead can never throw
+  // before the corresponding get() reports the bad index.
+  int64_t peek(int64_t idx) {
+    int64_t offset = 0;
+    for (const auto j : c10::irange(num_indexers)) {
+      int64_t value = *(int64_t*)&indexers[j][idx * indexer_strides[j]];
+      if (value < 0) {
+        value += original_sizes[j];
+      }
+      offset += value * original_strides[j];
+    }
+    return offset;
+  }
 };
+
+C10_ALWAYS_INLINE void prefetch_read(const void* addr) {
+#if defined(__GNUC__) || defined(__clang__)
+  __builtin_prefetch(addr, /*rw=*/0, /*locality=*/3);
+#else
+  (void)addr;
+#endif
+}
 } // anonymous namespace
 
-template <typename scalar_t, typename func_t>
+// is_plain_copy may be set by callers whose `f` is a pure element copy
+// (dst = src + offset); it enables bulk row copies and software prefetch of
+// upcoming gather targets, which dominate embedding-style gathers over
+// half-precision rows.
+template <typename scalar_t, bool is_plain_copy = false, typename func_t>
 void cpu_index_kernel(TensorIteratorBase& iter, IntArrayRef index_size, IntArrayRef index_stride,
                       const func_t& f, bool serial_execution=false)
 {
@@ -68,12 +98,31 @@ void cpu_index_kernel(TensorIteratorBase& iter, IntArrayRef index_size, IntArray
     if (is_constant_index(ntensor, strides)) {
       // specialization for when every element uses the same index
       int64_t offset = indexer.get(0);
+      if constexpr (is_plain_copy) {
+        // Embedding-style row gathers land here (the whole inner loop reads
+        // one indexed row); copy the row in bulk instead of element-wise.
+        if (strides[0] == sizeof(scalar_t) && strides[1] == sizeof(scalar_t)) {
+          std::memcpy(dst, src + offset, n * sizeof(scalar_t));
+          return;
+        }
+      }
       for (const auto i : c10::irange(n)) {
         f(dst + strides[0] * i, src + strides[1] * i, offset);
       }
     } else {
+      // Gather targets are data-dependent loads; for plain copies, telling
+      // the prefetcher about them a few iterations ahead hides most of the
+      // miss latency on tables that fall out of cache.
+      constexpr int64_t prefetch_distance = 8;
       for (const auto i : c10::irange(n)) {
         int64_t offset = indexer.get(i);
+        if constexpr (is_plain_copy) {
+          if (i + prefetch_distance < n) {
+            prefetch_read(
+                src + strides[1] * (i + prefetch_distance) +
+                indexer.peek(i + prefetch_distance));
+          }
+        }
         f(dst + strides[0] * i, src + strides[1] * i, offset);
       }
     }
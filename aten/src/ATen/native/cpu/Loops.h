@@ -227,6 +227,73 @@ vectorized_loop(char** C10_RESTRICT data_, int64_t n, int64_t S, func_t&& op, ve
 }
 
 
+// True when every argument of the kernel has the same scalar type as the
+// result, which the strided gather buffers below assume.
+template <typename traits, std::size_t... INDEX>
+constexpr bool same_arg_types_impl(std::index_sequence<INDEX...>) {
+  return (std::is_same<typename traits::result_type,
+                       typename traits::template arg<INDEX>::type>::value && ...);
+}
+
+template <typename traits>
+constexpr bool same_arg_types() {
+  return same_arg_types_impl<traits>(std::make_index_sequence<traits::arity>{});
+}
+
+// Strided-gather vectorization tier. The 1d slices handed to the loop always
+// have constant strides, so a non-contiguous slice can still run the explicit
+// vector kernel: each block of input is gathered into a contiguous stack
+// buffer (a constant-stride copy the compiler can turn into gather or
+// strided-shuffle sequences), `vop` runs at full SIMD width, and the result
+// is scattered back through the output stride. Tensors whose inner stride
+// happens to be contiguous bypass their buffer entirely. This mostly matters
+// for math-heavy ops: a transposed exp spends its time in the exp itself,
+// not in the gather, while basic_loop would scalarize the exp as well.
+template <typename func_t, typename vec_func_t>
+inline void
+strided_loop(char** C10_RESTRICT data_, const int64_t* strides, int64_t n, func_t&& op, vec_func_t&& vop) {
+  using traits = function_traits<vec_func_t>;
+  using scalar_t = typename function_traits<func_t>::result_type;
+  using Vec = Vectorized<scalar_t>;
+  constexpr int ntensors = traits::arity + 1;
+  // Big enough to amortize the block setup, small enough that the buffers
+  // stay in L1 alongside the strided cache lines they were gathered from.
+  constexpr int64_t kBlockSize = 4 * Vec::size();
+
+  char* C10_RESTRICT data[ntensors];
+  for (const auto arg : c10::irange(ntensors)) {
+    data[arg] = data_[arg];
+  }
+
+  alignas(64) scalar_t buffer[ntensors][kBlockSize];
+  char* block[ntensors];
+
+  for (int64_t i = 0; i < n; i += kBlockSize) {
+    const int64_t m = std::min(kBlockSize, n - i);
+    for (const auto arg : c10::irange(1, ntensors)) {
+      char* base = data[arg] + i * strides[arg];
+      if (strides[arg] == static_cast<int64_t>(sizeof(scalar_t))) {
+        block[arg] = base;
+      } else {
+        for (const auto j : c10::irange(m)) {
+          buffer[arg][j] = c10::load<scalar_t>(base + j * strides[arg]);
+        }
+        block[arg] = reinterpret_cast<char*>(buffer[arg]);
+      }
+    }
+    char* out_base = data[0] + i * strides[0];
+    const bool direct_output =
+        strides[0] == static_cast<int64_t>(sizeof(scalar_t));
+    block[0] = direct_output ? out_base : reinterpret_cast<char*>(buffer[0]);
+    vectorized_loop(block, m, 0, op, vop);
+    if (!direct_output) {
+      for (const auto j : c10::irange(m)) {
+        *reinterpret_cast<scalar_t*>(out_base + j * strides[0]) = buffer[0][j];
+      }
+    }
+  }
+}
+
 template <typename traits, typename cb_t>
 inline void unroll_contiguous_scalar_checks(
     const int64_t* /*strides*/,
@@ -285,6 +352,16 @@ struct VectorizedLoop2d {
           }
         } else {
           for (const auto i C10_UNUSED : c10::irange(size1)) {
+            if constexpr (same_arg_types<traits>()) {
+              // Rows long enough to amortize the gather keep SIMD width
+              // through the strided tier; short rows stay on basic_loop.
+              using scalar_t = typename traits::result_type;
+              if (size0 >= 2 * Vectorized<scalar_t>::size()) {
+                strided_loop(data.data(), strides, size0, op, vop);
+                advance(data, outer_strides);
+                continue;
+              }
+            }
             basic_loop(data.data(), strides, 0, size0, op);
             advance(data, outer_strides);
           }
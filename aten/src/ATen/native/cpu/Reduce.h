@@ -91,29 +91,63 @@ inline void vectorized_inner_reduction(char** data, int64_t n, func_t op, vec_fu
   basic_loop(ptrs, strides, count * 4 * Vec::size(), n, op);
 }
 
+// computes the reduction out = op(out, in) over a single vector of columns
+template <typename func_t, typename vec_func_t>
+inline void vectorized_reduction_single(char** data, int64_t n, int64_t stride, vec_func_t vop) {
+  VEC_LOOP_HEADER(func_t, data)
+  const char* in1_ptr = data[1];
+  Vec acc = Vec::loadu(in1_ptr);
+  for (const auto i : c10::irange(1, n)) {
+    acc = vop(acc, Vec::loadu(in1_ptr + stride * i));
+  }
+  acc = vop(acc, Vec::loadu(out_ptr));
+  acc.store(out_ptr);
+}
+
 // computes the reduction out = op(out, in)
 template <typename func_t, typename vec_func_t>
 inline void vectorized_outer_reduction(char** data, int64_t inner_stride, int64_t size0, int64_t size1, func_t op, vec_func_t vop) {
   VEC_LOOP_HEADER(func_t, data)
 
-  // reduce down each column of 4 * Vec::size() elements (128 or 256 bytes)
-#if defined(CPU_CAPABILITY_AVX512)
-  int64_t outer_stride[2] = { 256, 256 };
-#else
-  int64_t outer_stride[2] = { 128, 128 };
-#endif
-  UNARY_OUTER_LOOP(data, outer_stride, size1 / (4 * Vec::size()), [&] {
-    vectorized_reduction(data, size0, inner_stride, op, vop, /*reduce=*/false);
-  });
+  // Walk the rows in L1-sized tiles. Each column pass below only touches a
+  // slice of every row, so without tiling each pass streams the full input
+  // from memory again; within a tile the later, narrower passes hit lines
+  // the wide pass just brought in. 16KB of input leaves L1 room for the
+  // output row and stack.
+  constexpr int64_t kTileBytes = 16 * 1024;
+  const int64_t bytes_per_row =
+      std::max(inner_stride, static_cast<int64_t>(sizeof(scalar_t)));
+  const int64_t tile_rows = std::max<int64_t>(1, kTileBytes / bytes_per_row);
 
-  // reduce down the remaining columns
-  int64_t step[] = { sizeof(scalar_t), sizeof(scalar_t) };
-  int64_t remaining = size1 % (4 * Vec::size());
-  UNARY_OUTER_LOOP(data, step, remaining, [&] {
-    char* ptrs[3] = { data[0], data[0], data[1] };
-    int64_t strides[] = { 0, 0, inner_stride };
-    basic_loop(ptrs, strides, 0, size0, op);
-  });
+  const int64_t wide_width = 4 * Vec::size();
+  for (int64_t row = 0; row < size0; row += tile_rows) {
+    const int64_t rows = std::min(tile_rows, size0 - row);
+    char* tile[2] = {data[0], data[1] + row * inner_stride};
+
+    // reduce down each column of 4 * Vec::size() elements (128 or 256 bytes)
+    int64_t wide_stride[2] = {
+        static_cast<int64_t>(wide_width * sizeof(scalar_t)),
+        static_cast<int64_t>(wide_width * sizeof(scalar_t))};
+    UNARY_OUTER_LOOP(tile, wide_stride, size1 / wide_width, [&] {
+      vectorized_reduction(tile, rows, inner_stride, op, vop, /*reduce=*/false);
+    });
+
+    // reduce down the remaining columns one vector at a time
+    int64_t vec_stride[2] = {
+        static_cast<int64_t>(Vec::size() * sizeof(scalar_t)),
+        static_cast<int64_t>(Vec::size() * sizeof(scalar_t))};
+    UNARY_OUTER_LOOP(tile, vec_stride, (size1 % wide_width) / Vec::size(), [&] {
+      vectorized_reduction_single<func_t>(tile, rows, inner_stride, vop);
+    });
+
+    // reduce down the tail columns
+    int64_t step[] = { sizeof(scalar_t), sizeof(scalar_t) };
+    UNARY_OUTER_LOOP(tile, step, size1 % Vec::size(), [&] {
+      char* ptrs[3] = {tile[0], tile[0], tile[1]};
+      int64_t strides[] = { 0, 0, inner_stride };
+      basic_loop(ptrs, strides, 0, rows, op);
+    });
+  }
 }
 
 template<typename traits, typename res_t>
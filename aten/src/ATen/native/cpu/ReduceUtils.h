@@ -38,6 +38,8 @@ using namespace vec;
         static constexpr auto reduce = ReductionType::PROD;                    \
         return __VA_ARGS__();                                                  \
       }                                                                        \
+      default:                                                                 \
+        TORCH_INTERNAL_ASSERT(false, "Unsupported reduction type");            \
     }                                                                          \
   }()
 
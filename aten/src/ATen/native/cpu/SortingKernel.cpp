@@ -1,5 +1,6 @@
 #define TORCH_ASSERT_NO_OPERATORS
 
+#include <cstring>
 #include <limits>
 
 #include <ATen/native/Sorting.h>
@@ -92,13 +93,19 @@ struct KeyValueCompDesc {
 };
 
 #ifdef USE_FBGEMM
-static bool can_use_radix_sort(const TensorBase& values, const bool descending) {
+static bool can_use_radix_sort(const TensorBase& values, const bool descending, const bool stable) {
   // radix_sort can be used only for 1D data
   if (values.dim() != 1) return false;
   // radix_sort sorts in ascending order
   if (descending) return false;
-  // radix_sort works for integer values
-  if (!at::isIntegralType(values.scalar_type(), /*includeBool=*/false)) return false;
+  // radix_sort works for integer values; float32 is handled through an
+  // order-preserving bit transform (see parallel_sort1d_float_kernel)
+  const auto dtype = values.scalar_type();
+  if (!at::isIntegralType(dtype, /*includeBool=*/false) && dtype != ScalarType::Float) return false;
+  // The float transform orders -0.0 before 0.0 and NaNs by payload, both of
+  // which compare as equal in the comparison path, so it cannot honor a
+  // stable-sort request.
+  if (dtype == ScalarType::Float && stable) return false;
   // performance improvements are visible for bigger tensor sizes, when radix_sort
   // is accelerated with OpenMP
   if (values.numel() < at::internal::GRAIN_SIZE || !fbgemm::is_radix_sort_accelerated_with_openmp()) return false;
@@ -139,6 +146,59 @@ static void parallel_sort1d_kernel(
     }
   });
 }
+
+static void parallel_sort1d_float_kernel(
+    const TensorBase& values,
+    const TensorBase& indices) {
+  const auto elements = values.numel();
+  auto* const keys = values.data_ptr<float>();
+  auto* const vals = indices.data_ptr<int64_t>();
+  // Order-preserving transform into int32 keys: flipping the non-sign bits of
+  // negatives makes signed integer order match float order; NaNs map to
+  // INT32_MAX so they land at the end just like the comparison path. The
+  // original keys are kept aside so the output values can be gathered back
+  // with their exact bit patterns (the NaN mapping is lossy).
+  std::vector<float> orig_keys(elements);
+  std::vector<int32_t> xform_keys(elements);
+  std::vector<int32_t> tmp_keys(elements);
+  std::vector<int64_t> tmp_vals(elements);
+  at::parallel_for(0, elements, at::internal::GRAIN_SIZE, [&](int64_t begin, int64_t end) {
+    for (const auto i : c10::irange(begin, end)) {
+      const float key = keys[i];
+      orig_keys[i] = key;
+      if (_isnan<float>(key)) {
+        xform_keys[i] = std::numeric_limits<int32_t>::max();
+      } else {
+        int32_t bits = 0;
+        std::memcpy(&bits, &key, sizeof(bits));
+        xform_keys[i] = bits ^ ((bits >> 31) & 0x7fffffff);
+      }
+    }
+  });
+  const int32_t* sorted_keys = nullptr;
+  const int64_t* sorted_vals = nullptr;
+  std::tie(sorted_keys, sorted_vals) = fbgemm::radix_sort_parallel(
+      xform_keys.data(),
+      vals,
+      tmp_keys.data(),
+      tmp_vals.data(),
+      elements,
+      std::numeric_limits<int32_t>::max(),
+      /*maybe_with_neg_vals=*/true);
+  (void)sorted_keys;
+  at::parallel_for(0, elements, at::internal::GRAIN_SIZE, [&](int64_t begin, int64_t end) {
+    for (const auto i : c10::irange(begin, end)) {
+      keys[i] = orig_keys[sorted_vals[i]];
+    }
+  });
+  if (sorted_vals != vals) {
+    const auto num_threads = at::get_num_threads();
+    at::parallel_for(0, elements, elements / num_threads, [&](int64_t begin, int64_t end) {
+      const auto job_size = end - begin;
+      vec::map([](vec::Vectorized<int64_t> x) -> vec::Vectorized<int64_t> { return x; }, vals + begin, sorted_vals + begin, job_size);
+    });
+  }
+}
 #endif
 
 static void sort_kernel(
@@ -156,8 +216,12 @@ static void sort_kernel(
     return;
   }
 #ifdef USE_FBGEMM
-  if (can_use_radix_sort(values, descending)) {
-    parallel_sort1d_kernel(values, indices);
+  if (can_use_radix_sort(values, descending, stable)) {
+    if (values.scalar_type() == ScalarType::Float) {
+      parallel_sort1d_float_kernel(values, indices);
+    } else {
+      parallel_sort1d_kernel(values, indices);
+    }
     return;
   }
 #endif
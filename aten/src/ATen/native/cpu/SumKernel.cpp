@@ -1,6 +1,8 @@
 #define TORCH_ASSERT_NO_OPERATORS
 #include <ATen/AccumulateType.h>
+#include <ATen/Context.h>
 #include <ATen/Dispatch.h>
+#include <ATen/Parallel.h>
 #include <ATen/native/ReduceOps.h>
 #include <ATen/native/TensorIterator.h>
 #include <ATen/native/cpu/Reduce.h>
@@ -8,6 +10,7 @@
 #include <c10/util/irange.h>
 #include <ATen/cpu/vec/functional.h>
 #include <algorithm>
+#include <vector>
 
 namespace at::native {
 namespace {
@@ -537,10 +540,64 @@ void scalar_outer_sum(
   }
 }
 
+/** Thread-count-invariant sum for reductions to a single element
+
+The regular path merges per-thread partial sums whose boundaries depend on
+the number of threads, so results differ between machines. Here the
+reduction is instead split into fixed-size leaf chunks along the iteration
+order; each chunk is summed independently (on whatever thread picks it up)
+and the chunk partials are then merged with the same cascade in index
+order. The partition depends only on the input size, so the result is
+bitwise identical for any thread count, at the cost of one extra pass over
+the (small) partials buffer and coarser load balancing.
+*/
+template <bool ignore_nan, typename scalar_t>
+void cascade_sum_deterministic(TensorIterator &iter) {
+  using acc_t = at::acc_type<scalar_t, true>;
+  using ScalarLoadPolicy = std::conditional_t<
+      ignore_nan,
+      NanSumCastLoadPolicy<scalar_t, acc_t>,
+      CastLoadPolicy<scalar_t, acc_t>>;
+  constexpr int64_t chunk_size = 65536;
+
+  const int64_t numel = iter.numel();
+  const int64_t n_chunks = divup(numel, chunk_size);
+  std::vector<acc_t> partials(n_chunks, acc_t(0));
+  at::parallel_for(0, n_chunks, 1, [&](int64_t begin, int64_t end) {
+    for (const auto c : c10::irange(begin, end)) {
+      acc_t chunk_acc = acc_t(0);
+      auto loop = [&](char** data, const int64_t* strides, int64_t size0,
+                      int64_t size1) {
+        for (const auto j : c10::irange(size1)) {
+          const char* row_in = data[1] + j * strides[3];
+          chunk_acc += row_sum<acc_t, ScalarLoadPolicy>(
+              row_in, strides[1], size0);
+        }
+      };
+      iter.serial_for_each(
+          loop, {c * chunk_size, std::min(numel, (c + 1) * chunk_size)});
+      partials[c] = chunk_acc;
+    }
+  });
+
+  auto result = row_sum<acc_t, LoadPolicy<acc_t>>(
+      reinterpret_cast<const char*>(partials.data()), sizeof(acc_t), n_chunks);
+  iter.output_base().fill_(scalar_t(result));
+}
+
 // Custom floating point sum for better accuracy
 template <bool ignore_nan, typename scalar_t>
 void cascade_sum(TensorIterator &iter) {
   iter.output_base().fill_(scalar_t(0));
+  // Reductions with several output elements parallelize over independent
+  // outputs and are already thread-count-invariant; the single-output case
+  // merges per-thread partials, so use the fixed chunk tree instead when
+  // deterministic algorithms are requested.
+  if (at::globalContext().deterministicAlgorithms() &&
+      iter.num_output_elements() == 1 && iter.numel() > 0) {
+    cascade_sum_deterministic<ignore_nan, scalar_t>(iter);
+    return;
+  }
   iter.parallel_reduce(
     [&](char** data, const int64_t* strides, int64_t size0, int64_t size1) {
       // NOLINTNEXTLINE(modernize-avoid-c-arrays,cppcoreguidelines-avoid-c-arrays)
@@ -10,6 +10,10 @@
 #include <c10/util/irange.h>
 #include <ATen/native/cpu/UpSampleKernelAVXAntialias.h>
 
+#include <algorithm>
+#include <cstring>
+#include <typeinfo>
+
 #ifndef AT_PER_OPERATOR_HEADERS
 #include <ATen/Functions.h>
 #else
@@ -1423,6 +1427,43 @@ struct HelperInterpCubic : public HelperInterpBase {
 // Internally, it uses TensorIterator to optimize the computations.
 // - out_ndims is the number of interpolated dims: 1, 2, 3
 // - scale_type is template type for scales, typically std::optional<double>
+// An interpolation plan is the set of per-dimension index/weight tensors fed
+// to the TensorIterator in upsample_generic_Nd_kernel_impl. It depends only
+// on the resize geometry (sizes, strides, dtype, mode, align_corners,
+// explicit scales), not on the tensor contents, but building the tables can
+// dominate small-image resizes. Pipelines that repeatedly upsample identical
+// shapes (e.g. per-frame video processing) hit the same geometry thousands of
+// times, so we keep a small per-thread MRU cache of recently used plans. The
+// cached tensors are only ever read once built.
+struct InterpPlanCache {
+  using Key = std::vector<int64_t>;
+  using Plan = std::vector<std::vector<Tensor>>;
+  static constexpr size_t kCapacity = 8;
+
+  Plan* find(const Key& key) {
+    for (const auto i : c10::irange(entries_.size())) {
+      if (entries_[i].first == key) {
+        if (i != 0) {
+          std::rotate(
+              entries_.begin(), entries_.begin() + i, entries_.begin() + i + 1);
+        }
+        return &entries_.front().second;
+      }
+    }
+    return nullptr;
+  }
+
+  Plan& insert(Key key, Plan plan) {
+    if (entries_.size() >= kCapacity) {
+      entries_.pop_back();
+    }
+    entries_.emplace(entries_.begin(), std::move(key), std::move(plan));
+    return entries_.front().second;
+  }
+
+  std::vector<std::pair<Key, Plan>> entries_;
+};
+
 // - template<typename> class F is one of the above structs to compute indices and weights
 template <int out_ndims, typename scale_type, class F>
 void upsample_generic_Nd_kernel_impl(
@@ -1448,9 +1489,6 @@ void upsample_generic_Nd_kernel_impl(
   }
   auto restrided_input = input.as_strided(shape, strides);
 
-  // NOLINTNEXTLINE(cppcoreguidelines-init-variables)
-  std::vector<std::vector<Tensor>> indices_weights;
-
   constexpr int interp_size = F::interp_size;
   auto input_scalar_type = input.scalar_type();
   if ((interp_size == 1 && input_scalar_type == at::ScalarType::Byte)) {
@@ -1459,15 +1497,41 @@ void upsample_generic_Nd_kernel_impl(
     input_scalar_type = at::ScalarType::Float;
   }
 
+  thread_local InterpPlanCache plan_cache;
+  InterpPlanCache::Key cache_key;
+  cache_key.reserve(4 + 5 * out_ndims);
+  cache_key.push_back(static_cast<int64_t>(typeid(F).hash_code()));
+  cache_key.push_back(out_ndims);
+  cache_key.push_back(static_cast<int64_t>(input_scalar_type));
+  cache_key.push_back(align_corners);
   for (const auto i : c10::irange(out_ndims)) {
-    // NOLINTNEXTLINE(performance-inefficient-vector-operation)
-    indices_weights.emplace_back(
-      F::compute_indices_weights(
-        input_scalar_type, input.size(i + 2), oshape[i + 2],
-        input.stride(i + 2) * input.element_size(),
-        input.dim(), i + 2, align_corners, scales[i]
-      )
-    );
+    cache_key.push_back(input.size(i + 2));
+    cache_key.push_back(oshape[i + 2]);
+    cache_key.push_back(input.stride(i + 2) * input.element_size());
+    int64_t scale_bits = -1;
+    if (scales[i].has_value()) {
+      const double scale = *scales[i];
+      std::memcpy(&scale_bits, &scale, sizeof(scale_bits));
+    }
+    cache_key.push_back(scales[i].has_value());
+    cache_key.push_back(scale_bits);
+  }
+
+  InterpPlanCache::Plan* indices_weights = plan_cache.find(cache_key);
+  if (indices_weights == nullptr) {
+    InterpPlanCache::Plan plan;
+    for (const auto i : c10::irange(out_ndims)) {
+      // NOLINTNEXTLINE(performance-inefficient-vector-operation)
+      plan.emplace_back(
+        F::compute_indices_weights(
+          input_scalar_type, input.size(i + 2), oshape[i + 2],
+          input.stride(i + 2) * input.element_size(),
+          input.dim(), i + 2, align_corners, scales[i]
+        )
+      );
+    }
+    indices_weights =
+        &plan_cache.insert(std::move(cache_key), std::move(plan));
   }
 
   TensorIteratorConfig config;
@@ -1476,7 +1540,7 @@ void upsample_generic_Nd_kernel_impl(
     .add_output(output)
     .add_const_input(restrided_input);
 
-  for (auto & idx_weight: indices_weights) {
+  for (auto & idx_weight: *indices_weights) {
     for (auto& tensor : idx_weight) {
       config.add_const_input(tensor);
     }
@@ -42,18 +42,60 @@ inline __m128i conver_int4_to_int8(const uint8_t* data) {
 
 #if defined(CPU_CAPABILITY_AVX512) && !defined(_MSC_VER)
 
+// Load 32 x T as two fp32 vectors.
+inline void load_as_fp32x2(const BFloat16* ptr, __m512& v0, __m512& v1) {
+  __m512i t = _mm512_loadu_si512((__m512i*)ptr);
+  vec::cvtbf16_fp32(t, v0, v1);
+}
+
+inline void load_as_fp32x2(const Half* ptr, __m512& v0, __m512& v1) {
+  __m512i t = _mm512_loadu_si512((__m512i*)ptr);
+  vec::cvtfp16_fp32(t, v0, v1);
+}
+
+inline void load_as_fp32x2(const float* ptr, __m512& v0, __m512& v1) {
+  v0 = _mm512_loadu_ps(ptr);
+  v1 = _mm512_loadu_ps(ptr + 16);
+}
+
+// Store one/two fp32 vectors as 16/32 x T.
+inline void store_from_fp32(BFloat16* ptr, __m512 v) {
+  _mm256_storeu_si256((__m256i*)ptr, vec::cvtfp32_bf16(v));
+}
+
+inline void store_from_fp32(Half* ptr, __m512 v) {
+  _mm256_storeu_si256((__m256i*)ptr, vec::cvtfp32_fp16(v));
+}
+
+inline void store_from_fp32(float* ptr, __m512 v) {
+  _mm512_storeu_ps(ptr, v);
+}
+
+inline void store_from_fp32x2(BFloat16* ptr, __m512 v0, __m512 v1) {
+  _mm512_storeu_si512((__m512i*)ptr, vec::cvtfp32_bf16(v0, v1));
+}
+
+inline void store_from_fp32x2(Half* ptr, __m512 v0, __m512 v1) {
+  _mm512_storeu_si512((__m512i*)ptr, vec::cvtfp32_fp16(v0, v1));
+}
+
+inline void store_from_fp32x2(float* ptr, __m512 v0, __m512 v1) {
+  _mm512_storeu_ps(ptr, v0);
+  _mm512_storeu_ps(ptr + 16, v1);
+}
+
 // A block : {BLOCK_M, BLOCK_K}, lda = K
 // B block : {BLOCK_K, BLOCK_N / 2}, ldb = BLOCK_N / 2
 // C block : {BLOCK_M, BLOCK_N}, ldc = N
 //
 // ScaleAndZeros block : {1, BLOCK_N, 2}
 //
-template <int BLOCK_M, int BLOCK_N>
-inline void tinygemm_kernel(
-    const BFloat16* RESTRICT A,
+template <int BLOCK_M, int BLOCK_N, typename T>
+inline void tinygemm_kernel_(
+    const T* RESTRICT A,
     const uint8_t* RESTRICT B,
-    const BFloat16* RESTRICT ScaleAndZeros,
-    BFloat16* RESTRICT C,
+    const T* RESTRICT ScaleAndZeros,
+    T* RESTRICT C,
     int lda,
     int ldb,
     int ldc,
@@ -75,10 +117,10 @@ inline void tinygemm_kernel(
   __m512 scale[COLS];
   __m512 zero[COLS];
 
-  // Lookup table to de-quantize int4 values to bf16.
+  // Lookup table to de-quantize int4 values to fp32.
   // Values are dequantized as truly int4 [-8, 7] range;
   //
-  // dequant = (bf16(int4_value) * bf16_scale) + bf16_zero
+  // dequant = (fp32(int4_value) * scale) + zero
   //
   static const __m512 lut = _mm512_set_ps(
       7.0f, 6.0f, 5.0f, 4.0f,
@@ -96,16 +138,13 @@ inline void tinygemm_kernel(
 
   // load scale and zero point
   auto load_scale_and_zeros = [&](int i, int _kb) {
-    // load 2x bfloat16 vector
-    __m512i t = _mm512_loadu_si512((__m512i*)(ScaleAndZeros + _kb * ldc * 2 + 32 * i));
+    // load 32 values and convert to 2x f32 vector
+    __m512 a, b;
+    load_as_fp32x2(ScaleAndZeros + _kb * ldc * 2 + 32 * i, a, b);
     if (_kb + PREFETCH_SIZE_KB < KB) {
       _mm_prefetch(ScaleAndZeros + (_kb + PREFETCH_SIZE_KB) * ldc * 2 + 32 * i, _MM_HINT_T0);
     }
 
-    // convert to 2x f32 vector
-    __m512 a, b;
-    vec::cvtbf16_fp32(t, a, b);
-
     // transpose scale_and_zero from {16, 2} to {2, 16}
     // inputs:
     //   a: {s0, z0, s1, z1, ..., s7, z7}
@@ -181,23 +220,18 @@ inline void tinygemm_kernel(
     constexpr int col = i % COLS;
     if constexpr (COLS == 4) {
       // when BLOCK_N = 64, handle each row at a time
-      // to reduce `cvtfp32_bf16` overhead.
+      // to reduce narrowing-convert overhead.
       if constexpr (col == 0) {
-        __m512i c01 = vec::cvtfp32_bf16(vc[row * 4 + 0], vc[row * 4 + 1]);
-        __m512i c23 = vec::cvtfp32_bf16(vc[row * 4 + 2], vc[row * 4 + 3]);
-        _mm512_storeu_si512((__m512i*)(C + row * ldc + 0 * 32), c01);
-        _mm512_storeu_si512((__m512i*)(C + row * ldc + 1 * 32), c23);
+        store_from_fp32x2(C + row * ldc + 0 * 32, vc[row * 4 + 0], vc[row * 4 + 1]);
+        store_from_fp32x2(C + row * ldc + 1 * 32, vc[row * 4 + 2], vc[row * 4 + 3]);
       }
     } else {
-      __m256i ci = vec::cvtfp32_bf16(vc[i]);
-      _mm256_storeu_si256((__m256i*)(C + row * ldc + col * 16), ci);
+      store_from_fp32(C + row * ldc + col * 16, vc[i]);
     }
   };
   c10::ForcedUnroll<ROWS * COLS>{}(storec);
 }
 
-#elif defined(CPU_CAPABILITY_AVX2) && !defined(_MSC_VER)
-
 template <int BLOCK_M, int BLOCK_N>
 inline void tinygemm_kernel(
     const BFloat16* RESTRICT A,
@@ -209,6 +243,80 @@ inline void tinygemm_kernel(
     int ldc,
     int K,
     int BLOCK_K) {
+  tinygemm_kernel_<BLOCK_M, BLOCK_N>(A, B, ScaleAndZeros, C, lda, ldb, ldc, K, BLOCK_K);
+}
+
+template <int BLOCK_M, int BLOCK_N>
+inline void tinygemm_kernel(
+    const Half* RESTRICT A,
+    const uint8_t* RESTRICT B,
+    const Half* RESTRICT ScaleAndZeros,
+    Half* RESTRICT C,
+    int lda,
+    int ldb,
+    int ldc,
+    int K,
+    int BLOCK_K) {
+  tinygemm_kernel_<BLOCK_M, BLOCK_N>(A, B, ScaleAndZeros, C, lda, ldb, ldc, K, BLOCK_K);
+}
+
+template <int BLOCK_M, int BLOCK_N>
+inline void tinygemm_kernel(
+    const float* RESTRICT A,
+    const uint8_t* RESTRICT B,
+    const float* RESTRICT ScaleAndZeros,
+    float* RESTRICT C,
+    int lda,
+    int ldb,
+    int ldc,
+    int K,
+    int BLOCK_K) {
+  tinygemm_kernel_<BLOCK_M, BLOCK_N>(A, B, ScaleAndZeros, C, lda, ldb, ldc, K, BLOCK_K);
+}
+
+#elif defined(CPU_CAPABILITY_AVX2) && !defined(_MSC_VER)
+
+// Load 16 x T as two fp32 vectors.
+inline void load_as_fp32x2(const BFloat16* ptr, __m256& v0, __m256& v1) {
+  __m256i t = _mm256_loadu_si256((__m256i*)ptr);
+  vec::cvtbf16_fp32(t, v0, v1);
+}
+
+inline void load_as_fp32x2(const Half* ptr, __m256& v0, __m256& v1) {
+  __m256i t = _mm256_loadu_si256((__m256i*)ptr);
+  vec::cvtfp16_fp32(t, v0, v1);
+}
+
+inline void load_as_fp32x2(const float* ptr, __m256& v0, __m256& v1) {
+  v0 = _mm256_loadu_ps(ptr);
+  v1 = _mm256_loadu_ps(ptr + 8);
+}
+
+// Store two fp32 vectors as 16 x T.
+inline void store_from_fp32x2(BFloat16* ptr, __m256 v0, __m256 v1) {
+  _mm256_storeu_si256((__m256i*)ptr, vec::cvtfp32_bf16(v0, v1));
+}
+
+inline void store_from_fp32x2(Half* ptr, __m256 v0, __m256 v1) {
+  _mm256_storeu_si256((__m256i*)ptr, vec::cvtfp32_fp16(v0, v1));
+}
+
+inline void store_from_fp32x2(float* ptr, __m256 v0, __m256 v1) {
+  _mm256_storeu_ps(ptr, v0);
+  _mm256_storeu_ps(ptr + 8, v1);
+}
+
+template <int BLOCK_M, int BLOCK_N, typename T>
+inline void tinygemm_kernel_(
+    const T* RESTRICT A,
+    const uint8_t* RESTRICT B,
+    const T* RESTRICT ScaleAndZeros,
+    T* RESTRICT C,
+    int lda,
+    int ldb,
+    int ldc,
+    int K,
+    int BLOCK_K) {
 
   constexpr int ROWS = BLOCK_M;
   constexpr int COLS = BLOCK_N / 8;
@@ -232,16 +340,13 @@ inline void tinygemm_kernel(
 
   // load scale and zero point
   auto load_scale_and_zeros = [&](int i, int _kb) {
-    // load 2x bfloat16 vector
-    __m256i t = _mm256_loadu_si256((__m256i*)(ScaleAndZeros + _kb * ldc * 2 + 16 * i));
+    // load 16 values and convert to 2x f32 vector
+    __m256 a, b;
+    load_as_fp32x2(ScaleAndZeros + _kb * ldc * 2 + 16 * i, a, b);
     if (_kb + PREFETCH_SIZE_KB < KB) {
       _mm_prefetch(ScaleAndZeros + (_kb + PREFETCH_SIZE_KB) * ldc * 2 + 16 * i, _MM_HINT_T0);
     }
 
-    // convert to 2x f32 vector
-    __m256 a, b;
-    vec::cvtbf16_fp32(t, a, b);
-
     // transpose scale_and_zero from {8, 2} to {2, 8}
     // inputs:
     //   a: {s0, z0, s1, z1, s2, z2, s3, z3}
@@ -330,13 +435,55 @@ inline void tinygemm_kernel(
     constexpr int row = i / COLS;
     constexpr int col = i % COLS;
     if constexpr (col % 2 == 0) {
-      __m256i ci = vec::cvtfp32_bf16(vc[row * COLS + col], vc[row * COLS + col + 1]);
-      _mm256_storeu_si256((__m256i*)(C + row * ldc + col * 8), ci);
+      store_from_fp32x2(
+          C + row * ldc + col * 8, vc[row * COLS + col], vc[row * COLS + col + 1]);
     }
   };
   c10::ForcedUnroll<ROWS * COLS>{}(storec);
 }
 
+template <int BLOCK_M, int BLOCK_N>
+inline void tinygemm_kernel(
+    const BFloat16* RESTRICT A,
+    const uint8_t* RESTRICT B,
+    const BFloat16* RESTRICT ScaleAndZeros,
+    BFloat16* RESTRICT C,
+    int lda,
+    int ldb,
+    int ldc,
+    int K,
+    int BLOCK_K) {
+  tinygemm_kernel_<BLOCK_M, BLOCK_N>(A, B, ScaleAndZeros, C, lda, ldb, ldc, K, BLOCK_K);
+}
+
+template <int BLOCK_M, int BLOCK_N>
+inline void tinygemm_kernel(
+    const Half* RESTRICT A,
+    const uint8_t* RESTRICT B,
+    const Half* RESTRICT ScaleAndZeros,
+    Half* RESTRICT C,
+    int lda,
+    int ldb,
+    int ldc,
+    int K,
+    int BLOCK_K) {
+  tinygemm_kernel_<BLOCK_M, BLOCK_N>(A, B, ScaleAndZeros, C, lda, ldb, ldc, K, BLOCK_K);
+}
+
+template <int BLOCK_M, int BLOCK_N>
+inline void tinygemm_kernel(
+    const float* RESTRICT A,
+    const uint8_t* RESTRICT B,
+    const float* RESTRICT ScaleAndZeros,
+    float* RESTRICT C,
+    int lda,
+    int ldb,
+    int ldc,
+    int K,
+    int BLOCK_K) {
+  tinygemm_kernel_<BLOCK_M, BLOCK_N>(A, B, ScaleAndZeros, C, lda, ldb, ldc, K, BLOCK_K);
+}
+
 #endif
 
 #if !defined(C10_MOBILE) && defined(__aarch64__)
@@ -607,9 +607,219 @@ void LayerNormBackwardKernelImpl(
   }
 }
 
+template <typename T>
+void RmsNormKernelImplInternal(
+    const Tensor& X,
+    const Tensor& gamma,
+    int64_t M,
+    int64_t N,
+    double eps,
+    Tensor* Y,
+    Tensor* rstd) {
+  using opmath_t = at::opmath_type<T>;
+  using Vec = vec::Vectorized<opmath_t>;
+  TORCH_DCHECK_EQ(X.numel(), M * N);
+  DCHECK(!gamma.defined() || gamma.numel() == N);
+  const T* X_data = X.const_data_ptr<T>();
+  const T* gamma_data = gamma.defined() ? gamma.const_data_ptr<T>() : nullptr;
+  T* Y_data = Y->data_ptr<T>();
+  T* rstd_data = rstd->data_ptr<T>();
+  const bool gamma_null = gamma_data == nullptr;
+  at::parallel_for(0, M, 1, [&](int64_t start, int64_t end) {
+    for (const auto i : c10::irange(start, end)) {
+      const T* X_ptr = X_data + i * N;
+      T* Y_ptr = Y_data + i * N;
+      const opmath_t sum_sq = vec::map_reduce_all<T>(
+          [](Vec x) { return x * x; },
+          [](Vec x, Vec y) { return x + y; },
+          X_ptr,
+          N);
+      const opmath_t rstd_val = opmath_t(1) /
+          std::sqrt(
+              sum_sq / static_cast<opmath_t>(N) + static_cast<opmath_t>(eps));
+      if (gamma_null) {
+        vec::map<T>(
+            [rstd_val](Vec x) { return x * Vec(rstd_val); }, Y_ptr, X_ptr, N);
+      } else {
+        vec::map2<T>(
+            [rstd_val](Vec x, Vec gamma) { return x * Vec(rstd_val) * gamma; },
+            Y_ptr,
+            X_ptr,
+            gamma_data,
+            N);
+      }
+      rstd_data[i] = rstd_val;
+    }
+  });
+}
+
+void RmsNormKernelImpl(
+    const Tensor& X,
+    const Tensor& gamma,
+    int64_t M,
+    int64_t N,
+    double eps,
+    Tensor* Y,
+    Tensor* rstd) {
+  AT_DISPATCH_FLOATING_TYPES_AND2(kBFloat16, kHalf, X.scalar_type(),
+      "RmsNormKernelImpl", [&]() {
+    RmsNormKernelImplInternal<scalar_t>(X, gamma, M, N, eps, Y, rstd);
+  });
+}
+
+template <typename T>
+void RmsNormBackwardKernelImplInternal(
+    const Tensor& dY,
+    const Tensor& X,
+    const Tensor& rstd,
+    const Tensor& gamma,
+    int64_t M,
+    int64_t N,
+    Tensor* dX,
+    Tensor* dgamma) {
+  using opmath_t = at::opmath_type<T>;
+  using Vec = vec::Vectorized<opmath_t>;
+  TORCH_DCHECK_EQ(dY.numel(), M * N);
+  TORCH_DCHECK_EQ(X.numel(), M * N);
+  TORCH_DCHECK_EQ(rstd.numel(), M);
+  DCHECK(!gamma.defined() || gamma.numel() == N);
+  const T* dY_data = dY.template const_data_ptr<T>();
+  const T* X_data = X.template const_data_ptr<T>();
+  const T* rstd_data = rstd.template const_data_ptr<T>();
+  const T* gamma_data =
+      gamma.defined() ? gamma.template const_data_ptr<T>() : nullptr;
+  T* dX_data = dX->defined() ? dX->template data_ptr<T>() : nullptr;
+  T* dgamma_data = dgamma->defined() ? dgamma->template data_ptr<T>() : nullptr;
+  const opmath_t scale = opmath_t(1) / static_cast<opmath_t>(N);
+  const bool gamma_null = gamma_data == nullptr;
+  const bool dX_null = dX_data == nullptr;
+  const bool dgamma_null = dgamma_data == nullptr;
+
+  // dgamma is reduced with the same two path strategy as LayerNorm: each
+  // thread accumulates its rows into a private {N} buffer while it computes
+  // dX (reusing dY[i] and X[i] from L1), then the buffers are reduced along
+  // the thread dimension.
+  int num_threads = at::get_num_threads();
+  Tensor buffer = at::empty({0}, X.options());
+  T* buffer_data = nullptr;
+  if (!dgamma_null) {
+    buffer.resize_({num_threads, N}).zero_();
+    buffer_data = buffer.template data_ptr<T>();
+  }
+
+  at::parallel_for(0, M, 1, [&](int64_t start, int64_t end) {
+    int tid = at::get_thread_num();
+    TORCH_CHECK(
+        tid < num_threads,
+        "expect thread id smaller than ",
+        num_threads,
+        ", got thread id ",
+        tid);
+    T* dgamma_buffer_ptr = dgamma_null ? nullptr : buffer_data + tid * N;
+    for (const auto i : c10::irange(start, end)) {
+      const T* dY_ptr = dY_data + i * N;
+      const T* X_ptr = X_data + i * N;
+      const opmath_t a = rstd_data[i];
+      if (!dgamma_null) {
+        // Scalar math:
+        // for (const auto j : c10::irange(N)) {
+        //   dgamma_data[j] += dY_ptr[j] * X_ptr[j] * a;
+        // }
+        vec::map3<T>(
+            [a](Vec dgamma, Vec dy, Vec x) { return dgamma + dy * x * Vec(a); },
+            dgamma_buffer_ptr,
+            dgamma_buffer_ptr,
+            dY_ptr,
+            X_ptr,
+            N);
+      }
+      if (!dX_null) {
+        T* dX_ptr = dX_data + i * N;
+        opmath_t ds = opmath_t(0);
+        // Scalar math:
+        // for (const auto j : c10::irange(N)) {
+        //   const T gamma_v = gamma_null ? T(1) : gamma_data[j];
+        //   ds += dY_ptr[j] * X_ptr[j] * gamma_v;
+        // }
+        if (gamma_null) {
+          ds = vec::map2_reduce_all<T>(
+              [](Vec x, Vec y) { return x * y; },
+              [](Vec x, Vec y) { return x + y; },
+              dY_ptr,
+              X_ptr,
+              N);
+        } else {
+          ds = vec::map3_reduce_all<T>(
+              [](Vec x, Vec y, Vec z) { return x * y * z; },
+              [](Vec x, Vec y) { return x + y; },
+              dY_ptr,
+              X_ptr,
+              gamma_data,
+              N);
+        }
+        const opmath_t b = -ds * a * a * a * scale;
+        // Scalar math:
+        // for (const auto j : c10::irange(N)) {
+        //   const T gamma_v = gamma_null ? T(1) : gamma_data[j];
+        //   dX_ptr[j] = a * dY_ptr[j] * gamma_v + b * X_ptr[j];
+        // }
+        if (gamma_null) {
+          vec::map2<T>(
+              [a, b](Vec dy, Vec x) { return Vec(a) * dy + Vec(b) * x; },
+              dX_ptr,
+              dY_ptr,
+              X_ptr,
+              N);
+        } else {
+          vec::map3<T>(
+              [a, b](Vec dy, Vec gamma, Vec x) {
+                return Vec(a) * dy * gamma + Vec(b) * x;
+              },
+              dX_ptr,
+              dY_ptr,
+              gamma_data,
+              X_ptr,
+              N);
+        }
+      }
+    }
+  });
+
+  if (buffer_data != nullptr) {
+    parallel_for(0, N, 1, [&](int64_t start, int64_t end) {
+      for (const auto j : c10::irange(start, end)) {
+        opmath_t dgamma_v = opmath_t(0);
+        for (const auto i : c10::irange(num_threads)) {
+          dgamma_v += buffer_data[i * N + j];
+        }
+        // NOLINTNEXTLINE(clang-analyzer-core.NullDereference)
+        dgamma_data[j] = dgamma_v;
+      }
+    });
+  }
+}
+
+void RmsNormBackwardKernelImpl(
+    const Tensor& dY,
+    const Tensor& X,
+    const Tensor& rstd,
+    const Tensor& gamma,
+    int64_t M,
+    int64_t N,
+    Tensor* dX,
+    Tensor* dgamma) {
+  AT_DISPATCH_FLOATING_TYPES_AND2(kBFloat16, kHalf, X.scalar_type(),
+      "RmsNormBackwardKernelImpl", [&]() {
+    RmsNormBackwardKernelImplInternal<scalar_t>(
+        dY.contiguous(), X, rstd, gamma, M, N, dX, dgamma);
+  });
+}
+
 } // namespace
 
 REGISTER_DISPATCH(LayerNormKernel, &LayerNormKernelImpl);
 REGISTER_DISPATCH(LayerNormBackwardKernel, &LayerNormBackwardKernelImpl);
+REGISTER_DISPATCH(RmsNormKernel, &RmsNormKernelImpl);
+REGISTER_DISPATCH(RmsNormBackwardKernel, &RmsNormBackwardKernelImpl);
 
 } // namespace at::native
@@ -0,0 +1,265 @@
+#include <ATen/core/Tensor.h>
+#include <ATen/Dispatch.h>
+#include <ATen/ceil_div.h>
+#include <ATen/cuda/CUDAContext.h>
+#include <ATen/cuda/DeviceUtils.cuh>
+#include <ATen/native/LinearAlgebraUtils.h>
+#include <ATen/native/cuda/linalg/BatchLinearAlgebraLib.h>
+
+namespace at {
+namespace native {
+
+namespace {
+
+// Warp-per-matrix batched factorizations for tiny matrices (n <= warp size).
+// Each warp stages one matrix in shared memory and factorizes it with one
+// lane per row (or per column for the row swaps), so a block of
+// kSmallLinalgWarpsPerBlock warps retires that many matrices. This avoids
+// both the per-matrix kernel launches of the looped cuSOLVER path and the
+// pointer-array setup of the batched library paths, which dominate the
+// runtime when the matrices themselves are only a few dozen elements.
+//
+// Real types only: the upper-triangular variants run the lower-triangular
+// algorithm on A^T by swapping the row/column indices of every global-memory
+// access, which is only equivalent when no conjugation is needed.
+constexpr int kSmallLinalgWarpsPerBlock = 4;
+
+template <typename scalar_t>
+__global__ void cholesky_small_batched_kernel(
+    scalar_t* data,
+    int n,
+    int lda,
+    int64_t matrix_stride,
+    int* infos,
+    int64_t batch_count,
+    bool upper) {
+  extern __shared__ unsigned char shared_raw[];
+  const int lane = threadIdx.x;
+  const int64_t batch =
+      static_cast<int64_t>(blockIdx.x) * blockDim.y + threadIdx.y;
+  if (batch >= batch_count) {
+    return;
+  }
+  scalar_t* tile =
+      reinterpret_cast<scalar_t*>(shared_raw) + threadIdx.y * n * n;
+  scalar_t* A = data + batch * matrix_stride;
+  auto elem = [&](int r, int c) -> scalar_t& {
+    return upper ? A[c + r * lda] : A[r + c * lda];
+  };
+
+  // Stage the relevant triangle; the algorithm never reads above the diagonal
+  for (int idx = lane; idx < n * n; idx += C10_WARP_SIZE) {
+    const int c = idx / n;
+    const int r = idx - c * n;
+    if (r >= c) {
+      tile[idx] = elem(r, c);
+    }
+  }
+  __syncwarp();
+
+  int info = 0;
+  for (int k = 0; k < n; ++k) {
+    // Every lane reads the same pre-sqrt diagonal element, so the early exit
+    // below is warp-uniform
+    const scalar_t diag = tile[k + k * n];
+    if (!(diag > scalar_t(0))) { // catches non-positive-definite and NaN
+      info = k + 1;
+      break;
+    }
+    if (lane == k) {
+      tile[k + k * n] = std::sqrt(diag);
+    }
+    __syncwarp();
+    const scalar_t inv_diag = scalar_t(1) / tile[k + k * n];
+    if (lane > k && lane < n) {
+      tile[lane + k * n] *= inv_diag;
+    }
+    __syncwarp();
+    // Rank-1 update of the trailing submatrix, one lane per row. Iterations
+    // of this loop touch disjoint columns, so no sync is needed inside it
+    for (int j = k + 1; j < n; ++j) {
+      if (lane >= j && lane < n) {
+        tile[lane + j * n] -= tile[lane + k * n] * tile[j + k * n];
+      }
+    }
+    __syncwarp();
+  }
+
+  if (lane == 0) {
+    infos[batch] = info;
+  }
+  for (int idx = lane; idx < n * n; idx += C10_WARP_SIZE) {
+    const int c = idx / n;
+    const int r = idx - c * n;
+    if (r >= c) {
+      elem(r, c) = tile[idx];
+    }
+  }
+}
+
+template <typename scalar_t>
+__global__ void lu_factor_small_batched_kernel(
+    scalar_t* data,
+    int n,
+    int lda,
+    int64_t matrix_stride,
+    int* pivots,
+    int* infos,
+    int64_t batch_count,
+    bool compute_pivots) {
+  extern __shared__ unsigned char shared_raw[];
+  const int lane = threadIdx.x;
+  const int64_t batch =
+      static_cast<int64_t>(blockIdx.x) * blockDim.y + threadIdx.y;
+  if (batch >= batch_count) {
+    return;
+  }
+  scalar_t* tile =
+      reinterpret_cast<scalar_t*>(shared_raw) + threadIdx.y * n * n;
+  scalar_t* A = data + batch * matrix_stride;
+  int* pivots_batch = pivots + batch * n;
+
+  for (int idx = lane; idx < n * n; idx += C10_WARP_SIZE) {
+    const int c = idx / n;
+    tile[idx] = A[(idx - c * n) + c * lda];
+  }
+  __syncwarp();
+
+  int info = 0;
+  for (int k = 0; k < n; ++k) {
+    int piv = k;
+    if (compute_pivots) {
+      // Partial pivoting: warp argmax over |column k| below the diagonal.
+      // Ties resolve to the lowest row index, matching LAPACK's i?amax
+      scalar_t best_val(-1);
+      int best_idx = k;
+      if (lane >= k && lane < n) {
+        best_val = std::abs(tile[lane + k * n]);
+        best_idx = lane;
+      }
+      for (int offset = C10_WARP_SIZE / 2; offset > 0; offset /= 2) {
+        const scalar_t other_val = WARP_SHFL_DOWN(best_val, offset);
+        const int other_idx = WARP_SHFL_DOWN(best_idx, offset);
+        if (other_val > best_val) {
+          best_val = other_val;
+          best_idx = other_idx;
+        }
+      }
+      piv = WARP_SHFL(best_idx, 0);
+      if (lane == 0) {
+        pivots_batch[k] = piv + 1;
+      }
+      if (piv != k && lane < n) {
+        // One lane per column for the row swap
+        const scalar_t tmp = tile[k + lane * n];
+        tile[k + lane * n] = tile[piv + lane * n];
+        tile[piv + lane * n] = tmp;
+      }
+      __syncwarp();
+    }
+    const scalar_t pivot = tile[k + k * n];
+    if (pivot == scalar_t(0)) {
+      // Like LAPACK's getf2 we record the first zero pivot and skip the
+      // elimination step for this column
+      if (info == 0) {
+        info = k + 1;
+      }
+      continue;
+    }
+    const scalar_t inv_pivot = scalar_t(1) / pivot;
+    if (lane > k && lane < n) {
+      tile[lane + k * n] *= inv_pivot;
+    }
+    __syncwarp();
+    for (int j = k + 1; j < n; ++j) {
+      if (lane > k && lane < n) {
+        tile[lane + j * n] -= tile[lane + k * n] * tile[k + j * n];
+      }
+    }
+    __syncwarp();
+  }
+
+  if (lane == 0) {
+    infos[batch] = info;
+  }
+  for (int idx = lane; idx < n * n; idx += C10_WARP_SIZE) {
+    const int c = idx / n;
+    A[(idx - c * n) + c * lda] = tile[idx];
+  }
+}
+
+} // anonymous namespace
+
+void cholesky_small_batched_cuda(
+    const Tensor& input,
+    bool upper,
+    const Tensor& info) {
+  if (input.numel() == 0) {
+    return;
+  }
+  const auto batch_size = batchCount(input);
+  const int n = static_cast<int>(input.size(-1));
+  const int lda = std::max<int>(1, n);
+  TORCH_INTERNAL_ASSERT(n <= C10_WARP_SIZE);
+  TORCH_INTERNAL_ASSERT_DEBUG_ONLY(input.mT().is_contiguous());
+
+  const dim3 block(C10_WARP_SIZE, kSmallLinalgWarpsPerBlock);
+  const auto grid = static_cast<unsigned int>(
+      ceil_div(batch_size, static_cast<int64_t>(kSmallLinalgWarpsPerBlock)));
+  auto stream = at::cuda::getCurrentCUDAStream();
+  AT_DISPATCH_FLOATING_TYPES(
+      input.scalar_type(), "cholesky_small_batched_cuda", [&] {
+        const size_t shared_size =
+            sizeof(scalar_t) * kSmallLinalgWarpsPerBlock * n * n;
+        cholesky_small_batched_kernel<scalar_t>
+            <<<grid, block, shared_size, stream>>>(
+                input.data_ptr<scalar_t>(),
+                n,
+                lda,
+                matrixStride(input),
+                info.data_ptr<int>(),
+                batch_size,
+                upper);
+        C10_CUDA_KERNEL_LAUNCH_CHECK();
+      });
+}
+
+void lu_factor_small_batched_cuda(
+    const Tensor& input,
+    const Tensor& pivots,
+    const Tensor& infos,
+    bool compute_pivots) {
+  if (input.numel() == 0) {
+    return;
+  }
+  const auto batch_size = batchCount(input);
+  const int n = static_cast<int>(input.size(-1));
+  const int lda = std::max<int>(1, n);
+  TORCH_INTERNAL_ASSERT(input.size(-2) == input.size(-1));
+  TORCH_INTERNAL_ASSERT(n <= C10_WARP_SIZE);
+  TORCH_INTERNAL_ASSERT_DEBUG_ONLY(input.mT().is_contiguous());
+
+  const dim3 block(C10_WARP_SIZE, kSmallLinalgWarpsPerBlock);
+  const auto grid = static_cast<unsigned int>(
+      ceil_div(batch_size, static_cast<int64_t>(kSmallLinalgWarpsPerBlock)));
+  auto stream = at::cuda::getCurrentCUDAStream();
+  AT_DISPATCH_FLOATING_TYPES(
+      input.scalar_type(), "lu_factor_small_batched_cuda", [&] {
+        const size_t shared_size =
+            sizeof(scalar_t) * kSmallLinalgWarpsPerBlock * n * n;
+        lu_factor_small_batched_kernel<scalar_t>
+            <<<grid, block, shared_size, stream>>>(
+                input.data_ptr<scalar_t>(),
+                n,
+                lda,
+                matrixStride(input),
+                pivots.data_ptr<int>(),
+                infos.data_ptr<int>(),
+                batch_size,
+                compute_pivots);
+        C10_CUDA_KERNEL_LAUNCH_CHECK();
+      });
+}
+
+} // namespace native
+} // namespace at
@@ -19,6 +19,12 @@
 
 #include <c10/cuda/CUDACachingAllocator.h>
 #include <c10/cuda/CUDAStream.h>
+#include <c10/util/env.h>
+
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <utility>
 
 // TODO(NS): Investigate why FP8 conversion intrinsics end up being slower
 #ifdef AT_USE_NV_CVT_INTRINSICS
@@ -169,6 +175,42 @@ void neg_conj_kernel_cuda(TensorIteratorBase &iter) {
 
 using namespace at::cuda;
 
+// Opt-in dedicated streams for cross-GPU memcpys (see
+// PYTORCH_CUDA_P2P_COPY_STREAM below). Running the transfer off the source
+// device's current stream lets the copy engines overlap with already-enqueued
+// compute on both devices, at the cost of slightly weaker ordering: kernels
+// enqueued on the source device's stream after a non_blocking copy no longer
+// implicitly wait for the transfer, mirroring the documented semantics of
+// non_blocking host-to-device copies.
+static bool p2p_copy_stream_enabled() {
+  static bool enabled =
+      c10::utils::check_env("PYTORCH_CUDA_P2P_COPY_STREAM") == true;
+  return enabled;
+}
+
+// Below this size the extra event wiring costs more than the overlap buys;
+// small transfers stay packed together on the source device's current stream.
+constexpr int64_t kP2pCopyStreamMinBytes = 64 * 1024;
+
+static CUDAStream get_p2p_copy_stream(
+    DeviceIndex src_device,
+    DeviceIndex dst_device) {
+  static std::mutex mutex;
+  static std::map<std::pair<DeviceIndex, DeviceIndex>, CUDAStream> streams;
+  std::lock_guard<std::mutex> lock(mutex);
+  auto it = streams.find({src_device, dst_device});
+  if (it == streams.end()) {
+    // High priority so the transfer launch is not stuck behind queued compute
+    // if the pool hands the same stream out to other work.
+    it = streams
+             .emplace(
+                 std::make_pair(src_device, dst_device),
+                 getStreamFromPool(/*isHighPriority=*/true, src_device))
+             .first;
+  }
+  return it->second;
+}
+
 // device-to-device copy, does type conversion
 void copy_device_to_device(TensorIterator& iter,
                            bool non_blocking,
@@ -193,6 +235,24 @@ void copy_device_to_device(TensorIterator& iter,
   // for non-contig copies. This mimics the behavior of cross-device
   // cudaMemcpyAsync on the default stream.
   CUDAStream copy_stream = getCurrentCUDAStream(src_device.index());
+  bool use_p2p_copy_stream = src_device != dst_device && memcpy_eligible &&
+      non_blocking && p2p_copy_stream_enabled() &&
+      numel * iter.element_size(0) >= kP2pCopyStreamMinBytes;
+  if (use_p2p_copy_stream) {
+    copy_stream = get_p2p_copy_stream(src_device.index(), dst_device.index());
+    // The copy stream must see the source tensor fully produced before the
+    // transfer starts
+    CUDAEvent src_written;
+    src_written.record(getCurrentCUDAStream(src_device.index()));
+    src_written.block(copy_stream);
+    // Both allocations are now used on a stream the caching allocator does
+    // not associate them with; keep the blocks from being reused while the
+    // transfer is in flight.
+    CUDACachingAllocator::recordStream(
+        iter.tensor(1).storage().data_ptr(), copy_stream);
+    CUDACachingAllocator::recordStream(
+        iter.tensor(0).storage().data_ptr(), copy_stream);
+  }
   if (src_device != dst_device) {
     // This is a cross-device copy on the src current stream and dst current
     // stream. We perform a two-way barrier between both devices' streams
@@ -285,6 +345,41 @@ static bool maybe_enable_p2p_access(Device dst_device, Device src_device) {
   return at::cuda::get_p2p_access(src_device.index(), dst_device.index());
 }
 
+// Chunk size for staged pageable H2D copies; large enough to reach peak DMA
+// bandwidth, small enough that staging and DMA pipeline against each other.
+constexpr int64_t kStagedCopyChunkBytes = 4 * 1024 * 1024;
+// Below this size the extra host memcpy isn't worth pipelining.
+constexpr int64_t kStagedCopyMinBytes = 2 * kStagedCopyChunkBytes;
+
+static bool staged_pageable_h2d_enabled() {
+  static bool enabled =
+      c10::utils::check_env("PYTORCH_CUDA_STAGED_PAGEABLE_COPY") == true;
+  return enabled;
+}
+
+static void staged_pageable_h2d_copy(
+    void* dst,
+    const void* src,
+    int64_t nbytes,
+    CUDAStream stream) {
+  int64_t offset = 0;
+  while (offset < nbytes) {
+    const int64_t chunk = std::min(kStagedCopyChunkBytes, nbytes - offset);
+    auto slab = at::cuda::HostAlloc(chunk);
+    std::memcpy(slab.get(), static_cast<const char*>(src) + offset, chunk);
+    AT_CUDA_CHECK(cudaMemcpyAsync(
+        static_cast<char*>(dst) + offset,
+        slab.get(),
+        chunk,
+        cudaMemcpyHostToDevice,
+        stream));
+    // Let the caching host allocator reuse the slab once the DMA is done;
+    // the DataPtr going out of scope alone would allow premature reuse.
+    CachingHostAllocator_recordEvent(slab.get(), slab.get_context(), stream);
+    offset += chunk;
+  }
+}
+
 static void copy_kernel_cuda(TensorIterator& iter, bool non_blocking) {
   TORCH_CHECK(iter.ntensors() == 2);
 
@@ -359,7 +454,26 @@ static void copy_kernel_cuda(TensorIterator& iter, bool non_blocking) {
   int64_t nbytes = iter.numel() * iter.element_size(0);
   CUDAStream stream = getCurrentCUDAStream();
 
-  if (non_blocking) {
+  // Pageable H2D copies can be staged through pinned slabs from the caching
+  // host allocator: each chunk is memcpy'd into a pinned slab and DMA'd with
+  // cudaMemcpyAsync, so the host-side staging of chunk i+1 overlaps the DMA
+  // of chunk i instead of the driver's synchronous pageable path stalling
+  // the input pipeline. Slabs are handed back via recordEvent, so the
+  // allocator recycles them (a small steady-state ring) once their DMA
+  // completes. Opt in with PYTORCH_CUDA_STAGED_PAGEABLE_COPY=1.
+  const bool use_staged_h2d = kind == cudaMemcpyHostToDevice &&
+      nbytes >= kStagedCopyMinBytes && staged_pageable_h2d_enabled() &&
+      !iter.tensor(1).is_pinned();
+
+  if (use_staged_h2d) {
+    // The pageable source is fully consumed by the host-side staging
+    // memcpys, so no event needs to be recorded against it; blocking
+    // callers only need to wait for the in-flight DMAs.
+    staged_pageable_h2d_copy(dst, src, nbytes, stream);
+    if (!non_blocking) {
+      AT_CUDA_CHECK(cudaStreamSynchronize(stream));
+    }
+  } else if (non_blocking) {
     AT_CUDA_CHECK(cudaMemcpyAsync(dst, src, nbytes, kind, stream));
     // we use both the storage context and the tensor data pointer as the key
     // for the caching host allocator. This allows us to better attribute the
@@ -438,6 +438,21 @@ public:
     return kv_it->second;
   }
 
+  // If key is in this cache, return a pointer to the cached config and mark
+  // it as most recently used. Otherwise, return nullptr without creating a
+  // plan. This lets callers probe for an exact plan before deciding to
+  // populate the cache differently (see NOTE [ cuFFT plan batch bucketing ]).
+  const CuFFTConfig *find(CuFFTParams params) {
+    AT_ASSERT(_max_size > 0);
+
+    map_kkv_iter_t map_it = _cache_map.find(params);
+    if (map_it == _cache_map.end()) {
+      return nullptr;
+    }
+    _usage_list.splice(_usage_list.begin(), _usage_list, map_it->second);
+    return &map_it->second->second;
+  }
+
   void clear() {
     _cache_map.clear();
     _usage_list.clear();
@@ -0,0 +1,491 @@
+#define TORCH_ASSERT_ONLY_METHOD_OPERATORS
+#include <ATen/native/layer_norm.h>
+
+#include <ATen/core/Tensor.h>
+#include <ATen/AccumulateType.h>
+#include <ATen/Dispatch.h>
+#include <ATen/Utils.h>
+#include <ATen/cuda/CUDAContext.h>
+#include <ATen/cuda/CUDAGeneratorImpl.h>
+#include <ATen/cuda/CUDAGraphsUtils.cuh>
+#include <ATen/native/cuda/block_reduce.cuh>
+#include <c10/cuda/CUDAMathCompat.h>
+#include <c10/util/irange.h>
+#include <curand_kernel.h>
+
+#ifndef AT_PER_OPERATOR_HEADERS
+#include <ATen/Functions.h>
+#include <ATen/NativeFunctions.h>
+#else
+#include <ATen/ops/_fused_dropout_add_layer_norm_native.h>
+#include <ATen/ops/_fused_dropout_add_layer_norm_backward_native.h>
+#include <ATen/ops/_fused_dropout_add_rms_norm_native.h>
+#include <ATen/ops/_fused_dropout_add_rms_norm_backward_native.h>
+#include <ATen/ops/_fused_rms_norm_backward.h>
+#include <ATen/ops/empty.h>
+#include <ATen/ops/empty_like_native.h>
+#include <ATen/ops/native_layer_norm_backward.h>
+#endif
+
+namespace at::native {
+
+namespace {
+
+constexpr int kCUDANumThreads = 256;
+constexpr int kMaskBits = 8;
+
+// Fused dropout + residual add + normalization for transformer blocks:
+//
+//   z = residual + dropout(input, p)
+//   y = norm(z) * gamma (+ beta)
+//
+// run unfused this is three kernels with two full-size intermediates; here
+// input and residual are read once, the pre-normalization sum z is written
+// once (it is needed for backward anyway) and re-read for the normalized
+// output while still hot in L2, and the dropout mask is kept bit-packed, an
+// eighth the size of the bool mask native_dropout materializes.
+//
+// Each thread owns whole mask bytes, i.e. groups of eight consecutive
+// elements of a row, so a mask byte is assembled in registers and written
+// without atomics. curand_uniform4 yields four floats, so a byte of mask
+// bits takes two draws regardless of how many of its lanes are in range;
+// keeping the draw count independent of N is also what makes the philox
+// counter offset computable on the host.
+template <typename T, typename T_ACC, bool kRms>
+__global__ void DropoutAddNormForwardCUDAKernel(
+    int64_t N,
+    int64_t bytes_per_row,
+    T_ACC keep_p,
+    T_ACC scale,
+    T_ACC eps,
+    PhiloxCudaState philox_args,
+    const T* X,
+    const T* R,
+    const T* gamma,
+    const T* beta,
+    uint8_t* mask,
+    T* Z,
+    T* Y,
+    T_ACC* mean,
+    T_ACC* rstd) {
+  using WelfordType = WelfordData<T_ACC, int64_t>;
+  using WelfordOp =
+      WelfordOps<T_ACC, T_ACC, int64_t, thrust::pair<T_ACC, T_ACC>>;
+
+  __shared__
+      typename std::aligned_storage<sizeof(WelfordType), alignof(WelfordType)>::
+          type val_shared[C10_WARP_SIZE];
+  WelfordType* val_shared_ptr = reinterpret_cast<WelfordType*>(val_shared);
+  __shared__ T_ACC sum_shared[C10_WARP_SIZE];
+  __shared__ T_ACC stats_shared[2];
+
+  const int64_t i = blockIdx.x;
+
+  auto seeds = at::cuda::philox::unpack(philox_args);
+  curandStatePhilox4_32_10_t state;
+  curand_init(
+      std::get<0>(seeds),
+      blockIdx.x * blockDim.x + threadIdx.x,
+      std::get<1>(seeds),
+      &state);
+
+  WelfordOp welford_op = {/*correction=*/0, /*take_sqrt=*/false};
+  WelfordType w_val(0, 0, 0, 0);
+  T_ACC sum_sq = 0;
+
+  for (int64_t byte = threadIdx.x; byte < bytes_per_row; byte += blockDim.x) {
+    const float4 rand_lo = curand_uniform4(&state);
+    const float4 rand_hi = curand_uniform4(&state);
+    uint8_t mask_byte = 0;
+    const int64_t limit = std::min<int64_t>(kMaskBits, N - byte * kMaskBits);
+    for (int64_t b = 0; b < limit; ++b) {
+      const float r = b < 4 ? (&rand_lo.x)[b] : (&rand_hi.x)[b - 4];
+      const bool keep = static_cast<T_ACC>(r) < keep_p;
+      const int64_t index = i * N + byte * kMaskBits + b;
+      T_ACC z = static_cast<T_ACC>(R[index]);
+      if (keep) {
+        mask_byte |= uint8_t(1) << b;
+        z += static_cast<T_ACC>(X[index]) * scale;
+      }
+      const T z_out = static_cast<T>(z);
+      Z[index] = z_out;
+      // Accumulate the stored (rounded) value so the statistics match what
+      // an unfused normalization of Z would compute for low precision types.
+      if (kRms) {
+        sum_sq += static_cast<T_ACC>(z_out) * static_cast<T_ACC>(z_out);
+      } else {
+        w_val = welford_op.reduce(w_val, static_cast<T_ACC>(z_out), index);
+      }
+    }
+    mask[i * bytes_per_row + byte] = mask_byte;
+  }
+
+  if (kRms) {
+    sum_sq = cuda_utils::BlockReduceSum<T_ACC>(sum_sq, sum_shared);
+    if (threadIdx.x == 0) {
+      stats_shared[1] =
+          c10::cuda::compat::rsqrt(sum_sq / static_cast<T_ACC>(N) + eps);
+      rstd[i] = stats_shared[1];
+    }
+  } else {
+    w_val = cuda_utils::BlockReduce(
+        w_val,
+        welford_op,
+        /*identity_element=*/WelfordType(0, 0, 0, 0),
+        val_shared_ptr);
+    if (threadIdx.x == 0) {
+      T_ACC m1;
+      T_ACC m2;
+      thrust::tie(m2, m1) = welford_op.project(w_val);
+      stats_shared[0] = m1;
+      stats_shared[1] = c10::cuda::compat::rsqrt(m2 + eps);
+      mean[i] = m1;
+      rstd[i] = stats_shared[1];
+    }
+  }
+  __syncthreads();
+
+  const T_ACC mean_v = kRms ? T_ACC(0) : stats_shared[0];
+  const T_ACC rstd_v = stats_shared[1];
+  for (int64_t j = threadIdx.x; j < N; j += blockDim.x) {
+    const int64_t index = i * N + j;
+    const T_ACC gamma_v =
+        gamma == nullptr ? T_ACC(1) : static_cast<T_ACC>(gamma[j]);
+    T_ACC y = (static_cast<T_ACC>(Z[index]) - mean_v) * rstd_v * gamma_v;
+    if (!kRms) {
+      y += beta == nullptr ? T_ACC(0) : static_cast<T_ACC>(beta[j]);
+    }
+    Y[index] = static_cast<T>(y);
+  }
+}
+
+// dX = dZ * mask * scale with the mask unpacked from one bit per element.
+template <typename T, typename T_ACC>
+__global__ void DropoutBitMaskScaleCUDAKernel(
+    int64_t N,
+    int64_t bytes_per_row,
+    T_ACC scale,
+    const T* dZ,
+    const uint8_t* mask,
+    T* dX) {
+  const int64_t i = blockIdx.x;
+  for (int64_t j = threadIdx.x; j < N; j += blockDim.x) {
+    const uint8_t mask_byte = mask[i * bytes_per_row + j / kMaskBits];
+    const T_ACC g =
+        ((mask_byte >> (j % kMaskBits)) & 1) != 0 ? scale : T_ACC(0);
+    dX[i * N + j] = static_cast<T>(static_cast<T_ACC>(dZ[i * N + j]) * g);
+  }
+}
+
+// Returns (Y, Z, mask, mean, rstd); mean is left undefined for RMSNorm and
+// mean/rstd are flat {M} (the LayerNorm wrapper reshapes to the stat shape).
+template <bool kRms>
+std::tuple<Tensor, Tensor, Tensor, Tensor, Tensor> dropout_add_norm_cuda_impl(
+    const Tensor& input,
+    const Tensor& residual,
+    IntArrayRef normalized_shape,
+    const Tensor& weight,
+    const Tensor& bias,
+    double p,
+    double eps,
+    std::optional<Generator> gen_) {
+  auto M_N = _check_layer_norm_inputs(input, normalized_shape, weight, bias);
+  auto M = M_N.first;
+  auto N = M_N.second;
+  TORCH_CHECK(
+      residual.sizes().equals(input.sizes()),
+      "residual must have the same shape as input, but got ",
+      residual.sizes(),
+      " and ",
+      input.sizes());
+  TORCH_CHECK(
+      residual.scalar_type() == input.scalar_type(),
+      "residual must have the same dtype as input, but got ",
+      residual.scalar_type(),
+      " and ",
+      input.scalar_type());
+  TORCH_CHECK(
+      p >= 0 && p <= 1,
+      "dropout probability has to be between 0 and 1, but got ",
+      p);
+
+  auto X = input.expect_contiguous();
+  auto R = residual.expect_contiguous();
+  auto gamma = weight.expect_contiguous();
+  auto beta = bias.expect_contiguous();
+
+  Tensor Y = at::native::empty_like(
+      *X,
+      c10::nullopt /* dtype */,
+      c10::nullopt /* layout */,
+      c10::nullopt /* device */,
+      c10::nullopt /* pin_memory */,
+      LEGACY_CONTIGUOUS_MEMORY_FORMAT);
+  Tensor Z = at::native::empty_like(
+      *X,
+      c10::nullopt /* dtype */,
+      c10::nullopt /* layout */,
+      c10::nullopt /* device */,
+      c10::nullopt /* pin_memory */,
+      LEGACY_CONTIGUOUS_MEMORY_FORMAT);
+  // Rows are padded to whole bytes so every mask byte belongs to one row.
+  const int64_t bytes_per_row = (N + kMaskBits - 1) / kMaskBits;
+  Tensor mask = at::empty({M, bytes_per_row}, X->options().dtype(kByte));
+  auto acc_type = at::toAccumulateType(input.scalar_type(), /*is_cuda=*/true);
+  Tensor mean;
+  if (!kRms) {
+    mean = at::empty({M}, X->options().dtype(acc_type));
+  }
+  Tensor rstd = at::empty({M}, X->options().dtype(acc_type));
+
+  // Calling the kernel for M==0 gives a CUDA error
+  // See: https://github.com/pytorch/pytorch/pull/28614
+  if (M > 0) {
+    auto gen = get_generator_or_default<CUDAGeneratorImpl>(
+        gen_, cuda::detail::getDefaultCUDAGenerator());
+    // Two curand_uniform4 draws of four 32-bit values each per mask byte
+    // owned by a thread; the offset is counted in 32-bit values.
+    const int64_t counter_offset =
+        8 * ((bytes_per_row - 1) / kCUDANumThreads + 1);
+    PhiloxCudaState rng_engine_inputs;
+    {
+      // See Note [Acquire lock when using random generators]
+      std::lock_guard<std::mutex> lock(gen->mutex_);
+      rng_engine_inputs = gen->philox_cuda_state(counter_offset);
+    }
+    cudaStream_t cuda_stream = at::cuda::getCurrentCUDAStream();
+    AT_DISPATCH_FLOATING_TYPES_AND2(
+        at::ScalarType::Half,
+        at::ScalarType::BFloat16,
+        X->scalar_type(),
+        "fused_dropout_add_norm_cuda",
+        [&] {
+          using acc_t = acc_type<scalar_t, true>;
+          const acc_t keep_p = static_cast<acc_t>(1. - p);
+          const acc_t scale =
+              p < 1. ? static_cast<acc_t>(1. / (1. - p)) : acc_t(0);
+          DropoutAddNormForwardCUDAKernel<scalar_t, acc_t, kRms>
+              <<<M, kCUDANumThreads, 0, cuda_stream>>>(
+                  N,
+                  bytes_per_row,
+                  keep_p,
+                  scale,
+                  static_cast<acc_t>(eps),
+                  rng_engine_inputs,
+                  X->const_data_ptr<scalar_t>(),
+                  R->const_data_ptr<scalar_t>(),
+                  gamma->defined() ? gamma->const_data_ptr<scalar_t>()
+                                   : nullptr,
+                  beta->defined() ? beta->const_data_ptr<scalar_t>() : nullptr,
+                  mask.mutable_data_ptr<uint8_t>(),
+                  Z.mutable_data_ptr<scalar_t>(),
+                  Y.mutable_data_ptr<scalar_t>(),
+                  kRms ? static_cast<acc_t*>(nullptr)
+                       : mean.mutable_data_ptr<acc_t>(),
+                  rstd.mutable_data_ptr<acc_t>());
+          C10_CUDA_KERNEL_LAUNCH_CHECK();
+        });
+  }
+  return std::make_tuple(
+      std::move(Y),
+      std::move(Z),
+      std::move(mask),
+      std::move(mean),
+      std::move(rstd));
+}
+
+Tensor dropout_bit_mask_grad_cuda(
+    const Tensor& dZ,
+    const Tensor& mask,
+    double p) {
+  TORCH_INTERNAL_ASSERT(mask.scalar_type() == ScalarType::Byte);
+  TORCH_INTERNAL_ASSERT(mask.dim() == 2);
+  auto dZ_ = dZ.expect_contiguous();
+  Tensor dX = at::native::empty_like(
+      *dZ_,
+      c10::nullopt /* dtype */,
+      c10::nullopt /* layout */,
+      c10::nullopt /* device */,
+      c10::nullopt /* pin_memory */,
+      LEGACY_CONTIGUOUS_MEMORY_FORMAT);
+  const int64_t M = mask.size(0);
+  const int64_t bytes_per_row = mask.size(1);
+  const int64_t N = M > 0 ? dZ.numel() / M : 0;
+  if (M > 0 && N > 0) {
+    cudaStream_t cuda_stream = at::cuda::getCurrentCUDAStream();
+    AT_DISPATCH_FLOATING_TYPES_AND2(
+        at::ScalarType::Half,
+        at::ScalarType::BFloat16,
+        dZ.scalar_type(),
+        "fused_dropout_add_norm_backward_cuda",
+        [&] {
+          using acc_t = acc_type<scalar_t, true>;
+          const acc_t scale =
+              p < 1. ? static_cast<acc_t>(1. / (1. - p)) : acc_t(0);
+          DropoutBitMaskScaleCUDAKernel<scalar_t, acc_t>
+              <<<M, kCUDANumThreads, 0, cuda_stream>>>(
+                  N,
+                  bytes_per_row,
+                  scale,
+                  dZ_->const_data_ptr<scalar_t>(),
+                  mask.const_data_ptr<uint8_t>(),
+                  dX.mutable_data_ptr<scalar_t>());
+          C10_CUDA_KERNEL_LAUNCH_CHECK();
+        });
+  }
+  return dX;
+}
+
+} // namespace
+
+std::tuple<Tensor, Tensor, Tensor, Tensor, Tensor>
+_fused_dropout_add_layer_norm_cuda(
+    const Tensor& input,
+    const Tensor& residual,
+    IntArrayRef normalized_shape,
+    const std::optional<Tensor>& weight_opt /* optional */,
+    const std::optional<Tensor>& bias_opt /* optional */,
+    double p,
+    double eps,
+    std::optional<Generator> generator) {
+  // See [Note: hacky wrapper removal for optional tensor]
+  c10::MaybeOwned<Tensor> weight_maybe_owned =
+      at::borrow_from_optional_tensor(weight_opt);
+  const Tensor& weight = *weight_maybe_owned;
+  c10::MaybeOwned<Tensor> bias_maybe_owned =
+      at::borrow_from_optional_tensor(bias_opt);
+  const Tensor& bias = *bias_maybe_owned;
+
+  auto outputs = dropout_add_norm_cuda_impl</*kRms=*/false>(
+      input,
+      residual,
+      normalized_shape,
+      weight,
+      bias,
+      p,
+      eps,
+      std::move(generator));
+  Tensor mean = std::move(std::get<3>(outputs));
+  Tensor rstd = std::move(std::get<4>(outputs));
+
+  const auto input_shape = input.sizes();
+  const size_t axis = input.dim() - normalized_shape.size();
+  std::vector<int64_t> stat_shape;
+  for (const auto idx : c10::irange(axis)) {
+    stat_shape.push_back(input_shape[idx]);
+  }
+  for (const auto C10_UNUSED idx : c10::irange(axis, input.dim())) {
+    stat_shape.push_back(1);
+  }
+  mean = mean.view(stat_shape);
+  rstd = rstd.view(stat_shape);
+
+  return std::make_tuple(
+      std::move(std::get<0>(outputs)),
+      std::move(std::get<1>(outputs)),
+      std::move(std::get<2>(outputs)),
+      std::move(mean),
+      std::move(rstd));
+}
+
+std::tuple<Tensor, Tensor, Tensor, Tensor>
+_fused_dropout_add_layer_norm_backward_cuda(
+    const Tensor& grad_out,
+    const Tensor& pre_norm,
+    const Tensor& mask,
+    IntArrayRef normalized_shape,
+    const Tensor& mean,
+    const Tensor& rstd,
+    const std::optional<Tensor>& weight_opt /* optional */,
+    const std::optional<Tensor>& bias_opt /* optional */,
+    double p,
+    std::array<bool, 4> grad_input_mask) {
+  // The normalization backward already produces the gradient at the
+  // pre-normalization sum, which is exactly the residual gradient; the
+  // input gradient differs from it only by the saved mask and scale.
+  const bool needs_dz = grad_input_mask[0] || grad_input_mask[1];
+  auto norm_grads = at::native_layer_norm_backward(
+      grad_out,
+      pre_norm,
+      normalized_shape,
+      mean,
+      rstd,
+      weight_opt,
+      bias_opt,
+      {needs_dz, grad_input_mask[2], grad_input_mask[3]});
+  Tensor dZ = std::move(std::get<0>(norm_grads));
+  Tensor dX;
+  if (grad_input_mask[0]) {
+    dX = dropout_bit_mask_grad_cuda(dZ, mask, p);
+  }
+  Tensor dR;
+  if (grad_input_mask[1]) {
+    dR = std::move(dZ);
+  }
+  return std::make_tuple(
+      std::move(dX),
+      std::move(dR),
+      std::move(std::get<1>(norm_grads)),
+      std::move(std::get<2>(norm_grads)));
+}
+
+std::tuple<Tensor, Tensor, Tensor, Tensor> _fused_dropout_add_rms_norm_cuda(
+    const Tensor& input,
+    const Tensor& residual,
+    IntArrayRef normalized_shape,
+    const std::optional<Tensor>& weight_opt /* optional */,
+    double p,
+    double eps,
+    std::optional<Generator> generator) {
+  // See [Note: hacky wrapper removal for optional tensor]
+  c10::MaybeOwned<Tensor> weight_maybe_owned =
+      at::borrow_from_optional_tensor(weight_opt);
+  const Tensor& weight = *weight_maybe_owned;
+
+  auto outputs = dropout_add_norm_cuda_impl</*kRms=*/true>(
+      input,
+      residual,
+      normalized_shape,
+      weight,
+      Tensor(),
+      p,
+      eps,
+      std::move(generator));
+  return std::make_tuple(
+      std::move(std::get<0>(outputs)),
+      std::move(std::get<1>(outputs)),
+      std::move(std::get<2>(outputs)),
+      std::move(std::get<4>(outputs)));
+}
+
+std::tuple<Tensor, Tensor, Tensor> _fused_dropout_add_rms_norm_backward_cuda(
+    const Tensor& grad_out,
+    const Tensor& pre_norm,
+    const Tensor& mask,
+    IntArrayRef normalized_shape,
+    const Tensor& rstd,
+    const std::optional<Tensor>& weight_opt /* optional */,
+    double p,
+    std::array<bool, 3> grad_input_mask) {
+  const bool needs_dz = grad_input_mask[0] || grad_input_mask[1];
+  auto norm_grads = at::_fused_rms_norm_backward(
+      grad_out,
+      pre_norm,
+      normalized_shape,
+      rstd,
+      weight_opt,
+      {needs_dz, grad_input_mask[2]});
+  Tensor dZ = std::move(std::get<0>(norm_grads));
+  Tensor dX;
+  if (grad_input_mask[0]) {
+    dX = dropout_bit_mask_grad_cuda(dZ, mask, p);
+  }
+  Tensor dR;
+  if (grad_input_mask[1]) {
+    dR = std::move(dZ);
+  }
+  return std::make_tuple(
+      std::move(dX), std::move(dR), std::move(std::get<1>(norm_grads)));
+}
+
+} // namespace at::native
@@ -0,0 +1,182 @@
+#define TORCH_ASSERT_ONLY_METHOD_OPERATORS
+#include <ATen/core/Tensor.h>
+#include <ATen/DeviceGuard.h>
+#include <ATen/Dispatch.h>
+#include <ATen/Dispatch_v2.h>
+#include <ATen/cuda/Atomic.cuh>
+#include <ATen/cuda/CUDAContext.h>
+#include <ATen/native/TensorIterator.h>
+#include <ATen/native/cuda/Loops.cuh>
+
+#ifndef AT_PER_OPERATOR_HEADERS
+#include <ATen/Functions.h>
+#include <ATen/NativeFunctions.h>
+#else
+#include <ATen/ops/_cast_from_fp8_scaled_native.h>
+#include <ATen/ops/_cast_to_fp8_scaled_native.h>
+#include <ATen/ops/empty_like.h>
+#include <ATen/ops/zeros.h>
+#endif
+
+// Fused float8 quantization/dequantization:
+//
+//   _cast_to_fp8_scaled(self, scale, dtype) -> (Tensor, Tensor)
+//   _cast_from_fp8_scaled(self, inv_scale, dtype) -> Tensor
+//
+// Delayed-scaling fp8 training needs, per step and per tensor, the scaled
+// cast to fp8 and the abs-max of the unscaled input (to update the amax
+// history that produces the next step's scale). Composing those out of
+// existing ops costs two full reads of the source (abs().max() plus mul/to);
+// the cast kernel here computes both in a single read. The scale and
+// inv_scale arguments are read on device, so the amax -> scale update can
+// stay on the GPU without a sync. Scale/amax-history bookkeeping itself is
+// recipe state and is left to the caller.
+
+namespace at::native {
+
+namespace {
+
+constexpr int kBlockSize = 256;
+
+template <typename scalar_t, typename fp8_t>
+C10_LAUNCH_BOUNDS_1(kBlockSize)
+__global__ void cast_to_fp8_scaled_kernel(
+    const scalar_t* input,
+    fp8_t* output,
+    const float* scale,
+    float* amax,
+    int64_t numel) {
+  const float s = *scale;
+  float local_amax = 0.0f;
+  for (int64_t i = blockIdx.x * static_cast<int64_t>(blockDim.x) + threadIdx.x;
+       i < numel;
+       i += static_cast<int64_t>(blockDim.x) * gridDim.x) {
+    const float x = static_cast<float>(input[i]);
+    local_amax = fmaxf(local_amax, fabsf(x));
+    output[i] = static_cast<fp8_t>(x * s);
+  }
+  __shared__ float shared_amax[kBlockSize];
+  shared_amax[threadIdx.x] = local_amax;
+  __syncthreads();
+  for (unsigned int offset = blockDim.x / 2; offset > 0; offset >>= 1) {
+    if (threadIdx.x < offset) {
+      shared_amax[threadIdx.x] =
+          fmaxf(shared_amax[threadIdx.x], shared_amax[threadIdx.x + offset]);
+    }
+    __syncthreads();
+  }
+  if (threadIdx.x == 0) {
+    gpuAtomicMax(amax, shared_amax[0]);
+  }
+}
+
+void check_fp8_cast_scale(
+    const char* name,
+    const Tensor& self,
+    const Tensor& scale) {
+  TORCH_CHECK(
+      scale.scalar_type() == kFloat && scale.numel() == 1,
+      name,
+      ": scale must be a float scalar tensor, got ",
+      scale.scalar_type(),
+      " with ",
+      scale.numel(),
+      " elements");
+  TORCH_CHECK(
+      scale.device() == self.device(),
+      name,
+      ": scale must be on the same device as self");
+}
+
+} // anonymous namespace
+
+std::tuple<Tensor, Tensor> _cast_to_fp8_scaled_cuda(
+    const Tensor& self,
+    const Tensor& scale,
+    ScalarType dtype) {
+  TORCH_CHECK(
+      isFloat8Type(dtype),
+      "_cast_to_fp8_scaled: dtype must be a float8 type, got ",
+      dtype);
+  check_fp8_cast_scale("_cast_to_fp8_scaled", self, scale);
+  const OptionalDeviceGuard device_guard(device_of(self));
+
+  auto input = self.contiguous();
+  auto out = at::empty_like(input, input.options().dtype(dtype));
+  auto amax = at::zeros({}, self.options().dtype(kFloat));
+  const int64_t numel = input.numel();
+  if (numel == 0) {
+    return {out, amax};
+  }
+
+  // The grid is capped so tail blocks keep enough work per thread; the
+  // grid-stride loop covers the rest.
+  const int64_t grid = std::min<int64_t>(
+      (numel + kBlockSize - 1) / kBlockSize,
+      static_cast<int64_t>(at::cuda::getCurrentDeviceProperties()
+                               ->multiProcessorCount) *
+          8);
+  auto stream = at::cuda::getCurrentCUDAStream();
+  AT_DISPATCH_FLOATING_TYPES_AND2(
+      kHalf, kBFloat16, input.scalar_type(), "_cast_to_fp8_scaled_cuda", [&] {
+        using input_t = scalar_t;
+        AT_DISPATCH_V2(
+            dtype,
+            "_cast_to_fp8_scaled_cuda_out",
+            AT_WRAP([&] {
+              cast_to_fp8_scaled_kernel<input_t, scalar_t>
+                  <<<grid, kBlockSize, 0, stream>>>(
+                      input.const_data_ptr<input_t>(),
+                      out.mutable_data_ptr<scalar_t>(),
+                      scale.const_data_ptr<float>(),
+                      amax.mutable_data_ptr<float>(),
+                      numel);
+              C10_CUDA_KERNEL_LAUNCH_CHECK();
+            }),
+            AT_EXPAND(AT_FLOAT8_TYPES));
+      });
+  return {out, amax};
+}
+
+Tensor _cast_from_fp8_scaled_cuda(
+    const Tensor& self,
+    const Tensor& inv_scale,
+    ScalarType dtype) {
+  TORCH_CHECK(
+      isFloat8Type(self.scalar_type()),
+      "_cast_from_fp8_scaled: self must be a float8 tensor, got ",
+      self.scalar_type());
+  TORCH_CHECK(
+      dtype == kFloat || dtype == kDouble || dtype == kHalf ||
+          dtype == kBFloat16,
+      "_cast_from_fp8_scaled: dtype must be a non-float8 floating type, got ",
+      dtype);
+  check_fp8_cast_scale("_cast_from_fp8_scaled", self, inv_scale);
+  const OptionalDeviceGuard device_guard(device_of(self));
+
+  auto out = at::empty_like(self, self.options().dtype(dtype));
+  auto iter = TensorIteratorConfig()
+                  .add_output(out)
+                  .add_const_input(self)
+                  .check_all_same_dtype(false)
+                  .build();
+  AT_DISPATCH_V2(
+      self.scalar_type(),
+      "_cast_from_fp8_scaled_cuda",
+      AT_WRAP([&] {
+        using fp8_t = scalar_t;
+        AT_DISPATCH_FLOATING_TYPES_AND2(
+            kHalf, kBFloat16, dtype, "_cast_from_fp8_scaled_cuda_out", [&] {
+              const float* inv_scale_ptr = inv_scale.const_data_ptr<float>();
+              gpu_kernel(
+                  iter, [inv_scale_ptr] GPU_LAMBDA(fp8_t x) -> scalar_t {
+                    return static_cast<scalar_t>(
+                        static_cast<float>(x) * (*inv_scale_ptr));
+                  });
+            });
+      }),
+      AT_EXPAND(AT_FLOAT8_TYPES));
+  return out;
+}
+
+} // namespace at::native
@@ -0,0 +1,297 @@
+#define TORCH_ASSERT_ONLY_METHOD_OPERATORS
+#include <ATen/core/Tensor.h>
+#include <ATen/AccumulateType.h>
+#include <ATen/Dispatch.h>
+#include <ATen/Utils.h>
+#include <ATen/cuda/CUDAContext.h>
+#include <ATen/cuda/CUDAGeneratorImpl.h>
+#include <ATen/cuda/CUDAGraphsUtils.cuh>
+#include <ATen/native/cuda/block_reduce.cuh>
+#include <c10/macros/Macros.h>
+#include <curand_kernel.h>
+
+#ifndef AT_PER_OPERATOR_HEADERS
+#include <ATen/Functions.h>
+#include <ATen/NativeFunctions.h>
+#else
+#include <ATen/ops/_fused_token_sample_native.h>
+#include <ATen/ops/empty.h>
+#endif
+
+namespace at::native {
+
+namespace {
+
+constexpr int kSampleBlockSize = 256;
+
+// Note [Fused token sampling]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// The op fuses the per-step sampling pipeline of an autoregressive decoder
+// (softmax -> top-k -> top-p -> multinomial) into one kernel per call, one
+// block per row. The key observation is that neither filter needs a sort:
+// both top-k and top-p keep a down-closed set under the value ordering, so
+// each reduces to finding a value threshold, and a threshold can be found by
+// bisecting over the order-preserving integer encoding of the scaled logits
+// (32 count/mass reductions over the row, all hitting L2). The categorical
+// draw over the surviving set then uses the Gumbel-max trick, which turns
+// the softmax + cumsum + inverse-CDF search into a single argmax of
+// `z_i + g_i` and needs no normalization at all. The sampled index is
+// written to a device tensor, so the host never synchronizes.
+//
+// Tie semantics: every logit equal to the k-th largest survives top-k (the
+// value-threshold formulation), where a sort-based implementation would keep
+// an arbitrary k-subset. Likewise top-p keeps the smallest value-threshold
+// set whose probability mass reaches `top_p`, including ties at the
+// boundary; the highest logit always survives.
+
+// Maps a float to an unsigned integer that preserves the total order, so
+// value thresholds can be bisected exactly over bit patterns.
+__device__ __forceinline__ uint32_t float_as_ordered(float v) {
+  const uint32_t bits = __float_as_uint(v);
+  return (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+}
+
+template <typename T>
+__global__ void fused_token_sample_kernel(
+    const T* logits,
+    int64_t V,
+    float inv_temperature,
+    int64_t top_k, // 0 if disabled
+    float top_p, // > 1 if disabled
+    PhiloxCudaState philox_args,
+    int64_t* out) {
+  __shared__ float sum_shared[C10_WARP_SIZE];
+  __shared__ float val_shared[C10_WARP_SIZE];
+  __shared__ int64_t idx_shared[C10_WARP_SIZE];
+  __shared__ float broadcast_f;
+  __shared__ int broadcast_i;
+
+  const int64_t row = blockIdx.x;
+  const T* x = logits + row * V;
+  const int tid = threadIdx.x;
+
+  auto z = [&](int64_t j) -> float {
+    return static_cast<float>(x[j]) * inv_temperature;
+  };
+
+  // Row maximum: anchors the exponentials and bounds the threshold searches.
+  float m = -INFINITY;
+  for (int64_t j = tid; j < V; j += blockDim.x) {
+    m = max_propagate_nan(m, z(j));
+  }
+  m = cuda_utils::BlockReduceMax(m, val_shared);
+  if (tid == 0) {
+    broadcast_f = m;
+  }
+  __syncthreads();
+  m = broadcast_f;
+  const uint32_t u_max = float_as_ordered(m);
+
+  // Total (unnormalized) probability mass, needed for the top-p target.
+  float total_mass = 0;
+  if (top_p <= 1.0f) {
+    float local = 0;
+    for (int64_t j = tid; j < V; j += blockDim.x) {
+      local += __expf(z(j) - m);
+    }
+    local = cuda_utils::BlockReduceSum(local, sum_shared);
+    if (tid == 0) {
+      broadcast_f = local;
+    }
+    __syncthreads();
+    total_mass = broadcast_f;
+  }
+
+  // Finds the largest threshold `t` in [0, u_max] such that the kept set
+  // {j : ordered(z_j) >= t} still satisfies the filter; the searches share
+  // their structure and only differ in the per-element measure (count for
+  // top-k, exponential mass for top-p). The loop state is kept uniform
+  // across the block by broadcasting the reduced predicate from thread 0.
+  uint32_t cutoff = 0;
+  for (int filter = 0; filter < 2; ++filter) {
+    const bool is_top_k = filter == 0;
+    if (is_top_k ? top_k <= 0 : top_p > 1.0f) {
+      continue;
+    }
+    uint32_t lo = 0;
+    uint32_t hi = u_max;
+    while (lo < hi) {
+      const uint32_t mid = lo + (hi - lo + 1) / 2;
+      float local = 0;
+      for (int64_t j = tid; j < V; j += blockDim.x) {
+        const float zj = z(j);
+        if (float_as_ordered(zj) >= mid) {
+          local += is_top_k ? 1.0f : __expf(zj - m);
+        }
+      }
+      local = cuda_utils::BlockReduceSum(local, sum_shared);
+      if (tid == 0) {
+        broadcast_i = is_top_k ? local >= static_cast<float>(top_k)
+                               : local >= top_p * total_mass;
+      }
+      __syncthreads();
+      if (broadcast_i) {
+        lo = mid;
+      } else {
+        hi = mid - 1;
+      }
+      __syncthreads();
+    }
+    cutoff = ::max(cutoff, lo);
+  }
+
+  // Gumbel-max draw over the surviving set: argmax of z_j + g_j with i.i.d.
+  // standard Gumbel noise samples the renormalized categorical exactly.
+  auto seeds = at::cuda::philox::unpack(philox_args);
+  curandStatePhilox4_32_10_t state;
+  curand_init(
+      std::get<0>(seeds),
+      blockIdx.x * blockDim.x + tid,
+      std::get<1>(seeds),
+      &state);
+
+  float best_val = -INFINITY;
+  int64_t best_idx = 0;
+  float4 rand;
+  int lane = 0;
+  for (int64_t j = tid; j < V; j += blockDim.x) {
+    if (lane == 0) {
+      rand = curand_uniform4(&state);
+    }
+    const float r = (&rand.x)[lane];
+    lane = (lane + 1) % 4;
+    const float zj = z(j);
+    if (float_as_ordered(zj) < cutoff) {
+      continue;
+    }
+    // curand_uniform is in (0, 1]; clamp -log(r) away from zero so r == 1
+    // cannot produce an infinite score.
+    const float gumbel = -__logf(::max(-__logf(r), FLT_MIN));
+    const float score = (zj - m) + gumbel;
+    if (score > best_val || (score == best_val && j < best_idx)) {
+      best_val = score;
+      best_idx = j;
+    }
+  }
+
+  // Block argmax over (score, index) pairs; ties go to the lowest index so
+  // the result is deterministic for a fixed generator state.
+  const int lid = tid % C10_WARP_SIZE;
+  const int wid = tid / C10_WARP_SIZE;
+#pragma unroll
+  for (int offset = (C10_WARP_SIZE >> 1); offset > 0; offset >>= 1) {
+    const float other_val = WARP_SHFL_DOWN(best_val, offset);
+    const int64_t other_idx = WARP_SHFL_DOWN(best_idx, offset);
+    if (other_val > best_val ||
+        (other_val == best_val && other_idx < best_idx)) {
+      best_val = other_val;
+      best_idx = other_idx;
+    }
+  }
+  __syncthreads();
+  if (lid == 0) {
+    val_shared[wid] = best_val;
+    idx_shared[wid] = best_idx;
+  }
+  __syncthreads();
+  if (wid == 0) {
+    const int warps = blockDim.x / C10_WARP_SIZE;
+    best_val = lid < warps ? val_shared[lid] : -INFINITY;
+    best_idx = lid < warps ? idx_shared[lid] : int64_t{0};
+#pragma unroll
+    for (int offset = (C10_WARP_SIZE >> 1); offset > 0; offset >>= 1) {
+      const float other_val = WARP_SHFL_DOWN(best_val, offset);
+      const int64_t other_idx = WARP_SHFL_DOWN(best_idx, offset);
+      if (other_val > best_val ||
+          (other_val == best_val && other_idx < best_idx)) {
+        best_val = other_val;
+        best_idx = other_idx;
+      }
+    }
+    if (tid == 0) {
+      out[row] = best_idx;
+    }
+  }
+}
+
+} // namespace
+
+Tensor _fused_token_sample_cuda(
+    const Tensor& logits,
+    double temperature,
+    std::optional<int64_t> top_k,
+    std::optional<double> top_p,
+    std::optional<Generator> generator) {
+  TORCH_CHECK(
+      logits.dim() >= 1, "_fused_token_sample: logits must be at least 1-D");
+  TORCH_CHECK(
+      temperature > 0,
+      "_fused_token_sample: temperature must be positive, but got ",
+      temperature);
+  const int64_t V = logits.size(-1);
+  TORCH_CHECK(
+      V > 0, "_fused_token_sample: logits must have a non-empty last dim");
+
+  int64_t k = 0;
+  if (top_k.has_value()) {
+    TORCH_CHECK(
+        *top_k > 0,
+        "_fused_token_sample: top_k must be positive, but got ",
+        *top_k);
+    // top_k >= vocabulary size keeps everything.
+    k = *top_k < V ? *top_k : 0;
+  }
+  // A value > 1 disables the filter inside the kernel.
+  double p = 2.0;
+  if (top_p.has_value()) {
+    TORCH_CHECK(
+        *top_p > 0 && *top_p <= 1,
+        "_fused_token_sample: top_p must be in (0, 1], but got ",
+        *top_p);
+    p = *top_p < 1 ? *top_p : 2.0;
+  }
+
+  auto X = logits.expect_contiguous();
+  const int64_t n_rows = logits.numel() / V;
+  auto out_sizes = logits.sizes().vec();
+  out_sizes.pop_back();
+  Tensor out = at::empty(out_sizes, logits.options().dtype(kLong));
+  if (n_rows == 0) {
+    return out;
+  }
+
+  auto gen = get_generator_or_default<CUDAGeneratorImpl>(
+      generator, cuda::detail::getDefaultCUDAGenerator());
+  // One uniform per element assigned to a thread, drawn four at a time; the
+  // offset is counted in 32-bit values.
+  const int64_t counter_offset =
+      4 * ((V + 4 * kSampleBlockSize - 1) / (4 * kSampleBlockSize));
+  PhiloxCudaState rng_engine_inputs;
+  {
+    // See Note [Acquire lock when using random generators]
+    std::lock_guard<std::mutex> lock(gen->mutex_);
+    rng_engine_inputs = gen->philox_cuda_state(counter_offset);
+  }
+
+  cudaStream_t stream = at::cuda::getCurrentCUDAStream();
+  AT_DISPATCH_FLOATING_TYPES_AND2(
+      at::ScalarType::Half,
+      at::ScalarType::BFloat16,
+      X->scalar_type(),
+      "_fused_token_sample_cuda",
+      [&] {
+        fused_token_sample_kernel<scalar_t>
+            <<<n_rows, kSampleBlockSize, 0, stream>>>(
+                X->const_data_ptr<scalar_t>(),
+                V,
+                static_cast<float>(1.0 / temperature),
+                k,
+                static_cast<float>(p),
+                rng_engine_inputs,
+                out.mutable_data_ptr<int64_t>());
+        C10_CUDA_KERNEL_LAUNCH_CHECK();
+      });
+  return out;
+}
+
+} // namespace at::native
@@ -28,6 +28,8 @@
 #include <ATen/ops/zeros_like.h>
 #include <ATen/ops/ones_like.h>
 #include <ATen/ops/empty_quantized.h>
+#include <ATen/ops/_moe_combine_native.h>
+#include <ATen/ops/_moe_dispatch_native.h>
 #include <ATen/ops/index_add_native.h>
 #include <ATen/ops/index_reduce_native.h>
 #include <ATen/ops/index_select_native.h>
@@ -138,10 +140,25 @@ __global__ void indexing_backward_kernel_stride_1(
     if ((idx < numel) &&
         (idx == 0 || crnt_sorted_idx != sorted_indices[idx - 1]))
     {
-      // Determine the number of duplicates in advance
+      // Determine the number of duplicates in advance. The branch above is
+      // warp-uniform (it does not depend on threadIdx.x), so all lanes scan
+      // the run cooperatively: each lane probes one element per round and a
+      // ballot counts how much of the run is left, instead of every lane
+      // issuing one serial global read per duplicate. At high duplicate
+      // rates the serial scan dominates this kernel.
+      int laneIdx = threadIdx.x % C10_WARP_SIZE;
       int64_t num_duplicates = 1;
-      while (((idx + num_duplicates) < numel) && (sorted_indices[idx + num_duplicates] == crnt_sorted_idx)) {
-        num_duplicates++;
+      while ((idx + num_duplicates) < numel) {
+        const int64_t probe = idx + num_duplicates + laneIdx;
+        const int same =
+            (probe < numel) && (sorted_indices[probe] == crnt_sorted_idx);
+        const int run_left = __popcll(
+            static_cast<unsigned long long>(WARP_BALLOT(same)));
+        num_duplicates += run_left;
+        // The run ends inside this warp-sized window.
+        if (run_left != C10_WARP_SIZE) {
+          break;
+        }
       }
 
       // Continue computing weights
@@ -156,7 +173,6 @@ __global__ void indexing_backward_kernel_stride_1(
       } else {
         opmath_t gradient = (opmath_t)0.0;
 
-        int laneIdx = threadIdx.x % C10_WARP_SIZE;
         int64_t num_warp_passes = num_duplicates / C10_WARP_SIZE;
         for (int64_t i = 0; i < num_warp_passes; ++i) {
             grad_row = ((int64_t) indices[idx + i * C10_WARP_SIZE + laneIdx]) * stride + z * numel * stride;
@@ -585,6 +601,108 @@ void index_put_with_sort_kernel(Tensor & self, const c10::List<std::optional<Ten
 
 REGISTER_CUDA_DISPATCH(index_put_with_sort_stub, &index_put_with_sort_kernel);
 
+// Deterministic scatter_add: sort the linear destination index of every src
+// element with cub, then segment-sum duplicates so each output location is
+// written exactly once, in a fixed order. Unlike routing through
+// _scatter_via_index_put, the linear index is built directly from the output
+// strides with one broadcast add per dimension instead of materializing a
+// [numel, ndim] coordinate tensor and re-deriving it inside index_put.
+void scatter_add_with_sort_kernel(const Tensor& self, int64_t dim, const Tensor& index, const Tensor& src) {
+  const int64_t num_indices = index.numel();
+  if (num_indices == 0) {
+    return;
+  }
+  bool self_contiguous = self.is_contiguous();
+  auto self_ = self_contiguous ? self : self.contiguous();
+
+  // scatter_add only reads the leading index.size(d) elements of src along
+  // each dimension.
+  Tensor src_ = src;
+  for (const auto d: c10::irange(src.dim())) {
+    if (index.size(d) != src_.size(d)) {
+      src_ = src_.narrow(d, 0, index.size(d));
+    }
+  }
+  src_ = src_.contiguous();
+
+  // scatter_add requires 0 <= index < self.size(dim)
+  at::_assert_async(index.max() < self_.size(dim));
+  at::_assert_async(index.min() >= 0);
+
+  // Linear destination of each src element in the contiguous output:
+  // index * stride(dim) plus the element's own offset in every other
+  // dimension.
+  Tensor linearIndex = index.mul(self_.stride(dim));
+  for (const auto d: c10::irange(self_.dim())) {
+    if (d == dim || index.size(d) == 1) {
+      continue;
+    }
+    auto shape = std::vector<int64_t>(index.dim(), 1);
+    shape[d] = index.size(d);
+    linearIndex.add_(at::arange(index.size(d), linearIndex.options())
+                         .mul_(self_.stride(d))
+                         .view(shape));
+  }
+  linearIndex = linearIndex.reshape(-1).contiguous();
+
+  auto sorted_indices = at::empty_like(linearIndex, LEGACY_CONTIGUOUS_MEMORY_FORMAT);
+  auto orig_indices = at::empty_like(linearIndex, LEGACY_CONTIGUOUS_MEMORY_FORMAT);
+  const cudaStream_t stream = at::cuda::getCurrentCUDAStream();
+
+#if (defined(CUDA_VERSION) && CUDA_VERSION < 11030) || defined(USE_ROCM)
+  if (num_indices < 50000) {
+    index_put_with_sort_kernel_thrust_helper(linearIndex, orig_indices, sorted_indices, num_indices);
+  } else
+#endif
+  {
+    auto range = at::arange(num_indices, linearIndex.options());
+    // linearIndex can not be negative, and we take advantage of this
+    // fact to sort on less bits for better performance.
+    int64_t nbits = cuda::cub::get_num_bits(largestIndex(self_));
+    cuda::cub::radix_sort_pairs(
+      linearIndex.const_data_ptr<int64_t>(), sorted_indices.mutable_data_ptr<int64_t>(),
+      range.const_data_ptr<int64_t>(), orig_indices.mutable_data_ptr<int64_t>(),
+      num_indices, false, 0, nbits);
+  }
+
+  // Per-element destinations are equivalent to an index_put with sliceSize 1;
+  // the stride-1 kernel reduces duplicate destinations warp-parallel before
+  // its single write.
+  const int indices_per_block = 4;
+  const int warp_size = at::cuda::warp_size();
+  dim3 grid(ceil_div(num_indices, (int64_t) indices_per_block), 1, 1);
+  dim3 block(warp_size, indices_per_block);
+
+  AT_DISPATCH_V2(
+    src_.scalar_type(),
+    "scatter_add_with_sort",
+    AT_WRAP([&] {
+      indexing_backward_kernel_stride_1<scalar_t><<<grid, block, 0, stream>>>(
+        sorted_indices.const_data_ptr<int64_t>(),
+        orig_indices.const_data_ptr<int64_t>(),
+        src_.const_data_ptr<scalar_t>(),
+        self_.mutable_data_ptr<scalar_t>(),
+        num_indices,
+        /*stride=*/1,
+        /*stride_before=*/0,
+        /*outer_dim=*/1,
+        /*accumulate=*/true);
+      C10_CUDA_KERNEL_LAUNCH_CHECK();
+    }),
+    AT_EXPAND(AT_ALL_TYPES_AND_COMPLEX),
+    AT_EXPAND(AT_FLOAT8_TYPES),
+    kComplexHalf,
+    kHalf,
+    kBool,
+    kBFloat16);
+
+  if (!self_contiguous) {
+    self.copy_(self_);
+  }
+}
+
+REGISTER_CUDA_DISPATCH(scatter_add_with_sort_stub, &scatter_add_with_sort_kernel);
+
 void index_put_with_sort_quantized(Tensor & self, const c10::List<std::optional<Tensor>>& indices, const Tensor & value, double scale, int zero_point, bool unsafe) {
   if (indices.size() > (size_t)self.dim()) {
     TORCH_CHECK_INDEX(false, "too many indices for tensor of dimension ", self.dim(), " (got ", indices.size(), ")");
@@ -1822,5 +1940,138 @@ Tensor index_select_sparse_cuda(const Tensor& self, int64_t dim, const Tensor& i
   }
 }
 
+namespace {
+
+constexpr int kMoEBlockThreads = 256;
+
+// One block per output row; threads stride over the hidden dimension.
+// Rows are fully coalesced on both the load and the store side because
+// the dispatch order is contiguous in the output.
+template <typename scalar_t, typename index_t>
+__global__ void moe_dispatch_kernel(
+    const scalar_t* __restrict__ tokens,
+    const index_t* __restrict__ row_indices,
+    scalar_t* __restrict__ out,
+    int64_t num_out_rows,
+    int64_t num_in_rows,
+    int64_t hidden) {
+  for (int64_t row = blockIdx.x; row < num_out_rows; row += gridDim.x) {
+    const index_t src_row = row_indices[row];
+    CUDA_KERNEL_ASSERT(src_row >= 0 && src_row < num_in_rows);
+    const scalar_t* src = tokens + src_row * hidden;
+    scalar_t* dst = out + row * hidden;
+    for (int64_t i = threadIdx.x; i < hidden; i += blockDim.x) {
+      dst[i] = src[i];
+    }
+  }
+}
+
+// One block per token; each thread accumulates the top_k weighted rows
+// for its hidden elements in opmath precision. The token owns its output
+// row exclusively, so no atomics are needed and the result is
+// deterministic.
+template <typename scalar_t, typename index_t>
+__global__ void moe_combine_kernel(
+    const scalar_t* __restrict__ expert_rows,
+    const index_t* __restrict__ row_indices,
+    const scalar_t* __restrict__ combine_weights,
+    scalar_t* __restrict__ out,
+    int64_t num_tokens,
+    int64_t num_expert_rows,
+    int64_t top_k,
+    int64_t hidden) {
+  using opmath_t = at::opmath_type<scalar_t>;
+  for (int64_t token = blockIdx.x; token < num_tokens; token += gridDim.x) {
+    for (int64_t i = threadIdx.x; i < hidden; i += blockDim.x) {
+      opmath_t acc = 0;
+      for (int64_t j = 0; j < top_k; ++j) {
+        const index_t src_row = row_indices[token * top_k + j];
+        CUDA_KERNEL_ASSERT(src_row >= 0 && src_row < num_expert_rows);
+        acc += static_cast<opmath_t>(combine_weights[token * top_k + j]) *
+            static_cast<opmath_t>(expert_rows[src_row * hidden + i]);
+      }
+      out[token * hidden + i] = static_cast<scalar_t>(acc);
+    }
+  }
+}
+
+} // anonymous namespace
+
+Tensor _moe_dispatch_cuda(const Tensor& self, const Tensor& row_indices) {
+  TORCH_CHECK(self.dim() == 2,
+      "_moe_dispatch: expected a 2-D token tensor, got ", self.dim(), "-D");
+  TORCH_CHECK(row_indices.dim() == 1,
+      "_moe_dispatch: expected 1-D row indices, got ", row_indices.dim(), "-D");
+  auto tokens = self.contiguous();
+  auto indices = row_indices.contiguous();
+  const int64_t num_out_rows = indices.numel();
+  const int64_t hidden = tokens.size(1);
+  Tensor out = at::empty({num_out_rows, hidden}, tokens.options());
+  if (out.numel() == 0) {
+    return out;
+  }
+  const int64_t grid = std::min<int64_t>(
+      num_out_rows, at::cuda::getCurrentDeviceProperties()->maxGridSize[0]);
+  const cudaStream_t stream = at::cuda::getCurrentCUDAStream();
+  AT_DISPATCH_FLOATING_TYPES_AND2(
+      at::ScalarType::Half, at::ScalarType::BFloat16,
+      tokens.scalar_type(), "_moe_dispatch_cuda", [&] {
+    AT_DISPATCH_INDEX_TYPES(indices.scalar_type(), "_moe_dispatch_cuda", [&] {
+      moe_dispatch_kernel<scalar_t, index_t><<<grid, kMoEBlockThreads, 0, stream>>>(
+          tokens.const_data_ptr<scalar_t>(),
+          indices.const_data_ptr<index_t>(),
+          out.mutable_data_ptr<scalar_t>(),
+          num_out_rows,
+          tokens.size(0),
+          hidden);
+      C10_CUDA_KERNEL_LAUNCH_CHECK();
+    });
+  });
+  return out;
+}
+
+Tensor _moe_combine_cuda(const Tensor& self, const Tensor& row_indices, const Tensor& combine_weights) {
+  TORCH_CHECK(self.dim() == 2,
+      "_moe_combine: expected a 2-D expert output tensor, got ", self.dim(), "-D");
+  TORCH_CHECK(row_indices.dim() == 2,
+      "_moe_combine: expected [num_tokens, top_k] row indices, got ",
+      row_indices.dim(), "-D");
+  TORCH_CHECK(row_indices.sizes() == combine_weights.sizes(),
+      "_moe_combine: row_indices and combine_weights must have the same shape, got ",
+      row_indices.sizes(), " and ", combine_weights.sizes());
+  TORCH_CHECK(combine_weights.scalar_type() == self.scalar_type(),
+      "_moe_combine: combine_weights must match the expert output dtype, got ",
+      combine_weights.scalar_type(), " and ", self.scalar_type());
+  auto expert_rows = self.contiguous();
+  auto indices = row_indices.contiguous();
+  auto weights = combine_weights.contiguous();
+  const int64_t num_tokens = indices.size(0);
+  const int64_t top_k = indices.size(1);
+  const int64_t hidden = expert_rows.size(1);
+  Tensor out = at::empty({num_tokens, hidden}, expert_rows.options());
+  if (out.numel() == 0) {
+    return out;
+  }
+  const int64_t grid = std::min<int64_t>(
+      num_tokens, at::cuda::getCurrentDeviceProperties()->maxGridSize[0]);
+  const cudaStream_t stream = at::cuda::getCurrentCUDAStream();
+  AT_DISPATCH_FLOATING_TYPES_AND2(
+      at::ScalarType::Half, at::ScalarType::BFloat16,
+      expert_rows.scalar_type(), "_moe_combine_cuda", [&] {
+    AT_DISPATCH_INDEX_TYPES(indices.scalar_type(), "_moe_combine_cuda", [&] {
+      moe_combine_kernel<scalar_t, index_t><<<grid, kMoEBlockThreads, 0, stream>>>(
+          expert_rows.const_data_ptr<scalar_t>(),
+          indices.const_data_ptr<index_t>(),
+          weights.const_data_ptr<scalar_t>(),
+          out.mutable_data_ptr<scalar_t>(),
+          num_tokens,
+          expert_rows.size(0),
+          top_k,
+          hidden);
+      C10_CUDA_KERNEL_LAUNCH_CHECK();
+    });
+  });
+  return out;
+}
 
 } // at::native
@@ -2,6 +2,7 @@
 #include <ATen/core/Tensor.h>
 #include <ATen/AccumulateType.h>
 #include <ATen/Dispatch.h>
+#include <ATen/OpMathType.h>
 #include <ATen/cuda/detail/KernelUtils.h>
 #include <ATen/native/TensorIterator.h>
 #include <ATen/TensorUtils.h>
@@ -16,8 +17,11 @@
 #include <ATen/Functions.h>
 #include <ATen/NativeFunctions.h>
 #else
+#include <ATen/ops/_fused_cross_entropy_loss_backward_native.h>
+#include <ATen/ops/_fused_cross_entropy_loss_native.h>
 #include <ATen/ops/binary_cross_entropy_backward_native.h>
 #include <ATen/ops/binary_cross_entropy_native.h>
+#include <ATen/ops/empty.h>
 #include <ATen/ops/empty_like.h>
 #include <ATen/ops/exp.h>
 #include <ATen/ops/nll_loss_backward_native.h>
@@ -623,4 +627,180 @@ TORCH_IMPL_FUNC(nll_loss_backward_out_cuda)
       reduction,
       ignore_index);
 }
+
+// Fused cross entropy: computes per-sample loss and logsumexp by streaming
+// over the class dimension, one block per sample, without materializing the
+// [batch, n_classes] log probabilities.
+
+constexpr int FUSED_CROSS_ENTROPY_THREADS = 256;
+
+template <typename scalar_t, typename accscalar_t>
+__global__ void fused_cross_entropy_forward_cuda_kernel(
+    scalar_t* output,
+    accscalar_t* logsumexp,
+    const scalar_t* input,
+    const int64_t* target,
+    int64_t n_classes,
+    int64_t ignore_index) {
+  __shared__ accscalar_t sh_acc[FUSED_CROSS_ENTROPY_THREADS];
+
+  const int64_t i = blockIdx.x;
+  const int64_t t = target[i];
+  if (t == ignore_index) {
+    if (threadIdx.x == 0) {
+      output[i] = static_cast<scalar_t>(0);
+      logsumexp[i] = static_cast<accscalar_t>(0);
+    }
+    return;
+  }
+  CHECK_INDEX_IN_CLASS(t, n_classes);
+  const scalar_t* row = input + i * n_classes;
+
+  accscalar_t thread_max = -std::numeric_limits<accscalar_t>::infinity();
+  for (int64_t j = threadIdx.x; j < n_classes; j += blockDim.x) {
+    thread_max = ::max(thread_max, static_cast<accscalar_t>(row[j]));
+  }
+  sh_acc[threadIdx.x] = thread_max;
+  __syncthreads();
+  for (int s = blockDim.x / 2; s > 0; s >>= 1) {
+    if (threadIdx.x < s) {
+      sh_acc[threadIdx.x] = ::max(sh_acc[threadIdx.x], sh_acc[threadIdx.x + s]);
+    }
+    __syncthreads();
+  }
+  const accscalar_t row_max = sh_acc[0];
+  __syncthreads();
+
+  accscalar_t thread_sum = 0;
+  for (int64_t j = threadIdx.x; j < n_classes; j += blockDim.x) {
+    thread_sum += ::exp(static_cast<accscalar_t>(row[j]) - row_max);
+  }
+  sh_acc[threadIdx.x] = thread_sum;
+  __syncthreads();
+  for (int s = blockDim.x / 2; s > 0; s >>= 1) {
+    if (threadIdx.x < s) {
+      sh_acc[threadIdx.x] += sh_acc[threadIdx.x + s];
+    }
+    __syncthreads();
+  }
+
+  if (threadIdx.x == 0) {
+    const accscalar_t lse = row_max + ::log(sh_acc[0]);
+    logsumexp[i] = lse;
+    output[i] = static_cast<scalar_t>(lse - static_cast<accscalar_t>(row[t]));
+  }
+}
+
+template <typename scalar_t, typename accscalar_t>
+__global__ void fused_cross_entropy_backward_cuda_kernel(
+    scalar_t* grad_input,
+    const scalar_t* grad_output,
+    const scalar_t* input,
+    const int64_t* target,
+    const accscalar_t* logsumexp,
+    int64_t n_classes,
+    int64_t ignore_index) {
+  const int64_t i = blockIdx.x;
+  const int64_t t = target[i];
+  scalar_t* grad_row = grad_input + i * n_classes;
+  if (t == ignore_index) {
+    for (int64_t j = threadIdx.x; j < n_classes; j += blockDim.x) {
+      grad_row[j] = static_cast<scalar_t>(0);
+    }
+    return;
+  }
+  const scalar_t* row = input + i * n_classes;
+  const accscalar_t go = static_cast<accscalar_t>(grad_output[i]);
+  const accscalar_t lse = logsumexp[i];
+  for (int64_t j = threadIdx.x; j < n_classes; j += blockDim.x) {
+    accscalar_t grad = go * ::exp(static_cast<accscalar_t>(row[j]) - lse);
+    if (j == t) {
+      grad -= go;
+    }
+    grad_row[j] = static_cast<scalar_t>(grad);
+  }
+}
+
+std::tuple<Tensor, Tensor> _fused_cross_entropy_loss_cuda(
+    const Tensor& self,
+    const Tensor& target,
+    int64_t ignore_index) {
+  TORCH_CHECK(self.dim() == 2, "_fused_cross_entropy_loss: input tensor should be 2D");
+  TORCH_CHECK(
+      target.dim() == 1 && target.size(0) == self.size(0),
+      "_fused_cross_entropy_loss: size mismatch (got input: ",
+      self.sizes(),
+      ", target: ",
+      target.sizes(),
+      ")");
+  auto input = self.contiguous();
+  auto target_ = target.contiguous();
+  const int64_t batch_size = input.size(0);
+  Tensor output = at::empty({batch_size}, input.options());
+  Tensor logsumexp = at::empty(
+      {batch_size}, input.options().dtype(toOpMathType(input.scalar_type())));
+  if (batch_size == 0) {
+    return std::make_tuple(std::move(output), std::move(logsumexp));
+  }
+  AT_DISPATCH_FLOATING_TYPES_AND2(
+      at::ScalarType::Half,
+      at::ScalarType::BFloat16,
+      input.scalar_type(),
+      "_fused_cross_entropy_loss_cuda",
+      [&] {
+        using accscalar_t = at::acc_type<scalar_t, /*is_cuda*/true>;
+        fused_cross_entropy_forward_cuda_kernel<scalar_t, accscalar_t>
+            <<<batch_size,
+               FUSED_CROSS_ENTROPY_THREADS,
+               0,
+               at::cuda::getCurrentCUDAStream()>>>(
+                output.mutable_data_ptr<scalar_t>(),
+                logsumexp.mutable_data_ptr<accscalar_t>(),
+                input.const_data_ptr<scalar_t>(),
+                target_.const_data_ptr<int64_t>(),
+                input.size(1),
+                ignore_index);
+        C10_CUDA_KERNEL_LAUNCH_CHECK();
+      });
+  return std::make_tuple(std::move(output), std::move(logsumexp));
+}
+
+Tensor _fused_cross_entropy_loss_backward_cuda(
+    const Tensor& grad_output,
+    const Tensor& self,
+    const Tensor& target,
+    const Tensor& logsumexp,
+    int64_t ignore_index) {
+  auto input = self.contiguous();
+  auto target_ = target.contiguous();
+  auto grad_output_ = grad_output.contiguous();
+  auto lse = logsumexp.contiguous();
+  const int64_t batch_size = input.size(0);
+  Tensor grad_input = at::empty_like(input);
+  if (batch_size == 0) {
+    return grad_input;
+  }
+  AT_DISPATCH_FLOATING_TYPES_AND2(
+      at::ScalarType::Half,
+      at::ScalarType::BFloat16,
+      input.scalar_type(),
+      "_fused_cross_entropy_loss_backward_cuda",
+      [&] {
+        using accscalar_t = at::acc_type<scalar_t, /*is_cuda*/true>;
+        fused_cross_entropy_backward_cuda_kernel<scalar_t, accscalar_t>
+            <<<batch_size,
+               FUSED_CROSS_ENTROPY_THREADS,
+               0,
+               at::cuda::getCurrentCUDAStream()>>>(
+                grad_input.mutable_data_ptr<scalar_t>(),
+                grad_output_.const_data_ptr<scalar_t>(),
+                input.const_data_ptr<scalar_t>(),
+                target_.const_data_ptr<int64_t>(),
+                lse.const_data_ptr<accscalar_t>(),
+                input.size(1),
+                ignore_index);
+        C10_CUDA_KERNEL_LAUNCH_CHECK();
+      });
+  return grad_input;
+}
 }  // namespace at::native
@@ -7,12 +7,15 @@
 #include <ATen/cuda/detail/KernelUtils.h>
 #include <ATen/cuda/detail/OffsetCalculator.cuh> //for MAX_DIMS
 #include <ATen/cuda/cub.cuh>
+#include <ATen/MemoryOverlap.h>
+#include <ATen/native/Resize.h>
 
 #ifndef AT_PER_OPERATOR_HEADERS
 #include <ATen/NativeFunctions.h>
 #else
 #include <ATen/ops/empty_native.h>
 #include <ATen/ops/nonzero_native.h>
+#include <ATen/ops/nonzero_static_native.h>
 #endif
 
 
@@ -54,6 +57,58 @@ __global__ void write_indices(
   }
 }
 
+//nonzero_static kernels: the output capacity is fixed up front, so the row of
+//every nonzero element is known from an exclusive prefix sum of the flags and
+//no device-to-host copy of the total count is needed.
+template <typename scalar_t>
+__global__ void write_static_indices(
+    const scalar_t* inp,
+    const int* scan,
+    int64_t* out,
+    TensorDims<int> dims,
+    int ndim,
+    int n,
+    int64_t size) {
+  auto index = threadIdx.x + blockIdx.x * blockDim.x;
+  if (index < n && NonZeroOp<scalar_t>()(inp[index])) {
+    int64_t row = scan[index];
+    if (row < size) {
+      int div = 1;
+#pragma unroll
+      for (int dim = MAX_DIMS; dim >= 0; dim--) {
+        if (dim > ndim - 1)
+          continue;
+        auto dim_size = dims.sizes[dim];
+        out[row * ndim + dim] = (index / div) % dim_size;
+        div *= dim_size;
+      }
+    }
+  }
+}
+
+template <typename scalar_t>
+__global__ void fill_static_tail(
+    const scalar_t* inp,
+    const int* scan,
+    int64_t* out,
+    int ndim,
+    int n,
+    int64_t size,
+    int64_t fill_value) {
+  int64_t row = threadIdx.x + static_cast<int64_t>(blockIdx.x) * blockDim.x;
+  if (row >= size) {
+    return;
+  }
+  //recover the total count from the exclusive scan instead of syncing on it
+  int64_t total =
+      n > 0 ? scan[n - 1] + (NonZeroOp<scalar_t>()(inp[n - 1]) ? 1 : 0) : 0;
+  if (row >= total) {
+    for (int dim = 0; dim < ndim; dim++) {
+      out[row * ndim + dim] = fill_value;
+    }
+  }
+}
+
 } //anonymous namespace
 
 template<typename scalar_t>
@@ -127,4 +182,112 @@ Tensor nonzero_cuda(const Tensor& self){
   Tensor out = at::detail::empty_cuda({0}, self.options().dtype(kLong));
   return at::native::nonzero_out_cuda(self, out);
 }
+
+template <typename scalar_t>
+void nonzero_static_cuda_out_impl(
+    const Tensor& self,
+    int64_t size,
+    int64_t fill_value,
+    Tensor& out) {
+  Tensor self_ = self.contiguous();
+  int N = self_.numel();
+  const int ndim = self.dim();
+  const cudaStream_t stream = at::cuda::getCurrentCUDAStream();
+  auto& allocator = *c10::cuda::CUDACachingAllocator::get();
+  //exclusive prefix sum of the nonzero flags; scan[i] is the output row of
+  //element i, and scan[N-1] plus the last flag recovers the total count on
+  //device, so unlike nonzero no host synchronization is needed
+  auto scan = allocator.allocate(sizeof(int) * N);
+  const scalar_t* self_data = self_.const_data_ptr<scalar_t>();
+  if (N > 0) {
+    cub::TransformInputIterator<int, NonZeroOp<scalar_t>, const scalar_t*> itr(
+        self_data, NonZeroOp<scalar_t>());
+    size_t temp_storage_bytes = 0;
+    cub::DeviceScan::ExclusiveSum(
+        nullptr, temp_storage_bytes, itr, (int*)scan.get(), N, stream);
+    auto temp_storage = allocator.allocate(temp_storage_bytes);
+    cub::DeviceScan::ExclusiveSum(
+        temp_storage.get(), temp_storage_bytes, itr, (int*)scan.get(), N, stream);
+  }
+  //out is guaranteed {size, ndim} by the wrapper; only its strides may differ
+  bool need_to_copy = !out.is_contiguous();
+  Tensor out_temp = need_to_copy
+      ? Tensor(at::detail::empty_cuda({size, ndim}, out.options()))
+      : out;
+  int64_t* out_data = out_temp.mutable_data_ptr<int64_t>();
+  const int nthreads = 256;
+  if (N > 0) {
+    TensorDims<int> dims;
+    for (int i = 0; i < ndim; i++) {
+      dims.sizes[i] = self.sizes()[i];
+    }
+    const int nblocks = (N + nthreads - 1) / nthreads;
+    write_static_indices<<<nblocks, nthreads, 0, stream>>>(
+        self_data, (const int*)scan.get(), out_data, dims, ndim, N, size);
+    C10_CUDA_KERNEL_LAUNCH_CHECK();
+  }
+  const int64_t tail_blocks = (size + nthreads - 1) / nthreads;
+  fill_static_tail<<<tail_blocks, nthreads, 0, stream>>>(
+      self_data, (const int*)scan.get(), out_data, ndim, N, size, fill_value);
+  C10_CUDA_KERNEL_LAUNCH_CHECK();
+  if (need_to_copy) {
+    out.copy_(out_temp);
+  }
+}
+
+Tensor& nonzero_static_out_cuda(
+    const Tensor& self,
+    int64_t size,
+    int64_t fill_value,
+    Tensor& out) {
+  TORCH_CHECK(
+      size >= 0, "nonzero_static: 'size' must be an non-negative integer");
+  TORCH_CHECK(
+      self.numel() < std::numeric_limits<int>::max(),
+      "nonzero_static is not supported for tensors with more than INT_MAX elements");
+  TORCH_CHECK(
+      out.dtype() == at::kLong,
+      "nonzero_static: Expected out tensor to have scalar type Long "
+      "but got scalar type",
+      out.dtype());
+  TORCH_CHECK(
+      self.device() == out.device(),
+      "expected self and out to be on the same device, but got out on ",
+      out.device(),
+      " and self on ",
+      self.device());
+  TORCH_CHECK(
+      self.dim() <= MAX_DIMS,
+      "nonzero_static is not supported for tensor with more than ",
+      MAX_DIMS,
+      " dimensions");
+  int64_t ndim = self.dim();
+  if (out.dim() != 2 || out.size(0) != size || out.size(1) != ndim) {
+    at::native::resize_output(out, {size, ndim});
+  }
+  at::assert_no_internal_overlap(out);
+  at::assert_no_overlap(out, self);
+  if (out.size(0) == 0 || out.size(1) == 0) {
+    return out;
+  }
+  AT_DISPATCH_ALL_TYPES_AND_COMPLEX_AND4(
+      at::ScalarType::ComplexHalf,
+      at::ScalarType::Bool,
+      at::ScalarType::BFloat16,
+      at::ScalarType::Half,
+      self.scalar_type(),
+      "nonzero_static_cuda",
+      [&] { nonzero_static_cuda_out_impl<scalar_t>(self, size, fill_value, out); });
+  return out;
+}
+
+Tensor nonzero_static_cuda(
+    const Tensor& self,
+    int64_t size,
+    int64_t fill_value) {
+  Tensor out = at::detail::empty_cuda(
+      {size, self.dim()}, self.options().dtype(kLong));
+  at::native::nonzero_static_out_cuda(self, size, fill_value, out);
+  return out;
+}
 } //namespace at::native
@@ -65,7 +65,7 @@ __device__ __forceinline__ void warp_reduce(acc_t* sum) {
 // input_t_float, acc_t=float, output_t=half  => read float tensor, float accumulators, write half tensor.
 
 template <typename input_t, typename output_t, typename acc_t, int log2_elements, bool is_log_softmax, bool is_masked>
-__global__ void softmax_warp_forward(output_t *dst, const input_t *src, int batch_size, int stride, int element_count, const bool *mask = nullptr, const int head_chunk_size = -1, bool is_transformer_mask = false)
+__global__ void softmax_warp_forward(output_t *dst, const input_t *src, int batch_size, int stride, int element_count, const bool *mask = nullptr, const int head_chunk_size = -1, bool is_transformer_mask = false, bool is_per_batch_mask = false)
 {
     // WARP_SIZE and WARP_BATCH must match the return values batches_per_warp and warp_size of method warp_softmax_forward_kernel.
     constexpr int next_power_of_two = 1 << log2_elements;
@@ -90,6 +90,15 @@ __global__ void softmax_warp_forward(output_t *dst, const input_t *src, int batc
 
     if (is_transformer_mask) {
         mask += ((first_batch * stride) / head_chunk_size) * stride + local_idx;
+    } else if (is_per_batch_mask) {
+        // Mask of shape [B, S, S] broadcast over the head dimension of a
+        // [B, H, S, S] input (head_chunk_size is H * S * S). The mask row
+        // advances with the data row by `stride` within a warp batch, exactly
+        // like the full-shape mask, so only the base offset differs. Callers
+        // guarantee warp batches never straddle a row wrap (S even when
+        // batches_per_warp is 2).
+        mask += (((first_batch * stride) / head_chunk_size) * element_count +
+                 (first_batch % element_count)) * stride + local_idx;
     } else {
         mask += idx_offset;
     }
@@ -300,7 +309,7 @@ __global__ void softmax_warp_backward(output_t *gradInput, const input_t *grad,
 } // end of anonymous namespace
 
 template<typename input_t, typename output_t, typename acc_t, bool is_log_softmax, bool is_masked>
-void dispatch_softmax_forward(output_t *dst, const input_t *src, int softmax_elements, int softmax_elements_stride, int batch_count, const bool *mask = nullptr, int chunk_size = -1, bool is_transformer_mask = false)
+void dispatch_softmax_forward(output_t *dst, const input_t *src, int softmax_elements, int softmax_elements_stride, int batch_count, const bool *mask = nullptr, int chunk_size = -1, bool is_transformer_mask = false, bool is_per_batch_mask = false)
 {
     TORCH_INTERNAL_ASSERT( softmax_elements >= 0 && softmax_elements <= 1024 );
     if (softmax_elements == 0) {
@@ -328,7 +337,7 @@ void dispatch_softmax_forward(output_t *dst, const input_t *src, int softmax_ele
             #define LAUNCH_SOFTMAX_WARP_FORWARD(L2E) case L2E:                    \
             softmax_warp_forward<input_t, output_t, acc_t, L2E, is_log_softmax, is_masked>   \
                 <<<blocks, threads, 0, at::cuda::getCurrentCUDAStream()>>>(dst,   \
-                    src, batch_count, softmax_elements_stride, softmax_elements, mask, chunk_size, is_transformer_mask); \
+                    src, batch_count, softmax_elements_stride, softmax_elements, mask, chunk_size, is_transformer_mask, is_per_batch_mask); \
             C10_CUDA_KERNEL_LAUNCH_CHECK();                                       \
             break;
 
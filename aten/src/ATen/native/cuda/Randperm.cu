@@ -2,14 +2,19 @@
 #include <ATen/core/Tensor.h>
 #include <ATen/Dispatch.h>
 #include <ATen/cuda/CUDAContext.h>
+#include <ATen/cuda/CUDAGeneratorImpl.h>
+#include <ATen/cuda/CUDAGraphsUtils.cuh>
 #include <ATen/native/TensorFactories.h>
 #include <ATen/cuda/cub.h>
 #include <ATen/native/cuda/Randperm.cuh>
+#include <c10/util/irange.h>
+#include <curand_kernel.h>
 
 #ifndef AT_PER_OPERATOR_HEADERS
 #include <ATen/Functions.h>
 #include <ATen/NativeFunctions.h>
 #else
+#include <ATen/ops/_randperm_batched_native.h>
 #include <ATen/ops/arange.h>
 #include <ATen/ops/empty.h>
 #include <ATen/ops/empty_like.h>
@@ -130,4 +135,111 @@ Tensor& randperm_out_cuda(int64_t n, std::optional<Generator> generator, Tensor&
   return result;
 }
 
+namespace {
+
+// One permutation per block: the indices are staged in shared memory, the
+// leader thread runs a serial Fisher-Yates shuffle on them, and all threads
+// write the row out coalesced. Each block draws from its own Philox
+// subsequence, so the permutations are independent and the batch needs a
+// single launch (and a single generator state reservation) instead of one
+// sort pipeline per permutation. Swap targets are picked by the multiply-
+// shift trick; the leftover bias is at most n / 2^32 per draw, which is
+// orders of magnitude below the duplicate-key threshold the sort-based
+// randperm already tolerates.
+constexpr int kBatchedRandpermBlockSize = 256;
+
+__global__ void randperm_batched_kernel(
+    int64_t* out,
+    int64_t n,
+    PhiloxCudaState philox_args) {
+  extern __shared__ int32_t perm[];
+  const int64_t batch_idx = blockIdx.x;
+  int64_t* out_row = out + batch_idx * n;
+
+  for (int64_t i = threadIdx.x; i < n; i += blockDim.x) {
+    perm[i] = static_cast<int32_t>(i);
+  }
+  __syncthreads();
+
+  if (threadIdx.x == 0) {
+    auto seeds = at::cuda::philox::unpack(philox_args);
+    curandStatePhilox4_32_10_t state;
+    curand_init(std::get<0>(seeds), batch_idx, std::get<1>(seeds), &state);
+    for (int64_t i = n - 1; i > 0; --i) {
+      const auto r = static_cast<int64_t>(
+          (static_cast<uint64_t>(curand(&state)) * (i + 1)) >> 32);
+      const int32_t tmp = perm[i];
+      perm[i] = perm[r];
+      perm[r] = tmp;
+    }
+  }
+  __syncthreads();
+
+  for (int64_t i = threadIdx.x; i < n; i += blockDim.x) {
+    out_row[i] = perm[i];
+  }
+}
+
+} // namespace
+
+Tensor _randperm_batched_cuda(
+    int64_t n,
+    int64_t batch,
+    std::optional<Generator> generator,
+    std::optional<ScalarType> dtype,
+    std::optional<Layout> layout,
+    std::optional<Device> device,
+    std::optional<bool> pin_memory) {
+  TORCH_CHECK(n >= 0, "n must be non-negative, got ", n);
+  TORCH_CHECK(batch >= 0, "batch must be non-negative, got ", batch);
+  auto options = TensorOptions()
+                     .dtype(dtype.value_or(kLong))
+                     .layout(layout)
+                     .device(device)
+                     .pinned_memory(pin_memory);
+  TORCH_CHECK(
+      options.dtype() == kLong,
+      "_randperm_batched only supports int64 output, got ",
+      options.dtype());
+
+  Tensor result = at::empty({batch, n}, options);
+  if (n == 0 || batch == 0) {
+    return result;
+  }
+
+  // The per-block shuffle stages the permutation in shared memory; larger
+  // permutations fall back to one sort-based randperm per row.
+  const int64_t max_shared_n =
+      at::cuda::getCurrentDeviceProperties()->sharedMemPerBlock /
+      sizeof(int32_t);
+  if (n > max_shared_n) {
+    for (const auto b : c10::irange(batch)) {
+      auto row = result.select(0, b);
+      at::native::randperm_out_cuda(n, generator, row);
+    }
+    return result;
+  }
+
+  auto gen = get_generator_or_default<CUDAGeneratorImpl>(
+      generator, cuda::detail::getDefaultCUDAGenerator());
+  // The leader thread draws one 32-bit value per swap from its block's
+  // subsequence, four at a time.
+  const int64_t counter_offset = 4 * ((n + 3) / 4);
+  PhiloxCudaState rng_engine_inputs;
+  {
+    // See Note [Acquire lock when using random generators]
+    std::lock_guard<std::mutex> lock(gen->mutex_);
+    rng_engine_inputs = gen->philox_cuda_state(counter_offset);
+  }
+
+  cudaStream_t stream = at::cuda::getCurrentCUDAStream();
+  randperm_batched_kernel<<<
+      batch,
+      kBatchedRandpermBlockSize,
+      n * sizeof(int32_t),
+      stream>>>(result.mutable_data_ptr<int64_t>(), n, rng_engine_inputs);
+  C10_CUDA_KERNEL_LAUNCH_CHECK();
+  return result;
+}
+
 } // namespace at::native
@@ -876,6 +876,17 @@ struct ReduceOp {
   }
 };
 
+// NOTE [ Amortizing launch latency for many small reductions ]
+// Each call here pays a full kernel launch, which dominates for tiny
+// per-token reductions (layernorm stats, softmax denominators) in decode
+// loops. A persistent resident grid consuming reduction descriptors does not
+// fit this design: ReduceOp is specialized at compile time per op, dtype and
+// vec size, so there is no runtime descriptor a single resident kernel could
+// dispatch on. The supported way to amortize launch cost across a decoding
+// step is CUDA Graph capture (at::cuda::CUDAGraph / torch.cuda.graphs),
+// which replays the whole step's launches with one submission; these kernels
+// are capture-safe, including the two-pass path, because the semaphore and
+// workspace buffers are allocated before capture begins.
 template<int max_threads, typename R>
 static void launch_reduce_kernel(const ReduceConfig& config, const R& reduction) {
   dim3 block = config.block();
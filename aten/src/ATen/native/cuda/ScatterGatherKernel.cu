@@ -542,6 +542,8 @@ void scatter_reduce_two_cuda_kernel(const Tensor& self, const int64_t dim, const
     cuda_scatter_gather_base_kernel<true, false>()(self, dim, index, src,
             "scatter_reduce_cuda_mean_", reduce_mean);
     break;
+  default :
+    break;
   }
 }
 
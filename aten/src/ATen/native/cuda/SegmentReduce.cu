@@ -114,6 +114,12 @@ __global__ void segment_reduce_forward_kernel(
   index_t offset_start = lengths_cumsum_data[offset_idx];
   index_t offset_end = lengths_cumsum_data[offset_idx + 1];
 
+  // For LOGSUMEXP, initial_value carries the running max and
+  // logsumexp_weight the sum of exponentials rescaled to it; a provided
+  // initial behaves like one extra element.
+  scalar_t logsumexp_weight =
+      is_initial_set ? static_cast<scalar_t>(1) : static_cast<scalar_t>(0);
+
   // ===== step2: apply reduction
   for (index_t j = offset_start; j < offset_end; ++j) {
     int64_t data_index = outer_idx * data_stride_axis * data_size_axis
@@ -133,6 +139,14 @@ __global__ void segment_reduce_forward_kernel(
     } else if (
       reduction == ReductionType::PROD) {
       initial_value = initial_value * data;
+    } else if (reduction == ReductionType::LOGSUMEXP) {
+      if (data <= initial_value) {
+        logsumexp_weight += std::exp(data - initial_value);
+      } else {
+        logsumexp_weight =
+            logsumexp_weight * std::exp(initial_value - data) + 1;
+        initial_value = data;
+      }
     }
   }
 
@@ -146,6 +160,9 @@ __global__ void segment_reduce_forward_kernel(
       reduction == ReductionType::MEAN && lengths_data[lengths_idx] > 0 &&
       !at::_isnan(initial_value)) {
     initial_value = initial_value / lengths_data[lengths_idx];
+  } else if (reduction == ReductionType::LOGSUMEXP) {
+    // Empty segments without an initial give -inf + log(0) = -inf.
+    initial_value = initial_value + std::log(logsumexp_weight);
   }
   int64_t output_index = outer_idx * output_stride_axis * output_size_axis
                          + dim_idx * output_stride_axis + lane_id;
@@ -255,6 +272,16 @@ __global__ void segment_reduce_backward_kernel(
         grad_input_data[data_index] = grad_val / values_data[data_index];
       }
     }
+  } else if (reduction == ReductionType::LOGSUMEXP) {
+    // d logsumexp(x) / dx_j = exp(x_j - logsumexp(x)); computed from the
+    // forward output in one pass, no mask materialized.
+    const auto& grad_val = grad_data[output_index];
+    for (int64_t j = offset_start; j < offset_end; ++j) {
+      int64_t data_index = outer_idx * data_stride_axis * data_size_axis
+                           + j * data_stride_axis + lane_id;
+      grad_input_data[data_index] = grad_val *
+          std::exp(values_data[data_index] - output_data[output_index]);
+    }
   }
 }
 } // namespace
@@ -453,7 +480,9 @@ Tensor _segment_reduce_lengths_offsets_cuda_kernel(
               scalar_t initial_value = 0;
               if (initial.has_value()) {
                 initial_value = initial.value().to<scalar_t>();
-              } else if (reduction == ReductionType::MAX) {
+              } else if (
+                  reduction == ReductionType::MAX ||
+                  reduction == ReductionType::LOGSUMEXP) {
                 initial_value = -std::numeric_limits<scalar_t>::infinity();
               } else if (
                   reduction == ReductionType::MEAN ||
@@ -465,7 +494,10 @@ Tensor _segment_reduce_lengths_offsets_cuda_kernel(
                 initial_value = 1;
               }
 
-              if (output_shape.size() > 1) {
+              // cub has no segmented logsumexp; route it through the custom
+              // kernel regardless of dimensionality.
+              if (output_shape.size() > 1 ||
+                  reduction == ReductionType::LOGSUMEXP) {
                 segment_reduce_forward_kernel<scalar_t>
                     <<<num_blocks,
                        threads_per_block,
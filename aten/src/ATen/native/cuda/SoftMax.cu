@@ -1131,14 +1131,36 @@ Tensor masked_softmax_cuda(const Tensor& input_, const Tensor& mask_, const std:
   // TODO We should have special fast kernel for TxT mask as well
   // mask_type == 0 => mask_ is a src_mask
   bool is_TxT_mask = (mask_type == 0) && input_.dim() == 4 && mask_.dim() == 2 && input_.size(3) == mask_.size(1) && input_.size(2) == mask_.size(0) && mask_.size(0) == mask_.size(1);
+
+  // Broadcast attention-mask layouts are evaluated on the fly instead of
+  // requiring the caller to materialize the expansion:
+  // [B, 1, 1, S] is a padding mask and reduces to the BxT fast path,
+  // [B, 1, S, S] is a per-batch attention mask shared across heads.
+  bool is_Bx11S_mask = input_.dim() == 4 && mask_.dim() == 4 &&
+      mask_.size(0) == input_.size(0) && mask_.size(1) == 1 &&
+      mask_.size(2) == 1 && mask_.size(3) == input_.size(3);
+  bool is_BxSS_mask = input_.dim() == 4 && mask_.dim() == 4 &&
+      mask_.size(0) == input_.size(0) && mask_.size(1) == 1 &&
+      mask_.size(2) == input_.size(2) && mask_.size(3) == input_.size(3);
+
   // If mask_type == 2, then mask_.sizes() must equal input_.sizes()
-  TORCH_CHECK(mask_.sizes() == input_.sizes() || is_BxT_mask || is_TxT_mask, "Mask shape should match input. mask: ", mask_.sizes(), " input: ", input_.sizes());
+  TORCH_CHECK(mask_.sizes() == input_.sizes() || is_BxT_mask || is_TxT_mask || is_Bx11S_mask || is_BxSS_mask, "Mask shape should match input. mask: ", mask_.sizes(), " input: ", input_.sizes());
 
   auto input = input_.dim() == 0 ? input_.view(1) : input_;
   auto mask = mask_.dim() == 0 ? mask_.view(1) : mask_;
   if (is_TxT_mask) {
     mask = mask.expand(input.sizes());
   }
+  if (is_Bx11S_mask) {
+    if (input_.size(2) == input_.size(3) && input_.size(1) % 2 == 0) {
+      // Same data layout as a (B, T) key-padding mask
+      mask = mask.view({input_.size(0), input_.size(3)});
+      is_BxT_mask = true;
+    } else {
+      mask = mask.expand(input.sizes());
+      is_Bx11S_mask = false;
+    }
+  }
   int64_t dim = dim_.has_value() ? dim_.value() : input.dim() - 1;
 
   int softmax_elements = input.size(dim);
@@ -1148,9 +1170,16 @@ Tensor masked_softmax_cuda(const Tensor& input_, const Tensor& mask_, const std:
   //     3) mask.is_contiguous()
   //     4) dim == input.dim() - 1
   // Otherwise, we fallback to vanilla softmax (where we do not support transformer_mask since converting the mask is expensive)
-  if (softmax_elements > 1024 || softmax_elements * input.element_size() > 4096 || !mask.is_contiguous() || dim < input.dim()-1) {
+  // The per-batch mask kernel derives the mask row from the row index, which
+  // only works out for square matrices; the warp kernel also processes two
+  // rows per warp when softmax_elements <= 128, so rows must not straddle a
+  // mask-row wrap within a warp (see is_per_batch_mask in
+  // PersistentSoftmax.cuh).
+  bool BxSS_fast_path_ok = is_BxSS_mask && input.size(2) == input.size(3) &&
+      (softmax_elements > 128 || softmax_elements % 2 == 0);
+  if (softmax_elements > 1024 || softmax_elements * input.element_size() > 4096 || !mask.is_contiguous() || dim < input.dim()-1 || (is_BxSS_mask && !BxSS_fast_path_ok)) {
     if (is_BxT_mask) {
-      mask = mask.view({mask_.size(0), 1, 1, mask_.size(1)}).expand(input.sizes());
+      mask = mask.view({mask.size(0), 1, 1, mask.size(1)}).expand(input.sizes());
     }
     AT_DISPATCH_FLOATING_TYPES_AND2(
       ScalarType::Half,
@@ -1186,6 +1215,30 @@ Tensor masked_softmax_cuda(const Tensor& input_, const Tensor& mask_, const std:
         );
       });
 
+  } else if (is_BxSS_mask) {
+    // Mask of shape [B, 1, S, S] broadcast across the head dimension; the
+    // kernel re-reads the same (B, S, S) mask rows for every head instead of
+    // a materialized [B, H, S, S] expansion.
+    AT_DISPATCH_FLOATING_TYPES_AND2(
+      ScalarType::Half,
+      ScalarType::BFloat16,
+      input.scalar_type(),
+      "masked_softmax",
+      [&] {
+        using accscalar_t = acc_type<scalar_t, true>;
+        dispatch_softmax_forward<scalar_t, scalar_t, accscalar_t, false/* is_log_softmax */, true/* is_masked */>(
+          output.mutable_data_ptr<scalar_t>(),    // dst
+          input.const_data_ptr<scalar_t>(),       // src
+          softmax_elements,
+          softmax_elements,
+          batch_count,
+          mask.const_data_ptr<bool>(),
+          chunk_size,
+          false, // is_transformer_mask
+          true // is_per_batch_mask
+        );
+      });
+
   } else {
     AT_DISPATCH_FLOATING_TYPES_AND2(
       ScalarType::Half,
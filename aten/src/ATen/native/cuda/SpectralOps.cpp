@@ -11,6 +11,7 @@
 #include <ATen/native/cuda/CuFFTUtils.h>
 #include <ATen/native/cuda/CuFFTPlanCache.h>
 #include <ATen/cuda/nvrtc_stub/ATenNVRTC.h>
+#include <c10/util/env.h>
 #include <c10/util/irange.h>
 
 #ifndef AT_PER_OPERATOR_HEADERS
@@ -236,30 +237,59 @@ static const Tensor& _exec_fft(Tensor& out, const Tensor& self, IntArrayRef out_
   }
 #endif
 
+  // NOTE [ cuFFT plan batch bucketing ]
+  //
+  // The plan cache keys on the exact batch count, so a workload running many
+  // distinct batch counts over the same signal shape creates one plan per
+  // count and thrashes the LRU cache. When PYTORCH_CUFFT_PLAN_BUCKETING is
+  // set, the batch is instead decomposed into power-of-two chunks and each
+  // chunk is executed with its own cached plan at the corresponding offset,
+  // so at most log2(batch) plans cover every batch count of a signal shape.
+  // Only simple (contiguous) layouts are batch-translatable this way, since
+  // offsetting the data pointers by whole signals requires the batch stride
+  // to equal the signal size.
+  static const bool plan_bucketing_enabled =
+      c10::utils::check_env("PYTORCH_CUFFT_PLAN_BUCKETING") == true;
+#if defined(USE_ROCM)
+  // hipfft may clobber its input, so inputs are always cloned and the
+  // offset-based execution below doesn't apply.
+  constexpr bool bucketing_supported = false;
+#else
+  constexpr bool bucketing_supported = true;
+#endif
+  bool use_bucketing = plan_bucketing_enabled && bucketing_supported &&
+      use_caching && batch_size > 1;
+  if (use_bucketing) {
+    const auto in_layout = as_cufft_embed(
+        input.strides(), signal_size, fft_type == CuFFTTransformType::C2R);
+    const auto out_layout = as_cufft_embed(
+        out.strides(), signal_size, fft_type == CuFFTTransformType::R2C);
+    use_bucketing =
+        !in_layout.must_clone && in_layout.simple && out_layout.simple;
+  }
+
+  bool cache_active = false;
   if (use_caching && plan_cache.max_size() > 0) {
     guard.lock();
     if (plan_cache.max_size() > 0) {  // check again after acquiring the lock
-      config = &plan_cache.lookup(Params);
+      cache_active = true;
+      if (use_bucketing) {
+        // Only reuse an exact-shape plan that is already cached; on a miss,
+        // fall through to the bucketed path below instead of planning for
+        // this exact batch count.
+        config = plan_cache.find(Params);
+      } else {
+        config = &plan_cache.lookup(Params);
+      }
     }
   }
 
-  if (config == nullptr) {
+  use_bucketing = use_bucketing && config == nullptr && cache_active;
+  if (config == nullptr && !use_bucketing) {
     uncached_plan.emplace(Params);
     config = &uncached_plan.value();
   }
 
-  auto & plan = config->plan();
-
-  if (config->should_clone_input()) {
-    input = input.clone(MemoryFormat::Contiguous);
-  }
-
-  // prepare cufft for execution
-  CUFFT_CHECK(cufftSetStream(plan, at::cuda::getCurrentCUDAStream()));
-  auto workspace = at::empty({ config->workspace_size() }, at::device(at::kCUDA).dtype(at::kByte));
-  CUFFT_CHECK(cufftSetWorkArea(plan, workspace.mutable_data_ptr()));
-
-  // execute transform plan
 #if !defined(USE_ROCM)
   CUcontext pctx = nullptr;
   at::globalContext().getNVRTC().cuCtxGetCurrent(&pctx);
@@ -271,7 +301,59 @@ static const Tensor& _exec_fft(Tensor& out, const Tensor& self, IntArrayRef out_
     at::globalContext().getNVRTC().cuCtxSetCurrent(pctx);
   }
 #endif /* !defined(USE_ROCM) */
-  exec_cufft_plan(*config, const_cast<void*>(input.const_data_ptr()), out.data_ptr(), forward);
+
+  if (use_bucketing) {
+    // See NOTE [ cuFFT plan batch bucketing ]. The plan cache mutex is held
+    // for the whole loop, and each chunk plan is used before the next lookup
+    // so LRU eviction cannot invalidate it.
+    const char* in_ptr = static_cast<const char*>(input.const_data_ptr());
+    char* out_ptr = static_cast<char*>(out.data_ptr());
+    const int64_t in_batch_stride = input.strides()[0] * input.element_size();
+    const int64_t out_batch_stride = out.strides()[0] * out.element_size();
+    DimVector chunk_signal_size(signal_size.begin(), signal_size.end());
+    int64_t offset = 0;
+    int64_t remaining = batch_size;
+    while (remaining > 0) {
+      // Largest-first binary decomposition of the batch count.
+      int64_t chunk = 1;
+      while (chunk * 2 <= remaining) {
+        chunk *= 2;
+      }
+      chunk_signal_size[0] = chunk;
+      CuFFTParams chunk_params(
+          input.strides(), out.strides(), chunk_signal_size, fft_type, value_type);
+      const CuFFTConfig& chunk_config = plan_cache.lookup(chunk_params);
+      TORCH_INTERNAL_ASSERT(!chunk_config.should_clone_input());
+      auto& chunk_plan = chunk_config.plan();
+      CUFFT_CHECK(cufftSetStream(chunk_plan, at::cuda::getCurrentCUDAStream()));
+      auto workspace = at::empty(
+          {chunk_config.workspace_size()}, at::device(at::kCUDA).dtype(at::kByte));
+      CUFFT_CHECK(cufftSetWorkArea(chunk_plan, workspace.mutable_data_ptr()));
+      exec_cufft_plan(
+          chunk_config,
+          const_cast<char*>(in_ptr + offset * in_batch_stride),
+          out_ptr + offset * out_batch_stride,
+          forward);
+      offset += chunk;
+      remaining -= chunk;
+    }
+  } else {
+    auto& plan = config->plan();
+
+    if (config->should_clone_input()) {
+      input = input.clone(MemoryFormat::Contiguous);
+    }
+
+    // prepare cufft for execution
+    CUFFT_CHECK(cufftSetStream(plan, at::cuda::getCurrentCUDAStream()));
+    auto workspace = at::empty(
+        {config->workspace_size()}, at::device(at::kCUDA).dtype(at::kByte));
+    CUFFT_CHECK(cufftSetWorkArea(plan, workspace.mutable_data_ptr()));
+
+    // execute transform plan
+    exec_cufft_plan(
+        *config, const_cast<void*>(input.const_data_ptr()), out.data_ptr(), forward);
+  }
 
   // Inplace reshaping to original batch shape and inverting the dimension permutation
   DimVector out_strides(ndim);
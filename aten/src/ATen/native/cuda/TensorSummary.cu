@@ -0,0 +1,124 @@
+#define TORCH_ASSERT_ONLY_METHOD_OPERATORS
+#include <ATen/AccumulateType.h>
+#include <ATen/Dispatch.h>
+#include <ATen/NumericUtils.h>
+#include <ATen/TensorOperators.h>
+#include <ATen/ceil_div.h>
+#include <ATen/core/Tensor.h>
+#include <ATen/cuda/Atomic.cuh>
+#include <ATen/cuda/CUDAContext.h>
+
+#ifndef AT_PER_OPERATOR_HEADERS
+#include <ATen/Functions.h>
+#include <ATen/NativeFunctions.h>
+#else
+#include <ATen/ops/_tensor_summary_native.h>
+#include <ATen/ops/empty.h>
+#endif
+
+#include <limits>
+
+namespace at::native {
+
+namespace {
+
+constexpr int kSummaryBlockSize = 256;
+
+// Accumulates min/max/sum/nan-count over the whole tensor in one read.
+// Each thread reduces a grid-stride slice locally, a shared-memory tree
+// combines the block, and one atomic per stat per block folds the block
+// result into the 4-element stats buffer. The buffer must be initialized
+// to [+inf, -inf, 0, 0] by the caller. NaNs are counted and excluded from
+// min/max/sum.
+template <typename scalar_t, typename acc_t>
+C10_LAUNCH_BOUNDS_1(kSummaryBlockSize)
+__global__ void tensor_summary_kernel(
+    const scalar_t* input,
+    int64_t numel,
+    double* stats) {
+  acc_t local_min = std::numeric_limits<acc_t>::infinity();
+  acc_t local_max = -std::numeric_limits<acc_t>::infinity();
+  acc_t local_sum = 0;
+  int64_t local_nan = 0;
+  for (int64_t i = blockIdx.x * blockDim.x + threadIdx.x; i < numel;
+       i += static_cast<int64_t>(gridDim.x) * blockDim.x) {
+    const acc_t val = static_cast<acc_t>(input[i]);
+    if (at::_isnan(val)) {
+      ++local_nan;
+      continue;
+    }
+    local_min = ::min(local_min, val);
+    local_max = ::max(local_max, val);
+    local_sum += val;
+  }
+
+  __shared__ acc_t shared_min[kSummaryBlockSize];
+  __shared__ acc_t shared_max[kSummaryBlockSize];
+  __shared__ acc_t shared_sum[kSummaryBlockSize];
+  __shared__ int64_t shared_nan[kSummaryBlockSize];
+  const int tid = threadIdx.x;
+  shared_min[tid] = local_min;
+  shared_max[tid] = local_max;
+  shared_sum[tid] = local_sum;
+  shared_nan[tid] = local_nan;
+  __syncthreads();
+  for (int stride = kSummaryBlockSize / 2; stride > 0; stride >>= 1) {
+    if (tid < stride) {
+      shared_min[tid] = ::min(shared_min[tid], shared_min[tid + stride]);
+      shared_max[tid] = ::max(shared_max[tid], shared_max[tid + stride]);
+      shared_sum[tid] += shared_sum[tid + stride];
+      shared_nan[tid] += shared_nan[tid + stride];
+    }
+    __syncthreads();
+  }
+  if (tid == 0) {
+    gpuAtomicMin(&stats[0], static_cast<double>(shared_min[0]));
+    gpuAtomicMax(&stats[1], static_cast<double>(shared_max[0]));
+    gpuAtomicAdd(&stats[2], static_cast<double>(shared_sum[0]));
+    gpuAtomicAdd(&stats[3], static_cast<double>(shared_nan[0]));
+  }
+}
+
+} // namespace
+
+// Single-pass CUDA implementation of _tensor_summary; see the composite
+// version in native/ReduceOps.cpp for the semantics. Everything stays
+// stream-ordered, so checking a tensor between kernels never synchronizes
+// the device.
+Tensor _tensor_summary_cuda(const Tensor& self) {
+  TORCH_CHECK(
+      at::isFloatingType(self.scalar_type()),
+      "_tensor_summary: expected a floating point tensor, got ",
+      self.scalar_type());
+  auto stats = at::empty({4}, self.options().dtype(kDouble));
+  const auto inf = std::numeric_limits<double>::infinity();
+  stats[0].fill_(inf);
+  stats[1].fill_(-inf);
+  stats[2].fill_(0);
+  stats[3].fill_(0);
+  const int64_t numel = self.numel();
+  if (numel == 0) {
+    stats[2].fill_(std::numeric_limits<double>::quiet_NaN());
+    return stats;
+  }
+  auto input = self.contiguous();
+  const int64_t grid = std::min(
+      ceil_div(numel, static_cast<int64_t>(kSummaryBlockSize)),
+      static_cast<int64_t>(1024));
+  auto stream = at::cuda::getCurrentCUDAStream();
+  AT_DISPATCH_FLOATING_TYPES_AND2(
+      kHalf, kBFloat16, input.scalar_type(), "_tensor_summary_cuda", [&] {
+        using acc_t = at::acc_type<scalar_t, /*is_cuda=*/true>;
+        tensor_summary_kernel<scalar_t, acc_t>
+            <<<grid, kSummaryBlockSize, 0, stream>>>(
+                input.const_data_ptr<scalar_t>(),
+                numel,
+                stats.mutable_data_ptr<double>());
+        C10_CUDA_KERNEL_LAUNCH_CHECK();
+      });
+  // mean = sum / (numel - nan_count), computed on device to stay async.
+  stats[2] /= numel - stats[3];
+  return stats;
+}
+
+} // namespace at::native
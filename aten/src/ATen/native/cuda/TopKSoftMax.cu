@@ -0,0 +1,151 @@
+#define TORCH_ASSERT_ONLY_METHOD_OPERATORS
+#include <ATen/core/Tensor.h>
+#include <ATen/AccumulateType.h>
+#include <ATen/Dispatch.h>
+#include <ATen/ceil_div.h>
+#include <ATen/cuda/CUDAContext.h>
+#include <ATen/cuda/DeviceUtils.cuh>
+#include <ATen/cuda/NumericLimits.cuh>
+#include <c10/cuda/CUDAException.h>
+
+#ifndef AT_PER_OPERATOR_HEADERS
+#include <ATen/Functions.h>
+#include <ATen/NativeFunctions.h>
+#else
+#include <ATen/ops/empty.h>
+#include <ATen/ops/_topk_softmax_native.h>
+#endif
+
+namespace at::native {
+
+namespace {
+
+// Largest inner dim the fused kernel supports. With one warp per row each
+// lane holds at most kMaxInnerDim / C10_WARP_SIZE elements in registers.
+constexpr int kMaxInnerDim = 256;
+constexpr int kWarpsPerBlock = 8;
+
+// One warp per row: computes the softmax normalizer for the row, then
+// iteratively selects the k largest logits. Since softmax is monotonic, the
+// top-k of the softmax output equals the softmax values at the top-k logits,
+// so the probabilities never have to be materialized for the full row.
+template <typename scalar_t>
+__global__ void TopKSoftMaxKernel(
+    const scalar_t* __restrict__ input,
+    scalar_t* __restrict__ values,
+    int64_t* __restrict__ indices,
+    int64_t num_rows,
+    int inner_dim,
+    int k) {
+  using acc_t = at::acc_type<scalar_t, true>;
+  constexpr int kMaxPerLane = kMaxInnerDim / C10_WARP_SIZE;
+
+  const int64_t row =
+      static_cast<int64_t>(blockIdx.x) * blockDim.y + threadIdx.y;
+  if (row >= num_rows) {
+    return;
+  }
+  const int lane = threadIdx.x;
+  const scalar_t* row_input = input + row * inner_dim;
+
+  // Lane `l` holds elements l, l + warpSize, l + 2 * warpSize, ...
+  acc_t elems[kMaxPerLane];
+  int num_local = 0;
+  acc_t row_max = at::numeric_limits<acc_t>::lower_bound();
+  for (int j = lane; j < inner_dim; j += C10_WARP_SIZE) {
+    elems[num_local] = static_cast<acc_t>(row_input[j]);
+    row_max = ::max(row_max, elems[num_local]);
+    num_local++;
+  }
+  for (int offset = C10_WARP_SIZE / 2; offset > 0; offset /= 2) {
+    row_max = ::max(row_max, WARP_SHFL_XOR(row_max, offset));
+  }
+
+  acc_t row_sum = 0;
+  for (int i = 0; i < num_local; i++) {
+    row_sum += std::exp(elems[i] - row_max);
+  }
+  for (int offset = C10_WARP_SIZE / 2; offset > 0; offset /= 2) {
+    row_sum += WARP_SHFL_XOR(row_sum, offset);
+  }
+
+  for (int sel = 0; sel < k; sel++) {
+    // Local argmax over the lane's surviving elements, then a warp argmax.
+    // Ties resolve to the smaller index.
+    acc_t best = at::numeric_limits<acc_t>::lower_bound();
+    int best_index = inner_dim;
+    for (int i = 0; i < num_local; i++) {
+      const int j = lane + i * C10_WARP_SIZE;
+      if (elems[i] > best || (elems[i] == best && j < best_index)) {
+        best = elems[i];
+        best_index = j;
+      }
+    }
+    for (int offset = C10_WARP_SIZE / 2; offset > 0; offset /= 2) {
+      const acc_t other = WARP_SHFL_XOR(best, offset);
+      const int other_index = WARP_SHFL_XOR(best_index, offset);
+      if (other > best || (other == best && other_index < best_index)) {
+        best = other;
+        best_index = other_index;
+      }
+    }
+    if (lane == best_index % C10_WARP_SIZE) {
+      elems[best_index / C10_WARP_SIZE] =
+          at::numeric_limits<acc_t>::lower_bound();
+    }
+    if (lane == 0) {
+      values[row * k + sel] =
+          static_cast<scalar_t>(std::exp(best - row_max) / row_sum);
+      indices[row * k + sel] = best_index;
+    }
+  }
+}
+
+} // namespace
+
+std::tuple<Tensor, Tensor> _topk_softmax_cuda(const Tensor& self, int64_t k) {
+  TORCH_CHECK(
+      self.dim() == 2,
+      "_topk_softmax: Expected a 2-D tensor, but got ",
+      self.dim(),
+      " dims");
+  const int64_t num_rows = self.size(0);
+  const int64_t inner_dim = self.size(1);
+  TORCH_CHECK(
+      inner_dim > 0 && inner_dim <= kMaxInnerDim,
+      "_topk_softmax: inner dim must be in (0, ",
+      kMaxInnerDim,
+      "], but got ",
+      inner_dim);
+  TORCH_CHECK(
+      k > 0 && k <= inner_dim,
+      "_topk_softmax: k must be in (0, ",
+      inner_dim,
+      "], but got ",
+      k);
+
+  const auto input = self.contiguous();
+  auto values = at::empty({num_rows, k}, self.options());
+  auto indices = at::empty({num_rows, k}, self.options().dtype(kLong));
+  if (num_rows == 0) {
+    return std::make_tuple(values, indices);
+  }
+
+  const dim3 block(C10_WARP_SIZE, kWarpsPerBlock);
+  const dim3 grid(ceil_div(num_rows, static_cast<int64_t>(kWarpsPerBlock)));
+  auto stream = at::cuda::getCurrentCUDAStream();
+  AT_DISPATCH_FLOATING_TYPES_AND2(
+      kHalf, kBFloat16, self.scalar_type(), "_topk_softmax_cuda", [&] {
+        TopKSoftMaxKernel<scalar_t><<<grid, block, 0, stream>>>(
+            input.const_data_ptr<scalar_t>(),
+            values.mutable_data_ptr<scalar_t>(),
+            indices.mutable_data_ptr<int64_t>(),
+            num_rows,
+            static_cast<int>(inner_dim),
+            static_cast<int>(k));
+        C10_CUDA_KERNEL_LAUNCH_CHECK();
+      });
+  return std::make_tuple(values, indices);
+}
+
+} // namespace at::native
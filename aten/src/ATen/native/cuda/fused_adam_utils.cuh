@@ -63,10 +63,12 @@ C10_DEVICE inline void adam_math(
         param -= lr * weight_decay * param;
       }
     }
-    // todo(crcrpar): use lerp
+    // lerp form of the moment updates, spelled out so nvcc can contract each
+    // into a single fma (std::lerp is not usable in device code here).
     // ref: https://developer.nvidia.com/blog/lerp-faster-cuda/
-    exp_avg = beta1 * exp_avg + (1 - beta1) * grad;
-    exp_avg_sq = beta2 * exp_avg_sq + (1 - beta2) * grad * grad;
+    exp_avg = grad + beta1 * (exp_avg - grad);
+    const opmath_t grad_sq = grad * grad;
+    exp_avg_sq = grad_sq + beta2 * (exp_avg_sq - grad_sq);
     const opmath_t step_size = lr / bias_correction1;
     opmath_t denom;
     if (amsgrad) {
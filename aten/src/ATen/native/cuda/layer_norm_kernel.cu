@@ -17,7 +17,12 @@
 #include <ATen/Functions.h>
 #include <ATen/NativeFunctions.h>
 #else
+#include <ATen/ops/_fused_layer_norm_linear_native.h>
+#include <ATen/ops/_fused_rms_norm_native.h>
+#include <ATen/ops/_fused_rms_norm_backward_native.h>
+#include <ATen/ops/addmm.h>
 #include <ATen/ops/empty.h>
+#include <ATen/ops/mm.h>
 #include <ATen/ops/empty_like_native.h>
 #include <ATen/ops/native_layer_norm_native.h>
 #include <ATen/ops/native_layer_norm_backward_native.h>
@@ -111,6 +116,41 @@ __global__ void LayerNormForwardCUDAKernel(
   }
 }
 
+// RMSNorm forward is a single pass per row: the sum of squares reduction and
+// the normalized write share one kernel, unlike LayerNorm which needs the
+// moments before it can normalize.
+template <typename T, typename T_ACC>
+__global__ void RmsNormForwardCUDAKernel(
+    int64_t N,
+    T_ACC eps,
+    const T* X,
+    const T* gamma,
+    T* Y,
+    T_ACC* rstd) {
+  __shared__ T_ACC sum_shared[C10_WARP_SIZE];
+  __shared__ T_ACC rstd_shared;
+  const int64_t i = blockIdx.x;
+  T_ACC sum_sq = 0;
+  for (int64_t j = threadIdx.x; j < N; j += blockDim.x) {
+    const T_ACC x = static_cast<T_ACC>(X[i * N + j]);
+    sum_sq += x * x;
+  }
+  sum_sq = cuda_utils::BlockReduceSum<T_ACC>(sum_sq, sum_shared);
+  if (threadIdx.x == 0) {
+    rstd_shared =
+        c10::cuda::compat::rsqrt(sum_sq / static_cast<T_ACC>(N) + eps);
+    rstd[i] = rstd_shared;
+  }
+  __syncthreads();
+  const T_ACC rstd_val = rstd_shared;
+  for (int64_t j = threadIdx.x; j < N; j += blockDim.x) {
+    const int64_t index = i * N + j;
+    const T_ACC gamma_v =
+        gamma == nullptr ? T_ACC(1) : static_cast<T_ACC>(gamma[j]);
+    Y[index] = static_cast<T_ACC>(X[index]) * rstd_val * gamma_v;
+  }
+}
+
 struct WelfordDataLN{
   float mean;
   float sigma2;
@@ -540,6 +580,62 @@ __global__ void GammaBetaBackwardSimpleCUDAKernel(
   }
 }
 
+template <typename T, typename T_ACC>
+__global__ void RmsNormBackwardCUDAKernel(
+    int64_t N,
+    const T* dY,
+    const T* X,
+    const T_ACC* rstd,
+    const T* gamma,
+    T* dX) {
+  __shared__ T_ACC ds_shared[C10_WARP_SIZE];
+  __shared__ T_ACC b_shared;
+  const int64_t i = blockIdx.x;
+  T_ACC ds = 0;
+  for (int64_t j = threadIdx.x; j < N; j += blockDim.x) {
+    const int64_t index = i * N + j;
+    const T_ACC gamma_v =
+        gamma == nullptr ? T_ACC(1) : static_cast<T_ACC>(gamma[j]);
+    ds += static_cast<T_ACC>(dY[index]) * static_cast<T_ACC>(X[index]) *
+        gamma_v;
+  }
+  ds = cuda_utils::BlockReduceSum<T_ACC>(ds, ds_shared);
+  if (threadIdx.x == 0) {
+    const T_ACC a = static_cast<T_ACC>(rstd[i]);
+    b_shared = -ds * a * a * a / static_cast<T_ACC>(N);
+  }
+  __syncthreads();
+  const T_ACC a = static_cast<T_ACC>(rstd[i]);
+  const T_ACC b = b_shared;
+  for (int64_t j = threadIdx.x; j < N; j += blockDim.x) {
+    const int64_t index = i * N + j;
+    const T_ACC gamma_v =
+        gamma == nullptr ? T_ACC(1) : static_cast<T_ACC>(gamma[j]);
+    dX[index] = a * static_cast<T_ACC>(dY[index]) * gamma_v +
+        b * static_cast<T_ACC>(X[index]);
+  }
+}
+
+template <typename T, typename T_ACC>
+__global__ void RmsNormGammaBackwardSimpleCUDAKernel(
+    int64_t M,
+    int64_t N,
+    const T* dY,
+    const T* X,
+    const T_ACC* rstd,
+    T* dg) {
+  const int64_t j = blockIdx.x * blockDim.x + threadIdx.x;
+  if (j < N) {
+    T_ACC sum1 = 0;
+    for (int64_t i = 0; i < M; ++i) {
+      const int64_t index = i * N + j;
+      sum1 += static_cast<T_ACC>(dY[index]) * static_cast<T_ACC>(X[index]) *
+          static_cast<T_ACC>(rstd[i]);
+    }
+    dg[j] = sum1;
+  }
+}
+
 // This implementation gets called if M and N divide with 32. This case should
 // be the most common. We can then make better use of warp level intrinsics
 // to improve performance.
@@ -822,6 +918,50 @@ void LayerNormKernelImpl(
       });
 }
 
+template <typename T, typename T_ACC>
+void RmsNormKernelImplInternal(
+    const Tensor& X,
+    const Tensor& gamma,
+    int64_t M,
+    int64_t N,
+    T_ACC eps,
+    Tensor* Y,
+    Tensor* rstd) {
+  // assumes input and gamma are of proper shape, this was checked in
+  // _check_layer_norm_inputs; assumes all tensors are contiguous
+  TORCH_CHECK(M <= at::cuda::getCurrentDeviceProperties()->maxGridSize[0], "M should be less than maximum CUDA grid size, \
+  file a support request to support bigger batches");
+  const T* X_data = X.const_data_ptr<T>();
+  const T* gamma_data = gamma.defined() ? gamma.const_data_ptr<T>() : nullptr;
+  T* Y_data = Y->data_ptr<T>();
+  T_ACC* rstd_data = rstd->data_ptr<T_ACC>();
+  cudaStream_t cuda_stream = at::cuda::getCurrentCUDAStream();
+  RmsNormForwardCUDAKernel<T, T_ACC>
+      <<<M, cuda_utils::kCUDABlockReduceNumThreads, 0, cuda_stream>>>(
+          N, eps, X_data, gamma_data, Y_data, rstd_data);
+  C10_CUDA_KERNEL_LAUNCH_CHECK();
+}
+
+void RmsNormKernelImpl(
+    const Tensor& X,
+    const Tensor& gamma,
+    int64_t M,
+    int64_t N,
+    double eps,
+    Tensor* Y,
+    Tensor* rstd) {
+  AT_DISPATCH_FLOATING_TYPES_AND2(
+      at::ScalarType::Half,
+      at::ScalarType::BFloat16,
+      X.scalar_type(),
+      "RmsNormKernelImpl",
+      [&]() {
+        using acc_t = acc_type<scalar_t, true>;
+        RmsNormKernelImplInternal<scalar_t, acc_t>(
+            X, gamma, M, N, static_cast<acc_t>(eps), Y, rstd);
+      });
+}
+
 template<typename T, typename T_ACC> __device__
 void cuLoadWriteStridedInputs(
     const int i1_block,
@@ -1331,6 +1471,129 @@ void LayerNormBackwardKernelImpl(
 
 } // namespace
 
+void RmsNormBackwardKernelImpl(
+    const Tensor& dY,
+    const Tensor& X,
+    const Tensor& rstd,
+    const Tensor& gamma,
+    int64_t M,
+    int64_t N,
+    Tensor* dX,
+    Tensor* dgamma) {
+  AT_DISPATCH_FLOATING_TYPES_AND2(
+      at::ScalarType::Half,
+      at::ScalarType::BFloat16,
+      X.scalar_type(),
+      "RmsNormBackwardKernelImpl",
+      [&]() {
+        using acc_t = acc_type<scalar_t, true>;
+        const scalar_t* dY_data = dY.const_data_ptr<scalar_t>();
+        const scalar_t* X_data = X.const_data_ptr<scalar_t>();
+        const acc_t* rstd_data = rstd.const_data_ptr<acc_t>();
+        const scalar_t* gamma_data =
+            gamma.defined() ? gamma.const_data_ptr<scalar_t>() : nullptr;
+        cudaStream_t cuda_stream = at::cuda::getCurrentCUDAStream();
+        if (dX->defined()) {
+          scalar_t* dX_data = dX->data_ptr<scalar_t>();
+          RmsNormBackwardCUDAKernel<scalar_t, acc_t>
+              <<<M, cuda_utils::kCUDABlockReduceNumThreads, 0, cuda_stream>>>(
+                  N, dY_data, X_data, rstd_data, gamma_data, dX_data);
+          C10_CUDA_KERNEL_LAUNCH_CHECK();
+        }
+        if (dgamma->defined()) {
+          scalar_t* dgamma_data = dgamma->data_ptr<scalar_t>();
+          const int64_t B = (N + kCUDANumThreads - 1) / kCUDANumThreads;
+          RmsNormGammaBackwardSimpleCUDAKernel<scalar_t, acc_t>
+              <<<B, kCUDANumThreads, 0, cuda_stream>>>(
+                  M, N, dY_data, X_data, rstd_data, dgamma_data);
+          C10_CUDA_KERNEL_LAUNCH_CHECK();
+        }
+      });
+}
+
+std::tuple<Tensor, Tensor> _fused_rms_norm_cuda(
+    const Tensor& input,
+    IntArrayRef normalized_shape,
+    const std::optional<Tensor>& weight_opt /* optional */,
+    double eps) {
+  // See [Note: hacky wrapper removal for optional tensor]
+  c10::MaybeOwned<Tensor> weight_maybe_owned =
+      at::borrow_from_optional_tensor(weight_opt);
+  const Tensor& weight = *weight_maybe_owned;
+
+  auto M_N = _check_layer_norm_inputs(input, normalized_shape, weight, Tensor());
+  auto M = M_N.first;
+  auto N = M_N.second;
+  auto X = input.expect_contiguous();
+  auto gamma = weight.expect_contiguous();
+
+  Tensor Y = at::native::empty_like(
+      *X,
+      c10::nullopt /* dtype */,
+      c10::nullopt /* layout */,
+      c10::nullopt /* device */,
+      c10::nullopt /* pin_memory */,
+      LEGACY_CONTIGUOUS_MEMORY_FORMAT);
+  auto acc_type = at::toAccumulateType(input.scalar_type(), /*is_cuda=*/true);
+  Tensor rstd = at::empty({M}, X->options().dtype(acc_type));
+  if (M > 0) {
+    RmsNormKernelImpl(*X, *gamma, M, N, eps, &Y, &rstd);
+  }
+  return std::make_tuple(std::move(Y), std::move(rstd));
+}
+
+std::tuple<Tensor, Tensor> _fused_rms_norm_backward_cuda(
+    const Tensor& dY,
+    const Tensor& input,
+    IntArrayRef normalized_shape,
+    const Tensor& rstd,
+    const std::optional<Tensor>& weight_opt /* optional */,
+    std::array<bool, 2> grad_input_mask) {
+  // See [Note: hacky wrapper removal for optional tensor]
+  c10::MaybeOwned<Tensor> weight_maybe_owned =
+      at::borrow_from_optional_tensor(weight_opt);
+  const Tensor& weight = *weight_maybe_owned;
+
+  auto M_N = _check_layer_norm_inputs(input, normalized_shape, weight, Tensor());
+  auto M = M_N.first;
+  auto N = M_N.second;
+  auto X = input.expect_contiguous();
+  auto gamma = weight.expect_contiguous();
+
+  Tensor dX;
+  Tensor dgamma;
+  if (grad_input_mask[0]) {
+    dX = at::native::empty_like(
+        *X,
+        c10::nullopt /* dtype */,
+        c10::nullopt /* layout */,
+        c10::nullopt /* device */,
+        c10::nullopt /* pin_memory */,
+        LEGACY_CONTIGUOUS_MEMORY_FORMAT);
+  }
+  if (grad_input_mask[1]) {
+    dgamma = M > 0 ? at::native::empty_like(
+                         *gamma,
+                         c10::nullopt /* dtype */,
+                         c10::nullopt /* layout */,
+                         c10::nullopt /* device */,
+                         c10::nullopt /* pin_memory */,
+                         LEGACY_CONTIGUOUS_MEMORY_FORMAT)
+                   : at::native::zeros_like(
+                         *gamma,
+                         c10::nullopt /* dtype */,
+                         c10::nullopt /* layout */,
+                         c10::nullopt /* device */,
+                         c10::nullopt /* pin_memory */,
+                         LEGACY_CONTIGUOUS_MEMORY_FORMAT);
+  }
+  if (M > 0 && N > 0) {
+    RmsNormBackwardKernelImpl(
+        dY.contiguous(), *X, rstd, *gamma, M, N, &dX, &dgamma);
+  }
+  return std::make_tuple(std::move(dX), std::move(dgamma));
+}
+
 std::tuple<Tensor, Tensor, Tensor> layer_norm_cuda(
     const Tensor& input,
     IntArrayRef normalized_shape,
@@ -1384,6 +1647,81 @@ std::tuple<Tensor, Tensor, Tensor> layer_norm_cuda(
   return std::make_tuple(std::move(Y), std::move(mean), std::move(rstd));
 }
 
+// Forward-only LayerNorm + linear input projection. cuBLASLt has no
+// normalization prologue, so the norm still runs as its own kernel; the
+// fusion here is everything around it: no mean/rstd tensors are kept (a
+// separate native_layer_norm call materializes and returns both for
+// backward), the normalized activation is handed to the GEMM immediately
+// while still hot in cache, and the whole sequence is a single dispatch.
+Tensor _fused_layer_norm_linear_cuda(
+    const Tensor& input,
+    IntArrayRef normalized_shape,
+    const std::optional<Tensor>& weight_opt /* optional */,
+    const std::optional<Tensor>& bias_opt /* optional */,
+    double eps,
+    const Tensor& proj_weight,
+    const std::optional<Tensor>& proj_bias_opt /* optional */) {
+  // See [Note: hacky wrapper removal for optional tensor]
+  c10::MaybeOwned<Tensor> weight_maybe_owned =
+      at::borrow_from_optional_tensor(weight_opt);
+  const Tensor& weight = *weight_maybe_owned;
+  c10::MaybeOwned<Tensor> bias_maybe_owned =
+      at::borrow_from_optional_tensor(bias_opt);
+  const Tensor& bias = *bias_maybe_owned;
+  c10::MaybeOwned<Tensor> proj_bias_maybe_owned =
+      at::borrow_from_optional_tensor(proj_bias_opt);
+  const Tensor& proj_bias = *proj_bias_maybe_owned;
+
+  TORCH_CHECK(
+      normalized_shape.size() == 1,
+      "_fused_layer_norm_linear: normalized_shape must be 1-D (the hidden "
+      "dimension), got ",
+      normalized_shape.size(),
+      "-D");
+  auto M_N = _check_layer_norm_inputs(input, normalized_shape, weight, bias);
+  auto M = M_N.first;
+  auto N = M_N.second;
+  TORCH_CHECK(
+      proj_weight.dim() == 2 && proj_weight.size(1) == N,
+      "_fused_layer_norm_linear: proj_weight must have shape "
+      "[out_features, ",
+      N,
+      "], got ",
+      proj_weight.sizes());
+
+  auto X = input.expect_contiguous();
+  auto gamma = weight.expect_contiguous();
+  auto beta = bias.expect_contiguous();
+
+  Tensor Y = at::native::empty_like(
+      *X,
+      c10::nullopt /* dtype */,
+      c10::nullopt /* layout */,
+      c10::nullopt /* device */,
+      c10::nullopt /* pin_memory */,
+      LEGACY_CONTIGUOUS_MEMORY_FORMAT);
+  auto acc_type = at::toAccumulateType(input.scalar_type(), /*is_cuda=*/true);
+  // Scratch only; freed as soon as this returns instead of being saved
+  // for a backward that never comes.
+  Tensor mean = at::empty({M}, X->options().dtype(acc_type));
+  Tensor rstd = at::empty({M}, X->options().dtype(acc_type));
+  if (M > 0) {
+    LayerNormKernelImpl(*X, *gamma, *beta, M, N, eps, &Y, &mean, &rstd);
+  }
+
+  auto Y2d = Y.view({M, N});
+  Tensor out = proj_bias.defined()
+      ? at::addmm(proj_bias, Y2d, proj_weight.t())
+      : at::mm(Y2d, proj_weight.t());
+
+  const auto input_shape = input.sizes();
+  const size_t axis = input.dim() - normalized_shape.size();
+  std::vector<int64_t> out_shape(
+      input_shape.begin(), input_shape.begin() + axis);
+  out_shape.push_back(proj_weight.size(0));
+  return out.view(out_shape);
+}
+
 std::tuple<Tensor, Tensor, Tensor> layer_norm_backward_cuda(
     const Tensor& dY,
     const Tensor& input,
@@ -1461,5 +1799,7 @@ std::tuple<Tensor, Tensor, Tensor> layer_norm_backward_cuda(
 
 REGISTER_DISPATCH(LayerNormKernel, &LayerNormKernelImpl);
 REGISTER_DISPATCH(LayerNormBackwardKernel, &LayerNormBackwardKernelImpl);
+REGISTER_DISPATCH(RmsNormKernel, &RmsNormKernelImpl);
+REGISTER_DISPATCH(RmsNormBackwardKernel, &RmsNormBackwardKernelImpl);
 
 } // namespace at::native
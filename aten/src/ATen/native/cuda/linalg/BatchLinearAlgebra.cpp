@@ -5,10 +5,14 @@
 #include <ATen/core/Tensor.h>
 #include <ATen/Context.h>
 #include <ATen/cuda/CUDAContext.h>
+#include <ATen/cuda/CUDAEvent.h>
 #include <ATen/Dispatch.h>
 #include <ATen/cuda/PinnedMemoryAllocator.h>
 #include <ATen/cuda/detail/IndexUtils.cuh>
 
+#include <mutex>
+#include <unordered_map>
+
 #include <c10/util/Exception.h>
 
 #include <ATen/native/LinearAlgebraUtils.h>
@@ -1351,6 +1355,88 @@ void cholesky_helper_magma(const Tensor& input, bool upper, const Tensor& info)
   }
 }
 
+#if defined(USE_LINALG_SOLVER) && !defined(USE_ROCM)
+namespace {
+
+// Note [Small-batch backend selection cache]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// For tiny batched factorizations (n <= kSmallLinalgMaxDim) the
+// warp-per-matrix kernels in cuda/BatchLinearAlgebraSmall.cu often beat both
+// cuSOLVER and MAGMA, but the crossover depends on the GPU and on (n, batch).
+// Rather than hard-coding yet another heuristic, the first call for a given
+// (op, dtype, n, batch bucket) times the specialized kernel against the
+// library path the static heuristic would have picked, on clones of the
+// input, and caches the winner. The timing run synchronizes the current
+// stream a few times; that one-off cost is amortized by workloads that
+// repeat the same shape, which are the only workloads the cache matters for.
+// Batch sizes are bucketed by their log2 so that slowly-varying batch sizes
+// share an entry.
+
+enum class SmallLinalgOp : uint8_t { Cholesky, LuFactor };
+
+bool use_small_linalg_kernel(const Tensor& input) {
+  const auto n = input.size(-1);
+  return n > 0 && n <= kSmallLinalgMaxDim && input.size(-2) == n &&
+      batchCount(input) > 1 &&
+      (input.scalar_type() == at::kFloat || input.scalar_type() == at::kDouble);
+}
+
+template <typename candidate_t>
+float time_small_linalg_candidate(const Tensor& input, const candidate_t& candidate) {
+  // Run once on a throwaway clone so that one-time costs (library handle
+  // creation, module loading) don't skew the measurement, then time a second
+  // run. The factorizations are destructive, hence one clone per run.
+  candidate(cloneBatchedColumnMajor(input));
+  at::cuda::CUDAEvent start(cudaEventDefault);
+  at::cuda::CUDAEvent end(cudaEventDefault);
+  auto input_clone = cloneBatchedColumnMajor(input);
+  const auto stream = at::cuda::getCurrentCUDAStream();
+  start.record(stream);
+  candidate(input_clone);
+  end.record(stream);
+  end.synchronize();
+  return start.elapsed_time(end);
+}
+
+template <typename kernel_t, typename library_t>
+bool small_linalg_prefers_kernel(
+    SmallLinalgOp op,
+    const Tensor& input,
+    const kernel_t& run_kernel,
+    const library_t& run_library) {
+  static std::mutex cache_mutex;
+  static std::unordered_map<uint64_t, bool> cache;
+
+  uint64_t batch_bucket = 0;
+  for (auto batch = batchCount(input); batch > 1; batch >>= 1) {
+    batch_bucket++;
+  }
+  const uint64_t key = (static_cast<uint64_t>(op) << 48) |
+      (static_cast<uint64_t>(input.scalar_type()) << 40) |
+      (static_cast<uint64_t>(input.size(-1)) << 32) | batch_bucket;
+  {
+    const std::lock_guard<std::mutex> lock(cache_mutex);
+    const auto it = cache.find(key);
+    if (it != cache.end()) {
+      return it->second;
+    }
+  }
+
+  // Time outside the lock; if two threads race on the same key they both
+  // measure and the last insert wins, which is harmless.
+  const auto kernel_ms = time_small_linalg_candidate(input, run_kernel);
+  const auto library_ms = time_small_linalg_candidate(input, run_library);
+  const bool prefer_kernel = kernel_ms < library_ms;
+  {
+    const std::lock_guard<std::mutex> lock(cache_mutex);
+    cache[key] = prefer_kernel;
+  }
+  return prefer_kernel;
+}
+
+} // anonymous namespace
+#endif // defined(USE_LINALG_SOLVER) && !defined(USE_ROCM)
+
 static void cholesky_kernel(const Tensor& input, const Tensor& info, bool upper) {
 #if defined(USE_LINALG_SOLVER) && !defined(USE_ROCM)
   auto preferred_backend = at::globalContext().linalgPreferredBackend();
@@ -1362,7 +1448,23 @@ static void cholesky_kernel(const Tensor& input, const Tensor& info, bool upper)
       cholesky_helper_magma(input, upper, info);
       break;
     default:
-      if (batchCount(input) == 1 || !use_magma_ || use_cusolver_potrf_batched_) {
+      if (use_small_linalg_kernel(input) &&
+          small_linalg_prefers_kernel(
+              SmallLinalgOp::Cholesky,
+              input,
+              [&](const Tensor& clone) {
+                cholesky_small_batched_cuda(clone, upper, info.clone());
+              },
+              [&](const Tensor& clone) {
+                // batchCount > 1 here, see use_small_linalg_kernel
+                if (!use_magma_ || use_cusolver_potrf_batched_) {
+                  cholesky_helper_cusolver(clone, upper, info.clone());
+                } else {
+                  cholesky_helper_magma(clone, upper, info.clone());
+                }
+              })) {
+        cholesky_small_batched_cuda(input, upper, info);
+      } else if (batchCount(input) == 1 || !use_magma_ || use_cusolver_potrf_batched_) {
         cholesky_helper_cusolver(input, upper, info);
       } else {
         cholesky_helper_magma(input, upper, info);
@@ -1648,14 +1750,48 @@ static void lu_factor(const Tensor& input, const Tensor& pivots, const Tensor& i
 #ifdef USE_ROCM
     lu_factor_cusolver(input, pivots, infos, compute_pivots);
 #else
-    if (m == n && (batch_size == 1 || m <= 16 || (m <= 128 && batch_size <= 16))) {
+    if (use_small_linalg_kernel(input) &&
+        small_linalg_prefers_kernel(
+            SmallLinalgOp::LuFactor,
+            input,
+            [&](const Tensor& clone) {
+              lu_factor_small_batched_cuda(clone, pivots.clone(), infos.clone(), compute_pivots);
+            },
+            [&](const Tensor& clone) {
+              // For m == n <= 32 and batchCount > 1 the static heuristic
+              // below reduces to this choice
+              if (m <= 16 || batch_size <= 16) {
+                lu_factor_cusolver(clone, pivots.clone(), infos.clone(), compute_pivots);
+              } else {
+                lu_factor_batched_magma(clone, pivots.clone(), infos.clone(), compute_pivots);
+              }
+            })) {
+      lu_factor_small_batched_cuda(input, pivots, infos, compute_pivots);
+    } else if (m == n && (batch_size == 1 || m <= 16 || (m <= 128 && batch_size <= 16))) {
       lu_factor_cusolver(input, pivots, infos, compute_pivots);
     } else {
       lu_factor_batched_magma(input, pivots, infos, compute_pivots);
     }
 #endif // USE_ROCM
 #else // !AT_MAGMA_ENABLED
+#ifdef USE_ROCM
     lu_factor_cusolver(input, pivots, infos, compute_pivots);
+#else
+    if (use_small_linalg_kernel(input) &&
+        small_linalg_prefers_kernel(
+            SmallLinalgOp::LuFactor,
+            input,
+            [&](const Tensor& clone) {
+              lu_factor_small_batched_cuda(clone, pivots.clone(), infos.clone(), compute_pivots);
+            },
+            [&](const Tensor& clone) {
+              lu_factor_cusolver(clone, pivots.clone(), infos.clone(), compute_pivots);
+            })) {
+      lu_factor_small_batched_cuda(input, pivots, infos, compute_pivots);
+    } else {
+      lu_factor_cusolver(input, pivots, infos, compute_pivots);
+    }
+#endif // USE_ROCM
 #endif // AT_MAGMA_ENABLED
 #else // !USE_LINALG_SOLVER
     lu_factor_magma(input, pivots, infos, compute_pivots);
@@ -57,6 +57,13 @@ void ldl_solve_cusolver(
 void lu_factor_batched_cublas(const Tensor& A, const Tensor& pivots, const Tensor& infos, bool get_pivots);
 void lu_solve_batched_cublas(const Tensor& LU, const Tensor& pivots, const Tensor& B, TransposeType transpose);
 
+// Warp-per-matrix batched factorizations for tiny matrices (n <= 32), real
+// types only; implemented in cuda/BatchLinearAlgebraSmall.cu. Input must be a
+// batched column-major working copy, as for the library paths above.
+constexpr int64_t kSmallLinalgMaxDim = 32;
+void cholesky_small_batched_cuda(const Tensor& input, bool upper, const Tensor& info);
+void lu_factor_small_batched_cuda(const Tensor& input, const Tensor& pivots, const Tensor& infos, bool compute_pivots);
+
 #if defined(USE_LINALG_SOLVER)
 
 // entrance of calculations of `svd` using cusolver gesvdj and gesvdjBatched
@@ -67,12 +67,30 @@ static void im2col(
       for (const auto c_col : c10::irange(begin, end)) {
         for (const auto h_col : c10::irange(height_col)) {
           int64_t h_im = h_col * stride_h - pad_h + h_offset * dilation_h;
-          for (const auto w_col : c10::irange(width_col)) {
-            int64_t w_im = w_col * stride_w - pad_w + w_offset * dilation_w;
-            data_col[(c_col * height_col + h_col) * width_col + w_col] =
-                (h_im >= 0 && w_im >= 0 && h_im < height && w_im < width)
-                ? data_im[(c_im * height + h_im) * width + w_im]
-                : static_cast<T>(0);
+          T* row_col = data_col + (c_col * height_col + h_col) * width_col;
+          if (h_im < 0 || h_im >= height) {
+            std::fill_n(row_col, width_col, static_cast<T>(0));
+          } else if (stride_w == 1) {
+            // With unit width stride, consecutive output columns read
+            // consecutive input pixels, so the row is a shifted contiguous
+            // copy with zero-filled out-of-bounds edges.
+            const int64_t w_im0 = w_offset * dilation_w - pad_w;
+            const int64_t w_begin = std::clamp<int64_t>(-w_im0, 0, width_col);
+            const int64_t w_end =
+                std::clamp<int64_t>(width - w_im0, w_begin, width_col);
+            std::fill_n(row_col, w_begin, static_cast<T>(0));
+            std::copy_n(
+                data_im + (c_im * height + h_im) * width + w_im0 + w_begin,
+                w_end - w_begin,
+                row_col + w_begin);
+            std::fill_n(row_col + w_end, width_col - w_end, static_cast<T>(0));
+          } else {
+            for (const auto w_col : c10::irange(width_col)) {
+              int64_t w_im = w_col * stride_w - pad_w + w_offset * dilation_w;
+              row_col[w_col] = (w_im >= 0 && w_im < width)
+                  ? data_im[(c_im * height + h_im) * width + w_im]
+                  : static_cast<T>(0);
+            }
           }
         }
 
@@ -11,10 +11,16 @@
 #include <ATen/Functions.h>
 #include <ATen/NativeFunctions.h>
 #else
+#include <ATen/ops/_fused_layer_norm_linear_native.h>
+#include <ATen/ops/_fused_rms_norm.h>
+#include <ATen/ops/_fused_rms_norm_native.h>
+#include <ATen/ops/_fused_rms_norm_backward_native.h>
 #include <ATen/ops/empty.h>
 #include <ATen/ops/empty_like.h>
 #include <ATen/ops/empty_like_native.h>
+#include <ATen/ops/layer_norm.h>
 #include <ATen/ops/layer_norm_native.h>
+#include <ATen/ops/linear.h>
 #include <ATen/ops/native_batch_norm.h>
 #include <ATen/ops/native_layer_norm.h>
 #include <ATen/ops/native_layer_norm_backward_native.h>
@@ -198,8 +204,117 @@ Tensor layer_norm_symint(
   return std::get<0>(at::native_layer_norm_symint(input, normalized_shape, weight, bias, eps));
 }
 
+// Generic fallback for _fused_layer_norm_linear: norm then projection as
+// two ops. The CUDA backend (layer_norm_kernel.cu) provides the fused
+// version; this keeps the op usable on every other backend.
+Tensor _fused_layer_norm_linear(
+    const Tensor& input,
+    IntArrayRef normalized_shape,
+    const std::optional<Tensor>& weight_opt /* optional */,
+    const std::optional<Tensor>& bias_opt /* optional */,
+    double eps,
+    const Tensor& proj_weight,
+    const std::optional<Tensor>& proj_bias_opt /* optional */) {
+  TORCH_CHECK(
+      normalized_shape.size() == 1,
+      "_fused_layer_norm_linear: normalized_shape must be 1-D (the hidden "
+      "dimension), got ",
+      normalized_shape.size(),
+      "-D");
+  auto normed =
+      at::layer_norm(input, normalized_shape, weight_opt, bias_opt, eps);
+  return at::linear(normed, proj_weight, proj_bias_opt);
+}
+
+std::tuple<Tensor, Tensor> _fused_rms_norm_cpu(
+    const Tensor& input,
+    IntArrayRef normalized_shape,
+    const std::optional<Tensor>& weight_opt /* optional */,
+    double eps) {
+  // See [Note: hacky wrapper removal for optional tensor]
+  c10::MaybeOwned<Tensor> weight_maybe_owned = at::borrow_from_optional_tensor(weight_opt);
+  const Tensor& weight = *weight_maybe_owned;
+  auto bias_opt = at::optional<Tensor>();
+  const Tensor& bias = *at::borrow_from_optional_tensor(bias_opt);
+
+  auto M_N = _check_layer_norm_inputs(input, normalized_shape, weight, bias);
+  auto M = M_N.first;
+  auto N = M_N.second;
+  auto X = input.expect_contiguous();
+  auto gamma = weight.expect_contiguous();
+
+  Tensor Y = at::native::empty_like(
+      *X,
+      c10::nullopt /* dtype */,
+      c10::nullopt /* layout */,
+      c10::nullopt /* device */,
+      c10::nullopt /* pin_memory */,
+      at::MemoryFormat::Contiguous);
+  Tensor rstd = at::empty({M}, X->options());
+  if (M > 0) {
+    RmsNormKernel(kCPU, *X, *gamma, M, N, eps, &Y, &rstd);
+  }
+  return std::make_tuple(std::move(Y), std::move(rstd));
+}
+
+std::tuple<Tensor, Tensor> _fused_rms_norm_backward_cpu(
+    const Tensor& dY,
+    const Tensor& input,
+    IntArrayRef normalized_shape,
+    const Tensor& rstd,
+    const std::optional<Tensor>& weight_opt /* optional */,
+    std::array<bool, 2> grad_input_mask) {
+  // See [Note: hacky wrapper removal for optional tensor]
+  c10::MaybeOwned<Tensor> weight_maybe_owned =
+      at::borrow_from_optional_tensor(weight_opt);
+  const Tensor& weight = *weight_maybe_owned;
+  auto bias_opt = at::optional<Tensor>();
+  const Tensor& bias = *at::borrow_from_optional_tensor(bias_opt);
+
+  auto M_N = _check_layer_norm_inputs(input, normalized_shape, weight, bias);
+  auto M = M_N.first;
+  auto N = M_N.second;
+  auto X = input.expect_contiguous();
+  auto gamma = weight.expect_contiguous();
+
+  Tensor dX;
+  Tensor dgamma;
+  if (grad_input_mask[0]) {
+    dX = at::native::empty_like(
+        *X,
+        c10::nullopt /* dtype */,
+        c10::nullopt /* layout */,
+        c10::nullopt /* device */,
+        c10::nullopt /* pin_memory */,
+        at::MemoryFormat::Contiguous);
+  }
+  if (grad_input_mask[1]) {
+    dgamma = M > 0 ? at::native::empty_like(
+                         *gamma,
+                         c10::nullopt /* dtype */,
+                         c10::nullopt /* layout */,
+                         c10::nullopt /* device */,
+                         c10::nullopt /* pin_memory */,
+                         at::MemoryFormat::Contiguous)
+                   : at::native::zeros_like(
+                         *gamma,
+                         c10::nullopt /* dtype */,
+                         c10::nullopt /* layout */,
+                         c10::nullopt /* device */,
+                         c10::nullopt /* pin_memory */,
+                         at::MemoryFormat::Contiguous);
+  }
+  if (M > 0 && N > 0) {
+    RmsNormBackwardKernel(
+        kCPU, dY, *X, rstd, *gamma, M, N, &dX, &dgamma);
+  }
+  return std::make_tuple(std::move(dX), std::move(dgamma));
+}
+
 DEFINE_DISPATCH(LayerNormKernel);
 DEFINE_DISPATCH(LayerNormBackwardKernel);
+DEFINE_DISPATCH(RmsNormKernel);
+DEFINE_DISPATCH(RmsNormBackwardKernel);
 
 // Ported from pytorch/xla repo
 std::tuple<Tensor, Tensor, Tensor> math_native_layer_norm(
@@ -276,6 +391,29 @@ Tensor rms_norm(
   const Tensor& bias = *at::borrow_from_optional_tensor(bias_opt);
   (void) _check_layer_norm_inputs(input, normalized_shape, weight, bias);
 
+  // Take the fused kernel when it supports the inputs; it avoids materializing
+  // the pow/mean/rsqrt/mul intermediates of the decomposed form below.
+  const bool can_fuse = (input.device().is_cpu() || input.device().is_cuda()) &&
+      at::isFloatingType(input.scalar_type()) &&
+      (!weight.defined() ||
+       (weight.scalar_type() == input.scalar_type() &&
+        weight.device() == input.device()));
+  if (can_fuse) {
+    double eps_val = std::numeric_limits<double>::epsilon();
+    if (eps.has_value()) {
+      eps_val = eps.value();
+    } else {
+      AT_DISPATCH_FLOATING_TYPES_AND2(
+          at::ScalarType::Half,
+          at::ScalarType::BFloat16,
+          input.scalar_type(),
+          "rms_norm",
+          [&] { eps_val = std::numeric_limits<scalar_t>::epsilon(); });
+    }
+    return std::get<0>(
+        at::_fused_rms_norm(input, normalized_shape, weight_opt, eps_val));
+  }
+
   std::vector<int64_t> dims_to_reduce;
   for (const auto i : c10::irange(normalized_shape.size())) {
     dims_to_reduce.push_back(input.dim() - i - 1);
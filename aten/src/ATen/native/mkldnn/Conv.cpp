@@ -35,9 +35,12 @@ REGISTER_NO_CPU_DISPATCH(mkldnn_convolution_transpose_backward_stub);
 
 #else // AT_MKLDNN_ENABLED
 
+#include <ATen/Parallel.h>
 #include <ATen/native/mkldnn/MKLDNNCommon.h>
+#include <ATen/native/mkldnn/PrimitiveCache.h>
 #include <ATen/native/mkldnn/Utils.h>
 #include <ATen/native/ConvUtils.h>
+#include <c10/util/hash.h>
 #include <c10/util/irange.h>
 
 namespace at { namespace native {
@@ -162,6 +165,110 @@ static inline at::MemoryFormat mkldnn_convolution_memory_format(int64_t dims, bo
    return memory_format;
 }
 
+// Key identifying a convolution primitive for the dense (non-prepacked)
+// path: everything that determines the oneDNN primitive descriptor, but not
+// the weight values, so distinct convolutions with the same geometry share
+// one entry. The thread count participates because oneDNN may select a
+// different implementation depending on the threading budget (same
+// convention as NumOfThreads in the quantized PrimitiveCacheKey).
+struct ConvPrimitiveCacheKey {
+  std::vector<int64_t> input_size;
+  std::vector<int64_t> weight_size;
+  std::vector<int64_t> stride;
+  std::vector<int64_t> dilation;
+  std::vector<int64_t> padding;
+  int64_t groups;
+  bool has_bias;
+  bool is_channels_last;
+  ScalarType input_dtype;
+  ScalarType weight_dtype;
+  int64_t num_threads;
+
+  bool operator==(const ConvPrimitiveCacheKey& other) const {
+    return input_size == other.input_size &&
+        weight_size == other.weight_size && stride == other.stride &&
+        dilation == other.dilation && padding == other.padding &&
+        groups == other.groups && has_bias == other.has_bias &&
+        is_channels_last == other.is_channels_last &&
+        input_dtype == other.input_dtype &&
+        weight_dtype == other.weight_dtype &&
+        num_threads == other.num_threads;
+  }
+
+  struct Hash {
+    size_t operator()(const ConvPrimitiveCacheKey& key) const {
+      return c10::get_hash(
+          key.input_size,
+          key.weight_size,
+          key.stride,
+          key.dilation,
+          key.padding,
+          key.groups,
+          key.has_bias,
+          key.is_channels_last,
+          key.input_dtype,
+          key.weight_dtype,
+          key.num_threads);
+    }
+  };
+};
+
+static mkldnn::ShardedPrimitiveCache<
+    ConvPrimitiveCacheKey,
+    ideep::convolution_forward_params>&
+conv_primitive_cache() {
+  static mkldnn::ShardedPrimitiveCache<
+      ConvPrimitiveCacheKey,
+      ideep::convolution_forward_params>
+      cache;
+  return cache;
+}
+
+// Looks up (or prepares and caches) the forward params for the given
+// convolution. The returned params hold the primitive descriptor only, not
+// any tensor data, so they are safe to share across calls and threads.
+static ideep::convolution_forward_params* _mkldnn_get_conv_forward_params(
+    const ConvPrimitiveCacheKey& key,
+    const ideep::tensor& x,
+    const ideep::tensor& w,
+    const ideep::tensor& b,
+    IntArrayRef output_sizes,
+    ideep::tensor& y,
+    IntArrayRef stride,
+    IntArrayRef dilation,
+    IntArrayRef padding,
+    int64_t groups,
+    const ideep::attr_t& op_attr) {
+  auto& cache = conv_primitive_cache();
+  if (auto* params = cache.find(key)) {
+    return params;
+  }
+  auto params = std::make_unique<ideep::convolution_forward_params>();
+  ideep::convolution_forward::prepare(
+      *params,
+      x,
+      w,
+      b,
+      {output_sizes.begin(), output_sizes.end()},
+      y,
+      {stride.begin(), stride.end()},
+      {dilation.begin(), dilation.end()},
+      {padding.begin(), padding.end()},
+      {padding.begin(), padding.end()},
+      groups,
+      ideep::scale_t(),
+      ideep::scale_t(),
+      ideep::scale_t(),
+      ideep::zero_point_t(),
+      ideep::zero_point_t(),
+      op_attr,
+      dnnl::algorithm::convolution_direct,
+      dnnl::prop_kind::forward,
+      ideep::u8s8,
+      ideep::engine::cpu_engine());
+  return cache.insert(key, std::move(params));
+}
+
 static void _mkldnn_convolution_out (
     const Tensor& input_t,
     const Tensor& weight_t,
@@ -173,12 +280,42 @@ static void _mkldnn_convolution_out (
     IntArrayRef padding,
     int64_t groups,
     bool is_channels_last,
-    const ideep::attr_t& op_attr) {
+    const ideep::attr_t& op_attr,
+    bool use_primitive_cache = false) {
   auto memory_format = mkldnn_convolution_memory_format(input_t.ndimension(), is_channels_last);
   auto input = input_t.is_mkldnn() ? input_t : input_t.contiguous(memory_format);
   auto weight = weight_t.is_mkldnn() ? weight_t : weight_t.contiguous(memory_format);
   const ideep::tensor x = itensor_from_tensor(input, /*from_const_data_ptr*/true);
   const ideep::tensor w = itensor_from_tensor(weight, /*from_const_data_ptr*/true);
+  if (use_primitive_cache && !input_t.is_mkldnn() && !weight_t.is_mkldnn()) {
+    // Shared-primitive-cache path: reuse the primitive descriptor prepared
+    // by any thread (or by mkldnn::_prewarm_convolution at model load)
+    // instead of redoing primitive creation per thread-local cache.
+    const ideep::tensor b = bias.defined()
+        ? itensor_from_tensor(bias, /*from_const_data_ptr*/true)
+        : ideep::tensor();
+    ConvPrimitiveCacheKey key{
+        input.sizes().vec(),
+        weight.sizes().vec(),
+        stride.vec(),
+        dilation.vec(),
+        padding.vec(),
+        groups,
+        bias.defined(),
+        is_channels_last,
+        input.scalar_type(),
+        weight.scalar_type(),
+        at::get_num_threads()};
+    auto* params = _mkldnn_get_conv_forward_params(
+        key, x, w, b, output_sizes, y, stride, dilation, padding, groups, op_attr);
+    auto expected_weight = w.reorder_if_differ_in(
+        ideep::tensor::desc(params->pd.weights_desc(), groups));
+    // Unlike the quantized path, the source may still be in the user layout
+    // here, so leave the source reorder to the primitive execution.
+    ideep::convolution_forward::compute</*reorder_src=*/true, /*reorder_weight=*/false>(
+        *params, x, expected_weight, b, y);
+    return;
+  }
   if (bias.defined()) {
     const ideep::tensor b = itensor_from_tensor(bias, /*from_const_data_ptr*/true);
     ideep::convolution_forward::compute_v3(
@@ -264,7 +401,10 @@ static Tensor _mkldnn_convolution(
       padding_expanded,
       groups,
       use_channels_last,
-      op_attr);
+      op_attr,
+      // Fused variants carry post-ops that are not part of the cache key,
+      // so only the plain convolution takes the shared primitive cache.
+      /*use_primitive_cache=*/attr == "none");
 
   if (input_t.is_mkldnn()) {
     return MKLDNNTensor(y, input_t.options());
@@ -1040,6 +1180,34 @@ std::tuple<Tensor, Tensor, Tensor> mkldnn_convolution_transpose_backward(
   }
   return std::make_tuple(grad_input, grad_weight, grad_bias);
 }
+
+// Builds (and caches) the oneDNN forward primitive for a convolution with
+// the given weight and input geometry, so the first real inference request
+// for that shape does not pay primitive creation. Intended to be called at
+// model load for each convolution whose input shapes are known.
+void mkldnn_prewarm_convolution(
+    const Tensor& weight,
+    const std::optional<Tensor>& bias,
+    IntArrayRef input_size,
+    IntArrayRef padding,
+    IntArrayRef stride,
+    IntArrayRef dilation,
+    int64_t groups) {
+  TORCH_CHECK(
+      !weight.is_mkldnn(),
+      "mkldnn::_prewarm_convolution: expected a dense weight");
+  TORCH_CHECK(
+      static_cast<int64_t>(input_size.size()) == weight.ndimension(),
+      "mkldnn::_prewarm_convolution: input_size must have ",
+      weight.ndimension(),
+      " elements to match the weight");
+  c10::impl::ExcludeDispatchKeyGuard edkg(c10::autograd_dispatch_keyset);
+  // Running the convolution once on scratch input both prepares the shared
+  // primitive params and warms oneDNN's per-thread state for the calling
+  // thread.
+  auto input = at::empty(input_size, weight.options());
+  mkldnn_convolution(input, weight, bias, padding, stride, dilation, groups);
+}
 }
 
 REGISTER_ALL_CPU_DISPATCH(mkldnn_convolution_transpose_stub, &mkldnn_convolution_transpose);
@@ -1058,6 +1226,9 @@ TORCH_LIBRARY_IMPL(mkldnn, CPU, m) {
   m.impl(
       TORCH_SELECTIVE_NAME("mkldnn::_convolution_transpose_pointwise"),
       TORCH_FN(mkldnn_convolution_transpose_pointwise));
+  m.impl(
+      TORCH_SELECTIVE_NAME("mkldnn::_prewarm_convolution"),
+      TORCH_FN(mkldnn_prewarm_convolution));
 }
 
 TORCH_LIBRARY_IMPL(mkldnn, MkldnnCPU, m) {
@@ -0,0 +1,134 @@
+#include <vector>
+
+#include <ATen/native/mkldnn/Common.h>
+#include <ATen/native/mkldnn/LinearPrepack.h>
+#include <ATen/native/mkldnn/MKLDNNCommon.h>
+#include <ATen/native/mkldnn/OpContext.h>
+#include <ATen/native/mkldnn/Utils.h>
+
+#if AT_MKLDNN_ENABLED()
+
+namespace at {
+namespace native {
+namespace mkldnn {
+namespace internal {
+namespace linear {
+
+c10::intrusive_ptr<mkldnn::LinearOpContext> createLinearPrePackOpContext(
+    Tensor weight,
+    std::optional<Tensor> bias,
+    std::optional<int64_t> batch_size,
+    std::string attr) {
+  return mkldnn::MkldnnLinearOpContext::create_context(
+      std::move(weight), std::move(bias), batch_size, attr);
+}
+
+ContextLinear create(
+    const Tensor& weight,
+    const std::optional<Tensor>& bias,
+    const std::optional<int64_t> batch_size,
+    const ideep::attr_t& attr) {
+  TORCH_CHECK(
+      weight.dim() == 2,
+      "linear_prepack: expected a 2d weight, got ",
+      weight.dim(),
+      "d");
+  mkldnn_check_low_precision(weight.scalar_type(), "linear_prepack");
+  const int64_t out_features = weight.size(0);
+  const int64_t in_features = weight.size(1);
+
+  c10::impl::ExcludeDispatchKeyGuard edkg(c10::autograd_dispatch_keyset);
+  auto weight_ = weight.contiguous();
+  auto w = itensor_view_from_dense(weight_);
+  // Querying oneDNN for the blocked layout it would pick at execution time
+  // and reordering once here removes the per-call pack (and the primitive
+  // cache hash lookup for the reorder) from the hot path.
+  ideep::dims input_size;
+  if (batch_size.has_value()) {
+    input_size = {batch_size.value(), in_features};
+  }
+  auto packed_desc = ideep::inner_product_forward::expected_weights_desc(
+      {out_features, in_features},
+      input_size,
+      /* weight dtype */ w.get_data_type(),
+      /* src dtype */ w.get_data_type());
+  ideep::tensor packed_weight;
+  packed_weight.init(packed_desc);
+  packed_weight.feed_from(w);
+
+  return ContextLinear{
+      std::move(packed_weight),
+      bias.has_value() ? c10::make_optional(*bias) : c10::nullopt,
+      attr};
+}
+
+Tensor run(ContextLinear& context, const Tensor& input) {
+  const ideep::tensor& mkldnn_weight = context.weight_packed_;
+
+  auto input_ = input.contiguous();
+  const int64_t dim = input_.dim();
+  auto input_reshaped = dim == 2
+      ? input_
+      : input_.reshape({-1, input_.size(input_.dim() - 1)});
+
+  std::vector<int64_t> output_size(
+      input_.sizes().begin(), input_.sizes().end() - 1);
+  output_size.push_back(mkldnn_weight.get_dim(0));
+  auto output = at::empty(output_size, input_.options());
+  if (output.numel() == 0) {
+    return output;
+  }
+  if (dim != 2) {
+    std::vector<int64_t> output_size_reshaped = {
+        input_reshaped.size(0), mkldnn_weight.get_dim(0)};
+    output = output.reshape(output_size_reshaped);
+  }
+
+  c10::MaybeOwned<Tensor> bias_maybe_owned =
+      at::borrow_from_optional_tensor(context.at_bias_);
+  const Tensor& bias = *bias_maybe_owned;
+
+  c10::impl::ExcludeDispatchKeyGuard edkg(c10::autograd_dispatch_keyset);
+  ideep::tensor mkldnn_output = itensor_from_tensor(output);
+  const ideep::tensor mkldnn_input = itensor_view_from_dense(input_reshaped);
+  std::optional<ideep::tensor> mkldnn_bias{c10::nullopt};
+  if (bias.defined()) {
+    mkldnn_bias = itensor_from_tensor(bias);
+  }
+
+  if (mkldnn_bias.has_value()) {
+    ideep::inner_product_forward::compute<
+        /*reorder_src=*/false,
+        /*reorder_weight=*/false>(
+        mkldnn_input,
+        mkldnn_weight,
+        mkldnn_bias.value(),
+        mkldnn_output,
+        context.attr_);
+  } else {
+    ideep::inner_product_forward::compute<
+        /*reorder_src=*/false,
+        /*reorder_weight=*/false>(
+        mkldnn_input, mkldnn_weight, mkldnn_output, context.attr_);
+  }
+
+  if (dim != 2) {
+    output = output.reshape(output_size);
+  }
+
+  return output;
+}
+
+Tensor linear_run(
+    const Tensor& input,
+    const c10::intrusive_ptr<mkldnn::LinearOpContext>& op_context) {
+  return op_context->run(input);
+}
+
+} // namespace linear
+} // namespace internal
+} // namespace mkldnn
+} // namespace native
+} // namespace at
+
+#endif // AT_MKLDNN_ENABLED()
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <ATen/Tensor.h>
+#include <ATen/native/mkldnn/Common.h>
+#include <ATen/native/mkldnn/OpContext.h>
+
+#if AT_MKLDNN_ENABLED()
+
+namespace at {
+namespace native {
+namespace mkldnn {
+namespace internal {
+namespace linear {
+
+c10::intrusive_ptr<mkldnn::LinearOpContext> createLinearPrePackOpContext(
+    Tensor weight,
+    std::optional<Tensor> bias,
+    std::optional<int64_t> batch_size,
+    std::string attr);
+
+Tensor linear_run(
+    const Tensor& input,
+    const c10::intrusive_ptr<mkldnn::LinearOpContext>& op_context);
+
+ContextLinear create(
+    const Tensor& weight,
+    const std::optional<Tensor>& bias,
+    const std::optional<int64_t> batch_size,
+    const ideep::attr_t& attr);
+
+Tensor run(ContextLinear& context, const Tensor& input);
+
+} // namespace linear
+} // namespace internal
+} // namespace mkldnn
+} // namespace native
+} // namespace at
+
+#endif // AT_MKLDNN_ENABLED()
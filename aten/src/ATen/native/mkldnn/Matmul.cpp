@@ -137,6 +137,12 @@ mkldnn_gemm(
     op_attr = ideep::attr_t::fuse_sum();
   }
   if (std::is_same_v<scalar_t, float>) op_attr.set_fpmath_mode(dnnl_fpmath_mode_bf16); // bf32 path
+  if ((std::is_same_v<scalar_t, c10::BFloat16> && at::globalContext().allowBF16ReductionCPU()) ||
+      (std::is_same_v<scalar_t, c10::Half> && at::globalContext().allowFP16ReductionCPU())) {
+    // Let oneDNN accumulate in the input precision where that selects a
+    // faster kernel (e.g. bf16 accumulation chains on AMX).
+    op_attr.set_accumulation_mode(dnnl::accumulation_mode::relaxed);
+  }
 
   // NOTE: View as c-contiguous to avoid extra reordering in mkldnn
   // Use identity: C = AB <=> C^T = B^T A^T
@@ -277,6 +283,10 @@ void mkldnn_matmul(
   // to address their differences, we use mkldnn post ops to perform a fused "add" after matrix multiplication is over
   if (beta != 0.0f) op_attr = ideep::attr_t::fuse_sum();
   if (mat1.scalar_type() == at::kFloat) op_attr.set_fpmath_mode(dnnl_fpmath_mode_bf16); // bf32 path
+  if ((mat1.scalar_type() == at::kBFloat16 && at::globalContext().allowBF16ReductionCPU()) ||
+      (mat1.scalar_type() == at::kHalf && at::globalContext().allowFP16ReductionCPU())) {
+    op_attr.set_accumulation_mode(dnnl::accumulation_mode::relaxed);
+  }
   // If alpha = 0, dose not need actually do gemm computation
   if (alpha == 0)
     return;
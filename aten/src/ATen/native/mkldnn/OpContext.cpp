@@ -2,6 +2,7 @@
 
 #if AT_MKLDNN_ENABLED()
 #include <ATen/native/mkldnn/ConvPrepack.h>
+#include <ATen/native/mkldnn/LinearPrepack.h>
 
 namespace at {
 namespace native {
@@ -40,6 +41,30 @@ void MkldnnConvOpContext::run(const Tensor& input, void* output) {
   mkldnn::internal::convolution::run(op_context_, input, output);
 }
 
+c10::intrusive_ptr<LinearOpContext> MkldnnLinearOpContext::create_context(
+    at::Tensor&& weight,
+    std::optional<at::Tensor>&& bias,
+    std::optional<int64_t> batch_size,
+    const std::string& attr) {
+  auto it = fusion_attr_map.find(attr);
+  TORCH_CHECK(it != fusion_attr_map.end(), "Fusion behavior undefined.");
+  const ideep::attr_t& op_attr = it->second;
+
+  auto op_context =
+      mkldnn::internal::linear::create(weight, bias, batch_size, op_attr);
+
+  return c10::make_intrusive<MkldnnLinearOpContext>(
+      std::move(weight),
+      std::move(bias),
+      batch_size,
+      attr,
+      std::move(op_context));
+}
+
+Tensor MkldnnLinearOpContext::run(const Tensor& input) {
+  return mkldnn::internal::linear::run(op_context_, input);
+}
+
 } // namespace mkldnn
 } // namespace native
 } // namespace at
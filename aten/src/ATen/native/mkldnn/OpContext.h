@@ -92,6 +92,54 @@ class MkldnnConvOpContext final : public ConvOpContext {
       const ideep::attr_t& attr);
 };
 
+using SerializationTypeLinearPrePack = std::tuple<
+    Tensor,
+    std::optional<Tensor>,
+    std::optional<int64_t>,
+    std::string>;
+
+class LinearOpContext : public torch::jit::CustomClassHolder {
+ protected:
+  Tensor orig_weight_;
+  std::optional<Tensor> orig_bias_;
+  std::optional<int64_t> batch_size_;
+  std::string attr_;
+
+ public:
+  SerializationTypeLinearPrePack unpack() {
+    return std::make_tuple(orig_weight_, orig_bias_, batch_size_, attr_);
+  }
+
+  virtual Tensor run(const Tensor& input) = 0;
+};
+
+class MkldnnLinearOpContext final : public LinearOpContext {
+ private:
+  ContextLinear op_context_;
+
+ public:
+  MkldnnLinearOpContext(
+      Tensor&& weight,
+      std::optional<Tensor>&& bias,
+      std::optional<int64_t> batch_size,
+      std::string attr,
+      ContextLinear&& op_context)
+      : op_context_(std::move(op_context)) {
+    orig_weight_ = std::move(weight);
+    orig_bias_ = std::move(bias);
+    batch_size_ = batch_size;
+    attr_ = std::move(attr);
+  }
+
+  Tensor run(const Tensor& input) override;
+
+  static c10::intrusive_ptr<LinearOpContext> create_context(
+      Tensor&& weight,
+      std::optional<Tensor>&& bias,
+      std::optional<int64_t> batch_size,
+      const std::string& attr);
+};
+
 } // namespace mkldnn
 } // namespace native
 } // namespace at
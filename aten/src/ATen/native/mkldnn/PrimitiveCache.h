@@ -0,0 +1,65 @@
+#pragma once
+
+#include <ATen/Config.h>
+
+#if AT_MKLDNN_ENABLED()
+
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+
+namespace at { namespace native { namespace mkldnn {
+
+// A process-wide, sharded, read-mostly cache for oneDNN primitive
+// descriptors/params.
+//
+// ideep keeps its own primitive caches thread-local, so on a many-core
+// inference box every worker thread pays primitive construction for every
+// shape it sees first. This cache is shared: a shape prepared once (by any
+// thread, or by an explicit pre-warm pass at model load) is a cheap lookup
+// for all threads afterwards.
+//
+// Concurrency model: lookups take a per-shard shared_lock, so steady-state
+// inference (all hits) only does uncontended reader acquisitions spread
+// over kNumShards locks. Insertions take the shard's exclusive lock; they
+// only happen the first time a shape is seen. Entries are never evicted,
+// so pointers returned by find()/insert() stay valid for the lifetime of
+// the process and can be used outside the lock.
+template <typename Key, typename Value, size_t kNumShards = 16>
+class ShardedPrimitiveCache {
+ public:
+  // Returns the cached value for key, or nullptr on miss.
+  Value* find(const Key& key) {
+    auto& shard = shard_for(key);
+    std::shared_lock<std::shared_mutex> lock(shard.mutex);
+    auto it = shard.map.find(key);
+    return it == shard.map.end() ? nullptr : it->second.get();
+  }
+
+  // Inserts value for key and returns the cached entry. If another thread
+  // raced us and inserted first, the existing entry wins and is returned;
+  // the equivalent loser is discarded.
+  Value* insert(const Key& key, std::unique_ptr<Value> value) {
+    auto& shard = shard_for(key);
+    std::unique_lock<std::shared_mutex> lock(shard.mutex);
+    auto it = shard.map.emplace(key, std::move(value)).first;
+    return it->second.get();
+  }
+
+ private:
+  struct Shard {
+    std::shared_mutex mutex;
+    std::unordered_map<Key, std::unique_ptr<Value>, typename Key::Hash> map;
+  };
+
+  Shard& shard_for(const Key& key) {
+    return shards_[typename Key::Hash()(key) % kNumShards];
+  }
+
+  Shard shards_[kNumShards];
+};
+
+}}} // namespace at::native::mkldnn
+
+#endif // AT_MKLDNN_ENABLED()
@@ -4,6 +4,7 @@
 
 #include <ATen/Tensor.h>
 #include <ATen/native/mkldnn/ConvPrepack.h>
+#include <ATen/native/mkldnn/LinearPrepack.h>
 #include <ATen/native/mkldnn/OpContext.h>
 #include <ATen/native/mkldnn/Utils.h>
 #include <torch/custom_class.h>
@@ -51,6 +52,21 @@ TORCH_LIBRARY(mkldnn, m) {
                 std::move(std::get<7>(state)));
           });
 
+  m.class_<LinearOpContext>(TORCH_SELECTIVE_CLASS("LinearOpContext"))
+      .def_pickle(
+          [](const c10::intrusive_ptr<LinearOpContext>& op_context)
+              -> SerializationTypeLinearPrePack { // __getstate__
+            return op_context->unpack();
+          },
+          [](SerializationTypeLinearPrePack state)
+              -> c10::intrusive_ptr<LinearOpContext> { // __setstate__
+            return internal::linear::createLinearPrePackOpContext(
+                std::move(std::get<0>(state)),
+                std::move(std::get<1>(state)),
+                std::move(std::get<2>(state)),
+                std::move(std::get<3>(state)));
+          });
+
   m.def(TORCH_SELECTIVE_SCHEMA(
       "mkldnn::_linear_pointwise(Tensor X, Tensor W, Tensor? B, str attr, Scalar?[] scalars, str? algorithm) -> Tensor Y"));
   m.def(TORCH_SELECTIVE_SCHEMA(
@@ -71,6 +87,8 @@ TORCH_LIBRARY(mkldnn, m) {
       "mkldnn::_reorder_convolution_weight(Tensor self, int[2] padding=0, int[2] stride=1, int[2] dilation=1, int groups=1, int[]? input_size=None) -> Tensor Y"));
   m.def(TORCH_SELECTIVE_SCHEMA(
       "mkldnn::_reorder_mkldnn_rnn_layer_weight(Tensor weight0, Tensor weight1, int hidden_size, bool reverse, bool has_biases, bool batch_first, int[]? input_size=None) -> Tensor[] Y"));
+  m.def(TORCH_SELECTIVE_SCHEMA(
+      "mkldnn::_prewarm_convolution(Tensor W, Tensor? B, int[] input_size, int[] padding, int[] stride, int[] dilation, int groups) -> ()"));
   m.def("_is_mkldnn_bf16_supported", &is_mkldnn_bf16_supported);
   m.def("_is_mkldnn_fp16_supported", &is_mkldnn_fp16_supported);
   m.def("_is_mkldnn_acl_supported", &is_mkldnn_acl_supported);
@@ -85,6 +103,12 @@ TORCH_LIBRARY(mkldnn_prepacked, m) {
 
   m.def(TORCH_SELECTIVE_SCHEMA(
       "mkldnn_prepacked::conv2d_run(Tensor X, __torch__.torch.classes.mkldnn.ConvOpContext W_prepack) -> Tensor Y"));
+
+  m.def(TORCH_SELECTIVE_SCHEMA(
+      "mkldnn_prepacked::linear_prepack(Tensor W, Tensor? B, int? batch_size, str attr) -> __torch__.torch.classes.mkldnn.LinearOpContext"));
+
+  m.def(TORCH_SELECTIVE_SCHEMA(
+      "mkldnn_prepacked::linear_run(Tensor X, __torch__.torch.classes.mkldnn.LinearOpContext W_prepack) -> Tensor Y"));
 }
 
 TORCH_LIBRARY_IMPL(mkldnn_prepacked, CPU, m) {
@@ -94,6 +118,14 @@ TORCH_LIBRARY_IMPL(mkldnn_prepacked, CPU, m) {
 
   m.impl(
       TORCH_SELECTIVE_NAME("mkldnn_prepacked::conv2d_run"), TORCH_FN(conv_run));
+
+  m.impl(
+      TORCH_SELECTIVE_NAME("mkldnn_prepacked::linear_prepack"),
+      TORCH_FN(internal::linear::createLinearPrePackOpContext));
+
+  m.impl(
+      TORCH_SELECTIVE_NAME("mkldnn_prepacked::linear_run"),
+      TORCH_FN(internal::linear::linear_run));
 }
 
 } // namespace mkldnn
@@ -5,6 +5,7 @@
 #include <ATen/Functions.h>
 #include <ATen/NativeFunctions.h>
 #include <ATen/NestedTensorImpl.h>
+#include <ATen/Parallel.h>
 #include <ATen/ScalarOps.h>
 #include <ATen/TensorIndexing.h>
 #include <ATen/TensorOperators.h>
@@ -14,6 +15,7 @@
 #include <ATen/native/layer_norm.h>
 #include <ATen/native/nested/NestedTensorUtils.h>
 
+#include <cstring>
 #include <tuple>
 
 namespace at {
@@ -56,6 +58,64 @@ Tensor pad_tensor_to_shape(
   new_tensor = new_tensor.reshape(goal_shape);
   return new_tensor;
 }
+
+// Shared copy loop for the contiguous CPU padded<->nested fast paths:
+// moves each component's rows directly between the packed nested buffer and
+// the component's slot in the padded tensor, parallelized over components.
+// The inner loop is a memcpy of the innermost component dimension, so it
+// works for every dtype without dispatch.
+void copy_padded_nested_cpu(
+    char* padded_data,
+    char* nested_data,
+    const int64_t* sizes_ptr,
+    int64_t ncomponents,
+    int64_t component_dim,
+    const int64_t* offsets_ptr,
+    IntArrayRef padded_shape,
+    int64_t itemsize,
+    bool to_padded) {
+  const int64_t d = component_dim;
+  // contiguous strides (in elements) of one padded component slot
+  std::vector<int64_t> slot_strides(d);
+  int64_t slot_numel = 1;
+  for (int64_t k = d - 1; k >= 0; k--) {
+    slot_strides[k] = slot_numel;
+    slot_numel *= padded_shape[k + 1];
+  }
+  at::parallel_for(0, ncomponents, 1, [&](int64_t begin, int64_t end) {
+    for (const auto i : c10::irange(begin, end)) {
+      const int64_t* sizes_i = sizes_ptr + i * d;
+      const int64_t row_len = sizes_i[d - 1];
+      if (row_len == 0) {
+        continue;
+      }
+      int64_t nrows = 1;
+      for (int64_t k = 0; k < d - 1; k++) {
+        nrows *= sizes_i[k];
+      }
+      char* slot = padded_data + i * slot_numel * itemsize;
+      char* buf = nested_data + offsets_ptr[i] * itemsize;
+      const int64_t row_bytes = row_len * itemsize;
+      for (const auto r : c10::irange(nrows)) {
+        // decompose the packed row index into component indices to find
+        // the row's offset within the (larger) padded slot
+        int64_t slot_off = 0;
+        int64_t rem = r;
+        for (int64_t k = d - 2; k >= 0; k--) {
+          slot_off += (rem % sizes_i[k]) * slot_strides[k];
+          rem /= sizes_i[k];
+        }
+        char* padded_row = slot + slot_off * itemsize;
+        char* nested_row = buf + r * row_bytes;
+        if (to_padded) {
+          std::memcpy(padded_row, nested_row, row_bytes);
+        } else {
+          std::memcpy(nested_row, padded_row, row_bytes);
+        }
+      }
+    }
+  });
+}
 } // namespace
 
 
@@ -226,6 +286,50 @@ Tensor nested_from_padded_generic(
     }
   }
   IntArrayRef target_size_arr(target_size);
+
+  // Fast path for CPU when the mask region would exactly tile the padded
+  // tensor: gather each component's valid prefix block directly into the
+  // packed buffer in parallel, instead of materializing per-component
+  // boolean masks and doing a masked_select over the whole padded tensor.
+  bool sizes_match_padded = true;
+  for (size_t ii = 0; ii < dim - 1; ++ii) {
+    sizes_match_padded = sizes_match_padded &&
+        target_size[ii] == padded_transformed.sizes()[ii + 1];
+  }
+  if (padded_transformed.device().is_cpu() && sizes_match_padded) {
+    if (!padded_transformed.is_contiguous()) {
+      // also normalizes channels-last inputs
+      padded_transformed = padded_transformed.contiguous();
+    }
+    const auto ncomponents = sizes.sizes()[0];
+    const auto component_dim = sizes.sizes()[1];
+    const int64_t* sizes_ptr = sizes.const_data_ptr<int64_t>();
+    std::vector<int64_t> offsets(ncomponents);
+    int64_t total_numel = 0;
+    for (const auto i : c10::irange(ncomponents)) {
+      offsets[i] = total_numel;
+      int64_t numel_i = 1;
+      for (const auto k : c10::irange(component_dim)) {
+        numel_i *= sizes_ptr[i * component_dim + k];
+      }
+      total_numel += numel_i;
+    }
+    Tensor new_buffer =
+        at::empty({total_numel}, padded_transformed.options());
+    copy_padded_nested_cpu(
+        static_cast<char*>(padded_transformed.data_ptr()),
+        static_cast<char*>(new_buffer.data_ptr()),
+        sizes_ptr,
+        ncomponents,
+        component_dim,
+        offsets.data(),
+        padded_transformed.sizes(),
+        padded_transformed.element_size(),
+        /*to_padded=*/false);
+    return at::detail::make_tensor<NestedTensorImpl>(
+        std::move(new_buffer), sizes);
+  }
+
   std::vector<at::Tensor> masks;
   std::vector<at::Tensor> all_sizes = sizes.unbind();
   for (const auto& size : all_sizes) {
@@ -272,6 +376,44 @@ Tensor NestedTensor_to_padded_tensor_generic(
   const auto sizes_num_columns = sizes.sizes()[1];
   const auto sizes_data_start = sizes.data_ptr<int64_t>();
   const auto sizes_data_end = sizes_data_start + sizes.numel();
+
+  // Fast path for CPU: fill one output allocation with the padding value and
+  // copy each component's rows into its slot in parallel, instead of
+  // materializing a padded copy of every component and stacking them.
+  if (nt.get_buffer().device().is_cpu()) {
+    std::vector<int64_t> out_shape;
+    out_shape.reserve(sizes_num_columns + 1);
+    out_shape.push_back(sizes_num_rows);
+    out_shape.insert(out_shape.end(), max_size.begin(), max_size.end());
+    // Fold output_size into the same allocation instead of padding twice.
+    if (output_size.has_value()) {
+      auto output_size_ = output_size.value();
+      TORCH_CHECK(
+          (int64_t)output_size_.size() == (int64_t)out_shape.size(),
+          "Length of output_size does not match NestedTensor dims. Broadcasting is not supported.");
+      for (int64_t i = 0; i < (int64_t)out_shape.size(); i++) {
+        TORCH_CHECK(
+            output_size_[i] >= out_shape[i],
+            "Value in output_size is less than NestedTensor padded size. Truncation is not supported.");
+        out_shape[i] = output_size_[i];
+      }
+    }
+    const auto buffer = nt.get_buffer();
+    Tensor output = at::empty(out_shape, buffer.options());
+    output.fill_(padding);
+    copy_padded_nested_cpu(
+        static_cast<char*>(output.data_ptr()),
+        static_cast<char*>(buffer.data_ptr()),
+        sizes_data_start,
+        sizes_num_rows,
+        sizes_num_columns,
+        nt.get_storage_offsets().const_data_ptr<int64_t>(),
+        out_shape,
+        buffer.element_size(),
+        /*to_padded=*/true);
+    return output;
+  }
+
   std::vector<int64_t> split_sizes;
   split_sizes.reserve(sizes_num_rows);
   for (auto sizes_data = sizes_data_start; sizes_data != sizes_data_end;
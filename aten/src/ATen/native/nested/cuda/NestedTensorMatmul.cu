@@ -3,6 +3,7 @@
 #include <ATen/ATen.h>
 #include <ATen/Dispatch.h>
 
+#include <ATen/cuda/CUDABlas.h>
 #include <ATen/cuda/CUDAContext.h>
 #include <ATen/cuda/detail/KernelUtils.h>
 #include <ATen/cuda/detail/IndexUtils.cuh>
@@ -394,6 +395,75 @@ Tensor bmm_nested_cuda(const Tensor& self, const Tensor& mat2) {
 #endif
 #endif
 
+  // Batches where every matrix has the same shape and leading dimensions
+  // (e.g. per-head attention slices packed into a nested tensor) that were
+  // not handled above can still run as a single cuBLAS pointer-array batched
+  // GEMM instead of one gemm launch per matrix. Only the matrix pointers
+  // differ, and the pointer arrays are staged through one pinned buffer.
+  if (ntensors > 1) {
+    bool batched_done = false;
+    AT_DISPATCH_FLOATING_TYPES_AND2(
+        at::ScalarType::Half,
+        at::ScalarType::BFloat16,
+        self.scalar_type(),
+        "bmm_nested_cuda_batched",
+        [&] {
+          const IntArrayRef& self_shape0 = get_size_for_index(self, 0);
+          const IntArrayRef& mat2_shape0 = get_size_for_index(mat2, 0);
+          const int64_t m = self_shape0[0];
+          const int64_t k = self_shape0[1];
+          const int64_t n = mat2_shape0[1];
+          if (m == 0 || n == 0 || k == 0) {
+            return;
+          }
+          const int64_t lda = get_stride_for_index(self, 0)[0];
+          const int64_t ldb = get_stride_for_index(mat2, 0)[0];
+          bool uniform = lda >= k && ldb >= n;
+          for (int64_t i = 0; uniform && i < ntensors; i++) {
+            const auto self_stride = get_stride_for_index(self, i);
+            const auto mat2_stride = get_stride_for_index(mat2, i);
+            uniform = get_size_for_index(self, i) == self_shape0 &&
+                get_size_for_index(mat2, i) == mat2_shape0 &&
+                self_stride[0] == lda && self_stride[1] == 1 &&
+                mat2_stride[0] == ldb && mat2_stride[1] == 1;
+          }
+          if (!uniform) {
+            return;
+          }
+          at::Tensor ptr_args = at::empty(
+              {ntensors * 3},
+              at::TensorOptions().dtype(at::kLong).pinned_memory(true));
+          int64_t* ptr_a_data = ptr_args.data_ptr<int64_t>();
+          int64_t* ptr_b_data = ptr_a_data + ntensors;
+          int64_t* ptr_c_data = ptr_a_data + 2 * ntensors;
+          for (int64_t i = 0; i < ntensors; i++) {
+            ptr_a_data[i] = reinterpret_cast<int64_t>(
+                self_buffer.data_ptr<scalar_t>() + get_offset_for_index(self, i));
+            ptr_b_data[i] = reinterpret_cast<int64_t>(
+                mat2_buffer.data_ptr<scalar_t>() + get_offset_for_index(mat2, i));
+            ptr_c_data[i] = reinterpret_cast<int64_t>(
+                out_buffer.data_ptr<scalar_t>() + out_offsets_ptr[i]);
+          }
+          ptr_args = ptr_args.to(output.device(), true);
+          ptr_a_data = ptr_args.data_ptr<int64_t>();
+          // The matrices are row-major, so compute out^T = mat2^T * self^T by
+          // swapping the operand roles in the column-major cuBLAS call.
+          at::cuda::blas::bgemm_batched<scalar_t>(
+              'n', 'n',
+              n, m, k,
+              at::opmath_type<scalar_t>(1),
+              reinterpret_cast<const scalar_t* const*>(ptr_a_data + ntensors), ldb,
+              reinterpret_cast<const scalar_t* const*>(ptr_a_data), lda,
+              at::opmath_type<scalar_t>(0),
+              reinterpret_cast<scalar_t* const*>(ptr_a_data + 2 * ntensors), n,
+              ntensors);
+          batched_done = true;
+        });
+    if (batched_done) {
+      return output;
+    }
+  }
+
   std::vector<Tensor> output_unbind = output.unbind();
   for (int64_t i = 0; i < ntensors; i++) {
     at::mm_out(output_unbind[i],
@@ -25,10 +25,59 @@
 #include <c10/util/irange.h>
 
 #include <algorithm>
+#include <limits>
 #include <string>
+#include <utility>
 
 int register_linear_params();
 
+#if defined(USE_FBGEMM) || defined(USE_PYTORCH_QNNPACK) || AT_MKLDNN_ENABLED()
+namespace {
+// Single-pass min/max over the activations, parallelized over chunks.
+// fbgemm::FindMinMax is vectorized but single threaded; for the activation
+// sizes seen in dynamic-quant transformer workloads the reduction is a
+// measurable slice of the op, so split it across threads and combine the
+// partial results.
+std::pair<float, float> find_activation_min_max(
+    const at::Tensor& input_contig) {
+  if (input_contig.numel() == 0) {
+    // On empty input, no output data will be generated,
+    // so use arbitrary qparams.
+    return {0.f, 0.f};
+  }
+#ifdef USE_FBGEMM
+  const float* input_ptr = input_contig.const_data_ptr<float>();
+  return at::parallel_reduce(
+      0,
+      input_contig.numel(),
+      at::internal::GRAIN_SIZE,
+      std::pair<float, float>(
+          std::numeric_limits<float>::infinity(),
+          -std::numeric_limits<float>::infinity()),
+      [input_ptr](int64_t begin, int64_t end, std::pair<float, float> acc) {
+        // NOLINTNEXTLINE(cppcoreguidelines-init-variables)
+        float chunk_min, chunk_max;
+        fbgemm::FindMinMax(
+            /*m=*/input_ptr + begin,
+            /*min=*/&chunk_min,
+            /*max=*/&chunk_max,
+            /*len=*/end - begin);
+        return std::pair<float, float>(
+            std::min(acc.first, chunk_min), std::max(acc.second, chunk_max));
+      },
+      [](std::pair<float, float> a, std::pair<float, float> b) {
+        return std::pair<float, float>(
+            std::min(a.first, b.first), std::max(a.second, b.second));
+      });
+#else
+  auto [t_min, t_max] = at::aminmax(input_contig);
+  return {t_min.item<float>(), t_max.item<float>()};
+#endif
+}
+} // namespace
+#endif // defined(USE_FBGEMM) || defined(USE_PYTORCH_QNNPACK) ||
+       // AT_MKLDNN_ENABLED()
+
 #ifdef USE_FBGEMM
 template <bool ReluFused>
 at::Tensor PackedLinearWeight::apply_dynamic_impl(
@@ -66,13 +115,7 @@ at::Tensor PackedLinearWeight::apply_dynamic_impl(
           std::to_string(K));
 
   // Calculate statistics for quantization of the input Tensor
-  // NOLINTNEXTLINE(cppcoreguidelines-init-variables)
-  float x_min, x_max;
-  fbgemm::FindMinMax(
-      /*m=*/input_ptr,
-      /*min=*/&x_min,
-      /*max=*/&x_max,
-      /*len=*/input.numel());
+  auto [x_min, x_max] = find_activation_min_max(input_contig);
 
   // Input tensor is quantized as 8-bit unsigned values
   static constexpr int precision = 8;
@@ -272,20 +315,7 @@ at::Tensor PackedLinearWeightsQnnp::apply_dynamic_impl(
   const float* bias_ptr = bias_contig.const_data_ptr<float>();
 
   // Calculate statistics for quantization of input Tensor
-  // TODO: optimized kernel
-  // NOLINTNEXTLINE(cppcoreguidelines-init-variables)
-  float x_min;
-  // NOLINTNEXTLINE(cppcoreguidelines-init-variables)
-  float x_max;
-  if (input.numel() > 0) {
-    x_min = input_contig.min().item<float>();
-    x_max = input_contig.max().item<float>();
-  } else {
-    // On empty input, no output data will be generated,
-    // so use arbitrary qparams.
-    x_min = 0;
-    x_max = 0;
-  }
+  auto [x_min, x_max] = find_activation_min_max(input_contig);
 
   auto q_params = quant_utils::ChooseQuantizationParams(
       /*min=*/x_min,
@@ -515,21 +545,7 @@ at::Tensor PackedLinearWeightsOnednn::apply_dynamic_impl(
   ideep::tensor x;
   x.init(input_desc, input_contig.data_ptr());
   // Find quantization parameters
-  float x_max = 0, x_min = 0;
-#ifdef USE_FBGEMM
-  // Use FBGEMM's FindMinMax if available since it's faster
-  fbgemm::FindMinMax(
-      /*m=*/input_contig.data_ptr<float>(),
-      /*min=*/&x_min,
-      /*max=*/&x_max,
-      /*len=*/input.numel());
-#else
-  if (input_contig.numel() > 0) {
-    auto [t_min, t_max] = at::aminmax(input_contig);
-    x_max = t_max.item<float>();
-    x_min = t_min.item<float>();
-  }
-#endif
+  auto [x_min, x_max] = find_activation_min_max(input_contig);
   const int precision = 8;
   auto q_params = quant_utils::ChooseQuantizationParams(
       /*min=*/x_min,
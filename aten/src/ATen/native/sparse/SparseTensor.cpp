@@ -67,6 +67,10 @@
 #include <ATen/ops/ones.h>
 #endif
 
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
 namespace at::native {
 
 using namespace at::sparse;
@@ -634,52 +638,94 @@ SparseTensor _coalesce_sparse_cpu(const SparseTensor& self) {
   // this function)
   auto newIndicesAccessor = newIndices.accessor<int64_t, 2>();
   auto indicesAccessor = indices.accessor<int64_t, 2>();
-  auto indicesPermutationAccessor = indicesPermutation.accessor<int64_t, 1>();
-  auto indicesBufferAccessor = indicesBuffer.accessor<int64_t, 1>();
+  const int64_t* indicesPermutation_ptr = indicesPermutation.const_data_ptr<int64_t>();
+  const int64_t* indicesBuffer_ptr = indicesBuffer.const_data_ptr<int64_t>();
+
+  /* The duplicate-sum pass is parallelized by cutting the sorted order into
+   * per-thread partitions whose boundaries are moved forward onto the next
+   * group boundary, so every run of duplicates is summed by exactly one
+   * thread. A first parallel pass counts the unique entries per partition, a
+   * prefix sum assigns each partition its output offset, and a second
+   * parallel pass writes indices and summed values independently with no
+   * serial work over nnz.
+   */
+  const int64_t num_chunks = std::max<int64_t>(
+      1,
+      std::min<int64_t>(
+          at::get_num_threads(), nnz / at::internal::GRAIN_SIZE));
+  std::vector<int64_t> chunk_offsets(num_chunks + 1, 0);
+  chunk_offsets[num_chunks] = nnz;
+  for (const auto t : c10::irange(int64_t(1), num_chunks)) {
+    int64_t p = std::max(nnz * t / num_chunks, chunk_offsets[t - 1]);
+    while (p < nnz && indicesBuffer_ptr[p] == indicesBuffer_ptr[p - 1]) {
+      p++;
+    }
+    chunk_offsets[t] = p;
+  }
+
+  std::vector<int64_t> unique_offsets(num_chunks + 1, 0);
+  at::parallel_for(0, num_chunks, 1, [&](int64_t t_start, int64_t t_end) {
+    for (const auto t : c10::irange(t_start, t_end)) {
+      int64_t count = 0;
+      for (const auto j : c10::irange(chunk_offsets[t], chunk_offsets[t + 1])) {
+        if (j == chunk_offsets[t] ||
+            indicesBuffer_ptr[j] != indicesBuffer_ptr[j - 1]) {
+          count++;
+        }
+      }
+      unique_offsets[t + 1] = count;
+    }
+  });
+  std::partial_sum(
+      unique_offsets.begin(), unique_offsets.end(), unique_offsets.begin());
 
-  int64_t i = -1;
   AT_DISPATCH_ALL_TYPES_AND_COMPLEX_AND4(
       at::ScalarType::ComplexHalf, at::ScalarType::BFloat16, at::ScalarType::Half, at::ScalarType::Bool,
       values.scalar_type(), "coalesce", [&] {
-    int64_t prev = -1;
     int64_t blockSize = values.stride(0);
     scalar_t* values_ptr = values.data_ptr<scalar_t>();
     scalar_t* newValues_ptr = newValues.data_ptr<scalar_t>();
-    for (const auto j : c10::irange(nnz)) {
-      int64_t pos = indicesPermutationAccessor[j];
-      int64_t curr = indicesBufferAccessor[j];
-      if (curr == prev) {
-        if (values.numel() >
-            0) { // if values is an empty tensor, there are no elements to copy
-          at::native::cpublas::axpy<scalar_t>(
-              blockSize,
-              static_cast<scalar_t>(1),
-              values_ptr + pos * blockSize,
-              1,
-              newValues_ptr + i * blockSize,
-              1);
-        }
-      } else {
-        ++i;
-        for (const auto d : c10::irange(sparse_dim)) {
-          newIndicesAccessor[d][i] = indicesAccessor[d][pos];
-        }
-        if (values.numel() >
-            0) { // if values is an empty tensor, there are no elements to copy
-          at::native::cpublas::copy<scalar_t>(
-              blockSize,
-              values_ptr + pos * blockSize,
-              1,
-              newValues_ptr + i * blockSize,
-              1);
+    at::parallel_for(0, num_chunks, 1, [&](int64_t t_start, int64_t t_end) {
+      for (const auto t : c10::irange(t_start, t_end)) {
+        int64_t i = unique_offsets[t] - 1;
+        int64_t prev = -1;
+        for (const auto j : c10::irange(chunk_offsets[t], chunk_offsets[t + 1])) {
+          int64_t pos = indicesPermutation_ptr[j];
+          int64_t curr = indicesBuffer_ptr[j];
+          if (curr == prev) {
+            if (values.numel() >
+                0) { // if values is an empty tensor, there are no elements to copy
+              at::native::cpublas::axpy<scalar_t>(
+                  blockSize,
+                  static_cast<scalar_t>(1),
+                  values_ptr + pos * blockSize,
+                  1,
+                  newValues_ptr + i * blockSize,
+                  1);
+            }
+          } else {
+            ++i;
+            for (const auto d : c10::irange(sparse_dim)) {
+              newIndicesAccessor[d][i] = indicesAccessor[d][pos];
+            }
+            if (values.numel() >
+                0) { // if values is an empty tensor, there are no elements to copy
+              at::native::cpublas::copy<scalar_t>(
+                  blockSize,
+                  values_ptr + pos * blockSize,
+                  1,
+                  newValues_ptr + i * blockSize,
+                  1);
+            }
+          }
+          prev = curr;
         }
       }
-      prev = curr;
-    }
+    });
   });
 
   dst._coalesced_(true);
-  get_sparse_impl(dst)->set_nnz_and_narrow(i + 1);
+  get_sparse_impl(dst)->set_nnz_and_narrow(unique_offsets[num_chunks]);
 
   return dst;
 }
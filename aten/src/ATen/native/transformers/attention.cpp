@@ -27,6 +27,7 @@
 #include <ATen/Functions.h>
 #include <ATen/NativeFunctions.h>
 #else
+#include <ATen/ops/_flash_attention_forward.h>
 #include <ATen/ops/_fused_sdp_choice_native.h>
 #include <ATen/ops/_masked_softmax.h>
 #include <ATen/ops/_native_multi_head_attention_native.h>
@@ -57,6 +58,8 @@
 #include <ATen/ops/matmul_native.h>
 #include <ATen/ops/ones.h>
 #include <ATen/ops/pad.h>
+#include <ATen/ops/repeat_interleave.h>
+#include <ATen/ops/_scaled_dot_product_attention_varlen_native.h>
 #include <ATen/ops/scaled_dot_product_attention_native.h>
 #include <ATen/ops/softmax.h>
 #include <ATen/ops/split_native.h>
@@ -424,8 +427,8 @@ std::tuple<Tensor, Tensor> native_multi_head_attention_cpu(
 }
 
 int64_t _fused_sdp_choice_cpp(const Tensor& query_, const Tensor& key, const Tensor& value,
-        const std::optional<Tensor>& attn_mask_, double dropout_p, bool is_causal, std::optional<double> scale){
-  sdp::sdp_params kernel_params{query_, key, value, attn_mask_, dropout_p, is_causal};
+        const std::optional<Tensor>& attn_mask_, double dropout_p, bool is_causal, std::optional<double> scale, bool enable_gqa){
+  sdp::sdp_params kernel_params{query_, key, value, attn_mask_, dropout_p, is_causal, enable_gqa};
   auto backend = sdp::select_sdp_backend_cpp(kernel_params);
   if (backend == sdp::SDPBackend::error) {
     TORCH_CHECK(
@@ -449,12 +452,13 @@ int64_t _fused_sdp_choice_meta(
     const std::optional<Tensor>& attn_mask_,
     double dropout_p,
     bool is_causal,
-    std::optional<double> scale) {
+    std::optional<double> scale,
+    bool enable_gqa) {
   auto query_key_set = query_.key_set();
 #if defined(USE_ROCM)
   bool has_rocm = query_key_set.has(c10::DispatchKey::HIP);
   if (has_rocm) {
-    auto choice_int = _fused_sdp_choice_stub(at::kHIP, query_, key, value, attn_mask_, dropout_p, is_causal, scale);
+    auto choice_int = _fused_sdp_choice_stub(at::kHIP, query_, key, value, attn_mask_, dropout_p, is_causal, scale, enable_gqa);
     return choice_int;
   }
 #else
@@ -468,7 +472,8 @@ int64_t _fused_sdp_choice_meta(
         attn_mask_,
         dropout_p,
         is_causal,
-        scale);
+        scale,
+        enable_gqa);
     return choice_int;
   }
 #endif
@@ -483,7 +488,8 @@ inline void validate_sdpa_input(
     const std::optional<Tensor>& attn_mask_,
     double dropout_p,
     bool is_causal,
-    std::optional<double> scale) {
+    std::optional<double> scale,
+    bool enable_gqa) {
   TORCH_CHECK(
       query_.dtype() == key.dtype() && query_.dtype() == value.dtype(),
       "Expected query, key, and value to have the same dtype, but got query.dtype: ",
@@ -506,6 +512,23 @@ inline void validate_sdpa_input(
       "Scaled_dot_product_attention: Nested tensors for query / key are not supported "
       "when an explicit attn_mask is set");
   }
+  if (enable_gqa) {
+    TORCH_CHECK(
+        !query_.is_nested() && !key.is_nested() && !value.is_nested(),
+        "Scaled_dot_product_attention: Nested tensors are not supported when enable_gqa is set");
+    TORCH_CHECK(
+        query_.dim() >= 3 && key.dim() >= 3 && value.dim() >= 3,
+        "Scaled_dot_product_attention: Grouped query attention requires inputs with a num_heads dimension, but got query.dim: ",
+        query_.dim(), " key.dim: ", key.dim(), " and value.dim: ", value.dim(), " instead.");
+    TORCH_CHECK(
+        key.sym_size(-3) == value.sym_size(-3),
+        "Scaled_dot_product_attention: Grouped query attention requires key and value to have the same num_heads, but got key.size(-3): ",
+        key.sym_size(-3), " and value.size(-3): ", value.sym_size(-3), " instead.");
+    TORCH_CHECK(
+        query_.sym_size(-3) % key.sym_size(-3) == 0,
+        "Scaled_dot_product_attention: The number of key/value heads must evenly divide the number of query heads, but got query.size(-3): ",
+        query_.sym_size(-3), " and key.size(-3): ", key.sym_size(-3), " instead.");
+  }
   return;
 }
 // This function is used to produce an attn_mask
@@ -642,20 +665,33 @@ Tensor scaled_dot_product_attention(
     const std::optional<Tensor>& attn_mask_,
     double dropout_p,
     bool is_causal,
-    std::optional<double> scale) {
-  validate_sdpa_input(query_, key, value, attn_mask_, dropout_p, is_causal, scale);
+    std::optional<double> scale,
+    bool enable_gqa) {
+  validate_sdpa_input(query_, key, value, attn_mask_, dropout_p, is_causal, scale, enable_gqa);
   int64_t choice_int = static_cast<int64_t>(sdp::SDPBackend::math);
   if (_fused_sdp_choice_stub.is_device_supported(query_.device().type())) {
     choice_int = _fused_sdp_choice_stub(query_.device().type(),
-          query_, key, value, attn_mask_, dropout_p, is_causal, scale);
+          query_, key, value, attn_mask_, dropout_p, is_causal, scale, enable_gqa);
   }
   sdp::SDPBackend backend = static_cast<sdp::SDPBackend>(choice_int);
+  // The CUDA flash kernel maps query heads onto key/value heads with index
+  // arithmetic and takes grouped-query layouts directly; every other backend
+  // needs the key/value heads repeated to match the query.
+  auto repeat_kv_for_gqa = [&](const Tensor& param) -> Tensor {
+    auto q_num_heads = query_.sym_size(-3);
+    auto kv_num_heads = param.sym_size(-3);
+    if (!enable_gqa || q_num_heads == kv_num_heads) {
+      return param;
+    }
+    return at::repeat_interleave_symint(
+        param, q_num_heads / kv_num_heads, /*dim=*/-3);
+  };
   std::optional<Tensor> attn_mask = convert_boolean_attn_mask(attn_mask_, query_.dtype());
   switch (backend) {
     case sdp::SDPBackend::cudnn_attention: {
       bool compute_logsumexp = should_compute_logsumexp(query_, key, value);
       auto out_lse_softmax = at::_scaled_dot_product_cudnn_attention(
-          query_, key, value, attn_mask_, compute_logsumexp, dropout_p, is_causal, false /*return_debug_mask*/, scale);
+          query_, repeat_kv_for_gqa(key), repeat_kv_for_gqa(value), attn_mask_, compute_logsumexp, dropout_p, is_causal, false /*return_debug_mask*/, scale);
       return std::get<0>(out_lse_softmax);
     }
     case sdp::SDPBackend::flash_attention: {
@@ -680,14 +716,14 @@ Tensor scaled_dot_product_attention(
         attn_mask.value() = preprocess_mask(attn_mask.value(), query_, key, value);;
       }
       auto out_and_lse = at::_scaled_dot_product_efficient_attention(
-          query_, key, value, attn_mask, compute_logsumexp, dropout_p, is_causal, scale);
+          query_, repeat_kv_for_gqa(key), repeat_kv_for_gqa(value), attn_mask, compute_logsumexp, dropout_p, is_causal, scale);
       return std::get<0>(out_and_lse);
     }
     case sdp::SDPBackend::math:
       return std::get<0>(at::_scaled_dot_product_attention_math(
           query_,
-          key,
-          value,
+          repeat_kv_for_gqa(key),
+          repeat_kv_for_gqa(value),
           attn_mask,
           dropout_p,
           is_causal,
@@ -701,6 +737,98 @@ Tensor scaled_dot_product_attention(
   }
 }
 
+// Computes scaled dot product attention over a batch of variable-length
+// ("ragged") sequences without materializing any padding.
+//
+// Args:
+//     query (Tensor): Packed query; shape (total_q, H, E), where total_q is
+//         the number of query tokens summed over the whole batch
+//     key (Tensor): Packed key; shape (total_k, H, E)
+//     value (Tensor): Packed value; shape (total_k, H, E)
+//     cum_seq_q (Tensor): Cumulative sequence lengths of the queries; shape
+//         (N + 1,), dtype int32, starting at 0 and ending at total_q
+//     cum_seq_k (Tensor): Cumulative sequence lengths of the keys/values;
+//         shape (N + 1,), dtype int32
+//     max_q (int): Largest query sequence length in the batch
+//     max_k (int): Largest key sequence length in the batch
+//     dropout_p (float): Dropout probability
+//     is_causal (bool): If true, applies causal masking per sequence
+//
+// Returns a tensor:
+//     output (Tensor): Attention output; shape (total_q, H, E)
+//
+// This is the packed-sequence counterpart of scaled_dot_product_attention:
+// sequence i occupies rows [cum_seq_q[i], cum_seq_q[i + 1]) of the packed
+// tensors, so no FLOPs are spent on padding. Currently only the CUDA flash
+// attention backend supports this layout.
+Tensor _scaled_dot_product_attention_varlen(
+    const Tensor& query_,
+    const Tensor& key,
+    const Tensor& value,
+    const Tensor& cum_seq_q,
+    const Tensor& cum_seq_k,
+    c10::SymInt max_q,
+    c10::SymInt max_k,
+    double dropout_p,
+    bool is_causal,
+    std::optional<double> scale) {
+  TORCH_CHECK(
+      query_.device().type() == DeviceType::CUDA &&
+          key.device().type() == DeviceType::CUDA &&
+          value.device().type() == DeviceType::CUDA,
+      "_scaled_dot_product_attention_varlen is only supported on CUDA, got query device: ",
+      query_.device());
+  TORCH_CHECK(
+      query_.dim() == 3 && key.dim() == 3 && value.dim() == 3,
+      "_scaled_dot_product_attention_varlen: Expected packed query, key and value of "
+      "shape (total_tokens, num_heads, head_dim), but got query dim: ",
+      query_.dim(),
+      ", key dim: ",
+      key.dim(),
+      ", value dim: ",
+      value.dim());
+  TORCH_CHECK(
+      cum_seq_q.dim() == 1 && cum_seq_k.dim() == 1 &&
+          cum_seq_q.scalar_type() == at::kInt &&
+          cum_seq_k.scalar_type() == at::kInt,
+      "_scaled_dot_product_attention_varlen: Expected 1-D int32 cumulative sequence "
+      "length tensors, but got cum_seq_q: ",
+      cum_seq_q.scalar_type(),
+      " with dim: ",
+      cum_seq_q.dim(),
+      ", cum_seq_k: ",
+      cum_seq_k.scalar_type(),
+      " with dim: ",
+      cum_seq_k.dim());
+  TORCH_CHECK(
+      cum_seq_q.sym_numel() == cum_seq_k.sym_numel(),
+      "_scaled_dot_product_attention_varlen: cum_seq_q and cum_seq_k must describe the "
+      "same number of sequences");
+  validate_sdpa_input(query_, key, value, c10::nullopt, dropout_p, is_causal, scale);
+
+  // FlashAttention requires the head dimension to be a multiple of 8; pad it
+  // here the same way the dense flash path does, and compute the softmax
+  // scale from the original head dim.
+  c10::SymInt og_size = query_.sym_size(-1);
+  Tensor query_padded = pad_last_dim<8, false>(query_);
+  Tensor key_padded = pad_last_dim<8, false>(key);
+  Tensor value_padded = pad_last_dim<8, false>(value);
+  auto og_scale = sdp::calculate_scale(query_, scale);
+  auto out = std::get<0>(at::_flash_attention_forward_symint(
+      query_padded,
+      key_padded,
+      value_padded,
+      cum_seq_q,
+      cum_seq_k,
+      std::move(max_q),
+      std::move(max_k),
+      dropout_p,
+      is_causal,
+      false /*return_debug_mask*/,
+      og_scale.as_float_unchecked()));
+  return post_process_flash_output(std::move(out), og_size);
+}
+
 std::tuple<Tensor, Tensor> _scaled_dot_product_attention_math(
         const Tensor& query_, const Tensor& key, const Tensor& value,
         const std::optional<Tensor>& attn_mask_, double dropout_p, bool is_causal,
@@ -0,0 +1,139 @@
+#define TORCH_ASSERT_ONLY_METHOD_OPERATORS
+#include <ATen/core/Tensor.h>
+#include <ATen/Dispatch.h>
+#include <ATen/cuda/CUDAContext.h>
+#include <c10/cuda/CUDAException.h>
+
+#ifndef AT_PER_OPERATOR_HEADERS
+#include <ATen/Functions.h>
+#include <ATen/NativeFunctions.h>
+#else
+#include <ATen/ops/_paged_kv_cache_append_native.h>
+#endif
+
+namespace at::native {
+
+namespace {
+
+// One thread block per sequence. The block table maps a sequence's logical
+// token positions onto physical cache blocks, so appending a token is a
+// single strided copy into the page that holds position seq_lens[b]; no
+// existing cache entry is ever moved.
+template <typename scalar_t>
+__global__ void PagedKVCacheAppendKernel(
+    scalar_t* __restrict__ key_cache,
+    scalar_t* __restrict__ value_cache,
+    const scalar_t* __restrict__ key,
+    const scalar_t* __restrict__ value,
+    const int* __restrict__ block_table,
+    const int* __restrict__ seq_lens,
+    int max_blocks_per_seq,
+    int block_size,
+    int64_t token_numel) {
+  const int b = blockIdx.x;
+  const int pos = seq_lens[b];
+  const int logical_block = pos / block_size;
+  CUDA_KERNEL_ASSERT(
+      pos >= 0 && logical_block < max_blocks_per_seq &&
+      "_paged_kv_cache_append_: seq_lens out of range for block_table");
+  const int physical_block = block_table[b * max_blocks_per_seq + logical_block];
+  const int slot = pos % block_size;
+
+  const int64_t dst_offset =
+      (static_cast<int64_t>(physical_block) * block_size + slot) * token_numel;
+  const int64_t src_offset = static_cast<int64_t>(b) * token_numel;
+  for (int64_t i = threadIdx.x; i < token_numel; i += blockDim.x) {
+    key_cache[dst_offset + i] = key[src_offset + i];
+    value_cache[dst_offset + i] = value[src_offset + i];
+  }
+}
+
+} // namespace
+
+void _paged_kv_cache_append_cuda_(
+    Tensor& key_cache,
+    Tensor& value_cache,
+    const Tensor& key,
+    const Tensor& value,
+    const Tensor& block_table,
+    const Tensor& seq_lens) {
+  TORCH_CHECK(
+      key_cache.dim() == 4 && value_cache.dim() == 4,
+      "_paged_kv_cache_append_: Expected caches of shape "
+      "(num_blocks, block_size, num_heads, head_dim), but got key_cache dim: ",
+      key_cache.dim(),
+      ", value_cache dim: ",
+      value_cache.dim());
+  TORCH_CHECK(
+      key_cache.sizes() == value_cache.sizes(),
+      "_paged_kv_cache_append_: key_cache and value_cache must have the same "
+      "shape");
+  TORCH_CHECK(
+      key.dim() == 3 && key.sizes() == value.sizes(),
+      "_paged_kv_cache_append_: Expected key and value of shape "
+      "(batch, num_heads, head_dim), but got key dim: ",
+      key.dim());
+  TORCH_CHECK(
+      key.size(1) == key_cache.size(2) && key.size(2) == key_cache.size(3),
+      "_paged_kv_cache_append_: key head count/dim (",
+      key.size(1),
+      ", ",
+      key.size(2),
+      ") do not match the cache (",
+      key_cache.size(2),
+      ", ",
+      key_cache.size(3),
+      ")");
+  TORCH_CHECK(
+      key_cache.scalar_type() == value_cache.scalar_type() &&
+          key_cache.scalar_type() == key.scalar_type() &&
+          key_cache.scalar_type() == value.scalar_type(),
+      "_paged_kv_cache_append_: caches, key and value must share one dtype");
+  TORCH_CHECK(
+      key_cache.is_contiguous() && value_cache.is_contiguous(),
+      "_paged_kv_cache_append_: caches must be contiguous");
+  const int64_t batch_size = key.size(0);
+  TORCH_CHECK(
+      block_table.dim() == 2 && block_table.size(0) == batch_size &&
+          block_table.scalar_type() == at::kInt,
+      "_paged_kv_cache_append_: Expected int32 block_table of shape "
+      "(batch, max_blocks_per_seq)");
+  TORCH_CHECK(
+      seq_lens.dim() == 1 && seq_lens.size(0) == batch_size &&
+          seq_lens.scalar_type() == at::kInt,
+      "_paged_kv_cache_append_: Expected int32 seq_lens of shape (batch,)");
+
+  if (batch_size == 0) {
+    return;
+  }
+  const auto key_contig = key.contiguous();
+  const auto value_contig = value.contiguous();
+  const auto block_table_contig = block_table.contiguous();
+  const auto seq_lens_contig = seq_lens.contiguous();
+
+  const int64_t token_numel = key.size(1) * key.size(2);
+  const int threads =
+      static_cast<int>(std::min<int64_t>(token_numel, 256));
+  auto stream = at::cuda::getCurrentCUDAStream();
+  AT_DISPATCH_FLOATING_TYPES_AND2(
+      kHalf,
+      kBFloat16,
+      key_cache.scalar_type(),
+      "_paged_kv_cache_append_cuda",
+      [&] {
+        PagedKVCacheAppendKernel<scalar_t>
+            <<<batch_size, threads, 0, stream>>>(
+                key_cache.mutable_data_ptr<scalar_t>(),
+                value_cache.mutable_data_ptr<scalar_t>(),
+                key_contig.const_data_ptr<scalar_t>(),
+                value_contig.const_data_ptr<scalar_t>(),
+                block_table_contig.const_data_ptr<int>(),
+                seq_lens_contig.const_data_ptr<int>(),
+                static_cast<int>(block_table.size(1)),
+                static_cast<int>(key_cache.size(1)),
+                token_numel);
+        C10_CUDA_KERNEL_LAUNCH_CHECK();
+      });
+}
+
+} // namespace at::native
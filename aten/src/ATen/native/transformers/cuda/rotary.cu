@@ -0,0 +1,162 @@
+#define TORCH_ASSERT_ONLY_METHOD_OPERATORS
+#include <ATen/core/Tensor.h>
+#include <ATen/Dispatch.h>
+#include <ATen/OpMathType.h>
+#include <ATen/cuda/CUDAContext.h>
+#include <c10/cuda/CUDAException.h>
+
+#ifndef AT_PER_OPERATOR_HEADERS
+#include <ATen/Functions.h>
+#include <ATen/NativeFunctions.h>
+#else
+#include <ATen/ops/_apply_rotary_emb_native.h>
+#include <ATen/ops/empty_like.h>
+#endif
+
+namespace at::native {
+
+namespace {
+
+// One thread per rotated pair, grid-stride. The pair (x0, x1) becomes
+// (x0 * cos - x1 * sin, x1 * cos + x0 * sin); every output element depends
+// only on its own input pair, so `in == out` (the in-place variant) is safe.
+template <typename scalar_t>
+__global__ void ApplyRotaryEmbKernel(
+    const scalar_t* __restrict__ in,
+    scalar_t* __restrict__ out,
+    const scalar_t* __restrict__ cos,
+    const scalar_t* __restrict__ sin,
+    int64_t total_pairs,
+    int num_heads,
+    int seq_len,
+    int rot_dim,
+    bool interleaved) {
+  using opmath_t = at::opmath_type<scalar_t>;
+  for (int64_t p = blockIdx.x * static_cast<int64_t>(blockDim.x) + threadIdx.x;
+       p < total_pairs;
+       p += static_cast<int64_t>(blockDim.x) * gridDim.x) {
+    const int i = static_cast<int>(p % rot_dim);
+    const int64_t row = p / rot_dim;
+    const int s = static_cast<int>((row / num_heads) % seq_len);
+    const int64_t base = row * (2 * rot_dim);
+    const int64_t idx0 = interleaved ? base + 2 * i : base + i;
+    const int64_t idx1 = interleaved ? idx0 + 1 : idx0 + rot_dim;
+
+    const opmath_t x0 = static_cast<opmath_t>(in[idx0]);
+    const opmath_t x1 = static_cast<opmath_t>(in[idx1]);
+    const opmath_t c =
+        static_cast<opmath_t>(cos[static_cast<int64_t>(s) * rot_dim + i]);
+    const opmath_t sn =
+        static_cast<opmath_t>(sin[static_cast<int64_t>(s) * rot_dim + i]);
+    out[idx0] = static_cast<scalar_t>(x0 * c - x1 * sn);
+    out[idx1] = static_cast<scalar_t>(x1 * c + x0 * sn);
+  }
+}
+
+void check_rotary_emb_inputs_cuda(
+    const Tensor& qk,
+    const Tensor& cos,
+    const Tensor& sin,
+    const char* name) {
+  TORCH_CHECK(
+      qk.dim() == 4,
+      name,
+      ": Expected qk of shape (batch, seq_len, num_heads, head_dim), but got ",
+      qk.dim(),
+      " dims");
+  const int64_t seq_len = qk.size(1);
+  const int64_t head_dim = qk.size(3);
+  TORCH_CHECK(
+      head_dim % 2 == 0,
+      name,
+      ": head_dim must be even to rotate lane pairs, but got ",
+      head_dim);
+  TORCH_CHECK(
+      cos.dim() == 2 && cos.size(0) == seq_len &&
+          cos.size(1) == head_dim / 2,
+      name,
+      ": Expected cos of shape (seq_len, head_dim / 2) = (",
+      seq_len,
+      ", ",
+      head_dim / 2,
+      "), but got ",
+      cos.sizes());
+  TORCH_CHECK(
+      sin.sizes() == cos.sizes(),
+      name,
+      ": sin must match cos shape, but got ",
+      sin.sizes());
+  TORCH_CHECK(
+      qk.scalar_type() == cos.scalar_type() &&
+          qk.scalar_type() == sin.scalar_type(),
+      name,
+      ": qk, cos and sin must share one dtype, but got ",
+      qk.scalar_type(),
+      ", ",
+      cos.scalar_type(),
+      " and ",
+      sin.scalar_type());
+}
+
+void apply_rotary_emb_cuda_impl(
+    const Tensor& qk,
+    Tensor& out,
+    const Tensor& cos,
+    const Tensor& sin,
+    bool interleaved) {
+  const auto cos_contig = cos.contiguous();
+  const auto sin_contig = sin.contiguous();
+  const int64_t rot_dim = qk.size(3) / 2;
+  const int64_t total_pairs = qk.numel() / 2;
+  constexpr int threads = 256;
+  const int64_t blocks =
+      std::min<int64_t>((total_pairs + threads - 1) / threads, 65535);
+  auto stream = at::cuda::getCurrentCUDAStream();
+  AT_DISPATCH_FLOATING_TYPES_AND2(
+      kHalf, kBFloat16, qk.scalar_type(), "_apply_rotary_emb_cuda", [&] {
+        ApplyRotaryEmbKernel<scalar_t><<<blocks, threads, 0, stream>>>(
+            qk.const_data_ptr<scalar_t>(),
+            out.mutable_data_ptr<scalar_t>(),
+            cos_contig.const_data_ptr<scalar_t>(),
+            sin_contig.const_data_ptr<scalar_t>(),
+            total_pairs,
+            static_cast<int>(qk.size(2)),
+            static_cast<int>(qk.size(1)),
+            static_cast<int>(rot_dim),
+            interleaved);
+        C10_CUDA_KERNEL_LAUNCH_CHECK();
+      });
+}
+
+} // namespace
+
+Tensor apply_rotary_emb_cuda(
+    const Tensor& qk,
+    const Tensor& cos,
+    const Tensor& sin,
+    bool interleaved) {
+  check_rotary_emb_inputs_cuda(qk, cos, sin, "_apply_rotary_emb");
+  const auto qk_contig = qk.contiguous();
+  auto out = at::empty_like(qk_contig);
+  if (qk.numel() > 0) {
+    apply_rotary_emb_cuda_impl(qk_contig, out, cos, sin, interleaved);
+  }
+  return out;
+}
+
+Tensor& apply_rotary_emb_cuda_(
+    Tensor& qk,
+    const Tensor& cos,
+    const Tensor& sin,
+    bool interleaved) {
+  check_rotary_emb_inputs_cuda(qk, cos, sin, "_apply_rotary_emb_");
+  TORCH_CHECK(
+      qk.is_contiguous(),
+      "_apply_rotary_emb_: qk must be contiguous to rotate in place");
+  if (qk.numel() > 0) {
+    apply_rotary_emb_cuda_impl(qk, qk, cos, sin, interleaved);
+  }
+  return qk;
+}
+
+} // namespace at::native
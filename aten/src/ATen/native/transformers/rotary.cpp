@@ -0,0 +1,190 @@
+#define TORCH_ASSERT_ONLY_METHOD_OPERATORS
+#include <ATen/core/Tensor.h>
+#include <ATen/Dispatch.h>
+#include <ATen/Parallel.h>
+#include <ATen/cpu/vec/vec.h>
+#include <c10/util/irange.h>
+
+#ifndef AT_PER_OPERATOR_HEADERS
+#include <ATen/Functions.h>
+#include <ATen/NativeFunctions.h>
+#else
+#include <ATen/ops/_apply_rotary_emb_native.h>
+#include <ATen/ops/empty_like.h>
+#endif
+
+namespace at::native {
+
+namespace {
+
+void check_rotary_emb_inputs(
+    const Tensor& qk,
+    const Tensor& cos,
+    const Tensor& sin,
+    const char* name) {
+  TORCH_CHECK(
+      qk.dim() == 4,
+      name,
+      ": Expected qk of shape (batch, seq_len, num_heads, head_dim), but got ",
+      qk.dim(),
+      " dims");
+  const int64_t seq_len = qk.size(1);
+  const int64_t head_dim = qk.size(3);
+  TORCH_CHECK(
+      head_dim % 2 == 0,
+      name,
+      ": head_dim must be even to rotate lane pairs, but got ",
+      head_dim);
+  TORCH_CHECK(
+      cos.dim() == 2 && cos.size(0) == seq_len &&
+          cos.size(1) == head_dim / 2,
+      name,
+      ": Expected cos of shape (seq_len, head_dim / 2) = (",
+      seq_len,
+      ", ",
+      head_dim / 2,
+      "), but got ",
+      cos.sizes());
+  TORCH_CHECK(
+      sin.sizes() == cos.sizes(),
+      name,
+      ": sin must match cos shape, but got ",
+      sin.sizes());
+  TORCH_CHECK(
+      qk.scalar_type() == cos.scalar_type() &&
+          qk.scalar_type() == sin.scalar_type(),
+      name,
+      ": qk, cos and sin must share one dtype, but got ",
+      qk.scalar_type(),
+      ", ",
+      cos.scalar_type(),
+      " and ",
+      sin.scalar_type());
+}
+
+// Rotates one contiguous (batch, seq_len, num_heads, 2 * rot_dim) tensor.
+// The pair (x0, x1) becomes (x0 * cos - x1 * sin, x1 * cos + x0 * sin), so
+// every output element depends only on its own input pair and `in == out`
+// (the in-place variant) is safe.
+template <typename scalar_t>
+void apply_rotary_emb_cpu_kernel(
+    const scalar_t* in,
+    scalar_t* out,
+    const scalar_t* cos,
+    const scalar_t* sin,
+    int64_t batch_size,
+    int64_t seq_len,
+    int64_t num_heads,
+    int64_t rot_dim,
+    bool interleaved) {
+  using Vec = at::vec::Vectorized<scalar_t>;
+  const int64_t head_dim = 2 * rot_dim;
+  at::parallel_for(
+      0,
+      batch_size * seq_len * num_heads,
+      internal::GRAIN_SIZE / head_dim,
+      [&](int64_t begin, int64_t end) {
+        for (const auto row : c10::irange(begin, end)) {
+          const int64_t s = (row / num_heads) % seq_len;
+          const scalar_t* in_row = in + row * head_dim;
+          scalar_t* out_row = out + row * head_dim;
+          const scalar_t* cos_row = cos + s * rot_dim;
+          const scalar_t* sin_row = sin + s * rot_dim;
+          int64_t i = 0;
+          if (interleaved) {
+            // Pairs are adjacent lanes (x[2i], x[2i+1]); two input vectors
+            // hold Vec::size() pairs, split apart with deinterleave2.
+            for (; i + Vec::size() <= rot_dim; i += Vec::size()) {
+              auto [x0, x1] = at::vec::deinterleave2(
+                  Vec::loadu(in_row + 2 * i),
+                  Vec::loadu(in_row + 2 * i + Vec::size()));
+              const auto c = Vec::loadu(cos_row + i);
+              const auto sn = Vec::loadu(sin_row + i);
+              auto [y0, y1] =
+                  at::vec::interleave2(x0 * c - x1 * sn, x1 * c + x0 * sn);
+              y0.store(out_row + 2 * i);
+              y1.store(out_row + 2 * i + Vec::size());
+            }
+            for (; i < rot_dim; ++i) {
+              const scalar_t x0 = in_row[2 * i];
+              const scalar_t x1 = in_row[2 * i + 1];
+              out_row[2 * i] = x0 * cos_row[i] - x1 * sin_row[i];
+              out_row[2 * i + 1] = x1 * cos_row[i] + x0 * sin_row[i];
+            }
+          } else {
+            // Half-rotated pairs (x[i], x[i + rot_dim]) sit in two contiguous
+            // halves, so the rotation maps directly onto vector lanes.
+            for (; i + Vec::size() <= rot_dim; i += Vec::size()) {
+              const auto x0 = Vec::loadu(in_row + i);
+              const auto x1 = Vec::loadu(in_row + rot_dim + i);
+              const auto c = Vec::loadu(cos_row + i);
+              const auto sn = Vec::loadu(sin_row + i);
+              (x0 * c - x1 * sn).store(out_row + i);
+              (x1 * c + x0 * sn).store(out_row + rot_dim + i);
+            }
+            for (; i < rot_dim; ++i) {
+              const scalar_t x0 = in_row[i];
+              const scalar_t x1 = in_row[rot_dim + i];
+              out_row[i] = x0 * cos_row[i] - x1 * sin_row[i];
+              out_row[rot_dim + i] = x1 * cos_row[i] + x0 * sin_row[i];
+            }
+          }
+        }
+      });
+}
+
+void apply_rotary_emb_cpu_impl(
+    const Tensor& qk,
+    Tensor& out,
+    const Tensor& cos,
+    const Tensor& sin,
+    bool interleaved) {
+  const auto cos_contig = cos.contiguous();
+  const auto sin_contig = sin.contiguous();
+  AT_DISPATCH_FLOATING_TYPES_AND2(
+      kHalf, kBFloat16, qk.scalar_type(), "_apply_rotary_emb_cpu", [&] {
+        apply_rotary_emb_cpu_kernel<scalar_t>(
+            qk.const_data_ptr<scalar_t>(),
+            out.mutable_data_ptr<scalar_t>(),
+            cos_contig.const_data_ptr<scalar_t>(),
+            sin_contig.const_data_ptr<scalar_t>(),
+            qk.size(0),
+            qk.size(1),
+            qk.size(2),
+            qk.size(3) / 2,
+            interleaved);
+      });
+}
+
+} // namespace
+
+Tensor apply_rotary_emb_cpu(
+    const Tensor& qk,
+    const Tensor& cos,
+    const Tensor& sin,
+    bool interleaved) {
+  check_rotary_emb_inputs(qk, cos, sin, "_apply_rotary_emb");
+  const auto qk_contig = qk.contiguous();
+  auto out = at::empty_like(qk_contig);
+  if (qk.numel() > 0) {
+    apply_rotary_emb_cpu_impl(qk_contig, out, cos, sin, interleaved);
+  }
+  return out;
+}
+
+Tensor& apply_rotary_emb_cpu_(
+    Tensor& qk,
+    const Tensor& cos,
+    const Tensor& sin,
+    bool interleaved) {
+  check_rotary_emb_inputs(qk, cos, sin, "_apply_rotary_emb_");
+  TORCH_CHECK(
+      qk.is_contiguous(),
+      "_apply_rotary_emb_: qk must be contiguous to rotate in place");
+  if (qk.numel() > 0) {
+    apply_rotary_emb_cpu_impl(qk, qk, cos, sin, interleaved);
+  }
+  return qk;
+}
+
+} // namespace at::native
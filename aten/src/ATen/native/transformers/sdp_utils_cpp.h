@@ -47,6 +47,7 @@ struct sdp_params {
   std::optional<at::Tensor> attn_mask;
   double dropout;
   bool is_causal;
+  bool enable_gqa;
 };
 
 SDPBackend select_sdp_backend_cpp(sdp_params const& kernel_params);
@@ -352,6 +353,41 @@ inline bool check_safe_kv_broadcast(at::Tensor const& param, bool debug) {
   return true;
 }
 
+inline bool check_grouped_query_attention(sdp_params const& params, bool debug) {
+  // This is expected to be called after check_tensor_shapes ensuring that the
+  // size() calls won't error since the inputs are all 4 dimensional
+  const auto q_num_heads = params.query.sym_size(1);
+  const auto k_num_heads = params.key.sym_size(1);
+  const auto v_num_heads = params.value.sym_size(1);
+
+  if (k_num_heads != v_num_heads) {
+    if (debug) {
+      TORCH_WARN(
+          "Grouped query attention requires key and value to have the same num_heads. ",
+          "Key sizes(): ",
+          params.key.sizes(),
+          ", Value sizes(): ",
+          params.value.sizes(),
+          " instead.");
+    }
+    return false;
+  }
+  if (q_num_heads % k_num_heads != 0) {
+    if (debug) {
+      TORCH_WARN(
+          "Grouped query attention requires the number of key/value heads to evenly divide the number of query heads. ",
+          "Query.sizes(): ",
+          params.query.sizes(),
+          ", Key sizes(): ",
+          params.key.sizes(),
+          " instead.");
+    }
+    return false;
+  }
+  return true;
+}
+
+template <bool supports_grouped_query_attention = false>
 inline bool check_batch_size_and_num_heads_dense(sdp_params const& params, bool debug) {
   // This is expected to be called after check_tensor_shapes ensuring that the
   // size() calls won't error since the inputs are all 4 dimensional
@@ -370,6 +406,13 @@ inline bool check_batch_size_and_num_heads_dense(sdp_params const& params, bool
       q_num_heads == k_num_heads && q_num_heads == v_num_heads;
 
   if (!(same_batch_size && same_num_heads)) {
+    // Kernels that map query heads onto key/value heads internally can take
+    // fewer key/value heads directly instead of requiring a materialized
+    // expand of key and value.
+    if (same_batch_size && supports_grouped_query_attention &&
+        params.enable_gqa) {
+      return check_grouped_query_attention(params, debug);
+    }
     if (debug) {
       TORCH_WARN(
           "For dense inputs, both fused kernels require query, key and value to have the same batch_size and num_heads. ",
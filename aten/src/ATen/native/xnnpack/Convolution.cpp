@@ -8,6 +8,7 @@
 #include <ATen/native/xnnpack/Common.h>
 #include <ATen/native/xnnpack/Convolution.h>
 #include <ATen/native/xnnpack/Engine.h>
+#include <ATen/native/xnnpack/WeightsCache.h>
 #include <c10/util/irange.h>
 
 namespace at::native::xnnpack {
@@ -212,62 +213,68 @@ ContextConv2D create(
     for (const auto i : c10::irange(4)) {
       weight_sizes[i] = weight_reordered.size(i);
     }
-    create_status = xnn_create_deconvolution2d_nhwc_f32(
-      padding_expanded[Layout::Parameter::height],                    // output_padding_top
-      padding_expanded[Layout::Parameter::width],                     // output_padding_right
-      padding_expanded[Layout::Parameter::height],                    // output_padding_bottom
-      padding_expanded[Layout::Parameter::width],                     // output_padding_left
-      weight_reordered.size(Layout::Filter::height),                  // kernel_height
-      weight_reordered.size(Layout::Filter::width),                   // kernel_width
-      stride_expanded[Layout::Parameter::height],                     // subsampling_height
-      stride_expanded[Layout::Parameter::width],                      // subsampling_width
-      dilation_expanded[Layout::Parameter::height],                   // dilation_height
-      dilation_expanded[Layout::Parameter::width],                    // dilation_width
-      groups,                                                         // groups
-      weight_reordered.size(Layout::Filter::output) / groups,         // group_input_channels
-      weight_reordered.size(Layout::Filter::input),                   // group_output_channels
-      weight_reordered.size(Layout::Filter::output),                  // input_pixel_stride
-      weight_reordered.size(Layout::Filter::input) * groups,          // output_pixel_stride
-      weight_reordered.data_ptr<float>(),                             // kernel
-      (bias && bias->defined())
-          ? bias->contiguous().data_ptr<float>()
-          : nullptr,                                                  // bias
-      output_min,                                                     // output_min
-      output_max,                                                     // output_max
-      0u,                                                             // flags
-      nullptr,                                                        // xnn_caches_t
-      nullptr,                                                        // xnn_weights_cache_t
-      &convolution_op);                                               // operator
+    create_status = internal::create_with_shared_weights_cache(
+        [&](xnn_weights_cache_t weights_cache) {
+      return xnn_create_deconvolution2d_nhwc_f32(
+        padding_expanded[Layout::Parameter::height],                  // output_padding_top
+        padding_expanded[Layout::Parameter::width],                   // output_padding_right
+        padding_expanded[Layout::Parameter::height],                  // output_padding_bottom
+        padding_expanded[Layout::Parameter::width],                   // output_padding_left
+        weight_reordered.size(Layout::Filter::height),                // kernel_height
+        weight_reordered.size(Layout::Filter::width),                 // kernel_width
+        stride_expanded[Layout::Parameter::height],                   // subsampling_height
+        stride_expanded[Layout::Parameter::width],                    // subsampling_width
+        dilation_expanded[Layout::Parameter::height],                 // dilation_height
+        dilation_expanded[Layout::Parameter::width],                  // dilation_width
+        groups,                                                       // groups
+        weight_reordered.size(Layout::Filter::output) / groups,       // group_input_channels
+        weight_reordered.size(Layout::Filter::input),                 // group_output_channels
+        weight_reordered.size(Layout::Filter::output),                // input_pixel_stride
+        weight_reordered.size(Layout::Filter::input) * groups,        // output_pixel_stride
+        weight_reordered.data_ptr<float>(),                           // kernel
+        (bias && bias->defined())
+            ? bias->contiguous().data_ptr<float>()
+            : nullptr,                                                // bias
+        output_min,                                                   // output_min
+        output_max,                                                   // output_max
+        0u,                                                           // flags
+        nullptr,                                                      // xnn_caches_t
+        weights_cache,                                                // xnn_weights_cache_t
+        &convolution_op);                                             // operator
+    });
   } else {
     for (const auto i : c10::irange(4)) {
       weight_sizes[i] = weight_nhwc.size(i);
     }
-    create_status = xnn_create_convolution2d_nhwc_f32(
-      padding_expanded[Layout::Parameter::height],                    // input_padding_top
-      padding_expanded[Layout::Parameter::width],                     // input_padding_right
-      padding_expanded[Layout::Parameter::height],                    // input_padding_bottom
-      padding_expanded[Layout::Parameter::width],                     // input_padding_left
-      weight_nhwc.size(Layout::Filter::height),                       // kernel_height
-      weight_nhwc.size(Layout::Filter::width),                        // kernel_width
-      stride_expanded[Layout::Parameter::height],                     // subsampling_height
-      stride_expanded[Layout::Parameter::width],                      // subsampling_width
-      dilation_expanded[Layout::Parameter::height],                   // dilation_height
-      dilation_expanded[Layout::Parameter::width],                    // dilation_width
-      groups,                                                         // groups
-      weight_nhwc.size(Layout::Filter::input),                        // group_input_channels
-      weight_nhwc.size(Layout::Filter::output) / groups,              // group_output_channels
-      weight_nhwc.size(Layout::Filter::input) * groups,               // input_pixel_stride
-      weight_nhwc.size(Layout::Filter::output),                       // output_pixel_stride
-      weight_nhwc.data_ptr<float>(),                                  // kernel
-      (bias && bias->defined())
-          ? bias->contiguous().data_ptr<float>()
-          : nullptr,                                                  // bias
-      output_min,                                                     // output_min
-      output_max,                                                     // output_max
-      0u,                                                             // flags
-      nullptr,                                                        // xnn_caches_t
-      nullptr,                                                        // xnn_weights_cache_t
-      &convolution_op);                                               // operator
+    create_status = internal::create_with_shared_weights_cache(
+        [&](xnn_weights_cache_t weights_cache) {
+      return xnn_create_convolution2d_nhwc_f32(
+        padding_expanded[Layout::Parameter::height],                  // input_padding_top
+        padding_expanded[Layout::Parameter::width],                   // input_padding_right
+        padding_expanded[Layout::Parameter::height],                  // input_padding_bottom
+        padding_expanded[Layout::Parameter::width],                   // input_padding_left
+        weight_nhwc.size(Layout::Filter::height),                     // kernel_height
+        weight_nhwc.size(Layout::Filter::width),                      // kernel_width
+        stride_expanded[Layout::Parameter::height],                   // subsampling_height
+        stride_expanded[Layout::Parameter::width],                    // subsampling_width
+        dilation_expanded[Layout::Parameter::height],                 // dilation_height
+        dilation_expanded[Layout::Parameter::width],                  // dilation_width
+        groups,                                                       // groups
+        weight_nhwc.size(Layout::Filter::input),                      // group_input_channels
+        weight_nhwc.size(Layout::Filter::output) / groups,            // group_output_channels
+        weight_nhwc.size(Layout::Filter::input) * groups,             // input_pixel_stride
+        weight_nhwc.size(Layout::Filter::output),                     // output_pixel_stride
+        weight_nhwc.data_ptr<float>(),                                // kernel
+        (bias && bias->defined())
+            ? bias->contiguous().data_ptr<float>()
+            : nullptr,                                                // bias
+        output_min,                                                   // output_min
+        output_max,                                                   // output_max
+        0u,                                                           // flags
+        nullptr,                                                      // xnn_caches_t
+        weights_cache,                                                // xnn_weights_cache_t
+        &convolution_op);                                             // operator
+    });
   }
 
   TORCH_CHECK(
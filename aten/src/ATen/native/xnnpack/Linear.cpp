@@ -3,6 +3,7 @@
 #include <ATen/native/xnnpack/Common.h>
 #include <ATen/native/utils/Factory.h>
 #include <ATen/native/xnnpack/Linear.h>
+#include <ATen/native/xnnpack/WeightsCache.h>
 
 namespace at::native::xnnpack {
 namespace internal::linear {
@@ -82,21 +83,24 @@ ContextLinear create(
 
   xnn_operator_t linear_op{};
 
-  const xnn_status create_status = xnn_create_fully_connected_nc_f32(
-      weight_contig.size(Layout::Filter::input),                        // input_channels
-      weight_contig.size(Layout::Filter::output),                       // output_channels
-      weight_contig.size(Layout::Filter::input),                        // input_pixel_stride
-      weight_contig.size(Layout::Filter::output),                       // output_pixel_stride
-      weight_contig.data_ptr<float>(),                                  // kernel
+  const xnn_status create_status = internal::create_with_shared_weights_cache(
+      [&](xnn_weights_cache_t weights_cache) {
+    return xnn_create_fully_connected_nc_f32(
+      weight_contig.size(Layout::Filter::input),                      // input_channels
+      weight_contig.size(Layout::Filter::output),                     // output_channels
+      weight_contig.size(Layout::Filter::input),                      // input_pixel_stride
+      weight_contig.size(Layout::Filter::output),                     // output_pixel_stride
+      weight_contig.data_ptr<float>(),                                // kernel
       (bias && bias->defined()) ?
           bias->contiguous().data_ptr<float>() :
-          nullptr,                                                      // bias
+          nullptr,                                                    // bias
       output_min,                                                     // output_min
       output_max,                                                     // output_max
       0u,                                                             // flags
       nullptr,                                                        // xnn_caches_t
-      nullptr,                                                        // xnn_weights_cache_t
+      weights_cache,                                                  // xnn_weights_cache_t
       &linear_op);                                                    // operator
+  });
 
   TORCH_CHECK(
       xnn_status_success == create_status,
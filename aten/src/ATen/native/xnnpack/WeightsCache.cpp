@@ -0,0 +1,87 @@
+#ifdef USE_XNNPACK
+
+#include <ATen/native/xnnpack/WeightsCache.h>
+#include <c10/util/Exception.h>
+
+#include <atomic>
+#include <mutex>
+
+namespace at::native::xnnpack {
+namespace internal {
+namespace {
+
+std::atomic<bool> shared_weights_cache_enabled_{false};
+
+std::mutex& cache_mutex() {
+  static std::mutex mutex;
+  return mutex;
+}
+
+// Caller must hold cache_mutex(). Deliberately leaked: operators created
+// against the cache keep pointing into it for the lifetime of the process.
+xnn_weights_cache_t shared_weights_cache() {
+  static xnn_weights_cache_t cache = []() -> xnn_weights_cache_t {
+    xnn_weights_cache_t created = nullptr;
+    const xnn_status status = xnn_create_weights_cache(&created);
+    if (xnn_status_success != status) {
+      TORCH_WARN_ONCE(
+          "Failed to create XNNPACK weights cache; "
+          "packed weights will not be shared across operators.");
+      return nullptr;
+    }
+    return created;
+  }();
+  return cache;
+}
+
+} // namespace
+
+bool set_shared_weights_cache_enabled(const bool enabled) {
+  return shared_weights_cache_enabled_.exchange(enabled);
+}
+
+bool shared_weights_cache_enabled() {
+  return shared_weights_cache_enabled_.load();
+}
+
+void finalize_shared_weights_cache() {
+  if (!shared_weights_cache_enabled()) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(cache_mutex());
+  xnn_weights_cache_t cache = shared_weights_cache();
+  if (!cache || xnn_weights_cache_is_finalized(cache)) {
+    return;
+  }
+  const xnn_status status = xnn_finalize_weights_cache(
+      cache, xnn_weights_cache_finalization_kind_soft);
+  if (xnn_status_success != status) {
+    TORCH_WARN_ONCE(
+        "Failed to finalize XNNPACK weights cache; "
+        "newly created operators will use private packed weights.");
+  }
+}
+
+xnn_status create_with_shared_weights_cache(
+    const std::function<xnn_status(xnn_weights_cache_t)>& create) {
+  if (!shared_weights_cache_enabled()) {
+    return create(nullptr);
+  }
+  std::lock_guard<std::mutex> lock(cache_mutex());
+  xnn_weights_cache_t cache = shared_weights_cache();
+  if (!cache) {
+    return create(nullptr);
+  }
+  const xnn_status status = create(cache);
+  if (xnn_status_success != status && xnn_weights_cache_is_finalized(cache)) {
+    // The weights were not in the cache and the finalized cache rejects new
+    // insertions; pack privately instead.
+    return create(nullptr);
+  }
+  return status;
+}
+
+} // namespace internal
+} // namespace at::native::xnnpack
+
+#endif /* USE_XNNPACK */
@@ -0,0 +1,55 @@
+#pragma once
+
+#ifdef USE_XNNPACK
+
+#include <ATen/native/xnnpack/Common.h>
+#include <functional>
+
+namespace at::native::xnnpack {
+namespace internal {
+
+// Process-wide XNNPACK weights cache.
+//
+// Every prepacked conv2d / linear op context owns an xnn_operator that packs
+// its weights into a private allocation, so a model instantiated several
+// times in one process (or several models sharing weights) pays for identical
+// packed weights once per instance. Routing operator creation through the
+// shared weights cache below makes XNNPACK content-address the packed blobs:
+// identical weights pack once per process and all operators point into the
+// same buffer, cutting both prepacking time and RSS.
+//
+// Lifecycle (mirrors XNNPACK's weights cache contract): enable the cache
+// before instantiating models, and call finalize_shared_weights_cache() once
+// the models of interest have been created, before running inference
+// concurrently with further model creation. Finalization is "soft": existing
+// packed weights remain available to later instantiations of the same
+// models, while operators with weights not already in the cache silently
+// fall back to private packing.
+//
+// The cache only deduplicates within a process. XNNPACK's weights cache owns
+// its backing memory and stores process-local pointers in its lookup
+// structures, so it cannot be placed in a cross-process (ashmem) mapping
+// through the public API.
+
+// Returns the previous value.
+bool set_shared_weights_cache_enabled(bool enabled);
+bool shared_weights_cache_enabled();
+
+// Soft-finalizes the cache, making the packed weights collected so far safe
+// to use from concurrently running operators. No-op if the cache is
+// disabled, empty, or already finalized.
+void finalize_shared_weights_cache();
+
+// Invokes `create` with the process-wide weights cache (nullptr when the
+// cache is disabled or could not be constructed) while holding the cache
+// lock. If creation against a finalized cache fails -- XNNPACK rejects
+// insertions of new weights after finalization -- the operator is recreated
+// with private packing instead. All xnn_create_* calls that take an
+// xnn_weights_cache_t must go through this helper.
+xnn_status create_with_shared_weights_cache(
+    const std::function<xnn_status(xnn_weights_cache_t)>& create);
+
+} // namespace internal
+} // namespace at::native::xnnpack
+
+#endif /* USE_XNNPACK */
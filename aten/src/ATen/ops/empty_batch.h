@@ -0,0 +1,38 @@
+#pragma once
+#include <ATen/core/Tensor.h>
+
+#include <functional>
+#include <vector>
+
+namespace at {
+
+/// Creates a batch of uninitialized tensors backed by a single allocation.
+///
+/// Compared to calling `at::empty` in a loop, the whole batch costs one
+/// dispatcher crossing, one device guard and one allocator call, which
+/// matters when creating many small tensors. Each tensor starts on an
+/// allocator-aligned boundary of the shared buffer and behaves like an
+/// independently created contiguous tensor; the allocation is freed once
+/// the last tensor referencing it is gone.
+TORCH_API std::vector<Tensor> empty_batch(
+    ArrayRef<IntArrayRef> sizes,
+    const TensorOptions& options = {});
+
+/// Creates a batch of tensors viewing consecutive, tightly packed regions of
+/// `data`. The blob must hold the tensors back to back in the given order
+/// with no padding in between. The optional `deleter` is called once, after
+/// the last tensor referencing the blob is gone.
+TORCH_API std::vector<Tensor> from_blob_batch(
+    void* data,
+    ArrayRef<IntArrayRef> sizes,
+    const std::function<void(void*)>& deleter,
+    const TensorOptions& options = {},
+    std::optional<Device> target_device = c10::nullopt);
+
+TORCH_API std::vector<Tensor> from_blob_batch(
+    void* data,
+    ArrayRef<IntArrayRef> sizes,
+    const TensorOptions& options = {},
+    std::optional<Device> target_device = c10::nullopt);
+
+} // namespace at
@@ -537,6 +537,11 @@ RecordFunction::RecordFunction(StepCallbacks&& step_callbacks)
   }
 }
 
+RecordFunction::RecordFunction(std::optional<StepCallbacks>&& step_callbacks)
+    : RecordFunction(
+          step_callbacks.has_value() ? std::move(*step_callbacks)
+                                     : StepCallbacks()) {}
+
 void RecordFunction::runStartCallbacks() {
   for (const auto i : c10::irange(step_callbacks_.callbacks_.size())) {
     tryRunCallback</*is_start=*/true>(
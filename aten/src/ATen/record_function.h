@@ -286,6 +286,11 @@ struct TORCH_API RecordFunction {
   //    kLowProb probability
   explicit RecordFunction(RecordScope scope = RecordScope::FUNCTION);
   explicit RecordFunction(StepCallbacks&& step_callbacks);
+  // Constructs an inactive RecordFunction when `step_callbacks` is empty.
+  // Used by the RECORD_FUNCTION macros together with
+  // `getStepCallbacksUnlessEmpty` to skip the StepCallbacks copy in the
+  // common case where no callbacks are registered.
+  explicit RecordFunction(std::optional<StepCallbacks>&& step_callbacks);
 
   template <typename F>
   void before(
@@ -587,28 +592,43 @@ void record_function_with_scope_and_debug_handle(
 
 } // namespace detail
 
+// Building with TORCH_DISABLE_RECORD_FUNCTION compiles the RECORD_FUNCTION
+// family of macros out entirely, for deployments where even the inactive
+// fast path (a sampling countdown decrement per annotated op) is unwanted.
+// Profilers and observers relying on these annotations will see no events.
+#ifdef TORCH_DISABLE_RECORD_FUNCTION
+
+#define RECORD_FUNCTION_WITH_SCOPE(scope, fn, inputs, ...)
+
+#define RECORD_FUNCTION_WITH_SCOPE_INPUTS_OUTPUTS( \
+    scope, fn, inputs, outputs, ...)
+
+#else // TORCH_DISABLE_RECORD_FUNCTION
+
 // optional argument - function's seq_no
-#define RECORD_FUNCTION_WITH_SCOPE(scope, fn, inputs, ...) \
-  at::RecordFunction guard(scope);                         \
-  if (guard.isActive()) {                                  \
-    ::at::detail::record_function_with_scope(              \
-        guard, fn, inputs, ##__VA_ARGS__);                 \
+#define RECORD_FUNCTION_WITH_SCOPE(scope, fn, inputs, ...)           \
+  at::RecordFunction guard(at::getStepCallbacksUnlessEmpty(scope));  \
+  if (C10_UNLIKELY(guard.isActive())) {                              \
+    ::at::detail::record_function_with_scope(                        \
+        guard, fn, inputs, ##__VA_ARGS__);                           \
   }
 
-#define RECORD_FUNCTION_WITH_SCOPE_INPUTS_OUTPUTS( \
-    scope, fn, inputs, outputs, ...)               \
-  at::RecordFunction guard(scope);                 \
-  if (guard.isActive()) {                          \
-    if (guard.needsInputs()) {                     \
-      guard.before(fn, inputs, ##__VA_ARGS__);     \
-    } else {                                       \
-      guard.before(fn, ##__VA_ARGS__);             \
-    }                                              \
-    if (guard.needsOutputs()) {                    \
-      guard.setOutputs(outputs);                   \
-    }                                              \
+#define RECORD_FUNCTION_WITH_SCOPE_INPUTS_OUTPUTS(                  \
+    scope, fn, inputs, outputs, ...)                                \
+  at::RecordFunction guard(at::getStepCallbacksUnlessEmpty(scope)); \
+  if (C10_UNLIKELY(guard.isActive())) {                             \
+    if (guard.needsInputs()) {                                      \
+      guard.before(fn, inputs, ##__VA_ARGS__);                      \
+    } else {                                                        \
+      guard.before(fn, ##__VA_ARGS__);                              \
+    }                                                               \
+    if (guard.needsOutputs()) {                                     \
+      guard.setOutputs(outputs);                                    \
+    }                                                               \
   }
 
+#endif // TORCH_DISABLE_RECORD_FUNCTION
+
 #define RECORD_FUNCTION(fn, inputs, ...) \
   RECORD_FUNCTION_WITH_SCOPE(            \
       at::RecordScope::FUNCTION, fn, inputs, ##__VA_ARGS__)
@@ -631,13 +651,18 @@ void record_function_with_scope_and_debug_handle(
 
 // Helper macro to pass in debug handle that is used to
 // post process events
-#define RECORD_WITH_SCOPE_DEBUG_HANDLE_AND_INPUTS(             \
-    scope, fn, debug_handle, inputs, ...)                      \
-  at::RecordFunction guard(scope);                             \
-  if (guard.isActive()) {                                      \
-    ::at::detail::record_function_with_scope_and_debug_handle( \
-        guard, fn, debug_handle, inputs, ##__VA_ARGS__);       \
-  }
+#ifdef TORCH_DISABLE_RECORD_FUNCTION
+#define RECORD_WITH_SCOPE_DEBUG_HANDLE_AND_INPUTS( \
+    scope, fn, debug_handle, inputs, ...)
+#else
+#define RECORD_WITH_SCOPE_DEBUG_HANDLE_AND_INPUTS(                  \
+    scope, fn, debug_handle, inputs, ...)                           \
+  at::RecordFunction guard(at::getStepCallbacksUnlessEmpty(scope)); \
+  if (C10_UNLIKELY(guard.isActive())) {                             \
+    ::at::detail::record_function_with_scope_and_debug_handle(      \
+        guard, fn, debug_handle, inputs, ##__VA_ARGS__);            \
+  }
+#endif // TORCH_DISABLE_RECORD_FUNCTION
 
 // Helper macros to record LITE INTERPETER scope events with debug handles
 #define RECORD_EDGE_SCOPE_WITH_DEBUG_HANDLE_AND_INPUTS( \
@@ -649,11 +674,15 @@ void record_function_with_scope_and_debug_handle(
 // launch to let the profiler bind the outputs to the op that produced
 // them.  Note that guard is declared by RECORD_FUNCTION so this macro
 // needs to be called from the same scope as RECORD_FUNCTION
+#ifdef TORCH_DISABLE_RECORD_FUNCTION
+#define RECORD_OUTPUTS(outputs)
+#else
 #define RECORD_OUTPUTS(outputs)                                    \
   if (guard.needsOutputs()) {                                      \
     guard.setOutputs(                                              \
         std::vector<c10::IValue>(outputs.begin(), outputs.end())); \
   }
+#endif // TORCH_DISABLE_RECORD_FUNCTION
 
 /**
  * addThreadLocalCallback adds a thread local callback to run with
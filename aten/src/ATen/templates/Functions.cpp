@@ -3,6 +3,9 @@
 #include <ATen/Functions.h>
 #include <ATen/Utils.h>
 #include <c10/core/Allocator.h>
+#include <c10/core/alignment.h>
+#include <c10/util/accumulate.h>
+#include <c10/util/irange.h>
 
 namespace at {
 
@@ -100,4 +103,129 @@ Tensor TensorMaker::make_tensor() {
    return IntArrayRef(zeros, 1);
  }
 
+namespace {
+
+void check_batch_options(const TensorOptions& options, const char* name) {
+  TORCH_CHECK(
+      options.layout() == Layout::Strided,
+      name, " only supports strided layout, got: ", options.layout());
+  TORCH_CHECK(
+      !options.memory_format_opt().has_value() ||
+          *options.memory_format_opt() == MemoryFormat::Contiguous,
+      name, " only supports contiguous tensors");
+}
+
+// Creates one contiguous tensor per entry of `sizes`, all sharing `storage`
+// at the given element offsets. The storage is freed once the last carved
+// tensor is gone.
+std::vector<Tensor> carve_batch_from_storage(
+    const Storage& storage,
+    ArrayRef<IntArrayRef> sizes,
+    const std::vector<int64_t>& element_offsets,
+    DispatchKey dispatch_key,
+    caffe2::TypeMeta dtype) {
+  std::vector<Tensor> result;
+  result.reserve(sizes.size());
+  for (const auto i : c10::irange(sizes.size())) {
+    Tensor tensor = detail::make_tensor<TensorImpl>(
+        Storage(storage), dispatch_key, dtype);
+    TensorImpl* tensor_impl = tensor.unsafeGetTensorImpl();
+    tensor_impl->set_sizes_contiguous(sizes[i]);
+    tensor_impl->set_storage_offset(element_offsets[i]);
+    result.push_back(std::move(tensor));
+  }
+  return result;
+}
+
+} // namespace
+
+std::vector<Tensor> empty_batch(
+    ArrayRef<IntArrayRef> sizes,
+    const TensorOptions& options) {
+  check_batch_options(options, "empty_batch");
+  const caffe2::TypeMeta dtype = options.dtype();
+  const auto itemsize = static_cast<int64_t>(dtype.itemsize());
+  constexpr auto alignment = static_cast<int64_t>(c10::gAlignment);
+  TORCH_INTERNAL_ASSERT(alignment % itemsize == 0);
+
+  // Lay the tensors out in aligned slots of one buffer, so each carved
+  // tensor starts on an allocator-aligned boundary just like an
+  // individually allocated tensor would.
+  std::vector<int64_t> element_offsets;
+  element_offsets.reserve(sizes.size());
+  int64_t total_bytes = 0;
+  for (const auto size : sizes) {
+    check_size_nonnegative(size);
+    element_offsets.push_back(total_bytes / itemsize);
+    const auto nbytes = c10::multiply_integers(size) * itemsize;
+    total_bytes += (nbytes + alignment - 1) / alignment * alignment;
+  }
+
+  // A single flat byte buffer pays the dispatcher crossing, device guard
+  // and allocator call once for the whole batch.
+  Tensor buffer = at::empty({total_bytes}, options.dtype(kByte));
+  return carve_batch_from_storage(
+      buffer.storage(), sizes, element_offsets, options.computeDispatchKey(), dtype);
+}
+
+std::vector<Tensor> from_blob_batch(
+    void* data,
+    ArrayRef<IntArrayRef> sizes,
+    const std::function<void(void*)>& deleter,
+    const TensorOptions& options,
+    std::optional<Device> target_device) {
+  check_batch_options(options, "from_blob_batch");
+  const caffe2::TypeMeta dtype = options.dtype();
+  const auto itemsize = static_cast<int64_t>(dtype.itemsize());
+
+  // The blob holds the tensors back to back with no padding.
+  std::vector<int64_t> element_offsets;
+  element_offsets.reserve(sizes.size());
+  int64_t total_numel = 0;
+  for (const auto size : sizes) {
+    check_size_nonnegative(size);
+    element_offsets.push_back(total_numel);
+    total_numel += c10::multiply_integers(size);
+  }
+
+  if (!target_device.has_value()) {
+    target_device =
+        globalContext().getDeviceFromPtr(data, options.device().type());
+  }
+  if (options.device().has_index()) {
+    TORCH_CHECK_VALUE(
+        options.device() == *target_device,
+        "Specified device ", options.device(),
+        " does not match device of data ", *target_device);
+  }
+
+  DataPtr data_ptr;
+  if (deleter) {
+    data_ptr = InefficientStdFunctionContext::makeDataPtr(
+        data, deleter, *target_device);
+  } else {
+    data_ptr = DataPtr(data, *target_device);
+  }
+  // One storage is shared by all carved tensors; the deleter runs once the
+  // last of them is gone.
+  Storage storage{
+      Storage::use_byte_size_t{},
+      static_cast<size_t>(total_numel * itemsize),
+      std::move(data_ptr),
+      /*allocator=*/nullptr,
+      /*resizable=*/false};
+
+  return carve_batch_from_storage(
+      storage, sizes, element_offsets, options.computeDispatchKey(), dtype);
+}
+
+std::vector<Tensor> from_blob_batch(
+    void* data,
+    ArrayRef<IntArrayRef> sizes,
+    const TensorOptions& options,
+    std::optional<Device> target_device) {
+  return from_blob_batch(
+      data, sizes, /*deleter=*/nullptr, options, std::move(target_device));
+}
+
 } // namespace at
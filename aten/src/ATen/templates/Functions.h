@@ -71,6 +71,7 @@
 #include <c10/util/Optional.h>
 #include <c10/util/OptionalArrayRef.h>
 
+#include <ATen/ops/empty_batch.h>
 #include <ATen/ops/from_blob.h>
 #include <ATen/ops/tensor.h>
 
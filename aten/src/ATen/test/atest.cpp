@@ -306,3 +306,57 @@ TEST_F(atest, atest) {
     ASSERT_EQ(t_.device(), at::Device(kCUDA, 0));
   }
 }
+
+TEST_F(atest, empty_batch) {
+  std::array<IntArrayRef, 3> shapes = {
+      IntArrayRef{2, 3}, IntArrayRef{5}, IntArrayRef{1, 1, 4}};
+  auto tensors = empty_batch(shapes);
+
+  ASSERT_EQ(tensors.size(), 3);
+  for (const auto i : c10::irange(tensors.size())) {
+    ASSERT_EQ(tensors[i].sizes(), shapes[i]);
+    ASSERT_EQ(tensors[i].dtype(), kFloat);
+    ASSERT_TRUE(tensors[i].is_contiguous());
+    // All tensors are carved out of one allocation
+    ASSERT_EQ(
+        tensors[i].storage().data(), tensors[0].storage().data());
+  }
+  // Carved tensors do not overlap
+  tensors[0].fill_(1);
+  tensors[1].fill_(2);
+  tensors[2].fill_(3);
+  ASSERT_TRUE(tensors[0].equal(ones({2, 3})));
+  ASSERT_TRUE(tensors[1].equal(2 * ones({5})));
+  ASSERT_TRUE(tensors[2].equal(3 * ones({1, 1, 4})));
+
+  auto typed = empty_batch({IntArrayRef{4}}, kByte);
+  ASSERT_EQ(typed.size(), 1);
+  ASSERT_EQ(typed[0].dtype(), kByte);
+}
+
+TEST_F(atest, from_blob_batch) {
+  // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers,modernize-avoid-c-arrays,cppcoreguidelines-avoid-c-arrays)
+  float data[] = {1, 2, 3, 4, 5, 6};
+
+  // The blob holds the tensors tightly packed back to back
+  auto tensors = from_blob_batch(data, {IntArrayRef{2, 2}, IntArrayRef{2}});
+  ASSERT_EQ(tensors.size(), 2);
+  ASSERT_EQ(tensors[0].data_ptr<float>(), data);
+  ASSERT_EQ(tensors[1].data_ptr<float>(), data + 4);
+  ASSERT_EQ(tensors[0][1][1].item<float>(), 4.0);
+  ASSERT_EQ(tensors[1][1].item<float>(), 6.0);
+
+  // The deleter runs once, after the last carved tensor is gone
+  int isgone = 0;
+  {
+    Tensor survivor;
+    {
+      auto f = from_blob_batch(
+          data, {IntArrayRef{2}, IntArrayRef{4}}, [&](void*) { isgone++; });
+      survivor = f[1];
+    }
+    ASSERT_EQ(isgone, 0);
+    survivor.reset();
+    ASSERT_EQ(isgone, 1);
+  }
+}
@@ -94,6 +94,26 @@ TEST(CPUGeneratorImpl, TestGetSetCurrentSeed) {
   ASSERT_EQ(current_seed, 123);
 }
 
+TEST(CPUGeneratorImpl, TestPhiloxEngineInputs) {
+  // Test Description:
+  // Batched fills reserve disjoint Philox counter ranges per call; the
+  // reservation counter restarts when the generator is reseeded.
+  // See Note [Acquire lock when using random generators]
+  auto gen = at::detail::createCPUGenerator(42);
+  auto cpu_gen = check_generator<CPUGeneratorImpl>(gen);
+  std::lock_guard<std::mutex> lock(gen.mutex());
+  auto first = cpu_gen->philox_engine_inputs(256);
+  auto second = cpu_gen->philox_engine_inputs(256);
+  ASSERT_EQ(first.first, 42);
+  ASSERT_EQ(first.second, 0);
+  ASSERT_EQ(second.first, 42);
+  ASSERT_EQ(second.second, 256);
+  cpu_gen->set_current_seed(123);
+  auto after_reseed = cpu_gen->philox_engine_inputs(256);
+  ASSERT_EQ(after_reseed.first, 123);
+  ASSERT_EQ(after_reseed.second, 0);
+}
+
 void thread_func_get_set_current_seed(Generator generator) {
   std::lock_guard<std::mutex> lock(generator.mutex());
   auto current_seed = generator.current_seed();
@@ -1,7 +1,9 @@
 #include <gtest/gtest.h>
 
+#include <ATen/ATen.h>
 #include <ATen/cuda/CUDAContext.h>
 #include <ATen/cuda/CUDAEvent.h>
+#include <ATen/cuda/CUDAForkJoin.h>
 #include <c10/core/Event.h>
 #include <c10/core/impl/InlineEvent.h>
 #include <c10/cuda/CUDAGuard.h>
@@ -433,3 +435,28 @@ TEST(TestStream, ExternalMultiThreadTest) {
   cudaStreamDestroy(cuda_stream_a);
   cudaStreamDestroy(cuda_stream_b);
 }
+
+// Fork/Join scope
+TEST(TestStream, ForkJoinScopeTest) {
+  if (!at::cuda::is_available()) return;
+
+  const auto options = at::dtype(at::kFloat).device(at::kCUDA);
+  at::Tensor x1 = at::ones({64, 64}, options);
+  at::Tensor x2 = at::ones({64, 64}, options);
+  at::Tensor y1, y2;
+
+  {
+    at::cuda::CUDAForkJoinScope scope(2);
+    scope.fork({x1}, [&] { y1 = x1 + 1; });
+    scope.fork({x2}, [&] { y2 = x2 * 2; });
+    scope.join({y1, y2});
+
+    // Consumed on the parent stream after join().
+    at::Tensor sum = y1 + y2;
+    ASSERT_TRUE(sum.equal(at::full({64, 64}, 4.0, options)));
+  }
+
+  // The scope must restore the parent stream after each branch.
+  ASSERT_EQ_CUDA(
+      at::cuda::getCurrentCUDAStream(), at::cuda::getDefaultCUDAStream());
+}
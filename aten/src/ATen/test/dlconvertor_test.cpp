@@ -20,6 +20,34 @@ TEST(TestDlconvertor, TestDlconvertor) {
   ASSERT_TRUE(a.equal(b));
 }
 
+TEST(TestDlconvertor, TestDlconvertorBatch) {
+  manual_seed(123);
+
+  std::vector<Tensor> tensors = {rand({3, 4}), rand({5}), rand({2, 2, 2})};
+  std::vector<DLManagedTensor*> dlMTensors = toDLPackBatch(tensors);
+  ASSERT_EQ(dlMTensors.size(), tensors.size());
+
+  // Consume in reverse; the pool must stay alive until the last record goes.
+  for (size_t i = tensors.size(); i > 0; i--) {
+    Tensor b = fromDLPack(dlMTensors[i - 1]);
+    ASSERT_TRUE(tensors[i - 1].equal(b));
+  }
+}
+
+TEST(TestDlconvertor, TestDlconvertorBorrowed) {
+  manual_seed(123);
+
+  Tensor a = rand({3, 4});
+  DLManagedTensor dlMTensor;
+  toDLPackBorrowed(a, dlMTensor);
+  ASSERT_EQ(dlMTensor.deleter, nullptr);
+
+  Tensor b = fromDLPackBorrowed(&dlMTensor);
+
+  ASSERT_TRUE(a.equal(b));
+  ASSERT_EQ(a.data_ptr(), b.data_ptr());
+}
+
 TEST(TestDlconvertor, TestDlconvertorNoStrides) {
   manual_seed(123);
 
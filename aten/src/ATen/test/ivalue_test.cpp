@@ -6,6 +6,8 @@
 #include <gtest/gtest.h>
 #include <torch/torch.h>
 
+#include <thread>
+
 // Snippets for checking assembly.
 c10::IValue inspectTupleConstruction() {
   std::tuple<std::string, std::string> s = std::make_tuple(
@@ -376,6 +378,28 @@ TEST(IValueTest, FutureCallbacks) {
   ASSERT_FALSE(f2->hasError());
 }
 
+TEST(IValueTest, FutureChainedCallbacksRunInline) {
+  // CPU-only futures run continuations on the completing thread, so a
+  // then()-chain is flushed synchronously by the final markCompleted().
+  auto head = c10::make_intrusive<ivalue::Future>(IntType::get());
+  auto tail = head;
+  for (const auto i : c10::irange(10)) {
+    (void)i;
+    tail = tail->then(
+        [](ivalue::Future& parent) { return IValue(parent.value().toInt() + 1); },
+        IntType::get());
+  }
+  const auto completing_thread = std::this_thread::get_id();
+  std::thread::id callback_thread;
+  tail->addCallback([&callback_thread](ivalue::Future&) {
+    callback_thread = std::this_thread::get_id();
+  });
+  head->markCompleted(IValue(0));
+  ASSERT_TRUE(tail->completed());
+  ASSERT_EQ(10, tail->value().toInt());
+  ASSERT_EQ(completing_thread, callback_thread);
+}
+
 TEST(IValueTest, FutureExceptions) {
   auto f3 = c10::make_intrusive<ivalue::Future>(IntType::get());
   int calledTimes = 0;
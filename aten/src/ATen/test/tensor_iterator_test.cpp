@@ -266,3 +266,27 @@ TEST(TensorIteratorTest, CpuKernelMultipleOutputs_##name) {
   EXPECT_TRUE(out2.equal(expected2));                                                               \
 }
 AT_FORALL_SCALAR_TYPES(MULTIPLE_OUTPUTS_TEST_ITER_FOR_TYPE)
+
+// Building the same iterator twice must produce identical results; the
+// second build replays the cached iteration plan (see IterationPlanCache)
+// because the outputs are preallocated and shapes/strides repeat.
+TEST(TensorIteratorTest, RepeatedBuildUsesPlanCache) {
+  auto a = at::randn({4, 6, 8}).transpose(0, 2);
+  auto b = at::randn({8, 6, 4});
+  auto out = at::empty({8, 6, 4});
+  auto expected = a.add(b);
+  for (const auto i : c10::irange(3)) {
+    (void)i;
+    auto iter = TensorIterator::binary_op(out, a, b);
+    at::native::cpu_kernel(iter, [](float x, float y) { return x + y; });
+    EXPECT_TRUE(out.equal(expected));
+  }
+
+  // A different shape with the same rank must miss the cache and rebuild.
+  auto c = at::randn({2, 6, 8}).transpose(0, 2);
+  auto d = at::randn({8, 6, 2});
+  auto out2 = at::empty({8, 6, 2});
+  auto iter = TensorIterator::binary_op(out2, c, d);
+  at::native::cpu_kernel(iter, [](float x, float y) { return x + y; });
+  EXPECT_TRUE(out2.equal(c.add(d)));
+}
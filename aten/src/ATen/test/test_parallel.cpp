@@ -5,13 +5,14 @@
 #include <ATen/Parallel.h>
 #include <ATen/ParallelFuture.h>
 
+#include <atomic>
 #include <iostream>
 // NOLINTNEXTLINE(modernize-deprecated-headers)
 #include <string.h>
 #include <sstream>
+#include <thread>
 #if AT_MKL_ENABLED()
 #include <mkl.h>
-#include <thread>
 #endif
 
 struct NumThreadsGuard {
@@ -124,3 +125,23 @@ TEST(TestParallel, IntraOpLaunchFuture) {
 
   ASSERT_TRUE(v1 == 1 && v2 == 2);
 }
+
+TEST(TestParallel, ThreadPoolCpuAffinity) {
+  // No affinity is configured by default
+  ASSERT_TRUE(at::get_thread_pool_cpu_affinity().empty());
+
+  // NOLINTNEXTLINE(hicpp-avoid-goto,cppcoreguidelines-avoid-goto)
+  ASSERT_THROW(at::set_thread_pool_cpu_affinity({}), std::exception);
+  // NOLINTNEXTLINE(hicpp-avoid-goto,cppcoreguidelines-avoid-goto)
+  ASSERT_THROW(at::set_thread_pool_cpu_affinity({-1}), std::exception);
+
+  // Spin up the inter-op pool; once its threads have initialized, the
+  // affinity can no longer change
+  std::atomic<bool> done{false};
+  at::launch([&done]() { done = true; });
+  while (!done) {
+    std::this_thread::yield();
+  }
+  // NOLINTNEXTLINE(hicpp-avoid-goto,cppcoreguidelines-avoid-goto)
+  ASSERT_THROW(at::set_thread_pool_cpu_affinity({0}), std::exception);
+}
@@ -0,0 +1,121 @@
+// Eager-mode framework overhead benchmarks.
+//
+// Each scenario pins one slice of the per-op overhead stack (dispatcher
+// round trip, autograd wrapper, TensorImpl creation, bucket and batch
+// plumbing) on tiny inputs, so the numbers track bookkeeping cost rather
+// than kernel time. Keep the scenarios stable across releases: baselines
+// recorded with --benchmark_format=json are compared between builds to
+// gate upgrades on framework-overhead regressions (see the README).
+
+#include <benchmark/benchmark.h>
+#include <torch/torch.h>
+
+#include <c10/util/irange.h>
+
+#include <utility>
+#include <vector>
+
+namespace {
+
+// A dispatcher round trip through an op whose kernel does almost nothing.
+void BM_DispatchNoop(benchmark::State& state) {
+  auto t = torch::randn({1});
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(at::_has_compatible_shallow_copy_type(t, t));
+  }
+}
+
+// View creation: dispatch plus allocation of a view TensorImpl.
+void BM_ViewCreation(benchmark::State& state) {
+  auto t = torch::randn({4, 4});
+  for (auto _ : state) {
+    auto v = t.view({16});
+    benchmark::DoNotOptimize(v);
+  }
+}
+
+// One-element add without autograd: dispatch, type promotion, output
+// allocation; the kernel itself is negligible.
+void BM_AddOneElement(benchmark::State& state) {
+  torch::NoGradGuard no_grad;
+  auto a = torch::randn({1});
+  auto b = torch::randn({1});
+  for (auto _ : state) {
+    auto c = a + b;
+    benchmark::DoNotOptimize(c);
+  }
+}
+
+// Same add with the autograd wrapper engaged: grad_fn allocation and graph
+// bookkeeping on top of the dispatch cost.
+void BM_AddOneElementAutograd(benchmark::State& state) {
+  auto a = torch::randn({1}, torch::requires_grad());
+  auto b = torch::randn({1});
+  for (auto _ : state) {
+    auto c = a + b;
+    benchmark::DoNotOptimize(c);
+  }
+}
+
+// Same add under InferenceMode, the cheapest configuration the overhead
+// stack offers.
+void BM_AddOneElementInferenceMode(benchmark::State& state) {
+  c10::InferenceMode guard;
+  auto a = torch::randn({1});
+  auto b = torch::randn({1});
+  for (auto _ : state) {
+    auto c = a + b;
+    benchmark::DoNotOptimize(c);
+  }
+}
+
+// DDP hands gradients to the communication backend as flattened buckets;
+// this measures the flatten/unflatten round trip that brackets every
+// collective, without the collective itself.
+void BM_GradBucketFlatten(benchmark::State& state) {
+  const auto num_grads = state.range(0);
+  std::vector<at::Tensor> grads;
+  grads.reserve(num_grads);
+  for (const auto i : c10::irange(num_grads)) {
+    (void)i;
+    grads.push_back(torch::randn({256}));
+  }
+  for (auto _ : state) {
+    auto flat = at::flatten_dense_tensors(grads);
+    auto out = at::unflatten_dense_tensors(flat, grads);
+    benchmark::DoNotOptimize(out);
+  }
+}
+
+// DataLoader batch collation: the Stack transform over a batch of
+// examples, as run by every worker for every delivered batch.
+void BM_CollateStack(benchmark::State& state) {
+  const auto batch_size = state.range(0);
+  std::vector<torch::data::Example<>> batch;
+  batch.reserve(batch_size);
+  for (const auto i : c10::irange(batch_size)) {
+    (void)i;
+    batch.emplace_back(torch::randn({3, 8, 8}), torch::tensor(int64_t(0)));
+  }
+  torch::data::transforms::Stack<torch::data::Example<>> stack;
+  for (auto _ : state) {
+    auto examples = batch;
+    auto collated = stack.apply_batch(std::move(examples));
+    benchmark::DoNotOptimize(collated);
+  }
+}
+
+} // namespace
+
+BENCHMARK(BM_DispatchNoop);
+BENCHMARK(BM_ViewCreation);
+BENCHMARK(BM_AddOneElement);
+BENCHMARK(BM_AddOneElementAutograd);
+BENCHMARK(BM_AddOneElementInferenceMode);
+BENCHMARK(BM_GradBucketFlatten)->Arg(16)->Arg(64);
+BENCHMARK(BM_CollateStack)->Arg(32);
+
+int main(int argc, char** argv) {
+  ::benchmark::Initialize(&argc, argv);
+  ::benchmark::RunSpecifiedBenchmarks();
+}
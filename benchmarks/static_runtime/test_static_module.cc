@@ -795,6 +795,82 @@ TEST(StaticRuntime, ManageOutputTensorsWithoutDeallocateOutputTensors) {
   runtime(input_tensors, {});
 }
 
+TEST(StaticRuntime, BucketizeManagedStorageSizes) {
+  const std::string test_graph = R"IR(
+    graph(%0 : Tensor):
+      # This intermediate tensor is managed by the memory planner.
+      %1 : Tensor = aten::mul(%0, %0)
+      %2 : Tensor = aten::mul(%1, %1)
+      return (%2)
+  )IR";
+  auto g = std::make_shared<torch::jit::Graph>();
+  torch::jit::parseIR(test_graph, g.get());
+  torch::jit::StaticModuleOptions opts;
+  opts.bucketize_managed_storage_sizes = true;
+  torch::jit::StaticModule smod(g, opts);
+  torch::jit::StaticRuntime runtime(smod);
+
+  auto run_and_check = [&](int64_t numel) {
+    auto a = at::randn({numel});
+    std::vector<at::IValue> args{a};
+    auto expected = (a * a) * (a * a);
+    auto output = runtime(args, {}).toTensor();
+    runtime.check_for_memory_leak();
+    EXPECT_TRUE(at::allclose(output, expected));
+  };
+
+  // Profile run, then a second run that draws from the planned buffer.
+  run_and_check(100);
+  run_and_check(100);
+  // 100 floats = 400 bytes, rounded up to the next power of two.
+  const auto* planner = runtime.get_memory_planner();
+  ASSERT_NE(planner, nullptr);
+  EXPECT_EQ(planner->total_managed(), 512);
+  // A slightly smaller shape lands in the same bucket, so the planned
+  // buffer size is unchanged.
+  run_and_check(90);
+  EXPECT_EQ(planner->total_managed(), 512);
+}
+
+TEST(StaticRuntime, ShareActivationArena) {
+  const std::string test_graph = R"IR(
+    graph(%0 : Tensor):
+      # This intermediate tensor is managed by the memory planner.
+      %1 : Tensor = aten::mul(%0, %0)
+      %2 : Tensor = aten::mul(%1, %1)
+      return (%2)
+  )IR";
+  auto g = std::make_shared<torch::jit::Graph>();
+  torch::jit::parseIR(test_graph, g.get());
+  torch::jit::StaticModuleOptions opts;
+  opts.share_activation_arena = true;
+  torch::jit::StaticModule smod(g, opts);
+  // Two runtimes cloned from the same module lease their per-request arenas
+  // from the module's shared pool.
+  torch::jit::StaticRuntime runtime1(smod);
+  torch::jit::StaticRuntime runtime2(smod);
+
+  auto run_and_check = [&](torch::jit::StaticRuntime& runtime, int64_t numel) {
+    auto a = at::randn({numel});
+    std::vector<at::IValue> args{a};
+    auto expected = (a * a) * (a * a);
+    auto output = runtime(args, {}).toTensor();
+    runtime.check_for_memory_leak();
+    EXPECT_TRUE(at::allclose(output, expected));
+  };
+
+  // Interleave the two runtimes; after the profile runs, the second and
+  // later iterations draw their arenas from the shared pool.
+  for (const auto i : c10::irange(3)) {
+    (void)i;
+    run_and_check(runtime1, 100);
+    run_and_check(runtime2, 100);
+  }
+  // Shape changes still work: the lease simply grows the slab.
+  run_and_check(runtime1, 1000);
+  run_and_check(runtime2, 10);
+}
+
 TEST(StaticRuntime, DisableManageOutputTensors) {
   const std::string test_graph = R"IR(
     graph(%0 : Tensor):
@@ -6,6 +6,10 @@
 #include <c10/mobile/CPUCachingAllocator.h>
 #include <c10/mobile/CPUProfilingAllocator.h>
 #include <c10/util/Logging.h>
+#include <c10/util/env.h>
+
+#include <mutex>
+#include <vector>
 
 // TODO: rename flag to C10
 C10_DEFINE_bool(
@@ -15,12 +19,167 @@ C10_DEFINE_bool(
 
 namespace c10 {
 
+namespace {
+
+// A per-thread size-class arena for small CPU allocations, opted into with
+// TORCH_CPU_SMALL_ALLOC_ARENA=1.  Workloads that churn through millions of
+// small tensors per second (e.g. small-batch inference) are dominated by
+// posix_memalign/free in alloc_cpu/free_cpu; caching freed blocks in
+// thread-local free lists keeps those allocations off the global heap.
+//
+// Every allocation made while the arena is enabled is prefixed with a
+// gAlignment-sized header recording the owning arena and the size class, so
+// a single deleter can serve both cached and spilled (large) blocks, and
+// blocks freed on a different thread than the one that allocated them can be
+// returned to their owner.  Arenas are intentionally never destroyed: live
+// blocks may outlive the thread that allocated them and still need to find
+// their owning arena from the deleter.
+class ThreadLocalSmallBlockArena {
+ public:
+  // Blocks up to this many bytes (net of the header) are cached.
+  static constexpr size_t kMaxSmallAlloc = 4096;
+  // Size classes are gAlignment-granular: class i serves (i + 1) * gAlignment
+  // bytes of user data.
+  static constexpr size_t kNumClasses = kMaxSmallAlloc / gAlignment;
+  // Per-class cap on cached blocks, to bound per-thread memory held.
+  static constexpr size_t kMaxCachedPerClass = 64;
+  // Header value used for allocations that bypass the free lists.
+  static constexpr size_t kSpillClass = kNumClasses;
+
+  struct Header {
+    ThreadLocalSmallBlockArena* owner;
+    size_t size_class;
+  };
+  static_assert(
+      sizeof(Header) <= gAlignment,
+      "arena header must fit in one alignment quantum");
+
+  static bool enabled() {
+    static bool enabled_ =
+        c10::utils::check_env("TORCH_CPU_SMALL_ALLOC_ARENA") == true;
+    return enabled_;
+  }
+
+  static ThreadLocalSmallBlockArena& current() {
+    // Leaked on purpose; see class comment.
+    static thread_local ThreadLocalSmallBlockArena* arena =
+        new ThreadLocalSmallBlockArena();
+    return *arena;
+  }
+
+  // Allocates nbytes of user data, prefixed with a header.  Small requests
+  // are served from the calling thread's free lists; everything else spills
+  // to alloc_cpu.
+  static void* allocate(size_t nbytes) {
+    if (nbytes > kMaxSmallAlloc) {
+      void* raw = c10::alloc_cpu(gAlignment + nbytes);
+      init_header(raw, nullptr, kSpillClass);
+      return static_cast<uint8_t*>(raw) + gAlignment;
+    }
+    return current().allocate_small(nbytes);
+  }
+
+  // Frees a block previously returned by allocate().
+  static void deallocate(void* ptr) {
+    void* raw = static_cast<uint8_t*>(ptr) - gAlignment;
+    auto* header = static_cast<Header*>(raw);
+    if (header->size_class == kSpillClass) {
+      c10::free_cpu(raw);
+      return;
+    }
+    header->owner->deallocate_small(raw, header->size_class);
+  }
+
+ private:
+  ThreadLocalSmallBlockArena() : free_lists_(kNumClasses) {}
+
+  static void init_header(
+      void* raw,
+      ThreadLocalSmallBlockArena* owner,
+      size_t size_class) {
+    auto* header = static_cast<Header*>(raw);
+    header->owner = owner;
+    header->size_class = size_class;
+  }
+
+  void* allocate_small(size_t nbytes) {
+    const size_t size_class = nbytes == 0 ? 0 : (nbytes - 1) / gAlignment;
+    auto& free_list = free_lists_[size_class];
+    if (free_list.empty()) {
+      drain_remote_frees();
+    }
+    void* raw = nullptr;
+    if (!free_list.empty()) {
+      raw = free_list.back();
+      free_list.pop_back();
+    } else {
+      raw = c10::alloc_cpu(gAlignment + (size_class + 1) * gAlignment);
+    }
+    init_header(raw, this, size_class);
+    return static_cast<uint8_t*>(raw) + gAlignment;
+  }
+
+  void deallocate_small(void* raw, size_t size_class) {
+    if (this == &current()) {
+      auto& free_list = free_lists_[size_class];
+      if (free_list.size() < kMaxCachedPerClass) {
+        free_list.push_back(raw);
+        return;
+      }
+      c10::free_cpu(raw);
+      return;
+    }
+    // Freed from a different thread: hand the block back to the owner.
+    std::lock_guard<std::mutex> guard(remote_mutex_);
+    remote_frees_.push_back(raw);
+  }
+
+  void drain_remote_frees() {
+    std::vector<void*> drained;
+    {
+      std::lock_guard<std::mutex> guard(remote_mutex_);
+      drained.swap(remote_frees_);
+    }
+    for (void* raw : drained) {
+      const size_t size_class = static_cast<Header*>(raw)->size_class;
+      auto& free_list = free_lists_[size_class];
+      if (free_list.size() < kMaxCachedPerClass) {
+        free_list.push_back(raw);
+      } else {
+        c10::free_cpu(raw);
+      }
+    }
+  }
+
+  // Only touched by the owning thread.
+  std::vector<std::vector<void*>> free_lists_;
+  // Blocks freed by other threads, pending reuse by the owner.
+  std::mutex remote_mutex_;
+  std::vector<void*> remote_frees_;
+};
+
+} // namespace
+
 struct C10_API DefaultCPUAllocator final : at::Allocator {
   DefaultCPUAllocator() = default;
   at::DataPtr allocate(size_t nbytes) override {
     void* data = nullptr;
     try {
-      data = c10::alloc_cpu(nbytes);
+      // nbytes == 0 falls through to alloc_cpu, which maps it to nullptr.
+      // The small-block arena takes precedence over a scoped caching
+      // allocator: both are recycling schemes, and arena blocks carry a
+      // header the caching allocator knows nothing about.
+      if (nbytes > 0 && ThreadLocalSmallBlockArena::enabled()) {
+        data = ThreadLocalSmallBlockArena::allocate(nbytes);
+      } else if (auto* caching_allocator = GetThreadLocalCachingAllocator();
+                 nbytes > 0 && caching_allocator != nullptr) {
+        // Inside a WithCPUCachingAllocatorGuard scope: draw the block from
+        // the caller-provided recycled pool, so functional ops reuse output
+        // buffers of recurring sizes instead of hitting the heap.
+        data = caching_allocator->allocate(nbytes);
+      } else {
+        data = c10::alloc_cpu(nbytes);
+      }
     } catch (c10::Error& e) {
       profiledCPUMemoryReporter().OutOfMemory(nbytes);
       throw e;
@@ -34,6 +193,22 @@ struct C10_API DefaultCPUAllocator final : at::Allocator {
       return;
     }
     profiledCPUMemoryReporter().Delete(ptr);
+    if (ThreadLocalSmallBlockArena::enabled()) {
+      ThreadLocalSmallBlockArena::deallocate(ptr);
+      return;
+    }
+    if (auto* caching_allocator = GetThreadLocalCachingAllocator()) {
+      caching_allocator->free(ptr);
+      return;
+    }
+    if (CPUCachingAllocatorEverEnabled()) {
+      // A block allocated inside a caching scope may be freed after the
+      // scope closed; untrack it so the pool doesn't hand it out again.
+      // Untrack before releasing: once free_cpu returns, another thread may
+      // reallocate the same address inside a caching scope, and a late
+      // record_free would erase that live entry.
+      CPUCachingAllocator::record_free(ptr);
+    }
     free_cpu(ptr);
   }
 
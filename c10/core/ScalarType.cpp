@@ -38,10 +38,41 @@ calculate_dtype2index() {
 
 constexpr auto dtype2index = calculate_dtype2index();
 
-} // anonymous namespace
+// This table axes must be consistent with index2dtype
+// clang-format off
+constexpr std::
+array<std::array<ScalarType, index2dtype.size()>, index2dtype.size()>
+    _promoteTypesLookup = {{
+    /*        u1  i1  i2  i4  i8  f2  f4  f8  c2  c4  c8  b1  bf*/
+    /* u1 */ {u1, i2, i2, i4, i8, f2, f4, f8, c2, c4, c8, u1, bf},
+    /* i1 */ {i2, i1, i2, i4, i8, f2, f4, f8, c2, c4, c8, i1, bf},
+    /* i2 */ {i2, i2, i2, i4, i8, f2, f4, f8, c2, c4, c8, i2, bf},
+    /* i4 */ {i4, i4, i4, i4, i8, f2, f4, f8, c2, c4, c8, i4, bf},
+    /* i8 */ {i8, i8, i8, i8, i8, f2, f4, f8, c2, c4, c8, i8, bf},
+    /* f2 */ {f2, f2, f2, f2, f2, f2, f4, f8, c2, c4, c8, f2, f4},
+    /* f4 */ {f4, f4, f4, f4, f4, f4, f4, f8, c4, c4, c8, f4, f4},
+    /* f8 */ {f8, f8, f8, f8, f8, f8, f8, f8, c8, c8, c8, f8, f8},
+    /* c2 */ {c2, c2, c2, c2, c2, c2, c4, c8, c2, c4, c8, c2, c4},
+    /* c4 */ {c4, c4, c4, c4, c4, c4, c4, c8, c4, c4, c8, c4, c4},
+    /* c8 */ {c8, c8, c8, c8, c8, c8, c8, c8, c8, c8, c8, c8, c8},
+    /* b1 */ {u1, i1, i2, i4, i8, f2, f4, f8, c2, c4, c8, b1, bf},
+    /* bf */ {bf, bf, bf, bf, bf, f4, f4, f8, c4, c4, c8, bf, bf},
+}};
+// clang-format on
 
-ScalarType promoteTypes(ScalarType a, ScalarType b) {
-  // This is generated according to NumPy's promote_types
+// Note [Full promotion matrix]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// promoteTypes used to re-derive the qint/bits/float8/barebones-unsigned
+// special cases with a chain of predicate calls on every invocation, which
+// shows up in TensorIterator::compute_types for every mixed-dtype elementwise
+// call. The rules are a pure function of the two dtypes, so the full
+// NumOptions x NumOptions matrix is materialized at compile time instead and
+// the hot path becomes a single load. Combinations that must raise an error
+// are marked with the NumOptions sentinel and routed to the cold reporting
+// path, which re-derives which rule was violated to keep the messages.
+constexpr auto invalid = ScalarType::NumOptions;
+
+constexpr ScalarType calculatePromoteType(ScalarType a, ScalarType b) {
   if (a == ud || b == ud) {
     return ScalarType::Undefined;
   }
@@ -51,14 +82,8 @@ ScalarType promoteTypes(ScalarType a, ScalarType b) {
     return a;
   }
 
-  // Handle identically equal types
   if (isQIntType(a) || isQIntType(b)) {
-    TORCH_CHECK(
-        false,
-        "promoteTypes with quantized numbers is not handled yet; figure out what the correct rules should be, offending types: ",
-        toString(a),
-        " ",
-        toString(b));
+    return invalid;
   }
 
   if (isBitsType(a) || isBitsType(b)) {
@@ -66,12 +91,7 @@ ScalarType promoteTypes(ScalarType a, ScalarType b) {
   }
 
   if (isFloat8Type(a) || isFloat8Type(b)) {
-    TORCH_CHECK(
-        false,
-        "Promotion for Float8 Types is not supported, attempted to promote ",
-        toString(a),
-        " and ",
-        toString(b));
+    return invalid;
   }
 
   if (isBarebonesUnsignedType(a) || isBarebonesUnsignedType(b)) {
@@ -91,41 +111,83 @@ ScalarType promoteTypes(ScalarType a, ScalarType b) {
     if (isFloatingType(b)) {
       return b;
     }
+    return invalid;
+  }
+
+  const auto ix_a = dtype2index[static_cast<int64_t>(a)];
+  const auto ix_b = dtype2index[static_cast<int64_t>(b)];
+  if (ix_a == -1 || ix_b == -1) {
+    // Every dtype outside index2dtype must have been handled above.
+    return invalid;
+  }
+  return _promoteTypesLookup[ix_a][ix_b];
+}
+
+constexpr std::array<
+    std::array<ScalarType, static_cast<size_t>(ScalarType::NumOptions)>,
+    static_cast<size_t>(ScalarType::NumOptions)>
+calculate_promote_types_lookup() {
+  std::array<
+      std::array<ScalarType, static_cast<size_t>(ScalarType::NumOptions)>,
+      static_cast<size_t>(ScalarType::NumOptions)>
+      table = {};
+  for (size_t a = 0; a < static_cast<size_t>(ScalarType::NumOptions); a++) {
+    for (size_t b = 0; b < static_cast<size_t>(ScalarType::NumOptions); b++) {
+      table[a][b] = calculatePromoteType(
+          static_cast<ScalarType>(a), static_cast<ScalarType>(b));
+    }
+  }
+  return table;
+}
+
+constexpr auto promote_types_lookup = calculate_promote_types_lookup();
+
+[[noreturn]] void reportInvalidPromotion(ScalarType a, ScalarType b) {
+  if (isQIntType(a) || isQIntType(b)) {
+    TORCH_CHECK(
+        false,
+        "promoteTypes with quantized numbers is not handled yet; figure out what the correct rules should be, offending types: ",
+        toString(a),
+        " ",
+        toString(b));
+  }
+  if (isFloat8Type(a) || isFloat8Type(b)) {
     TORCH_CHECK(
         false,
-        "Promotion for uint16, uint32, uint64 types is not supported, attempted to promote ",
+        "Promotion for Float8 Types is not supported, attempted to promote ",
         toString(a),
         " and ",
         toString(b));
   }
+  TORCH_CHECK(
+      false,
+      "Promotion for uint16, uint32, uint64 types is not supported, attempted to promote ",
+      toString(a),
+      " and ",
+      toString(b));
+}
 
-  auto ix_a = dtype2index[static_cast<int64_t>(a)];
-  TORCH_INTERNAL_ASSERT(ix_a != -1);
-  auto ix_b = dtype2index[static_cast<int64_t>(b)];
-  TORCH_INTERNAL_ASSERT(ix_b != -1);
-
-  // This table axes must be consistent with index2dtype
-  // clang-format off
-  static constexpr std::
-  array<std::array<ScalarType, index2dtype.size()>, index2dtype.size()>
-      _promoteTypesLookup = {{
-      /*        u1  i1  i2  i4  i8  f2  f4  f8  c2  c4  c8  b1  bf*/
-      /* u1 */ {u1, i2, i2, i4, i8, f2, f4, f8, c2, c4, c8, u1, bf},
-      /* i1 */ {i2, i1, i2, i4, i8, f2, f4, f8, c2, c4, c8, i1, bf},
-      /* i2 */ {i2, i2, i2, i4, i8, f2, f4, f8, c2, c4, c8, i2, bf},
-      /* i4 */ {i4, i4, i4, i4, i8, f2, f4, f8, c2, c4, c8, i4, bf},
-      /* i8 */ {i8, i8, i8, i8, i8, f2, f4, f8, c2, c4, c8, i8, bf},
-      /* f2 */ {f2, f2, f2, f2, f2, f2, f4, f8, c2, c4, c8, f2, f4},
-      /* f4 */ {f4, f4, f4, f4, f4, f4, f4, f8, c4, c4, c8, f4, f4},
-      /* f8 */ {f8, f8, f8, f8, f8, f8, f8, f8, c8, c8, c8, f8, f8},
-      /* c2 */ {c2, c2, c2, c2, c2, c2, c4, c8, c2, c4, c8, c2, c4},
-      /* c4 */ {c4, c4, c4, c4, c4, c4, c4, c8, c4, c4, c8, c4, c4},
-      /* c8 */ {c8, c8, c8, c8, c8, c8, c8, c8, c8, c8, c8, c8, c8},
-      /* b1 */ {u1, i1, i2, i4, i8, f2, f4, f8, c2, c4, c8, b1, bf},
-      /* bf */ {bf, bf, bf, bf, bf, f4, f4, f8, c4, c4, c8, bf, bf},
-  }};
-  // clang-format on
-  return _promoteTypesLookup[ix_a][ix_b];
+} // anonymous namespace
+
+ScalarType promoteTypes(ScalarType a, ScalarType b) {
+  // This is generated according to NumPy's promote_types.
+  // See Note [Full promotion matrix]
+  const auto result =
+      promote_types_lookup[static_cast<size_t>(a)][static_cast<size_t>(b)];
+  if (C10_UNLIKELY(result == ScalarType::NumOptions)) {
+    reportInvalidPromotion(a, b);
+  }
+  return result;
+}
+
+ScalarType promoteTypes(ArrayRef<ScalarType> types) {
+  TORCH_CHECK(
+      !types.empty(), "promoteTypes expects a non-empty list of dtypes");
+  ScalarType result = types.front();
+  for (const auto t : types.slice(1)) {
+    result = promoteTypes(result, t);
+  }
+  return result;
 }
 
 std::pair<std::string, std::string> getDtypeNames(c10::ScalarType scalarType) {
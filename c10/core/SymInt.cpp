@@ -61,12 +61,120 @@ bool SymInt::has_hint() const {
     }                                                                \
   }
 
+// The arithmetic operators are written out by hand instead of using
+// DEFINE_BINARY so they can short-circuit identities (x + 0, x * 1, x / 1)
+// and annihilators (x * 0, x % 1) without materializing any SymNode: the
+// wrapped constant node, the virtual dispatch and the result node are all
+// skipped, and the symbolic operand is returned by just bumping its
+// refcount. These rewrites are definitionally true for any integer,
+// including unbacked symbols, so no guard is lost; the symbolic backend
+// would perform the same simplification after allocating the nodes.
+// Comparisons must NOT be short-circuited this way since they produce
+// guards.
+
+SymInt SymInt::operator+(const SymInt& sci) const {
+  if (auto ma = maybe_as_int()) {
+    if (auto mb = sci.maybe_as_int()) {
+      return SymInt(*ma + *mb);
+    }
+    if (*ma == 0) {
+      return sci;
+    }
+    auto b = sci.toSymNode();
+    return SymInt(b->wrap_int(*ma)->add(b));
+  }
+  if (auto mb = sci.maybe_as_int()) {
+    if (*mb == 0) {
+      return *this;
+    }
+    auto a = toSymNodeImplUnowned();
+    return SymInt(a->add(a->wrap_int(*mb)));
+  }
+  return SymInt(toSymNodeImplUnowned()->add(sci.toSymNode()));
+}
+
+SymInt SymInt::operator-(const SymInt& sci) const {
+  if (auto ma = maybe_as_int()) {
+    if (auto mb = sci.maybe_as_int()) {
+      return SymInt(*ma - *mb);
+    }
+    auto b = sci.toSymNode();
+    return SymInt(b->wrap_int(*ma)->sub(b));
+  }
+  if (auto mb = sci.maybe_as_int()) {
+    if (*mb == 0) {
+      return *this;
+    }
+    auto a = toSymNodeImplUnowned();
+    return SymInt(a->sub(a->wrap_int(*mb)));
+  }
+  return SymInt(toSymNodeImplUnowned()->sub(sci.toSymNode()));
+}
+
+SymInt SymInt::operator*(const SymInt& sci) const {
+  if (auto ma = maybe_as_int()) {
+    if (auto mb = sci.maybe_as_int()) {
+      return SymInt(*ma * *mb);
+    }
+    if (*ma == 1) {
+      return sci;
+    }
+    if (*ma == 0) {
+      return SymInt(0);
+    }
+    auto b = sci.toSymNode();
+    return SymInt(b->wrap_int(*ma)->mul(b));
+  }
+  if (auto mb = sci.maybe_as_int()) {
+    if (*mb == 1) {
+      return *this;
+    }
+    if (*mb == 0) {
+      return SymInt(0);
+    }
+    auto a = toSymNodeImplUnowned();
+    return SymInt(a->mul(a->wrap_int(*mb)));
+  }
+  return SymInt(toSymNodeImplUnowned()->mul(sci.toSymNode()));
+}
+
+SymInt SymInt::operator/(const SymInt& sci) const {
+  if (auto ma = maybe_as_int()) {
+    if (auto mb = sci.maybe_as_int()) {
+      return SymInt(*ma / *mb);
+    }
+    auto b = sci.toSymNode();
+    return SymInt(b->wrap_int(*ma)->floordiv(b));
+  }
+  if (auto mb = sci.maybe_as_int()) {
+    if (*mb == 1) {
+      return *this;
+    }
+    auto a = toSymNodeImplUnowned();
+    return SymInt(a->floordiv(a->wrap_int(*mb)));
+  }
+  return SymInt(toSymNodeImplUnowned()->floordiv(sci.toSymNode()));
+}
+
+SymInt SymInt::operator%(const SymInt& sci) const {
+  if (auto ma = maybe_as_int()) {
+    if (auto mb = sci.maybe_as_int()) {
+      return SymInt(*ma % *mb);
+    }
+    auto b = sci.toSymNode();
+    return SymInt(b->wrap_int(*ma)->mod(b));
+  }
+  if (auto mb = sci.maybe_as_int()) {
+    if (*mb == 1) {
+      return SymInt(0);
+    }
+    auto a = toSymNodeImplUnowned();
+    return SymInt(a->mod(a->wrap_int(*mb)));
+  }
+  return SymInt(toSymNodeImplUnowned()->mod(sci.toSymNode()));
+}
+
 // clang-format off
-DEFINE_BINARY(operator+, std::plus<>(), add, SymInt)
-DEFINE_BINARY(operator-, std::minus<>(), sub, SymInt)
-DEFINE_BINARY(operator*, std::multiplies<>(), mul, SymInt)
-DEFINE_BINARY(operator/, std::divides<>(), floordiv, SymInt)
-DEFINE_BINARY(operator%, std::modulus<>(), mod, SymInt)
 DEFINE_BINARY(sym_eq, std::equal_to<>(), eq, SymBool)
 DEFINE_BINARY(sym_ne, std::not_equal_to<>(), ne, SymBool)
 DEFINE_BINARY(sym_lt, std::less<>(), lt, SymBool)
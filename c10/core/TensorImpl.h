@@ -1817,6 +1817,15 @@ struct C10_API TensorImpl : public c10::intrusive_ptr_target {
     TORCH_CHECK(
         !matches_policy(SizesStridesPolicy::CustomStrides),
         "tried to directly modify sizes for customized tensor");
+    // A tensor that is already contiguous at its current sizes already
+    // carries exactly the strides, numel and contiguity flags this call
+    // would recompute, so setting the same sizes again is a no-op. Serving
+    // loops that resize output tensors to the same dozen shapes forever hit
+    // this path on every iteration.
+    if (!has_symbolic_sizes_strides_ && is_contiguous_ &&
+        new_size.equals(sizes_and_strides_.sizes_arrayref())) {
+      return;
+    }
     sizes_and_strides_.set_sizes(new_size);
 
     refresh_numel();
@@ -1849,6 +1858,21 @@ struct C10_API TensorImpl : public c10::intrusive_ptr_target {
         ") must match dimensionality of strides (",
         new_stride.size(),
         ")");
+    // Restriding to the current sizes and strides is a no-op; skip the
+    // stride normalization and the contiguity/numel refresh entirely. This
+    // happens a lot in fixed-shape loops that resize to the same geometry
+    // every iteration. Negative strides are excluded because the slow path
+    // below replaces them with computed values.
+    if (new_size.equals(sizes_and_strides_.sizes_arrayref()) &&
+        new_stride.equals(sizes_and_strides_.strides_arrayref()) &&
+        std::all_of(new_stride.begin(), new_stride.end(), [](int64_t s) {
+          return s >= 0;
+        })) {
+      if (storage_offset.has_value()) {
+        storage_offset_ = *storage_offset;
+      }
+      return;
+    }
     const auto new_dim = new_size.size();
     bool overflowed = false;
     sizes_and_strides_.set_sizes(new_size);
@@ -16,6 +16,7 @@ CUDAAllocatorConfig::CUDAAllocatorConfig()
       m_pinned_num_register_threads(1),
       m_expandable_segments(false),
       m_release_lock_on_cudamalloc(false),
+      m_skip_events_if_stream_idle(false),
       m_pinned_use_cuda_host_register(false),
       m_last_allocator_settings("") {
   m_roundup_power2_divisions.assign(kRoundUpPowerOfTwoIntervals, 0);
@@ -294,6 +295,17 @@ void CUDAAllocatorConfig::parseArgs(const char* env) {
           "Expected a single True/False argument for release_lock_on_cudamalloc");
       config_item_view = config[i];
       m_release_lock_on_cudamalloc = (config_item_view == "True");
+    } else if (config_item_view == "skip_events_if_stream_idle") {
+      used_native_specific_option = true;
+      consumeToken(config, ++i, ':');
+      ++i;
+      TORCH_CHECK(
+          i < config.size() &&
+              (std::string_view(config[i]) == "True" ||
+               std::string_view(config[i]) == "False"),
+          "Expected a single True/False argument for skip_events_if_stream_idle");
+      config_item_view = config[i];
+      m_skip_events_if_stream_idle = (config_item_view == "True");
     } else if (
         // ROCm build's hipify step will change "cuda" to "hip", but for ease of
         // use, accept both. We must break up the string to prevent hipify here.
@@ -37,6 +37,10 @@ class C10_CUDA_API CUDAAllocatorConfig {
     return instance().m_release_lock_on_cudamalloc;
   }
 
+  static bool skip_events_if_stream_idle() {
+    return instance().m_skip_events_if_stream_idle;
+  }
+
   /** Pinned memory allocator settings */
   static bool pinned_use_cuda_host_register() {
     return instance().m_pinned_use_cuda_host_register;
@@ -113,6 +117,7 @@ class C10_CUDA_API CUDAAllocatorConfig {
   std::atomic<size_t> m_pinned_num_register_threads;
   std::atomic<bool> m_expandable_segments;
   std::atomic<bool> m_release_lock_on_cudamalloc;
+  std::atomic<bool> m_skip_events_if_stream_idle;
   std::atomic<bool> m_pinned_use_cuda_host_register;
   std::string m_last_allocator_settings;
   std::mutex m_last_allocator_settings_mutex;
@@ -214,6 +214,13 @@ struct Block {
                      // expandable_segment_ is null. When false
                      // This Block will be aligned to the segment size
                      // of its expandable_segment_.
+  bool segment_registered{false}; // the owning segment was published to an
+                                  // attached allocator trace tracker, which
+                                  // may have registered it externally (e.g.
+                                  // as an NCCL user buffer); releasing it
+                                  // forces a deregistration in the tracker.
+                                  // Copied to every block split from the
+                                  // segment.
   Block* prev{nullptr}; // prev block if split from a larger allocation
   Block* next{nullptr}; // next block if split from a larger allocation
   int event_count{0}; // number of outstanding CUDA events
@@ -890,6 +897,10 @@ class DeviceCachingAllocator {
   // record used memory.
   size_t total_allocated_memory = 0;
 
+  // bytes in segments that were published to attached trace trackers at
+  // allocation time (see Block::segment_registered)
+  size_t total_registered_memory = 0;
+
   size_t allowed_memory_maximum = 0;
 
   // all live expandable segments
@@ -930,6 +941,18 @@ class DeviceCachingAllocator {
   // was used while cudagraph capturing
   std::unordered_map<Block*, stream_set> block_to_cudagraph_stream_uses;
 
+  // Members specific to shape-profile replay
+  // (see Note [Shape-profile replay])
+
+  // When true, malloc appends the rounded size of every large-pool
+  // allocation to shape_profile_trace_.
+  bool shape_profile_recording_ = false;
+  // Rounded sizes recorded during one warm iteration, in allocation order.
+  std::vector<size_t> shape_profile_trace_;
+  // Segment sizes that were pre-carved for replay; blocks of these sizes are
+  // never split so the recorded shapes keep hitting them exact-fit.
+  ska::flat_hash_set<size_t> shape_profile_sizes_;
+
  public:
   // NOLINTNEXTLINE(cppcoreguidelines-pro-type-member-init)
   DeviceCachingAllocator()
@@ -995,6 +1018,55 @@ class DeviceCachingAllocator {
     return allocated_pool_blocks == expected_live_allocations.size();
   }
 
+  // Note [Shape-profile replay]
+  // ~~~~~~~~~~~~~~~~~~~~~~~~~~~
+  // Fixed-shape serving workloads request the same sequence of block sizes
+  // every iteration, but best-fit reuse still splits large segments and the
+  // resulting fragmentation can accumulate into cudaMalloc retries over long
+  // uptimes. beginShapeProfile() records the rounded size of every large-pool
+  // allocation; endShapeProfileAndPrecarve() then reserves one segment per
+  // recorded allocation, sized exactly, and pins those sizes so the blocks
+  // are never split. Steady state becomes pure exact-fit reuse of the
+  // pre-carved segments: O(1) lower_bound hits, no splitting, and no
+  // fragmentation growth. Callers should record a warm iteration and, for a
+  // minimal footprint, emptyCache() before pre-carving.
+  void beginShapeProfile() {
+    std::unique_lock<std::recursive_mutex> lock(mutex);
+    shape_profile_trace_.clear();
+    shape_profile_sizes_.clear();
+    shape_profile_recording_ = true;
+  }
+
+  void endShapeProfileAndPrecarve(
+      c10::DeviceIndex device,
+      cudaStream_t stream) {
+    auto context = maybeGatherContext(RecordContext::STATE);
+    std::unique_lock<std::recursive_mutex> lock(mutex);
+    shape_profile_recording_ = false;
+    for (auto size : shape_profile_trace_) {
+      shape_profile_sizes_.insert(size);
+    }
+    // One exactly-sized segment per recorded allocation; duplicate sizes in
+    // the trace were live simultaneously and each get their own segment.
+    for (auto size : shape_profile_trace_) {
+      BlockPool& pool = get_pool(size, stream);
+      AllocParams params(
+          device, size, stream, &pool, /*alloc_size=*/size, stats);
+      params.stat_types = get_stat_types_for_pool(pool);
+      if (!alloc_block(params, false, context, lock)) {
+        TORCH_WARN(
+            "shape-profile pre-carve stopped early: could not reserve ",
+            format_size(size),
+            " on device ",
+            device);
+        break;
+      }
+      pool.insert_into_blocks(params.block);
+    }
+    shape_profile_trace_.clear();
+    shape_profile_trace_.shrink_to_fit();
+  }
+
   void attachOutOfMemoryObserver(OutOfMemoryObserver observer) {
     oom_observers_.emplace_back(std::move(observer));
   }
@@ -1039,6 +1111,11 @@ class DeviceCachingAllocator {
       process_events(context);
     }
     size_t size = round_size(orig_size);
+    if (C10_UNLIKELY(shape_profile_recording_) && size > kSmallSize) {
+      // Small-pool allocations already share kSmallBuffer segments and are
+      // not a fragmentation concern; only large-pool sizes are replayed.
+      shape_profile_trace_.push_back(size);
+    }
     auto& pool = get_pool(size, stream);
     const size_t alloc_size = get_allocation_size(size);
     AllocParams params(device, size, stream, &pool, alloc_size, stats);
@@ -1067,9 +1144,18 @@ class DeviceCachingAllocator {
       block_found = alloc_block(params, false, context, lock)
           // Free enough available cached blocks to satisfy alloc and retry
           // alloc.
-          || (release_available_cached_blocks(params, context) &&
+          || (release_available_cached_blocks(
+                  params, context, /*keep_registered=*/true) &&
               alloc_block(params, false, context, lock))
-          // Free all non-split cached blocks and retry alloc.
+          // Free all non-split cached blocks that are not registered with an
+          // attached trace tracker and retry alloc.
+          || (C10_LIKELY(captures_underway.empty()) &&
+              release_cached_blocks(context, /*keep_registered=*/true) &&
+              alloc_block(params, false, context, lock))
+          // Last resort: also release tracker-registered segments (e.g. NCCL
+          // user buffers). Each release forces a deregistration in the
+          // tracker, so this tier is reached only when evicting everything
+          // else was not enough.
           || (C10_LIKELY(captures_underway.empty()) &&
               release_cached_blocks(context) &&
               alloc_block(params, true, context, lock));
@@ -1136,6 +1222,14 @@ class DeviceCachingAllocator {
             " allocated in private pools (e.g., CUDA Graphs), ";
       }
 
+      std::string registered_msg;
+
+      if (total_registered_memory > 0) {
+        registered_msg = " " + format_size(total_registered_memory) +
+            " of the reserved memory is in segments registered with attached"
+            " allocator trace trackers (e.g., NCCL user buffers).";
+      }
+
       // Make sure we do not have the device lock before calling our
       // observers which might need hold the GIL
       // It is safe to release at this point because will no longer
@@ -1189,6 +1283,7 @@ class DeviceCachingAllocator {
           format_size(
               reserved_bytes - allocated_bytes - allocated_in_private_pools),
           " is reserved by PyTorch but unallocated.",
+          registered_msg,
           " If reserved but unallocated memory is large try setting",
           " PYTORCH_CUDA_ALLOC_CONF=expandable_segments:True to avoid"
           " fragmentation.  See documentation for Memory Management "
@@ -1222,6 +1317,7 @@ class DeviceCachingAllocator {
 
       block = new Block(device, stream, size, pool, block->ptr);
       block->expandable_segment_ = remaining->expandable_segment_;
+      block->segment_registered = remaining->segment_registered;
       block->prev = remaining->prev;
       if (block->prev) {
         block->prev->next = block;
@@ -1330,6 +1426,12 @@ class DeviceCachingAllocator {
         needs_events_deferred_until_no_capture.push_back(block);
       } else {
         insert_events(block);
+        // With skip_events_if_stream_idle every using stream may have been
+        // idle, in which case no events were recorded and the block is
+        // immediately reusable.
+        if (block->event_count == 0) {
+          free_block(block, context);
+        }
       }
     } else {
       free_block(block, context);
@@ -1393,6 +1495,19 @@ class DeviceCachingAllocator {
     release_cached_blocks(context);
   }
 
+  /** reclaims the slack inside expandable segments **/
+  size_t compactExpandableSegments() {
+    auto context = maybeGatherContext(RecordContext::ALL);
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+    // Return blocks only held back by outstanding stream events first, so
+    // their pages are visible to the sweep below.
+    synchronize_and_free_events(context);
+    const size_t before = total_allocated_memory;
+    compact_expandable_pool(large_blocks, context);
+    compact_expandable_pool(small_blocks, context);
+    return before - total_allocated_memory;
+  }
+
   /** Retrieves size of largest unused block held by the memory cache **/
   void cacheInfo(size_t* largest) {
     std::lock_guard<std::recursive_mutex> lock(mutex);
@@ -2205,6 +2320,7 @@ class DeviceCachingAllocator {
     }
     const size_t subsumed_size = src->size;
     dst->size += subsumed_size;
+    dst->segment_registered = dst->segment_registered || src->segment_registered;
     // NOLINTNEXTLINE(clang-analyzer-deadcode.DeadStores)
     auto erased =
         src->mapped ? pool.blocks.erase(src) : pool.unmapped.erase(src);
@@ -2248,6 +2364,12 @@ class DeviceCachingAllocator {
   }
 
   bool should_split(const Block* block, size_t size) {
+    if (C10_UNLIKELY(!shape_profile_sizes_.empty()) &&
+        shape_profile_sizes_.count(block->size)) {
+      // Pre-carved replay segments are kept whole so the recorded shapes
+      // keep hitting them exact-fit. See Note [Shape-profile replay].
+      return false;
+    }
     size_t remaining = block->size - size;
     if (block->pool->is_small || CUDAAllocatorConfig::expandable_segments()) {
       return remaining >= kMinBlockSize;
@@ -2356,7 +2478,10 @@ class DeviceCachingAllocator {
     size_t total_age = 0.0;
     int freeable_block_count = 0;
     for (auto& b : large_blocks.blocks) {
-      if (!b->is_split()) {
+      // Tracker-registered segments are not GC candidates; releasing them
+      // opportunistically would trigger deregistrations (e.g. with NCCL)
+      // that OOM-driven eviction deliberately saves for last.
+      if (!b->is_split() && !b->segment_registered) {
         total_age += b->gc_count();
         ++freeable_block_count;
       }
@@ -2382,7 +2507,7 @@ class DeviceCachingAllocator {
       while (it != large_blocks.blocks.end()) {
         Block* block = *it;
         ++it;
-        if (!block->is_split() &&
+        if (!block->is_split() && !block->segment_registered &&
             static_cast<double>(block->gc_count()) >= age_threshold) {
           block_freed = true;
           gc_reclaimed += block->size;
@@ -2490,6 +2615,14 @@ class DeviceCachingAllocator {
         p.stream(),
         p.device(),
         ctx);
+    // A tracker observing SEGMENT_ALLOC may register the segment externally
+    // (e.g. as an NCCL user buffer). Remember that so eviction under memory
+    // pressure can prefer unregistered segments and avoid deregistration
+    // storms.
+    p.block->segment_registered = !trace_trackers_.empty();
+    if (p.block->segment_registered) {
+      total_registered_memory += size;
+    }
     p.block->context_when_segment_allocated = ctx;
     return true;
   }
@@ -2497,9 +2630,12 @@ class DeviceCachingAllocator {
   /** Free one or more oversize blocks to the system allocator.  But only enough
    * **/
   /** to satisfy the target size **/
+  /** keep_registered leaves tracker-registered segments cached so that they
+   * are only evicted as a last resort **/
   bool release_available_cached_blocks(
       const AllocParams& p,
-      const std::shared_ptr<GatheredContext>& context) {
+      const std::shared_ptr<GatheredContext>& context,
+      bool keep_registered = false) {
     if (CUDAAllocatorConfig::max_split_size() ==
         std::numeric_limits<size_t>::max())
       return false;
@@ -2524,38 +2660,45 @@ class DeviceCachingAllocator {
              ((*it)->size >= CUDAAllocatorConfig::max_split_size()) &&
              ((*it)->stream == p.stream())) {
         auto cur = it;
-        totalReleased += (*it)->size;
-        if (it != pool.blocks.begin()) {
+        const bool at_begin = it == pool.blocks.begin();
+        if (!at_begin) {
           --it;
+        }
+        if (!(keep_registered && (*cur)->segment_registered)) {
+          totalReleased += (*cur)->size;
           release_block(*cur, context);
-        } else {
-          release_block(*cur, context);
+        }
+        if (at_begin) {
           break;
         }
       }
       if (totalReleased < key.size)
         return false;
+    } else if (keep_registered && (*it)->segment_registered) {
+      return false;
     } else {
       release_block(*it, context);
     }
     return true;
   }
 
-  bool release_cached_blocks(const std::shared_ptr<GatheredContext>& context) {
+  bool release_cached_blocks(
+      const std::shared_ptr<GatheredContext>& context,
+      bool keep_registered = false) {
     // First ensure that all blocks that can't currently be allocated due to
     // outstanding events are returned to the pool.
     synchronize_and_free_events(context);
 
     // Free all non-split cached blocks to system allocator
-    release_blocks(large_blocks, context);
-    release_blocks(small_blocks, context);
+    release_blocks(large_blocks, context, keep_registered);
+    release_blocks(small_blocks, context, keep_registered);
 
     for (auto it = graph_pools_freeable.begin();
          it != graph_pools_freeable.end();) {
       // See notifyCaptureDestroy for the strategy here.
       TORCH_INTERNAL_ASSERT(it->second->use_count == 0);
-      release_blocks(it->second->small_blocks, context);
-      release_blocks(it->second->large_blocks, context);
+      release_blocks(it->second->small_blocks, context, keep_registered);
+      release_blocks(it->second->large_blocks, context, keep_registered);
       if (it->second->cudaMalloc_count == 0) {
         auto erase_count = graph_pools.erase(it->first);
         TORCH_INTERNAL_ASSERT(erase_count == 1);
@@ -2599,6 +2742,9 @@ class DeviceCachingAllocator {
 
     C10_CUDA_CHECK(cudaFree((void*)block->ptr));
     total_allocated_memory -= block->size;
+    if (block->segment_registered) {
+      total_registered_memory -= block->size;
+    }
 
     auto* pool = block->pool;
     if (pool->owner_PrivatePool) {
@@ -2678,15 +2824,48 @@ class DeviceCachingAllocator {
         block->device,
         context ? context : block->context_when_segment_allocated);
   }
-  void release_blocks(
+  // Unmaps the physical pages backing every free block of the pool that
+  // lives inside an expandable segment, without releasing the segment's
+  // virtual address range (so live blocks keep their pointers and the
+  // reclaimed pages can be remapped at the tail of the same segment) and
+  // without touching non-expandable cached segments. Physical pages under
+  // live blocks cannot be moved -- outstanding tensors hold raw pointers
+  // into the segment -- so the reclaim is bounded by the hole bytes, not by
+  // ideal packing. unmap_block() synchronizes the owning stream before the
+  // pages are returned to the driver.
+  void compact_expandable_pool(
       BlockPool& pool,
       const std::shared_ptr<GatheredContext>& context) {
+    // unmapping mutates the free pool, so gather candidates first. Two
+    // mapped free blocks are never adjacent (they would have merged when
+    // freed), so unmapping one cannot merge away another candidate.
+    std::vector<Block*> to_unmap;
+    for (Block* block : pool.blocks) {
+      if (block->expandable_segment_ && block->mapped) {
+        to_unmap.push_back(block);
+      }
+    }
+    for (Block* block : to_unmap) {
+      unmap_block(block, context);
+    }
+  }
+
+  void release_blocks(
+      BlockPool& pool,
+      const std::shared_ptr<GatheredContext>& context,
+      bool keep_registered = false) {
     std::vector<Block*> to_unmap;
     // Frees all non-split blocks
     auto it = pool.blocks.begin();
     while (it != pool.blocks.end()) {
       Block* block = *it;
       ++it;
+      if (keep_registered && block->segment_registered) {
+        // Tracker-registered segments (e.g. NCCL user buffers) are only
+        // released as a last resort, since every release triggers a
+        // deregistration in the attached tracker.
+        continue;
+      }
       if (block->expandable_segment_) {
         // unmapping will mutate the free pool
         // so just gather what needs to be freed
@@ -2764,6 +2943,21 @@ class DeviceCachingAllocator {
     for (auto& stream : streams) {
       C10_CUDA_CHECK(c10::cuda::SetDevice(stream.device_index()));
 
+      if (CUDAAllocatorConfig::skip_events_if_stream_idle()) {
+        // If the using stream has already drained all submitted work, the
+        // block's pending uses are provably complete and no end-of-life
+        // event is needed: the block goes straight back to its allocating
+        // stream's pool. Multi-stream inference whose side streams go idle
+        // between requests skips almost all event churn this way.
+        cudaError_t err = C10_CUDA_ERROR_HANDLED(cudaStreamQuery(stream.stream()));
+        if (err == cudaSuccess) {
+          continue;
+        }
+        // Not idle (or query unsupported right now); clear the error and
+        // fall through to the usual event-based path.
+        (void)cudaGetLastError();
+      }
+
       EventPool::Event event = create_event_internal(stream.device_index());
       C10_CUDA_CHECK(cudaEventRecord(*event, stream.stream()));
 
@@ -3241,6 +3435,24 @@ class NativeCachingAllocator : public CUDAAllocator {
     assertValidDevice(device);
     device_allocator[device]->resetPeakStats();
   }
+
+  size_t compactExpandableSegments(c10::DeviceIndex device) override {
+    assertValidDevice(device);
+    return device_allocator[device]->compactExpandableSegments();
+  }
+
+  // Shape-profile replay (see Note [Shape-profile replay])
+  void beginShapeProfile(c10::DeviceIndex device) override {
+    assertValidDevice(device);
+    device_allocator[device]->beginShapeProfile();
+  }
+
+  void endShapeProfileAndPrecarve(c10::DeviceIndex device) override {
+    assertValidDevice(device);
+    device_allocator[device]->endShapeProfileAndPrecarve(
+        device, cuda::getCurrentCUDAStream(device));
+  }
+
   // CUDAGraph interactions
   void beginAllocateToPool(
       c10::DeviceIndex device,
@@ -277,6 +277,32 @@ class CUDAAllocator : public Allocator {
         " does not yet support checkPoolLiveAllocations. "
         "If you need it, please file an issue describing your use case.");
   }
+  // Shape-profile replay for fixed-shape serving: record the block sizes of
+  // one warm iteration, then pre-carve exactly-sized, never-split segments so
+  // steady state reuses them exact-fit with no fragmentation. See
+  // Note [Shape-profile replay] in CUDACachingAllocator.cpp.
+  virtual void beginShapeProfile(c10::DeviceIndex device) {
+    TORCH_CHECK(
+        false,
+        name(),
+        " does not yet support shape-profile replay. "
+        "If you need it, please file an issue describing your use case.");
+  }
+  virtual void endShapeProfileAndPrecarve(c10::DeviceIndex device) {
+    TORCH_CHECK(
+        false,
+        name(),
+        " does not yet support shape-profile replay. "
+        "If you need it, please file an issue describing your use case.");
+  }
+  // Unmaps the physical pages backing free blocks inside expandable
+  // segments ("holes"), returning them to the driver so they can be
+  // remapped at the tail of a segment or by another pool. Returns the
+  // number of bytes reclaimed. No-op for allocators without expandable
+  // segments.
+  virtual size_t compactExpandableSegments(c10::DeviceIndex device) {
+    return 0;
+  }
   virtual std::shared_ptr<void> getIpcDevPtr(std::string handle) = 0;
   virtual bool isHistoryEnabled() {
     TORCH_CHECK(
@@ -369,6 +395,10 @@ inline void emptyCache() {
   return get()->emptyCache();
 }
 
+inline size_t compactExpandableSegments(c10::DeviceIndex device) {
+  return get()->compactExpandableSegments(device);
+}
+
 inline void cacheInfo(c10::DeviceIndex device, size_t* largestBlock) {
   return get()->cacheInfo(device, largestBlock);
 }
@@ -421,6 +451,15 @@ inline void endAllocateToPool(c10::DeviceIndex device, MempoolId_t mempool_id) {
   get()->endAllocateToPool(device, mempool_id);
 }
 
+// Shape-profile replay
+inline void beginShapeProfile(c10::DeviceIndex device) {
+  get()->beginShapeProfile(device);
+}
+
+inline void endShapeProfileAndPrecarve(c10::DeviceIndex device) {
+  get()->endShapeProfileAndPrecarve(device);
+}
+
 inline void recordHistory(
     bool enabled,
     CreateContextFn context_recorder,
@@ -194,7 +194,8 @@ CUDAKernelLaunchRegistry::CUDAKernelLaunchRegistry()
     : do_all_devices_support_managed_memory(
           dsa_check_if_all_devices_support_managed_memory()),
       gather_launch_stacktrace(check_env_for_enable_launch_stacktracing()),
-      enabled_at_runtime(check_env_for_dsa_enabled()) {
+      enabled_at_runtime(check_env_for_dsa_enabled()),
+      lazy_failure_checks(check_env_for_lazy_failure_checks()) {
   for (C10_UNUSED const auto _ : c10::irange(dsa_get_device_count())) {
     uvm_assertions.emplace_back(nullptr, uvm_deleter);
   }
@@ -211,6 +212,10 @@ bool CUDAKernelLaunchRegistry::check_env_for_dsa_enabled() const {
   return env_flag_set("PYTORCH_USE_CUDA_DSA");
 }
 
+bool CUDAKernelLaunchRegistry::check_env_for_lazy_failure_checks() const {
+  return env_flag_set("PYTORCH_CUDA_DSA_LAZY_CHECK");
+}
+
 uint32_t CUDAKernelLaunchRegistry::insert(
     const char* launch_filename,
     const char* launch_function,
@@ -222,6 +227,28 @@ uint32_t CUDAKernelLaunchRegistry::insert(
     return 0;
   }
 
+  if (lazy_failure_checks) {
+    // Lock-free fast path for production use. We deliberately skip gathering
+    // a launch stacktrace (it would require writing the slot's std::string,
+    // which cannot be done race-free without the mutex) and write only the
+    // POD fields of the slot. If the ring wraps while another thread is
+    // writing the same slot the entry may be torn, but the
+    // `generation_number == caller` consistency check in the failure
+    // reporter discards such stale entries, and this path only matters
+    // post-mortem anyway.
+    const auto my_gen_number =
+        generation_number.fetch_add(1, std::memory_order_relaxed);
+    auto& slot = kernel_launches[my_gen_number % max_kernel_launches];
+    slot.launch_filename = launch_filename;
+    slot.launch_function = launch_function;
+    slot.launch_linenum = launch_linenum;
+    slot.kernel_name = kernel_name;
+    slot.device = dsa_get_device_id();
+    slot.stream = stream_id;
+    slot.generation_number = my_gen_number;
+    return my_gen_number;
+  }
+
   const auto backtrace = gather_launch_stacktrace ? c10::get_backtrace() : "";
 
   const std::lock_guard<std::mutex> lock(read_write_mutex);
@@ -333,12 +360,25 @@ CUDAKernelLaunchRegistry& CUDAKernelLaunchRegistry::get_singleton_ref() {
 }
 
 bool CUDAKernelLaunchRegistry::has_failed() const {
+  if (lazy_failure_checks) {
+    // The managed-memory scan happens only in `poll_for_failures`, which
+    // synchronization boundaries invoke; every other CUDA API check just
+    // reads the cached flag.
+    return failure_observed.load(std::memory_order_relaxed);
+  }
+  return poll_for_failures();
+}
+
+bool CUDAKernelLaunchRegistry::poll_for_failures() const {
   for (const auto& x : uvm_assertions) {
     if (x && x->assertion_count > 0) {
+      failure_observed.store(true, std::memory_order_relaxed);
       return true;
     }
   }
-  return false;
+  // Assertion counts only ever increase, so once a failure has been observed
+  // the cached flag stays sticky.
+  return failure_observed.load(std::memory_order_relaxed);
 }
 
 } // namespace c10::cuda
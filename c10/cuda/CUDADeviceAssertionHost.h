@@ -2,6 +2,7 @@
 
 #include <c10/cuda/CUDAMacros.h>
 
+#include <atomic>
 #include <cstdint>
 #include <memory>
 #include <mutex>
@@ -90,7 +91,9 @@ class C10_CUDA_API CUDAKernelLaunchRegistry {
   /// queue doesn't provide false information by always increasing, but also to
   /// mark where we are inserting into the queue
 #ifdef TORCH_USE_CUDA_DSA
-  uint64_t generation_number = 0;
+  /// Atomic so that, when lazy failure checks are enabled, launches can be
+  /// registered without taking `read_write_mutex`
+  std::atomic<uint64_t> generation_number{0};
 #endif
   /// Shared mutex between writer and accessor to ensure multi-threaded safety.
   mutable std::mutex read_write_mutex;
@@ -107,8 +110,13 @@ class C10_CUDA_API CUDAKernelLaunchRegistry {
   /// A single circular buffer holds information about every kernel launch the
   /// process makes across all devices.
   std::vector<CUDAKernelLaunchInfo> kernel_launches;
+  /// Caches whether a device-side assertion failure has ever been observed so
+  /// that, when lazy failure checks are enabled, `has_failed` does not need to
+  /// re-read the managed-memory assertion counts on every CUDA API check
+  mutable std::atomic<bool> failure_observed{false};
   bool check_env_for_enable_launch_stacktracing() const;
   bool check_env_for_dsa_enabled() const;
+  bool check_env_for_lazy_failure_checks() const;
 
  public:
   CUDAKernelLaunchRegistry();
@@ -139,8 +147,22 @@ class C10_CUDA_API CUDAKernelLaunchRegistry {
   /// Whether or not host-side DSA is enabled or disabled at run-time
   /// Note: Device-side code cannot be enabled/disabled at run-time
   bool enabled_at_runtime = false;
+  /// Whether failure checks are deferred to stream/event synchronization
+  /// boundaries. In this mode kernel launches are registered without taking a
+  /// lock and `has_failed` reads a cached flag instead of scanning the
+  /// managed-memory assertion counts; the scan happens in `poll_for_failures`,
+  /// which synchronization points invoke via `C10_CUDA_DSA_SYNC_CHECK`. This
+  /// keeps the steady-state cost of DSA low enough to leave it enabled in
+  /// production at the price of failures surfacing at the next sync boundary
+  /// rather than at the next CUDA API check. Enabled via the env var
+  /// `PYTORCH_CUDA_DSA_LAZY_CHECK`
+  bool lazy_failure_checks = false;
   /// Whether or not a device has indicated a failure
   bool has_failed() const;
+  /// Scans each device's assertion count for new failures and updates the
+  /// cached failure flag. Called at synchronization boundaries when lazy
+  /// failure checks are enabled; equivalent to `has_failed` otherwise
+  bool poll_for_failures() const;
 #ifdef TORCH_USE_CUDA_DSA
   const bool enabled_at_compile_time = true;
 #else
@@ -71,6 +71,27 @@ class C10_CUDA_API CUDAError : public c10::Error {
 // diagnostic if it didn't.
 #define C10_CUDA_KERNEL_LAUNCH_CHECK() C10_CUDA_CHECK(cudaGetLastError())
 
+/// Polls for device-side assertion failures recorded since the last check.
+/// Used at stream/event synchronization boundaries when lazy DSA failure
+/// checks are enabled (`PYTORCH_CUDA_DSA_LAZY_CHECK`); effectively free
+/// otherwise. This is a macro so the raised error carries the sync site's
+/// __FILE__/__LINE__, per Note [CHECK macro].
+#define C10_CUDA_DSA_SYNC_CHECK()                                 \
+  do {                                                            \
+    const auto& dsa_registry =                                    \
+        c10::cuda::CUDAKernelLaunchRegistry::get_singleton_ref(); \
+    if (C10_UNLIKELY(                                             \
+            dsa_registry.lazy_failure_checks &&                   \
+            dsa_registry.poll_for_failures())) {                  \
+      c10::cuda::c10_cuda_check_implementation(                   \
+          static_cast<int32_t>(cudaSuccess),                      \
+          __FILE__,                                               \
+          __func__,                                               \
+          static_cast<uint32_t>(__LINE__),                        \
+          true);                                                  \
+    }                                                             \
+  } while (0)
+
 /// Launches a CUDA kernel appending to it all the information need to handle
 /// device-side assertion failures. Checks that the launch was successful.
 #define TORCH_DSA_KERNEL_LAUNCH(                                      \
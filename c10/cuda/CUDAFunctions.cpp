@@ -139,6 +139,7 @@ void device_synchronize() {
     (*interp)->trace_gpu_device_synchronization(c10::kCUDA);
   }
   C10_CUDA_CHECK(cudaDeviceSynchronize());
+  C10_CUDA_DSA_SYNC_CHECK();
 }
 
 // this function has to be called from callers performing cuda synchronizing
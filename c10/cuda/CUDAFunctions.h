@@ -108,6 +108,7 @@ C10_CUDA_API void __inline__ stream_synchronize(cudaStream_t stream) {
         c10::kCUDA, reinterpret_cast<uintptr_t>(stream));
   }
   C10_CUDA_CHECK(cudaStreamSynchronize(stream));
+  C10_CUDA_DSA_SYNC_CHECK();
 }
 
 C10_CUDA_API bool hasPrimaryContext(DeviceIndex device_index);
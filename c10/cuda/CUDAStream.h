@@ -117,6 +117,9 @@ class C10_CUDA_API CUDAStream {
     cudaError_t err = C10_CUDA_ERROR_HANDLED(cudaStreamQuery(stream()));
 
     if (err == cudaSuccess) {
+      // The stream has drained, which is a synchronization boundary for any
+      // lazily-checked device-side assertion failures
+      C10_CUDA_DSA_SYNC_CHECK();
       return true;
     } else if (err != cudaErrorNotReady) {
       C10_CUDA_CHECK(err);
@@ -3,6 +3,7 @@ dsa_tests = [
     "impl/CUDAAssertionsTest_catches_stream.cu",
     "impl/CUDAAssertionsTest_catches_thread_and_block_and_device.cu",
     "impl/CUDAAssertionsTest_from_2_processes.cu",
+    "impl/CUDAAssertionsTest_lazy_check.cu",
     "impl/CUDAAssertionsTest_multiple_writes_from_blocks_and_threads.cu",
     "impl/CUDAAssertionsTest_multiple_writes_from_multiple_blocks.cu",
     "impl/CUDAAssertionsTest_multiple_writes_from_same_block.cu",
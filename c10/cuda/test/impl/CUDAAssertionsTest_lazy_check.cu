@@ -0,0 +1,75 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <c10/cuda/CUDADeviceAssertion.h>
+#include <c10/cuda/CUDAException.h>
+#include <c10/cuda/CUDAFunctions.h>
+#include <c10/cuda/CUDAStream.h>
+
+#include <string>
+
+using ::testing::HasSubstr;
+
+/**
+ * Device kernel that takes a single integer parameter as argument and
+ * will always trigger a device side assertion.
+ */
+__global__ void cuda_always_fail_assertion_kernel(
+    const int a,
+    TORCH_DSA_KERNEL_ARGS) {
+  CUDA_KERNEL_ASSERT2(a != a);
+}
+
+/**
+ * TEST: With lazy failure checks enabled, a device-side assertion is not
+ * surfaced by arbitrary CUDA API checks but is caught at the next
+ * synchronization boundary, with full kernel attribution from the lock-free
+ * launch registry. Also checks that the cached failure flag is sticky.
+ */
+void cuda_device_assertions_lazy_check_test() {
+  auto& launch_registry = c10::cuda::CUDAKernelLaunchRegistry::get_singleton_ref();
+  ASSERT_TRUE(launch_registry.lazy_failure_checks);
+
+  const auto stream = c10::cuda::getStreamFromPool();
+  TORCH_DSA_KERNEL_LAUNCH(
+      cuda_always_fail_assertion_kernel,
+      1, /* Blocks */
+      1, /* Threads */
+      0, /* Shared mem */
+      stream, /* Stream */
+      1);
+
+  try {
+    c10::cuda::device_synchronize();
+    throw std::runtime_error("Test didn't fail, but should have.");
+  } catch (const c10::Error& err) {
+    const auto err_str = std::string(err.what());
+    ASSERT_THAT(
+        err_str,
+        HasSubstr("CUDA device-side assertion failures were found on GPU #0!"));
+    ASSERT_THAT(
+        err_str,
+        HasSubstr(
+            "Name of kernel launched that led to failure = cuda_always_fail_assertion_kernel"));
+    ASSERT_THAT(
+        err_str, HasSubstr("File containing kernel launch = " __FILE__));
+    ASSERT_THAT(
+        err_str,
+        HasSubstr(
+            "Stream kernel was launched on = " + std::to_string(stream.id())));
+  }
+
+  // Once polled, the failure must remain visible to every subsequent check
+  // without re-scanning the managed-memory buffers
+  ASSERT_TRUE(launch_registry.has_failed());
+}
+
+TEST(CUDATest, cuda_device_assertions_lazy_check_test) {
+#ifdef TORCH_USE_CUDA_DSA
+  c10::cuda::CUDAKernelLaunchRegistry::get_singleton_ref().enabled_at_runtime = true;
+  c10::cuda::CUDAKernelLaunchRegistry::get_singleton_ref().lazy_failure_checks = true;
+  cuda_device_assertions_lazy_check_test();
+#else
+  GTEST_SKIP() << "CUDA device-side assertions (DSA) was not enabled at compile time.";
+#endif
+}
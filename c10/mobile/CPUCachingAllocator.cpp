@@ -1,3 +1,5 @@
+#include <atomic>
+
 #include <c10/core/impl/alloc_cpu.h>
 #include <c10/mobile/CPUCachingAllocator.h>
 #include <c10/util/Exception.h>
@@ -6,6 +8,7 @@ namespace c10 {
 
 namespace {
 thread_local CPUCachingAllocator* caching_allocator_ptr{nullptr};
+std::atomic<bool> caching_allocator_ever_enabled{false};
 } // namespace
 
 std::mutex CPUCachingAllocator::mutex_;
@@ -96,9 +99,16 @@ CPUCachingAllocator* GetThreadLocalCachingAllocator() {
   return caching_allocator_ptr;
 }
 
+bool CPUCachingAllocatorEverEnabled() {
+  return caching_allocator_ever_enabled.load(std::memory_order_relaxed);
+}
+
 WithCPUCachingAllocatorGuard::WithCPUCachingAllocatorGuard(
     CPUCachingAllocator* allocator)
     : prev_caching_allocator_ptr_(GetThreadLocalCachingAllocator()) {
+  if (allocator != nullptr) {
+    caching_allocator_ever_enabled.store(true, std::memory_order_relaxed);
+  }
   caching_allocator_ptr = allocator;
 }
 
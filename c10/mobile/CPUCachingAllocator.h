@@ -10,9 +10,9 @@
 /*
  * CPUCachingAllocator:
  * DISCLAIMER:
- *    This is subject to change (beta) and only supported on mobile builds.
- *    If code snippet such as in 'Usage pattern' is used outside of mobile
- *    build you will not observe the intended behavior.
+ *    This is subject to change (beta). Originally mobile only, the scoped
+ *    guard is now also honored by the default server CPU allocator, where
+ *    it serves as a per-scope recycled output pool for eager hot loops.
  *    See below for more information.
  * Why?
  *    It has been observed that some mobile platforms, such as pixel 3, return
@@ -94,6 +94,11 @@ CPUCachingAllocator* GetDefaultCPUCachingAllocator();
 bool ThreadLocalCachingAllocatorEnabled();
 CPUCachingAllocator* GetThreadLocalCachingAllocator();
 
+// True once any WithCPUCachingAllocatorGuard has been entered in this
+// process. Lets allocators skip the record_free bookkeeping (and its global
+// mutex) on the common path when the caching allocator was never used.
+C10_API bool CPUCachingAllocatorEverEnabled();
+
 class C10_API WithCPUCachingAllocatorGuard {
  public:
   WithCPUCachingAllocatorGuard(CPUCachingAllocator* allocator);
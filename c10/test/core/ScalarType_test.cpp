@@ -0,0 +1,94 @@
+#include <c10/core/ScalarType.h>
+
+#include <c10/util/ArrayRef.h>
+#include <c10/util/Exception.h>
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+using c10::ScalarType;
+
+namespace {
+
+// The types covered by the dense promotion table.
+const std::vector<ScalarType> standard_types = {
+    ScalarType::Byte,
+    ScalarType::Char,
+    ScalarType::Short,
+    ScalarType::Int,
+    ScalarType::Long,
+    ScalarType::Half,
+    ScalarType::Float,
+    ScalarType::Double,
+    ScalarType::ComplexHalf,
+    ScalarType::ComplexFloat,
+    ScalarType::ComplexDouble,
+    ScalarType::Bool,
+    ScalarType::BFloat16,
+};
+
+TEST(ScalarTypeTest, PromoteTypesIsSymmetricAndIdempotent) {
+  for (const auto a : standard_types) {
+    EXPECT_EQ(c10::promoteTypes(a, a), a);
+    for (const auto b : standard_types) {
+      EXPECT_EQ(c10::promoteTypes(a, b), c10::promoteTypes(b, a));
+    }
+  }
+}
+
+TEST(ScalarTypeTest, PromoteTypesSpotChecks) {
+  EXPECT_EQ(
+      c10::promoteTypes(ScalarType::Byte, ScalarType::Char), ScalarType::Short);
+  EXPECT_EQ(
+      c10::promoteTypes(ScalarType::Int, ScalarType::Half), ScalarType::Half);
+  EXPECT_EQ(
+      c10::promoteTypes(ScalarType::BFloat16, ScalarType::Half),
+      ScalarType::Float);
+  EXPECT_EQ(
+      c10::promoteTypes(ScalarType::Bool, ScalarType::Byte), ScalarType::Byte);
+  EXPECT_EQ(
+      c10::promoteTypes(ScalarType::ComplexFloat, ScalarType::Double),
+      ScalarType::ComplexDouble);
+  EXPECT_EQ(
+      c10::promoteTypes(ScalarType::Undefined, ScalarType::Float),
+      ScalarType::Undefined);
+  EXPECT_EQ(
+      c10::promoteTypes(ScalarType::Bits8, ScalarType::Float),
+      ScalarType::Undefined);
+}
+
+TEST(ScalarTypeTest, PromoteTypesSpecialCases) {
+  // Identical types short-circuit before the unsupported-combination checks.
+  EXPECT_EQ(
+      c10::promoteTypes(ScalarType::QInt8, ScalarType::QInt8),
+      ScalarType::QInt8);
+  EXPECT_EQ(
+      c10::promoteTypes(ScalarType::Float8_e5m2, ScalarType::Float8_e5m2),
+      ScalarType::Float8_e5m2);
+  // Barebones unsigned types only promote against floating point types.
+  EXPECT_EQ(
+      c10::promoteTypes(ScalarType::UInt16, ScalarType::Float),
+      ScalarType::Float);
+  EXPECT_THROW(
+      c10::promoteTypes(ScalarType::UInt16, ScalarType::Int), c10::Error);
+  EXPECT_THROW(
+      c10::promoteTypes(ScalarType::QInt8, ScalarType::Int), c10::Error);
+  EXPECT_THROW(
+      c10::promoteTypes(ScalarType::Float8_e5m2, ScalarType::Float8_e4m3fn),
+      c10::Error);
+}
+
+TEST(ScalarTypeTest, PromoteTypesMultiOperand) {
+  EXPECT_EQ(
+      c10::promoteTypes({ScalarType::Byte, ScalarType::Char, ScalarType::Float}),
+      ScalarType::Float);
+  EXPECT_EQ(
+      c10::promoteTypes({ScalarType::Long, ScalarType::Half}),
+      ScalarType::Half);
+  EXPECT_EQ(c10::promoteTypes({ScalarType::Int}), ScalarType::Int);
+  EXPECT_THROW(
+      c10::promoteTypes(c10::ArrayRef<ScalarType>{}), c10::Error);
+}
+
+} // namespace
@@ -23,6 +23,30 @@ TEST(SymIntTest, CheckRange) {
   EXPECT_FALSE(SymInt::check_range(INT64_MIN));
 }
 
+namespace {
+// A symbolic (non-constant) integer node; only is_int() is needed because
+// the identity fast paths must not dispatch into the node at all.
+class MockSymNodeImpl : public SymNodeImpl {
+ public:
+  bool is_int() override {
+    return true;
+  }
+};
+} // namespace
+
+TEST(SymIntTest, ArithmeticIdentityFastPaths) {
+  SymInt x(SymNode(c10::make_intrusive<MockSymNodeImpl>()));
+  EXPECT_TRUE((x + 0).is_same(x));
+  EXPECT_TRUE((0 + x).is_same(x));
+  EXPECT_TRUE((x - 0).is_same(x));
+  EXPECT_TRUE((x * 1).is_same(x));
+  EXPECT_TRUE((1 * x).is_same(x));
+  EXPECT_TRUE((x / 1).is_same(x));
+  EXPECT_EQ((x * 0).maybe_as_int(), c10::make_optional<int64_t>(0));
+  EXPECT_EQ((0 * x).maybe_as_int(), c10::make_optional<int64_t>(0));
+  EXPECT_EQ((x % 1).maybe_as_int(), c10::make_optional<int64_t>(0));
+}
+
 #if !C10_UBSAN_ENABLED
 // This test fails signed-integer-overflow UBSAN check
 TEST(SymIntTest, Overflows) {
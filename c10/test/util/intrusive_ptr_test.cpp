@@ -3543,4 +3543,67 @@ TEST(
   p->ptr = weak_intrusive_ptr<intrusive_ptr_target>(
       intrusive_ptr<intrusive_ptr_target>(p));
 }
+
+TEST(ThreadConfinedRefcountTest, guardTogglesAndRestoresFlag) {
+  EXPECT_FALSE(c10::detail::refcounts_are_thread_confined());
+  {
+    ThreadConfinedRefcountGuard guard;
+    EXPECT_TRUE(c10::detail::refcounts_are_thread_confined());
+    {
+      ThreadConfinedRefcountGuard nested;
+      EXPECT_TRUE(c10::detail::refcounts_are_thread_confined());
+    }
+    EXPECT_TRUE(c10::detail::refcounts_are_thread_confined());
+  }
+  EXPECT_FALSE(c10::detail::refcounts_are_thread_confined());
+}
+
+TEST(ThreadConfinedRefcountTest, refcountingWorksUnderGuard) {
+  ThreadConfinedRefcountGuard guard;
+  auto obj = make_intrusive<SomeClass>();
+  EXPECT_EQ(1u, obj.use_count());
+  {
+    intrusive_ptr<SomeClass> copy = obj;
+    EXPECT_EQ(2u, obj.use_count());
+    weak_intrusive_ptr<SomeClass> weak(obj);
+    EXPECT_EQ(2u, obj.weak_use_count());
+    intrusive_ptr<SomeClass> locked = weak.lock();
+    EXPECT_EQ(3u, obj.use_count());
+  }
+  EXPECT_EQ(1u, obj.use_count());
+  EXPECT_EQ(1u, obj.weak_use_count());
+}
+
+TEST(ThreadConfinedRefcountTest, destructionRunsUnderGuard) {
+  bool resourcesReleased = false;
+  bool wasDestructed = false;
+  {
+    ThreadConfinedRefcountGuard guard;
+    auto obj =
+        make_intrusive<DestructableMock>(&resourcesReleased, &wasDestructed);
+    auto copy = obj;
+    obj.reset();
+    EXPECT_FALSE(wasDestructed);
+    copy.reset();
+    EXPECT_TRUE(wasDestructed);
+  }
+  EXPECT_TRUE(resourcesReleased);
+}
+
+TEST(ThreadConfinedRefcountTest, objectsOutliveGuard) {
+  bool resourcesReleased = false;
+  bool wasDestructed = false;
+  intrusive_ptr<DestructableMock> obj;
+  {
+    ThreadConfinedRefcountGuard guard;
+    obj = make_intrusive<DestructableMock>(&resourcesReleased, &wasDestructed);
+  }
+  // Refcounting transparently goes back to atomic ops once the guard is
+  // gone; the object can be shared and destroyed as usual.
+  auto copy = obj;
+  EXPECT_EQ(2u, obj.use_count());
+  copy.reset();
+  obj.reset();
+  EXPECT_TRUE(wasDestructed);
+}
 // NOLINTEND(clang-analyzer-cplusplus*)
@@ -1 +1,20 @@
 #include <c10/util/intrusive_ptr.h>
+
+namespace c10::detail {
+
+// See Note [Thread-confined refcounts]
+thread_local bool raw_thread_confined_refcounts = false;
+
+#if defined(_MSC_VER) || defined(C10_ANDROID) || defined(C10_IPHONE)
+bool refcounts_are_thread_confined() {
+  return raw_thread_confined_refcounts;
+}
+#endif
+
+bool _set_thread_confined_refcounts(bool enabled) {
+  const bool prev = raw_thread_confined_refcounts;
+  raw_thread_confined_refcounts = enabled;
+  return prev;
+}
+
+} // namespace c10::detail
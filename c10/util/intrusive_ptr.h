@@ -5,6 +5,7 @@
 #include <atomic>
 #include <climits>
 #include <memory>
+#include <thread>
 #include <type_traits>
 
 namespace pybind11 {
@@ -28,8 +29,63 @@ struct DontIncreaseRefcount {};
 
 namespace detail {
 constexpr uint32_t kImpracticallyHugeReferenceCount = 0x0FFFFFFF;
+
+// Note [Thread-confined refcounts]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Every intrusive_ptr copy does a lock-prefixed RMW on the refcount, which
+// single-threaded inference pays for without getting anything back. While
+// ThreadConfinedRefcountGuard (below) is active on a thread, refcount and
+// weakcount updates on that thread degrade to plain relaxed load/store
+// pairs instead of atomic RMWs. This is only sound if every object whose
+// refcount is touched under the guard is confined to the current thread
+// for the guard's entire lifetime: no other thread may copy, destroy, or
+// lock() a pointer to it concurrently. Objects merely *read* by other
+// threads are fine as long as those threads don't touch refcounts.
+//
+// thread_local variables cannot be C10_API on Windows (see
+// c10/core/impl/LocalDispatchKeySet.h for the same dance).
+#if defined(_MSC_VER) || defined(C10_ANDROID) || defined(C10_IPHONE)
+C10_API bool refcounts_are_thread_confined();
+#else
+extern C10_API thread_local bool raw_thread_confined_refcounts;
+
+inline bool refcounts_are_thread_confined() {
+  return raw_thread_confined_refcounts;
+}
+#endif
+C10_API bool _set_thread_confined_refcounts(bool enabled);
 } // namespace detail
 
+// RAII guard that marks all refcount traffic on the current thread as
+// thread-confined, replacing atomic RMWs with relaxed load/store pairs.
+// See Note [Thread-confined refcounts] for the (strict) usage contract;
+// the typical user is a single-threaded inference loop whose tensors
+// never escape the thread. Nestable; must be destroyed on the thread
+// that created it.
+class C10_API ThreadConfinedRefcountGuard {
+ public:
+  ThreadConfinedRefcountGuard()
+      : prev_(detail::_set_thread_confined_refcounts(true)),
+        thread_id_(std::this_thread::get_id()) {}
+  ThreadConfinedRefcountGuard(const ThreadConfinedRefcountGuard&) = delete;
+  ThreadConfinedRefcountGuard(ThreadConfinedRefcountGuard&&) = delete;
+  ThreadConfinedRefcountGuard& operator=(const ThreadConfinedRefcountGuard&) =
+      delete;
+  ThreadConfinedRefcountGuard& operator=(ThreadConfinedRefcountGuard&&) =
+      delete;
+  ~ThreadConfinedRefcountGuard() {
+    TORCH_INTERNAL_ASSERT_DEBUG_ONLY(
+        thread_id_ == std::this_thread::get_id(),
+        "ThreadConfinedRefcountGuard was destroyed on a different thread "
+        "than it was created on.");
+    detail::_set_thread_confined_refcounts(prev_);
+  }
+
+ private:
+  bool prev_;
+  std::thread::id thread_id_;
+};
+
 /**
  * intrusive_ptr<T> is an alternative to shared_ptr<T> that has better
  * performance because it does the refcounting intrusively
@@ -199,22 +255,45 @@ TTarget* assign_ptr_(TTarget* rhs) {
 // Increment needs to be acquire-release to make use_count() and
 // unique() reliable.
 inline uint32_t atomic_refcount_increment(std::atomic<uint32_t>& refcount) {
+  if (C10_UNLIKELY(refcounts_are_thread_confined())) {
+    // See Note [Thread-confined refcounts]: the object is owned by this
+    // thread only, so a plain load/store pair (a `mov` instead of a
+    // lock-prefixed `add` on x86_64) is enough.
+    const uint32_t new_count = refcount.load(std::memory_order_relaxed) + 1;
+    refcount.store(new_count, std::memory_order_relaxed);
+    return new_count;
+  }
   return refcount.fetch_add(1, std::memory_order_acq_rel) + 1;
 }
 
 // weak_use_count() is only used for testing, so we don't need it to
 // be reliable. Relaxed should be fine.
 inline uint32_t atomic_weakcount_increment(std::atomic<uint32_t>& weakcount) {
+  if (C10_UNLIKELY(refcounts_are_thread_confined())) {
+    const uint32_t new_count = weakcount.load(std::memory_order_relaxed) + 1;
+    weakcount.store(new_count, std::memory_order_relaxed);
+    return new_count;
+  }
   return weakcount.fetch_add(1, std::memory_order_relaxed) + 1;
 }
 
 // Both decrements need to be acquire-release for correctness. See
 // e.g. std::shared_ptr implementation.
 inline uint32_t atomic_refcount_decrement(std::atomic<uint32_t>& refcount) {
+  if (C10_UNLIKELY(refcounts_are_thread_confined())) {
+    const uint32_t new_count = refcount.load(std::memory_order_relaxed) - 1;
+    refcount.store(new_count, std::memory_order_relaxed);
+    return new_count;
+  }
   return refcount.fetch_sub(1, std::memory_order_acq_rel) - 1;
 }
 
 inline uint32_t atomic_weakcount_decrement(std::atomic<uint32_t>& weakcount) {
+  if (C10_UNLIKELY(refcounts_are_thread_confined())) {
+    const uint32_t new_count = weakcount.load(std::memory_order_relaxed) - 1;
+    weakcount.store(new_count, std::memory_order_relaxed);
+    return new_count;
+  }
   return weakcount.fetch_sub(1, std::memory_order_acq_rel) - 1;
 }
 
@@ -1,14 +1,64 @@
 #include "miniz.h"
-#include <iostream>
+#include <algorithm>
+#include <thread>
+#include <vector>
 
 #include "caffe2/serialize/crc_alt.h"
 
+#if defined(USE_EXTERNAL_MZCRC)
+
+namespace {
+
+// Buffers at least this large are checksummed in parallel; below it the
+// thread launch overhead outweighs the speedup.
+constexpr size_t kParallelCrcMinLength = 8 * 1024 * 1024;
+// Per-thread span granularity for the parallel path.
+constexpr size_t kParallelCrcSpan = 4 * 1024 * 1024;
+
+// Checkpointing multi-GB models is bottlenecked on the single-threaded
+// CRC32 of every record. Large buffers are split into spans checksummed on
+// their own threads and folded together with crc32_combine, which yields
+// the same result as a sequential pass.
+uint32_t crc32_parallel(const mz_uint8* ptr, size_t buf_len, uint32_t crc) {
+  const size_t max_threads =
+      std::max(1u, std::thread::hardware_concurrency());
+  const size_t num_spans = std::min(
+      max_threads, (buf_len + kParallelCrcSpan - 1) / kParallelCrcSpan);
+  const size_t span_len = (buf_len + num_spans - 1) / num_spans;
+
+  std::vector<uint32_t> span_crcs(num_spans, 0);
+  std::vector<size_t> span_lens(num_spans, 0);
+  std::vector<std::thread> workers;
+  workers.reserve(num_spans);
+  for (size_t i = 0; i < num_spans; i++) {
+    const size_t start = i * span_len;
+    const size_t len = std::min(span_len, buf_len - start);
+    span_lens[i] = len;
+    workers.emplace_back([i, ptr, start, len, &span_crcs] {
+      span_crcs[i] = crc32_fast(ptr + start, len, 0);
+    });
+  }
+  for (auto& worker : workers) {
+    worker.join();
+  }
+
+  uint32_t result = crc;
+  for (size_t i = 0; i < num_spans; i++) {
+    result = crc32_combine(result, span_crcs[i], span_lens[i]);
+  }
+  return result;
+}
+
+} // namespace
+
 extern "C" {
 // See: miniz.h
-#if defined(USE_EXTERNAL_MZCRC)
 mz_ulong mz_crc32(mz_ulong crc, const mz_uint8* ptr, size_t buf_len) {
-  auto z = crc32_fast(ptr, buf_len, crc);
-  return z;
-};
-#endif
+  if (buf_len >= kParallelCrcMinLength) {
+    return crc32_parallel(ptr, buf_len, static_cast<uint32_t>(crc));
+  }
+  return crc32_fast(ptr, buf_len, crc);
 }
+}
+
+#endif
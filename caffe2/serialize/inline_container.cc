@@ -1,3 +1,4 @@
+#include <atomic>
 #include <cstdio>
 #include <cstring>
 #include <cerrno>
@@ -5,18 +6,30 @@
 #include <ostream>
 #include <fstream>
 #include <algorithm>
+#include <condition_variable>
+#include <deque>
 #include <sstream>
+#include <utility>
+#include <vector>
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <thread>
 
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
 #include <c10/core/Allocator.h>
 #include <c10/core/Backend.h>
 #include <c10/core/CPUAllocator.h>
+#include <c10/core/alignment.h>
 #include <c10/core/Backend.h>
 #include <c10/util/Exception.h>
 #include <c10/util/Logging.h>
 #include <c10/util/hash.h>
+#include <c10/util/irange.h>
 
 #include "caffe2/core/common.h"
 #include "caffe2/serialize/file_adapter.h"
@@ -36,20 +49,50 @@ struct MzZipReaderIterWrapper {
   mz_zip_reader_extract_iter_state* impl;
 };
 
+// Read-ahead state for a prefetching ChunkRecordIterator: a reader thread
+// extracts chunks into `ready` while the consumer drains them, recycling
+// buffers through `free_bufs` so steady state holds kChunkPrefetchDepth
+// allocations (double buffering).
+constexpr size_t kChunkPrefetchDepth = 2;
+
+struct ChunkPrefetchState {
+  std::mutex mutex;
+  std::condition_variable cv;
+  // chunks read ahead, in record order; .second is the byte count
+  std::deque<std::pair<std::vector<char>, size_t>> ready;
+  std::vector<std::vector<char>> free_bufs;
+  std::string error;
+  bool finished = false;
+  bool stopped = false;
+  std::thread reader;
+};
+
 ChunkRecordIterator::ChunkRecordIterator(
     size_t recordSize,
     size_t chunkSize,
-    std::unique_ptr<MzZipReaderIterWrapper> iter)
+    std::unique_ptr<MzZipReaderIterWrapper> iter,
+    bool prefetch)
     : recordSize_(recordSize),
       chunkSize_(chunkSize),
       offset_(0),
-      iter_(std::move(iter)) {}
+      iter_(std::move(iter)),
+      prefetch_(prefetch) {}
 
 ChunkRecordIterator::~ChunkRecordIterator() {
+  if (prefetch_state_) {
+    {
+      std::lock_guard<std::mutex> guard(prefetch_state_->mutex);
+      prefetch_state_->stopped = true;
+    }
+    prefetch_state_->cv.notify_all();
+    if (prefetch_state_->reader.joinable()) {
+      prefetch_state_->reader.join();
+    }
+  }
   mz_zip_reader_extract_iter_free(iter_->impl);
 }
 
-size_t ChunkRecordIterator::next(void* buf){
+size_t ChunkRecordIterator::readChunk(void* buf) {
   size_t want_size = std::min(chunkSize_, recordSize_ - offset_);
   if (want_size == 0) {
     return 0;
@@ -60,6 +103,78 @@ size_t ChunkRecordIterator::next(void* buf){
   return read_size;
 }
 
+void ChunkRecordIterator::startPrefetch() {
+  prefetch_state_ = std::make_unique<ChunkPrefetchState>();
+  auto* state = prefetch_state_.get();
+  for (size_t i = 0; i < kChunkPrefetchDepth; i++) {
+    state->free_bufs.emplace_back(chunkSize_);
+  }
+  state->reader = std::thread([this, state]() {
+    while (true) {
+      std::vector<char> buf;
+      {
+        std::unique_lock<std::mutex> lock(state->mutex);
+        state->cv.wait(lock, [state] {
+          return state->stopped || !state->free_bufs.empty();
+        });
+        if (state->stopped) {
+          return;
+        }
+        buf = std::move(state->free_bufs.back());
+        state->free_bufs.pop_back();
+      }
+      size_t read_size = 0;
+      try {
+        read_size = readChunk(buf.data());
+      } catch (const std::exception& e) {
+        std::lock_guard<std::mutex> guard(state->mutex);
+        state->error = e.what();
+        state->cv.notify_all();
+        return;
+      }
+      {
+        std::lock_guard<std::mutex> guard(state->mutex);
+        state->ready.emplace_back(std::move(buf), read_size);
+      }
+      state->cv.notify_all();
+      if (read_size == 0) {
+        // end of record
+        return;
+      }
+    }
+  });
+}
+
+size_t ChunkRecordIterator::next(void* buf){
+  if (!prefetch_) {
+    return readChunk(buf);
+  }
+  if (!prefetch_state_) {
+    startPrefetch();
+  }
+  auto* state = prefetch_state_.get();
+  std::unique_lock<std::mutex> lock(state->mutex);
+  if (state->finished) {
+    return 0;
+  }
+  state->cv.wait(lock, [state] {
+    return !state->ready.empty() || !state->error.empty();
+  });
+  TORCH_CHECK(state->error.empty(), "chunk prefetch failed: ", state->error);
+  auto chunk = std::move(state->ready.front());
+  state->ready.pop_front();
+  const size_t read_size = chunk.second;
+  if (read_size == 0) {
+    state->finished = true;
+    return 0;
+  }
+  std::memcpy(buf, chunk.first.data(), read_size);
+  state->free_bufs.push_back(std::move(chunk.first));
+  lock.unlock();
+  state->cv.notify_all();
+  return read_size;
+}
+
 size_t istream_read_func(void* pOpaque, mz_uint64 file_ofs, void* pBuf, size_t n) {
   auto self = static_cast<PyTorchStreamReader*>(pOpaque);
   return self->read(file_ofs, static_cast<char*>(pBuf), n);
@@ -116,6 +231,8 @@ size_t PyTorchStreamReader::read(uint64_t pos, char* buf, size_t n) {
 PyTorchStreamReader::PyTorchStreamReader(const std::string& file_name)
     : ar_(std::make_unique<mz_zip_archive>()),
       in_(std::make_unique<FileAdapter>(file_name)) {
+  // Remembered so zero-copy mode can mmap the archive; see setZeroCopyRead().
+  file_name_ = file_name;
   init();
 }
 
@@ -340,6 +457,55 @@ size_t PyTorchStreamReader::getRecordID(const std::string& name) {
   return result;
 }
 
+#ifndef _WIN32
+namespace {
+// Context for a DataPtr that points into an mmap of the archive; keeps the
+// mapping alive until the last record referencing it is freed.
+struct MmapRecordContext {
+  std::shared_ptr<void> mapping;
+};
+
+void deleteMmapRecordContext(void* ctx) {
+  delete static_cast<MmapRecordContext*>(ctx);
+}
+} // namespace
+#endif
+
+bool PyTorchStreamReader::ensureArchiveMapped() {
+#ifdef _WIN32
+  return false;
+#else
+  if (mmap_base_) {
+    return true;
+  }
+  if (file_name_.empty()) {
+    return false;
+  }
+  const int fd = open(file_name_.c_str(), O_RDONLY);
+  if (fd == -1) {
+    return false;
+  }
+  struct stat st {};
+  if (fstat(fd, &st) != 0) {
+    close(fd);
+    return false;
+  }
+  const auto size = static_cast<size_t>(st.st_size);
+  // PROT_WRITE + MAP_PRIVATE: loaded tensors stay mutable, with written
+  // pages copied on first touch while clean pages remain shared with other
+  // processes mapping the same checkpoint.
+  void* base = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (base == MAP_FAILED) {
+    return false;
+  }
+  mmap_size_ = size;
+  mmap_base_ =
+      std::shared_ptr<void>(base, [size](void* p) { munmap(p, size); });
+  return true;
+#endif
+}
+
 // return dataptr, size
 std::tuple<at::DataPtr, size_t> PyTorchStreamReader::getRecord(const std::string& name) {
   std::lock_guard<std::mutex> guard(reader_lock_);
@@ -351,6 +517,25 @@ std::tuple<at::DataPtr, size_t> PyTorchStreamReader::getRecord(const std::string
   mz_zip_archive_file_stat stat;
   mz_zip_reader_file_stat(ar_.get(), key, &stat);
   valid("retrieving file meta-data for ", name.c_str());
+#ifndef _WIN32
+  // Zero-copy fast path: serve stored (uncompressed), aligned records
+  // directly out of an mmap of the archive. See setZeroCopyRead().
+  if (zero_copy_read_ && stat.m_method == 0 && ensureArchiveMapped()) {
+    const size_t payload_ofs = getRecordPayloadOffset(stat.m_local_header_ofs);
+    void* data = static_cast<uint8_t*>(mmap_base_.get()) + payload_ofs;
+    if (payload_ofs + stat.m_uncomp_size <= mmap_size_ &&
+        reinterpret_cast<uintptr_t>(data) % c10::gAlignment == 0) {
+      auto* ctx = new MmapRecordContext{mmap_base_};
+      return std::make_tuple(
+          at::DataPtr(
+              data,
+              ctx,
+              &deleteMmapRecordContext,
+              at::Device(at::DeviceType::CPU)),
+          stat.m_uncomp_size);
+    }
+  }
+#endif
   at::DataPtr retval = c10::GetCPUAllocator()->allocate(stat.m_uncomp_size);
   mz_zip_reader_extract_to_mem(ar_.get(), key, retval.get(), stat.m_uncomp_size, 0);
   valid("reading file ", name.c_str());
@@ -358,6 +543,103 @@ std::tuple<at::DataPtr, size_t> PyTorchStreamReader::getRecord(const std::string
   return std::make_tuple(std::move(retval), stat.m_uncomp_size);
 }
 
+std::vector<std::tuple<at::DataPtr, size_t>> PyTorchStreamReader::getRecords(
+    const std::vector<std::string>& names) {
+  std::vector<std::tuple<at::DataPtr, size_t>> results(names.size());
+
+  // Payload reads that can run off the calling thread: stored records on a
+  // file-backed reader are plain byte ranges, so a private FileAdapter per
+  // worker can read them positionally without touching miniz or in_.
+  struct PayloadRead {
+    size_t payload_ofs;
+    size_t size;
+    void* dst;
+    size_t read_size;
+  };
+  std::vector<PayloadRead> reads;
+  std::vector<size_t> fallback;
+  {
+    std::lock_guard<std::mutex> guard(reader_lock_);
+    const bool can_read_positionally = !file_name_.empty() && !zero_copy_read_;
+    for (const auto i : c10::irange(names.size())) {
+      const std::string& name = names[i];
+      if ((!load_debug_symbol_) &&
+          c10::string_view(name).ends_with(kDebugPklSuffix)) {
+        continue;
+      }
+      if (!can_read_positionally) {
+        fallback.push_back(i);
+        continue;
+      }
+      size_t key = getRecordID(name);
+      mz_zip_archive_file_stat stat;
+      mz_zip_reader_file_stat(ar_.get(), key, &stat);
+      valid("retrieving file meta-data for ", name.c_str());
+      if (stat.m_method != 0) {
+        // Compressed records need miniz and therefore the lock.
+        fallback.push_back(i);
+        continue;
+      }
+      at::DataPtr retval = c10::GetCPUAllocator()->allocate(stat.m_uncomp_size);
+      reads.push_back(PayloadRead{
+          getRecordPayloadOffset(stat.m_local_header_ofs),
+          static_cast<size_t>(stat.m_uncomp_size),
+          retval.get(),
+          0});
+      results[i] = std::make_tuple(std::move(retval), stat.m_uncomp_size);
+    }
+
+    if (!reads.empty()) {
+      constexpr size_t kMaxReadThreads = 8;
+      const size_t nthread = std::min(kMaxReadThreads, reads.size());
+      // Open every extra adapter before spawning so open failures throw on
+      // the calling thread. Worker 0 reuses in_, which is safe because
+      // reader_lock_ is held for the duration of the reads.
+      std::vector<std::unique_ptr<FileAdapter>> adapters;
+      for (const auto i : c10::irange(nthread - 1)) {
+        (void)i;
+        adapters.emplace_back(std::make_unique<FileAdapter>(file_name_));
+      }
+      std::atomic<size_t> next_read{0};
+      std::vector<std::thread> loaderThreads;
+      for (const auto t : c10::irange(nthread)) {
+        loaderThreads.emplace_back([this, t, &adapters, &next_read, &reads] {
+          while (true) {
+            const size_t i = next_read.fetch_add(1);
+            if (i >= reads.size()) {
+              return;
+            }
+            PayloadRead& r = reads[i];
+            if (t == 0) {
+              r.read_size = read(r.payload_ofs, static_cast<char*>(r.dst), r.size);
+            } else {
+              r.read_size = adapters[t - 1]->read(r.payload_ofs, r.dst, r.size);
+            }
+          }
+        });
+      }
+      for (auto& thread : loaderThreads) {
+        thread.join();
+      }
+      for (const auto& r : reads) {
+        TORCH_CHECK(
+            r.read_size == r.size,
+            "record size ",
+            r.size,
+            " mismatch with read size ",
+            r.read_size);
+      }
+    }
+  }
+
+  // Entries the parallel path could not serve take the regular single-record
+  // path (which handles compression, zero-copy mode and stream adapters).
+  for (const size_t i : fallback) {
+    results[i] = getRecord(names[i]);
+  }
+  return results;
+}
+
 size_t
 PyTorchStreamReader::getRecordMultiReaders(const std::string& name,
   std::vector<std::shared_ptr<ReadAdapterInterface>>& additionalReaders,
@@ -437,6 +719,11 @@ PyTorchStreamReader::getRecord(const std::string& name,
     // Reader size too small, use single threaded version
     return getRecord(name);
   }
+  if (stat.m_method != 0) {
+    // Compressed records cannot be split into raw byte-range reads; use the
+    // single threaded version, which streams them through the decompressor
+    return getRecord(name);
+  }
 
   at::DataPtr retval = c10::GetCPUAllocator()->allocate(stat.m_uncomp_size);
   void* dst = retval.get();
@@ -495,6 +782,11 @@ PyTorchStreamReader::getRecord(const std::string& name, void* dst, size_t n,
     // Reader size too small, use single threaded version
     return getRecord(name, dst, n);
   }
+  if (stat.m_method != 0) {
+    // Compressed records cannot be split into raw byte-range reads; use the
+    // single threaded version, which streams them through the decompressor
+    return getRecord(name, dst, n);
+  }
 
   PyTorchStreamReader::getRecordMultiReaders(name, additionalReaders, dst, n);
   return stat.m_uncomp_size;
@@ -544,7 +836,8 @@ size_t PyTorchStreamReader::getRecord(
 ChunkRecordIterator PyTorchStreamReader::createChunkReaderIter(
     const std::string& name,
     const size_t recordSize,
-    const size_t chunkSize) {
+    const size_t chunkSize,
+    const bool prefetch) {
   // Create zip reader iterator
   size_t key = getRecordID(name);
   mz_zip_reader_extract_iter_state* zipReaderIter =
@@ -557,28 +850,33 @@ ChunkRecordIterator PyTorchStreamReader::createChunkReaderIter(
   return ChunkRecordIterator(
       recordSize,
       chunkSize,
-      std::make_unique<MzZipReaderIterWrapper>(zipReaderIter));
+      std::make_unique<MzZipReaderIterWrapper>(zipReaderIter),
+      prefetch);
 }
 
 static int64_t read_le_16(uint8_t* buf) {
   return buf[0] + (buf[1] << 8);
 }
 
-size_t PyTorchStreamReader::getRecordOffset(const std::string& name) {
-  std::lock_guard<std::mutex> guard(reader_lock_);
-  mz_zip_archive_file_stat stat;
-  mz_zip_reader_file_stat(ar_.get(), getRecordID(name), &stat);
-  valid("retrieving file meta-data for ", name.c_str());
+size_t PyTorchStreamReader::getRecordPayloadOffset(uint64_t local_header_ofs) {
   // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays,modernize-avoid-c-arrays)
   uint8_t local_header[MZ_ZIP_LOCAL_DIR_HEADER_SIZE];
   in_->read(
-      stat.m_local_header_ofs,
+      local_header_ofs,
       local_header,
       MZ_ZIP_LOCAL_DIR_HEADER_SIZE,
       "reading file header");
   size_t filename_len = read_le_16(local_header + MZ_ZIP_LDH_FILENAME_LEN_OFS);
   size_t extra_len = read_le_16(local_header + MZ_ZIP_LDH_EXTRA_LEN_OFS);
-  return stat.m_local_header_ofs + MZ_ZIP_LOCAL_DIR_HEADER_SIZE + filename_len + extra_len;
+  return local_header_ofs + MZ_ZIP_LOCAL_DIR_HEADER_SIZE + filename_len + extra_len;
+}
+
+size_t PyTorchStreamReader::getRecordOffset(const std::string& name) {
+  std::lock_guard<std::mutex> guard(reader_lock_);
+  mz_zip_archive_file_stat stat;
+  mz_zip_reader_file_stat(ar_.get(), getRecordID(name), &stat);
+  valid("retrieving file meta-data for ", name.c_str());
+  return getRecordPayloadOffset(stat.m_local_header_ofs);
 }
 
 size_t PyTorchStreamReader::getRecordSize(const std::string& name) {
@@ -681,6 +979,18 @@ void PyTorchStreamWriter::writeRecord(
     const void* data,
     size_t size,
     bool compress) {
+  writeRecord(
+      name,
+      data,
+      size,
+      compress ? CompressionMethod::Deflate : CompressionMethod::Stored);
+}
+
+void PyTorchStreamWriter::writeRecord(
+    const std::string& name,
+    const void* data,
+    size_t size,
+    CompressionMethod method) {
   AT_ASSERT(!finalized_);
   AT_ASSERT(!archive_name_plus_slash_.empty());
   TORCH_INTERNAL_ASSERT(
@@ -694,7 +1004,18 @@ void PyTorchStreamWriter::writeRecord(
   std::string full_name = archive_name_plus_slash_ + name;
   size_t padding_size =
       detail::getPadding(ar_->m_archive_size, full_name.size(), size, padding_);
-  uint32_t flags = compress ? MZ_BEST_COMPRESSION : 0;
+  uint32_t flags = 0;
+  switch (method) {
+    case CompressionMethod::Stored:
+      flags = 0;
+      break;
+    case CompressionMethod::DeflateFast:
+      flags = MZ_BEST_SPEED;
+      break;
+    case CompressionMethod::Deflate:
+      flags = MZ_BEST_COMPRESSION;
+      break;
+  }
   mz_zip_writer_add_mem_ex_v2(
       /*pZip=*/ar_.get(),
       /*pArchive_name=*/full_name.c_str(),
@@ -97,6 +97,7 @@ namespace serialize {
 static constexpr const char* kSerializationIdRecordName = ".data/serialization_id";
 
 struct MzZipReaderIterWrapper;
+struct ChunkPrefetchState;
 
 class TORCH_API ChunkRecordIterator {
  public:
@@ -110,12 +111,21 @@ class TORCH_API ChunkRecordIterator {
  ChunkRecordIterator(
       size_t recordSize,
       size_t chunkSize,
-      std::unique_ptr<MzZipReaderIterWrapper> iter);
+      std::unique_ptr<MzZipReaderIterWrapper> iter,
+      bool prefetch);
+
+  // Pulls the next chunk synchronously from the zip extract iterator.
+  size_t readChunk(void* buf);
+  void startPrefetch();
 
   const size_t recordSize_;
   const size_t chunkSize_;
   size_t offset_;
   std::unique_ptr<MzZipReaderIterWrapper> iter_;
+  // Read-ahead state, allocated on the first next() call when prefetching
+  // was requested; see createChunkReaderIter().
+  const bool prefetch_;
+  std::unique_ptr<ChunkPrefetchState> prefetch_state_;
 
   friend class PyTorchStreamReader;
 };
@@ -165,10 +175,24 @@ class TORCH_API PyTorchStreamReader final {
   bool hasRecord(const std::string& name);
   std::vector<std::string> getAllRecords();
 
+  // Batched read of several records, in `names` order. On a file-backed
+  // reader, payloads of stored (uncompressed) records are read in parallel
+  // by a small pool of threads with a private FileAdapter each, so loading
+  // many tensor records overlaps their file reads instead of serializing on
+  // reader_lock_. Compressed records, stream-backed readers and zero-copy
+  // mode fall back to the single-record path per entry.
+  std::vector<std::tuple<at::DataPtr, size_t>> getRecords(
+      const std::vector<std::string>& names);
+
+  // When `prefetch` is set, a dedicated reader thread extracts chunks ahead
+  // of the caller into a small ready queue (double buffering), so next()
+  // overlaps file reads with the caller's compute. While such an iterator is
+  // live, the reader must not be used through any other method.
   ChunkRecordIterator createChunkReaderIter(
       const std::string& name,
       const size_t recordSize,
-      const size_t chunkSize);
+      const size_t chunkSize,
+      const bool prefetch = false);
 
   ~PyTorchStreamReader();
   uint64_t version() const {
@@ -184,11 +208,29 @@ class TORCH_API PyTorchStreamReader final {
   void setAdditionalReaderSizeThreshold(const size_t& size){
     additional_reader_size_threshold_ = size;
   }
+
+  // Zero-copy read mode. When enabled on a file-backed reader, getRecord()
+  // returns uncompressed, suitably aligned records as DataPtrs that point
+  // into a private (copy-on-write) mmap of the archive instead of copying
+  // them into freshly allocated buffers: pages are faulted in lazily and
+  // clean pages are shared across processes that map the same file.
+  // Compressed or misaligned records, and readers not backed by a file,
+  // fall back to the copying path. Has no effect on Windows.
+  void setZeroCopyRead(bool enable) {
+    zero_copy_read_ = enable;
+  }
+
  private:
   void init();
   size_t read(uint64_t pos, char* buf, size_t n);
   void valid(const char* what, const char* info = "");
   size_t getRecordID(const std::string& name);
+  // Returns the offset of a record's payload given the offset of its zip
+  // local file header. Caller must hold reader_lock_.
+  size_t getRecordPayloadOffset(uint64_t local_header_ofs);
+  // Maps the backing archive file into memory for zero-copy reads.
+  // Returns false if the reader is not file-backed or mapping failed.
+  bool ensureArchiveMapped();
 
   friend size_t
   istream_read_func(void* pOpaque, uint64_t file_ofs, void* pBuf, size_t n);
@@ -201,6 +243,25 @@ class TORCH_API PyTorchStreamReader final {
   bool load_debug_symbol_ = true;
   std::string serialization_id_;
   size_t additional_reader_size_threshold_;
+  // Zero-copy read mode state; see setZeroCopyRead().
+  std::string file_name_;
+  bool zero_copy_read_ = false;
+  std::shared_ptr<void> mmap_base_;
+  size_t mmap_size_ = 0;
+};
+
+// Per-record compression codecs for PyTorchStreamWriter::writeRecord(). The
+// records stay ordinary zip entries, so PyTorchStreamReader (and common zip
+// tools) decompress them transparently on read, including through the chunked
+// getRecord() paths. Only codecs implemented by the bundled miniz are
+// available here; DeflateFast trades compression ratio for throughput and is
+// usually the right choice for checkpoint shards written on the training
+// critical path, while Deflate matches the ratio of the legacy
+// `compress = true` flag.
+enum class CompressionMethod : uint8_t {
+  Stored = 0,
+  DeflateFast = 1,
+  Deflate = 2,
 };
 
 class TORCH_API PyTorchStreamWriter final {
@@ -216,6 +277,11 @@ class TORCH_API PyTorchStreamWriter final {
       const void* data,
       size_t size,
       bool compress = false);
+  void writeRecord(
+      const std::string& name,
+      const void* data,
+      size_t size,
+      CompressionMethod method);
   void writeEndOfFile();
 
   const std::unordered_set<std::string>& getAllWrittenRecords();
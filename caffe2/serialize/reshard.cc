@@ -0,0 +1,380 @@
+#include "caffe2/serialize/reshard.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+#include <c10/core/thread_pool.h>
+#include <c10/util/Exception.h>
+#include <c10/util/irange.h>
+
+#include "caffe2/serialize/file_adapter.h"
+
+namespace caffe2 {
+namespace serialize {
+
+uint64_t ShardingSpec::total_bytes() const {
+  uint64_t total = 0;
+  for (const auto& chunk : chunks) {
+    total += chunk.num_bytes;
+  }
+  return total;
+}
+
+void ShardingSpec::validate() const {
+  std::vector<const ShardChunk*> sorted;
+  sorted.reserve(chunks.size());
+  for (const auto& chunk : chunks) {
+    TORCH_CHECK(
+        chunk.num_bytes > 0,
+        "Sharding spec for '",
+        tensor_name,
+        "' contains an empty chunk (record '",
+        chunk.record_name,
+        "')");
+    sorted.push_back(&chunk);
+  }
+  std::sort(sorted.begin(), sorted.end(), [](const auto* a, const auto* b) {
+    return a->offset < b->offset;
+  });
+  uint64_t expected_offset = 0;
+  for (const auto* chunk : sorted) {
+    TORCH_CHECK(
+        chunk->offset == expected_offset,
+        "Sharding spec for '",
+        tensor_name,
+        "' has a gap or overlap at byte offset ",
+        expected_offset,
+        " (next chunk starts at ",
+        chunk->offset,
+        ")");
+    expected_offset = chunk->offset + chunk->num_bytes;
+  }
+}
+
+ReshardPlan planReshard(
+    const std::vector<ShardingSpec>& source_specs,
+    const std::vector<ShardingSpec>& target_specs) {
+  std::unordered_map<std::string, const ShardingSpec*> source_by_name;
+  for (const auto& spec : source_specs) {
+    spec.validate();
+    const bool inserted =
+        source_by_name.emplace(spec.tensor_name, &spec).second;
+    TORCH_CHECK(
+        inserted, "Duplicate source sharding spec for '", spec.tensor_name, "'");
+  }
+
+  ReshardPlan plan;
+  // Target records are discovered in target-spec order; this map keeps one
+  // entry per (archive, record) so records packing several chunks are
+  // materialized (and written) once.
+  std::unordered_map<std::string, size_t> record_index;
+  size_t matched_sources = 0;
+
+  for (const auto& target : target_specs) {
+    target.validate();
+    const auto it = source_by_name.find(target.tensor_name);
+    TORCH_CHECK(
+        it != source_by_name.end(),
+        "No source sharding spec for target tensor '",
+        target.tensor_name,
+        "'");
+    const ShardingSpec& source = *it->second;
+    ++matched_sources;
+    TORCH_CHECK(
+        source.total_bytes() == target.total_bytes(),
+        "Source and target sharding specs for '",
+        target.tensor_name,
+        "' disagree on the tensor size: ",
+        source.total_bytes(),
+        " vs ",
+        target.total_bytes(),
+        " bytes");
+
+    auto sorted_by_offset = [](const std::vector<ShardChunk>& chunks) {
+      std::vector<const ShardChunk*> sorted;
+      sorted.reserve(chunks.size());
+      for (const auto& chunk : chunks) {
+        sorted.push_back(&chunk);
+      }
+      std::sort(sorted.begin(), sorted.end(), [](const auto* a, const auto* b) {
+        return a->offset < b->offset;
+      });
+      return sorted;
+    };
+    const auto source_chunks = sorted_by_offset(source.chunks);
+    const auto target_chunks = sorted_by_offset(target.chunks);
+
+    // Register every target record up front so records land in the plan
+    // even if (pathologically) no source bytes map onto them.
+    for (const auto* chunk : target_chunks) {
+      const std::string key =
+          std::to_string(chunk->archive_index) + '/' + chunk->record_name;
+      auto inserted = record_index.emplace(key, plan.records.size());
+      if (inserted.second) {
+        plan.records.emplace_back();
+        plan.records.back().archive_index = chunk->archive_index;
+        plan.records.back().name = chunk->record_name;
+      }
+      auto& record = plan.records[inserted.first->second];
+      record.num_bytes =
+          std::max(record.num_bytes, chunk->record_offset + chunk->num_bytes);
+    }
+
+    // Two-pointer sweep over the two sorted tilings of [0, total_bytes).
+    size_t si = 0;
+    for (const auto* tchunk : target_chunks) {
+      const uint64_t tbegin = tchunk->offset;
+      const uint64_t tend = tchunk->offset + tchunk->num_bytes;
+      while (si < source_chunks.size() &&
+             source_chunks[si]->offset + source_chunks[si]->num_bytes <=
+                 tbegin) {
+        ++si;
+      }
+      for (size_t i = si; i < source_chunks.size(); ++i) {
+        const ShardChunk& schunk = *source_chunks[i];
+        if (schunk.offset >= tend) {
+          break;
+        }
+        const uint64_t begin = std::max(schunk.offset, tbegin);
+        const uint64_t end =
+            std::min(schunk.offset + schunk.num_bytes, tend);
+        ReshardCopyOp op;
+        op.source_archive = schunk.archive_index;
+        op.source_record = schunk.record_name;
+        op.source_offset = schunk.record_offset + (begin - schunk.offset);
+        op.target_archive = tchunk->archive_index;
+        op.target_record = tchunk->record_name;
+        op.target_offset = tchunk->record_offset + (begin - tbegin);
+        op.num_bytes = end - begin;
+        const std::string key =
+            std::to_string(tchunk->archive_index) + '/' + tchunk->record_name;
+        plan.records[record_index.at(key)].ops.push_back(plan.ops.size());
+        plan.ops.push_back(std::move(op));
+      }
+    }
+  }
+  TORCH_CHECK(
+      matched_sources == source_specs.size(),
+      "Some source sharding specs have no matching target spec");
+
+  // Each target archive is written sequentially, so keep its records
+  // together (stable to preserve the target-spec order within an archive).
+  std::stable_sort(
+      plan.records.begin(),
+      plan.records.end(),
+      [](const ReshardTargetRecord& a, const ReshardTargetRecord& b) {
+        return a.archive_index < b.archive_index;
+      });
+  return plan;
+}
+
+namespace {
+
+// A handful of independent file handles per source archive lets reads into
+// the same archive proceed in parallel without a shared seek position.
+constexpr size_t kHandlesPerArchive = 4;
+
+} // namespace
+
+struct ReshardEngine::SourceArchive {
+  explicit SourceArchive(const std::string& path) : reader(path) {
+    for (const auto i C10_UNUSED : c10::irange(kHandlesPerArchive)) {
+      handles.emplace_back(std::make_unique<Handle>(path));
+    }
+  }
+
+  struct Handle {
+    explicit Handle(const std::string& path) : adapter(path) {}
+    FileAdapter adapter;
+    std::mutex mutex;
+  };
+
+  PyTorchStreamReader reader;
+  std::vector<std::unique_ptr<Handle>> handles;
+  std::atomic<size_t> next_handle{0};
+  // record name -> (payload offset in the raw file, payload size)
+  std::unordered_map<std::string, std::pair<uint64_t, uint64_t>> extents;
+};
+
+ReshardEngine::ReshardEngine(
+    std::vector<std::string> source_paths,
+    ReshardOptions options)
+    : options_(options) {
+  sources_.reserve(source_paths.size());
+  for (const auto& path : source_paths) {
+    sources_.emplace_back(std::make_unique<SourceArchive>(path));
+  }
+  if (options_.num_threads == 0) {
+    options_.num_threads = c10::TaskThreadPoolBase::defaultNumThreads();
+  }
+  TORCH_CHECK(options_.window_bytes > 0, "window_bytes must be positive");
+}
+
+ReshardEngine::~ReshardEngine() = default;
+
+void ReshardEngine::run(
+    const ReshardPlan& plan,
+    const std::vector<std::string>& target_paths) {
+  // Resolve every source record once; getRecordOffset points at the raw
+  // payload, which is only the record's bytes for Stored (uncompressed)
+  // entries.
+  for (const auto& op : plan.ops) {
+    TORCH_CHECK(
+        op.source_archive < sources_.size(),
+        "Copy op references source archive ",
+        op.source_archive,
+        " but only ",
+        sources_.size(),
+        " archives were opened");
+    TORCH_CHECK(
+        op.target_archive < target_paths.size(),
+        "Copy op references target archive ",
+        op.target_archive,
+        " but only ",
+        target_paths.size(),
+        " target paths were given");
+    auto& source = *sources_[op.source_archive];
+    auto it = source.extents.find(op.source_record);
+    if (it == source.extents.end()) {
+      const uint64_t offset = source.reader.getRecordOffset(op.source_record);
+      const uint64_t size = source.reader.getRecordSize(op.source_record);
+      it = source.extents
+               .emplace(op.source_record, std::make_pair(offset, size))
+               .first;
+    }
+    TORCH_CHECK(
+        op.source_offset + op.num_bytes <= it->second.second,
+        "Copy op reads past the end of record '",
+        op.source_record,
+        "' (",
+        op.source_offset + op.num_bytes,
+        " > ",
+        it->second.second,
+        " bytes)");
+  }
+
+  struct PendingRecord {
+    const ReshardTargetRecord* record;
+    std::vector<char> buffer;
+    size_t remaining_ops;
+  };
+
+  std::mutex mutex;
+  std::condition_variable cv;
+  std::deque<std::unique_ptr<PendingRecord>> window;
+  uint64_t window_bytes_used = 0;
+  std::exception_ptr first_error;
+  size_t tasks_in_flight = 0;
+
+  c10::ThreadPool pool(static_cast<int>(options_.num_threads));
+
+  size_t record_idx = 0;
+  for (const auto target_archive : c10::irange(target_paths.size())) {
+    PyTorchStreamWriter writer(target_paths[target_archive]);
+    while (record_idx < plan.records.size() &&
+           plan.records[record_idx].archive_index == target_archive) {
+      const ReshardTargetRecord& record = plan.records[record_idx];
+      ++record_idx;
+
+      std::unique_lock<std::mutex> lock(mutex);
+      // Drain finished records, then wait for window space. A record larger
+      // than the window is admitted alone.
+      while (true) {
+        while (!window.empty() && window.front()->remaining_ops == 0) {
+          auto done = std::move(window.front());
+          window.pop_front();
+          window_bytes_used -= done->buffer.size();
+          lock.unlock();
+          writer.writeRecord(
+              done->record->name, done->buffer.data(), done->buffer.size());
+          lock.lock();
+        }
+        if (first_error ||
+            window.empty() ||
+            window_bytes_used + record.num_bytes <= options_.window_bytes) {
+          break;
+        }
+        cv.wait(lock);
+      }
+      if (first_error) {
+        break;
+      }
+
+      auto pending = std::make_unique<PendingRecord>();
+      pending->record = &record;
+      // Zero-filled so bytes no source chunk maps onto are deterministic.
+      pending->buffer.assign(record.num_bytes, 0);
+      pending->remaining_ops = record.ops.size();
+      PendingRecord* pending_ptr = pending.get();
+      window.push_back(std::move(pending));
+      window_bytes_used += record.num_bytes;
+      tasks_in_flight += record.ops.size();
+      lock.unlock();
+
+      for (const auto op_idx : record.ops) {
+        const ReshardCopyOp& op = plan.ops[op_idx];
+        pool.run([this, &op, pending_ptr, &mutex, &cv, &first_error,
+                  &tasks_in_flight] {
+          std::exception_ptr error;
+          try {
+            auto& source = *sources_[op.source_archive];
+            const auto extent = source.extents.at(op.source_record);
+            auto& handle = *source.handles
+                                [source.next_handle++ % source.handles.size()];
+            std::lock_guard<std::mutex> handle_lock(handle.mutex);
+            handle.adapter.read(
+                extent.first + op.source_offset,
+                pending_ptr->buffer.data() + op.target_offset,
+                op.num_bytes,
+                "reading reshard source chunk");
+          } catch (...) {
+            error = std::current_exception();
+          }
+          std::lock_guard<std::mutex> lock(mutex);
+          if (error && !first_error) {
+            first_error = error;
+          }
+          --pending_ptr->remaining_ops;
+          --tasks_in_flight;
+          cv.notify_all();
+        });
+      }
+    }
+
+    // Drain the tail of this archive's window.
+    std::unique_lock<std::mutex> lock(mutex);
+    while (!window.empty()) {
+      if (window.front()->remaining_ops == 0) {
+        auto done = std::move(window.front());
+        window.pop_front();
+        window_bytes_used -= done->buffer.size();
+        if (first_error) {
+          continue;
+        }
+        lock.unlock();
+        writer.writeRecord(
+            done->record->name, done->buffer.data(), done->buffer.size());
+        lock.lock();
+      } else {
+        cv.wait(lock);
+      }
+    }
+    if (first_error) {
+      // Wait for stragglers referencing freed state, then surface the error
+      // without finalizing the (incomplete) target archive.
+      cv.wait(lock, [&] { return tasks_in_flight == 0; });
+      std::rethrow_exception(first_error);
+    }
+    lock.unlock();
+    writer.writeEndOfFile();
+  }
+}
+
+} // namespace serialize
+} // namespace caffe2
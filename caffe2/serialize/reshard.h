@@ -0,0 +1,121 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <c10/macros/Macros.h>
+
+#include "caffe2/serialize/inline_container.h"
+
+// Native checkpoint resharding.
+//
+// A distributed checkpoint stores each logical tensor flattened across a set
+// of archives (one per rank), each rank holding one or more contiguous byte
+// spans of the flattened tensor as zip records. Resharding from N source
+// ranks to M target ranks is a pure data-movement problem: intersect the
+// source and target byte spans, then copy each intersection from its source
+// record into the right position of its target record.
+//
+// Doing this tensor by tensor in Python serializes on record-sized
+// allocations and single-threaded reads. The engine below instead computes
+// the full copy plan up front and executes it with a thread pool, assembling
+// target records in a bounded streaming window so peak memory stays at
+// ReshardOptions::window_bytes regardless of checkpoint size.
+//
+// Source archives must have been produced by PyTorchStreamWriter without
+// per-record compression (the default), since partial record reads go
+// through getRecordOffset() directly against the raw file.
+
+namespace caffe2 {
+namespace serialize {
+
+// A contiguous byte span of a flattened logical tensor, stored inside one
+// zip record. `offset` positions the span within the logical tensor;
+// `record_offset` positions it within the record (non-zero when a record
+// packs several spans back to back).
+struct TORCH_API ShardChunk {
+  std::string record_name;
+  size_t archive_index = 0;
+  uint64_t offset = 0;
+  uint64_t record_offset = 0;
+  uint64_t num_bytes = 0;
+};
+
+// The layout of one logical tensor across a set of archives. Chunks must
+// tile [0, total_bytes()) exactly; validate() enforces this.
+struct TORCH_API ShardingSpec {
+  std::string tensor_name;
+  std::vector<ShardChunk> chunks;
+
+  uint64_t total_bytes() const;
+  void validate() const;
+};
+
+// One copy in a reshard plan: `num_bytes` starting at `source_offset` within
+// the source record land at `target_offset` within the target record.
+struct TORCH_API ReshardCopyOp {
+  size_t source_archive = 0;
+  std::string source_record;
+  uint64_t source_offset = 0;
+  size_t target_archive = 0;
+  std::string target_record;
+  uint64_t target_offset = 0;
+  uint64_t num_bytes = 0;
+};
+
+// A target record to materialize, with the ops that fill it. Records are
+// listed grouped by target archive, and `ops` indexes into ReshardPlan::ops.
+struct TORCH_API ReshardTargetRecord {
+  size_t archive_index = 0;
+  std::string name;
+  uint64_t num_bytes = 0;
+  std::vector<size_t> ops;
+};
+
+struct TORCH_API ReshardPlan {
+  std::vector<ReshardCopyOp> ops;
+  std::vector<ReshardTargetRecord> records;
+};
+
+// Computes the chunk intersections between the source and target layouts of
+// every tensor. Both spec lists must describe the same set of tensors with
+// matching total sizes; both are validated.
+TORCH_API ReshardPlan planReshard(
+    const std::vector<ShardingSpec>& source_specs,
+    const std::vector<ShardingSpec>& target_specs);
+
+struct TORCH_API ReshardOptions {
+  // Reader threads; 0 selects the hardware concurrency default.
+  size_t num_threads = 0;
+  // Upper bound on the bytes of target records being assembled at once.
+  // Records larger than the window are still processed, one at a time.
+  uint64_t window_bytes = 1ull << 30;
+};
+
+// Executes reshard plans against a fixed set of source archives. Reads are
+// fanned out over a thread pool (with a few independent file handles per
+// source archive, so reads into the same archive overlap); completed target
+// records are written out in order while later records are still being
+// assembled.
+class TORCH_API ReshardEngine {
+ public:
+  explicit ReshardEngine(
+      std::vector<std::string> source_paths,
+      ReshardOptions options = ReshardOptions());
+  ~ReshardEngine();
+
+  // Writes one archive per entry of `target_paths`; plan op/record
+  // archive_index values index into that vector.
+  void run(const ReshardPlan& plan, const std::vector<std::string>& target_paths);
+
+ private:
+  struct SourceArchive;
+
+  std::vector<std::unique_ptr<SourceArchive>> sources_;
+  ReshardOptions options_;
+};
+
+} // namespace serialize
+} // namespace caffe2
@@ -0,0 +1,195 @@
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <c10/util/irange.h>
+#include <c10/util/tempfile.h>
+
+#include "caffe2/serialize/inline_container.h"
+#include "caffe2/serialize/reshard.h"
+
+namespace caffe2 {
+namespace serialize {
+namespace {
+
+ShardChunk makeChunk(
+    std::string record_name,
+    size_t archive_index,
+    uint64_t offset,
+    uint64_t num_bytes,
+    uint64_t record_offset = 0) {
+  ShardChunk chunk;
+  chunk.record_name = std::move(record_name);
+  chunk.archive_index = archive_index;
+  chunk.offset = offset;
+  chunk.record_offset = record_offset;
+  chunk.num_bytes = num_bytes;
+  return chunk;
+}
+
+TEST(ReshardPlanTest, IntersectsSourceAndTargetChunks) {
+  // Four source ranks of 100 bytes each, resharded to two ranks of 200.
+  ShardingSpec source;
+  source.tensor_name = "param";
+  for (const auto rank : c10::irange(4)) {
+    source.chunks.push_back(
+        makeChunk("param/shard", rank, rank * 100, 100));
+  }
+  ShardingSpec target;
+  target.tensor_name = "param";
+  for (const auto rank : c10::irange(2)) {
+    target.chunks.push_back(
+        makeChunk("param/shard", rank, rank * 200, 200));
+  }
+
+  const auto plan = planReshard({source}, {target});
+  ASSERT_EQ(plan.records.size(), 2);
+  ASSERT_EQ(plan.ops.size(), 4);
+  for (const auto& record : plan.records) {
+    EXPECT_EQ(record.num_bytes, 200);
+    ASSERT_EQ(record.ops.size(), 2);
+  }
+  // Source rank 1's bytes [100, 200) land at [100, 200) of target rank 0.
+  const auto& op = plan.ops[plan.records[0].ops[1]];
+  EXPECT_EQ(op.source_archive, 1);
+  EXPECT_EQ(op.source_offset, 0);
+  EXPECT_EQ(op.target_archive, 0);
+  EXPECT_EQ(op.target_offset, 100);
+  EXPECT_EQ(op.num_bytes, 100);
+}
+
+TEST(ReshardPlanTest, SplitsMisalignedBoundaries) {
+  // 2 -> 3 ranks with boundaries that do not line up: every target chunk
+  // overlapping the source boundary must be fed by two copy ops.
+  ShardingSpec source;
+  source.tensor_name = "param";
+  source.chunks.push_back(makeChunk("s0", 0, 0, 90));
+  source.chunks.push_back(makeChunk("s1", 1, 90, 90));
+  ShardingSpec target;
+  target.tensor_name = "param";
+  target.chunks.push_back(makeChunk("t0", 0, 0, 60));
+  target.chunks.push_back(makeChunk("t1", 1, 60, 60));
+  target.chunks.push_back(makeChunk("t2", 2, 120, 60));
+
+  const auto plan = planReshard({source}, {target});
+  ASSERT_EQ(plan.records.size(), 3);
+  EXPECT_EQ(plan.records[0].ops.size(), 1);
+  EXPECT_EQ(plan.records[1].ops.size(), 2);
+  EXPECT_EQ(plan.records[2].ops.size(), 1);
+  const auto& head = plan.ops[plan.records[1].ops[0]];
+  EXPECT_EQ(head.source_archive, 0);
+  EXPECT_EQ(head.source_offset, 60);
+  EXPECT_EQ(head.num_bytes, 30);
+  const auto& tail = plan.ops[plan.records[1].ops[1]];
+  EXPECT_EQ(tail.source_archive, 1);
+  EXPECT_EQ(tail.source_offset, 0);
+  EXPECT_EQ(tail.target_offset, 30);
+  EXPECT_EQ(tail.num_bytes, 30);
+}
+
+TEST(ReshardPlanTest, RejectsInvalidSpecs) {
+  ShardingSpec source;
+  source.tensor_name = "param";
+  source.chunks.push_back(makeChunk("s0", 0, 0, 50));
+  source.chunks.push_back(makeChunk("s1", 1, 60, 50)); // gap at [50, 60)
+  ShardingSpec target;
+  target.tensor_name = "param";
+  target.chunks.push_back(makeChunk("t0", 0, 0, 110));
+  // NOLINTNEXTLINE(cppcoreguidelines-avoid-goto,hicpp-avoid-goto)
+  EXPECT_THROW(planReshard({source}, {target}), c10::Error);
+
+  source.chunks[1].offset = 50;
+  target.chunks[0].num_bytes = 90; // size mismatch
+  // NOLINTNEXTLINE(cppcoreguidelines-avoid-goto,hicpp-avoid-goto)
+  EXPECT_THROW(planReshard({source}, {target}), c10::Error);
+
+  target.chunks[0].num_bytes = 100;
+  target.tensor_name = "other"; // no matching source tensor
+  // NOLINTNEXTLINE(cppcoreguidelines-avoid-goto,hicpp-avoid-goto)
+  EXPECT_THROW(planReshard({source}, {target}), c10::Error);
+}
+
+TEST(ReshardEngineTest, ReshardsAcrossArchives) {
+  // 4 source ranks, two tensors per rank, resharded to 2 ranks with
+  // misaligned chunk boundaries. A small window forces the streaming path.
+  constexpr size_t kSourceRanks = 4;
+  constexpr size_t kTargetRanks = 2;
+  constexpr uint64_t kTensorABytes = 1000;
+  constexpr uint64_t kTensorBBytes = 600;
+
+  std::vector<char> tensor_a(kTensorABytes);
+  std::vector<char> tensor_b(kTensorBBytes);
+  for (const auto i : c10::irange(tensor_a.size())) {
+    tensor_a[i] = static_cast<char>(i * 7 + 1);
+  }
+  for (const auto i : c10::irange(tensor_b.size())) {
+    tensor_b[i] = static_cast<char>(i * 13 + 5);
+  }
+
+  std::vector<c10::TempFile> source_files;
+  std::vector<std::string> source_paths;
+  ShardingSpec source_a, source_b;
+  source_a.tensor_name = "a";
+  source_b.tensor_name = "b";
+  for (const auto rank : c10::irange(kSourceRanks)) {
+    source_files.push_back(c10::make_tempfile());
+    source_paths.push_back(source_files.back().name);
+    PyTorchStreamWriter writer(source_paths.back());
+    const uint64_t a_begin = rank * (kTensorABytes / kSourceRanks);
+    const uint64_t a_bytes = kTensorABytes / kSourceRanks;
+    writer.writeRecord("a/shard", tensor_a.data() + a_begin, a_bytes);
+    source_a.chunks.push_back(makeChunk("a/shard", rank, a_begin, a_bytes));
+    const uint64_t b_begin = rank * (kTensorBBytes / kSourceRanks);
+    const uint64_t b_bytes = kTensorBBytes / kSourceRanks;
+    writer.writeRecord("b/shard", tensor_b.data() + b_begin, b_bytes);
+    source_b.chunks.push_back(makeChunk("b/shard", rank, b_begin, b_bytes));
+    writer.writeEndOfFile();
+  }
+
+  ShardingSpec target_a, target_b;
+  target_a.tensor_name = "a";
+  target_b.tensor_name = "b";
+  // Deliberately uneven target split so copy ops straddle source records.
+  target_a.chunks.push_back(makeChunk("a/shard", 0, 0, 330));
+  target_a.chunks.push_back(makeChunk("a/shard", 1, 330, 670));
+  target_b.chunks.push_back(makeChunk("b/shard", 0, 0, 450));
+  target_b.chunks.push_back(makeChunk("b/shard", 1, 450, 150));
+
+  const auto plan =
+      planReshard({source_a, source_b}, {target_a, target_b});
+
+  std::vector<c10::TempFile> target_files;
+  std::vector<std::string> target_paths;
+  for (const auto rank C10_UNUSED : c10::irange(kTargetRanks)) {
+    target_files.push_back(c10::make_tempfile());
+    target_paths.push_back(target_files.back().name);
+  }
+
+  ReshardOptions options;
+  options.num_threads = 3;
+  options.window_bytes = 512;
+  ReshardEngine engine(source_paths, options);
+  engine.run(plan, target_paths);
+
+  auto check_record = [&](size_t rank,
+                          const std::string& name,
+                          const char* expected,
+                          uint64_t offset,
+                          uint64_t num_bytes) {
+    PyTorchStreamReader reader(target_paths[rank]);
+    ASSERT_EQ(reader.getRecordSize(name), num_bytes);
+    std::vector<char> actual(num_bytes);
+    reader.getRecord(name, actual.data(), num_bytes);
+    EXPECT_EQ(std::memcmp(actual.data(), expected + offset, num_bytes), 0);
+  };
+  check_record(0, "a/shard", tensor_a.data(), 0, 330);
+  check_record(1, "a/shard", tensor_a.data(), 330, 670);
+  check_record(0, "b/shard", tensor_b.data(), 0, 450);
+  check_record(1, "b/shard", tensor_b.data(), 450, 150);
+}
+
+} // namespace
+} // namespace serialize
+} // namespace caffe2
@@ -10,6 +10,8 @@
 
 #include <algorithm>
 #include <chrono>
+#include <cstdio>
+#include <fstream>
 #include <future>
 #include <iostream>
 #include <iterator>
@@ -410,6 +412,74 @@ TEST(DataTest, SavingAndLoadingRandomSamplerYieldsSameSequence) {
   }
 }
 
+TEST(DataTest, PermutedSamplerIsAPermutation) {
+  for (const size_t size : {1, 2, 5, 10, 100, 1000}) {
+    samplers::PermutedSampler sampler(size);
+    std::vector<bool> seen(size, false);
+    while (auto batch = sampler.next(7)) {
+      for (auto i : *batch) {
+        ASSERT_LT(i, size);
+        ASSERT_FALSE(seen[i]);
+        seen[i] = true;
+      }
+    }
+    for (auto was_seen : seen) {
+      ASSERT_TRUE(was_seen);
+    }
+  }
+}
+
+TEST(DataTest, PermutedSamplerReturnsLessValuesForLastBatch) {
+  samplers::PermutedSampler sampler(5);
+  ASSERT_EQ(sampler.next(3).value().size(), 3);
+  ASSERT_EQ(sampler.next(100).value().size(), 2);
+  ASSERT_FALSE(sampler.next(2).has_value());
+}
+
+TEST(DataTest, PermutedSamplerReshufflesEachEpoch) {
+  samplers::PermutedSampler sampler(100);
+  auto first_epoch = sampler.next(100).value();
+  sampler.reset();
+  ASSERT_EQ(sampler.epoch(), 1);
+  auto second_epoch = sampler.next(100).value();
+  ASSERT_NE(first_epoch, second_epoch);
+
+  // The same (seed, epoch) pair always yields the same order.
+  sampler.set_epoch(0);
+  ASSERT_EQ(sampler.next(100).value(), first_epoch);
+}
+
+TEST(DataTest, PermutedSamplerResetsWithNewSizeWell) {
+  samplers::PermutedSampler sampler(5);
+  ASSERT_EQ(sampler.next(5).value().size(), 5);
+  ASSERT_FALSE(sampler.next(2).has_value());
+  sampler.reset(7);
+  ASSERT_EQ(sampler.next(7).value().size(), 7);
+  ASSERT_FALSE(sampler.next(2).has_value());
+  sampler.reset(3);
+  ASSERT_EQ(sampler.next(3).value().size(), 3);
+  ASSERT_FALSE(sampler.next(2).has_value());
+}
+
+TEST(DataTest, SavingAndLoadingPermutedSamplerYieldsSameSequence) {
+  samplers::PermutedSampler a(10, /*seed=*/42);
+  a.reset();
+  a.next(3);
+  ASSERT_EQ(a.index(), 3);
+
+  std::stringstream stream;
+  torch::save(a, stream);
+
+  samplers::PermutedSampler b(10);
+  torch::load(b, stream);
+  ASSERT_EQ(b.index(), 3);
+  ASSERT_EQ(b.epoch(), 1);
+
+  auto b_sequence = b.next(10).value();
+  ASSERT_EQ(b_sequence.size(), 7);
+  ASSERT_EQ(a.next(10).value(), b_sequence);
+}
+
 TEST(DataTest, StreamSamplerReturnsTheBatchSizeAndThenRemainder) {
   samplers::StreamSampler sampler(/*epoch_size=*/100);
   ASSERT_EQ(sampler.next(10).value(), 10);
@@ -488,6 +558,41 @@ TEST(DataTest, StackTransformWorksForTensorExample) {
   ASSERT_TRUE(second.data.allclose(torch::eye(4).slice(/*dim=*/0, 2, 4)));
 }
 
+TEST(DataTest, PinnedStackTransformWorksForExample) {
+  struct D : public datasets::Dataset<D> {
+    Example<> get(size_t index) override {
+      return {tensor[index], 1 + tensor[index]};
+    }
+
+    torch::optional<size_t> size() const override {
+      return tensor.size(0);
+    }
+
+    torch::Tensor tensor{torch::eye(4)};
+  };
+
+  auto d = D().map(transforms::PinnedStack<Example<>>());
+
+  Example<> batch = d.get_batch({0, 1});
+  ASSERT_TRUE(batch.data.allclose(torch::eye(4).slice(/*dim=*/0, 0, 2)));
+  ASSERT_TRUE(batch.target.allclose(1 + torch::eye(4).slice(/*dim=*/0, 0, 2)));
+  if (torch::cuda::is_available()) {
+    ASSERT_TRUE(batch.data.is_pinned());
+    ASSERT_TRUE(batch.target.is_pinned());
+  }
+}
+
+TEST(DataTest, PinnedStackTransformWorksForTensorExample) {
+  auto d = datasets::TensorDataset(torch::eye(4))
+               .map(transforms::PinnedStack<TensorExample>());
+
+  TensorExample batch = d.get_batch({0, 1});
+  ASSERT_TRUE(batch.data.allclose(torch::eye(4).slice(/*dim=*/0, 0, 2)));
+  if (torch::cuda::is_available()) {
+    ASSERT_TRUE(batch.data.is_pinned());
+  }
+}
+
 // Template classes cannot be nested in functions.
 template <typename Target>
 struct T : transforms::TensorTransform<Target> {
@@ -2320,3 +2425,119 @@ TEST(DataLoaderTest, CustomPreprocessPolicy) {
     }
   }
 }
+
+TEST(DataLoaderTest, DevicePrefetcherDeliversAllBatchesInOrder) {
+  // The CPU device exercises the whole pipeline minus the stream/event
+  // machinery, which requires a device backend.
+  auto data_loader = torch::data::make_data_loader<samplers::SequentialSampler>(
+      datasets::TensorDataset(torch::arange(16, torch::kFloat32)),
+      DataLoaderOptions(4).workers(2));
+  DevicePrefetcher prefetcher(
+      *data_loader, torch::kCPU, DevicePrefetcherOptions().depth(3));
+
+  std::vector<float> seen;
+  for (auto& batch : prefetcher) {
+    for (auto& example : batch) {
+      seen.push_back(example.data.item<float>());
+    }
+  }
+  ASSERT_EQ(seen.size(), 16);
+  for (const auto i : c10::irange(seen.size())) {
+    ASSERT_EQ(seen[i], static_cast<float>(i));
+  }
+
+  // A second epoch works once the first is exhausted.
+  size_t count = 0;
+  for (auto& batch : prefetcher) {
+    count += batch.size();
+  }
+  ASSERT_EQ(count, 16);
+}
+
+TEST(DataLoaderTest, DevicePrefetcherAppliesDeviceStage) {
+  // The stage stands in for a device-side decode/resize; on CPU it runs on
+  // the transfer thread without the stream machinery.
+  auto data_loader = torch::data::make_data_loader<samplers::SequentialSampler>(
+      datasets::TensorDataset(torch::arange(8, torch::kFloat32)),
+      DataLoaderOptions(2));
+  using Batch = std::vector<datasets::TensorExample>;
+  DevicePrefetcher prefetcher(*data_loader, torch::kCPU, [](Batch batch) {
+    for (auto& example : batch) {
+      example.data = example.data * 2;
+    }
+    return batch;
+  });
+
+  std::vector<float> seen;
+  for (auto& batch : prefetcher) {
+    for (auto& example : batch) {
+      seen.push_back(example.data.item<float>());
+    }
+  }
+  ASSERT_EQ(seen.size(), 8);
+  for (const auto i : c10::irange(seen.size())) {
+    ASSERT_EQ(seen[i], static_cast<float>(2 * i));
+  }
+}
+
+TEST(DataLoaderTest, DevicePrefetcherJoinsWhenDroppedMidEpoch) {
+  auto data_loader = torch::data::make_data_loader(
+      datasets::TensorDataset(torch::arange(100, torch::kFloat32)),
+      DataLoaderOptions(1));
+  {
+    DevicePrefetcher prefetcher(*data_loader, torch::kCPU);
+    auto iterator = prefetcher.begin();
+    ASSERT_NE(iterator, prefetcher.end());
+    (void)*iterator;
+    // The destructor must join the transfer thread without deadlocking.
+  }
+}
+
+TEST(DataLoaderTest, DevicePrefetcherRejectsZeroDepth) {
+  auto data_loader = torch::data::make_data_loader(
+      datasets::TensorDataset(torch::arange(4, torch::kFloat32)),
+      DataLoaderOptions(1));
+  ASSERT_THROWS_WITH(
+      DevicePrefetcher(
+          *data_loader, torch::kCPU, DevicePrefetcherOptions().depth(0)),
+      "DevicePrefetcher `depth` must be positive");
+}
+
+TEST(DataTest, ParseNumericTextFillsPreallocatedTensor) {
+  const std::string text = "1.5,-2.25,3\n4e2 5.0e-1\t-0.125\n";
+  auto out = torch::empty({6}, torch::kFloat32);
+  const auto count = torch::data::parse_numeric_text(text, out);
+  ASSERT_EQ(count, 6);
+  auto expected =
+      torch::tensor({1.5f, -2.25f, 3.0f, 400.0f, 0.5f, -0.125f});
+  ASSERT_TRUE(out.allclose(expected));
+}
+
+TEST(DataTest, ParseNumericTextChecksCapacityAndTokens) {
+  auto tiny = torch::empty({2}, torch::kFloat32);
+  ASSERT_THROWS_WITH(
+      torch::data::parse_numeric_text("1,2,3", tiny),
+      "more values than the output tensor");
+  auto out = torch::empty({4}, torch::kFloat32);
+  ASSERT_THROWS_WITH(
+      torch::data::parse_numeric_text("1,abc,3", out),
+      "invalid numeric token");
+}
+
+TEST(DataTest, LoadNumericTextRoundTrip) {
+  const std::string path = "text_ingest_test.csv";
+  {
+    std::ofstream stream(path);
+    // Many rows so the parallel path sees multiple newline-snapped chunks.
+    for (int i = 0; i < 1000; ++i) {
+      stream << i << "," << i * 0.5 << "\n";
+    }
+  }
+  auto values = torch::data::load_numeric_text(path, torch::kFloat64);
+  ASSERT_EQ(values.numel(), 2000);
+  ASSERT_EQ(values[0].item<double>(), 0.0);
+  ASSERT_EQ(values[1].item<double>(), 0.0);
+  ASSERT_EQ(values[1998].item<double>(), 999.0);
+  ASSERT_EQ(values[1999].item<double>(), 499.5);
+  std::remove(path.c_str());
+}
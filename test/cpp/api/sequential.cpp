@@ -266,6 +266,34 @@ TEST_F(SequentialTest, ForwardReturnsTheLastValue) {
   ASSERT_EQ(y.size(1), 100);
 }
 
+TEST_F(SequentialTest, ResolvesTensorForwardChain) {
+  torch::manual_seed(0);
+  // All-Tensor chains take the pre-resolved path.
+  Sequential sequential(Linear(10, 3), Functional(torch::relu), Linear(3, 5));
+  ASSERT_TRUE(sequential->resolve_forward_chain());
+
+  auto x = torch::randn({4, 10});
+  auto y = sequential->forward(x);
+  auto expected = sequential->at<Linear>(2)->forward(
+      torch::relu(sequential->at<Linear>(0)->forward(x)));
+  ASSERT_TRUE(y.allclose(expected));
+
+  // Adding a module invalidates the resolved chain; a non-Tensor forward()
+  // makes the whole chain fall back to the generic path, which must still
+  // produce the same result.
+  struct M : torch::nn::Module {
+    torch::Tensor forward(torch::Tensor v, int64_t scale = 1) {
+      return v * scale;
+    }
+
+   protected:
+    FORWARD_HAS_DEFAULT_ARGS({1, torch::nn::AnyValue(int64_t(1))})
+  };
+  sequential->push_back(M{});
+  ASSERT_FALSE(sequential->resolve_forward_chain());
+  ASSERT_TRUE(sequential->forward(x).allclose(expected));
+}
+
 TEST_F(SequentialTest, SanityCheckForHoldingStandardModules) {
   Sequential sequential(
       Linear(10, 3),
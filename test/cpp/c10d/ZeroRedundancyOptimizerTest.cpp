@@ -0,0 +1,135 @@
+#include <thread>
+#include <vector>
+
+#include "TestUtils.hpp"
+
+#include <gtest/gtest.h>
+#include <torch/csrc/distributed/c10d/FileStore.hpp>
+#include <torch/csrc/distributed/c10d/ProcessGroupGloo.hpp>
+#include <torch/optim.h>
+#include <torch/torch.h>
+
+using namespace c10d::test;
+
+namespace {
+
+c10::intrusive_ptr<::c10d::ProcessGroupGloo> createProcessGroup(
+    const std::string& path,
+    int rank,
+    int size) {
+  auto store = c10::make_intrusive<::c10d::FileStore>(path, size);
+  auto options = ::c10d::ProcessGroupGloo::Options::create();
+  options->timeout = std::chrono::milliseconds(5000);
+  options->devices.push_back(
+      ::c10d::ProcessGroupGloo::createDeviceForHostname("127.0.0.1"));
+  return c10::make_intrusive<::c10d::ProcessGroupGloo>(
+      store, rank, size, options);
+}
+
+// Every rank runs the same deterministic "training": identical parameters
+// and per-rank gradients, stepped through the sharded wrapper; the result
+// must match a single-process Adam fed the rank-averaged gradients.
+void runShardedStep(
+    const std::string& path,
+    int rank,
+    int size,
+    int64_t bucket_bytes,
+    std::vector<torch::Tensor>& out_params) {
+  torch::manual_seed(42);
+  std::vector<torch::Tensor> params;
+  for (const auto numel : {1024, 16, 512, 256, 8}) {
+    params.push_back(torch::randn({numel}));
+  }
+
+  auto pg = createProcessGroup(path, rank, size);
+  torch::optim::ZeroRedundancyOptimizer sharded(
+      params,
+      pg,
+      [](std::vector<torch::Tensor> shard) {
+        return std::make_unique<torch::optim::Adam>(
+            std::move(shard), torch::optim::AdamOptions(1e-1));
+      },
+      torch::optim::ZeroRedundancyOptimizerOptions().bucket_bytes(
+          bucket_bytes));
+
+  // State exists only for the local shard.
+  EXPECT_LT(sharded.local_optimizer().size(), params.size());
+
+  for (const auto step : {0, 1, 2}) {
+    for (const auto i : c10::irange(params.size())) {
+      // Deterministic, rank-dependent gradients.
+      params[i].mutable_grad() =
+          torch::full_like(params[i], 0.1 * (rank + 1) * (step + 1) * (i + 1));
+    }
+    sharded.step();
+  }
+  out_params = params;
+}
+
+} // namespace
+
+TEST(ZeroRedundancyOptimizerTest, MatchesUnshardedAdam) {
+  const int size = 4;
+  TemporaryFile file;
+
+  std::vector<std::vector<torch::Tensor>> results(size);
+  std::vector<std::thread> threads;
+  for (const auto rank : c10::irange(size)) {
+    threads.emplace_back([&, rank] {
+      // A tiny bucket forces multiple buckets in flight.
+      runShardedStep(file.path, rank, size, /*bucket_bytes=*/1024, results[rank]);
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  // Reference: plain Adam over the same parameters with the rank-averaged
+  // gradients.
+  torch::manual_seed(42);
+  std::vector<torch::Tensor> ref_params;
+  for (const auto numel : {1024, 16, 512, 256, 8}) {
+    ref_params.push_back(torch::randn({numel}));
+  }
+  torch::optim::Adam reference(ref_params, torch::optim::AdamOptions(1e-1));
+  const double mean_rank_factor = (1.0 + size) / 2.0; // avg of (rank + 1)
+  for (const auto step : {0, 1, 2}) {
+    for (const auto i : c10::irange(ref_params.size())) {
+      ref_params[i].mutable_grad() = torch::full_like(
+          ref_params[i], 0.1 * mean_rank_factor * (step + 1) * (i + 1));
+    }
+    reference.step();
+  }
+
+  for (const auto rank : c10::irange(size)) {
+    ASSERT_EQ(results[rank].size(), ref_params.size());
+    for (const auto i : c10::irange(ref_params.size())) {
+      EXPECT_TRUE(torch::allclose(
+          results[rank][i], ref_params[i], /*rtol=*/1e-5, /*atol=*/1e-6))
+          << "rank " << rank << " param " << i << " diverged";
+    }
+  }
+}
+
+TEST(ZeroRedundancyOptimizerTest, RejectsInvalidArguments) {
+  const int size = 1;
+  TemporaryFile file;
+  auto pg = createProcessGroup(file.path, /*rank=*/0, size);
+  auto factory = [](std::vector<torch::Tensor> shard) {
+    return std::make_unique<torch::optim::Adam>(std::move(shard));
+  };
+
+  EXPECT_THROW(
+      torch::optim::ZeroRedundancyOptimizer({}, pg, factory), c10::Error);
+  EXPECT_THROW(
+      torch::optim::ZeroRedundancyOptimizer(
+          {torch::randn({4})},
+          pg,
+          factory,
+          torch::optim::ZeroRedundancyOptimizerOptions().bucket_bytes(0)),
+      c10::Error);
+  EXPECT_THROW(
+      torch::optim::ZeroRedundancyOptimizer(
+          {torch::randn({4}), torch::randn({4}, torch::kDouble)}, pg, factory),
+      c10::Error);
+}
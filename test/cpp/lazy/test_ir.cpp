@@ -114,6 +114,34 @@ TEST(IrTest, TsNodeTest) {
   EXPECT_TRUE(leafptr != nullptr);
 }
 
+TEST(IrTest, AsyncShapeInferenceTest) {
+  bool restore_FLAGS_torch_lazy_enable_async_shape_inference =
+      FLAGS_torch_lazy_enable_async_shape_inference;
+  FLAGS_torch_lazy_enable_async_shape_inference = true;
+
+  Shape shape(c10::kFloat, {2, 3});
+  auto make_node = [&]() {
+    return MakeNode<TsNode>(
+        OpKind::Get("lazy_test::async_shape"),
+        OpList{},
+        [shape]() { return shape; },
+        /*num_outputs*/ 1,
+        /*hash_seed*/ kHashSeed);
+  };
+
+  // First node misses the shape cache, so the shape function is deferred to
+  // the thread pool; shape() must wait for and publish its result.
+  NodePtr node = make_node();
+  EXPECT_EQ(node->shape(0), shape);
+
+  // Second node with the same shape hash is served from the shape cache.
+  NodePtr cached_node = make_node();
+  EXPECT_EQ(cached_node->shape(0), shape);
+
+  FLAGS_torch_lazy_enable_async_shape_inference =
+      restore_FLAGS_torch_lazy_enable_async_shape_inference;
+}
+
 TEST(IrTest, DimensionNodeTest) {
   const size_t DIM0 = 5;
   const size_t DIM1 = 8;
@@ -0,0 +1,82 @@
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+#include <torch/csrc/monitor/events.h>
+#include <torch/csrc/monitor/histogram.h>
+
+using namespace torch::monitor;
+
+namespace {
+class TestEventHandler : public EventHandler {
+ public:
+  void handle(const Event& e) override {
+    events.push_back(e);
+  }
+
+  std::vector<Event> events;
+};
+} // namespace
+
+TEST(MonitorTest, HistogramEmpty) {
+  Histogram h{"empty"};
+  ASSERT_EQ(h.count(), 0);
+  ASSERT_EQ(h.percentile(0.5), 0);
+  ASSERT_EQ(h.percentile(0.99), 0);
+}
+
+TEST(MonitorTest, HistogramPercentiles) {
+  Histogram h{"latency"};
+  for (int i = 0; i < 99; i++) {
+    h.record(100);
+  }
+  h.record(100000);
+
+  ASSERT_EQ(h.count(), 100);
+  // 100 lands in [64, 128), reported as the bucket upper bound
+  ASSERT_EQ(h.percentile(0.5), 127);
+  // 100000 lands in [65536, 131072)
+  ASSERT_EQ(h.percentile(0.99), 131071);
+
+  // non-positive values land in the first bucket
+  h.record(0);
+  h.record(-5);
+  ASSERT_EQ(h.count(), 102);
+  ASSERT_EQ(h.percentile(0.0), 1);
+}
+
+TEST(MonitorTest, HistogramConcurrentRecord) {
+  Histogram h{"latency"};
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; t++) {
+    threads.emplace_back([&] {
+      for (int i = 0; i < 1000; i++) {
+        h.record(1 << (i % 16));
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  ASSERT_EQ(h.count(), 4000);
+}
+
+TEST(MonitorTest, HistogramLog) {
+  auto handler = std::make_shared<TestEventHandler>();
+  registerEventHandler(handler);
+
+  Histogram h{"latency"};
+  h.record(100);
+  h.log();
+
+  ASSERT_EQ(handler->events.size(), 1);
+  const Event& e = handler->events.at(0);
+  ASSERT_EQ(e.name, "torch.monitor.Histogram");
+  ASSERT_EQ(std::get<std::string>(e.data.at("name")), "latency");
+  ASSERT_EQ(std::get<int64_t>(e.data.at("count")), 1);
+  ASSERT_EQ(std::get<int64_t>(e.data.at("p50")), 127);
+  ASSERT_EQ(std::get<int64_t>(e.data.at("p99")), 127);
+
+  unregisterEventHandler(handler);
+}
@@ -0,0 +1,51 @@
+#include <gtest/gtest.h>
+
+#include <ATen/record_function.h>
+#include <torch/csrc/profiler/standalone/op_duration_sampler.h>
+
+using namespace torch::profiler::impl;
+
+TEST(OpDurationSamplerTest, CollectsHistogram) {
+  clearOpDurationStats();
+  enableOpDurationSampler(/*sampling_probability=*/1.0);
+  ASSERT_TRUE(opDurationSamplerEnabled());
+
+  constexpr uint64_t kCalls = 32;
+  for (uint64_t i = 0; i < kCalls; ++i) {
+    RECORD_FUNCTION("op_duration_sampler_test_op", {});
+  }
+
+  disableOpDurationSampler();
+  ASSERT_FALSE(opDurationSamplerEnabled());
+
+  auto stats = getOpDurationStats();
+  auto it = stats.find("op_duration_sampler_test_op");
+  ASSERT_NE(it, stats.end());
+  EXPECT_EQ(it->second.calls, kCalls);
+
+  // Every sampled call lands in exactly one bucket.
+  uint64_t bucket_total = 0;
+  for (const auto count : it->second.buckets) {
+    bucket_total += count;
+  }
+  EXPECT_EQ(bucket_total, kCalls);
+}
+
+TEST(OpDurationSamplerTest, DisableStopsSamplingAndClearDrops) {
+  clearOpDurationStats();
+  enableOpDurationSampler(/*sampling_probability=*/1.0);
+  {
+    RECORD_FUNCTION("op_duration_sampler_disabled_op", {});
+  }
+  disableOpDurationSampler();
+
+  // Calls after disable are not recorded.
+  {
+    RECORD_FUNCTION("op_duration_sampler_disabled_op", {});
+  }
+  EXPECT_EQ(
+      getOpDurationStats().at("op_duration_sampler_disabled_op").calls, 1);
+
+  clearOpDurationStats();
+  EXPECT_TRUE(getOpDurationStats().empty());
+}
@@ -0,0 +1,104 @@
+#include <gtest/gtest.h>
+
+#include <torch/csrc/profiler/standalone/trace_diff.h>
+
+using namespace torch::profiler::impl;
+
+namespace {
+
+TraceOpSamples makeSamples(
+    const std::string& name,
+    const std::vector<std::string>& frames,
+    std::vector<double> durations_us) {
+  TraceOpSamples samples;
+  samples.name = name;
+  samples.call_path_hash = callPathHash(name, frames);
+  samples.durations_us = std::move(durations_us);
+  return samples;
+}
+
+} // namespace
+
+TEST(TraceDiffTest, CallPathHashIsStableAndFrameSensitive) {
+  const std::vector<std::string> frames = {"model.py(12): forward", "aten::mm"};
+  EXPECT_EQ(callPathHash("aten::mm", frames), callPathHash("aten::mm", frames));
+  EXPECT_NE(callPathHash("aten::mm", frames), callPathHash("aten::bmm", frames));
+  EXPECT_NE(callPathHash("aten::mm", frames), callPathHash("aten::mm", {}));
+  // Frame boundaries matter: {"ab", "c"} must not collide with {"a", "bc"}.
+  EXPECT_NE(
+      callPathHash("op", {"ab", "c"}), callPathHash("op", {"a", "bc"}));
+}
+
+TEST(TraceDiffTest, DetectsRegressionWithSignificance) {
+  std::vector<double> base_durations;
+  std::vector<double> cand_durations;
+  for (int i = 0; i < 50; ++i) {
+    // Tight distributions around 100us and 150us; the 50us shift dwarfs
+    // the +/-1us jitter, so the t-test must flag it.
+    base_durations.push_back(100.0 + (i % 3) - 1);
+    cand_durations.push_back(150.0 + (i % 3) - 1);
+  }
+  const std::vector<std::string> frames = {"model.py(7): forward"};
+  auto report = diffTraces(
+      {makeSamples("aten::mm", frames, base_durations)},
+      {makeSamples("aten::mm", frames, cand_durations)});
+
+  ASSERT_EQ(report.deltas.size(), 1u);
+  const auto& delta = report.deltas[0];
+  EXPECT_EQ(delta.name, "aten::mm");
+  EXPECT_EQ(delta.baseline_count, 50u);
+  EXPECT_EQ(delta.candidate_count, 50u);
+  EXPECT_NEAR(delta.delta_us, 50.0, 1.0);
+  EXPECT_NEAR(delta.delta_pct, 50.0, 2.0);
+  EXPECT_LT(delta.p_value, 1e-6);
+  EXPECT_TRUE(delta.significant);
+}
+
+TEST(TraceDiffTest, IdenticalSamplesAreNotSignificant) {
+  const std::vector<double> durations(20, 42.0);
+  auto report = diffTraces(
+      {makeSamples("aten::relu", {}, durations)},
+      {makeSamples("aten::relu", {}, durations)});
+  ASSERT_EQ(report.deltas.size(), 1u);
+  EXPECT_DOUBLE_EQ(report.deltas[0].delta_us, 0.0);
+  EXPECT_DOUBLE_EQ(report.deltas[0].p_value, 1.0);
+  EXPECT_FALSE(report.deltas[0].significant);
+}
+
+TEST(TraceDiffTest, SingleSampleSkipsTest) {
+  auto report = diffTraces(
+      {makeSamples("aten::add", {}, {10.0})},
+      {makeSamples("aten::add", {}, {20.0})});
+  ASSERT_EQ(report.deltas.size(), 1u);
+  EXPECT_DOUBLE_EQ(report.deltas[0].delta_us, 10.0);
+  EXPECT_DOUBLE_EQ(report.deltas[0].p_value, 1.0);
+  EXPECT_FALSE(report.deltas[0].significant);
+}
+
+TEST(TraceDiffTest, UnmatchedOpsAreReportedSeparately) {
+  auto report = diffTraces(
+      {makeSamples("aten::old_op", {}, {1.0, 2.0}),
+       makeSamples("aten::both", {}, {1.0, 2.0})},
+      {makeSamples("aten::new_op", {}, {3.0, 4.0}),
+       makeSamples("aten::both", {}, {1.0, 2.0})});
+  ASSERT_EQ(report.deltas.size(), 1u);
+  EXPECT_EQ(report.deltas[0].name, "aten::both");
+  ASSERT_EQ(report.baseline_only.size(), 1u);
+  EXPECT_EQ(report.baseline_only[0].name, "aten::old_op");
+  ASSERT_EQ(report.candidate_only.size(), 1u);
+  EXPECT_EQ(report.candidate_only[0].name, "aten::new_op");
+}
+
+TEST(TraceDiffTest, MergesDuplicateCallPathsAndRenders) {
+  auto report = diffTraces(
+      {makeSamples("aten::mm", {}, {1.0, 2.0}),
+       makeSamples("aten::mm", {}, {3.0})},
+      {makeSamples("aten::mm", {}, {1.0, 2.0, 3.0})});
+  ASSERT_EQ(report.deltas.size(), 1u);
+  EXPECT_EQ(report.deltas[0].baseline_count, 3u);
+  EXPECT_EQ(report.deltas[0].candidate_count, 3u);
+
+  const std::string rendered = renderTraceDiffReport(report);
+  EXPECT_NE(rendered.find("aten::mm"), std::string::npos);
+  EXPECT_NE(rendered.find("p-value"), std::string::npos);
+}
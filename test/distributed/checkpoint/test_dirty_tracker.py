@@ -0,0 +1,78 @@
+# Owner(s): ["oncall: distributed"]
+
+import torch
+
+from torch.distributed.checkpoint._dirty_tracker import StorageDirtyTracker
+from torch.testing._internal.common_utils import run_tests, TestCase
+
+
+class TestStorageDirtyTracker(TestCase):
+    def test_everything_dirty_on_first_call(self) -> None:
+        tracker = StorageDirtyTracker()
+        state_dict = {
+            "state": {"0": {"exp_avg": torch.zeros(4), "step": 3}},
+            "param_groups": [{"lr": 0.1}],
+        }
+        dirty = tracker.dirty_paths(state_dict)
+        self.assertEqual(dirty, {("state", "0", "exp_avg")})
+
+    def test_inplace_write_marks_dirty(self) -> None:
+        tracker = StorageDirtyTracker()
+        a = torch.zeros(4)
+        b = torch.zeros(4)
+        state_dict = {"a": a, "b": b}
+        tracker.dirty_paths(state_dict)
+
+        a.add_(1)
+        dirty = tracker.dirty_paths(state_dict)
+        self.assertEqual(dirty, {("a",)})
+
+        # A quiescent step leaves everything clean.
+        self.assertEqual(tracker.dirty_paths(state_dict), set())
+
+    def test_write_through_view_marks_dirty(self) -> None:
+        tracker = StorageDirtyTracker()
+        a = torch.zeros(4, 4)
+        tracker.dirty_paths({"a": a})
+
+        a[0].fill_(1)
+        self.assertEqual(tracker.dirty_paths({"a": a}), {("a",)})
+
+    def test_storage_swap_marks_dirty(self) -> None:
+        tracker = StorageDirtyTracker()
+        state_dict = {"a": torch.zeros(4)}
+        tracker.dirty_paths(state_dict)
+
+        # Fresh tensor object with a fresh storage but identical version.
+        state_dict["a"] = torch.zeros(4)
+        self.assertEqual(tracker.dirty_paths(state_dict), {("a",)})
+
+    def test_removed_entries_are_forgotten(self) -> None:
+        tracker = StorageDirtyTracker()
+        a = torch.zeros(4)
+        tracker.dirty_paths({"a": a, "b": torch.zeros(2)})
+
+        # "b" disappears; re-adding it later counts as new (dirty).
+        self.assertEqual(tracker.dirty_paths({"a": a}), set())
+        b = torch.zeros(2)
+        self.assertEqual(tracker.dirty_paths({"a": a, "b": b}), {("b",)})
+
+    def test_optimizer_state(self) -> None:
+        model = torch.nn.Linear(8, 4)
+        optim = torch.optim.AdamW(model.parameters())
+        model(torch.randn(2, 8)).sum().backward()
+        optim.step()
+
+        tracker = StorageDirtyTracker()
+        tracker.dirty_paths(optim.state_dict())
+        # No step: nothing to re-serialize.
+        self.assertEqual(tracker.dirty_paths(optim.state_dict()), set())
+
+        model(torch.randn(2, 8)).sum().backward()
+        optim.step()
+        dirty = tracker.dirty_paths(optim.state_dict())
+        self.assertTrue(any(path[-1] == "exp_avg" for path in dirty))
+
+
+if __name__ == "__main__":
+    run_tests()
@@ -243,6 +243,25 @@ class ProcessGroupGlooTest(MultiProcessTestCase):
         for fut in [pg.allreduce(torch.ones(i + 1)).get_future() for i in range(4)]:
             fut.wait()
 
+    @requires_gloo()
+    def test_multi_device_striped_allreduce(self):
+        store = c10d.FileStore(self.file_name, self.world_size)
+        opts = c10d.ProcessGroupGloo._Options()
+        opts._timeout = 50.0
+        opts._devices = [
+            create_device(interface=LOOPBACK),
+            create_device(interface=LOOPBACK),
+        ]
+        pg = self._create_process_group_gloo(store, self.rank, self.world_size, opts)
+
+        # Large contiguous tensors are striped across both devices; make the
+        # length odd so the stripes are unequal.
+        x = torch.full((1024 * 1024 + 1,), float(self.rank + 1))
+        fut = pg.allreduce(x).get_future()
+        fut.wait()
+        expected = sum(float(i + 1) for i in range(self.world_size))
+        self.assertEqual(torch.full_like(x, expected), fut.value()[0])
+
     @requires_gloo()
     def test_empty_tensors(self):
         store = c10d.FileStore(self.file_name, self.world_size)
@@ -657,6 +676,14 @@ class ProcessGroupGlooTest(MultiProcessTestCase):
     def test_sparse_allreduce_basics(self):
         self._test_sparse_allreduce_basics(lambda t: t)
 
+    @requires_gloo()
+    def test_sparse_allreduce_index_union(self):
+        os.environ["TORCH_GLOO_SPARSE_ALLREDUCE_UNION"] = "1"
+        try:
+            self._test_sparse_allreduce_basics(lambda t: t)
+        finally:
+            del os.environ["TORCH_GLOO_SPARSE_ALLREDUCE_UNION"]
+
     @skip_if_lt_x_gpu(2)
     @requires_gloo()
     def test_sparse_allreduce_basics_cuda(self):
@@ -624,6 +624,30 @@ class ProcessGroupNCCLGroupTest(MultiProcessTestCase):
         self.assertEqual(backend.comm_split_count(), 1)
         self.assertEqual(tensor, original_tensor)
 
+    @requires_nccl_version((2, 18), "Need NCCL 2.18+ for ncclCommSplit")
+    @skip_but_pass_in_sandcastle_if(not TEST_MULTIGPU, "NCCL test requires 2+ GPUs")
+    def test_eager_connect_all_groups(self):
+        # Test batch-initializing the communicators of declared subgroups
+        # before any collective runs on them.
+        store = c10d.FileStore(self.file_name, self.world_size)
+        device = torch.device(f"cuda:{self.rank}")
+        pg = self._create_process_group_nccl(store, self.opts())
+        backend = pg._get_backend(device)
+
+        ng = c10d.new_group()
+        # Nothing is initialized until the batch connect.
+        self.assertEqual(backend.comm_split_count(), 0)
+
+        c10d.distributed_c10d._eager_connect_all_groups(device)
+        # The default communicator is live and the subgroup was split off it.
+        self.assertEqual(backend.comm_split_count(), 1)
+
+        # The first collectives find live communicators: no further splits.
+        tensor = torch.tensor([self.rank]).cuda(device)
+        pg.broadcast(tensor, 0)
+        ng.broadcast(tensor, 0)
+        self.assertEqual(backend.comm_split_count(), 1)
+
     @requires_nccl_version((2, 18), "Need NCCL 2.18+ for ncclCommSplit")
     @skip_but_pass_in_sandcastle_if(not TEST_MULTIGPU, "NCCL test requires 2+ GPUs")
     def test_non_blocking_init(self):
@@ -1768,15 +1792,21 @@ class DistributedDataParallelTest(
 
     def _test_builtin_ddp_comm_hooks_nccl(self, gradient_as_bucket_view=False):
         """
-        This unit test verifies whether built-in C++ DDP communication hooks ALLREDUCE and FP16_COMPRESS
-        can give the same result with the case of no hook registered.
+        This unit test verifies whether built-in C++ DDP communication hooks ALLREDUCE, FP16_COMPRESS
+        and POWER_SGD can give the same result with the case of no hook registered.
         """
         process_group = self._get_process_group()
 
-        for comm_hook_type in [
+        # POWER_SGD is exercised in its warm-up phase here, where it runs
+        # vanilla allreduce, so the grads must match exactly.
+        hook_types = [
             dist.BuiltinCommHookType.ALLREDUCE,
             dist.BuiltinCommHookType.FP16_COMPRESS,
-        ]:
+            dist.BuiltinCommHookType.POWER_SGD,
+        ]
+        if BFLOAT16_AVAILABLE:
+            hook_types.append(dist.BuiltinCommHookType.BF16_COMPRESS)
+        for comm_hook_type in hook_types:
             # Get GPU model with the built-in communication hook.
             gpu_model = self._gpu_model_with_builtin_ddp_comm_hook(
                 process_group, comm_hook_type, gradient_as_bucket_view
@@ -2636,6 +2666,43 @@ class CommTest(test_c10d_common.AbstractCommTest, MultiProcessTestCase):
                 ),
             )
 
+    @requires_nccl()
+    @skip_if_lt_x_gpu(2)
+    def test_all_reduce_auto_coalesce_nccl(self):
+        # TORCH_NCCL_AUTO_COALESCE_MAX_OPS is read at process group creation
+        os.environ["TORCH_NCCL_AUTO_COALESCE_MAX_OPS"] = "4"
+        try:
+            store = c10d.FileStore(self.file_name, self.world_size)
+            c10d.init_process_group(
+                backend="nccl", store=store, rank=self.rank, world_size=self.world_size
+            )
+            process_group = c10d.distributed_c10d._get_default_group()
+            device = torch.device("cuda:%d" % self.rank)
+            tensors = [
+                torch.full(
+                    (60 + i,), self.rank + 1 + i, device=device, dtype=torch.float
+                )
+                for i in range(10)
+            ]
+            works = [
+                torch.distributed.all_reduce(
+                    tensor, group=process_group, async_op=True
+                )
+                for tensor in tensors
+            ]
+            # wait() on a work whose implicit batch is still open must flush it
+            for work in works:
+                work.wait()
+            for i, t in enumerate(tensors):
+                self.assertEqual(
+                    t,
+                    torch.full_like(
+                        t, self.world_size * (i + (self.world_size + 1.0) / 2.0)
+                    ),
+                )
+        finally:
+            del os.environ["TORCH_NCCL_AUTO_COALESCE_MAX_OPS"]
+
     @requires_nccl()
     @skip_if_lt_x_gpu(2)
     @skip_if_rocm
@@ -2954,6 +3021,42 @@ class CompilerTest(test_c10d_common.CompilerTest):
         dist.reduce_scatter_tensor(output_tensor, input_tensors)
         self.assertEqual(output_tensor, input_tensors[self.rank] * self.world_size)
 
+    @requires_nccl()
+    @skip_if_lt_x_gpu(2)
+    def test_all_to_all_segmented(self):
+        # With TORCH_NCCL_ALLTOALL_SEGMENTED, all_to_all accepts strided views
+        # (e.g. transposed block layouts from MoE token dispatch) without
+        # requiring a contiguous copy on either side.
+        os.environ["TORCH_NCCL_ALLTOALL_SEGMENTED"] = "1"
+        try:
+            store = dist.FileStore(self.file_name, self.world_size)
+            dist.init_process_group(
+                "nccl",
+                world_size=self.world_size,
+                rank=self.rank,
+                store=store,
+            )
+            src = torch.arange(
+                2 * self.world_size * 3, dtype=torch.float, device=self.rank
+            ).reshape(2, self.world_size, 3) + 100 * self.rank
+            dst = torch.empty(
+                2, self.world_size, 3, dtype=torch.float, device=self.rank
+            )
+            # Per-rank blocks as strided views along the middle dimension.
+            input_tensor_list = [src[:, r] for r in range(self.world_size)]
+            output_tensor_list = [dst[:, r] for r in range(self.world_size)]
+            dist.all_to_all(output_tensor_list, input_tensor_list)
+            for r in range(self.world_size):
+                expected = (
+                    torch.arange(
+                        2 * self.world_size * 3, dtype=torch.float, device=self.rank
+                    ).reshape(2, self.world_size, 3)[:, self.rank]
+                    + 100 * r
+                )
+                self.assertEqual(output_tensor_list[r], expected)
+        finally:
+            del os.environ["TORCH_NCCL_ALLTOALL_SEGMENTED"]
+
     @requires_nccl()
     @skip_if_lt_x_gpu(2)
     def test_reduce_scatter_tensor_coalesced(self):
@@ -524,6 +524,24 @@ class LibUvTCPStoreTest(TCPStoreTest):
             )
 
 
+@skip_if_win32()
+class LibUvTCPStoreUdsTest(LibUvTCPStoreTest):
+    """
+    Re-runs the libuv TCPStore tests with the same-host Unix domain socket
+    fast path enabled (TORCH_TCPSTORE_USE_UDS). The wire protocol is shared
+    between the transports, so the whole suite must pass unchanged; clients
+    fall back to TCP whenever the Unix domain socket cannot be reached.
+    """
+
+    def setUp(self):
+        os.environ["TORCH_TCPSTORE_USE_UDS"] = "1"
+        super().setUp()
+
+    def tearDown(self):
+        super().tearDown()
+        del os.environ["TORCH_TCPSTORE_USE_UDS"]
+
+
 class PrefixTCPStoreTest(TestCase, StoreTestBase):
     def setUp(self):
         super().setUp()
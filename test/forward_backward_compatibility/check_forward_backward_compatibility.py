@@ -143,6 +143,9 @@ ALLOW_LIST = [
     ("onednn::qconv2d_pointwise.binary", datetime.date(2024, 12, 31)),
     ("aten::_scaled_mm.out", datetime.date(2024, 12, 31)),
     ("aten::_scaled_mm", datetime.date(2024, 12, 31)),
+    # enable_gqa was added to the signature
+    ("aten::scaled_dot_product_attention", datetime.date(2024, 12, 31)),
+    ("aten::_fused_sdp_choice", datetime.date(2024, 12, 31)),
     # BC-breaking change in can_cast signature: 'from' -> 'from_'
     ("aten::can_cast", datetime.date(2024, 5, 31)),
 ]
@@ -737,6 +737,30 @@ class TestVmapAPI(TestCase):
         with self.assertRaisesRegex(RuntimeError, msg):
             vmap(op)(x, x)
 
+    def test_fallback_stats(self):
+        op = torch._test_functorch_fallback
+        x = torch.randn(5, 7, 11)
+        y = torch.randn(5, 7, 11)
+
+        # stats are off by default
+        torch._C._functorch._reset_vmap_fallback_stats()
+        vmap(op)(x, y)
+        self.assertEqual(torch._C._functorch._vmap_fallback_stats(), [])
+
+        torch._C._functorch._set_vmap_fallback_stats_enabled(True)
+        try:
+            vmap(op)(x, y)
+            vmap(op)(x, y)
+            stats = torch._C._functorch._vmap_fallback_stats()
+            self.assertEqual(len(stats), 1)
+            op_name, calls, total_ns = stats[0]
+            self.assertIn("_test_functorch_fallback", op_name)
+            self.assertEqual(calls, 2)
+            self.assertGreater(total_ns, 0)
+        finally:
+            torch._C._functorch._set_vmap_fallback_stats_enabled(False)
+            torch._C._functorch._reset_vmap_fallback_stats()
+
     def test_fallback_warning(self):
         # We use a dummy function _test_functorch_fallback
         # defined in prim_native_functions.cpp for this
@@ -729,6 +729,40 @@ main()
         # TODO(jansel): we should be able to get this count to 1
         self.check_output_and_recompiles(fn, count=2)
 
+    def test_dynamic_shapes_symbolic_capture(self):
+        # With dynamic=True, all sizes are captured symbolically up front, so
+        # changing batch sizes reuse a single compiled backward.
+        def fn():
+            model = torch.nn.Sequential(
+                torch.nn.Linear(4, 4),
+                torch.nn.ReLU(),
+                torch.nn.Linear(4, 4),
+                torch.nn.ReLU(),
+            )
+            opt_model = torch.compile(model, dynamic=True)
+
+            for b in range(10, 100, 10):
+                x = torch.randn([b, 4])
+                result = opt_model(x).sum()
+                result.backward()
+                yield model[0].weight.grad
+                yield model[0].bias.grad
+                yield model[2].weight.grad
+                yield model[2].bias.grad
+                model.zero_grad()
+
+        with torch.autograd.set_multithreading_enabled(False):
+            torch._dynamo.reset()
+            counters["compiled_autograd"].clear()
+            torch.manual_seed(123)
+            expected = list(fn())
+            torch.manual_seed(123)
+            with compiled_autograd.enable(compiler_fn, dynamic=True):
+                actual = list(fn())
+            self.assertEqual(expected, actual)
+            self.assertEqual(counters["compiled_autograd"]["captures"], 1)
+            self.assertEqual(counters["compiled_autograd"]["compiles"], 1)
+
     def test_accumulate_without_zero(self):
         def fn():
             model = torch.nn.Sequential(
@@ -13,6 +13,7 @@ import random
 import re
 import subprocess
 import sys
+import tempfile
 import threading
 import time
 import typing
@@ -905,6 +906,61 @@ class CommonTemplate:
 
         self.assertTrue(kernel_lib_path in kernel_libs_abs_path)
 
+    @skipCUDAIf(not SM80OrLater, "Requires sm80")
+    def test_eager_aoti_package_warm_start(self):
+        from torch._inductor.utils import (
+            load_aoti_eager_package,
+            package_aoti_eager_cache,
+        )
+
+        ns = "aten"
+        op_name = "abs"
+
+        device = "cpu"
+        if self.device.lower() == "cuda":
+            device = "cuda"
+
+        input_tensor = torch.randn(128, dtype=torch.float, device=device)
+        kernel_lib_path = aoti_compile_with_persistent_cache(
+            ns,
+            op_name,
+            input_tensor.device.type,
+            False,
+            getattr(torch.ops.aten, op_name),
+            args=(input_tensor,),
+            kwargs={},
+        )
+        self.assertTrue(len(kernel_lib_path) > 0)
+
+        with tempfile.TemporaryDirectory() as tmp_dir:
+            package_path = package_aoti_eager_cache(
+                os.path.join(tmp_dir, "aoti_eager_pkg.zip"), ns, device
+            )
+            self.assertTrue(len(package_path) > 0)
+            self.assertTrue(Path(package_path).exists())
+
+            # Install the package into an empty cache dir of a "fresh"
+            # process and check the kernels are served from it.
+            fresh_cache_dir = os.path.join(tmp_dir, "fresh_cache")
+            with unittest.mock.patch.dict(
+                os.environ, {"TORCHINDUCTOR_CACHE_DIR": fresh_cache_dir}
+            ):
+                self.assertEqual(
+                    load_aoti_eager_cache(ns, op_name, input_tensor.device.type),
+                    [],
+                )
+                num_installed = load_aoti_eager_package(package_path)
+                self.assertTrue(num_installed > 0)
+                # installing the same package again is a no-op
+                self.assertEqual(load_aoti_eager_package(package_path), 0)
+
+                json_data = load_aoti_eager_cache(
+                    ns, op_name, input_tensor.device.type
+                )
+                self.assertTrue(len(json_data) > 0)
+                for item in json_data:
+                    self.assertTrue(Path(item["kernel_path"]).exists())
+
     @skipCUDAIf(not SM80OrLater, "Requires sm80")
     def test_eager_aoti_with_scalar(self):
         namespace_name = "aten"
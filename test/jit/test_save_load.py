@@ -515,6 +515,49 @@ class TestSaveLoad(JitTestCase):
             self.assertEqual(m_name, loaded_name)
             self.assertEqual(m_buffer, loaded_buffer)
 
+    def test_load_dedups_tensor_storages(self):
+        """
+        Check that with TORCH_JIT_DEDUP_LOADED_TENSORS set, loading the same
+        weights twice shares a single copy-on-write storage, and that an
+        in-place write to one loaded copy does not leak into the other.
+        """
+
+        class TestModule(torch.nn.Module):
+            def __init__(self):
+                super().__init__()
+                self.weight = torch.nn.Parameter(torch.randn(8, 8))
+
+            def forward(self, x):
+                return x + self.weight
+
+        buffer = io.BytesIO()
+        torch.jit.save(torch.jit.script(TestModule()), buffer)
+
+        os.environ["TORCH_JIT_DEDUP_LOADED_TENSORS"] = "1"
+        try:
+            buffer.seek(0)
+            m1 = torch.jit.load(buffer)
+            buffer.seek(0)
+            m2 = torch.jit.load(buffer)
+        finally:
+            del os.environ["TORCH_JIT_DEDUP_LOADED_TENSORS"]
+
+        # The second load matches the first load's storage; both sides become
+        # copy-on-write clones of one allocation.
+        self.assertTrue(torch._C._is_cow_tensor(m1.weight))
+        self.assertTrue(torch._C._is_cow_tensor(m2.weight))
+        self.assertEqual(
+            torch._C._data_address(m1.weight), torch._C._data_address(m2.weight)
+        )
+
+        # An in-place write materializes a private copy instead of leaking
+        # into the other module.
+        expected = m1.weight.detach().clone()
+        with torch.no_grad():
+            m2.weight.add_(1)
+        self.assertEqual(m1.weight, expected)
+        self.assertEqual(m2.weight, expected + 1)
+
     def test_save_load_meta_tensors(self):
         """
         Check that parameters, buffers, and submodules are the same after loading
@@ -3605,6 +3605,64 @@ class TestConvolutionNNDeviceType(NNTestCase):
                     weight_format=weight_format,
                 )
 
+    @onlyCPU
+    def test_conv2d_direct_nhwc(self, device):
+        # Batch-1 channels-last inference with small spatial outputs goes
+        # through the direct NHWC kernel; see Note [Direct NHWC convolution]
+        # in aten/src/ATen/native/cpu/DirectConv2dKernel.cpp.
+        def select(x, weight, bias, stride, padding):
+            return torch._C._select_conv_backend(
+                x, weight, bias, stride, padding, (1, 1), False, (0, 0), 1
+            )
+
+        def helper(c, out_channels, h, w, kernel_size, stride, padding, has_bias):
+            x = torch.randn(1, c, h, w, device=device).to(
+                memory_format=torch.channels_last
+            )
+            weight = torch.randn(
+                out_channels, c, kernel_size, kernel_size, device=device
+            ).to(memory_format=torch.channels_last)
+            bias = torch.randn(out_channels, device=device) if has_bias else None
+            self.assertEqual(
+                select(x, weight, bias, (stride, stride), (padding, padding)),
+                torch._C._ConvBackend.DirectNhwc2d,
+            )
+            out = F.conv2d(x, weight, bias, stride, padding)
+            ref = F.conv2d(x.contiguous(), weight.contiguous(), bias, stride, padding)
+            self.assertTrue(out.is_contiguous(memory_format=torch.channels_last))
+            self.assertEqual(out, ref, atol=1e-4, rtol=1e-4)
+
+        # Channel counts straddle the vector width to exercise the scalar
+        # tails; the kernel/stride/padding combinations cover the gate.
+        for c, out_channels in [(8, 16), (21, 19), (64, 3), (3, 64)]:
+            for kernel_size, stride, padding in [
+                (1, 1, 0),
+                (3, 1, 1),
+                (3, 2, 1),
+                (5, 1, 2),
+                (7, 2, 3),
+            ]:
+                for has_bias in [True, False]:
+                    helper(c, out_channels, 7, 7, kernel_size, stride, padding, has_bias)
+        # Non-square input.
+        helper(32, 48, 5, 8, 3, 1, 1, True)
+
+        # Shapes outside the gate keep their existing backends.
+        direct = torch._C._ConvBackend.DirectNhwc2d
+        weight = torch.randn(16, 8, 3, 3).to(memory_format=torch.channels_last)
+        batched = torch.randn(2, 8, 7, 7).to(memory_format=torch.channels_last)
+        self.assertNotEqual(select(batched, weight, None, (1, 1), (1, 1)), direct)
+        large = torch.randn(1, 8, 56, 56).to(memory_format=torch.channels_last)
+        self.assertNotEqual(select(large, weight, None, (1, 1), (1, 1)), direct)
+        contig = torch.randn(1, 8, 7, 7)
+        self.assertNotEqual(
+            select(contig, weight.contiguous(), None, (1, 1), (1, 1)), direct
+        )
+        training = torch.randn(1, 8, 7, 7, requires_grad=True).to(
+            memory_format=torch.channels_last
+        )
+        self.assertNotEqual(select(training, weight, None, (1, 1), (1, 1)), direct)
+
     @onlyCUDA
     @skipCUDAIfRocmVersionLessThan((4, 3))
     @skipCUDAIfNotMiopenSuggestNHWC
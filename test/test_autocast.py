@@ -253,6 +253,47 @@ class TestAutocastCPU(TestCase):
                 cpu_autocast_output = getattr(torch, op)(*args, **maybe_kwargs)
             self.assertEqual(generic_autocast_output, cpu_autocast_output)
 
+    def test_autocast_persistent_cast_cache(self):
+        data = torch.randn(2, 3)
+        weight = torch.randn(3, 4)
+
+        class BF16CastCounterMode(TorchDispatchMode):
+            def __init__(self, weight):
+                super().__init__()
+                self.dtype_cast_counter = 0
+                self.weight = weight
+
+            def __torch_dispatch__(self, func, types, args=(), kwargs=None):
+                if (
+                    func is torch.ops.aten._to_copy.default
+                    and args[0] is self.weight
+                    and kwargs["dtype"] is torch.bfloat16
+                ):
+                    self.dtype_cast_counter += 1
+                return func(*args, **kwargs)
+
+        try:
+            torch._C._set_autocast_persistent_cache_enabled(True)
+            self.assertTrue(torch._C._is_autocast_persistent_cache_enabled())
+            with BF16CastCounterMode(weight) as mode:
+                # The persistent cache survives autocast scope exits, so the
+                # weight is cast only once across separate scopes.
+                for _ in range(3):
+                    with torch.amp.autocast(device_type="cpu"):
+                        torch.mm(data, weight)
+                self.assertEqual(mode.dtype_cast_counter, 1)
+
+                # An inplace mutation bumps the version counter and forces a
+                # single re-cast.
+                weight.mul_(2)
+                for _ in range(2):
+                    with torch.amp.autocast(device_type="cpu"):
+                        torch.mm(data, weight)
+                self.assertEqual(mode.dtype_cast_counter, 2)
+        finally:
+            torch._C._set_autocast_persistent_cache_enabled(False)
+        self.assertFalse(torch._C._is_autocast_persistent_cache_enabled())
+
     def test_cpu_autocast_deprecated_warning(self):
         with self.assertWarnsRegex(
             FutureWarning,
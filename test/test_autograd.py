@@ -1304,6 +1304,35 @@ class TestAutograd(TestCase):
         # because they are executed after
         self.assertEqual(b.grad.item(), 3)
 
+    def test_graph_topology_cache(self):
+        # The cache is enabled via an env var read once at startup, so run
+        # the check in a subprocess.
+        script = """\
+import torch
+
+x = torch.randn(7, 5, requires_grad=True)
+w = torch.randn(5, 3, requires_grad=True)
+
+# Same retained graph backward-ed repeatedly: hits the topology cache
+# after the first call.
+loss = (x @ w).sin().sum()
+for _ in range(3):
+    loss.backward(retain_graph=True)
+assert torch.allclose(x.grad, 3 * torch.cos(x @ w) @ w.t())
+
+# Rebuilding the graph every step must miss the cache and stay correct.
+x.grad = None
+for _ in range(2):
+    (x @ w).sin().sum().backward()
+assert torch.allclose(x.grad, 2 * torch.cos(x @ w) @ w.t())
+"""
+        env = os.environ.copy()
+        env["TORCH_AUTOGRAD_CACHE_GRAPH_TOPOLOGY"] = "1"
+        p = subprocess.run(
+            [sys.executable, "-c", script], env=env, capture_output=True
+        )
+        self.assertEqual(p.returncode, 0, msg=p.stderr.decode())
+
     def test_retains_grad_can_always_observe_tensor_prehook(self):
         def tensor_prehook(g):
             return g * 2
@@ -9557,6 +9586,95 @@ for shape in [(1,), ()]:
                 )
                 test(lambda: x, cuda, pin_memory)
 
+    def test_graph_save_on_cpu_async(self):
+        # On CPU inputs the native hook keeps a plain reference, so this
+        # exercises the flag plumbing and hook precedence rather than the
+        # offload itself (covered by test_graph_save_on_cpu_async_cuda).
+        self.assertFalse(torch._C._autograd._saved_tensors_get_offload_to_cpu())
+        with torch.autograd.graph.save_on_cpu_async():
+            self.assertTrue(torch._C._autograd._saved_tensors_get_offload_to_cpu())
+            a = torch.randn(5, requires_grad=True)
+            y = (a * a).sum()
+            y.backward()
+            self.assertEqual(a.grad, 2 * a)
+
+            # Explicit hooks take precedence over the native offload hook
+            pack_count = [0]
+
+            def pack(x):
+                pack_count[0] += 1
+                return x
+
+            with torch.autograd.graph.saved_tensors_hooks(pack, lambda x: x):
+                b = torch.randn(5, requires_grad=True)
+                z = (b * b).sum()
+            self.assertGreater(pack_count[0], 0)
+            z.backward()
+            self.assertEqual(b.grad, 2 * b)
+        self.assertFalse(torch._C._autograd._saved_tensors_get_offload_to_cpu())
+
+    def test_graph_save_under_memory_budget(self):
+        self.assertEqual(torch._C._autograd._saved_tensors_get_memory_budget(), -1)
+
+        def f(x, w):
+            return (x.mul(2.0).sin() @ w).sum()
+
+        x = torch.randn(64, 64, requires_grad=True)
+        w = torch.randn(64, 64, requires_grad=True)
+        f(x, w).backward()
+        expected_x, expected_w = x.grad.clone(), w.grad.clone()
+        x.grad = w.grad = None
+
+        # A zero budget drops every recomputable activation; gradients must
+        # come out identical since replaying mul/sin is bit-exact.
+        with torch.autograd.graph.save_under_memory_budget(0):
+            self.assertEqual(
+                torch._C._autograd._saved_tensors_get_memory_budget(), 0
+            )
+            out = f(x, w)
+        # retain_graph exercises recomputing the same saved tensors twice.
+        out.backward(retain_graph=True)
+        self.assertEqual(x.grad, expected_x)
+        self.assertEqual(w.grad, expected_w)
+        x.grad = w.grad = None
+        out.backward()
+        self.assertEqual(x.grad, expected_x)
+        self.assertEqual(w.grad, expected_w)
+        self.assertEqual(torch._C._autograd._saved_tensors_get_memory_budget(), -1)
+
+        with self.assertRaisesRegex(ValueError, "must be non-negative"):
+            torch.autograd.graph.save_under_memory_budget(-1)
+
+        # A budget large enough for everything behaves like no mode at all.
+        x.grad = w.grad = None
+        with torch.autograd.graph.save_under_memory_budget(1 << 30):
+            out = f(x, w)
+        out.backward()
+        self.assertEqual(x.grad, expected_x)
+        self.assertEqual(w.grad, expected_w)
+
+    @unittest.skipIf(not TEST_CUDA, "test requires CUDA")
+    def test_graph_save_on_cpu_async_cuda(self):
+        def f(x):
+            a = x + 1
+            return a * a
+
+        a = torch.rand(128, 128, requires_grad=True, device="cuda")
+        y = f(a)
+        y.sum().backward()
+        expected = a.grad.clone()
+        a.grad = None
+
+        with torch.autograd.graph.save_on_cpu_async():
+            y = f(a)
+        # retain_graph exercises unpacking (re-uploading) the same saved
+        # tensor twice
+        y.sum().backward(retain_graph=True)
+        self.assertEqual(a.grad, expected)
+        a.grad = None
+        y.sum().backward()
+        self.assertEqual(a.grad, expected)
+
     @unittest.skipIf(not TEST_CUDA, "test requires CUDA")
     def test_graph_save_on_cpu_cuda(self):
         def f(x):
@@ -318,6 +318,81 @@ class TestCppExtensionJIT(common.TestCase):
         z = module.tanh_add(x, y)
         self.assertEqual(z, x.tanh() + y.tanh())
 
+    def test_inline_jit_compile_extension_uses_shared_cache(self):
+        cpp_source = """
+        torch::Tensor cached_tanh_add(torch::Tensor x, torch::Tensor y) {
+          return x.tanh() + y.tanh();
+        }
+        """
+
+        cache_dir = tempfile.mkdtemp()
+        build_dir_1 = tempfile.mkdtemp()
+        build_dir_2 = tempfile.mkdtemp()
+        old_envvar = os.environ.get("TORCH_EXTENSIONS_CACHE_DIR", None)
+        try:
+            os.environ["TORCH_EXTENSIONS_CACHE_DIR"] = cache_dir
+
+            module = torch.utils.cpp_extension.load_inline(
+                name="inline_jit_extension_cached",
+                cpp_sources=cpp_source,
+                functions="cached_tanh_add",
+                build_directory=build_dir_1,
+                verbose=True,
+            )
+            # The built library was published to the shared cache.
+            self.assertEqual(len(os.listdir(cache_dir)), 1)
+
+            x = torch.randn(4, 4)
+            y = torch.randn(4, 4)
+            self.assertEqual(module.cached_tanh_add(x, y), x.tanh() + y.tanh())
+
+            # Loading the identical library again dedups to the same module
+            # object instead of a second dlopen.
+            module2 = torch.utils.cpp_extension.load_inline(
+                name="inline_jit_extension_cached",
+                cpp_sources=cpp_source,
+                functions="cached_tanh_add",
+                build_directory=build_dir_1,
+                verbose=True,
+            )
+            self.assertIs(module2, module)
+
+            # A fresh process with a fresh build directory (as after a
+            # container restart) must be served from the cache without
+            # invoking the compiler.
+            script = f"""
+import os
+import torch
+import torch.utils.cpp_extension
+
+module = torch.utils.cpp_extension.load_inline(
+    name="inline_jit_extension_cached",
+    cpp_sources={cpp_source!r},
+    functions="cached_tanh_add",
+    build_directory={build_dir_2!r},
+    verbose=True,
+)
+assert not os.path.exists(os.path.join({build_dir_2!r}, "build.ninja"))
+x = torch.randn(4, 4)
+assert torch.allclose(module.cached_tanh_add(x, x), x.tanh() + x.tanh())
+"""
+            result = subprocess.run(
+                [sys.executable, "-c", script],
+                stdout=subprocess.PIPE,
+                stderr=subprocess.STDOUT,
+                env=os.environ.copy(),
+            )
+            output = result.stdout.decode()
+            self.assertEqual(result.returncode, 0, msg=output)
+            self.assertIn("Reusing cached extension library", output)
+        finally:
+            for path in (cache_dir, build_dir_1, build_dir_2):
+                shutil.rmtree(path, ignore_errors=True)
+            if old_envvar is None:
+                os.environ.pop("TORCH_EXTENSIONS_CACHE_DIR")
+            else:
+                os.environ["TORCH_EXTENSIONS_CACHE_DIR"] = old_envvar
+
     def test_inline_jit_compile_extension_with_functions_as_dict(self):
         cpp_source = """
         torch::Tensor tanh_add(torch::Tensor x, torch::Tensor y) {
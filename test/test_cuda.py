@@ -167,6 +167,28 @@ class TestCuda(TestCase):
                 torch.cuda.caching_allocator_delete(mem)
                 self.assertEqual(torch.cuda.memory_allocated(), prev)
 
+    def test_compact_expandable_segments(self):
+        # Returns 0 for backends without expandable segments; when the
+        # expandable_segments wrapper (test_cuda_expandable_segments.py) runs
+        # this file, freeing a large block leaves reclaimable pages behind.
+        gc.collect()
+        torch.cuda.empty_cache()
+        a = torch.empty(64 * 1024 * 1024, dtype=torch.int8, device="cuda")
+        b = torch.empty(64 * 1024 * 1024, dtype=torch.int8, device="cuda")
+        del a
+        expandable_in_use = any(
+            segment["is_expandable"] for segment in torch.cuda.memory_snapshot()
+        )
+        reclaimed = torch.cuda.compact_expandable_segments()
+        self.assertGreaterEqual(reclaimed, 0)
+        reserved = torch.cuda.memory_reserved()
+        if expandable_in_use:
+            self.assertGreater(reclaimed, 0)
+        # the live tensor must be untouched
+        b.fill_(3)
+        self.assertTrue((b == 3).all())
+        self.assertGreaterEqual(reserved, torch.cuda.memory_allocated())
+
     def test_check_error(self):
         # Assert this call doesn't raise.
         torch.cuda.check_error(0)
@@ -867,6 +889,90 @@ class TestCuda(TestCase):
         samples = probs.multinomial(1000000, replacement=True)
         self.assertGreater(probs[samples].min().item(), 0)
 
+    def test_fused_token_sample(self):
+        torch.cuda.manual_seed(7)
+        logits = torch.randn(64, 128, device="cuda")
+
+        # Unfiltered samples are valid indices and deterministic per seed.
+        torch.cuda.manual_seed(11)
+        tokens = torch._fused_token_sample(logits)
+        self.assertEqual(tokens.shape, (64,))
+        self.assertEqual(tokens.dtype, torch.int64)
+        self.assertTrue(((tokens >= 0) & (tokens < 128)).all())
+        torch.cuda.manual_seed(11)
+        self.assertEqual(torch._fused_token_sample(logits), tokens)
+
+        # top_k=1 is greedy decoding.
+        self.assertEqual(
+            torch._fused_token_sample(logits, top_k=1), logits.argmax(dim=-1)
+        )
+
+        # top-k samples stay inside the k largest logits of each row.
+        k = 5
+        tokens = torch._fused_token_sample(logits, temperature=2.0, top_k=k)
+        kth = logits.topk(k, dim=-1).values[:, -1]
+        self.assertTrue((logits.gather(-1, tokens.unsqueeze(-1)).squeeze(-1) >= kth).all())
+
+        # top-p samples stay inside the smallest set whose mass reaches p.
+        top_p = 0.25
+        probs = logits.softmax(dim=-1)
+        sorted_probs, sorted_idx = probs.sort(dim=-1, descending=True)
+        reached = sorted_probs.cumsum(dim=-1) >= top_p
+        # Keep everything up to and including the first entry reaching top_p.
+        keep = torch.zeros_like(reached)
+        keep[:, 1:] = ~reached[:, :-1]
+        keep[:, 0] = True
+        nucleus = torch.zeros_like(probs, dtype=torch.bool).scatter(
+            -1, sorted_idx, keep
+        )
+        for _ in range(8):
+            tokens = torch._fused_token_sample(logits, top_p=top_p)
+            self.assertTrue(nucleus.gather(-1, tokens.unsqueeze(-1)).all())
+
+        # Empirical frequencies track the categorical distribution.
+        small = torch.tensor([0.0, 1.0, 2.0, 3.0], device="cuda")
+        tokens = torch._fused_token_sample(small.expand(20000, 4).contiguous())
+        freqs = tokens.bincount(minlength=4).float() / tokens.numel()
+        self.assertEqual(freqs, small.softmax(dim=-1), atol=0.02, rtol=0)
+
+        # Half inputs and invalid hyperparameters.
+        torch._fused_token_sample(logits.half(), temperature=0.5, top_k=3)
+        with self.assertRaisesRegex(RuntimeError, "temperature must be positive"):
+            torch._fused_token_sample(logits, temperature=0.0)
+        with self.assertRaisesRegex(RuntimeError, "top_p must be in"):
+            torch._fused_token_sample(logits, top_p=0.0)
+
+    def test_randperm_batched(self):
+        perms = torch._randperm_batched(50, 200, device="cuda")
+        self.assertEqual(perms.shape, (200, 50))
+        self.assertEqual(perms.dtype, torch.int64)
+        # every row is a permutation of [0, n)
+        expected = torch.arange(50, device="cuda").expand(200, 50)
+        self.assertEqual(perms.sort(dim=-1).values, expected)
+        # rows are independent: with n=50 a collision among 200 rows is
+        # astronomically unlikely
+        self.assertGreater(len({tuple(r) for r in perms.tolist()}), 199)
+
+        # deterministic per seed
+        torch.cuda.manual_seed(42)
+        a = torch._randperm_batched(17, 31, device="cuda")
+        torch.cuda.manual_seed(42)
+        self.assertEqual(torch._randperm_batched(17, 31, device="cuda"), a)
+
+        # degenerate shapes
+        self.assertEqual(
+            torch._randperm_batched(0, 4, device="cuda").shape, (4, 0)
+        )
+        self.assertEqual(
+            torch._randperm_batched(4, 0, device="cuda").shape, (0, 4)
+        )
+        # permutations too large for shared memory take the sort-based
+        # fallback and are still valid
+        n = 50000
+        perms = torch._randperm_batched(n, 2, device="cuda")
+        expected = torch.arange(n, device="cuda").expand(2, n)
+        self.assertEqual(perms.sort(dim=-1).values, expected)
+
     def _spawn_test_multinomial_invalid_probs_cuda(self, probs):
         import subprocess
 
@@ -3861,6 +3967,26 @@ class TestCudaMallocAsync(TestCase):
         finally:
             torch.cuda.memory._record_memory_history(None)
 
+    @unittest.skipIf(
+        TEST_CUDAMALLOCASYNC, "setContextRecorder not supported by CUDAMallocAsync"
+    )
+    def test_memory_snapshot_collapsed_stacks(self):
+        try:
+            torch.cuda.memory.empty_cache()
+            torch.cuda.memory._record_memory_history("state", stacks="python")
+            x = torch.rand(311, 411, device="cuda")
+
+            stacks = torch.cuda.memory._collapsed_stacks()
+            found_it = False
+            for line in stacks.splitlines():
+                frames, _, nbytes = line.rpartition(" ")
+                if "test_memory_snapshot_collapsed_stacks" in frames:
+                    self.assertGreaterEqual(int(nbytes), 311 * 411 * 4)
+                    found_it = True
+            self.assertTrue(found_it)
+        finally:
+            torch.cuda.memory._record_memory_history(None)
+
     @skipIfRocm
     def test_memory_profiler_viz(self):
         with torch.profiler.profile(
@@ -4148,6 +4274,19 @@ class TestCudaMallocAsync(TestCase):
         reg_mem = torch.cuda.memory_stats()[key_allocated]
         self.assertTrue(reg_mem - start_mem == nbytes)
 
+        torch.cuda.memory.empty_cache()
+        torch.cuda.memory._set_allocator_settings("skip_events_if_stream_idle:True")
+        # exercise the idle-stream free path: the side stream has drained by
+        # the time the block with a recorded stream use is freed
+        s = torch.cuda.Stream()
+        x = torch.rand(nelems, device="cuda")
+        with torch.cuda.stream(s):
+            y = x + 1
+        x.record_stream(s)
+        s.synchronize()
+        del x, y
+        torch.cuda.memory._set_allocator_settings("skip_events_if_stream_idle:False")
+
         with self.assertRaises(RuntimeError):
             torch.cuda.memory._set_allocator_settings("foo:1,bar:2")
 
@@ -427,6 +427,39 @@ class TestCudaMultiGPU(TestCase):
         x2 = torch.zeros(5, 5, device=d0)
         self._test_copy_sync_current_stream(x0, x2)
 
+    @unittest.skipIf(not TEST_MULTIGPU, "only one GPU detected")
+    def test_copy_p2p_copy_stream(self):
+        # PYTORCH_CUDA_P2P_COPY_STREAM is latched on first use, so exercise it
+        # in a fresh process
+        import os
+        import subprocess
+
+        env = dict(os.environ)
+        env["PYTORCH_CUDA_P2P_COPY_STREAM"] = "1"
+        subprocess.check_call(
+            [
+                sys.executable,
+                "-c",
+                """\
+import torch
+
+# Large enough to take the dedicated copy stream, with a compute producer on
+# the source stream the transfer must wait for
+x = torch.randn(1024, 1024, device="cuda:0")
+y = (x + 1).to("cuda:1", non_blocking=True)
+z = y.to("cuda:0", non_blocking=True)
+torch.cuda.synchronize(0)
+torch.cuda.synchronize(1)
+assert torch.equal(z, x + 1)
+
+# Small copies stay on the current stream; mix both sizes back to back
+small = torch.arange(16, device="cuda:0", dtype=torch.float)
+assert torch.equal(small.to("cuda:1", non_blocking=True).cpu(), small.cpu())
+""",
+            ],
+            env=env,
+        )
+
     @unittest.skipIf(not TEST_MULTIGPU, "only one GPU detected")
     def test_cat_autogpu(self):
         x = torch.randn(4, 4).cuda(1)
@@ -634,6 +634,31 @@ class FakeTensorTest(TestCase):
             x = torch.rand([10])
             x.tolist()
 
+    def test_fast_unary_impls(self):
+        shape_env = ShapeEnv()
+        mode = FakeTensorMode(shape_env=shape_env)
+        t = mode.from_tensor(
+            torch.randn(8, 4),
+            symbolic_context=StatelessSymbolicContext(
+                dynamic_sizes=[DimDynamic.DYNAMIC, DimDynamic.DYNAMIC],
+                constraint_sizes=[None, None],
+            ),
+        )
+        for op in [torch.relu, torch.sigmoid, torch.tanh, torch.neg, torch.exp]:
+            out = op(t)
+            self.assertEqual(out.shape, t.shape)
+            self.assertEqual(out.dtype, t.dtype)
+            self.assertEqual(out.device, t.device)
+        # Non-floating inputs take the slow path and still promote correctly
+        ti = mode.from_tensor(
+            torch.arange(6).reshape(2, 3),
+            symbolic_context=StatelessSymbolicContext(
+                dynamic_sizes=[DimDynamic.DYNAMIC, DimDynamic.DYNAMIC],
+                constraint_sizes=[None, None],
+            ),
+        )
+        self.assertEqual(torch.exp(ti).dtype, torch.float32)
+
     # Propagate real tensors doesn't work with fake-on-fake
     @expectedFailurePropagateRealTensors
     def test_same_shape_env_preserved(self):
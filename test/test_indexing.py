@@ -1075,6 +1075,21 @@ class TestIndexing(TestCase):
 
             self.assertEqual(output, input_list)
 
+    def test_index_put_accumulate_long_duplicate_runs(self, device):
+        # duplicate runs longer than a warp exercise the cooperative run scan
+        # in the sorted CUDA kernel, including the partial last window
+        for run_length in (3, 64, 100, 257):
+            indices = torch.arange(8, device=device).repeat_interleave(
+                run_length
+            )
+            input = torch.randn(8, dtype=torch.double, device=device)
+            values = torch.randn(
+                indices.size(0), dtype=torch.double, device=device
+            )
+            output = input.index_put((indices,), values, accumulate=True)
+            expected = input + values.view(8, run_length).sum(1)
+            self.assertEqual(output, expected)
+
     @onlyNativeDeviceTypes
     def test_index_ind_dtype(self, device):
         x = torch.randn(4, 4, device=device)
@@ -1535,6 +1550,37 @@ class TestIndexing(TestCase):
 
         _test_against_numpy(t, indices, 1)
 
+    @dtypes(torch.float32, torch.float64)
+    def test_moe_dispatch_combine(self, device, dtype):
+        num_tokens, hidden, top_k, num_experts = 32, 24, 2, 4
+        tokens = torch.randn(num_tokens, hidden, device=device, dtype=dtype)
+        expert_ids = torch.randint(
+            num_experts, (num_tokens, top_k), device=device
+        )
+        weights = torch.rand(num_tokens, top_k, device=device, dtype=dtype)
+
+        # Sort the (token, expert) pairs by expert, as an MoE layer would.
+        perm = expert_ids.reshape(-1).argsort(stable=True)
+        dispatched = torch.ops.aten._moe_dispatch(tokens, perm // top_k)
+        self.assertEqual(dispatched, tokens[perm // top_k], atol=0, rtol=0)
+
+        # Un-permute a fake expert output and apply the routing weights.
+        expert_out = dispatched * 1.5
+        inv = torch.empty_like(perm)
+        inv[perm] = torch.arange(perm.numel(), device=device)
+        row_indices = inv.reshape(num_tokens, top_k)
+        combined = torch.ops.aten._moe_combine(expert_out, row_indices, weights)
+        ref = (
+            expert_out[row_indices.reshape(-1)].reshape(num_tokens, top_k, hidden)
+            * weights.unsqueeze(-1)
+        ).sum(1)
+        self.assertEqual(combined, ref)
+
+        with self.assertRaisesRegex(RuntimeError, "expected a 2-D token tensor"):
+            torch.ops.aten._moe_dispatch(tokens.unsqueeze(0), perm)
+        with self.assertRaisesRegex(RuntimeError, "must have the same shape"):
+            torch.ops.aten._moe_combine(expert_out, row_indices, weights[:, :1])
+
     @dtypes(torch.long, torch.float)
     def test_take_along_dim_invalid(self, device, dtype):
         shape = (2, 3, 1, 4)
@@ -930,6 +930,64 @@ class TestJit(JitTestCase):
                 with self.assertRaisesRegex(RuntimeError, "INTERNAL ASSERT FAILED"):
                     states = m.get_debug_state()
 
+    @unittest.skipIf(GRAPH_EXECUTOR != ProfilingMode.PROFILING, 'Not implemented for Simple or Legacy')
+    def test_export_import_optimized_plan(self):
+        def foo(x):
+            return x + 2
+
+        x = torch.rand(1, 10)
+
+        with enable_profiling_mode_for_profiling_tests(), num_profiled_runs(1):
+            jitted = torch.jit.script(foo)
+            # nothing to export before the optimized plan exists
+            self.assertEqual(jitted._export_optimized_plan(), "")
+            jitted(x)
+            jitted(x)
+            plan = jitted._export_optimized_plan()
+            self.assertNotEqual(plan, "")
+
+            # a flushed executor seeded with the plan starts out optimized,
+            # skipping the profiling runs
+            jitted._debug_flush_compilation_cache()
+            self.assertFalse(jitted._import_optimized_plan(""))
+            self.assertTrue(jitted._import_optimized_plan(plan))
+            # importing on top of an existing plan is rejected
+            self.assertFalse(jitted._import_optimized_plan(plan))
+            # shouldn't throw: the plan is installed before any run
+            jitted.get_debug_state()
+            self.assertEqual(jitted(x), foo(x))
+            # imported plans must also serve shapes they never profiled
+            y = torch.rand(3, 4)
+            self.assertEqual(jitted(y), foo(y))
+
+    @unittest.skipIf(GRAPH_EXECUTOR != ProfilingMode.PROFILING, 'Not implemented for Simple or Legacy')
+    def test_seal_optimized_plan(self):
+        def foo(x):
+            return x + 2
+
+        x = torch.rand(1, 10)
+
+        with enable_profiling_mode_for_profiling_tests(), num_profiled_runs(1):
+            jitted = torch.jit.script(foo)
+            # nothing to seal before the optimized plan exists
+            self.assertFalse(jitted._seal_optimized_plan())
+            jitted(x)
+            jitted(x)
+            self.assertTrue(jitted._seal_optimized_plan())
+            # sealing is idempotent
+            self.assertTrue(jitted._seal_optimized_plan())
+            self.assertEqual(jitted(x), foo(x))
+            # guards are gone from the sealed plan
+            opt_graph = list(jitted.get_debug_state().execution_plans.values())[0].graph
+            self.assertTrue(all(n.kind() != "prim::TypeCheck" for n in opt_graph.nodes()))
+            # mismatched inputs raise instead of deoptimizing
+            with self.assertRaisesRegex(RuntimeError, "sealed plan"):
+                jitted(torch.rand(3, 4))
+            # a flushed executor profiles (and deoptimizes) from scratch again
+            jitted._debug_flush_compilation_cache()
+            y = torch.rand(3, 4)
+            self.assertEqual(jitted(y), foo(y))
+
     def test_numel(self):
         @torch.jit.script
         def get_numel_script(x):
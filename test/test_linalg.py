@@ -726,6 +726,32 @@ class TestLinalg(TestCase):
         with self.assertRaisesRegex(torch.linalg.LinAlgError, r'\(Batch element 3\): The factorization could not be completed'):
             torch.linalg.cholesky_ex(A, check_errors=True)
 
+    @onlyCUDA
+    @skipCUDAIfNoMagmaAndNoCusolver
+    @skipCPUIfNoLapack
+    @dtypes(torch.float32, torch.float64)
+    def test_small_batched_factorizations(self, device, dtype):
+        # Large batches of tiny matrices may dispatch to the specialized
+        # warp-per-matrix CUDA kernels (with a timing-based backend cache),
+        # so exercise that regime explicitly against the CPU reference
+        from torch.testing._internal.common_utils import random_hermitian_pd_matrix
+
+        for n, batch in itertools.product((1, 4, 8, 17, 32), (2, 513)):
+            A = random_hermitian_pd_matrix(n, batch, dtype=dtype, device=device)
+            L, info = torch.linalg.cholesky_ex(A)
+            self.assertEqual(info, torch.zeros(batch, dtype=torch.int32, device=device))
+            self.assertEqual(L, torch.linalg.cholesky_ex(A.cpu())[0], atol=1e-4, rtol=1e-5)
+            U = torch.linalg.cholesky(A, upper=True)
+            self.assertEqual(U, torch.linalg.cholesky(A.cpu(), upper=True), atol=1e-4, rtol=1e-5)
+
+            B = make_tensor((batch, n, n), dtype=dtype, device=device)
+            LU, pivots, info = torch.linalg.lu_factor_ex(B)
+            self.assertEqual(info, torch.zeros(batch, dtype=torch.int32, device=device))
+            # Compare via reconstruction: pivot choices may legitimately
+            # differ between backends when several rows tie
+            P, L, U = torch.lu_unpack(LU, pivots)
+            self.assertEqual(P @ L @ U, B, atol=1e-4, rtol=1e-5)
+
     def _test_addr_vs_numpy(self, device, dtype, beta=1, alpha=1):
         def check(m, a, b, beta, alpha):
             if dtype == torch.bfloat16:
@@ -4545,6 +4571,33 @@ class TestLinalg(TestCase):
         assert torch.cuda.tunable.is_enabled() is False, "TunableOp should be off after resetting"
         assert torch.cuda.tunable.get_max_tuning_iterations() == 100
 
+    @onlyCUDA
+    @dtypes(torch.float, torch.half)
+    def test_addmm_bias_tunableop(self, device, dtype):
+        # covers the gemm_and_bias entry point (GemmAndBiasTunableOp), which
+        # tunes the fused epilogue against an unfused gemm plus epilogue kernels
+        import os
+        os.environ["PYTORCH_TUNABLEOP_ROTATING_BUFFER_SIZE"] = "0"
+        mat1 = make_tensor((37, 53), device=device, dtype=dtype)
+        mat2 = make_tensor((53, 29), device=device, dtype=dtype)
+        bias = make_tensor((29,), device=device, dtype=dtype)
+        ref = torch.addmm(bias, mat1, mat2)
+        ref_relu = torch._addmm_activation(bias, mat1, mat2)
+
+        torch.cuda.tunable.enable()
+        torch.cuda.tunable.set_max_tuning_duration(1)
+        torch.cuda.tunable.set_max_tuning_iterations(1)
+        try:
+            res = torch.addmm(bias, mat1, mat2)
+            res_relu = torch._addmm_activation(bias, mat1, mat2)
+            self.assertEqual(res, ref)
+            self.assertEqual(res_relu, ref_relu)
+        finally:
+            # restore to default values so later unit tests are unaffected
+            torch.cuda.tunable.enable(False)
+            torch.cuda.tunable.set_max_tuning_duration(30)
+            torch.cuda.tunable.set_max_tuning_iterations(100)
+
     @dtypes(torch.float, torch.complex64)
     def test_matmul_out_kernel_errors_with_autograd(self, device, dtype):
         a = torch.empty((256, 512), device=device, dtype=dtype, requires_grad=True).unsqueeze(0)
@@ -6449,6 +6502,31 @@ scipy_lobpcg  | {eq_err_scipy:10.2e}  | {eq_err_general_scipy:10.2e}  | {iters2:
                     self.assertRaises(RuntimeError, lambda: torch.bmm(b1.cpu(), b2))
                     self.assertRaises(RuntimeError, lambda: torch.bmm(b1, b2, out=res2.cpu()))
 
+    @onlyCPU
+    @dtypes(torch.float, torch.double)
+    def test_bmm_batched_small_gemm_kernel(self, device, dtype):
+        # Batches of >= 16 matrices with dims <= 64 take the batch-parallel
+        # small-GEMM kernel instead of per-batch BLAS calls; compare it
+        # against the single-matrix path across tail sizes, transposed
+        # operands and baddbmm's alpha/beta handling.
+        num_batches = 64
+        for M, N, O in [(32, 64, 32), (7, 5, 3), (64, 1, 64)]:
+            for t1, t2 in itertools.product((True, False), repeat=2):
+                b1 = make_tensor((num_batches, M, N), dtype=dtype, device=device, low=-1, high=1)
+                b2 = make_tensor((num_batches, N, O), dtype=dtype, device=device, low=-1, high=1)
+                if t1:
+                    b1 = b1.transpose(1, 2).contiguous().transpose(1, 2)
+                if t2:
+                    b2 = b2.transpose(1, 2).contiguous().transpose(1, 2)
+                res = torch.bmm(b1, b2)
+                expect = torch.stack([b1[b].mm(b2[b]) for b in range(num_batches)])
+                self.assertEqual(expect, res)
+
+                t = make_tensor((num_batches, M, O), dtype=dtype, device=device, low=-1, high=1)
+                for beta in (0, 1, 0.5):
+                    res = torch.baddbmm(t, b1, b2, beta=beta, alpha=0.5)
+                    self.assertEqual(beta * t + 0.5 * expect, res)
+
     def _test_addbmm_baddbmm(self, func, b1, b2, ref, out_tensor):
         getattr(out_tensor, func + "_")(b1, b2)
         self.assertEqual(out_tensor, ref)
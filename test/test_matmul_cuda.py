@@ -363,6 +363,26 @@ class TestFP8MatmulCuda(TestCase):
         with self.assertRaises(RuntimeError):
             self._test_tautological_mm(device, out_dtype=e5m2_type)
 
+    # The fused casts are plain elementwise kernels and do not need fp8
+    # matmul hardware support, only the fp8 dtypes.
+    @parametrize("fp8_dtype", [e4m3_type, e5m2_type])
+    @parametrize("base_dtype", [torch.float16, torch.bfloat16, torch.float32])
+    def test_cast_to_fp8_scaled(self, device, fp8_dtype, base_dtype) -> None:
+        torch.manual_seed(42)
+        x = torch.randn(17, 33, device=device, dtype=base_dtype)
+        scale = tensor_to_scale(x, fp8_dtype).float()
+        x_fp8, amax = torch._cast_to_fp8_scaled(x, scale, fp8_dtype)
+        self.assertEqual(x_fp8.dtype, fp8_dtype)
+        self.assertEqual(amax, x.abs().max().float())
+        self.assertEqual(
+            x_fp8.to(torch.float), (x.float() * scale).to(fp8_dtype).to(torch.float))
+        # Round trip through the fused dequant.
+        x_back = torch._cast_from_fp8_scaled(
+            x_fp8, scale.reciprocal(), base_dtype)
+        self.assertEqual(x_back.dtype, base_dtype)
+        self.assertEqual(
+            x_back.float(), x_fp8.to(torch.float) / scale, atol=1e-3, rtol=1e-3)
+
     @unittest.skipIf(not PLATFORM_SUPPORTS_FP8, f8_msg)
     def test_float8_scale(self, device) -> None:
         size = (16, 16)
@@ -288,6 +288,35 @@ class TestMkldnn(TestCase):
     def test_conv3d(self):
         self._test_conv_base(dim=3)
 
+    def test_conv2d_prewarm(self):
+        # mkldnn::_prewarm_convolution populates the shared primitive cache
+        # at model load time; the convolution must produce the same result
+        # whether the cache is pre-warmed, cold, or already hot.
+        for bias, memory_format in itertools.product(
+                [True, False], [torch.contiguous_format, torch.channels_last]):
+            conv = torch.nn.Conv2d(in_channels=3,
+                                   out_channels=8,
+                                   kernel_size=3,
+                                   stride=2,
+                                   padding=1,
+                                   bias=bias).float()
+            conv = conv.to(memory_format=memory_format)
+            x = torch.randn(2, 3, 56, 56).to(memory_format=memory_format)
+            torch.ops.mkldnn._prewarm_convolution(
+                conv.weight,
+                conv.bias,
+                list(x.shape),
+                conv.padding,
+                conv.stride,
+                conv.dilation,
+                conv.groups)
+            with torch.backends.mkldnn.flags(enabled=False):
+                y_ref = conv(x)
+            # First call takes the cache-hit path after pre-warming, the
+            # second exercises a repeat hit.
+            self.assertEqual(y_ref, conv(x))
+            self.assertEqual(y_ref, conv(x))
+
     def _test_conv_deconv_lower_precision_base(self, dim, conv_module, dtype):
         input_shapes = {1: (224,), 2: (224, 224), 3: (55, 55, 55)}
         options = itertools.product([True, False], [1, 2], [1, 4])
@@ -1589,6 +1618,25 @@ class TestMkldnn(TestCase):
             ]:
                 common(self, shape1, shape2, op, dtype)
 
+    def test_matmul_bf16_reduced_precision_reduction(self):
+        if not torch.ops.mkldnn._is_mkldnn_bf16_supported():
+            self.skipTest("mkldnn bf16 path not supported")
+        orig = torch._C._get_cpu_allow_bf16_reduced_precision_reduction()
+        try:
+            torch._C._set_cpu_allow_bf16_reduced_precision_reduction(True)
+            self.assertTrue(torch._C._get_cpu_allow_bf16_reduced_precision_reduction())
+            a = torch.randn(64, 128, dtype=torch.bfloat16)
+            b = torch.randn(128, 64, dtype=torch.bfloat16)
+            y = torch.matmul(a, b)
+            y_ref = torch.matmul(a.float(), b.float())
+            # Reduced precision accumulation loosens the error bound but must
+            # stay within bf16 rounding of the f32 reference.
+            self.assertEqual(y, y_ref, exact_dtype=False, atol=1e-1, rtol=1e-2)
+        finally:
+            torch._C._set_cpu_allow_bf16_reduced_precision_reduction(orig)
+        self.assertEqual(
+            torch._C._get_cpu_allow_bf16_reduced_precision_reduction(), orig)
+
 
 instantiate_device_type_tests(TestMkldnn, globals(), only_for=('cpu',))
 
@@ -262,6 +262,35 @@ class TestOptimizer(TestCase):
             rtol=1e-2,
             atol=1e-3)
 
+    def test_fuse_elementwise_chains(self):
+        class ChainModule(torch.nn.Module):
+            def forward(self, x):
+                x = x * 2.0
+                x = x * 3.0
+                x = x + 1.0
+                x = x - 4.0
+                x = torch.clamp(x, min=-1.0)
+                x = torch.clamp(x, max=1.0)
+                x = F.relu(x)
+                x = F.relu(x)
+                return x
+
+        data = torch.randn(4, 4)
+        module = ChainModule()
+        ref = module(data)
+
+        m = torch.jit.script(module)
+        m.eval()
+        torch._C._jit_pass_fuse_elementwise_chains(m.forward.graph)
+
+        FileCheck().check_count("aten::mul", 1, exactly=True) \
+            .check_not("aten::add(") \
+            .check_count("aten::sub", 1, exactly=True) \
+            .check_count("aten::clamp", 1, exactly=True) \
+            .check_count("aten::relu", 1, exactly=True) \
+            .run(m.forward.graph)
+        torch.testing.assert_close(m(data), ref)
+
     @skipIfNoXNNPACK
     def test_quantized_conv_no_asan_failures(self):
         # There were ASAN failures when fold_conv_bn was run on
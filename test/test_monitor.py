@@ -11,6 +11,7 @@ import time
 from torch.monitor import (
     Aggregation,
     Event,
+    Histogram,
     log_event,
     register_event_handler,
     unregister_event_handler,
@@ -60,6 +61,57 @@ class TestMonitor(TestCase):
         self.assertEqual(s.count, 0)
         self.assertEqual(s.get(), {Aggregation.SUM: 6.0, Aggregation.COUNT: 3})
 
+    def test_histogram(self) -> None:
+        h = Histogram("op.latency")
+        self.assertEqual(h.name, "op.latency")
+        self.assertEqual(h.count, 0)
+        self.assertEqual(h.percentile(0.99), 0)
+
+        for _ in range(99):
+            h.record(100)
+        h.record(100000)
+        self.assertEqual(h.count, 100)
+        # percentiles are bucketed to the next power of two
+        self.assertEqual(h.percentile(0.5), 127)
+        self.assertEqual(h.percentile(0.99), 131071)
+
+        events = []
+        handle = register_event_handler(events.append)
+        try:
+            h.log()
+        finally:
+            unregister_event_handler(handle)
+        self.assertEqual(len(events), 1)
+        self.assertEqual(events[0].name, "torch.monitor.Histogram")
+        self.assertEqual(events[0].data["name"], "op.latency")
+        self.assertEqual(events[0].data["count"], 100)
+        self.assertEqual(events[0].data["p99"], 131071)
+
+    def test_op_latency_histograms(self) -> None:
+        import torch
+        from torch._C._monitor import (
+            _disable_op_latency_histograms,
+            _enable_op_latency_histograms,
+            _log_op_latency_histograms,
+        )
+
+        events = []
+        handle = register_event_handler(events.append)
+        _enable_op_latency_histograms()
+        try:
+            torch.add(torch.ones(4), torch.ones(4))
+        finally:
+            _disable_op_latency_histograms()
+        try:
+            _log_op_latency_histograms()
+        finally:
+            unregister_event_handler(handle)
+        names = {e.data["name"] for e in events}
+        self.assertIn("aten::add", names)
+        for e in events:
+            self.assertEqual(e.name, "torch.monitor.Histogram")
+            self.assertGreaterEqual(e.data["p99"], e.data["p50"])
+
     def test_log_event(self) -> None:
         e = Event(
             name="torch.monitor.TestEvent",
@@ -1931,6 +1931,26 @@ class TestNestedTensorDeviceType(TestCase):
     def test_bmm_cuda(self, device, dtype):
         self._test_bmm(device, dtype)
 
+    # batches where every matrix has the same shape take the pointer-array
+    # batched GEMM path instead of one gemm per matrix
+    @onlyCUDA
+    @dtypes(torch.float, torch.double, torch.float16, torch.bfloat16)
+    def test_bmm_cuda_uniform_shapes(self, device, dtype):
+        nt0 = torch.nested.nested_tensor(
+            [torch.randn((5, 7)) for _ in range(8)], device=device, dtype=dtype
+        )
+        nt1 = torch.nested.nested_tensor(
+            [torch.randn((7, 6)) for _ in range(8)], device=device, dtype=dtype
+        )
+        actual = torch.nested.to_padded_tensor(nt0.bmm(nt1), 0.0)
+        expect = torch.nested.to_padded_tensor(nt0, 0.0).bmm(
+            torch.nested.to_padded_tensor(nt1, 0.0)
+        )
+        if dtype in (torch.float16, torch.bfloat16):
+            self.assertEqual(actual, expect, rtol=1e-2, atol=1e-2)
+        else:
+            self.assertEqual(actual, expect)
+
     @onlyCPU
     # cannot test torch.float16 because: RuntimeError: "addmm_impl_cpu_" not implemented for 'Half'
     @dtypes(torch.float, torch.double)
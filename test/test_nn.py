@@ -7024,6 +7024,85 @@ tensor(..., device='meta', size=(1,), requires_grad=True)""")
 
             self.assertEqual(grads1, grads2, rtol=rtol, atol=atol)
 
+    def test_fused_layer_norm_linear(self):
+        def reference(x, normalized_shape, w, b, eps, pw, pb):
+            return F.linear(F.layer_norm(x, normalized_shape, w, b, eps), pw, pb)
+
+        for device in ["cpu"] + (["cuda"] if TEST_CUDA else []):
+            x = torch.randn(4, 7, 16, device=device)
+            w = torch.randn(16, device=device)
+            b = torch.randn(16, device=device)
+            pw = torch.randn(48, 16, device=device)
+            pb = torch.randn(48, device=device)
+
+            out = torch.ops.aten._fused_layer_norm_linear(
+                x, [16], w, b, 1e-5, pw, pb
+            )
+            self.assertEqual(out, reference(x, [16], w, b, 1e-5, pw, pb))
+
+            # Optional norm affine and projection bias.
+            out = torch.ops.aten._fused_layer_norm_linear(
+                x, [16], None, None, 1e-5, pw, None
+            )
+            self.assertEqual(out, reference(x, [16], None, None, 1e-5, pw, None))
+
+        # Multi-dim normalized_shape has no single projection axis.
+        with self.assertRaisesRegex(RuntimeError, "normalized_shape must be 1-D"):
+            torch.ops.aten._fused_layer_norm_linear(
+                torch.randn(2, 4, 4), [4, 4], None, None, 1e-5, torch.randn(8, 16), None
+            )
+
+    @unittest.skipIf(not TEST_CUDA, "CUDA not available")
+    def test_fused_dropout_add_norm(self):
+        def unpack_mask(mask, shape, n):
+            # One keep/drop bit per element, eight per byte, rows padded to
+            # whole bytes.
+            shifts = torch.arange(8, device=mask.device, dtype=torch.uint8)
+            bits = mask.unsqueeze(-1).bitwise_right_shift(shifts).bitwise_and(1)
+            return bits.flatten(-2)[:, :n].reshape(shape).bool()
+
+        p = 0.3
+        scale = 1 / (1 - p)
+        x = torch.randn(4, 7, 16, device="cuda", requires_grad=True)
+        res = torch.randn(4, 7, 16, device="cuda", requires_grad=True)
+        w = torch.randn(16, device="cuda", requires_grad=True)
+        b = torch.randn(16, device="cuda", requires_grad=True)
+
+        out, pre_norm, mask, mean, rstd = torch.ops.aten._fused_dropout_add_layer_norm(
+            x, res, [16], w, b, p, 1e-5
+        )
+        keep = unpack_mask(mask, x.shape, 16)
+        # Roughly (1 - p) of the elements should survive.
+        self.assertAlmostEqual(keep.float().mean().item(), 1 - p, delta=0.15)
+        z_ref = res + x * keep * scale
+        self.assertEqual(pre_norm, z_ref)
+        ref = F.layer_norm(z_ref, [16], w, b, 1e-5)
+        self.assertEqual(out, ref, atol=1e-4, rtol=1e-5)
+        grads = torch.autograd.grad(out.sum(), [x, res, w, b], retain_graph=True)
+        ref_grads = torch.autograd.grad(ref.sum(), [x, res, w, b])
+        for g, rg in zip(grads, ref_grads):
+            self.assertEqual(g, rg, atol=1e-4, rtol=1e-5)
+
+        out, pre_norm, mask, rstd = torch.ops.aten._fused_dropout_add_rms_norm(
+            x, res, [16], w, p, 1e-5
+        )
+        keep = unpack_mask(mask, x.shape, 16)
+        z_ref = res + x * keep * scale
+        self.assertEqual(pre_norm, z_ref)
+        ref = F.rms_norm(z_ref, [16], w, 1e-5)
+        self.assertEqual(out, ref, atol=1e-4, rtol=1e-5)
+        grads = torch.autograd.grad(out.sum(), [x, res, w], retain_graph=True)
+        ref_grads = torch.autograd.grad(ref.sum(), [x, res, w])
+        for g, rg in zip(grads, ref_grads):
+            self.assertEqual(g, rg, atol=1e-4, rtol=1e-5)
+
+        # p == 1 drops everything: empty mask, pre-norm sum is the residual.
+        _, pre_norm, mask, _, _ = torch.ops.aten._fused_dropout_add_layer_norm(
+            x, res, [16], w, b, 1.0, 1e-5
+        )
+        self.assertEqual(mask, torch.zeros_like(mask))
+        self.assertEqual(pre_norm, res)
+
     def test_layer_norm_eps(self):
         # test for https://github.com/pytorch/pytorch/issues/108072
         x = torch.Tensor([[[2.0, 2.0], [14.0, 14.0]], [[2.0, 2.0], [14.0, 14.0]]])
@@ -9853,6 +9932,28 @@ class TestNNDeviceType(NNTestCase):
                         exact_dtype=True
                     )
 
+    def test_masked_softmax_broadcast_masks(self, device):
+        # Test that broadcast attention-mask layouts - a BxL padding mask given
+        # as Bx1x1xL and a per-batch attention mask given as Bx1xLxL - are
+        # accepted without materializing the BxHxLxL expansion and match the
+        # explicit slow calculation.
+        sizes = [(1, 2, 23), (3, 3, 64), (6, 2, 256), (2, 4, 1200)]
+        for (B, num_heads, L) in sizes:
+            for mask_shape in [(B, 1, 1, L), (B, 1, L, L)]:
+                input = torch.randn((B, num_heads, L, L), device=device)
+                mask = torch.randint(0, 2, mask_shape, device=device).bool()
+                native_res = torch._masked_softmax(input, mask, 3, 2)
+                mask_expanded = mask.expand(B, num_heads, L, L)
+                pt_res = self._slow_masked_softmax(input, ~mask_expanded)
+                pt_res = torch.nan_to_num(pt_res)
+                # In result, should only fill the entirely masked out rows since those are non-deterministic (*may* be 0)
+                mask_out = mask_expanded.all(3, keepdim=True).expand(mask_expanded.shape)
+                self.assertEqual(
+                    pt_res.masked_fill(mask_out, 0),
+                    native_res.masked_fill(mask_out, 0),
+                    exact_dtype=True
+                )
+
     @onlyCUDA
     @gcIfJetson
     def test_masked_softmax_devices_parity(self):
@@ -11638,6 +11739,27 @@ if __name__ == '__main__':
                 output_one_hot = m(input, target_one_hot)
                 self.assertEqual(output, output_one_hot)
 
+    def test_cross_entropy_loss_large_vocab_fused(self, device):
+        # The 2D class-index case with a large class dimension takes a fused
+        # streaming path that avoids materializing log probabilities; check
+        # forward and gradients against the materializing reference.
+        N, C = 7, 16384  # C above the fused-path routing threshold
+        for dtype, ignore in product([torch.float, torch.double], [False, True]):
+            input = torch.randn(N, C, device=device, dtype=dtype, requires_grad=True)
+            target = torch.empty(N, dtype=torch.long, device=device).random_(0, C)
+            if ignore:
+                target[1] = -100
+            for reduction in ['none', 'mean', 'sum']:
+                ref_input = input.detach().clone().requires_grad_(True)
+                ref = F.nll_loss(F.log_softmax(ref_input, dim=1), target, reduction=reduction)
+                res = F.cross_entropy(input, target, reduction=reduction)
+                self.assertEqual(res, ref)
+                grad_output = torch.randn_like(ref)
+                ref.backward(grad_output)
+                res.backward(grad_output)
+                self.assertEqual(input.grad, ref_input.grad)
+                input.grad = None
+
     def test_cross_entropy_label_smoothing_errors(self, device):
         N, C = 3, 4
         input_args = [
@@ -11830,6 +11952,16 @@ if __name__ == '__main__':
             if device == 'cpu':
                 test_dtype(func, x, torch.bfloat16)
 
+    def test_unfold_non_overlapping(self, device):
+        # Non-overlapping patches take a relayout fast path on CPU; compare
+        # against the generic unit-stride path sampled at the patch origins.
+        for kh, kw in [(4, 3), (2, 2), (1, 5)]:
+            x = torch.randn(2, 3, 8, 15, device=device)
+            out = F.unfold(x, kernel_size=(kh, kw), stride=(kh, kw))
+            ref = F.unfold(x, kernel_size=(kh, kw))
+            ref = ref.view(2, 3 * kh * kw, 8 - kh + 1, 15 - kw + 1)
+            ref = ref[:, :, ::kh, ::kw].reshape(2, 3 * kh * kw, -1)
+            self.assertEqual(out, ref)
 
     def test_logsigmoid_out(self, device):
         # this isn't actually documented, but was broken previously:
@@ -1327,6 +1327,15 @@ class TestReductions(TestCase):
         big_exp[1] = 1000000
         big_out = torch.ones(1000000, dtype=torch.int8, device=device).bincount()
         self.assertEqual(big_exp, big_out)
+        # test large input against a scatter_add reference; on CPU this
+        # exercises the parallel privatized-histogram path
+        big_in = torch.randint(100, (100000,), device=device)
+        big_w = torch.rand(100000, device=device)
+        big_exp = torch.zeros(100, device=device).scatter_add_(0, big_in, big_w)
+        self.assertEqual(big_in.bincount(big_w), big_exp)
+        big_exp = torch.zeros(100, dtype=torch.int64, device=device).scatter_add_(
+            0, big_in, torch.ones_like(big_in))
+        self.assertEqual(big_in.bincount(), big_exp)
 
     # TODO: how many var stability tests are there?
     def test_var_stability2(self, device):
@@ -1680,6 +1689,34 @@ class TestReductions(TestCase):
             actual = torch.nansum(x, **dim_kwargs)
             self.assertEqual(expect, actual)
 
+    @dtypes(torch.float, torch.double, torch.half, torch.bfloat16)
+    def test_tensor_summary(self, device, dtype):
+        for noncontiguous, with_nan in product((False, True), (False, True)):
+            x = make_tensor((23, 13), device=device, dtype=dtype,
+                            low=-10, high=10, noncontiguous=noncontiguous)
+            if with_nan:
+                x[x < -5] = np.nan
+            stats = torch.ops.aten._tensor_summary(x)
+            self.assertEqual(stats.dtype, torch.double)
+            self.assertEqual(stats.device, x.device)
+            finite = x[~x.isnan()].double()
+            self.assertEqual(stats[0], finite.min(), exact_dtype=False)
+            self.assertEqual(stats[1], finite.max(), exact_dtype=False)
+            # The sum is accumulated in the input's acc type, so reduced
+            # precision inputs need a looser mean comparison.
+            tol = 1e-2 if dtype in (torch.half, torch.bfloat16) else None
+            self.assertEqual(stats[2], finite.mean(), exact_dtype=False,
+                             atol=tol, rtol=tol)
+            self.assertEqual(stats[3], x.isnan().sum(), exact_dtype=False)
+
+        # Empty input: no elements to summarize, mean is nan by convention.
+        stats = torch.ops.aten._tensor_summary(
+            torch.empty(0, device=device, dtype=dtype))
+        self.assertEqual(stats[0], float("inf"))
+        self.assertEqual(stats[1], float("-inf"))
+        self.assertTrue(stats[2].isnan().item())
+        self.assertEqual(stats[3], 0.0)
+
     def _test_reduction_function_with_numpy(self, torch_func, np_func, device, dtype,
                                             with_extremal=False, atol=None, rtol=None,
                                             exact_dtype=True, with_keepdim=False):
@@ -2617,6 +2654,8 @@ class TestReductions(TestCase):
 
         check([1., 2, 3], 0.5, 0, [0, 1, 0])
         check([1., 2, 3, 4], 0.5, 0, [0, 0.5, 0.5, 0])
+        # dim=None takes the selection-based path on CPU
+        check([1., 2, 3, 4], 0.5, None, [0, 0.5, 0.5, 0])
         check([3., 1, 4, 2], 0.5, 0, [0.5, 0, 0, 0.5])
         check([1., 2, 3, 4], [0.25, 0.5, 0.75], 0, [0.25, 1.25, 1.25, 0.25])
         check([[1., 2], [2, 1]], 0., 0, [[1, 0], [0, 1]])
@@ -3054,6 +3093,12 @@ class TestReductions(TestCase):
         linear = torch.linspace(0, 0.99 - 5.0e-7, 101).to(device)
         test_against_np(linear, bins=20, min=0, max=0.99)
 
+        # Large input; on CPU this exercises the blocked 1-D fast path.
+        # Chunked sums must agree with histogramming the whole input at once.
+        big = torch.randn(100000, device=device)
+        chunked = sum(torch.histc(chunk, bins=50, min=-3, max=3) for chunk in big.chunk(7))
+        self.assertEqual(torch.histc(big, bins=50, min=-3, max=3), chunked)
+
     @onlyCPU
     @dtypes(torch.bfloat16, torch.half)
     def test_histc_lowp(self, device, dtype):
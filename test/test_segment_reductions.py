@@ -552,6 +552,74 @@ class TestSegmentReductions(TestCase):
                     check_backward,
                 )
 
+    @dtypes(
+        *product(
+            (torch.float, torch.double),
+            (torch.int, torch.int64),
+        )
+    )
+    def test_logsumexp(self, device, dtypes):
+        val_dtype, length_type = dtypes
+        data = torch.tensor(
+            [1.0, 2.0, 3.0, 40.0, 5.0], device=device, dtype=val_dtype
+        )
+        lengths = torch.tensor([0, 2, 3, 0], device=device, dtype=length_type)
+        offsets = torch.tensor(
+            [0, 0, 2, 5, 5], device=device, dtype=length_type
+        )
+        # reference via per-segment torch.logsumexp; empty segments are -inf
+        expected = torch.stack(
+            [
+                torch.logsumexp(data[0:0], 0),
+                torch.logsumexp(data[0:2], 0),
+                torch.logsumexp(data[2:5], 0),
+                torch.logsumexp(data[5:5], 0),
+            ]
+        )
+        for args in ({"lengths": lengths}, {"offsets": offsets}):
+            actual = torch._segment_reduce(data, "logsumexp", axis=0, **args)
+            self.assertEqual(expected, actual)
+
+        # initial behaves like one extra element in every segment
+        actual = torch._segment_reduce(
+            data, "logsumexp", lengths=lengths, axis=0, initial=0.0
+        )
+        expected_initial = torch.logaddexp(
+            expected, torch.zeros_like(expected)
+        )
+        self.assertEqual(expected_initial, actual)
+
+        # backward matches autograd through the per-segment reference
+        lengths_nonempty = torch.tensor(
+            [2, 3], device=device, dtype=length_type
+        )
+        data_ref = data.clone().requires_grad_()
+        data_act = data.clone().requires_grad_()
+        out_ref = torch.stack(
+            [
+                torch.logsumexp(data_ref[0:2], 0),
+                torch.logsumexp(data_ref[2:5], 0),
+            ]
+        )
+        out_act = torch._segment_reduce(
+            data_act, "logsumexp", lengths=lengths_nonempty, axis=0
+        )
+        self.assertEqual(out_ref, out_act)
+        grad_out = torch.tensor([1.0, 2.0], device=device, dtype=val_dtype)
+        out_ref.backward(grad_out)
+        out_act.backward(grad_out)
+        self.assertEqual(data_ref.grad, data_act.grad)
+
+        if val_dtype == torch.double:
+            self.assertTrue(
+                gradcheck(
+                    lambda x: torch._segment_reduce(
+                        x, "logsumexp", lengths=lengths_nonempty, axis=0
+                    ),
+                    (data.clone().requires_grad_(),),
+                )
+            )
+
     @dtypes(torch.int, torch.int64)
     def test_unsafe_flag(self, device, dtype):
         length_type = dtype
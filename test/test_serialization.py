@@ -939,6 +939,39 @@ class TestOldSerialization(TestCase, SerializationMixin):
 
 
 class TestSerialization(TestCase, SerializationMixin):
+    def test_async_save(self):
+        m = torch.nn.Linear(5, 3)
+        expected = {k: v.clone() for k, v in m.state_dict().items()}
+
+        with TemporaryFileName() as fname:
+            handle = torch.serialization.async_save(m.state_dict(), fname)
+            # Mutating the model after async_save returns must not affect
+            # the checkpoint: the COW snapshot was taken synchronously.
+            with torch.no_grad():
+                for p in m.parameters():
+                    p.add_(100.0)
+            handle.wait()
+            self.assertTrue(handle.done())
+            result = torch.load(fname)
+            self.assertEqual(result, expected)
+
+        # Parameters keep their type and requires_grad flag.
+        with TemporaryFileName() as fname:
+            torch.serialization.async_save(
+                {"w": m.weight, "b": m.bias.detach()}, fname
+            ).wait()
+            result = torch.load(fname)
+            self.assertIsInstance(result["w"], torch.nn.Parameter)
+            self.assertTrue(result["w"].requires_grad)
+            self.assertFalse(result["b"].requires_grad)
+
+        # Background errors surface on wait().
+        handle = torch.serialization.async_save(
+            {"x": torch.ones(3)}, "/nonexistent-dir/ckpt.pt"
+        )
+        with self.assertRaises(Exception):
+            handle.wait()
+
     @parametrize('weights_only', (True, False))
     def test_serialization_zipfile(self, weights_only):
         data = self._test_serialization_data()
@@ -797,6 +797,33 @@ class TestShapeOps(TestCase):
         nz = x.nonzero()
         self.assertFalse(nz.requires_grad)
 
+    @onlyNativeDeviceTypes
+    @dtypes(torch.float, torch.bool)
+    def test_nonzero_static(self, device, dtype):
+        for shape in [(12,), (6, 2), (3, 2, 2)]:
+            tensor = torch.randint(2, shape, device=device).to(dtype)
+            ref = torch.nonzero(tensor, as_tuple=False)
+            num_nonzeros = ref.size(0)
+            # exact capacity, padded capacity, and truncating capacity
+            for size in [num_nonzeros, num_nonzeros + 3, max(num_nonzeros - 2, 0)]:
+                dst = torch.nonzero_static(tensor, size=size, fill_value=-7)
+                self.assertEqual(dst.shape, torch.Size([size, tensor.dim()]))
+                copy_len = min(size, num_nonzeros)
+                self.assertEqual(dst[:copy_len], ref[:copy_len], atol=0, rtol=0)
+                self.assertTrue((dst[copy_len:] == -7).all())
+            # out variant with a discontiguous destination
+            dst = torch.empty(
+                num_nonzeros, tensor.dim() * 2, dtype=torch.long, device=device
+            )[:, ::2]
+            torch.nonzero_static(tensor, size=num_nonzeros, out=dst)
+            self.assertEqual(dst, ref, atol=0, rtol=0)
+        # all-zero input is entirely fill_value
+        zeros = torch.zeros(4, 3, device=device, dtype=dtype)
+        dst = torch.nonzero_static(zeros, size=5)
+        self.assertTrue((dst == -1).all())
+        with self.assertRaisesRegex(RuntimeError, "must be an non-negative integer"):
+            torch.nonzero_static(zeros, size=-1)
+
     @dtypes(torch.int64, torch.float, torch.complex128)
     def test_sparse_dense_dim(self, device, dtype):
         for shape in [(), (2,), (2, 3)]:
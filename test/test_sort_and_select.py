@@ -871,6 +871,54 @@ class TestSortAndSelect(TestCase):
         self.assertEqual(val, expect)
         self.assertEqual(idx, [5, 4, 3, 2])
 
+    @onlyCUDA
+    @dtypes(torch.float, torch.double, torch.bfloat16, torch.half)
+    def test_topk_softmax(self, device, dtype):
+        # Fused equivalent of x.softmax(-1).topk(k) for small inner dims.
+        for num_rows, inner_dim, k in [(1, 1, 1), (17, 8, 2), (128, 256, 4)]:
+            x = torch.randn(num_rows, inner_dim, device=device, dtype=dtype)
+            val, idx = torch.ops.aten._topk_softmax(x, k)
+            ref_val, ref_idx = x.float().softmax(-1).topk(k)
+            self.assertEqual(idx, ref_idx)
+            self.assertEqual(val, ref_val.to(dtype), atol=1e-2, rtol=1e-2)
+
+    def test_streaming_topk(self, device):
+        from torch.utils._streaming_topk import StreamingTopK
+
+        for numel, k, largest in [(10000, 64, True), (10000, 64, False), (37, 64, True)]:
+            x = torch.randn(numel, device=device)
+            ref_val, ref_idx = x.topk(min(k, numel), largest=largest)
+
+            # Chunked accumulation matches a resident topk.
+            acc = StreamingTopK(k, largest=largest)
+            for chunk in x.split(613):
+                acc.update(chunk)
+            val, idx = acc.topk()
+            self.assertEqual(val, ref_val, atol=0, rtol=0)
+            self.assertEqual(x[idx], val, atol=0, rtol=0)
+
+            # Merging shard-local accumulators matches as well.
+            mid = numel // 2
+            left, right = StreamingTopK(k, largest=largest), StreamingTopK(
+                k, largest=largest
+            )
+            left.update(x[:mid])
+            right.update(x[mid:], offset=mid)
+            left.merge(right)
+            val, idx = left.topk()
+            self.assertEqual(val, ref_val, atol=0, rtol=0)
+            self.assertEqual(x[idx], val, atol=0, rtol=0)
+
+        with self.assertRaisesRegex(RuntimeError, "k must be positive"):
+            torch._streaming_topk_update(
+                torch.empty(0, device=device),
+                torch.empty(0, dtype=torch.long, device=device),
+                torch.randn(4, device=device),
+                torch.arange(4, device=device),
+                0,
+                True,
+            )
+
     def test_topk_4d(self, device):
         small = 128
         large = 8192
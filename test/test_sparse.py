@@ -367,6 +367,23 @@ class TestSparse(TestSparseBase):
             t, _, _ = self._gen_sparse(len(sparse_size), nnz, sparse_size + dense_size, dtype, device, coalesced)
             _test_coalesce(t)  # this tests correctness
 
+    @onlyCPU
+    @dtypes(torch.double)
+    def test_coalesce_large(self, device, dtype):
+        # Large duplicate-heavy input; exercises the partitioned parallel
+        # duplicate-sum path on CPU. Verified against dense accumulation.
+        nnz, size = 200000, 1000
+        indices = torch.randint(size, (2, nnz), device=device)
+        values = torch.randn(nnz, dtype=dtype, device=device)
+        t = torch.sparse_coo_tensor(indices, values, (size, size))
+        tc = t.coalesce()
+        self.assertTrue(tc.is_coalesced())
+        dense = torch.zeros(size, size, dtype=dtype, device=device)
+        dense.index_put_((indices[0], indices[1]), values, accumulate=True)
+        self.assertEqual(tc.to_dense(), dense)
+        flat = tc._indices()[0] * size + tc._indices()[1]
+        self.assertTrue((flat.diff() > 0).all())
+
     @dtypes(torch.double)
     @skipIfTorchDynamo("https://github.com/pytorch/pytorch/issues/89395")
     def test_coalesce_reference_cycle(self, device, dtype):
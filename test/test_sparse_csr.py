@@ -2055,6 +2055,24 @@ class TestSparseCSR(TestCase):
             m2 = maybe_transpose(t3, torch.randn(50, 25, device=device).to(dtype))
             _test_addmm_addmv(self, torch.addmm, M, m1, m2, transpose_out=t4, layout=layout, mode="dense_result")
 
+    @onlyCPU
+    @dtypes(torch.float64, torch.complex128)
+    def test_addmm_skewed_rows(self, device, dtype):
+        # Heavily skewed nnz per row (one nearly-dense row, many empty rows);
+        # without MKL this exercises the native kernel's nnz-balanced row
+        # partitioning and column blocking.
+        m, k, n = 64, 400, 300
+        dense = torch.zeros(m, k, device=device, dtype=dtype)
+        dense[0] = torch.randn(k, device=device, dtype=dtype)
+        dense[1::7, ::19] = torch.randn(9, 22, device=device, dtype=dtype)
+        sparse = dense.to_sparse_csr()
+        mat2 = torch.randn(k, n, device=device, dtype=dtype)
+        M = torch.randn(m, n, device=device, dtype=dtype)
+        for beta, alpha in [(0.0, 1.0), (0.7, 1.3)]:
+            res = torch.addmm(M, sparse, mat2, beta=beta, alpha=alpha)
+            expected = torch.addmm(M, dense, mat2, beta=beta, alpha=alpha)
+            self.assertEqual(res, expected)
+
     @parametrize("k", [0, 1, 8])
     @parametrize("n", [0, 1, 10])
     @parametrize("m", [0, 1, 25])
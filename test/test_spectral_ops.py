@@ -3,6 +3,9 @@
 import torch
 import unittest
 import math
+import os
+import subprocess
+import sys
 from contextlib import contextmanager
 from itertools import product
 import itertools
@@ -823,6 +826,29 @@ class TestFFT(TestCase):
     def test_fft_ifft_rfft_irfft(self, device, dtype):
         self._test_fft_ifft_rfft_irfft(device, dtype)
 
+    @onlyCUDA
+    def test_cufft_plan_bucketing(self, device):
+        # Plan bucketing is read from the environment once at first use, so
+        # exercise it in a fresh process.
+        script = """
+import torch
+torch.manual_seed(42)
+for batch in (1, 5, 13, 64, 100):
+    for n in (16, 100, 211):
+        x = torch.randn(batch, n, device='cuda')
+        torch.testing.assert_close(
+            torch.fft.rfft(x), torch.fft.rfft(x.cpu()).cuda())
+        c = torch.randn(batch, n, device='cuda', dtype=torch.complex64)
+        torch.testing.assert_close(
+            torch.fft.fft(c), torch.fft.fft(c.cpu()).cuda())
+"""
+        env = dict(os.environ)
+        env["PYTORCH_CUFFT_PLAN_BUCKETING"] = "1"
+        proc = subprocess.run(
+            [sys.executable, "-c", script], env=env,
+            stdout=subprocess.PIPE, stderr=subprocess.PIPE)
+        self.assertEqual(proc.returncode, 0, msg=proc.stderr.decode("ascii", errors="replace"))
+
     @deviceCountAtLeast(1)
     @onlyCUDA
     @dtypes(torch.double)
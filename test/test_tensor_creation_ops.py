@@ -607,6 +607,38 @@ class TestTensorCreation(TestCase):
                 self.assertEqual(c.grad, expected_c_grad)
                 self.assertEqual(d.grad, expected_d_grad)
 
+    @onlyCPU
+    @dtypes(torch.half, torch.float, torch.long)
+    def test_cat_parallel_many_inputs(self, device, dtype):
+        # Exercises the multi-threaded contiguous cat kernel: the output has
+        # to be over the serial-kernel grain size and there have to be many
+        # inputs so the (input, outer-slice) partitioning kicks in.
+        def make_input(rows):
+            if dtype == torch.long:
+                return torch.randint(100, (rows, 33), device=device, dtype=dtype)
+            return torch.randn((rows, 33), device=device, dtype=dtype)
+
+        def reference_cat(tensors, dim):
+            # Assemble the expected result with plain slice assignment so the
+            # reference does not go through any cat kernel.
+            sizes = list(tensors[0].shape)
+            sizes[dim] = sum(t.size(dim) for t in tensors)
+            out = torch.empty(sizes, device=device, dtype=dtype)
+            offset = 0
+            for t in tensors:
+                out.narrow(dim, offset, t.size(dim)).copy_(t)
+                offset += t.size(dim)
+            return out
+
+        # Equal-shape inputs take the stack-layout fast path.
+        same = [make_input(17) for _ in range(64)]
+        for dim in (0, 1):
+            self.assertEqual(torch.cat(same, dim=dim), reference_cat(same, dim))
+
+        # Ragged sizes along the cat dimension take the general path.
+        ragged = [make_input(rows) for rows in (1, 17, 64, 3, 128, 5, 99, 2)]
+        self.assertEqual(torch.cat(ragged, dim=0), reference_cat(ragged, 0))
+
     def test_cat_out_channels_last(self, device):
         x = torch.randn((4, 3, 8, 8))
         y = torch.randn(x.shape)
@@ -1557,6 +1557,25 @@ else:
                     self.assertEqual(grad, input.grad, atol=0, rtol=0)
                 input.grad = None
 
+    @onlyCPU
+    @dtypes(torch.float, torch.double, torch.bfloat16)
+    def test_deterministic_sum(self, device, dtype):
+        # The deterministic path splits the reduction into fixed-size chunks
+        # independent of the thread count; check it against the regular sum.
+        for numel in [5, 1024, 65536 + 7, 3 * 65536]:
+            input = torch.randn(numel, device=device).to(dtype)
+            res = None
+            with DeterministicGuard(True):
+                for _ in range(3):
+                    out = input.sum()
+                    if res is None:
+                        res = out
+                    else:
+                        self.assertEqual(res, out, atol=0, rtol=0)
+            ref = input.double().sum().to(dtype)
+            tol = 1e-2 if dtype == torch.bfloat16 else 1e-4
+            self.assertEqual(res, ref, atol=tol * numel ** 0.5, rtol=tol)
+
     @skipIfTorchInductor("https://github.com/pytorch/pytorch/issues/113707")
     def test_deterministic_interpolate_bilinear(self, device):
         input = torch.randn(1, 2, 4, 4, device=device, requires_grad=True)
@@ -9650,6 +9669,41 @@ tensor([[[1.+1.j, 1.+1.j, 1.+1.j,  ..., 1.+1.j, 1.+1.j, 1.+1.j],
             with self.assertRaisesRegex(RuntimeError, r"expected a bool, but got int"):
                 torch.utils.deterministic.fill_uninitialized_memory = 1
 
+    # Tests the opt-in batched (Philox counter based) CPU random fill path
+    def test_parallel_cpu_random_fill(self):
+        self.assertFalse(torch._C._get_parallel_cpu_random_fill())
+        try:
+            torch._C._set_parallel_cpu_random_fill(True)
+            self.assertTrue(torch._C._get_parallel_cpu_random_fill())
+            for dtype in [torch.float, torch.double, torch.half, torch.bfloat16]:
+                # Same seed must reproduce the same fill, and consecutive
+                # fills must come from disjoint counter ranges.
+                torch.manual_seed(2)
+                a = torch.empty(10000, dtype=dtype).uniform_()
+                b = torch.empty(10000, dtype=dtype).uniform_()
+                torch.manual_seed(2)
+                c = torch.empty(10000, dtype=dtype).uniform_()
+                self.assertEqual(a, c)
+                self.assertNotEqual(a, b)
+                self.assertTrue((a >= 0).all() and (a < 1).all())
+
+                torch.manual_seed(2)
+                n1 = torch.empty(10000, dtype=dtype).normal_()
+                torch.manual_seed(2)
+                n2 = torch.empty(10000, dtype=dtype).normal_()
+                self.assertEqual(n1, n2)
+                if dtype in (torch.float, torch.double):
+                    self.assertEqual(n1.mean(), 0, atol=0.1, rtol=0)
+                    self.assertEqual(n1.std(), 1, atol=0.1, rtol=0)
+
+            # A non-contiguous fill falls back to the serial path and still
+            # only writes the viewed elements.
+            x = torch.zeros(100, 2)
+            x[:, 0].uniform_()
+            self.assertTrue((x[:, 1] == 0).all())
+        finally:
+            torch._C._set_parallel_cpu_random_fill(False)
+
     def test_type_conversion_via_dtype_name(self):
         x = torch.tensor([1])
         self.assertEqual(x.byte().dtype, torch.uint8)
@@ -10662,6 +10716,57 @@ tensor([[[1.+1.j, 1.+1.j, 1.+1.j,  ..., 1.+1.j, 1.+1.j, 1.+1.j],
         t7.d = "dog"
         self._checked_swap(t6, t7)
 
+    def test_swappable_tensor_group(self):
+        weights = [torch.rand(3, 4), torch.rand(5), torch.rand(2, 2, 2)]
+        group = torch.utils.SwappableTensorGroup(weights)
+
+        new_values = [torch.rand_like(w) for w in weights]
+        old_values = [w.clone() for w in weights]
+        old_aliases = [w.view_as(w) for w in weights]
+
+        group.stage_(new_values)
+        # staging must not disturb the live values
+        for w, old in zip(weights, old_values):
+            self.assertEqual(w, old)
+
+        group.commit_()
+        for w, old_alias, old, new in zip(weights, old_aliases, old_values, new_values):
+            # tensor identity is preserved, only the storage changed
+            self.assertEqual(w, new)
+            # views taken before the commit keep reading the old snapshot
+            self.assertEqual(old_alias, old)
+
+        # the old storages become the shadow buffer for the next cycle
+        next_values = [torch.rand_like(w) for w in weights]
+        group.stage_(next_values)
+        group.commit_()
+        for w, next_value in zip(weights, next_values):
+            self.assertEqual(w, next_value)
+
+        with self.assertRaisesRegex(ValueError, "expected 3 values"):
+            group.stage_(new_values[:2])
+        base = torch.rand(4)
+        with self.assertRaisesRegex(ValueError, "must not share storage"):
+            torch.utils.SwappableTensorGroup([base, base[1:]])
+        with self.assertRaisesRegex(RuntimeError, "as many storages as tensors"):
+            torch._C._swap_tensor_storages(weights, [weights[0].untyped_storage()])
+        with self.assertRaisesRegex(RuntimeError, "bytes"):
+            torch._C._swap_tensor_storages(
+                [weights[0]], [torch.UntypedStorage(1)]
+            )
+
+    def test_swappable_tensor_group_autograd(self):
+        w = torch.rand(4, requires_grad=True)
+        group = torch.utils.SwappableTensorGroup([w])
+        out = (w * w).sum()
+        group.stage_([torch.rand(4)])
+        group.commit_()
+        # the commit bumps the version counter, so backward through a graph
+        # recorded against the old values fails loudly instead of mixing
+        # old and new weights
+        with self.assertRaisesRegex(RuntimeError, "modified by an inplace operation"):
+            out.backward()
+
 
 # The following block extends TestTorch with negative dim wrapping tests
 # FIXME: replace these with OpInfo sample inputs or systemic OpInfo tests
@@ -1364,6 +1364,34 @@ class TestTransformers(NNTestCase):
         _test_te_fastpath_called(t, (src, tgt), return_value=t_return_value, is_called=True)
         _test_mha_fastpath_called(mha, (q, q, q,), return_value=mha_return_value, is_called=True)
 
+    @parametrize("dtype", [torch.float, torch.float16, torch.bfloat16])
+    @parametrize("interleaved", [False, True])
+    def test_apply_rotary_emb(self, device, dtype, interleaved):
+        def reference(qk, cos, sin):
+            cos = cos.view(1, cos.size(0), 1, cos.size(1))
+            sin = sin.view(1, sin.size(0), 1, sin.size(1))
+            if interleaved:
+                x0 = qk[..., 0::2]
+                x1 = qk[..., 1::2]
+                return torch.stack(
+                    (x0 * cos - x1 * sin, x1 * cos + x0 * sin), dim=-1).flatten(-2)
+            x0, x1 = qk.chunk(2, dim=-1)
+            return torch.cat((x0 * cos - x1 * sin, x1 * cos + x0 * sin), dim=-1)
+
+        batch, seq_len, num_heads, head_dim = 2, 5, 3, 38
+        qk = torch.randn(batch, seq_len, num_heads, head_dim, device=device, dtype=dtype)
+        angles = torch.rand(seq_len, head_dim // 2, device=device) * 2 * math.pi
+        cos = angles.cos().to(dtype)
+        sin = angles.sin().to(dtype)
+
+        atol, rtol = (None, None) if dtype is torch.float else (2e-2, 2e-2)
+        out = torch.ops.aten._apply_rotary_emb(qk, cos, sin, interleaved)
+        self.assertEqual(out, reference(qk, cos, sin), atol=atol, rtol=rtol)
+
+        qk_inplace = qk.clone()
+        torch.ops.aten._apply_rotary_emb_(qk_inplace, cos, sin, interleaved)
+        self.assertEqual(qk_inplace, out)
+
 
 class TestSDPAFailureModes(NNTestCase):
     """ Used to test the failure modes of scaled_dot_product_attention
@@ -1811,6 +1839,31 @@ class TestSDPA(NNTestCase):
                              (query, key, value, None, 0.0, False)
                              )
 
+    def test_scaled_dot_product_attention_gqa(self, device):
+        batch_size, seq_len, head_dim = 2, 16, 32
+        q_num_heads, kv_num_heads = 8, 2
+        make_tensor = partial(torch.randn, device=device, dtype=torch.float64)
+        query = make_tensor(batch_size, q_num_heads, seq_len, head_dim)
+        key = make_tensor(batch_size, kv_num_heads, seq_len, head_dim)
+        value = make_tensor(batch_size, kv_num_heads, seq_len, head_dim)
+
+        # enable_gqa matches manually repeating the key/value heads to the
+        # query head count
+        actual = torch.nn.functional.scaled_dot_product_attention(
+            query, key, value, enable_gqa=True)
+        expected = torch.nn.functional.scaled_dot_product_attention(
+            query,
+            key.repeat_interleave(q_num_heads // kv_num_heads, dim=-3),
+            value.repeat_interleave(q_num_heads // kv_num_heads, dim=-3))
+        self.assertEqual(actual, expected)
+
+        # The number of key/value heads must evenly divide the query heads
+        bad_key = make_tensor(batch_size, 3, seq_len, head_dim)
+        bad_value = make_tensor(batch_size, 3, seq_len, head_dim)
+        with self.assertRaisesRegex(RuntimeError, "evenly divide"):
+            torch.nn.functional.scaled_dot_product_attention(
+                query, bad_key, bad_value, enable_gqa=True)
+
     @onlyCPU
     @parametrize("type", ["dense", "nested"])
     @parametrize("dropout", [0.0, 0.7])
@@ -2319,6 +2372,65 @@ class TestSDPACudaOnly(NNTestCase):
         with torch.backends.cuda.sdp_kernel(enable_math=False, enable_flash=True, enable_mem_efficient=False):
             scaled_dot_product_attention(query, key, value)
 
+    @unittest.skipIf(not PLATFORM_SUPPORTS_FLASH_ATTENTION, "Does not support flash attention")
+    @parametrize("is_causal", [True, False])
+    def test_scaled_dot_product_attention_varlen(self, device, is_causal: bool):
+        num_heads, head_dim = 8, 64
+        seq_lens = [3, 17, 1, 32]
+        dtype = torch.float16
+        qs = [torch.randn(n, num_heads, head_dim, device=device, dtype=dtype) for n in seq_lens]
+        ks = [torch.randn(n, num_heads, head_dim, device=device, dtype=dtype) for n in seq_lens]
+        vs = [torch.randn(n, num_heads, head_dim, device=device, dtype=dtype) for n in seq_lens]
+        query, key, value = torch.cat(qs), torch.cat(ks), torch.cat(vs)
+        cum_seq = torch.cumsum(
+            torch.tensor([0] + seq_lens, device=device), dim=0, dtype=torch.int32)
+        max_len = max(seq_lens)
+
+        actual = torch.ops.aten._scaled_dot_product_attention_varlen(
+            query, key, value, cum_seq, cum_seq, max_len, max_len, is_causal=is_causal)
+        self.assertEqual(actual.shape, query.shape)
+
+        # Each sequence must match a dense per-sequence reference.
+        for i, seq_len in enumerate(seq_lens):
+            start, end = sum(seq_lens[:i]), sum(seq_lens[:i + 1])
+            q_i = qs[i].transpose(0, 1).unsqueeze(0).float()
+            k_i = ks[i].transpose(0, 1).unsqueeze(0).float()
+            v_i = vs[i].transpose(0, 1).unsqueeze(0).float()
+            with sdpa_kernel(backends=[SDPBackend.MATH]):
+                math_ref = torch.nn.functional.scaled_dot_product_attention(
+                    q_i, k_i, v_i, is_causal=is_causal)
+            math_ref = math_ref.squeeze(0).transpose(0, 1).to(dtype)
+            self.assertEqual(actual[start:end], math_ref, atol=2e-3, rtol=1e-2)
+
+    @parametrize("dtype", [torch.float, torch.float16, torch.bfloat16])
+    def test_paged_kv_cache_append(self, device, dtype):
+        batch_size, num_heads, head_dim = 4, 8, 64
+        num_blocks, block_size, max_blocks_per_seq = 16, 4, 4
+        key_cache = torch.zeros(
+            num_blocks, block_size, num_heads, head_dim, device=device, dtype=dtype)
+        value_cache = torch.zeros_like(key_cache)
+        # Deliberately non-contiguous logical->physical block mapping.
+        block_table = torch.randperm(num_blocks, device=device, dtype=torch.int32)
+        block_table = block_table[:batch_size * max_blocks_per_seq].view(
+            batch_size, max_blocks_per_seq)
+
+        ref_key_cache = key_cache.clone()
+        ref_value_cache = value_cache.clone()
+        seq_lens_cpu = [0, 3, 7, 12]
+        for step in range(3):
+            seq_lens = torch.tensor(seq_lens_cpu, device=device, dtype=torch.int32)
+            key = torch.randn(batch_size, num_heads, head_dim, device=device, dtype=dtype)
+            value = torch.randn(batch_size, num_heads, head_dim, device=device, dtype=dtype)
+            torch.ops.aten._paged_kv_cache_append_(
+                key_cache, value_cache, key, value, block_table, seq_lens)
+            for b, pos in enumerate(seq_lens_cpu):
+                block = block_table[b][pos // block_size]
+                ref_key_cache[block][pos % block_size] = key[b]
+                ref_value_cache[block][pos % block_size] = value[b]
+            seq_lens_cpu = [pos + 1 for pos in seq_lens_cpu]
+        self.assertEqual(key_cache, ref_key_cache, atol=0, rtol=0)
+        self.assertEqual(value_cache, ref_value_cache, atol=0, rtol=0)
+
     @unittest.skipIf(not PLATFORM_SUPPORTS_MEM_EFF_ATTENTION, "Fused SDPA was not built for this system")
     @parametrize("type", ["dense", "nested"])
     @parametrize("is_contiguous", [True, False])
@@ -116,6 +116,8 @@ def _saved_tensors_hooks_enable() -> None: ...
 def _saved_tensors_hooks_disable(message: str) -> None: ...
 def _saved_tensors_hooks_get_disabled_error_message() -> Optional[str]: ...
 def _saved_tensors_hooks_set_tracing(is_tracing: bool) -> bool: ...
+def _saved_tensors_set_offload_to_cpu(offload: bool) -> bool: ...
+def _saved_tensors_get_offload_to_cpu() -> bool: ...
 
 class CreationMeta(Enum):
     DEFAULT = ...
@@ -8,3 +8,4 @@ def set_autograd_compiler(
 def clear_cache() -> None: ...
 def is_cache_empty() -> bool: ...
 def set_verbose_logger(fn: Optional[Callable[[str], None]]) -> bool: ...
+def set_default_dyn_type(dynamic: bool) -> bool: ...
@@ -25,6 +25,18 @@ class Stat:
     def add(self, v: float) -> None: ...
     def get(self) -> Dict[Aggregation, float]: ...
 
+class Histogram:
+    name: str
+    count: int
+    def __init__(self, name: str) -> None: ...
+    def record(self, value: int) -> None: ...
+    def percentile(self, p: float) -> int: ...
+    def log(self) -> None: ...
+
+def _enable_op_latency_histograms() -> None: ...
+def _disable_op_latency_histograms() -> None: ...
+def _log_op_latency_histograms() -> None: ...
+
 class Event:
     name: str
     timestamp: datetime.datetime
@@ -361,10 +361,16 @@ in_compiled_autograd_region = False
 
 
 @contextlib.contextmanager
-def enable(compiler_fn):
+def enable(compiler_fn, dynamic: bool = False):
+    # dynamic=True captures all autograd node sizes symbolically up front,
+    # so one compiled backward is reused across batch sizes. The default
+    # (dynamic=False) specializes on exact sizes and retraces once per size
+    # input observed to change. Only newly-created cache entries are affected;
+    # call torch._dynamo.compiled_autograd.reset() to drop existing ones.
     prior = torch._C._dynamo.compiled_autograd.set_autograd_compiler(
         functools.partial(AutogradCompilerInstance, compiler_fn)
     )
+    prior_dynamic = torch._C._dynamo.compiled_autograd.set_default_dyn_type(dynamic)
     if snapshot_verbose_logging_enabled():
         torch._C._dynamo.compiled_autograd.set_verbose_logger(cpp_verbose_log_fn)
     global compiled_autograd_enabled
@@ -376,6 +382,7 @@ def enable(compiler_fn):
         if not prior:
             compiled_autograd_enabled = False
         torch._C._dynamo.compiled_autograd.set_autograd_compiler(prior)
+        torch._C._dynamo.compiled_autograd.set_default_dyn_type(prior_dynamic)
 
 
 @contextlib.contextmanager
@@ -397,3 +404,4 @@ def reset() -> None:
     assert not in_compiled_autograd_region
     torch._C._dynamo.compiled_autograd.set_autograd_compiler(None)
     torch._C._dynamo.compiled_autograd.set_verbose_logger(None)
+    torch._C._dynamo.compiled_autograd.set_default_dyn_type(False)
@@ -1875,6 +1875,103 @@ def aoti_compile_with_persistent_cache(
             return ""
 
 
+def package_aoti_eager_cache(
+    package_path: str,
+    ns: Optional[str] = None,
+    device_type: Optional[str] = None,
+) -> str:
+    """
+    Bundle the aoti_eager persistent cache (kernel libraries plus the per-op
+    JSON confs) into a single zip archive, optionally restricted to one
+    namespace and/or device type. The archive can be shipped to other hosts
+    and installed with load_aoti_eager_package so fresh processes start with
+    a warm kernel cache instead of recompiling on first call. Returns the
+    package path, or an empty string when there is nothing to package.
+    """
+    import zipfile
+
+    cache_root = Path(cache_dir()) / "aoti_eager"
+    base = cache_root
+    if ns is not None:
+        base = base / ns
+        if device_type is not None:
+            base = base / device_type
+    if not base.exists():
+        return ""
+
+    num_packaged = 0
+    with zipfile.ZipFile(package_path, "w", zipfile.ZIP_DEFLATED) as package:
+        for file_path in sorted(base.rglob("*")):
+            if file_path.is_file():
+                package.write(
+                    file_path, file_path.relative_to(cache_root).as_posix()
+                )
+                num_packaged += 1
+    if num_packaged == 0:
+        os.remove(package_path)
+        return ""
+    return str(package_path)
+
+
+def load_aoti_eager_package(package_path: str) -> int:
+    """
+    Install a package produced by package_aoti_eager_cache into this
+    process's aoti_eager cache. Kernel libraries are extracted verbatim
+    (existing files are kept), and each per-op JSON conf is merged
+    entry-by-entry under the op conf lock, so the package can be layered on
+    top of locally compiled kernels. Returns the number of kernel entries
+    newly installed; ops registered afterwards via
+    register_ops_with_aoti_compile pick the kernels up through
+    load_aoti_eager_cache without compiling.
+    """
+    import zipfile
+
+    cache_root = Path(cache_dir()) / "aoti_eager"
+    num_installed = 0
+    with zipfile.ZipFile(package_path) as package:
+        names = package.namelist()
+        for name in names:
+            if name.endswith(".json") or name.endswith("/"):
+                continue
+            dest = cache_root / name
+            try:
+                dest.resolve().relative_to(cache_root.resolve())
+            except ValueError:
+                # Entry escapes the cache directory; refuse to extract it.
+                continue
+            if dest.exists():
+                continue
+            dest.parent.mkdir(parents=True, exist_ok=True)
+            with package.open(name) as src, open(dest, "wb") as dst:
+                shutil.copyfileobj(src, dst)
+
+        for name in names:
+            if not name.endswith(".json"):
+                continue
+            packaged_data = json.loads(package.read(name))
+            op_func_name_with_overload = Path(name).stem
+            op_conf = cache_root / name
+            op_conf.parent.mkdir(parents=True, exist_ok=True)
+            with aoti_eager_op_conf_lock(op_func_name_with_overload):
+                json_data = []
+                if op_conf.exists():
+                    with open(op_conf) as op_conf_file:
+                        try:
+                            json_data = json.load(op_conf_file)
+                        except Exception:
+                            json_data = []
+                for item in packaged_data:
+                    if all(
+                        item["meta_info"] != existing["meta_info"]
+                        for existing in json_data
+                    ):
+                        json_data.append(item)
+                        num_installed += 1
+                with open(op_conf, "w") as op_conf_file:
+                    json.dump(json_data, op_conf_file, indent=4)
+    return num_installed
+
+
 def run_and_get_cpp_code(fn, *args, **kwargs):
     # We use the patch context manager instead of using it as a decorator.
     # In this way, we can ensure that the attribute is patched and unpatched correctly
@@ -3301,6 +3301,33 @@ def meta__weight_int8pack_mm(x, w, q_scales):
     return x.new_empty(x.size(0), w.size(0), dtype=x.dtype)
 
 
+@register_meta(aten._fused_cross_entropy_loss.default)
+def meta__fused_cross_entropy_loss(self, target, ignore_index=-100):
+    torch._check(
+        self.dim() == 2,
+        lambda: "_fused_cross_entropy_loss: input tensor should be 2D",
+    )
+    torch._check(
+        target.dim() == 1 and target.size(0) == self.size(0),
+        lambda: (
+            f"_fused_cross_entropy_loss: size mismatch (got input: {self.shape}, "
+            f"target: {target.shape})"
+        ),
+    )
+    output = self.new_empty(self.size(0))
+    logsumexp = self.new_empty(
+        self.size(0), dtype=utils.get_computation_dtype(self.dtype)
+    )
+    return output, logsumexp
+
+
+@register_meta(aten._fused_cross_entropy_loss_backward.default)
+def meta__fused_cross_entropy_loss_backward(
+    grad_output, self, target, logsumexp, ignore_index=-100
+):
+    return torch.empty_like(self, memory_format=torch.contiguous_format)
+
+
 @register_meta(aten._cdist_forward.default)
 def meta_cdist_forward(x1, x2, p, compute_mode):
     torch._check(
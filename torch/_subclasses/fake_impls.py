@@ -1218,6 +1218,48 @@ def make_fast_binary_impl(slow_ref):
     return fast_binary_impl
 
 
+def make_fast_unary_impl(slow_ref):
+    def fast_unary_impl(mode, *args, **kwargs):
+        def slow(msg):
+            count_label(f"slow {msg}")
+            with mode:
+                return slow_ref(*args, **kwargs)
+
+        count_label("attempt fast unary")
+
+        if kwargs or len(args) != 1 or not isinstance(args[0], torch.Tensor):
+            return slow("unexpected args")
+        (t,) = args
+
+        # Type promotion can change the output dtype for non-floating inputs
+        # (e.g. exp(int) -> float), so keep the fast path to the common case
+        # where the output metadata is just the input metadata.
+        if not t.dtype.is_floating_point:
+            return slow("non-floating dtype")
+
+        if t.is_contiguous(memory_format=torch.contiguous_format):
+            count_label("fast unary is_contiguous")
+            memory_format = torch.contiguous_format
+        elif t.is_contiguous(memory_format=torch.channels_last):
+            count_label("fast unary channels_last")
+            memory_format = torch.channels_last
+        else:
+            return slow("no contiguity match")
+
+        return FakeTensor(
+            mode,
+            torch.empty(
+                t.shape,
+                dtype=t.dtype,
+                device="meta",
+                memory_format=memory_format,
+            ),
+            device=t.device,
+        )
+
+    return fast_unary_impl
+
+
 @functools.lru_cache(None)
 def get_fast_op_impls():
     import torch._refs
@@ -1232,4 +1274,17 @@ def get_fast_op_impls():
     register_fast_op_impl(torch.ops.aten.div.Tensor)(
         make_fast_binary_impl(torch._refs.div)
     )
+    # Pointwise unary ops are the bulk of what traces push through the
+    # dispatcher; their output metadata is a copy of the input metadata.
+    for fast_unary_op, unary_ref in [
+        (torch.ops.aten.relu.default, torch._refs.nn.functional.relu),
+        (torch.ops.aten.sigmoid.default, torch._refs.sigmoid),
+        (torch.ops.aten.tanh.default, torch._refs.tanh),
+        (torch.ops.aten.gelu.default, torch._refs.nn.functional.gelu),
+        (torch.ops.aten.neg.default, torch._refs.neg),
+        (torch.ops.aten.abs.default, torch._refs.abs),
+        (torch.ops.aten.exp.default, torch._refs.exp),
+        (torch.ops.aten.rsqrt.default, torch._refs.rsqrt),
+    ]:
+        register_fast_op_impl(fast_unary_op)(make_fast_unary_impl(unary_ref))
     return FAST_OP_IMPLEMENTATIONS
@@ -32,6 +32,8 @@ log = logging.getLogger(__name__)
 __all__ = [
     "saved_tensors_hooks",
     "save_on_cpu",
+    "save_on_cpu_async",
+    "save_under_memory_budget",
     "disable_saved_tensors_hooks",
     "register_multi_grad_hook",
     "allow_mutation_on_saved_tensors",
@@ -347,6 +349,85 @@ class save_on_cpu(saved_tensors_hooks):
         super().__init__(pack_to_cpu, unpack_from_cpu)
 
 
+class save_on_cpu_async:
+    """Context manager under which saved tensors are offloaded to pinned CPU memory asynchronously.
+
+    The native counterpart of :class:`save_on_cpu`: packing and unpacking
+    run entirely in C++ without crossing into the interpreter, the
+    device-to-host copy is issued on a side stream into pinned staging
+    memory so the forward pass is not stalled by the offload, and the
+    backward pass orders the copy back through events instead of
+    synchronizing with the host. Tensors already on CPU, and tensors too
+    small for the staging round trip to pay off, are saved as-is.
+
+    Explicit :class:`saved_tensors_hooks` installed inside this context
+    take precedence over the offload.
+
+    Example::
+
+        >>> # xdoctest: +REQUIRES(env:TORCH_DOCTEST_CUDA)
+        >>> # xdoctest: +REQUIRES(env:TORCH_DOCTEST_AUTOGRAD)
+        >>> a = torch.randn(1024, 1024, requires_grad=True, device="cuda")
+        >>> with torch.autograd.graph.save_on_cpu_async():
+        ...     # activations saved here live in pinned CPU memory
+        ...     y = (a * a).sum()
+        >>> y.backward()
+    """
+
+    def __enter__(self):
+        self.prev = torch._C._autograd._saved_tensors_set_offload_to_cpu(True)
+        return self
+
+    def __exit__(self, *args: object):
+        torch._C._autograd._saved_tensors_set_offload_to_cpu(self.prev)
+
+
+class save_under_memory_budget:
+    """Context manager under which saved tensors are dropped and recomputed to fit a memory budget.
+
+    A native, cost-model driven counterpart of activation checkpointing:
+    while the total bytes saved for backward stay under ``budget_bytes``,
+    tensors are saved as usual. Once the budget is exceeded, activations
+    whose producing op is cheap to replay (elementwise and similar ops, but
+    never matmuls, convolutions, in-place or random ops) are dropped at save
+    time and transparently recomputed from the producer's inputs during
+    backward. No wrapping of the model is required, and since the whole
+    mechanism lives in C++ it also applies to TorchScript and C++ frontend
+    training.
+
+    Explicit :class:`saved_tensors_hooks` installed inside this context take
+    precedence over the budget mode.
+
+    Args:
+        budget_bytes (int): maximum number of bytes of activations this mode
+            keeps alive before it starts dropping recomputable ones.
+
+    Example::
+
+        >>> # xdoctest: +REQUIRES(env:TORCH_DOCTEST_AUTOGRAD)
+        >>> a = torch.randn(1024, 1024, requires_grad=True)
+        >>> with torch.autograd.graph.save_under_memory_budget(1024 * 1024):
+        ...     y = (a * 2).relu().sum()
+        >>> y.backward()
+    """
+
+    def __init__(self, budget_bytes: int):
+        if budget_bytes < 0:
+            raise ValueError(
+                f"budget_bytes must be non-negative, got {budget_bytes}"
+            )
+        self.budget_bytes = budget_bytes
+
+    def __enter__(self):
+        self.prev = torch._C._autograd._saved_tensors_set_memory_budget(
+            self.budget_bytes
+        )
+        return self
+
+    def __exit__(self, *args: object):
+        torch._C._autograd._saved_tensors_set_memory_budget(self.prev)
+
+
 @contextlib.contextmanager
 def disable_saved_tensors_hooks(error_message):
     """Context-manager that disables the saved tensors default hooks feature.
@@ -48,6 +48,7 @@
 #include <torch/csrc/Layout.h>
 #include <torch/csrc/MemoryFormat.h>
 #include <torch/csrc/QScheme.h>
+#include <torch/csrc/Storage.h>
 #include <torch/csrc/Stream.h>
 #include <torch/csrc/THP.h>
 #include <torch/csrc/TypeInfo.h>
@@ -415,6 +416,88 @@ PyObject* THPModule_swap_tensor_impl(PyObject* _unused, PyObject* args) {
   END_HANDLE_TH_ERRORS
 }
 
+PyObject* THPModule_swap_tensor_storages(PyObject* _unused, PyObject* args) {
+  HANDLE_TH_ERRORS
+  PyObject* tensors_ = nullptr;
+  PyObject* storages_ = nullptr;
+  if (!PyArg_ParseTuple(args, "OO", &tensors_, &storages_)) {
+    return nullptr;
+  }
+
+  THPObjectPtr tensors(
+      PySequence_Fast(tensors_, "expected a sequence of Tensors"));
+  if (!tensors) {
+    return nullptr;
+  }
+  THPObjectPtr storages(
+      PySequence_Fast(storages_, "expected a sequence of Storages"));
+  if (!storages) {
+    return nullptr;
+  }
+
+  const Py_ssize_t size = PySequence_Fast_GET_SIZE(tensors.get());
+  TORCH_CHECK(
+      size == PySequence_Fast_GET_SIZE(storages.get()),
+      "Expected as many storages as tensors but got ",
+      size,
+      " tensors and ",
+      PySequence_Fast_GET_SIZE(storages.get()),
+      " storages");
+
+  // Validate everything up front so the flip below cannot fail halfway
+  // through and leave the tensor set in a mixed old/new state.
+  for (const auto i : c10::irange(size)) {
+    PyObject* t_ = PySequence_Fast_GET_ITEM(tensors.get(), i);
+    PyObject* s_ = PySequence_Fast_GET_ITEM(storages.get(), i);
+    TORCH_CHECK(
+        THPVariable_Check(t_), "Expected a Tensor at position ", i);
+    TORCH_CHECK(
+        THPStorage_Check(s_), "Expected a Storage at position ", i);
+    const auto& t = THPVariable_Unpack(t_);
+    const auto& s = THPStorage_Unpack(s_);
+    TORCH_CHECK(
+        t.unsafeGetTensorImpl()->has_storage(),
+        "Tensor at position ",
+        i,
+        " does not have a storage");
+    TORCH_CHECK(
+        s.device() == t.storage().device(),
+        "Storage at position ",
+        i,
+        " is on ",
+        s.device(),
+        " but the tensor's storage is on ",
+        t.storage().device());
+    TORCH_CHECK(
+        s.nbytes() == t.storage().nbytes(),
+        "Storage at position ",
+        i,
+        " has ",
+        s.nbytes(),
+        " bytes but the tensor's storage has ",
+        t.storage().nbytes(),
+        " bytes");
+  }
+
+  // Flip every tensor onto its replacement storage. No data is copied and
+  // the GIL is held throughout, so other Python threads observe either all
+  // old or all new storages. The previous StorageImpls stay alive (and keep
+  // their old contents readable) for as long as anything still references
+  // them, e.g. Python storage objects or views created before the flip.
+  for (const auto i : c10::irange(size)) {
+    const auto& t =
+        THPVariable_Unpack(PySequence_Fast_GET_ITEM(tensors.get(), i));
+    const auto& s =
+        THPStorage_Unpack(PySequence_Fast_GET_ITEM(storages.get(), i));
+    auto* impl = t.unsafeGetTensorImpl();
+    impl->set_storage_keep_dtype(s);
+    impl->bump_version();
+  }
+
+  Py_RETURN_NONE;
+  END_HANDLE_TH_ERRORS
+}
+
 PyObject* THPModule_addDocStr(PyObject* _unused, PyObject* args) {
   // adds a __doc__ string to a function, similar to numpy's arr_add_docstring
   static std::vector<std::string> all_docs;
@@ -888,6 +971,24 @@ PyObject* THPModule_deterministicFillUninitializedMemory(
     Py_RETURN_FALSE;
 }
 
+PyObject* THPModule_setParallelCpuRandomFill(
+    PyObject* _unused,
+    PyObject* arg) {
+  HANDLE_TH_ERRORS
+  TORCH_CHECK(
+      PyBool_Check(arg), "expected a bool, but got ", THPUtils_typename(arg));
+  at::globalContext().setParallelCpuRandomFill(arg == Py_True);
+  Py_RETURN_NONE;
+  END_HANDLE_TH_ERRORS
+}
+
+PyObject* THPModule_parallelCpuRandomFill(PyObject* _unused, PyObject* noargs) {
+  if (at::globalContext().parallelCpuRandomFill())
+    Py_RETURN_TRUE;
+  else
+    Py_RETURN_FALSE;
+}
+
 PyObject* THPModule_setUserEnabledNNPACK(PyObject* _unused, PyObject* arg) {
   HANDLE_TH_ERRORS
   TORCH_CHECK(
@@ -1045,6 +1146,25 @@ PyObject* THPModule_allowFP16ReductionCPU(PyObject* _unused, PyObject* noargs) {
   Py_RETURN_FALSE;
 }
 
+PyObject* THPModule_setAllowBF16ReductionCPU(PyObject* _unused, PyObject* arg) {
+  HANDLE_TH_ERRORS
+  TORCH_CHECK(
+      PyBool_Check(arg),
+      "set_allow_bf16_reduction_cpu expects a bool, "
+      "but got ",
+      THPUtils_typename(arg));
+  at::globalContext().setAllowBF16ReductionCPU(arg == Py_True);
+  Py_RETURN_NONE;
+  END_HANDLE_TH_ERRORS
+}
+
+PyObject* THPModule_allowBF16ReductionCPU(PyObject* _unused, PyObject* noargs) {
+  if (at::globalContext().allowBF16ReductionCPU()) {
+    Py_RETURN_TRUE;
+  }
+  Py_RETURN_FALSE;
+}
+
 PyObject* THPModule_setFlushDenormal(PyObject* _unused, PyObject* arg) {
   HANDLE_TH_ERRORS
   TORCH_CHECK(
@@ -1280,6 +1400,10 @@ static PyMethodDef TorchMethods[] = { // NOLINT
     {"_autograd_init", THPAutograd_initExtension, METH_NOARGS, nullptr},
     {"_add_docstr", THPModule_addDocStr, METH_VARARGS, nullptr},
     {"_swap_tensor_impl", THPModule_swap_tensor_impl, METH_VARARGS, nullptr},
+    {"_swap_tensor_storages",
+     THPModule_swap_tensor_storages,
+     METH_VARARGS,
+     nullptr},
     {"_init_names", THPModule_initNames, METH_O, nullptr},
     {"_has_distributed", THPModule_hasDistributed, METH_NOARGS, nullptr},
     {"_set_default_tensor_type",
@@ -1394,6 +1518,14 @@ static PyMethodDef TorchMethods[] = { // NOLINT
      THPModule_setDeterministicFillUninitializedMemory,
      METH_O,
      nullptr},
+    {"_get_parallel_cpu_random_fill",
+     THPModule_parallelCpuRandomFill,
+     METH_NOARGS,
+     nullptr},
+    {"_set_parallel_cpu_random_fill",
+     THPModule_setParallelCpuRandomFill,
+     METH_O,
+     nullptr},
     {"_get_nnpack_enabled", THPModule_userEnabledNNPACK, METH_NOARGS, nullptr},
     {"_set_nnpack_enabled", THPModule_setUserEnabledNNPACK, METH_O, nullptr},
     {"_get_warnAlways", THPModule_warnAlways, METH_NOARGS, nullptr},
@@ -1434,6 +1566,14 @@ static PyMethodDef TorchMethods[] = { // NOLINT
      THPModule_setAllowFP16ReductionCPU,
      METH_O,
      nullptr},
+    {"_get_cpu_allow_bf16_reduced_precision_reduction",
+     THPModule_allowBF16ReductionCPU,
+     METH_NOARGS,
+     nullptr},
+    {"_set_cpu_allow_bf16_reduced_precision_reduction",
+     THPModule_setAllowBF16ReductionCPU,
+     METH_O,
+     nullptr},
     {"_vmapmode_increment_nesting",
      THPModule_vmapmode_increment_nesting,
      METH_NOARGS,
@@ -1803,6 +1943,7 @@ Call this whenever a new thread is created in order to propagate values from
       .value("CudaDepthwise3d", at::native::ConvBackend::CudaDepthwise3d)
       .value("Cudnn", at::native::ConvBackend::Cudnn)
       .value("CudnnTranspose", at::native::ConvBackend::CudnnTranspose)
+      .value("DirectNhwc2d", at::native::ConvBackend::DirectNhwc2d)
       .value("Empty", at::native::ConvBackend::Empty)
       .value("Miopen", at::native::ConvBackend::Miopen)
       .value("MiopenDepthwise", at::native::ConvBackend::MiopenDepthwise)
@@ -1909,16 +2050,24 @@ Call this whenever a new thread is created in order to propagate values from
                        at::Tensor const& value,
                        std::optional<at::Tensor> attn_mask,
                        double dropout,
-                       bool is_causal) {
+                       bool is_causal,
+                       bool enable_gqa) {
         return sdp::sdp_params{
-            query, key, value, std::move(attn_mask), dropout, is_causal};
+            query,
+            key,
+            value,
+            std::move(attn_mask),
+            dropout,
+            is_causal,
+            enable_gqa};
       }))
       .def_readonly("query", &sdp::sdp_params::query)
       .def_readonly("key", &sdp::sdp_params::key)
       .def_readonly("value", &sdp::sdp_params::value)
       .def_readonly("attn_mask", &sdp::sdp_params::attn_mask)
       .def_readonly("dropout", &sdp::sdp_params::dropout)
-      .def_readonly("is_causal", &sdp::sdp_params::is_causal);
+      .def_readonly("is_causal", &sdp::sdp_params::is_causal)
+      .def_readonly("enable_gqa", &sdp::sdp_params::enable_gqa);
 
   py::enum_<sdp::SDPBackend>(
       py_module,
@@ -0,0 +1,333 @@
+#pragma once
+
+#include <torch/arg.h>
+#include <torch/data/detail/queue.h>
+#include <torch/data/example.h>
+#include <torch/data/iterator.h>
+#include <torch/data/worker_exception.h>
+#include <torch/types.h>
+
+#include <c10/core/Event.h>
+#include <c10/core/Stream.h>
+#include <c10/core/StreamGuard.h>
+#include <c10/core/impl/VirtualGuardImpl.h>
+#include <c10/util/Exception.h>
+#include <c10/util/irange.h>
+
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace torch {
+namespace data {
+
+/// Options to configure a `DevicePrefetcher`.
+struct DevicePrefetcherOptions {
+  DevicePrefetcherOptions() = default;
+  /* implicit */ DevicePrefetcherOptions(size_t depth) : depth_(depth) {}
+
+  /// The number of batches transferred ahead of consumption. Bounds both the
+  /// device memory held by staged batches and how far the transfer thread may
+  /// run ahead of the consumer.
+  TORCH_ARG(size_t, depth) = 2;
+
+  /// Whether to stage CPU tensors in pinned memory before the copy. Pinned
+  /// staging is what allows the copy to be asynchronous and overlap with
+  /// compute; disable it only if the dataset already produces pinned tensors.
+  TORCH_ARG(bool, pin_memory) = true;
+};
+
+namespace detail {
+
+/// Moves a batch (or a constituent of one) to `device`, staging CPU tensors
+/// in pinned memory first when requested. These overloads cover the batch
+/// types produced by the bundled datasets and transforms; user-defined batch
+/// types can add further overloads in this namespace.
+inline at::Tensor to_device(at::Tensor tensor, Device device, bool pin_memory);
+template <typename Data>
+Example<Data, example::NoTarget> to_device(
+    Example<Data, example::NoTarget> example,
+    Device device,
+    bool pin_memory);
+template <typename Data, typename Target>
+Example<Data, Target> to_device(
+    Example<Data, Target> example,
+    Device device,
+    bool pin_memory);
+template <typename T>
+std::vector<T> to_device(std::vector<T> batch, Device device, bool pin_memory);
+
+inline at::Tensor to_device(at::Tensor tensor, Device device, bool pin_memory) {
+  if (!tensor.defined() || tensor.device() == device) {
+    return tensor;
+  }
+  if (pin_memory && tensor.device().is_cpu() && !tensor.is_pinned(device)) {
+    tensor = tensor.pin_memory(device);
+  }
+  return tensor.to(device, /*non_blocking=*/true);
+}
+
+template <typename Data>
+Example<Data, example::NoTarget> to_device(
+    Example<Data, example::NoTarget> example,
+    Device device,
+    bool pin_memory) {
+  example.data = to_device(std::move(example.data), device, pin_memory);
+  return example;
+}
+
+template <typename Data, typename Target>
+Example<Data, Target> to_device(
+    Example<Data, Target> example,
+    Device device,
+    bool pin_memory) {
+  example.data = to_device(std::move(example.data), device, pin_memory);
+  example.target = to_device(std::move(example.target), device, pin_memory);
+  return example;
+}
+
+template <typename T>
+std::vector<T> to_device(std::vector<T> batch, Device device, bool pin_memory) {
+  for (auto& example : batch) {
+    example = to_device(std::move(example), device, pin_memory);
+  }
+  return batch;
+}
+
+} // namespace detail
+
+/// Wraps a `DataLoader` with a device-transfer stage.
+///
+/// A dedicated thread pops CPU batches from the underlying loader, stages
+/// them in pinned memory, and copies them to `device` on a dedicated stream,
+/// running up to `depth` batches ahead of the consumer. Every staged batch
+/// carries an event recorded on the transfer stream after its copy; `next()`
+/// makes the consumer's current stream wait on that event instead of blocking
+/// the host, so compute on delivered batches overlaps with the transfer of
+/// the following ones.
+///
+/// A *device stage* may additionally be attached: a function applied to each
+/// batch on the transfer stream after the copy, before the batch is handed to
+/// the consumer. This is the hook for device-side decode/augmentation
+/// pipelines — ship compact encoded bytes across PCIe and decode or resize on
+/// the device (e.g. through an nvJPEG binding), overlapping with training
+/// compute. The readiness event delivered with each batch covers both the
+/// copy and the stage, so the consumer needs no extra synchronization.
+///
+/// Like the `DataLoader` itself, the prefetcher is exhausted one epoch at a
+/// time and may be re-iterated for the next epoch:
+///
+/// \rst
+/// .. code-block:: cpp
+///
+///   auto loader = torch::data::make_data_loader(std::move(dataset), 64);
+///   torch::data::DevicePrefetcher prefetcher(
+///       *loader,
+///       torch::kCUDA,
+///       [](auto batch) { return decode_and_resize(std::move(batch)); });
+///   for (auto& batch : prefetcher) {
+///     // `batch` lives on the GPU, is decoded, and the current stream
+///     // already waits on it.
+///   }
+/// \endrst
+template <typename DataLoader>
+class DevicePrefetcher {
+ public:
+  using BatchType = typename DataLoader::BatchType;
+
+  /// A transform applied to each batch on the transfer stream after the
+  /// device copy. It runs on the transfer thread with the transfer stream
+  /// current, so device work it enqueues overlaps with consumer compute.
+  using DeviceStage = std::function<BatchType(BatchType)>;
+
+  DevicePrefetcher(
+      DataLoader& loader,
+      Device device,
+      DevicePrefetcherOptions options = {})
+      : loader_(loader), device_(device), options_(std::move(options)) {
+    TORCH_CHECK(
+        options_.depth() > 0, "DevicePrefetcher `depth` must be positive");
+  }
+
+  DevicePrefetcher(
+      DataLoader& loader,
+      Device device,
+      DeviceStage stage,
+      DevicePrefetcherOptions options = {})
+      : DevicePrefetcher(loader, device, std::move(options)) {
+    stage_ = std::move(stage);
+  }
+
+  DevicePrefetcher(const DevicePrefetcher&) = delete;
+  DevicePrefetcher& operator=(const DevicePrefetcher&) = delete;
+
+  // NOLINTNEXTLINE(bugprone-exception-escape)
+  ~DevicePrefetcher() {
+    join();
+  }
+
+  /// Returns an iterator over the transferred batches of one epoch. Starts
+  /// the transfer thread, which in turn begins an epoch on the underlying
+  /// `DataLoader`. The same iterator contract as for the `DataLoader`
+  /// applies: one active iterator at a time, incremented forward only.
+  Iterator<BatchType> begin() {
+    TORCH_CHECK(
+        !worker_.joinable(),
+        "Attempted to get a new DevicePrefetcher iterator "
+        "while another iterator is not yet exhausted");
+    quit_ = false;
+    results_.clear();
+    slots_.clear();
+    for (const auto s : c10::irange(options_.depth())) {
+      (void)s; // Suppress unused variable warning
+      slots_.push(Slot{});
+    }
+    worker_ = std::thread([this] { this->worker_thread(); });
+    return Iterator<BatchType>(
+        std::make_unique<detail::ValidIterator<BatchType>>(
+            [this] { return this->next(); }));
+  }
+
+  /// Returns a sentinel iterator that compares equal with a non-sentinel
+  /// iterator once the epoch is exhausted.
+  Iterator<BatchType> end() {
+    return Iterator<BatchType>(
+        std::make_unique<detail::SentinelIterator<BatchType>>());
+  }
+
+  /// Stops the transfer thread and discards staged batches. Called implicitly
+  /// when an epoch is exhausted and by the destructor. If the epoch was not
+  /// exhausted, the underlying `DataLoader` is left mid-epoch.
+  void join() {
+    if (!worker_.joinable()) {
+      return;
+    }
+    quit_ = true;
+    // Wake the worker if it is blocked waiting for a free slot.
+    slots_.push(Slot{});
+    worker_.join();
+    results_.clear();
+    slots_.clear();
+  }
+
+  /// Returns the options with which the `DevicePrefetcher` was configured.
+  const DevicePrefetcherOptions& options() const noexcept {
+    return options_;
+  }
+
+  /// Returns the device batches are transferred to.
+  Device device() const noexcept {
+    return device_;
+  }
+
+ private:
+  /// A token granting the transfer thread the right to stage one batch;
+  /// `depth` many circulate between the consumer and the transfer thread.
+  struct Slot {};
+
+  /// A transferred batch queued for the consumer. `ready` is recorded on the
+  /// transfer stream after the copy; an empty `batch` without an `exception`
+  /// marks the end of the epoch. The event is held through a `shared_ptr`
+  /// because `detail::Queue` requires copyable elements and `c10::Event` is
+  /// move-only.
+  struct Result {
+    optional<BatchType> batch;
+    std::shared_ptr<c10::Event> ready;
+    std::exception_ptr exception;
+  };
+
+  /// Returns the next transferred batch, or an empty `optional` once the
+  /// epoch is exhausted.
+  optional<BatchType> next() {
+    Result result = results_.pop(loader_.options().timeout);
+    if (result.exception) {
+      join();
+      throw WorkerException(result.exception);
+    }
+    if (!result.batch) {
+      join();
+      return nullopt;
+    }
+    slots_.push(Slot{});
+    if (result.ready) {
+      // Chain the transfer into the consumer's current stream rather than
+      // synchronizing the host on it.
+      c10::impl::VirtualGuardImpl impl(device_.type());
+      result.ready->block(impl.getStream(device_));
+    }
+    return std::move(result.batch);
+  }
+
+  /// The function the transfer thread runs: pulls batches from the underlying
+  /// loader, copies them to the device on the dedicated stream and hands them
+  /// to the consumer together with an event marking transfer completion.
+  void worker_thread() {
+    optional<c10::Stream> stream;
+    if (!device_.is_cpu()) {
+      c10::impl::VirtualGuardImpl impl(device_.type());
+      stream.emplace(
+          impl.getStreamFromGlobalPool(device_, /*isHighPriority=*/false));
+    }
+    try {
+      for (auto& batch : loader_) {
+        slots_.pop();
+        if (quit_) {
+          return;
+        }
+        Result result;
+        if (stream) {
+          c10::StreamGuard guard(*stream);
+          result.batch = detail::to_device(
+              std::move(batch), device_, options_.pin_memory());
+          if (stage_) {
+            // On the transfer stream, so the event below also covers any
+            // device work enqueued by the stage.
+            result.batch = stage_(*std::move(result.batch));
+          }
+          result.ready = std::make_shared<c10::Event>(device_.type());
+          result.ready->record(*stream);
+        } else {
+          result.batch = detail::to_device(
+              std::move(batch), device_, options_.pin_memory());
+          if (stage_) {
+            result.batch = stage_(*std::move(result.batch));
+          }
+        }
+        results_.push(std::move(result));
+      }
+      // End-of-epoch marker.
+      results_.push(Result{});
+    } catch (...) {
+      Result result;
+      result.exception = std::current_exception();
+      results_.push(std::move(result));
+    }
+  }
+
+  DataLoader& loader_;
+  const Device device_;
+  const DevicePrefetcherOptions options_;
+
+  /// Optional on-device transform applied on the transfer stream.
+  DeviceStage stage_;
+
+  /// The transfer thread, running `worker_thread()` for one epoch at a time.
+  std::thread worker_;
+
+  /// Transferred batches waiting for the consumer.
+  detail::Queue<Result> results_;
+
+  /// Free slots; bounds the number of staged batches to `depth`.
+  detail::Queue<Slot> slots_;
+
+  /// Tells the transfer thread to exit early during `join()`.
+  std::atomic<bool> quit_{false};
+};
+
+} // namespace data
+} // namespace torch
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <torch/csrc/Export.h>
+#include <torch/data/samplers/base.h>
+#include <torch/types.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace torch {
+namespace serialize {
+class OutputArchive;
+class InputArchive;
+} // namespace serialize
+} // namespace torch
+
+namespace torch {
+namespace data {
+namespace samplers {
+
+/// A `Sampler` that returns a shuffled order with constant memory.
+///
+/// Unlike `RandomSampler`, which materializes a full index permutation per
+/// epoch (80 GB of indices for a dataset of 10 billion samples), the
+/// `PermutedSampler` evaluates a bijective pseudorandom permutation of
+/// `0 ... size - 1` on the fly. The permutation is a Feistel network over the
+/// smallest power-of-two domain covering the dataset, cycle-walked back into
+/// range, so each index costs a handful of integer mixes and the sampler
+/// itself stores only a seed, an epoch counter and a cursor. Epoch starts are
+/// therefore instant, and every epoch is reshuffled by keying the permutation
+/// with the epoch number.
+class TORCH_API PermutedSampler : public Sampler<> {
+ public:
+  /// Constructs a `PermutedSampler` over indices `0 ... size - 1`. The `seed`
+  /// selects the family of per-epoch permutations; two samplers constructed
+  /// with the same size and seed yield identical sequences.
+  explicit PermutedSampler(size_t size, uint64_t seed = 0);
+
+  /// Advances to the next epoch (a fresh permutation of the same indices) and
+  /// rewinds the sampler. An optional `new_size` re-keys the permutation
+  /// domain.
+  void reset(optional<size_t> new_size = nullopt) override;
+
+  /// Returns the next batch of indices.
+  optional<std::vector<size_t>> next(size_t batch_size) override;
+
+  /// Serializes the `PermutedSampler` to the `archive`.
+  void save(serialize::OutputArchive& archive) const override;
+
+  /// Deserializes the `PermutedSampler` from the `archive`.
+  void load(serialize::InputArchive& archive) override;
+
+  /// Returns the current index of the `PermutedSampler`.
+  size_t index() const noexcept;
+
+  /// Sets the epoch, and thereby the permutation, to enumerate. Useful to
+  /// restore a particular epoch's order without replaying prior epochs.
+  void set_epoch(size_t epoch);
+
+  size_t epoch() const noexcept;
+
+ private:
+  /// Maps a position in the epoch to a dataset index via the keyed
+  /// permutation.
+  size_t permute(size_t position) const;
+
+  size_t size_;
+  uint64_t seed_;
+  size_t epoch_ = 0;
+  size_t index_ = 0;
+  /// Bits in each Feistel half; the permutation domain is `2^(2 * half_bits_)`.
+  uint32_t half_bits_ = 1;
+};
+
+} // namespace samplers
+} // namespace data
+} // namespace torch
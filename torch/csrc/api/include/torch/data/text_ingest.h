@@ -0,0 +1,32 @@
+#pragma once
+
+#include <torch/types.h>
+
+#include <string>
+#include <string_view>
+
+namespace torch {
+namespace data {
+
+/// Parses delimited numeric text (comma-, tab-, space- or
+/// newline-separated values, i.e. unquoted CSV or whitespace feature logs)
+/// directly into the preallocated contiguous tensor `out`, which must be of
+/// type `kFloat` or `kDouble`. Values are written in row-major order
+/// regardless of `out`'s shape. Parsing is parallelized over
+/// newline-partitioned chunks and uses a locale-free number parser, so it is
+/// orders of magnitude faster than istringstream-based extraction.
+///
+/// Returns the number of values written. Throws if the text holds more
+/// values than `out` has elements or if a token is not a valid number.
+TORCH_API int64_t parse_numeric_text(std::string_view text, Tensor& out);
+
+/// Reads the file at `path` and parses it as delimited numeric text,
+/// returning a 1-D tensor of `dtype` (`kFloat` or `kDouble`) holding every
+/// value in the file. Use `parse_numeric_text` with a preallocated tensor
+/// when the element count is known up front.
+TORCH_API Tensor load_numeric_text(
+    const std::string& path,
+    ScalarType dtype = kFloat);
+
+} // namespace data
+} // namespace torch
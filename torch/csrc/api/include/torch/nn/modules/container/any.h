@@ -155,6 +155,17 @@ class AnyModule {
   template <typename ReturnType = torch::Tensor, typename... ArgumentTypes>
   ReturnType forward(ArgumentTypes&&... arguments);
 
+  /// True if the contained module's `forward()` can be invoked directly with a
+  /// single `Tensor` and returns a `Tensor`, i.e. `forward_tensor()` is
+  /// usable. This is resolved statically when the module is stored, so the
+  /// query is cheap.
+  bool supports_tensor_forward() const;
+
+  /// Invokes `forward()` on the contained module with the `Tensor` directly,
+  /// bypassing the `AnyValue` boxing of `forward()`. Only valid if
+  /// `supports_tensor_forward()` is true.
+  Tensor forward_tensor(Tensor input);
+
   /// Attempts to cast the underlying module to the given module type. Throws an
   /// exception if the types do not match.
   template <typename T, typename = torch::detail::enable_if_module_t<T>>
@@ -282,6 +293,16 @@ ReturnType AnyModule::forward(ArgumentTypes&&... arguments) {
       .template get<ReturnType>();
 }
 
+inline bool AnyModule::supports_tensor_forward() const {
+  return content_ != nullptr && content_->has_tensor_forward();
+}
+
+inline Tensor AnyModule::forward_tensor(Tensor input) {
+  TORCH_CHECK(
+      !is_empty(), "Cannot call forward_tensor() on an empty AnyModule");
+  return content_->forward_tensor(std::move(input));
+}
+
 template <typename T, typename>
 T& AnyModule::get() {
   TORCH_CHECK(!is_empty(), "Cannot call get() on an empty AnyModule");
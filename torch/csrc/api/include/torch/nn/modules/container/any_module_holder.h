@@ -2,6 +2,8 @@
 
 #include <torch/nn/modules/container/any_value.h>
 
+#include <type_traits>
+
 namespace torch {
 namespace nn {
 
@@ -18,6 +20,16 @@ struct AnyModulePlaceholder : public AnyValue::Placeholder {
   /// The "erased" `forward()` method.
   virtual AnyValue forward(std::vector<AnyValue>&& arguments) = 0;
 
+  /// True if the underlying module's `forward()` can be invoked directly with
+  /// a single `Tensor` and returns a `Tensor`, i.e. `forward_tensor()` is
+  /// usable.
+  virtual bool has_tensor_forward() const = 0;
+
+  /// Invokes the underlying module's `forward()` directly with a `Tensor`,
+  /// bypassing the `AnyValue` boxing of `forward()`. Only valid if
+  /// `has_tensor_forward()` is true.
+  virtual Tensor forward_tensor(Tensor&& input) = 0;
+
   /// Returns std::shared_ptr<Module> pointing to the erased module.
   virtual std::shared_ptr<Module> ptr() = 0;
 
@@ -37,6 +49,14 @@ struct AnyModulePlaceholder : public AnyValue::Placeholder {
 /// module takes in its `forward()` method.
 template <typename ModuleType, typename... ArgumentTypes>
 struct AnyModuleHolder : public AnyModulePlaceholder {
+  /// Whether `forward()` accepts exactly one `Tensor` (no defaulted trailing
+  /// arguments) and returns something convertible to `Tensor`.
+  static constexpr bool has_tensor_forward_v = std::is_invocable_r_v<
+      Tensor,
+      decltype(&ModuleType::forward),
+      ModuleType&,
+      Tensor&&>;
+
   /// \internal
   struct CheckedGetter {
     template <typename T>
@@ -111,6 +131,24 @@ struct AnyModuleHolder : public AnyModulePlaceholder {
         InvokeForward{module}, CheckedGetter{arguments});
   }
 
+  bool has_tensor_forward() const override {
+    return has_tensor_forward_v;
+  }
+
+  /// Calls `forward()` on the underlying module with the `Tensor` directly.
+  /// Skipping the `AnyValue` boxing avoids one heap allocation per argument
+  /// and per return value, which dominates for small modules.
+  Tensor forward_tensor(Tensor&& input) override {
+    if constexpr (has_tensor_forward_v) {
+      return module->forward(std::move(input));
+    } else {
+      TORCH_INTERNAL_ASSERT(
+          false,
+          c10::demangle(type_info.name()),
+          "'s forward() method is not callable as Tensor(Tensor)");
+    }
+  }
+
   std::shared_ptr<Module> ptr() override {
     return module;
   }
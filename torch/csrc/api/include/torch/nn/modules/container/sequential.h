@@ -10,6 +10,7 @@
 
 #include <c10/util/Exception.h>
 
+#include <algorithm>
 #include <cstdint>
 #include <memory>
 #include <ostream>
@@ -173,6 +174,21 @@ class SequentialImpl : public Cloneable<SequentialImpl> {
   ReturnType forward(InputTypes&&... inputs) {
     TORCH_CHECK(!is_empty(), "Cannot call forward() on an empty Sequential");
 
+    // For the common Tensor -> Tensor chain, run the pre-resolved path: each
+    // step calls the module's forward() directly instead of boxing arguments
+    // and return values into AnyValues, which allocate.
+    if constexpr (
+        std::is_same_v<ReturnType, Tensor> && sizeof...(InputTypes) == 1 &&
+        (std::is_same_v<std::decay_t<InputTypes>, Tensor> && ...)) {
+      if (resolve_forward_chain()) {
+        Tensor value(std::forward<InputTypes>(inputs)...);
+        for (auto& module : modules_) {
+          value = module.forward_tensor(std::move(value));
+        }
+        return value;
+      }
+    }
+
     auto iterator = modules_.begin();
     auto input = iterator->any_forward(std::forward<InputTypes>(inputs)...);
 
@@ -254,6 +270,26 @@ class SequentialImpl : public Cloneable<SequentialImpl> {
     modules_.push_back(std::move(any_module));
     const auto index = modules_.size() - 1;
     register_module(std::move(name), modules_[index].ptr());
+    // The chain has to be re-resolved now that it has a new member.
+    tensor_chain_ = TensorChain::Unresolved;
+  }
+
+  /// Resolves the direct Tensor -> Tensor execution path, checking once that
+  /// every stored module's `forward()` is callable as `Tensor(Tensor)`.
+  /// Returns true if the resolved path is usable; false leaves the generic
+  /// `AnyValue`-based path in use. `forward()` resolves lazily on first call,
+  /// but this can be called eagerly after the last `push_back()` to keep the
+  /// check off the hot path.
+  bool resolve_forward_chain() {
+    if (tensor_chain_ == TensorChain::Unresolved) {
+      const bool supported = std::all_of(
+          modules_.begin(), modules_.end(), [](const AnyModule& module) {
+            return module.supports_tensor_forward();
+          });
+      tensor_chain_ =
+          supported ? TensorChain::Resolved : TensorChain::Unsupported;
+    }
+    return tensor_chain_ == TensorChain::Resolved;
   }
 
   /// Returns an iterator to the start of the `Sequential`.
@@ -362,10 +398,16 @@ class SequentialImpl : public Cloneable<SequentialImpl> {
   /// The base case, when the list of modules is empty.
   void push_back() {}
 
+  /// Whether the direct Tensor -> Tensor path has been resolved, and if so,
+  /// whether every stored module supports it.
+  enum class TensorChain : int8_t { Unresolved, Resolved, Unsupported };
+
   // Box the AnyModules to give Sequential reference semantics, like the rest of
   // the API. Note that this is not required otherwise, this could just be a
   // `vector<AnyModule>`.
   std::vector<AnyModule> modules_;
+
+  TensorChain tensor_chain_ = TensorChain::Unresolved;
 };
 
 /// A `ModuleHolder` subclass for `SequentialImpl`.
@@ -0,0 +1,141 @@
+#include <torch/data/samplers/permuted.h>
+#include <torch/serialize/archive.h>
+#include <torch/types.h>
+
+#include <c10/util/Exception.h>
+#include <c10/util/irange.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace torch {
+namespace data {
+namespace samplers {
+namespace {
+
+// Finalizer of the SplitMix64 generator; a cheap invertible 64-bit mixer used
+// both to derive round keys from (seed, epoch) and as the Feistel round
+// function.
+uint64_t mix64(uint64_t x) {
+  x ^= x >> 30;
+  x *= 0xbf58476d1ce4e5b9;
+  x ^= x >> 27;
+  x *= 0x94d049bb133111eb;
+  x ^= x >> 31;
+  return x;
+}
+
+// Number of Feistel rounds. Four rounds of a strong round function are the
+// textbook minimum for a pseudorandom permutation; statistical quality is all
+// we need here.
+constexpr uint32_t kFeistelRounds = 4;
+
+uint32_t half_bits_for_size(size_t size) {
+  // Smallest balanced Feistel domain 2^(2 * half_bits) covering `size`. The
+  // domain is less than 4x the dataset size, so cycle-walking takes fewer
+  // than four permutation evaluations on average.
+  uint32_t bits = 1;
+  while ((static_cast<uint64_t>(1) << (2 * bits)) < static_cast<uint64_t>(size)) {
+    ++bits;
+  }
+  return bits;
+}
+
+} // namespace
+
+PermutedSampler::PermutedSampler(size_t size, uint64_t seed)
+    : size_(size), seed_(seed), half_bits_(half_bits_for_size(size)) {}
+
+void PermutedSampler::reset(optional<size_t> new_size) {
+  if (new_size.has_value()) {
+    size_ = *new_size;
+    half_bits_ = half_bits_for_size(size_);
+  }
+  ++epoch_;
+  index_ = 0;
+}
+
+size_t PermutedSampler::permute(size_t position) const {
+  const uint64_t mask = (static_cast<uint64_t>(1) << half_bits_) - 1;
+  uint64_t value = position;
+  // Cycle-walk: the Feistel network is a bijection on the power-of-two
+  // domain; re-applying it to out-of-range outputs yields a bijection on
+  // `0 ... size_ - 1`.
+  do {
+    uint64_t left = value >> half_bits_;
+    uint64_t right = value & mask;
+    for (const auto round : c10::irange(kFeistelRounds)) {
+      const uint64_t round_key =
+          mix64(seed_ + 0x9e3779b97f4a7c15 * (epoch_ * kFeistelRounds + round + 1));
+      const uint64_t next_right = left ^ (mix64(right ^ round_key) & mask);
+      left = right;
+      right = next_right;
+    }
+    value = (left << half_bits_) | right;
+  } while (value >= static_cast<uint64_t>(size_));
+  return static_cast<size_t>(value);
+}
+
+optional<std::vector<size_t>> PermutedSampler::next(size_t batch_size) {
+  AT_ASSERT(index_ <= size_);
+  const size_t remaining_indices = size_ - index_;
+  if (remaining_indices == 0) {
+    return nullopt;
+  }
+  std::vector<size_t> index_batch(std::min(batch_size, remaining_indices));
+  for (const auto i : c10::irange(index_batch.size())) {
+    index_batch[i] = permute(index_ + i);
+  }
+  index_ += index_batch.size();
+  return index_batch;
+}
+
+void PermutedSampler::save(serialize::OutputArchive& archive) const {
+  archive.write(
+      "size",
+      torch::tensor(static_cast<int64_t>(size_), torch::kInt64),
+      /*is_buffer=*/true);
+  archive.write(
+      "seed",
+      torch::tensor(static_cast<int64_t>(seed_), torch::kInt64),
+      /*is_buffer=*/true);
+  archive.write(
+      "epoch",
+      torch::tensor(static_cast<int64_t>(epoch_), torch::kInt64),
+      /*is_buffer=*/true);
+  archive.write(
+      "index",
+      torch::tensor(static_cast<int64_t>(index_), torch::kInt64),
+      /*is_buffer=*/true);
+}
+
+void PermutedSampler::load(serialize::InputArchive& archive) {
+  auto tensor = torch::empty(1, torch::kInt64);
+  archive.read("size", tensor, /*is_buffer=*/true);
+  size_ = tensor.item<int64_t>();
+  half_bits_ = half_bits_for_size(size_);
+  archive.read("seed", tensor, /*is_buffer=*/true);
+  seed_ = static_cast<uint64_t>(tensor.item<int64_t>());
+  archive.read("epoch", tensor, /*is_buffer=*/true);
+  epoch_ = tensor.item<int64_t>();
+  archive.read("index", tensor, /*is_buffer=*/true);
+  index_ = tensor.item<int64_t>();
+}
+
+size_t PermutedSampler::index() const noexcept {
+  return index_;
+}
+
+void PermutedSampler::set_epoch(size_t epoch) {
+  epoch_ = epoch;
+  index_ = 0;
+}
+
+size_t PermutedSampler::epoch() const noexcept {
+  return epoch_;
+}
+
+} // namespace samplers
+} // namespace data
+} // namespace torch
@@ -0,0 +1,236 @@
+#include <torch/data/text_ingest.h>
+
+#include <torch/types.h>
+
+#include <ATen/Dispatch.h>
+#include <ATen/Parallel.h>
+#include <c10/util/Exception.h>
+#include <c10/util/irange.h>
+
+#include <cmath>
+#include <cstdint>
+#include <fstream>
+#include <vector>
+
+namespace torch {
+namespace data {
+namespace {
+
+// Chunks below this size are parsed serially; the counting pass and thread
+// wakeups would dominate otherwise.
+constexpr size_t kMinBytesPerChunk = 1 << 20;
+
+bool is_separator(char c) {
+  return c == ',' || c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+// Locale-free number parser. Digits are accumulated into a uint64 mantissa
+// and scaled once at the end, which keeps the hot loop free of per-digit
+// floating point math. `p` is advanced past the parsed token.
+double parse_number(const char*& p, const char* end, bool& ok) {
+  ok = false;
+  bool negative = false;
+  if (p < end && (*p == '-' || *p == '+')) {
+    negative = *p == '-';
+    ++p;
+  }
+  uint64_t mantissa = 0;
+  int exponent = 0;
+  bool any_digits = false;
+  while (p < end && *p >= '0' && *p <= '9') {
+    // Past 19 digits the mantissa would overflow; surplus integer digits
+    // only shift the exponent.
+    if (mantissa < (UINT64_MAX - 9) / 10) {
+      mantissa = mantissa * 10 + static_cast<uint64_t>(*p - '0');
+    } else {
+      ++exponent;
+    }
+    any_digits = true;
+    ++p;
+  }
+  if (p < end && *p == '.') {
+    ++p;
+    while (p < end && *p >= '0' && *p <= '9') {
+      if (mantissa < (UINT64_MAX - 9) / 10) {
+        mantissa = mantissa * 10 + static_cast<uint64_t>(*p - '0');
+        --exponent;
+      }
+      any_digits = true;
+      ++p;
+    }
+  }
+  if (!any_digits) {
+    return 0.0;
+  }
+  if (p < end && (*p == 'e' || *p == 'E')) {
+    ++p;
+    bool exp_negative = false;
+    if (p < end && (*p == '-' || *p == '+')) {
+      exp_negative = *p == '-';
+      ++p;
+    }
+    int exp_digits = 0;
+    bool any_exp_digits = false;
+    while (p < end && *p >= '0' && *p <= '9') {
+      exp_digits = exp_digits * 10 + (*p - '0');
+      any_exp_digits = true;
+      ++p;
+    }
+    if (!any_exp_digits) {
+      return 0.0;
+    }
+    exponent += exp_negative ? -exp_digits : exp_digits;
+  }
+  // The token must end at a separator (or the buffer end) to be valid.
+  if (p < end && !is_separator(*p)) {
+    return 0.0;
+  }
+  ok = true;
+  double value = static_cast<double>(mantissa);
+  if (exponent != 0) {
+    value *= std::pow(10.0, exponent);
+  }
+  return negative ? -value : value;
+}
+
+int64_t count_values(const char* p, const char* end) {
+  int64_t count = 0;
+  while (p < end) {
+    while (p < end && is_separator(*p)) {
+      ++p;
+    }
+    if (p == end) {
+      break;
+    }
+    ++count;
+    while (p < end && !is_separator(*p)) {
+      ++p;
+    }
+  }
+  return count;
+}
+
+template <typename scalar_t>
+void parse_values(
+    const char* p,
+    const char* end,
+    scalar_t* out,
+    int64_t capacity) {
+  int64_t written = 0;
+  while (p < end) {
+    while (p < end && is_separator(*p)) {
+      ++p;
+    }
+    if (p == end) {
+      break;
+    }
+    TORCH_CHECK(
+        written < capacity,
+        "parse_numeric_text: text holds more values than the output tensor "
+        "has elements (",
+        capacity,
+        ")");
+    const char* token_start = p;
+    bool ok = false;
+    double value = parse_number(p, end, ok);
+    TORCH_CHECK(
+        ok,
+        "parse_numeric_text: invalid numeric token starting at \"",
+        std::string(token_start, std::min<size_t>(end - token_start, 16)),
+        "\"");
+    out[written++] = static_cast<scalar_t>(value);
+  }
+}
+
+// Splits [0, size) into chunks whose boundaries are snapped forward to the
+// character following the next newline, so no token straddles two chunks.
+std::vector<size_t> chunk_boundaries(std::string_view text, size_t n_chunks) {
+  std::vector<size_t> bounds;
+  bounds.push_back(0);
+  const size_t target = text.size() / n_chunks;
+  for (const auto i : c10::irange(size_t(1), n_chunks)) {
+    size_t pos = std::max(i * target, bounds.back());
+    while (pos < text.size() && text[pos] != '\n') {
+      ++pos;
+    }
+    pos = std::min(pos + 1, text.size());
+    bounds.push_back(pos);
+  }
+  bounds.push_back(text.size());
+  return bounds;
+}
+
+} // namespace
+
+int64_t parse_numeric_text(std::string_view text, Tensor& out) {
+  TORCH_CHECK(
+      out.is_contiguous() && out.device().is_cpu(),
+      "parse_numeric_text: output tensor must be a contiguous CPU tensor");
+  TORCH_CHECK(
+      out.scalar_type() == kFloat || out.scalar_type() == kDouble,
+      "parse_numeric_text: output tensor must be of type kFloat or kDouble, "
+      "got ",
+      out.scalar_type());
+
+  const size_t n_chunks = std::max<size_t>(
+      1,
+      std::min<size_t>(
+          at::get_num_threads(), text.size() / kMinBytesPerChunk));
+  const auto bounds = chunk_boundaries(text, n_chunks);
+
+  // Pass 1: count values per chunk so every thread knows where its output
+  // slice begins.
+  std::vector<int64_t> chunk_offsets(n_chunks + 1, 0);
+  at::parallel_for(0, n_chunks, 1, [&](int64_t begin, int64_t end) {
+    for (const auto i : c10::irange(begin, end)) {
+      chunk_offsets[i + 1] =
+          count_values(text.data() + bounds[i], text.data() + bounds[i + 1]);
+    }
+  });
+  for (const auto i : c10::irange(n_chunks)) {
+    chunk_offsets[i + 1] += chunk_offsets[i];
+  }
+  const int64_t total = chunk_offsets[n_chunks];
+  TORCH_CHECK(
+      total <= out.numel(),
+      "parse_numeric_text: text holds ",
+      total,
+      " values but the output tensor has only ",
+      out.numel(),
+      " elements");
+
+  // Pass 2: parse each chunk directly into its output slice.
+  AT_DISPATCH_FLOATING_TYPES(out.scalar_type(), "parse_numeric_text", [&] {
+    auto* out_data = out.data_ptr<scalar_t>();
+    at::parallel_for(0, n_chunks, 1, [&](int64_t begin, int64_t end) {
+      for (const auto i : c10::irange(begin, end)) {
+        parse_values(
+            text.data() + bounds[i],
+            text.data() + bounds[i + 1],
+            out_data + chunk_offsets[i],
+            chunk_offsets[i + 1] - chunk_offsets[i]);
+      }
+    });
+  });
+  return total;
+}
+
+Tensor load_numeric_text(const std::string& path, ScalarType dtype) {
+  std::ifstream stream(path, std::ios::binary | std::ios::ate);
+  TORCH_CHECK(stream, "Error opening file at ", path);
+  const auto size = static_cast<size_t>(stream.tellg());
+  stream.seekg(0, std::ios::beg);
+  std::vector<char> buffer(size);
+  stream.read(buffer.data(), static_cast<std::streamsize>(size));
+  TORCH_CHECK(stream, "Error reading file at ", path);
+
+  std::string_view text(buffer.data(), buffer.size());
+  const int64_t total =
+      count_values(text.data(), text.data() + text.size());
+  Tensor out = torch::empty({total}, torch::TensorOptions().dtype(dtype));
+  parse_numeric_text(text, out);
+  return out;
+}
+
+} // namespace data
+} // namespace torch
@@ -0,0 +1,239 @@
+#include <torch/optim/zero_redundancy_optimizer.h>
+
+#ifdef USE_DISTRIBUTED
+
+#include <torch/serialize/archive.h>
+#include <torch/utils.h>
+
+#include <ATen/ATen.h>
+#include <c10/util/irange.h>
+
+#include <algorithm>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+namespace torch {
+namespace optim {
+
+ZeroRedundancyOptimizer::ZeroRedundancyOptimizer(
+    std::vector<Tensor> params,
+    c10::intrusive_ptr<c10d::Backend> process_group,
+    OptimizerFactory factory,
+    ZeroRedundancyOptimizerOptions options)
+    : Optimizer(std::vector<OptimizerParamGroup>{}, nullptr),
+      process_group_(std::move(process_group)),
+      options_(options) {
+  TORCH_CHECK(
+      process_group_ != nullptr,
+      "ZeroRedundancyOptimizer requires a process group");
+  TORCH_CHECK(
+      !params.empty(), "ZeroRedundancyOptimizer got an empty parameter list");
+  TORCH_CHECK(
+      options_.bucket_bytes() > 0,
+      "ZeroRedundancyOptimizer `bucket_bytes` must be positive, but got ",
+      options_.bucket_bytes());
+  for (const auto& p : params) {
+    TORCH_CHECK(
+        p.scalar_type() == params[0].scalar_type() &&
+            p.device() == params[0].device(),
+        "ZeroRedundancyOptimizer requires all parameters to share one dtype "
+        "and device for the flat communication buffers; got ",
+        p.scalar_type(),
+        " on ",
+        p.device(),
+        " vs ",
+        params[0].scalar_type(),
+        " on ",
+        params[0].device());
+  }
+
+  const int64_t world_size = process_group_->getSize();
+  const int64_t rank = process_group_->getRank();
+
+  // Greedy size-balanced partition: biggest parameters first, each assigned
+  // to the currently lightest rank, so shard (and therefore optimizer state)
+  // sizes stay close to total / world_size.
+  param_to_rank_.resize(params.size());
+  std::vector<size_t> order(params.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+    return params[a].numel() > params[b].numel();
+  });
+  std::vector<int64_t> assigned_numel(world_size, 0);
+  for (const auto idx : order) {
+    const auto owner = std::min_element(
+                           assigned_numel.begin(), assigned_numel.end()) -
+        assigned_numel.begin();
+    param_to_rank_[idx] = owner;
+    assigned_numel[owner] += params[idx].numel();
+  }
+
+  std::vector<Tensor> shard;
+  for (const auto i : c10::irange(params.size())) {
+    if (param_to_rank_[i] == rank) {
+      shard.push_back(params[i]);
+    }
+  }
+  local_optimizer_ = factory(std::move(shard));
+  TORCH_CHECK(
+      local_optimizer_ != nullptr,
+      "ZeroRedundancyOptimizer factory returned a null optimizer");
+  defaults_ = local_optimizer_->defaults().clone();
+  add_param_group(OptimizerParamGroup(std::move(params)));
+  build_buckets(world_size);
+}
+
+void ZeroRedundancyOptimizer::build_buckets(int64_t world_size) {
+  const auto& params = param_groups_[0].params();
+  const int64_t bucket_numel = std::max<int64_t>(
+      options_.bucket_bytes() / params[0].element_size(), 1);
+
+  Bucket current;
+  current.indices_per_rank.resize(world_size);
+  std::vector<int64_t> section_numel(world_size, 0);
+  auto flush = [&]() {
+    const auto max_section =
+        *std::max_element(section_numel.begin(), section_numel.end());
+    if (max_section == 0) {
+      return;
+    }
+    current.section_numel = max_section;
+    buckets_.push_back(std::move(current));
+    current = Bucket();
+    current.indices_per_rank.resize(world_size);
+    std::fill(section_numel.begin(), section_numel.end(), 0);
+  };
+  for (const auto i : c10::irange(params.size())) {
+    const auto owner = param_to_rank_[i];
+    if (section_numel[owner] > 0 &&
+        section_numel[owner] + params[i].numel() > bucket_numel) {
+      flush();
+    }
+    current.indices_per_rank[owner].push_back(i);
+    section_numel[owner] += params[i].numel();
+  }
+  flush();
+}
+
+Tensor ZeroRedundancyOptimizer::step(LossClosure closure) {
+  Tensor loss = {};
+  if (closure != nullptr) {
+    at::AutoGradMode enable_grad(true);
+    loss = closure();
+  }
+  NoGradGuard no_grad;
+  const int64_t world_size = process_group_->getSize();
+  const int64_t rank = process_group_->getRank();
+  auto& params = param_groups_[0].params();
+
+  // Per-bucket communication buffers only live for the duration of one step;
+  // a bucket's flat buffer is reused for the gradient reduce-scatter and the
+  // parameter allgather.
+  struct InFlight {
+    at::Tensor buffer;
+    at::Tensor shard;
+    c10::intrusive_ptr<c10d::Work> work;
+  };
+  std::vector<InFlight> inflight(buckets_.size());
+
+  // Kick off the reduce-scatter of every bucket before waiting on any, so
+  // the gather copies of one bucket overlap with the communication of the
+  // others.
+  for (const auto b : c10::irange(buckets_.size())) {
+    const auto& bucket = buckets_[b];
+    auto& fl = inflight[b];
+    fl.buffer = at::zeros(
+        {world_size * bucket.section_numel}, params[0].options());
+    fl.shard = at::empty({bucket.section_numel}, params[0].options());
+    for (const auto r : c10::irange(world_size)) {
+      int64_t offset = r * bucket.section_numel;
+      std::vector<Tensor> views;
+      std::vector<Tensor> grads;
+      for (const auto idx : bucket.indices_per_rank[r]) {
+        const auto& grad = params[idx].grad();
+        if (grad.defined()) {
+          views.push_back(fl.buffer.narrow(0, offset, params[idx].numel()));
+          grads.push_back(grad.reshape(-1));
+        }
+        offset += params[idx].numel();
+      }
+      if (!views.empty()) {
+        at::_foreach_copy_(views, grads);
+      }
+    }
+    fl.work = process_group_->_reduce_scatter_base(
+        fl.shard, fl.buffer, c10d::ReduceScatterOptions());
+  }
+
+  // Average and hand this rank's gradient sections to the wrapped optimizer
+  // as flat views, then run the local update on the shard only.
+  for (const auto b : c10::irange(buckets_.size())) {
+    inflight[b].work->wait();
+    auto& shard = inflight[b].shard;
+    shard.div_(static_cast<double>(world_size));
+    int64_t offset = 0;
+    for (const auto idx : buckets_[b].indices_per_rank[rank]) {
+      params[idx].mutable_grad() =
+          shard.narrow(0, offset, params[idx].numel()).view(params[idx].sizes());
+      offset += params[idx].numel();
+    }
+  }
+  local_optimizer_->step();
+
+  // Broadcast the updated shards back to every replica, again with all
+  // buckets in flight at once.
+  for (const auto b : c10::irange(buckets_.size())) {
+    const auto& bucket = buckets_[b];
+    auto& fl = inflight[b];
+    int64_t offset = 0;
+    std::vector<Tensor> views;
+    std::vector<Tensor> updated;
+    for (const auto idx : bucket.indices_per_rank[rank]) {
+      views.push_back(fl.shard.narrow(0, offset, params[idx].numel()));
+      updated.push_back(params[idx].reshape(-1));
+      offset += params[idx].numel();
+    }
+    if (!views.empty()) {
+      at::_foreach_copy_(views, updated);
+    }
+    fl.work = process_group_->_allgather_base(
+        fl.buffer, fl.shard, c10d::AllgatherOptions());
+  }
+  for (const auto b : c10::irange(buckets_.size())) {
+    const auto& bucket = buckets_[b];
+    auto& fl = inflight[b];
+    fl.work->wait();
+    for (const auto r : c10::irange(world_size)) {
+      if (r == rank) {
+        continue;
+      }
+      int64_t offset = r * bucket.section_numel;
+      std::vector<Tensor> replicas;
+      std::vector<Tensor> sections;
+      for (const auto idx : bucket.indices_per_rank[r]) {
+        replicas.push_back(params[idx]);
+        sections.push_back(fl.buffer.narrow(0, offset, params[idx].numel())
+                               .view(params[idx].sizes()));
+        offset += params[idx].numel();
+      }
+      if (!replicas.empty()) {
+        at::_foreach_copy_(replicas, sections);
+      }
+    }
+  }
+  return loss;
+}
+
+void ZeroRedundancyOptimizer::save(serialize::OutputArchive& archive) const {
+  local_optimizer_->save(archive);
+}
+
+void ZeroRedundancyOptimizer::load(serialize::InputArchive& archive) {
+  local_optimizer_->load(archive);
+}
+
+} // namespace optim
+} // namespace torch
+
+#endif // USE_DISTRIBUTED
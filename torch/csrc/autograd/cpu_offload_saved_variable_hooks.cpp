@@ -0,0 +1,67 @@
+#include <torch/csrc/autograd/cpu_offload_saved_variable_hooks.h>
+
+#ifndef AT_PER_OPERATOR_HEADERS
+#include <ATen/Functions.h>
+#else
+#include <ATen/ops/empty_like.h>
+#endif
+
+#include <c10/core/DeviceGuard.h>
+#include <c10/core/StreamGuard.h>
+#include <c10/core/impl/VirtualGuardImpl.h>
+
+namespace torch::autograd {
+
+void CpuOffloadSavedVariableHooks::call_pack_hook(const at::Tensor& tensor) {
+  // Tensors that are not worth (or not safe to) stage keep a plain
+  // reference, exactly as if no hook were installed.
+  const bool can_offload = tensor.defined() &&
+      tensor.layout() == c10::kStrided &&
+      (tensor.device().is_cuda() || tensor.device().is_privateuseone()) &&
+      static_cast<int64_t>(tensor.nbytes()) >= kMinOffloadBytes;
+  if (!can_offload) {
+    packed_ = tensor;
+    return;
+  }
+
+  const auto device = tensor.device();
+  device_ = device;
+  c10::impl::VirtualGuardImpl impl{device.type()};
+  c10::DeviceGuard device_guard(device);
+  const auto producer = impl.getStream(device);
+  const auto side = impl.getStreamFromGlobalPool(device);
+
+  // The side stream has to see the producer stream's writes to `tensor`
+  // before reading it back.
+  c10::Event ready{device.type()};
+  ready.record(producer);
+  ready.block(side);
+  {
+    c10::StreamGuard stream_guard(side);
+    packed_ = at::empty_like(
+        tensor, tensor.options().device(c10::kCPU).pinned_memory(true));
+    packed_.copy_(tensor, /*non_blocking=*/true);
+    // Autograd drops its reference to `tensor` once packing returns, at
+    // which point the caching allocator may hand the memory to another
+    // stream; keep it valid until the side stream is done reading.
+    impl.recordDataPtrOnStream(tensor.storage().data_ptr(), side);
+    offload_event_.emplace(device.type());
+    offload_event_->record(side);
+  }
+}
+
+at::Tensor CpuOffloadSavedVariableHooks::call_unpack_hook() {
+  if (!device_.has_value()) {
+    return packed_;
+  }
+  c10::impl::VirtualGuardImpl impl{device_->type()};
+  c10::DeviceGuard device_guard(*device_);
+  const auto consumer = impl.getStream(*device_);
+  // Order the H2D copy behind the offload instead of host-syncing; the
+  // staging buffer is pinned, so the copy back is async as well. Unpacking
+  // again (retain_graph=True) just re-uploads from the same staging buffer.
+  offload_event_->block(consumer);
+  return packed_.to(*device_, /*non_blocking=*/true);
+}
+
+} // namespace torch::autograd
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <ATen/core/Tensor.h>
+#include <c10/core/Event.h>
+#include <torch/csrc/autograd/saved_variable_hooks.h>
+
+#include <optional>
+
+namespace torch::autograd {
+
+// Native implementation of save-on-CPU saved-tensor hooks. Unlike the
+// Python torch.autograd.graph.save_on_cpu context manager, packing and
+// unpacking never cross into the interpreter, and the D2H copy runs
+// asynchronously on a side stream into pinned staging memory, so the
+// forward pass is not stalled by the offload. Unpack makes the current
+// stream wait on the offload event and issues an async H2D copy, so the
+// backward pass only orders against the copy instead of host-syncing.
+//
+// Enabled through at::SavedTensorDefaultHooks::set_offload_to_cpu (see
+// NOTE: [Native CPU offload of saved tensors]); tensors that already live
+// on CPU, or are smaller than kMinOffloadBytes, are saved as-is since the
+// staging round trip would cost more than it frees.
+struct TORCH_API CpuOffloadSavedVariableHooks : public SavedVariableHooks {
+  void call_pack_hook(const at::Tensor& tensor) override;
+  at::Tensor call_unpack_hook() override;
+
+  // Below this size the transfer latency dominates any memory won back.
+  static constexpr int64_t kMinOffloadBytes = 1 << 16;
+
+ private:
+  at::Tensor packed_;
+  std::optional<c10::Device> device_;
+  std::optional<c10::Event> offload_event_;
+};
+
+} // namespace torch::autograd
@@ -30,6 +30,7 @@
 #include <c10/util/Exception.h>
 #include <c10/util/Optional.h>
 #include <c10/util/ThreadLocal.h>
+#include <c10/util/env.h>
 #include <c10/util/irange.h>
 #include <c10/util/thread_name.h>
 
@@ -234,48 +235,126 @@ CheckpointValidGuard::~CheckpointValidGuard() {
   checkpoint_valid = prev_checkpoint_valid_state;
 }
 
-auto ReadyQueue::push(NodeTask item, bool incrementOutstandingTasks) -> void {
+size_t ReadyQueue::producer_shard() {
+  // Hash the thread id so concurrent producers (device threads on different
+  // sockets, the calling thread) land on different shards and their heap
+  // pushes never contend on one mutex.
+  static thread_local const size_t shard =
+      std::hash<std::thread::id>()(std::this_thread::get_id()) % kNumShards;
+  return shard;
+}
+
+void ReadyQueue::announce_one() {
   {
-    // Lock mutex for writing to heap_
-    std::lock_guard<std::mutex> lock(mutex_);
-    if (incrementOutstandingTasks) {
-      std::shared_ptr<GraphTask> graph_task = item.base_.lock();
-      TORCH_INTERNAL_ASSERT(graph_task, "GraphTask is no longer valid!");
-      ++graph_task->outstanding_tasks_;
-    }
-    heap_.push(std::move(item));
+    std::lock_guard<std::mutex> lock(count_mutex_);
+    ++count_;
   }
   not_empty_.notify_one();
 }
 
+auto ReadyQueue::push(NodeTask item, bool incrementOutstandingTasks) -> void {
+  if (incrementOutstandingTasks) {
+    std::shared_ptr<GraphTask> graph_task = item.base_.lock();
+    TORCH_INTERNAL_ASSERT(graph_task, "GraphTask is no longer valid!");
+    // outstanding_tasks_ is atomic; no need to hold any queue lock here
+    ++graph_task->outstanding_tasks_;
+  }
+  auto& shard = shards_[producer_shard()];
+  {
+    // Lock only this shard's mutex for writing to its heap
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    shard.heap.push(std::move(item));
+  }
+  announce_one();
+}
+
 auto ReadyQueue::pushShutdownTask() -> void {
+  auto& shard = shards_[producer_shard()];
   {
-    std::lock_guard<std::mutex> lock(mutex_);
-    heap_.push(NodeTask({}, nullptr, InputBuffer(0), true));
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    shard.heap.push(NodeTask({}, nullptr, InputBuffer(0), true));
   }
-  not_empty_.notify_one();
+  announce_one();
 }
 
 size_t ReadyQueue::size() const {
-  // Lock mutex for accesses to heap_
-  std::unique_lock<std::mutex> lock(mutex_);
-  return heap_.size();
+  std::unique_lock<std::mutex> lock(count_mutex_);
+  return count_;
 }
 
 auto ReadyQueue::pop() -> NodeTask {
-  // Lock mutex for accesses to heap_
-  std::unique_lock<std::mutex> lock(mutex_);
-  not_empty_.wait(lock, [this] { return !heap_.empty(); });
-  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
-  auto task = std::move(const_cast<NodeTask&>(heap_.top()));
-  heap_.pop();
-  return task;
+  {
+    // Reserve one queued task; after the decrement, some shard is guaranteed
+    // to hold a task that no other consumer can claim, so the scan below
+    // always terminates.
+    std::unique_lock<std::mutex> lock(count_mutex_);
+    not_empty_.wait(lock, [this] { return count_ > 0; });
+    --count_;
+  }
+  while (true) {
+    // Pick the best task among the shard tops. Only a small key is extracted
+    // under each shard lock; NodeTask itself (which owns an InputBuffer) is
+    // moved out once, from the winning shard.
+    struct TopKey {
+      bool is_shutdown;
+      bool is_empty_fn;
+      int reentrant_depth;
+      uint64_t sequence_nr;
+    };
+    int best_shard = -1;
+    TopKey best_key{};
+    for (const auto i : c10::irange(kNumShards)) {
+      std::lock_guard<std::mutex> lock(shards_[i].mutex);
+      if (shards_[i].heap.empty()) {
+        continue;
+      }
+      const NodeTask& top = shards_[i].heap.top();
+      TopKey key{
+          top.isShutdownTask_,
+          !top.fn_,
+          top.getReentrantDepth(),
+          top.fn_ ? top.fn_->sequence_nr() : 0};
+      // Mirrors CompareNodeTaskTime: shutdown tasks first, then empty
+      // NodeTasks, then deeper reentrant calls, then higher sequence_nr
+      auto better = [](const TopKey& a, const TopKey& b) {
+        if (a.is_shutdown != b.is_shutdown) {
+          return a.is_shutdown;
+        }
+        if (a.is_empty_fn != b.is_empty_fn) {
+          return a.is_empty_fn;
+        }
+        if (a.reentrant_depth != b.reentrant_depth) {
+          return a.reentrant_depth > b.reentrant_depth;
+        }
+        return a.sequence_nr > b.sequence_nr;
+      };
+      if (best_shard < 0 || better(key, best_key)) {
+        best_shard = static_cast<int>(i);
+        best_key = key;
+      }
+    }
+    if (best_shard < 0) {
+      // All visible tasks were claimed by concurrent consumers between their
+      // reservations and their pops; our reserved task is about to appear (or
+      // reappear) in some shard, so rescan.
+      std::this_thread::yield();
+      continue;
+    }
+    auto& shard = shards_[best_shard];
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    if (shard.heap.empty()) {
+      continue;
+    }
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+    auto task = std::move(const_cast<NodeTask&>(shard.heap.top()));
+    shard.heap.pop();
+    return task;
+  }
 }
 
 bool ReadyQueue::empty() const {
-  // Lock mutex for accesses to heap_
-  std::unique_lock<std::mutex> lock(mutex_);
-  return heap_.empty();
+  std::unique_lock<std::mutex> lock(count_mutex_);
+  return count_ == 0;
 }
 
 Engine::Engine()
@@ -1004,6 +1083,9 @@ void Engine::evaluate_function(
   auto& exec_info_ = graph_task->exec_info_;
   if (!exec_info_.empty()) {
     auto& fn_info = exec_info_.at(func);
+    // Reading `buffer` directly, so deferred batched accumulations (if any)
+    // must be applied first.
+    inputs.flush_pending();
     variable_list new_inputs = inputs.buffer;
     if (!fn_info.needed_) {
       // We always want to call tensor pre-hooks, but want to avoid calling it
@@ -1136,6 +1218,98 @@ void Engine::evaluate_function(
   }
 }
 
+namespace {
+
+// Cached result of the last full compute_dependencies traversal, reused
+// when backward() is called again on the exact same retained graph (same
+// Node objects, verified below). A training loop that keeps its graph
+// alive across steps then skips the whole-graph traversal after the first
+// backward. Opt-in via TORCH_AUTOGRAD_CACHE_GRAPH_TOPOLOGY because hits
+// require pointer-identical graphs; the common rebuild-every-step case
+// never matches and only pays the (cheap) root comparison.
+struct GraphTopologyCache {
+  std::mutex mutex;
+  bool valid{false};
+  // Root nodes of the cached traversal, compared by identity. The weak
+  // pointers make the identity check sound: if a cached node died, lock()
+  // fails even when a new node reuses its address, so a stale entry can
+  // never alias a fresh graph.
+  std::vector<std::weak_ptr<Node>> roots;
+  std::vector<std::weak_ptr<Node>> nodes;
+  std::unordered_map<Node*, int> dependencies;
+  std::unordered_set<Node*> nodes_in_graph;
+  bool will_use_accelerator{false};
+};
+
+GraphTopologyCache& graph_topology_cache() {
+  static GraphTopologyCache cache;
+  return cache;
+}
+
+bool graph_topology_cache_enabled() {
+  static const bool enabled =
+      c10::utils::check_env("TORCH_AUTOGRAD_CACHE_GRAPH_TOPOLOGY") == true;
+  return enabled;
+}
+
+// Copies the cached dependency counts and node set into graph_task if the
+// cache holds a traversal of exactly this graph. Returns false (leaving
+// graph_task untouched) on any mismatch.
+bool reuse_cached_topology(GraphTask& graph_task, const edge_list& roots) {
+  auto& cache = graph_topology_cache();
+  std::lock_guard<std::mutex> guard(cache.mutex);
+  if (!cache.valid || cache.roots.size() != roots.size()) {
+    return false;
+  }
+  for (const auto i : c10::irange(roots.size())) {
+    const auto cached_root = cache.roots[i].lock();
+    if (cached_root.get() != roots[i].function.get()) {
+      return false;
+    }
+  }
+  for (const auto& weak_node : cache.nodes) {
+    if (weak_node.expired()) {
+      return false;
+    }
+  }
+  graph_task.dependencies_ = cache.dependencies;
+  graph_task.nodes_in_graph_ = cache.nodes_in_graph;
+  if (cache.will_use_accelerator) {
+    graph_task.stash_current_streams();
+  }
+  return true;
+}
+
+void stash_topology_cache(const GraphTask& graph_task, const edge_list& roots) {
+  auto& cache = graph_topology_cache();
+  std::lock_guard<std::mutex> guard(cache.mutex);
+  cache.valid = false;
+  cache.roots.clear();
+  cache.roots.reserve(roots.size());
+  for (const auto& root : roots) {
+    cache.roots.emplace_back(root.function);
+  }
+  cache.nodes.clear();
+  cache.nodes.reserve(graph_task.nodes_in_graph_.size());
+  cache.will_use_accelerator = false;
+  for (Node* node : graph_task.nodes_in_graph_) {
+    cache.nodes.emplace_back(node->shared_from_this());
+    if (!cache.will_use_accelerator) {
+      cache.will_use_accelerator = node->stream().has_value();
+    }
+  }
+  for (const auto& root : roots) {
+    if (!cache.will_use_accelerator) {
+      cache.will_use_accelerator = root.function->stream().has_value();
+    }
+  }
+  cache.dependencies = graph_task.dependencies_;
+  cache.nodes_in_graph = graph_task.nodes_in_graph_;
+  cache.valid = true;
+}
+
+} // namespace
+
 inline static uint64_t compute_min_topological_nr(const edge_list& outputs) {
   // Computes the mininum topological number among all the outputs
   if (outputs.empty()) {
@@ -1247,8 +1421,21 @@ auto Engine::execute(
       : std::make_shared<GraphRoot>(root_edges, inputs);
 
   auto min_topo_nr = compute_min_topological_nr(outputs);
-  // Now compute the dependencies for all executable functions
-  compute_dependencies(graph_root.get(), *graph_task, min_topo_nr);
+  // Now compute the dependencies for all executable functions, reusing the
+  // cached traversal when backward() runs again over the same retained
+  // graph. Restricted to plain non-reentrant backward() without compiled
+  // autograd: those knobs change the traversal shape (exec_info, dummy
+  // root), so only the simple case is cached.
+  const bool try_topology_cache = graph_topology_cache_enabled() &&
+      outputs.empty() && not_reentrant_backward_call &&
+      compiled_autograd == nullptr;
+  if (!(try_topology_cache && reuse_cached_topology(*graph_task, root_edges))) {
+    compute_dependencies(graph_root.get(), *graph_task, min_topo_nr);
+    if (try_topology_cache && keep_graph) {
+      // Only a retained graph can come back with the same nodes.
+      stash_topology_cache(*graph_task, root_edges);
+    }
+  }
 
   if (!outputs.empty()) {
     graph_task->init_to_execute(
@@ -17,6 +17,7 @@
 
 #include <c10/util/CallOnce.h>
 
+#include <array>
 #include <exception>
 #include <functional>
 #include <memory>
@@ -100,13 +101,36 @@ struct ReadyQueue {
     }
   };
 
-  // To notify threads waiting on the ReadyQueue of available tasks on the heap_
-  std::condition_variable not_empty_;
-  // To protect read and writes to heap_
-  mutable std::mutex mutex_;
+  // The queue is sharded to cut producer-side mutex contention when many
+  // threads feed one queue (wide backward graphs on many-core machines):
+  // producers pick a shard by thread id, so the O(log n) heap push happens
+  // under a per-shard lock and only a counter update touches shared state.
+  // Consumers pop the best task among the shard tops. Priority order is
+  // therefore exact per shard and best-effort across shards, which is fine:
+  // sequence_nr / reentrant-depth ordering is a scheduling heuristic, and
+  // shutdown tasks still sort first within their shard so they are picked up
+  // promptly.
+  static constexpr size_t kNumShards = 8;
+
+  struct Shard {
+    // Protects read and writes to heap
+    std::mutex mutex;
+    std::priority_queue<NodeTask, std::vector<NodeTask>, CompareNodeTaskTime>
+        heap;
+  };
+  std::array<Shard, kNumShards> shards_;
 
-  std::priority_queue<NodeTask, std::vector<NodeTask>, CompareNodeTaskTime>
-      heap_;
+  // To notify threads waiting on the ReadyQueue of available tasks
+  std::condition_variable not_empty_;
+  // Protects count_, the number of queued tasks across all shards
+  mutable std::mutex count_mutex_;
+  size_t count_ = 0;
+
+  // Shard this thread pushes to; threads (and on multi-socket machines,
+  // typically sockets) spread across shards.
+  static size_t producer_shard();
+  // Publishes one queued task to sleeping consumers.
+  void announce_one();
 
  public:
   // incrementOutstandingTasks indicates whether or not we should increment
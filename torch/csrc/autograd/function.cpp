@@ -6,6 +6,9 @@
 
 #include <ATen/ATen.h>
 
+#include <array>
+#include <cstdlib>
+#include <cstring>
 #include <memory>
 #include <string>
 #include <utility>
@@ -43,6 +46,78 @@ void Node::assign_parent() {
   metadata()->assign_parent(current_evaluating_node);
 }
 
+namespace {
+
+// Thread-local recycling pool backing Node::operator new/delete. Node
+// lifetimes are owned by the tensors holding grad_fn and can span several
+// backward passes (retain_graph), so storage cannot be arena-freed wholesale
+// with a GraphTask; instead freed node storage is kept in size-bucketed
+// freelists and handed back out to subsequent graph construction. Blocks are
+// only ever linked into the freelist of the thread that deleted them, so no
+// synchronization is needed.
+constexpr size_t kNodePoolBucketSize = 64;
+constexpr size_t kNodePoolMaxBlockSize = 1024;
+constexpr size_t kNodePoolMaxCachedBlocks = 4096;
+
+struct NodePool {
+  std::array<std::vector<void*>, kNodePoolMaxBlockSize / kNodePoolBucketSize>
+      free_lists;
+  size_t num_cached = 0;
+
+  ~NodePool() {
+    for (auto& free_list : free_lists) {
+      for (void* block : free_list) {
+        ::operator delete(block);
+      }
+    }
+  }
+};
+
+thread_local NodePool node_pool;
+
+bool pooled_nodes_enabled() {
+  static const bool enabled = []() {
+    const char* env = std::getenv("TORCH_AUTOGRAD_POOLED_NODES");
+    return env != nullptr && std::strcmp(env, "1") == 0;
+  }();
+  return enabled;
+}
+
+size_t node_pool_bucket(size_t size) {
+  return (size - 1) / kNodePoolBucketSize;
+}
+
+} // namespace
+
+void* Node::operator new(size_t size) {
+  if (pooled_nodes_enabled() && size <= kNodePoolMaxBlockSize) {
+    auto& free_list = node_pool.free_lists[node_pool_bucket(size)];
+    if (!free_list.empty()) {
+      void* block = free_list.back();
+      free_list.pop_back();
+      node_pool.num_cached--;
+      return block;
+    }
+    // Round the allocation up to the bucket boundary so the block can serve
+    // any node that maps to the same bucket when it is recycled.
+    return ::operator new((node_pool_bucket(size) + 1) * kNodePoolBucketSize);
+  }
+  return ::operator new(size);
+}
+
+void Node::operator delete(void* ptr, size_t size) {
+  // `size` is the size of the most derived class: ~Node is virtual, so the
+  // deleting destructor passes the dynamic type's size and the block lands in
+  // the same bucket it was allocated from.
+  if (pooled_nodes_enabled() && size <= kNodePoolMaxBlockSize &&
+      node_pool.num_cached < kNodePoolMaxCachedBlocks) {
+    node_pool.free_lists[node_pool_bucket(size)].push_back(ptr);
+    node_pool.num_cached++;
+    return;
+  }
+  ::operator delete(ptr);
+}
+
 auto Node::name() const -> std::string {
   return c10::demangle(typeid(*this).name());
 }
@@ -142,6 +142,15 @@ struct TORCH_API Node : std::enable_shared_from_this<Node> {
   Node& operator=(Node&& other) = delete;
   virtual ~Node() = default;
 
+  /// Node subclasses are always individually heap-allocated (op
+  /// implementations construct them with `new` and release them through
+  /// `deleteNode`), which makes graph construction malloc-bound for small
+  /// models. When TORCH_AUTOGRAD_POOLED_NODES=1 these class-level operators
+  /// recycle node storage through a thread-local freelist instead of hitting
+  /// the system allocator on every node; see function.cpp.
+  static void* operator new(size_t size);
+  static void operator delete(void* ptr, size_t size);
+
   std::shared_ptr<Node> getptr() {
     return shared_from_this();
   }
@@ -21,6 +21,7 @@
 #include <torch/csrc/autograd/python_function.h>
 #include <torch/csrc/autograd/python_saved_variable_hooks.h>
 #include <torch/csrc/autograd/python_variable.h>
+#include <torch/csrc/autograd/recompute_saved_variable_hooks.h>
 #include <torch/csrc/autograd/record_function_ops.h>
 #include <torch/csrc/autograd/saved_variable.h>
 #include <torch/csrc/autograd/utils/python_arg_parsing.h>
@@ -387,6 +388,19 @@ PyObject* THPAutograd_initExtension(PyObject* _unused, PyObject* unused) {
   m.def("_pop_saved_tensors_default_hooks", []() {
     torch::autograd::PyDefaultSavedVariableHooks::pop_hooks();
   });
+  // See NOTE: [Native CPU offload of saved tensors]
+  m.def(
+      "_saved_tensors_set_offload_to_cpu",
+      at::SavedTensorDefaultHooks::set_offload_to_cpu);
+  m.def(
+      "_saved_tensors_get_offload_to_cpu",
+      at::SavedTensorDefaultHooks::get_offload_to_cpu);
+  m.def(
+      "_saved_tensors_set_memory_budget",
+      torch::autograd::set_saved_tensors_memory_budget);
+  m.def(
+      "_saved_tensors_get_memory_budget",
+      torch::autograd::get_saved_tensors_memory_budget);
 
   m.def("_get_creation_meta", [](const at::Tensor& t) {
     auto* meta = torch::autograd::impl::get_view_autograd_meta(t);
@@ -810,6 +824,43 @@ static PyObject* set_autocast_cache_enabled(PyObject* _unused, PyObject* arg) {
   END_HANDLE_TH_ERRORS
 }
 
+static PyObject* is_autocast_persistent_cache_enabled(
+    PyObject* _unused,
+    PyObject* arg) {
+  HANDLE_TH_ERRORS
+  if (at::autocast::is_autocast_persistent_cache_enabled()) {
+    Py_RETURN_TRUE;
+  } else {
+    Py_RETURN_FALSE;
+  }
+  END_HANDLE_TH_ERRORS
+}
+
+static PyObject* set_autocast_persistent_cache_enabled(
+    PyObject* _unused,
+    PyObject* arg) {
+  HANDLE_TH_ERRORS
+  TORCH_CHECK_TYPE(
+      PyBool_Check(arg),
+      "enabled must be a bool (got ",
+      Py_TYPE(arg)->tp_name,
+      ")");
+  at::autocast::set_autocast_persistent_cache_enabled(arg == Py_True);
+  Py_RETURN_NONE;
+  END_HANDLE_TH_ERRORS
+}
+
+static PyObject* clear_autocast_persistent_cache(
+    PyObject* _unused,
+    PyObject* arg) {
+  HANDLE_TH_ERRORS {
+    pybind11::gil_scoped_release no_gil;
+    at::autocast::clear_persistent_cache();
+  }
+  Py_RETURN_NONE;
+  END_HANDLE_TH_ERRORS
+}
+
 static PyObject* set_grad_enabled(
     PyObject* _unused,
     PyObject* args,
@@ -1278,6 +1329,18 @@ static PyMethodDef methods[] = { // NOLINT
      METH_NOARGS,
      nullptr},
     {"set_autocast_cache_enabled", set_autocast_cache_enabled, METH_O, nullptr},
+    {"_is_autocast_persistent_cache_enabled",
+     is_autocast_persistent_cache_enabled,
+     METH_NOARGS,
+     nullptr},
+    {"_set_autocast_persistent_cache_enabled",
+     set_autocast_persistent_cache_enabled,
+     METH_O,
+     nullptr},
+    {"_clear_autocast_persistent_cache",
+     clear_autocast_persistent_cache,
+     METH_NOARGS,
+     nullptr},
     {"_increment_version", THPModule_increment_version, METH_O, nullptr},
     {"set_anomaly_enabled",
      castPyCFunctionWithKeywords(set_anomaly_mode_enabled),
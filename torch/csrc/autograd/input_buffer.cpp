@@ -8,12 +8,19 @@
 #include <ATen/core/grad_mode.h>
 #include <ATen/native/SparseTensorUtils.h>
 
+#ifndef AT_PER_OPERATOR_HEADERS
+#include <ATen/Functions.h>
+#else
+#include <ATen/ops/_foreach_add.h>
+#endif
+
 #include <c10/core/DeviceGuard.h>
 #include <c10/core/Event.h>
 #include <c10/core/StreamGuard.h>
 #include <c10/util/Optional.h>
 
 #include <cstddef>
+#include <cstdlib>
 #include <utility>
 #include <vector>
 
@@ -82,6 +89,31 @@ bool can_accumulate_inplace(const Variable& v) {
       at::caching::adjusted_use_count(v) == 1 && v.has_storage() &&
       v.storage().use_count() == 1);
 }
+
+// Opt-in (TORCH_AUTOGRAD_BATCHED_ACCUMULATION=1): instead of launching one
+// add_ kernel per incoming edge, queue eligible gradients and flush them
+// through a single at::_foreach_add_ call when the buffer is consumed. This
+// collapses the thousands of tiny accumulation launches produced by graphs
+// with heavy weight sharing.
+bool batched_accumulation_enabled() {
+  static const bool enabled = [] {
+    auto* env = getenv("TORCH_AUTOGRAD_BATCHED_ACCUMULATION");
+    return env && env[0] == '1' && env[1] == '\0';
+  }();
+  return enabled;
+}
+
+// Deferred accumulation must match the in-place fast path of accumulate()
+// exactly: the flush runs buffer[pos].add_(var), so reuse its eligibility
+// rules, and additionally require matching sizes/dtype so _foreach_add_ can
+// take its fused multi-tensor route.
+bool can_defer_accumulation(const Variable& old_var, const Variable& var) {
+  return !at::GradMode::is_enabled() && !old_var.is_sparse() &&
+      !old_var.is_sparse_csr() && var.layout() == c10::kStrided &&
+      can_accumulate_inplace(old_var) && !at::isTensorSubclassLike(var) &&
+      old_var.sizes().equals(var.sizes()) &&
+      old_var.scalar_type() == var.scalar_type();
+}
 } // anonymous namespace
 
 static void accumulate(
@@ -210,6 +242,16 @@ void InputBuffer::add(
   auto& old_var = buffer[pos];
   if (!old_var.defined()) {
     buffer[pos] = std::move(var);
+  } else if (
+      opt_accumulate_stream && opt_producer_stream &&
+      batched_accumulation_enabled() &&
+      can_defer_accumulation(old_var, var)) {
+    // All the stream synchronization above has already run, so the gradient
+    // is safe to consume on the accumulation stream whenever the flush
+    // happens. Batching is restricted to the device-thread path (a producer
+    // stream is present); other callers read `buffer` directly and expect it
+    // to be up to date.
+    defer_accumulation(pos, std::move(var), *opt_accumulate_stream);
   } else {
     if (opt_accumulate_stream) {
       c10::OptionalStreamGuard stream_guard{opt_accumulate_stream};
@@ -223,6 +265,45 @@ void InputBuffer::add(
   }
 }
 
+void InputBuffer::defer_accumulation(
+    size_t pos,
+    Variable&& var,
+    const c10::Stream& stream) {
+  // All pending gradients are flushed with one _foreach_add_ on one stream;
+  // a stream change or a second gradient for the same slot (which would put
+  // duplicate tensors in the self list) flushes what has been queued so far.
+  if (pending_stream_ && *pending_stream_ != stream) {
+    flush_pending();
+  }
+  for (const auto queued_pos : pending_pos_) {
+    if (queued_pos == pos) {
+      flush_pending();
+      break;
+    }
+  }
+  pending_stream_ = stream;
+  pending_pos_.push_back(pos);
+  pending_grads_.push_back(std::move(var));
+}
+
+void InputBuffer::flush_pending() {
+  if (pending_pos_.empty()) {
+    return;
+  }
+  std::vector<at::Tensor> sums;
+  sums.reserve(pending_pos_.size());
+  for (const auto pos : pending_pos_) {
+    sums.push_back(buffer[pos]);
+  }
+  c10::OptionalStreamGuard stream_guard{pending_stream_};
+  // In-place accumulation is safe for the same reasons as accumulate()'s
+  // add_ fast path: eligibility was checked per gradient when it was queued.
+  at::_foreach_add_(sums, pending_grads_);
+  pending_pos_.clear();
+  pending_grads_.clear();
+  pending_stream_ = c10::nullopt;
+}
+
 auto InputBuffer::device() const -> at::Device {
   // Since we pick the first non-CPU tensor, this won't work with
   // mixed device-type operations (e.g., an op that is both CUDA
@@ -242,6 +323,7 @@ auto InputBuffer::device() const -> at::Device {
 }
 
 auto InputBuffer::variables(InputBuffer&& g) -> std::vector<Variable> {
+  g.flush_pending();
   std::vector<Variable> result = std::move(g.buffer);
   return result;
 }
@@ -39,7 +39,22 @@ struct InputBuffer {
   // Returns the inputs as a list of variables. Destroys given InputBuffer.
   static std::vector<Variable> variables(InputBuffer&& g);
 
+  // Applies any gradients deferred by batched accumulation mode (see
+  // TORCH_AUTOGRAD_BATCHED_ACCUMULATION in input_buffer.cpp) with a single
+  // at::_foreach_add_ call. Must be called before reading `buffer` directly;
+  // variables() flushes on its own.
+  TORCH_API void flush_pending();
+
   std::vector<Variable> buffer;
+
+ private:
+  void defer_accumulation(size_t pos, Variable&& var, const c10::Stream& stream);
+
+  // Deferred gradients for batched accumulation: pending_grads_[i] still has
+  // to be added to buffer[pending_pos_[i]] on pending_stream_.
+  std::vector<size_t> pending_pos_;
+  std::vector<Variable> pending_grads_;
+  std::optional<c10::Stream> pending_stream_;
 };
 
 } // namespace torch::autograd
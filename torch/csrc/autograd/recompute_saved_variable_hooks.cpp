@@ -0,0 +1,214 @@
+#include <torch/csrc/autograd/recompute_saved_variable_hooks.h>
+
+#include <ATen/core/dispatch/Dispatcher.h>
+#include <ATen/record_function.h>
+#include <c10/core/GradMode.h>
+#include <torch/csrc/profiler/util.h>
+
+#include <atomic>
+#include <deque>
+#include <unordered_map>
+#include <utility>
+
+namespace torch::autograd {
+
+using recompute_detail::Recipe;
+
+namespace {
+
+// Producers of recently finished ops, keyed by output TensorImpl. A recipe
+// keeps its input tensors alive, so the registry is bounded: only the most
+// recent kMaxRecipes producers are retained, which is plenty since autograd
+// packs a node's saved tensors right when the op consuming them runs.
+constexpr size_t kMaxRecipes = 64;
+
+struct RecomputeTLS {
+  int64_t budget_bytes = -1;
+  at::CallbackHandle handle = at::INVALID_CALLBACK_HANDLE;
+  std::unordered_map<const c10::TensorImpl*, std::shared_ptr<Recipe>> recipes;
+  std::deque<std::pair<const c10::TensorImpl*, std::shared_ptr<Recipe>>>
+      recipe_order;
+};
+
+thread_local RecomputeTLS recompute_tls;
+
+// Bytes currently kept alive by this mode. Tracked process-wide rather than
+// per-thread: packing runs on the forward thread, but SavedVariables are
+// released from autograd engine threads.
+std::atomic<int64_t> kept_bytes{0};
+
+struct CaptureContext : public at::ObserverContext {
+  c10::OperatorName op_name;
+  std::shared_ptr<std::vector<c10::IValue>> inputs;
+  uint64_t flops = 0;
+  bool skip = true;
+};
+
+bool is_replayable(const c10::OperatorHandle& op) {
+  // In-place and out= ops do not equal a pure replay of their inputs, and
+  // replaying a seeded op would advance the RNG to a different draw.
+  return !op.schema().is_mutable() &&
+      !op.hasTag(at::Tag::nondeterministic_seeded);
+}
+
+std::unique_ptr<at::ObserverContext> onFunctionEnter(
+    const at::RecordFunction& fn) {
+  auto ctx = std::make_unique<CaptureContext>();
+  const auto op_name = fn.operator_name();
+  if (!op_name.has_value()) {
+    return ctx;
+  }
+  const auto op = c10::Dispatcher::singleton().findOp(*op_name);
+  if (!op.has_value() || !is_replayable(*op)) {
+    return ctx;
+  }
+  const auto inputs = fn.inputs();
+  for (const auto& input : inputs) {
+    if (input.isGenerator()) {
+      return ctx;
+    }
+  }
+  ctx->op_name = *op_name;
+  ctx->inputs =
+      std::make_shared<std::vector<c10::IValue>>(inputs.begin(), inputs.end());
+  // The profiler cost model knows the matrix and convolution ops; for
+  // everything else the elementwise estimate below is filled in once the
+  // output sizes are known.
+  ctx->flops = torch::profiler::impl::computeFlops(
+      op_name->name, torch::profiler::impl::saveExtraArgs(fn));
+  ctx->skip = false;
+  return ctx;
+}
+
+void onFunctionExit(const at::RecordFunction& fn, at::ObserverContext* raw) {
+  auto* ctx = static_cast<CaptureContext*>(raw);
+  if (ctx == nullptr || ctx->skip) {
+    return;
+  }
+  const auto& outputs = fn.outputs();
+  int64_t out_numel = 0;
+  for (const auto& out : outputs) {
+    if (out.isTensor() && out.toTensor().defined()) {
+      out_numel += out.toTensor().numel();
+    }
+  }
+  if (out_numel == 0) {
+    return;
+  }
+  const uint64_t flops =
+      ctx->flops != 0 ? ctx->flops : static_cast<uint64_t>(out_numel);
+  auto& tls = recompute_tls;
+  for (size_t i = 0; i < outputs.size(); ++i) {
+    if (!outputs[i].isTensor()) {
+      continue;
+    }
+    const auto& t = outputs[i].toTensor();
+    if (!t.defined() || t.layout() != c10::kStrided) {
+      continue;
+    }
+    auto recipe = std::make_shared<Recipe>(Recipe{
+        ctx->op_name,
+        ctx->inputs,
+        i,
+        flops,
+        static_cast<int64_t>(t.nbytes())});
+    const auto* impl = t.unsafeGetTensorImpl();
+    tls.recipes[impl] = recipe;
+    tls.recipe_order.emplace_back(impl, std::move(recipe));
+  }
+  while (tls.recipe_order.size() > kMaxRecipes) {
+    const auto& [impl, recipe] = tls.recipe_order.front();
+    const auto it = tls.recipes.find(impl);
+    // Only evict if a newer op has not re-registered this impl.
+    if (it != tls.recipes.end() && it->second == recipe) {
+      tls.recipes.erase(it);
+    }
+    tls.recipe_order.pop_front();
+  }
+}
+
+} // namespace
+
+void RecomputeSavedVariableHooks::call_pack_hook(const at::Tensor& tensor) {
+  const int64_t bytes =
+      tensor.defined() ? static_cast<int64_t>(tensor.nbytes()) : 0;
+  auto& tls = recompute_tls;
+  if (tls.budget_bytes >= 0 && bytes > 0 &&
+      kept_bytes.load(std::memory_order_relaxed) + bytes > tls.budget_bytes) {
+    const auto it = tls.recipes.find(tensor.unsafeGetTensorImpl());
+    if (it != tls.recipes.end() &&
+        static_cast<double>(it->second->flops) <=
+            kMaxRecomputeFlopsPerByte *
+                static_cast<double>(it->second->bytes)) {
+      recipe_ = it->second;
+      expected_sizes_ = tensor.sizes().vec();
+      return;
+    }
+  }
+  packed_ = tensor;
+  counted_bytes_ = bytes;
+  kept_bytes.fetch_add(bytes, std::memory_order_relaxed);
+}
+
+at::Tensor RecomputeSavedVariableHooks::call_unpack_hook() {
+  if (!recipe_) {
+    return packed_;
+  }
+  const auto op = c10::Dispatcher::singleton().findOp(recipe_->op_name);
+  TORCH_INTERNAL_ASSERT(
+      op.has_value(),
+      "operator ",
+      recipe_->op_name,
+      " vanished between saving an activation and recomputing it");
+  std::vector<c10::IValue> stack = *recipe_->inputs;
+  {
+    // The replay must not be differentiated: the recomputed value is a
+    // stand-in for data the graph already accounts for.
+    c10::AutoGradMode no_grad(false);
+    op->callBoxed(&stack);
+  }
+  TORCH_INTERNAL_ASSERT(recipe_->output_index < stack.size());
+  at::Tensor result = stack[recipe_->output_index].toTensor();
+  TORCH_CHECK(
+      result.defined() && result.sizes() == expected_sizes_,
+      "recomputing a saved tensor with ",
+      recipe_->op_name,
+      " produced an unexpected shape; was an input modified in place?");
+  return result;
+}
+
+RecomputeSavedVariableHooks::~RecomputeSavedVariableHooks() {
+  if (counted_bytes_ > 0) {
+    kept_bytes.fetch_sub(counted_bytes_, std::memory_order_relaxed);
+  }
+}
+
+int64_t set_saved_tensors_memory_budget(int64_t budget_bytes) {
+  auto& tls = recompute_tls;
+  const int64_t prior = tls.budget_bytes;
+  if (budget_bytes < 0) {
+    if (tls.handle != at::INVALID_CALLBACK_HANDLE) {
+      at::removeCallback(tls.handle);
+      tls.handle = at::INVALID_CALLBACK_HANDLE;
+    }
+    tls.budget_bytes = -1;
+    tls.recipes.clear();
+    tls.recipe_order.clear();
+    return prior;
+  }
+  tls.budget_bytes = budget_bytes;
+  if (tls.handle == at::INVALID_CALLBACK_HANDLE) {
+    tls.handle = at::addThreadLocalCallback(
+        at::RecordFunctionCallback(&onFunctionEnter, &onFunctionExit)
+            .needsInputs(true)
+            .needsOutputs(true)
+            .scopes({at::RecordScope::FUNCTION}));
+  }
+  return prior;
+}
+
+int64_t get_saved_tensors_memory_budget() {
+  return recompute_tls.budget_bytes;
+}
+
+} // namespace torch::autograd
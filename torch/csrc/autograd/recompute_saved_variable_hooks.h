@@ -0,0 +1,74 @@
+#pragma once
+
+#include <ATen/core/Tensor.h>
+#include <ATen/core/ivalue.h>
+#include <ATen/core/operator_name.h>
+#include <torch/csrc/autograd/saved_variable_hooks.h>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace torch::autograd {
+
+namespace recompute_detail {
+
+// How to rebuild a dropped activation: replay the operator that produced it
+// from strongly held inputs and take the recorded output. Recipes are
+// captured by a RecordFunction observer when an op returns, together with
+// the cost-model inputs used to decide whether a replay is worth it.
+struct Recipe {
+  c10::OperatorName op_name;
+  std::shared_ptr<std::vector<c10::IValue>> inputs;
+  size_t output_index;
+  uint64_t flops;
+  int64_t bytes;
+};
+
+} // namespace recompute_detail
+
+// Native implementation of memory-budget driven activation recomputation.
+// While a budget is set on the current thread (see
+// set_saved_tensors_memory_budget below), a RecordFunction observer records,
+// for every non-mutating deterministic op, how its outputs could be replayed
+// from its inputs along with their estimated recompute flops. When autograd
+// then saves a tensor for backward and the bytes kept alive by this mode
+// already exceed the budget, the tensor is dropped instead of saved,
+// provided its producer is cheap to replay (at most kMaxRecomputeFlopsPerByte
+// estimated flops per byte won back, which admits elementwise and
+// normalization-style ops but not matmuls or convolutions). Unpacking during
+// backward re-dispatches the recorded op under no-grad mode and returns the
+// recorded output, so the whole round trip stays in C++ and works from
+// TorchScript and the C++ frontend alike.
+//
+// The selection is greedy in saving order: once the budget is exceeded,
+// every subsequently saved cheap tensor is dropped. Tensors saved by the
+// very node that produced them (e.g. softmax saving its result) are always
+// kept, because their recipe is only recorded when the producing op returns,
+// after the save; the big consumers of activation memory — inputs saved by
+// matmul, convolution and similar nodes — are covered.
+struct TORCH_API RecomputeSavedVariableHooks : public SavedVariableHooks {
+  void call_pack_hook(const at::Tensor& tensor) override;
+  at::Tensor call_unpack_hook() override;
+  ~RecomputeSavedVariableHooks() override;
+
+  // An op is only replayed if it costs at most this many estimated flops per
+  // byte of activation memory it wins back; elementwise ops sit well below
+  // one, matmuls and convolutions in the hundreds to thousands.
+  static constexpr double kMaxRecomputeFlopsPerByte = 16.0;
+
+ private:
+  at::Tensor packed_;
+  std::shared_ptr<recompute_detail::Recipe> recipe_;
+  std::vector<int64_t> expected_sizes_;
+  int64_t counted_bytes_ = 0;
+};
+
+// Enables (budget_bytes >= 0) or disables (budget_bytes < 0) the
+// memory-budget mode on the current thread and returns the previous budget.
+// The budget counts bytes kept alive by this mode across the process, since
+// saved tensors are released from autograd engine threads.
+TORCH_API int64_t set_saved_tensors_memory_budget(int64_t budget_bytes);
+TORCH_API int64_t get_saved_tensors_memory_budget();
+
+} // namespace torch::autograd
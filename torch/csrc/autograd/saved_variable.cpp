@@ -1,12 +1,15 @@
 #include <torch/csrc/autograd/saved_variable.h>
 
 #include <torch/csrc/autograd/anomaly_mode.h>
+#include <torch/csrc/autograd/cpu_offload_saved_variable_hooks.h>
 #include <torch/csrc/autograd/edge.h>
 #include <torch/csrc/autograd/engine.h>
 #include <torch/csrc/autograd/function.h>
 #include <torch/csrc/autograd/grad_mode.h>
+#include <torch/csrc/autograd/recompute_saved_variable_hooks.h>
 #include <torch/csrc/autograd/variable.h>
 
+#include <ATen/SavedTensorHooks.h>
 #include <ATen/Tensor.h>
 
 #include <memory>
@@ -105,7 +108,21 @@ void SavedVariable::save_metadata(const Variable& data) {
 }
 
 std::unique_ptr<SavedVariableHooks> SavedVariable::get_default_hooks() {
-  return Engine::get_default_engine().get_default_saved_variable_hooks();
+  auto hooks = Engine::get_default_engine().get_default_saved_variable_hooks();
+  if (hooks) {
+    return hooks;
+  }
+  // The native modes below only apply when no explicit default hook is
+  // installed; a memory budget takes precedence over CPU offload since it is
+  // the more specific request.
+  if (get_saved_tensors_memory_budget() >= 0) {
+    return std::make_unique<RecomputeSavedVariableHooks>();
+  }
+  // See NOTE: [Native CPU offload of saved tensors].
+  if (at::SavedTensorDefaultHooks::get_offload_to_cpu()) {
+    return std::make_unique<CpuOffloadSavedVariableHooks>();
+  }
+  return nullptr;
 }
 
 void SavedVariable::reset_data() {
@@ -90,6 +90,22 @@ void* CUDAPluggableAllocator::malloc(
   {
     const std::lock_guard<std::mutex> lock(allocator_mutex_);
     allocation_metadata_.emplace(r, _AllocationMetadata(size, device, stream));
+    if (device >= 0) {
+      if (static_cast<size_t>(device) >= device_stats_.size()) {
+        device_stats_.resize(device + 1);
+      }
+      auto& stats = device_stats_[device];
+      constexpr auto agg = static_cast<size_t>(
+          c10::cuda::CUDACachingAllocator::StatType::AGGREGATE);
+      auto bump = [](c10::cuda::CUDACachingAllocator::Stat& stat,
+                     int64_t amount) {
+        stat.current += amount;
+        stat.peak = std::max(stat.peak, stat.current);
+        stat.allocated += amount;
+      };
+      bump(stats.allocation[agg], 1);
+      bump(stats.allocated_bytes[agg], static_cast<int64_t>(size));
+    }
   }
   return r;
 }
@@ -137,6 +153,19 @@ void CUDAPluggableAllocator::raw_delete(void* ptr) {
     device_idx = metadata.device_idx;
     stream = metadata.stream;
     allocation_metadata_.erase(ptr);
+    if (device_idx >= 0 &&
+        static_cast<size_t>(device_idx) < device_stats_.size()) {
+      auto& stats = device_stats_[device_idx];
+      constexpr auto agg = static_cast<size_t>(
+          c10::cuda::CUDACachingAllocator::StatType::AGGREGATE);
+      auto drop = [](c10::cuda::CUDACachingAllocator::Stat& stat,
+                     int64_t amount) {
+        stat.current -= amount;
+        stat.freed += amount;
+      };
+      drop(stats.allocation[agg], 1);
+      drop(stats.allocated_bytes[agg], static_cast<int64_t>(size));
+    }
   }
   free_fn_(ptr, size, device_idx, stream);
 }
@@ -193,24 +222,39 @@ void CUDAPluggableAllocator::recordStream(
 
 c10::cuda::CUDACachingAllocator::DeviceStats CUDAPluggableAllocator::
     getDeviceStats(c10::DeviceIndex device) {
-  TORCH_CHECK(
-      false,
-      "CUDAPluggableAllocator does not yet support getDeviceStats. "
-      "If you need it, please file an issue describing your use case.");
+  const std::lock_guard<std::mutex> lock(allocator_mutex_);
+  if (device >= 0 && static_cast<size_t>(device) < device_stats_.size()) {
+    return device_stats_[device];
+  }
+  // No allocation has touched this device yet; everything is zero.
+  return c10::cuda::CUDACachingAllocator::DeviceStats();
 }
 
 void CUDAPluggableAllocator::resetAccumulatedStats(c10::DeviceIndex device) {
-  TORCH_CHECK(
-      false,
-      "CUDAPluggableAllocator does not yet support resetAccumulatedStats. "
-      "If you need it, please file an issue describing your use case.");
+  const std::lock_guard<std::mutex> lock(allocator_mutex_);
+  if (device < 0 || static_cast<size_t>(device) >= device_stats_.size()) {
+    return;
+  }
+  auto& stats = device_stats_[device];
+  constexpr auto agg = static_cast<size_t>(
+      c10::cuda::CUDACachingAllocator::StatType::AGGREGATE);
+  for (auto* stat : {&stats.allocation[agg], &stats.allocated_bytes[agg]}) {
+    stat->allocated = 0;
+    stat->freed = 0;
+  }
 }
 
 void CUDAPluggableAllocator::resetPeakStats(c10::DeviceIndex device) {
-  TORCH_CHECK(
-      false,
-      "CUDAPluggableAllocator does not yet support resetPeakStats. "
-      "If you need it, please file an issue describing your use case.");
+  const std::lock_guard<std::mutex> lock(allocator_mutex_);
+  if (device < 0 || static_cast<size_t>(device) >= device_stats_.size()) {
+    return;
+  }
+  auto& stats = device_stats_[device];
+  constexpr auto agg = static_cast<size_t>(
+      c10::cuda::CUDACachingAllocator::StatType::AGGREGATE);
+  for (auto* stat : {&stats.allocation[agg], &stats.allocated_bytes[agg]}) {
+    stat->peak = stat->current;
+  }
 }
 
 c10::cuda::CUDACachingAllocator::SnapshotInfo CUDAPluggableAllocator::
@@ -337,6 +381,85 @@ void CUDAPluggableAllocator::copy_data(
       cudaMemcpy(dest, src, count, cudaMemcpyKind::cudaMemcpyDeviceToDevice));
 }
 
+namespace {
+
+// State for the UVM preset. recordStream only receives the pointer, so the
+// sizes needed to re-issue prefetch hints are tracked here.
+std::mutex uvm_mutex;
+std::unordered_map<void*, size_t> uvm_allocation_sizes;
+
+bool uvm_device_supports_hints(int device) {
+  int concurrent_managed_access = 0;
+  C10_CUDA_CHECK(cudaDeviceGetAttribute(
+      &concurrent_managed_access,
+      cudaDevAttrConcurrentManagedAccess,
+      device));
+  return concurrent_managed_access != 0;
+}
+
+void* uvm_alloc(size_t size, int device, cudaStream_t stream) {
+  void* ptr = nullptr;
+  C10_CUDA_CHECK(cudaMallocManaged(&ptr, size));
+  if (uvm_device_supports_hints(device)) {
+    // Prefer device residency but let the driver evict pages to host under
+    // pressure; this is what makes working sets larger than VRAM page
+    // instead of OOM.
+    C10_CUDA_CHECK(
+        cudaMemAdvise(ptr, size, cudaMemAdviseSetPreferredLocation, device));
+    C10_CUDA_CHECK(
+        cudaMemAdvise(ptr, size, cudaMemAdviseSetAccessedBy, device));
+    C10_CUDA_CHECK(cudaMemPrefetchAsync(ptr, size, device, stream));
+  }
+  {
+    const std::lock_guard<std::mutex> lock(uvm_mutex);
+    uvm_allocation_sizes.emplace(ptr, size);
+  }
+  return ptr;
+}
+
+void uvm_free(
+    void* ptr,
+    size_t /*size*/,
+    int /*device*/,
+    cudaStream_t /*stream*/) {
+  {
+    const std::lock_guard<std::mutex> lock(uvm_mutex);
+    uvm_allocation_sizes.erase(ptr);
+  }
+  C10_CUDA_CHECK(cudaFree(ptr));
+}
+
+void uvm_record_stream(void* ptr, cudaStream_t stream) {
+  size_t size = 0;
+  {
+    const std::lock_guard<std::mutex> lock(uvm_mutex);
+    auto it = uvm_allocation_sizes.find(ptr);
+    if (it == uvm_allocation_sizes.end()) {
+      return;
+    }
+    size = it->second;
+  }
+  // The caller records the stream that will next touch this allocation;
+  // prefetch toward its device so evicted pages migrate back ahead of the
+  // kernel instead of faulting one page at a time.
+  int device = -1;
+  C10_CUDA_CHECK(cudaGetDevice(&device));
+  if (uvm_device_supports_hints(device)) {
+    C10_CUDA_CHECK(cudaMemPrefetchAsync(ptr, size, device, stream));
+  }
+}
+
+} // namespace
+
+std::shared_ptr<c10::cuda::CUDACachingAllocator::CUDAAllocator>
+createManagedAllocator() {
+  std::shared_ptr<CUDAPluggableAllocator> allocator(
+      new CUDAPluggableAllocator(uvm_alloc, uvm_free));
+  allocator->set_record_stream_fn(uvm_record_stream);
+  allocator->init(device_count);
+  return allocator;
+}
+
 std::shared_ptr<c10::cuda::CUDACachingAllocator::CUDAAllocator>
     current_custom_allocator;
 
@@ -23,6 +23,14 @@ std::shared_ptr<c10::cuda::CUDACachingAllocator::CUDAAllocator>
 createCustomAllocator(
     std::function<void*(size_t, int, cudaStream_t)> alloc_fn,
     std::function<void(void*, size_t, int, cudaStream_t)> free_fn);
+// Preset allocator backed by cudaMallocManaged. Allocations prefer device
+// residency (cudaMemAdviseSetPreferredLocation) but can be evicted to host
+// memory under pressure, so working sets larger than VRAM degrade to UVM
+// paging instead of raising OOM. recordStream re-issues a prefetch hint to
+// the using stream's device, pulling pages back in before the kernel that
+// needs them.
+std::shared_ptr<c10::cuda::CUDACachingAllocator::CUDAAllocator>
+createManagedAllocator();
 void changeCurrentAllocator(
     const std::shared_ptr<c10::cuda::CUDACachingAllocator::CUDAAllocator>&
         allocator);
@@ -146,6 +154,11 @@ struct CUDAPluggableAllocator
   std::mutex allocator_mutex_;
   // We do the bookeeping here in order to simplify custom allocators
   std::unordered_map<void*, _AllocationMetadata> allocation_metadata_;
+  // Aggregate allocation counters derived from the bookkeeping above, so
+  // the torch.cuda.memory_allocated()/max_memory_allocated() surface works
+  // with any pluggable allocator. Only StatType::AGGREGATE is populated;
+  // pool split and segment stats don't apply here.
+  std::vector<c10::cuda::CUDACachingAllocator::DeviceStats> device_stats_;
 
   bool initialized_ = false;
 };
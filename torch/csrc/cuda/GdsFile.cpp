@@ -0,0 +1,194 @@
+#include <torch/csrc/cuda/GdsFile.h>
+#include <torch/csrc/utils/pybind.h>
+
+#if defined(USE_CUFILE)
+#include <c10/cuda/CUDAGuard.h>
+
+#include <cufile.h>
+
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <unordered_map>
+
+namespace {
+
+// cuFile APIs return either a CUfileError_t carrying a cuFile error code
+// (possibly with an attached CUDA error), or for the read/write calls a
+// negative value that is either -1 with errno set or a negated cuFile error.
+std::string cuGDSFileGetErrorString(int status) {
+  status = std::abs(status);
+  return IS_CUFILE_ERR(status) ? std::string(CUFILE_ERRSTR(status))
+                               : std::string(std::strerror(status));
+}
+
+std::string cuGDSFileGetErrorString(CUfileError_t status) {
+  std::string errStr = cuGDSFileGetErrorString(static_cast<int>(status.err));
+  if (IS_CUDA_ERR(status)) {
+    errStr.append(".").append(
+        cudaGetErrorString(static_cast<cudaError_t>(status.cu_err)));
+  }
+  return errStr;
+}
+
+// Registered cuFile handles, keyed by the id handed back to Python. The ids
+// are never reused so a double-deregister fails loudly instead of silently
+// operating on an unrelated file.
+std::mutex gds_handles_mutex;
+int64_t gds_next_handle_id = 0;
+std::unordered_map<int64_t, CUfileHandle_t> gds_handles;
+
+CUfileHandle_t lookup_handle(int64_t handle_id) {
+  std::lock_guard<std::mutex> guard(gds_handles_mutex);
+  auto it = gds_handles.find(handle_id);
+  TORCH_CHECK(
+      it != gds_handles.end(), "Invalid GDS file handle: ", handle_id);
+  return it->second;
+}
+
+} // namespace
+
+namespace torch::cuda {
+
+void gds_register_buffer(const at::Storage& storage) {
+  CUfileError_t status =
+      cuFileBufRegister(storage.mutable_data(), storage.nbytes(), 0);
+  TORCH_CHECK(
+      status.err == CU_FILE_SUCCESS,
+      "cuFileBufRegister failed: ",
+      cuGDSFileGetErrorString(status));
+}
+
+void gds_deregister_buffer(const at::Storage& storage) {
+  CUfileError_t status = cuFileBufDeregister(storage.mutable_data());
+  TORCH_CHECK(
+      status.err == CU_FILE_SUCCESS,
+      "cuFileBufDeregister failed: ",
+      cuGDSFileGetErrorString(status));
+}
+
+int64_t gds_register_handle(int fd) {
+  CUfileDescr_t descr;
+  memset(&descr, 0, sizeof(descr));
+  descr.handle.fd = fd;
+  descr.type = CU_FILE_HANDLE_TYPE_OPAQUE_FD;
+  CUfileHandle_t handle;
+  CUfileError_t status = cuFileHandleRegister(&handle, &descr);
+  TORCH_CHECK(
+      status.err == CU_FILE_SUCCESS,
+      "cuFileHandleRegister failed: ",
+      cuGDSFileGetErrorString(status));
+
+  std::lock_guard<std::mutex> guard(gds_handles_mutex);
+  const int64_t handle_id = gds_next_handle_id++;
+  gds_handles.emplace(handle_id, handle);
+  return handle_id;
+}
+
+void gds_deregister_handle(int64_t handle_id) {
+  std::lock_guard<std::mutex> guard(gds_handles_mutex);
+  auto it = gds_handles.find(handle_id);
+  TORCH_CHECK(
+      it != gds_handles.end(), "Invalid GDS file handle: ", handle_id);
+  cuFileHandleDeregister(it->second);
+  gds_handles.erase(it);
+}
+
+void gds_load_storage(
+    int64_t handle_id,
+    const at::Storage& storage,
+    int64_t offset) {
+  CUfileHandle_t handle = lookup_handle(handle_id);
+  c10::cuda::CUDAGuard gpuGuard(storage.device());
+
+  const size_t nbytes = storage.nbytes();
+  // cuFile DMAs straight into the device buffer when the filesystem and
+  // driver support GDS, and transparently stages through its internal bounce
+  // buffers in compatibility mode otherwise.
+  ssize_t ret = cuFileRead(handle, storage.mutable_data(), nbytes, offset, 0);
+  TORCH_CHECK(ret >= 0, "cuFileRead failed: ", cuGDSFileGetErrorString(ret));
+  TORCH_CHECK(
+      static_cast<size_t>(ret) == nbytes,
+      "cuFileRead read ",
+      ret,
+      " bytes, expected ",
+      nbytes);
+}
+
+void gds_save_storage(
+    int64_t handle_id,
+    const at::Storage& storage,
+    int64_t offset) {
+  CUfileHandle_t handle = lookup_handle(handle_id);
+  c10::cuda::CUDAGuard gpuGuard(storage.device());
+
+  const size_t nbytes = storage.nbytes();
+  ssize_t ret = cuFileWrite(handle, storage.mutable_data(), nbytes, offset, 0);
+  TORCH_CHECK(ret >= 0, "cuFileWrite failed: ", cuGDSFileGetErrorString(ret));
+  TORCH_CHECK(
+      static_cast<size_t>(ret) == nbytes,
+      "cuFileWrite wrote ",
+      ret,
+      " bytes, expected ",
+      nbytes);
+}
+
+} // namespace torch::cuda
+
+#else // USE_CUFILE
+
+namespace torch::cuda {
+
+namespace {
+constexpr const char* kNoCufileError =
+    "PyTorch was not built with cuFile/GPUDirect Storage support (USE_CUFILE)";
+} // namespace
+
+void gds_register_buffer(const at::Storage& storage) {
+  TORCH_CHECK(false, kNoCufileError);
+}
+
+void gds_deregister_buffer(const at::Storage& storage) {
+  TORCH_CHECK(false, kNoCufileError);
+}
+
+int64_t gds_register_handle(int fd) {
+  TORCH_CHECK(false, kNoCufileError);
+}
+
+void gds_deregister_handle(int64_t handle_id) {
+  TORCH_CHECK(false, kNoCufileError);
+}
+
+void gds_load_storage(
+    int64_t handle_id,
+    const at::Storage& storage,
+    int64_t offset) {
+  TORCH_CHECK(false, kNoCufileError);
+}
+
+void gds_save_storage(
+    int64_t handle_id,
+    const at::Storage& storage,
+    int64_t offset) {
+  TORCH_CHECK(false, kNoCufileError);
+}
+
+} // namespace torch::cuda
+
+#endif // USE_CUFILE
+
+namespace torch::cuda {
+
+void initGdsBindings(PyObject* module) {
+  auto m = py::handle(module).cast<py::module>();
+
+  m.def("_gds_register_buffer", &gds_register_buffer);
+  m.def("_gds_deregister_buffer", &gds_deregister_buffer);
+  m.def("_gds_register_handle", &gds_register_handle);
+  m.def("_gds_deregister_handle", &gds_deregister_handle);
+  m.def("_gds_load_storage", &gds_load_storage);
+  m.def("_gds_save_storage", &gds_save_storage);
+}
+
+} // namespace torch::cuda
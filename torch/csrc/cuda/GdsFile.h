@@ -0,0 +1,11 @@
+#pragma once
+
+#include <torch/csrc/python_headers.h>
+
+namespace torch::cuda {
+
+// Registers the cuFile/GPUDirect Storage bindings (torch._C._gds_*). The
+// bindings are always registered; without USE_CUFILE they raise on use.
+void initGdsBindings(PyObject* module);
+
+} // namespace torch::cuda
@@ -35,6 +35,7 @@
 #include <torch/csrc/CudaIPCTypes.h>
 #include <torch/csrc/Generator.h>
 #include <torch/csrc/cuda/CUDAPluggableAllocator.h>
+#include <torch/csrc/cuda/GdsFile.h>
 #include <torch/csrc/cuda/THCP.h>
 #include <torch/csrc/cuda/memory_snapshot.h>
 #include <torch/csrc/cuda/python_comm.h>
@@ -627,6 +628,25 @@ PyObject* THCPModule_resetPeakMemoryStats(PyObject* _unused, PyObject* arg) {
   Py_RETURN_NONE;
 }
 
+PyObject* THCPModule_compactExpandableSegments(
+    PyObject* _unused,
+    PyObject* arg) {
+  HANDLE_TH_ERRORS
+  TORCH_CHECK(
+      THPUtils_checkLong(arg),
+      "invalid argument to compact_expandable_segments");
+  const auto device_index = THPUtils_unpackDeviceIndex(arg);
+  size_t reclaimed = 0;
+  {
+    pybind11::gil_scoped_release no_gil;
+    reclaimed =
+        c10::cuda::CUDACachingAllocator::compactExpandableSegments(
+            device_index);
+  }
+  return THPUtils_packUInt64(reclaimed);
+  END_HANDLE_TH_ERRORS
+}
+
 CapturedTraceback* getFromContext(
     const std::shared_ptr<c10::GatheredContext>& x) {
   if (CapturedTraceback* sc = dynamic_cast<CapturedTraceback*>(x.get())) {
@@ -836,6 +856,14 @@ PyObject* THCPModule_memorySnapshot(PyObject* _unused, PyObject* noargs) {
   END_HANDLE_TH_ERRORS
 }
 
+PyObject* THCPModule_memoryCollapsedStacks(
+    PyObject* _unused,
+    PyObject* noargs) {
+  HANDLE_TH_ERRORS
+  return THPUtils_packString(torch::cuda::_memory_snapshot_collapsed_stacks());
+  END_HANDLE_TH_ERRORS
+}
+
 PyObject* THCPModule_attachOutOfMemoryObserver(
     PyObject* _unused,
     PyObject* observer) {
@@ -1137,6 +1165,10 @@ static void registerCudaPluggableAllocator(PyObject* module) {
         malloc_fn, free_fn);
   });
 
+  m.def("_cuda_createManagedAllocator", []() {
+    return torch::cuda::CUDAPluggableAllocator::createManagedAllocator();
+  });
+
   // NOLINTNEXTLINE(bugprone-unused-raii)
   py::class_<
       c10::cuda::CUDACachingAllocator::AllocatorState,
@@ -1778,7 +1810,15 @@ static struct PyMethodDef _THCPModule_methods[] = {
      THCPModule_resetPeakMemoryStats,
      METH_O,
      nullptr},
+    {"_cuda_compactExpandableSegments",
+     THCPModule_compactExpandableSegments,
+     METH_O,
+     nullptr},
     {"_cuda_memorySnapshot", THCPModule_memorySnapshot, METH_NOARGS, nullptr},
+    {"_cuda_memoryCollapsedStacks",
+     THCPModule_memoryCollapsedStacks,
+     METH_NOARGS,
+     nullptr},
     {"_cuda_attach_out_of_memory_observer",
      THCPModule_attachOutOfMemoryObserver,
      METH_O,
@@ -1938,6 +1978,7 @@ void initModule(PyObject* module) {
 #endif
   registerCudaDeviceProperties(module);
   registerCudaPluggableAllocator(module);
+  initGdsBindings(module);
 }
 
 } // namespace torch::cuda
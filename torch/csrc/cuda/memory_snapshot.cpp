@@ -6,6 +6,9 @@
 #include <torch/csrc/jit/serialization/pickler.h>
 #include <torch/csrc/profiler/combined_traceback.h>
 
+#include <map>
+#include <sstream>
+
 namespace torch::cuda {
 
 using c10::Dict;
@@ -407,4 +410,76 @@ std::string _memory_snapshot_pickled() {
 
   return write_pickle(result);
 }
+
+std::string _memory_snapshot_collapsed_stacks() {
+  auto snapshot = c10::cuda::CUDACachingAllocator::snapshot();
+
+  // Live bytes keyed by the traceback captured when the memory was
+  // allocated. Allocated blocks are attributed to their allocation site;
+  // segments with no allocated blocks (cached but unused memory) are
+  // attributed to the stack that first mapped the segment, since that is
+  // what a leaking extension leaves behind. Contexts are only present when
+  // _record_memory_history is enabled.
+  std::unordered_map<CapturedTraceback*, int64_t> live_bytes;
+  std::vector<CapturedTraceback*> tracebacks;
+  auto add_bytes = [&](const std::shared_ptr<c10::GatheredContext>& ctx,
+                       int64_t bytes) {
+    if (!ctx) {
+      return;
+    }
+    auto* tb = getFromContext(ctx);
+    auto it = live_bytes.find(tb);
+    if (it == live_bytes.end()) {
+      live_bytes.emplace(tb, bytes);
+      tracebacks.push_back(tb);
+    } else {
+      it->second += bytes;
+    }
+  };
+
+  for (const auto& segmentInfo : snapshot.segments) {
+    bool any_allocated = false;
+    for (const auto& blockInfo : segmentInfo.blocks) {
+      if (blockInfo.allocated) {
+        any_allocated = true;
+        add_bytes(
+            blockInfo.context_when_allocated,
+            static_cast<int64_t>(blockInfo.size));
+      }
+    }
+    if (!any_allocated) {
+      add_bytes(
+          segmentInfo.context_when_allocated,
+          static_cast<int64_t>(segmentInfo.total_size));
+    }
+  }
+
+  auto s = symbolize(tracebacks);
+
+  // Distinct traceback objects can symbolize to the same frames, so merge
+  // by the rendered stack. Frames are emitted root-first, matching the
+  // ordering torch.cuda._memory_viz produces for flamegraph.pl.
+  std::map<std::string, int64_t> collapsed;
+  for (const auto i : c10::irange(tracebacks.size())) {
+    std::ostringstream stack;
+    const auto& tb = s.tracebacks.at(i);
+    bool first = true;
+    for (auto it = tb.rbegin(); it != tb.rend(); ++it) {
+      const auto& f = s.all_frames.at(*it);
+      if (!first) {
+        stack << ';';
+      }
+      first = false;
+      auto basename = f.filename.substr(f.filename.find_last_of('/') + 1);
+      stack << basename << ':' << f.lineno << ':' << f.funcname;
+    }
+    collapsed[stack.str()] += live_bytes.at(tracebacks.at(i));
+  }
+
+  std::ostringstream result;
+  for (const auto& entry : collapsed) {
+    result << entry.first << ' ' << entry.second << '\n';
+  }
+  return result.str();
+}
 } // namespace torch::cuda
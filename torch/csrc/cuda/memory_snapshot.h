@@ -24,4 +24,11 @@ TORCH_CUDA_CU_API void _record_memory_history(
 
 TORCH_CUDA_CU_API std::string _memory_snapshot_pickled();
 
+// Aggregates the live bytes currently held by the caching allocator per
+// allocation-site traceback and renders them in collapsed-stack format
+// ("frame;frame;frame bytes\n..."), suitable for flamegraph.pl or
+// speedscope. Requires _record_memory_history to have been enabled;
+// pass stacks="all" to attribute C++ call sites as well.
+TORCH_CUDA_CU_API std::string _memory_snapshot_collapsed_stacks();
+
 } // namespace torch::cuda
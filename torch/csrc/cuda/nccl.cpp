@@ -954,6 +954,99 @@ void all2all(
 #endif
 }
 
+namespace {
+
+// Returns the number of elements in one slice along dim 0 and checks that
+// every slice is contiguous in memory, i.e. the layout is (n, block) with an
+// arbitrary outer stride. This is the shape a transposed block layout has.
+size_t _check_slice_contiguous(const at::Tensor& t) {
+  TORCH_CHECK(
+      t.dim() >= 1, "all2all_segmented expects tensors with at least 1 dim");
+  size_t slice_numel = 1;
+  int64_t expected_stride = 1;
+  for (int64_t d = t.dim() - 1; d >= 1; d--) {
+    TORCH_CHECK(
+        t.size(d) <= 1 || t.stride(d) == expected_stride,
+        "all2all_segmented expects slices along dim 0 to be contiguous, got "
+        "sizes ",
+        t.sizes(),
+        " and strides ",
+        t.strides());
+    expected_stride *= t.size(d);
+    slice_numel *= t.size(d);
+  }
+  TORCH_CHECK(
+      t.size(0) <= 1 || t.stride(0) >= expected_stride,
+      "all2all_segmented expects non-overlapping slices, got sizes ",
+      t.sizes(),
+      " and strides ",
+      t.strides());
+  return slice_numel;
+}
+
+} // namespace
+
+void all2all_segmented(
+    std::vector<at::Tensor>& outputTensors,
+    std::vector<at::Tensor>& inputTensors,
+    ncclComm_t _comm,
+    at::cuda::CUDAStream& stream) {
+#ifdef USE_NCCL
+#if defined(NCCL_MAJOR) && \
+    ((NCCL_MAJOR > 2) || ((NCCL_MAJOR == 2) && (NCCL_MINOR >= 7)))
+  using namespace torch::cuda::nccl::detail;
+  auto comm = to_nccl_comm(_comm);
+
+  NCCL_CHECK(ncclGroupStart());
+  for (const auto r : c10::irange(outputTensors.size())) {
+    at::Tensor& input = inputTensors[r];
+    at::Tensor& output = outputTensors[r];
+
+    size_t send_slice = _check_slice_contiguous(input);
+    size_t recv_slice = _check_slice_contiguous(output);
+    auto* sendbuff = reinterpret_cast<const char*>(input.const_data_ptr());
+    auto* recvbuff = reinterpret_cast<char*>(output.data_ptr());
+    size_t send_stride = input.stride(0) * input.element_size();
+    size_t recv_stride = output.stride(0) * output.element_size();
+
+    // One message per slice; the peer's matching tensor must have the same
+    // leading dimension so that the message streams pair up.
+    for (const auto i : c10::irange(input.size(0))) {
+      if (_nccl_should_send_recv(send_slice)) {
+        NCCL_CHECK(ncclSend(
+            sendbuff + i * send_stride,
+            send_slice,
+            to_nccl_data_type(input),
+            r,
+            comm,
+            stream.stream()));
+      }
+    }
+    for (const auto i : c10::irange(output.size(0))) {
+      if (_nccl_should_send_recv(recv_slice)) {
+        NCCL_CHECK(ncclRecv(
+            recvbuff + i * recv_stride,
+            recv_slice,
+            to_nccl_data_type(output),
+            r,
+            comm,
+            stream.stream()));
+      }
+    }
+  }
+#ifndef NCCL_HAS_COMM_NONBLOCKING
+  NCCL_CHECK(ncclGroupEnd());
+#else
+  NCCL_CHECK_TIMEOUT(ncclGroupEnd(), _comm);
+#endif
+#else
+  AT_ERROR("all2all is only supported for NCCL lib version >= 2.7.0");
+#endif
+#else
+  AT_ERROR("PyTorch built without NCCL support");
+#endif
+}
+
 void send(
     const at::Tensor& input,
     ncclComm_t comm,
@@ -205,6 +205,18 @@ TORCH_CUDA_CPP_API void all2all(
     ncclComm_t _comm,
     at::cuda::CUDAStream& stream);
 
+// Like all2all, but sends every per-rank tensor slice-by-slice along dim 0,
+// so tensors only need contiguous slices (an arbitrary outer stride is fine).
+// This lets strided block layouts - e.g. the transpose an MoE dispatch wants -
+// feed the collective directly, without a permute+contiguous on either side.
+// Every rank must use this variant with matching leading dimensions, since
+// each slice becomes its own NCCL message.
+TORCH_CUDA_CPP_API void all2all_segmented(
+    std::vector<at::Tensor>& outputTensors,
+    std::vector<at::Tensor>& inputTensors,
+    ncclComm_t _comm,
+    at::cuda::CUDAStream& stream);
+
 TORCH_CUDA_CPP_API void send(
     const at::Tensor& input,
     ncclComm_t comm,
@@ -0,0 +1,125 @@
+#include <torch/csrc/distributed/c10d/CollectiveJournal.hpp>
+
+#include <chrono>
+#include <cstdlib>
+#include <string>
+
+#include <c10/util/Logging.h>
+#include <torch/csrc/distributed/c10d/Utils.hpp>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace c10d {
+
+namespace {
+
+uint32_t roundUpPowerOfTwo(uint32_t v) {
+  uint32_t p = 1;
+  while (p < v) {
+    p <<= 1;
+  }
+  return p;
+}
+
+int64_t nowUs() {
+  return std::chrono::duration_cast<std::chrono::microseconds>(
+             std::chrono::system_clock::now().time_since_epoch())
+      .count();
+}
+
+} // namespace
+
+CollectiveJournal& CollectiveJournal::get() {
+  static CollectiveJournal journal;
+  return journal;
+}
+
+CollectiveJournal::CollectiveJournal() {
+#ifndef _WIN32
+  if (getCvarInt({"TORCH_C10D_COLLECTIVE_JOURNAL"}, 1) == 0) {
+    return;
+  }
+  std::string dir = getCvarString({"TORCH_C10D_COLLECTIVE_JOURNAL_DIR"}, "");
+  if (dir.empty()) {
+    const char* tmpdir = std::getenv("TMPDIR");
+    dir = tmpdir != nullptr ? tmpdir : "/tmp";
+  }
+  capacity_ = roundUpPowerOfTwo(static_cast<uint32_t>(
+      getCvarInt({"TORCH_C10D_COLLECTIVE_JOURNAL_CAPACITY"}, 16384)));
+  // One file per process: ranks sharing a host must not collide.
+  const std::string path =
+      dir + "/c10d_journal." + std::to_string(getpid());
+
+  const size_t mapSize = sizeof(CollectiveJournalHeader) +
+      static_cast<size_t>(capacity_) * sizeof(CollectiveJournalRecord);
+  int fd = open(path.c_str(), O_CREAT | O_RDWR, 0644);
+  if (fd < 0 || ftruncate(fd, static_cast<off_t>(mapSize)) != 0) {
+    // Best effort: a read-only filesystem or a missing directory must never
+    // take the job down, the journal just stays off.
+    LOG(WARNING) << "c10d collective journal: failed to create " << path
+                 << ", journal disabled";
+    if (fd >= 0) {
+      close(fd);
+    }
+    return;
+  }
+  void* map = mmap(nullptr, mapSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close(fd);
+  if (map == MAP_FAILED) {
+    LOG(WARNING) << "c10d collective journal: mmap of " << path
+                 << " failed, journal disabled";
+    return;
+  }
+  // The mapping is intentionally leaked: works may still complete during
+  // process teardown, and the file itself must outlive us so post-mortem
+  // tooling can read the tail after a crash.
+  auto* header = static_cast<CollectiveJournalHeader*>(map);
+  header->magic = kCollectiveJournalMagic;
+  header->version = kCollectiveJournalVersion;
+  header->recordSize = sizeof(CollectiveJournalRecord);
+  header->capacity = capacity_;
+  header->head.store(0, std::memory_order_relaxed);
+  records_ = reinterpret_cast<CollectiveJournalRecord*>(header + 1);
+  header_ = header;
+#endif
+}
+
+uint64_t CollectiveJournal::recordStart(
+    OpType opType,
+    int rank,
+    uint64_t bytes) {
+  if (!enabled()) {
+    return 0;
+  }
+  // Claim a slot first so concurrent writers (collectives can be issued from
+  // several threads) never share a record; publication order is claim order.
+  const uint64_t seq =
+      header_->head.fetch_add(1, std::memory_order_acq_rel) + 1;
+  CollectiveJournalRecord& rec = records_[(seq - 1) & (capacity_ - 1)];
+  rec.endUs = 0;
+  rec.startUs = nowUs();
+  rec.bytes = bytes;
+  rec.opType = static_cast<uint32_t>(opType);
+  rec.rank = rank;
+  // Written last: readers treat a record as valid once seq matches the slot.
+  rec.seq = seq;
+  return seq;
+}
+
+void CollectiveJournal::recordEnd(uint64_t seq) {
+  if (seq == 0 || !enabled()) {
+    return;
+  }
+  CollectiveJournalRecord& rec = records_[(seq - 1) & (capacity_ - 1)];
+  // The ring may have lapped this entry; in that case the slot now belongs
+  // to a newer collective and must not be touched.
+  if (rec.seq == seq) {
+    rec.endUs = nowUs();
+  }
+}
+
+} // namespace c10d
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+#include <c10/macros/Macros.h>
+#include <torch/csrc/distributed/c10d/Work.hpp>
+
+namespace c10d {
+
+// Always-on collective journal.
+//
+// Unlike the NCCL flight recorder in TraceUtils.h, which is debug-oriented,
+// opt-in and NCCL-only, the journal is a fixed-size file-backed mmap ring
+// fed from the common c10d::Work lifecycle, so every backend (gloo, mpi,
+// nccl, ucc, ...) is covered without debug env vars. The file survives a
+// process crash - the kernel writes the dirty pages back - which makes
+// post-mortem desync/hang analysis at scale a matter of parsing one small
+// file per rank instead of rerunning the job.
+//
+// The layout is part of the reader-facing ABI: a CollectiveJournalHeader
+// followed by `capacity` packed CollectiveJournalRecords; record i lives in
+// slot i % capacity. Bump kCollectiveJournalVersion when changing it.
+struct CollectiveJournalRecord {
+  uint64_t seq; // process-local sequence number, starts at 1
+  int64_t startUs; // enqueue wall-clock time, microseconds since epoch
+  int64_t endUs; // completion wall-clock time; 0 while in flight
+  uint64_t bytes; // total input bytes, 0 when unknown
+  uint32_t opType; // c10d::OpType
+  int32_t rank;
+};
+
+struct CollectiveJournalHeader {
+  uint32_t magic;
+  uint32_t version;
+  uint32_t recordSize;
+  uint32_t capacity; // number of records, always a power of two
+  // Monotonically increasing count of started collectives. Readers should
+  // snapshot `head` and stay at least one slot behind it to avoid reading a
+  // record mid-update.
+  std::atomic<uint64_t> head;
+};
+
+constexpr uint32_t kCollectiveJournalMagic = 0x434a524c; // "CJRL"
+constexpr uint32_t kCollectiveJournalVersion = 1;
+
+// Process-wide writer for the journal file. The file is created lazily at
+// `$TORCH_C10D_COLLECTIVE_JOURNAL_DIR` (default: $TMPDIR or /tmp) as
+// c10d_journal.<pid>; set TORCH_C10D_COLLECTIVE_JOURNAL=0 to disable.
+class TORCH_API CollectiveJournal {
+ public:
+  static CollectiveJournal& get();
+
+  CollectiveJournal(const CollectiveJournal&) = delete;
+  CollectiveJournal& operator=(const CollectiveJournal&) = delete;
+
+  bool enabled() const {
+    return header_ != nullptr;
+  }
+
+  // Journals the start of a collective and returns the sequence number used
+  // to mark its completion. Returns 0 when the journal is disabled.
+  uint64_t recordStart(OpType opType, int rank, uint64_t bytes);
+
+  // Stamps the completion time on the record claimed by recordStart. A no-op
+  // when seq is 0 or the slot has already been recycled by a later
+  // collective.
+  void recordEnd(uint64_t seq);
+
+ private:
+  CollectiveJournal();
+
+  CollectiveJournalHeader* header_{nullptr};
+  CollectiveJournalRecord* records_{nullptr};
+  uint32_t capacity_{0};
+};
+
+} // namespace c10d
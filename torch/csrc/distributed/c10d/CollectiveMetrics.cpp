@@ -0,0 +1,135 @@
+#include <torch/csrc/distributed/c10d/CollectiveMetrics.hpp>
+
+#include <chrono>
+#include <cstring>
+#include <string>
+
+#include <c10/util/Logging.h>
+#include <torch/csrc/distributed/c10d/Utils.hpp>
+#include <torch/csrc/monitor/counters.h>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace c10d {
+
+namespace {
+
+uint32_t roundUpPowerOfTwo(uint32_t v) {
+  uint32_t p = 1;
+  while (p < v) {
+    p <<= 1;
+  }
+  return p;
+}
+
+} // namespace
+
+CollectiveMetricsRing& CollectiveMetricsRing::get() {
+  static CollectiveMetricsRing ring;
+  return ring;
+}
+
+CollectiveMetricsRing::CollectiveMetricsRing() {
+#ifndef _WIN32
+  auto shmName = getCvarString({"TORCH_NCCL_METRICS_SHM"}, "");
+  if (shmName.empty()) {
+    return;
+  }
+  capacity_ = roundUpPowerOfTwo(static_cast<uint32_t>(
+      getCvarInt({"TORCH_NCCL_METRICS_CAPACITY"}, 16384)));
+  // One segment per process: ranks sharing a host must not collide.
+  shmName += "." + std::to_string(getpid());
+
+  const size_t mapSize = sizeof(CollectiveMetricsHeader) +
+      static_cast<size_t>(capacity_) * sizeof(CollectiveMetricRecord);
+  int fd = shm_open(shmName.c_str(), O_CREAT | O_RDWR, 0644);
+  if (fd < 0 || ftruncate(fd, static_cast<off_t>(mapSize)) != 0) {
+    LOG(WARNING) << "TORCH_NCCL_METRICS_SHM: failed to create shared memory "
+                 << "segment " << shmName << ", metrics ring disabled";
+    if (fd >= 0) {
+      close(fd);
+    }
+    return;
+  }
+  void* map = mmap(nullptr, mapSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close(fd);
+  if (map == MAP_FAILED) {
+    LOG(WARNING) << "TORCH_NCCL_METRICS_SHM: mmap of " << shmName
+                 << " failed, metrics ring disabled";
+    return;
+  }
+  // The mapping is intentionally leaked: the watchdog may still publish
+  // records during process teardown, and the segment itself outlives us so
+  // monitors can drain the tail.
+  auto* header = static_cast<CollectiveMetricsHeader*>(map);
+  header->magic = kCollectiveMetricsMagic;
+  header->version = kCollectiveMetricsVersion;
+  header->recordSize = sizeof(CollectiveMetricRecord);
+  header->capacity = capacity_;
+  header->head.store(0, std::memory_order_relaxed);
+  records_ = reinterpret_cast<CollectiveMetricRecord*>(header + 1);
+  header_ = header;
+#endif
+}
+
+void CollectiveMetricsRing::record(
+    uint64_t seq,
+    OpType opType,
+    int rank,
+    int64_t numelIn,
+    int64_t numelOut,
+    float durationMs) {
+  if (!enabled()) {
+    return;
+  }
+  // Claim a slot first so concurrent watchdogs (one per process group) never
+  // write the same record; publication order is the claim order.
+  const uint64_t idx =
+      header_->head.fetch_add(1, std::memory_order_acq_rel);
+  CollectiveMetricRecord& rec = records_[idx & (capacity_ - 1)];
+  rec.seq = seq;
+  rec.timestampUs = std::chrono::duration_cast<std::chrono::microseconds>(
+                        std::chrono::system_clock::now().time_since_epoch())
+                        .count();
+  rec.numelIn = numelIn;
+  rec.numelOut = numelOut;
+  rec.durationMs = durationMs;
+  rec.rank = rank;
+  rec.opType = static_cast<uint8_t>(opType);
+}
+
+void recordCollectiveMetric(
+    uint64_t seq,
+    OpType opType,
+    int rank,
+    int64_t numelIn,
+    int64_t numelOut,
+    float durationMs) {
+  using torch::monitor::Aggregation;
+  // Window matches the guidance in torch/csrc/monitor/counters.h: large
+  // enough that aggregate events stay cheap at collective rates.
+  static torch::monitor::Stat<double> durationStat(
+      "pg_nccl.collective_duration_ms",
+      {Aggregation::COUNT,
+       Aggregation::SUM,
+       Aggregation::MEAN,
+       Aggregation::MAX},
+      std::chrono::seconds(60));
+  static torch::monitor::Stat<int64_t> numelOutStat(
+      "pg_nccl.collective_numel_out",
+      {Aggregation::COUNT, Aggregation::SUM, Aggregation::MAX},
+      std::chrono::seconds(60));
+
+  if (durationMs >= 0) {
+    durationStat.add(durationMs);
+  }
+  numelOutStat.add(numelOut);
+  CollectiveMetricsRing::get().record(
+      seq, opType, rank, numelIn, numelOut, durationMs);
+}
+
+} // namespace c10d
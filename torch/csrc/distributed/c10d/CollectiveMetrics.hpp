@@ -0,0 +1,82 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+#include <c10/macros/Macros.h>
+#include <torch/csrc/distributed/c10d/Work.hpp>
+
+namespace c10d {
+
+// One fixed-size record per finished collective. Records are published to a
+// shared-memory ring so fleet monitors can consume them without attaching to
+// the Python process or forcing a GPU sync. The layout is part of the
+// reader-facing ABI: bump kCollectiveMetricsVersion when changing it.
+struct alignas(64) CollectiveMetricRecord {
+  uint64_t seq; // collective sequence number within the process group
+  int64_t timestampUs; // completion wall-clock time, microseconds since epoch
+  int64_t numelIn;
+  int64_t numelOut;
+  float durationMs; // GPU time; -1 when TORCH_NCCL_ENABLE_TIMING is off
+  int32_t rank; // global rank of the writing process
+  uint8_t opType; // c10d::OpType
+  uint8_t reserved[3];
+};
+
+struct CollectiveMetricsHeader {
+  uint32_t magic;
+  uint32_t version;
+  uint32_t recordSize;
+  uint32_t capacity; // number of records, always a power of two
+  // Monotonically increasing write index; record i lives in slot
+  // i % capacity. Readers should snapshot `head` and stay at least one slot
+  // behind it to avoid reading a record mid-update.
+  std::atomic<uint64_t> head;
+};
+
+constexpr uint32_t kCollectiveMetricsMagic = 0x43434d52; // "CCMR"
+constexpr uint32_t kCollectiveMetricsVersion = 1;
+
+// Process-wide writer for the shared-memory metrics ring. The ring is only
+// created when TORCH_NCCL_METRICS_SHM names the shared-memory segment (the
+// pid is appended so ranks on one host don't collide); the torch::monitor
+// aggregate stats are fed unconditionally since they are no-ops without a
+// registered event handler.
+class TORCH_API CollectiveMetricsRing {
+ public:
+  static CollectiveMetricsRing& get();
+
+  CollectiveMetricsRing(const CollectiveMetricsRing&) = delete;
+  CollectiveMetricsRing& operator=(const CollectiveMetricsRing&) = delete;
+
+  bool enabled() const {
+    return header_ != nullptr;
+  }
+
+  void record(
+      uint64_t seq,
+      OpType opType,
+      int rank,
+      int64_t numelIn,
+      int64_t numelOut,
+      float durationMs);
+
+ private:
+  CollectiveMetricsRing();
+
+  CollectiveMetricsHeader* header_{nullptr};
+  CollectiveMetricRecord* records_{nullptr};
+  uint32_t capacity_{0};
+};
+
+// Publishes one finished collective to the shared-memory ring (when enabled)
+// and to the torch::monitor duration/size stats.
+TORCH_API void recordCollectiveMetric(
+    uint64_t seq,
+    OpType opType,
+    int rank,
+    int64_t numelIn,
+    int64_t numelOut,
+    float durationMs);
+
+} // namespace c10d
@@ -6,6 +6,8 @@
 #include <torch/csrc/distributed/c10d/GroupRegistry.hpp>
 #include <torch/csrc/distributed/c10d/ProcessGroup.hpp>
 #include <torch/csrc/distributed/c10d/RankLocal.hpp>
+#include <torch/csrc/distributed/c10d/SymmetricMemory.hpp>
+#include <algorithm>
 #include <utility>
 
 namespace {
@@ -281,6 +283,129 @@ at::Tensor broadcast(
   return broadcast_(output, src, std::move(group_name));
 }
 
+// Hierarchical all-reduce for multi-node clusters with fast intra-node
+// interconnect (e.g. 8xGPU NVLink nodes):
+//
+//   1. intra-node reduce-scatter: every rank stages its input in symmetric
+//      memory and reduces one 1/intra_size shard by reading its peers'
+//      buffers directly (one-sided, over NVLink),
+//   2. inter-node all-reduce: each rank all-reduces its shard across nodes
+//      through `inter_group_name` (a group containing the ranks with the
+//      same intra-node rank on every node, i.e. one "rail" per local rank),
+//   3. intra-node all-gather: the globally reduced shards are published in
+//      symmetric memory and every rank gathers them back into its input.
+//
+// Only 1/intra_size of the data crosses the network per rank, compared to
+// the 2x(world_size-1)/world_size of a flat ring all-reduce over the full
+// group.
+//
+// `intra_group_name` must name a symmetric memory group (see
+// set_group_info) containing exactly the ranks of the local node. Like
+// shard_dim_alltoall, the op is synchronous with respect to the current
+// stream; all steps are stream-ordered, so no work registration is needed
+// and wait_tensor() is a no-op on the result.
+at::Tensor& hierarchical_all_reduce_(
+    at::Tensor& input,
+    // NOLINTNEXTLINE(performance-unnecessary-value-param)
+    std::string reduce_op,
+    // NOLINTNEXTLINE(performance-unnecessary-value-param)
+    std::string intra_group_name,
+    // NOLINTNEXTLINE(performance-unnecessary-value-param)
+    std::string inter_group_name) {
+  TORCH_CHECK(
+      reduce_op == "sum",
+      "hierarchical_all_reduce: only sum is currently supported");
+  TORCH_CHECK(
+      input.is_contiguous(),
+      "hierarchical_all_reduce: input must be contiguous");
+
+  const auto& group_info =
+      c10d::symmetric_memory::get_group_info(intra_group_name);
+  const int intra_size = group_info.world_size;
+  const int intra_rank = group_info.rank;
+  if (intra_size == 1) {
+    // Single-GPU nodes: the hierarchy degenerates to a flat all-reduce.
+    return all_reduce_(input, std::move(reduce_op), std::move(inter_group_name));
+  }
+
+  // Stage the input in symmetric memory so peers can read it one-sided.
+  const int64_t numel = input.numel();
+  auto symm_buf = c10d::symmetric_memory::empty_strided_p2p(
+      {numel},
+      {1},
+      input.scalar_type(),
+      input.device(),
+      intra_group_name,
+      std::nullopt);
+  auto input_flat = input.view({numel});
+  symm_buf.copy_(input_flat);
+  auto symm = c10d::symmetric_memory::rendezvous(symm_buf);
+
+  const int64_t shard_size = (numel + intra_size - 1) / intra_size;
+  auto shard_begin = [&](int rank) {
+    return std::min<int64_t>(rank * shard_size, numel);
+  };
+  auto shard_numel = [&](int rank) {
+    return std::min(shard_size, numel - shard_begin(rank));
+  };
+
+  // (1) All peers have staged their inputs; reduce our shard in place.
+  symm->barrier(0);
+  const int64_t begin = shard_begin(intra_rank);
+  const int64_t len = shard_numel(intra_rank);
+  auto local_shard = input_flat.narrow(0, begin, len);
+  for (int r = 0; r < intra_size; ++r) {
+    if (r == intra_rank) {
+      continue;
+    }
+    local_shard.add_(
+        symm->get_buffer(r, {numel}, input.scalar_type(), 0)
+            .narrow(0, begin, len));
+  }
+
+  // (2) One all-reduce per rail carries the shard across nodes.
+  if (len > 0) {
+    c10d::AllreduceOptions opts;
+    opts.reduceOp = to_reduce_op(reduce_op);
+    std::vector<at::Tensor> shards{local_shard};
+    auto inter_group = c10d::resolve_process_group(inter_group_name);
+    inter_group->allreduce(shards, opts)->wait();
+  }
+
+  // (3) Publish the reduced shard and gather the others back.
+  symm_buf.narrow(0, begin, len).copy_(local_shard);
+  symm->barrier(0);
+  for (int r = 0; r < intra_size; ++r) {
+    if (r == intra_rank) {
+      continue;
+    }
+    const int64_t r_len = shard_numel(r);
+    if (r_len == 0) {
+      continue;
+    }
+    input_flat.narrow(0, shard_begin(r), r_len)
+        .copy_(symm->get_buffer(r, {numel}, input.scalar_type(), 0)
+                   .narrow(0, shard_begin(r), r_len));
+  }
+  // Peers may still be reading our buffer; don't let it be reclaimed until
+  // everyone is done.
+  symm->barrier(0);
+  return input;
+}
+
+at::Tensor hierarchical_all_reduce(
+    const at::Tensor& input,
+    std::string reduce_op,
+    std::string intra_group_name,
+    std::string inter_group_name) {
+  auto output = input.clone(at::MemoryFormat::Contiguous);
+  return hierarchical_all_reduce_(
+      output,
+      std::move(reduce_op),
+      std::move(intra_group_name),
+      std::move(inter_group_name));
+}
+
 at::Tensor wait_tensor(const at::Tensor& tensor) {
   auto work = c10d::RankLocal<WorkRegistry>::get().pop_work(tensor);
   if (work != nullptr) {
@@ -371,6 +496,20 @@ TORCH_LIBRARY(_c10d_functional, m) {
           c10::DispatchKey::CompositeExplicitAutograd, ::broadcast_),
       {at::Tag::pt2_compliant_tag});
 
+  m.def(
+      "hierarchical_all_reduce(Tensor input, str reduce_op, str intra_group_name, str inter_group_name) -> Tensor",
+      torch::dispatch(
+          c10::DispatchKey::CompositeExplicitAutograd,
+          ::hierarchical_all_reduce),
+      {at::Tag::pt2_compliant_tag});
+
+  m.def(
+      "hierarchical_all_reduce_(Tensor(a!) input, str reduce_op, str intra_group_name, str inter_group_name) -> Tensor(a!)",
+      torch::dispatch(
+          c10::DispatchKey::CompositeExplicitAutograd,
+          ::hierarchical_all_reduce_),
+      {at::Tag::pt2_compliant_tag});
+
   m.def(
       "wait_tensor(Tensor tensor) -> Tensor",
       torch::dispatch(
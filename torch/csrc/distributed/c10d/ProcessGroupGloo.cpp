@@ -5,8 +5,10 @@
 
 #include <torch/csrc/distributed/c10d/GlooDeviceFactory.hpp>
 #include <torch/csrc/distributed/c10d/PrefixStore.hpp>
+#include <torch/csrc/distributed/c10d/Utils.hpp>
 #include <chrono>
 #include <exception>
+#include <thread>
 
 #ifdef _WIN32
 #include <gloo/common/win.h>
@@ -1063,6 +1065,77 @@ class AsyncAllreduceWork : public ProcessGroupGloo::AsyncWork {
   }
 };
 
+// Minimum tensor size before allreduce is striped across contexts. Below
+// this the per-stripe fixed costs (extra threads, one gloo round trip per
+// context) outweigh the bandwidth win.
+constexpr int64_t kStripeThresholdBytes = 1024 * 1024;
+
+class AsyncAllreduceStripedWork : public AsyncAllreduceWork {
+ public:
+  AsyncAllreduceStripedWork(
+      std::vector<std::shared_ptr<gloo::Context>> contexts,
+      std::vector<at::Tensor>& inputs,
+      ReduceOp reduceOp,
+      uint32_t tag,
+      uint64_t seq)
+      : AsyncAllreduceWork(contexts[0], inputs, std::move(reduceOp), tag, seq),
+        contexts_(std::move(contexts)) {}
+
+  // Stripes a single large dense tensor across all configured gloo
+  // contexts. With one context per device (see createProcessGroupGloo and
+  // GlooDeviceFactory), each stripe's ring runs over its own NIC, so the
+  // stripes progress concurrently and the aggregate bandwidth of a
+  // multi-NIC host is usable by one collective. Every rank derives the
+  // same stripe boundaries from the tensor size and context count, so no
+  // extra coordination is needed. Tags may repeat across contexts; each
+  // context has its own connections.
+  void run() override {
+    auto flat = inputs[0].view({-1});
+    const auto numel = flat.numel();
+    const auto numStripes = static_cast<int64_t>(contexts_.size());
+    const auto stripeSize = (numel + numStripes - 1) / numStripes;
+
+    std::vector<std::exception_ptr> eptrs(numStripes);
+    auto runStripe = [&](int64_t stripe) {
+      const auto offset = stripe * stripeSize;
+      const auto length = std::min(stripeSize, numel - offset);
+      if (length <= 0) {
+        return;
+      }
+      try {
+        std::vector<at::Tensor> stripeTensors = {
+            flat.narrow(0, offset, length)};
+        const auto& scalarType = stripeTensors[0].scalar_type();
+        gloo::AllreduceOptions opts(contexts_[stripe]);
+        opts.setReduceFunction(getFunction(scalarType, reduceOp));
+        opts.setTag(tag);
+        GENERATE_ALL_TYPES(scalarType, setOutputs, opts, stripeTensors);
+        gloo::allreduce(opts);
+      } catch (...) {
+        eptrs[stripe] = std::current_exception();
+      }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(numStripes - 1);
+    for (const auto stripe : c10::irange(int64_t(1), numStripes)) {
+      threads.emplace_back(runStripe, stripe);
+    }
+    runStripe(0);
+    for (auto& thread : threads) {
+      thread.join();
+    }
+    for (auto& eptr : eptrs) {
+      if (eptr) {
+        std::rethrow_exception(eptr);
+      }
+    }
+  }
+
+ private:
+  const std::vector<std::shared_ptr<gloo::Context>> contexts_;
+};
+
 class AsyncAllreduceCoalescedWork : public AsyncAllreduceWork {
  public:
   AsyncAllreduceCoalescedWork(
@@ -1102,7 +1175,8 @@ class AsyncSparseAllreduceWork : public ProcessGroupGloo::AsyncWork {
       const std::shared_ptr<gloo::Context>& context,
       std::vector<at::Tensor>& inputs,
       uint32_t tag,
-      uint64_t seq)
+      uint64_t seq,
+      bool useIndexUnion = false)
       : ProcessGroupGloo::AsyncWork(
             {inputs},
             OpType::_ALLREDUCE_SPARSE,
@@ -1111,11 +1185,15 @@ class AsyncSparseAllreduceWork : public ProcessGroupGloo::AsyncWork {
             inputs),
         context(context),
         inputs(inputs),
-        tag(tag) {}
+        tag(tag),
+        useIndexUnion(useIndexUnion) {}
 
   std::shared_ptr<gloo::Context> context;
   std::vector<at::Tensor> inputs{};
   const uint32_t tag;
+  // Reduce values over the union of the index sets instead of gathering
+  // the values of every rank; see allreduce_with_index_union.
+  const bool useIndexUnion;
 
   // We share dimensionality about the sparse tensors before collecting
   // their contents. We assume here that the maximum number of sparse
@@ -1227,6 +1305,10 @@ class AsyncSparseAllreduceWork : public ProcessGroupGloo::AsyncWork {
       }
     }
 
+    if (useIndexUnion) {
+      return allreduce_with_index_union(input, metadata);
+    }
+
     // Gather all indices and all values.
     auto indices = allgather_indices(input, metadata);
     auto values = allgather_values(input, metadata);
@@ -1371,6 +1453,84 @@ class AsyncSparseAllreduceWork : public ProcessGroupGloo::AsyncWork {
 
     return values;
   }
+
+  // Two-phase sparse allreduce: gather the index sets of all ranks, compute
+  // their union once, then sum values with a dense allreduce over the union
+  // layout. Peak memory is bounded by the union nnz instead of the sum of
+  // nnz over all ranks, which matters for embedding gradients whose value
+  // rows dwarf their indices.
+  at::Tensor allreduce_with_index_union(
+      const at::Tensor& input,
+      const std::vector<SparseTensorMetadata>& metadata) {
+    const auto sparseDim = input.sparse_dim();
+
+    // Phase 1: gather indices only and flatten them to linear ids over the
+    // sparse dimensions. The union is their sorted unique set; the inverse
+    // mapping gives every gathered index its position in the union, of
+    // which we only need the positions of this rank's entries.
+    auto indices = allgather_indices(input, metadata);
+    std::vector<at::Tensor> flatIndices;
+    flatIndices.reserve(indices.size());
+    for (const auto& idx : indices) {
+      flatIndices.push_back(
+          at::sparse::flatten_indices(idx, input.sizes().slice(0, sparseDim)));
+    }
+    auto [unionFlat, inverse] = at::_unique(
+        at::cat(flatIndices), /*sorted=*/true, /*return_inverse=*/true);
+    const auto unionNnz = unionFlat.size(0);
+    int64_t offset = 0;
+    for (const auto i : c10::irange(static_cast<size_t>(context->rank))) {
+      offset += metadata[i].nnz();
+    }
+    auto positions = inverse.narrow(0, offset, input._nnz());
+
+    // Phase 2: scatter this rank's values into the union layout and sum
+    // across ranks. Every rank derives the same union, so the buffers line
+    // up element for element.
+    const auto valueShape = input.sizes().slice(sparseDim);
+    std::vector<int64_t> unionShape = {unionNnz};
+    std::copy(
+        valueShape.begin(), valueShape.end(), std::back_inserter(unionShape));
+    auto unionValues = at::zeros(unionShape, input.values().options());
+    unionValues.index_add_(0, positions, input.values());
+    if (unionValues.numel() > 0) {
+      const auto& scalarType = unionValues.scalar_type();
+      std::vector<at::Tensor> unionTensors = {unionValues};
+      gloo::AllreduceOptions opts(context);
+      opts.setReduceFunction(getFunction(scalarType, ReduceOp::SUM));
+      opts.setTag(tag);
+      GENERATE_ALL_TYPES(scalarType, setOutputs, opts, unionTensors);
+      gloo::allreduce(opts);
+    }
+
+    // Expand the linear ids back into sparse indices. The union is sorted
+    // and unique, so the result is coalesced by construction.
+    auto unionIndices = at::empty({sparseDim, unionNnz}, unionFlat.options());
+    auto flat = unionFlat;
+    for (auto d = sparseDim - 1; d >= 0; d--) {
+      unionIndices[d].copy_(flat % input.size(d));
+      if (d > 0) {
+        flat = flat.div(input.size(d), /*rounding_mode=*/"floor");
+      }
+    }
+    auto output = at::sparse_coo_tensor(
+        unionIndices, unionValues, input.sizes(), input.options());
+    output._coalesced_(true);
+    return output;
+  }
+
+  template <typename T>
+  void getFunction(gloo::AllreduceOptions::Func& fn, const ReduceOp op) {
+    fn = toFunction<T>(op);
+  }
+
+  gloo::AllreduceOptions::Func getFunction(
+      const at::ScalarType& dtype,
+      const ReduceOp& op) {
+    gloo::AllreduceOptions::Func fn;
+    GENERATE_ALL_TYPES(dtype, getFunction, fn, op);
+    return fn;
+  }
 };
 
 class AsyncAllreduceCUDAWork : public AsyncAllreduceWork {
@@ -1430,8 +1590,9 @@ class AsyncSparseAllreduceCUDAWork : public AsyncSparseAllreduceWork {
       const std::shared_ptr<gloo::Context>& context,
       std::vector<at::Tensor>& inputs,
       uint32_t tag,
-      uint64_t seq)
-      : AsyncSparseAllreduceWork(context, inputs, tag, seq) {
+      uint64_t seq,
+      bool useIndexUnion = false)
+      : AsyncSparseAllreduceWork(context, inputs, tag, seq, useIndexUnion) {
     initializeStreamsEvents(inputs, streams, events);
 
     // Kick off copy from CUDA tensors to CPU tensors.
@@ -1514,13 +1675,30 @@ c10::intrusive_ptr<Work> ProcessGroupGloo::allreduce(
   auto tag = nextTag();
   auto context = getContext(tag);
   ++seq_;
-  if (device.type() == at::kCPU) {
+  // A single large contiguous tensor can be striped across all configured
+  // contexts; with one device per NIC (GLOO_SOCKET_IFNAME=eth0,eth1,...)
+  // the stripes run concurrently over separate NICs. The decision below
+  // only depends on state that is identical on all ranks.
+  const bool stripeAcrossContexts = contexts_.size() > 1 &&
+      device.type() == at::kCPU && layout == c10::kStrided &&
+      inputs.size() == 1 && inputs[0].is_contiguous() &&
+      inputs[0].numel() * inputs[0].element_size() >= kStripeThresholdBytes;
+  // Both phases of the index-union algorithm are collectives, so every rank
+  // must take the same branch; an environment knob set identically across
+  // ranks decides, not per-call state.
+  const bool sparseIndexUnion = layout == c10::kSparse &&
+      getCvarBool({"TORCH_GLOO_SPARSE_ALLREDUCE_UNION"}, false);
+
+  if (stripeAcrossContexts) {
+    work = c10::make_intrusive<AsyncAllreduceStripedWork>(
+        contexts_, inputs, opts.reduceOp, tag, seq_);
+  } else if (device.type() == at::kCPU) {
     if (layout == c10::kStrided) {
       work = c10::make_intrusive<AsyncAllreduceWork>(
           std::move(context), inputs, opts.reduceOp, tag, seq_);
     } else if (layout == c10::kSparse) {
       work = c10::make_intrusive<AsyncSparseAllreduceWork>(
-          std::move(context), inputs, tag, seq_);
+          std::move(context), inputs, tag, seq_, sparseIndexUnion);
     } else {
       invalidArgument("unsupported layout");
     }
@@ -1530,7 +1708,7 @@ c10::intrusive_ptr<Work> ProcessGroupGloo::allreduce(
           std::move(context), inputs, opts.reduceOp, tag, seq_);
     } else if (layout == c10::kSparse) {
       work = c10::make_intrusive<AsyncSparseAllreduceCUDAWork>(
-          std::move(context), inputs, tag, seq_);
+          std::move(context), inputs, tag, seq_, sparseIndexUnion);
     } else {
       invalidArgument("unsupported layout");
     }
@@ -23,6 +23,7 @@
 #include <c10/util/irange.h>
 #include <c10/util/thread_name.h>
 #include <torch/csrc/cuda/nccl.h>
+#include <torch/csrc/distributed/c10d/CollectiveMetrics.hpp>
 #include <torch/csrc/distributed/c10d/NCCLUtils.hpp>
 #include <torch/csrc/distributed/c10d/ParamCommsUtils.hpp>
 #include <torch/csrc/distributed/c10d/PrefixStore.hpp>
@@ -504,6 +505,11 @@ ProcessGroupNCCL::WorkNCCL::WorkNCCL(const WorkNCCL& w)
 ProcessGroupNCCL::WorkNCCL::~WorkNCCL() = default;
 
 bool ProcessGroupNCCL::WorkNCCL::isCompleted() {
+  // A work inside an open auto-coalescing batch has not been handed to NCCL
+  // yet; close the batch first so querying the events below is meaningful.
+  if (autoCoalescePg_ != nullptr) {
+    autoCoalescePg_->flushAutoCoalescedWorks();
+  }
   if (!ncclComm_->isAborted()) {
     checkAndSetException();
   }
@@ -511,6 +517,9 @@ bool ProcessGroupNCCL::WorkNCCL::isCompleted() {
 }
 
 bool ProcessGroupNCCL::WorkNCCL::isStarted() {
+  if (autoCoalescePg_ != nullptr) {
+    autoCoalescePg_->flushAutoCoalescedWorks();
+  }
   if (!ncclComm_->isAborted()) {
     checkAndSetException();
   }
@@ -645,6 +654,12 @@ void ProcessGroupNCCL::WorkNCCL::synchronizeStream() {
 // Waiting on the work's corresponding CUDA events
 void ProcessGroupNCCL::WorkNCCL::synchronizeInternal(
     std::chrono::milliseconds timeout) {
+  // If this work is still part of an open auto-coalescing batch, its NCCL
+  // group has not been closed and ncclEndEvent_ has not been recorded; flush
+  // the batch so blocking on the event below synchronizes correctly.
+  if (autoCoalescePg_ != nullptr) {
+    autoCoalescePg_->flushAutoCoalescedWorks();
+  }
   synchronizeStream();
 
   // In case of blocking, wait for the operation to complete.
@@ -803,6 +818,13 @@ ProcessGroupNCCL::ProcessGroupNCCL(
       getCvarBool(TORCH_NCCL_ENABLE_TIMING, false) || desyncDebug_);
 #endif
   avoidRecordStreams_ = getCvarBool(TORCH_NCCL_AVOID_RECORD_STREAMS, false);
+  segmentedAllToAll_ = getCvarBool(TORCH_NCCL_ALLTOALL_SEGMENTED, false);
+  int autoCoalesceMaxOps = getCvarInt(TORCH_NCCL_AUTO_COALESCE_MAX_OPS, 0);
+  autoCoalesceMaxOps_ =
+      autoCoalesceMaxOps > 0 ? static_cast<size_t>(autoCoalesceMaxOps) : 0;
+  int autoCoalesceWindowUs = getCvarInt(TORCH_NCCL_AUTO_COALESCE_WINDOW_US, 200);
+  autoCoalesceWindow_ = std::chrono::microseconds(
+      autoCoalesceWindowUs > 0 ? autoCoalesceWindowUs : 0);
 #ifdef NCCL_HAS_COMM_REGISTER
   useTensorRegisterAllocatorHook_ =
       getCvarBool(TORCH_NCCL_USE_TENSOR_REGISTER_ALLOCATOR_HOOK, false);
@@ -1135,6 +1157,10 @@ bool ProcessGroupNCCL::abort(std::optional<std::string> abortReason) {
 }
 
 void ProcessGroupNCCL::shutdown(std::optional<std::string> reason) {
+  // Close any implicit NCCL group still open from auto-coalescing so the
+  // batched collectives are issued before communicators are aborted.
+  flushAutoCoalescedWorks();
+
   // Don't join threads here since the purpose of this method is to abort all
   // communicators and signal the threads to exit. Joining on the threads could
   // potentially block and hence avoid it in this method.
@@ -1766,6 +1792,22 @@ void ProcessGroupNCCL::watchdogHandler() {
         pgStatus_.lastCompletedWorkName = opTypeToString(work.opType_);
         pgStatus_.lastCompletedNumelIn = work.numelIn_;
         pgStatus_.lastCompletedNumelOut = work.numelOut_;
+        // Publish to the shared-memory metrics ring and monitor aggregates;
+        // the events have completed so elapsed_time does not sync the GPU.
+        float durationMs = -1.0f;
+        if (work.timingEnabled_ && work.ncclStartEvent_ && work.ncclEndEvent_) {
+          durationMs = work.getDuration();
+        }
+        recordCollectiveMetric(
+            work.seq_,
+            work.opType_,
+            rank_,
+            work.numelIn_,
+            work.numelOut_,
+            durationMs);
+        // WorkNCCL never goes through Work::finish(), so stamp the
+        // collective journal here.
+        work.markJournalCompleted();
         NCCLTraceBuffer::get()->retire_id(work.trace_id_, true);
         if (onCompletionHook_) {
           // Move Work object to completedWorkList_ to be consumed by the hook
@@ -2314,6 +2356,33 @@ bool check_same_size(const std::vector<at::Tensor>& input_tensors) {
   return true;
 }
 
+// Checks whether the (same-sized) tensors tile a single contiguous buffer
+// back-to-back in rank order, e.g. equal views into a persistent FSDP-style
+// flat parameter. If they do, an allgather can write directly into the
+// destination buffer, skipping both the staging tensor and the
+// post-collective copy. All tensors must alias one storage so that stashing
+// any of them keeps the whole destination alive.
+bool check_flat_dense_layout(const std::vector<at::Tensor>& tensors) {
+  const auto& first = tensors[0];
+  if (!first.is_contiguous()) {
+    return false;
+  }
+  const char* base = static_cast<const char*>(first.const_data_ptr());
+  const int64_t nbytes = first.numel() * first.element_size();
+  for (const auto i : c10::irange(tensors.size())) {
+    const auto& t = tensors[i];
+    if (!t.is_contiguous() || t.scalar_type() != first.scalar_type() ||
+        !t.is_alias_of(first)) {
+      return false;
+    }
+    if (static_cast<const char*>(t.const_data_ptr()) !=
+        base + static_cast<int64_t>(i) * nbytes) {
+      return false;
+    }
+  }
+  return true;
+}
+
 } // namespace
 
 c10::intrusive_ptr<ProcessGroupNCCL::WorkNCCL> ProcessGroupNCCL::initWork(
@@ -2417,6 +2486,9 @@ ProcessGroupNCCL::Options::Options(bool is_high_priority_stream)
 static constexpr int CoalActive = 0x01, CoalColl = 0x02, CoalP2P = 0x04;
 
 void ProcessGroupNCCL::startCoalescing() {
+  // An explicit coalescing group cannot nest inside an implicit one
+  flushAutoCoalescedWorks();
+
   // Other collective ops bump seq_ before creating a work. Thus, if coalesced
   // ops bump seq_ only after initing a work they will collide with (reuse) the
   // seq_ of the last non-coalesced collective.  Previously, seq_ was bumped
@@ -2515,6 +2587,37 @@ c10::intrusive_ptr<Work> ProcessGroupNCCL::endCoalescing() {
   return endCoalescing(OpType::COALESCED);
 }
 
+// Closes the implicit NCCL group opened by auto-coalescing (see
+// TORCH_NCCL_AUTO_COALESCE_MAX_OPS). The batched collectives are only handed
+// to NCCL by the groupEnd below, so afterwards we perform the per-work steps
+// that collective() deferred while the batch was open: record the end events,
+// complete the futures and enqueue the works with the watchdog.
+void ProcessGroupNCCL::flushAutoCoalescedWorks() {
+  if (!autoCoalesceOpen_) {
+    return;
+  }
+  auto ncclStream = ncclStreams_.at(autoCoalesceKey_);
+  groupEnd();
+  for (auto& work : autoCoalescedWorks_) {
+    // All batched kernels were enqueued on ncclStream by the groupEnd above,
+    // so recording each work's end event here marks (conservatively, for the
+    // earlier ops of the batch) the completion of its collective.
+    work->ncclEndEvent_->record(ncclStream);
+    {
+      c10::cuda::CUDAMultiStreamGuard streamGuard(ncclStream);
+      work->future_->markCompleted(at::IValue(*work->outputs_));
+    }
+    work->autoCoalescePg_ = nullptr;
+    // Notify graphs before we check the capture status preemptively
+    at::cuda::CUDAGraph::inc_pending_event_queries();
+    workEnqueue(work);
+  }
+  autoCoalescedWorks_.clear();
+  autoCoalescedComm_ = nullptr;
+  autoCoalesceKey_.clear();
+  autoCoalesceOpen_ = false;
+}
+
 template <typename Fn, typename PreProcess, typename PostProcess>
 c10::intrusive_ptr<Work> ProcessGroupNCCL::collective(
     at::Tensor& input,
@@ -2540,8 +2643,42 @@ c10::intrusive_ptr<Work> ProcessGroupNCCL::collective(
 
   auto device = getDevice(input);
   const auto key = getKeyFromDevice(device);
+
+  // Transparent micro-batching of collectives (see
+  // TORCH_NCCL_AUTO_COALESCE_MAX_OPS in ProcessGroupNCCL.hpp). An eligible op
+  // joins the currently open implicit NCCL group; an op that cannot join it
+  // (different communicator, batch full, window expired, or ineligible)
+  // flushes the batch first. Nonblocking communicators are excluded because
+  // closing their group requires polling the batched communicator.
+  bool autoCoalesce = autoCoalesceMaxOps_ > 0 && !coalescing_state_ &&
+      !nccl_use_nonblocking() &&
+      capture_status == c10::cuda::CaptureStatus::None;
+  if (autoCoalesceOpen_ &&
+      (!autoCoalesce || key != autoCoalesceKey_ ||
+       autoCoalescedWorks_.size() >= autoCoalesceMaxOps_ ||
+       std::chrono::steady_clock::now() - autoCoalesceStartTime_ >=
+           autoCoalesceWindow_)) {
+    // Flushing before getNCCLComm also keeps communicator initialization for
+    // a new device out of the open group.
+    flushAutoCoalescedWorks();
+  }
+
   auto ncclComm = getNCCLComm(key, device, opType);
 
+  if (autoCoalesce && !autoCoalesceOpen_) {
+    autoCoalesceOpen_ = true;
+    autoCoalesceKey_ = key;
+    autoCoalescedComm_ = ncclComm;
+    autoCoalesceStartTime_ = std::chrono::steady_clock::now();
+    groupStart();
+  }
+
+  // While a batch is open the NCCL kernels are not enqueued until the
+  // deferred groupEnd, so recordStream calls made now would not protect the
+  // inputs; keep references alive instead, as TORCH_NCCL_AVOID_RECORD_STREAMS
+  // does. The outputs are kept alive by work->outputs_ until the flush.
+  avoidRecordStreams |= autoCoalesce;
+
   if (coalescing_state_ & CoalActive) {
     coalescing_state_ |= CoalColl;
     if (coalescedDevice_.index() < 0) {
@@ -2566,8 +2703,8 @@ c10::intrusive_ptr<Work> ProcessGroupNCCL::collective(
   std::vector<at::Tensor> inputs{input};
   std::vector<at::Tensor> outputs{output};
 
-  bool enqueue =
-      !coalescing_state_ && capture_status == c10::cuda::CaptureStatus::None;
+  bool enqueue = !coalescing_state_ && !autoCoalesce &&
+      capture_status == c10::cuda::CaptureStatus::None;
   auto work =
       initWork(device, rank_, opType, profilingTitle, inputs, outputs, enqueue);
 
@@ -2627,7 +2764,7 @@ c10::intrusive_ptr<Work> ProcessGroupNCCL::collective(
   post(ncclStream, work);
 
   // End event should only be recorded after the ncclGroupEnd()
-  if (!coalescing_state_) {
+  if (!coalescing_state_ && !autoCoalesce) {
     work->ncclEndEvent_->record(ncclStream);
   }
   work->ncclComm_ = ncclComm;
@@ -2651,7 +2788,11 @@ c10::intrusive_ptr<Work> ProcessGroupNCCL::collective(
           // the "Future" argument.
           /*uses_future=*/false);
     }
-    work->future_->markCompleted(at::IValue(*work->outputs_));
+    // For an auto-coalesced op the collective is only handed to NCCL when the
+    // batch is flushed; the future is completed there, after the groupEnd.
+    if (!autoCoalesce) {
+      work->future_->markCompleted(at::IValue(*work->outputs_));
+    }
   }
 
   // Set appropriate work parameters.
@@ -2664,6 +2805,15 @@ c10::intrusive_ptr<Work> ProcessGroupNCCL::collective(
   work->numelIn_ = input.numel();
   work->numelOut_ = output.numel();
 
+  if (autoCoalesce) {
+    // End event recording, future completion and watchdog enqueue are
+    // deferred to flushAutoCoalescedWorks(); keeping the work in
+    // autoCoalescedWorks_ also keeps its outputs alive until the groupEnd.
+    work->autoCoalescePg_ = this;
+    autoCoalescedWorks_.push_back(work);
+    return work;
+  }
+
   // Notify graphs before we check the capture status preemptively
   at::cuda::CUDAGraph::inc_pending_event_queries();
   if (enqueue) {
@@ -2683,6 +2833,10 @@ c10::intrusive_ptr<Work> ProcessGroupNCCL::collectiveCoalesced(
     OpType opType,
     const char* profilingTitle,
     bool avoidRecordStreams) {
+  // This path opens its own NCCL group; close any implicit group left open by
+  // auto-coalescing first.
+  flushAutoCoalescedWorks();
+
   // Environment setting by the user may add onto collective call's option
   avoidRecordStreams |= avoidRecordStreams_;
   c10::cuda::CaptureStatus capture_status =
@@ -2887,6 +3041,9 @@ c10::intrusive_ptr<Work> ProcessGroupNCCL::pointToPoint(
   if (enableNanCheck_) {
     checkForNan(tensor);
   }
+  // P2P ops never join a collective auto-coalescing batch
+  flushAutoCoalescedWorks();
+
   // avoidRecordStreams_ note:
   // send, recv, and irecv should be ok with avoidRecordStreams,
   // However, for isend, I don't think the API requires the user
@@ -3557,8 +3714,23 @@ c10::intrusive_ptr<Work> ProcessGroupNCCL::allgather(
 
   bool same_size = check_same_size(outputTensors_);
   if (same_size) {
-    // Flatten a vector of tensors into a single, stacked tensor.
-    at::Tensor outputFlattened = newLikeFlat(outputTensors_);
+    // If the output tensors already tile one contiguous buffer in rank order
+    // (e.g. views into a persistent FSDP flat parameter), gather directly
+    // into that buffer instead of staging through a scratch tensor and
+    // copying out afterwards. Besides saving the copy, this lets NCCL's
+    // user-buffer registration (see useTensorRegisterAllocatorHook_) apply
+    // to the actual destination.
+    const bool flatDenseOutput = check_flat_dense_layout(outputTensors_);
+    at::Tensor outputFlattened;
+    if (flatDenseOutput) {
+      outputFlattened = outputTensors_[0].as_strided(
+          {static_cast<int64_t>(outputTensors_.size()),
+           outputTensors_[0].numel()},
+          {outputTensors_[0].numel(), 1});
+    } else {
+      // Flatten a vector of tensors into a single, stacked tensor.
+      outputFlattened = newLikeFlat(outputTensors_);
+    }
 
     return collective(
         inputTensor,
@@ -3594,6 +3766,12 @@ c10::intrusive_ptr<Work> ProcessGroupNCCL::allgather(
         },
         [&](at::cuda::CUDAStream& ncclStream,
             c10::intrusive_ptr<ProcessGroupNCCL::WorkNCCL>& work) {
+          if (flatDenseOutput) {
+            // The collective already wrote into the user-facing output
+            // tensors; outputFlattened aliases their storage, which was
+            // recorded on the nccl stream above.
+            return;
+          }
           // Copy the flattened output tensors to the outputs.
           at::cuda::CUDAStreamGuard guard(ncclStream);
           for (const auto j : c10::irange(outputTensors_.size())) {
@@ -4085,7 +4263,14 @@ c10::intrusive_ptr<Work> ProcessGroupNCCL::alltoall(
           at::Tensor& /* unused */,
           ncclComm_t comm,
           at::cuda::CUDAStream& stream) {
-        torch::cuda::nccl::all2all(outputTensors, inputTensors, comm, stream);
+        if (segmentedAllToAll_) {
+          // Sends slice-by-slice, so strided block layouts (e.g. transposed
+          // views from MoE token dispatch) work without a contiguous copy.
+          torch::cuda::nccl::all2all_segmented(
+              outputTensors, inputTensors, comm, stream);
+        } else {
+          torch::cuda::nccl::all2all(outputTensors, inputTensors, comm, stream);
+        }
         return ncclSuccess;
       },
       [&](at::cuda::CUDAStream&,
@@ -146,6 +146,33 @@ enum ErrorHandlingMode {
 static std::vector<std::string> TORCH_NCCL_AVOID_RECORD_STREAMS = {
     "TORCH_NCCL_AVOID_RECORD_STREAMS"};
 
+// If set, alltoall sends every per-rank tensor slice-by-slice along dim 0,
+// accepting tensors whose slices are contiguous but whose outer stride is
+// arbitrary (e.g. transposed block layouts from MoE token dispatch). This
+// removes the permute+contiguous copies otherwise needed on both sides of
+// the collective. All ranks must set this consistently and pass matching
+// leading dimensions, since every slice becomes its own NCCL message.
+static std::vector<std::string> TORCH_NCCL_ALLTOALL_SEGMENTED = {
+    "TORCH_NCCL_ALLTOALL_SEGMENTED"};
+
+// If set to a value > 0, ProcessGroupNCCL transparently batches eligible
+// collectives issued back-to-back on the same communicator into a single
+// ncclGroupStart/ncclGroupEnd region, cutting per-collective launch overhead
+// for many-small-tensor patterns without requiring the caller to bracket the
+// calls with start/end_coalescing. An open batch is flushed when it reaches
+// this many operations, when TORCH_NCCL_AUTO_COALESCE_WINDOW_US has elapsed
+// by the time the next collective is issued, when an incompatible operation
+// (different communicator, P2P, explicit coalescing, graph capture) arrives,
+// or when one of the batched works is queried or waited on.
+static std::vector<std::string> TORCH_NCCL_AUTO_COALESCE_MAX_OPS = {
+    "TORCH_NCCL_AUTO_COALESCE_MAX_OPS"};
+
+// Maximum age, in microseconds, of an open auto-coalescing batch before the
+// next collective triggers a flush instead of joining it. Only consulted when
+// auto-coalescing is enabled via TORCH_NCCL_AUTO_COALESCE_MAX_OPS.
+static std::vector<std::string> TORCH_NCCL_AUTO_COALESCE_WINDOW_US = {
+    "TORCH_NCCL_AUTO_COALESCE_WINDOW_US"};
+
 // If set, ProcessGroupNCCL registers postAlloc and preFree hooks to cuda cache
 // allocator so that whenever a tensor is allocated or freed, ProcessGroupNCCL
 // can register/deregister the tensor on all available NCCL communicators.
@@ -402,6 +429,13 @@ class TORCH_API ProcessGroupNCCL : public Backend {
     // The future returned by getFuture.
     c10::intrusive_ptr<at::ivalue::Future> future_;
 
+    // Set while this work belongs to a not-yet-flushed auto-coalescing batch
+    // (see TORCH_NCCL_AUTO_COALESCE_MAX_OPS); used to close the surrounding
+    // NCCL group before the work is queried or synchronized, and cleared when
+    // the batch is flushed. The watchdog's copies are only made at flush time
+    // and therefore never carry this pointer.
+    ProcessGroupNCCL* autoCoalescePg_{nullptr};
+
     bool timingEnabled_;
     // unique id used to tell the trace buffer that this
     // work has completed
@@ -1020,6 +1054,38 @@ class TORCH_API ProcessGroupNCCL : public Backend {
   // Stores communicators for all collectives run inside a coalescing block
   std::shared_ptr<NCCLComm> coalescedComm_ = nullptr;
 
+  // Maximum number of collectives batched into one implicit NCCL group by
+  // auto-coalescing; 0 disables the feature. See
+  // TORCH_NCCL_AUTO_COALESCE_MAX_OPS above.
+  size_t autoCoalesceMaxOps_{0};
+
+  // Maximum age of an open auto-coalescing batch. There is no timer thread;
+  // the window is checked when the next collective is issued, and a batch
+  // that outlives it because the application went quiet is closed by the
+  // wait() (or isCompleted()) of any of its works.
+  std::chrono::microseconds autoCoalesceWindow_{0};
+
+  // Whether an implicit ncclGroupStart opened by auto-coalescing is active
+  bool autoCoalesceOpen_ = false;
+
+  // Stream key of the current auto-coalescing batch
+  std::string autoCoalesceKey_;
+
+  // Communicator shared by all collectives in the current batch
+  std::shared_ptr<NCCLComm> autoCoalescedComm_ = nullptr;
+
+  // Time the current auto-coalescing batch was opened
+  std::chrono::steady_clock::time_point autoCoalesceStartTime_;
+
+  // Works issued inside the current batch. Their end events, future
+  // completion and watchdog enqueue are deferred until the batch is flushed.
+  std::vector<c10::intrusive_ptr<WorkNCCL>> autoCoalescedWorks_;
+
+  // Close the currently open auto-coalescing batch, if any: issue
+  // ncclGroupEnd, record the deferred end events, complete the futures and
+  // hand the batched works to the watchdog.
+  void flushAutoCoalescedWorks();
+
   // map from the key: "group name + pg counter (ID)" to the
   // unique NCCL ID count. This needs to be group and pg specific
   //
@@ -1074,6 +1140,9 @@ class TORCH_API ProcessGroupNCCL : public Backend {
   // Whether or not TORCH_NCCL_AVOID_RECORD_STREAMS was set
   bool avoidRecordStreams_ = false;
 
+  // Whether or not TORCH_NCCL_ALLTOALL_SEGMENTED was set
+  bool segmentedAllToAll_ = false;
+
   // Whether the NCCL watchdog should rethrow CUDA errors.
   bool rethrowCUDAErrors_ = false;
 
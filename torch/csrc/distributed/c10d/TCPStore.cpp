@@ -6,6 +6,7 @@
 #include <torch/csrc/distributed/c10d/logging.h>
 
 #include <fcntl.h>
+#include <array>
 #include <chrono>
 #include <fstream>
 #include <random>
@@ -198,11 +199,40 @@ class TCPClient {
   Socket socket_;
 };
 
+#ifndef _WIN32
+// Whether `host` names this machine, i.e. whether the store server behind it
+// may be reachable over the same-host Unix domain socket.
+static bool isLocalhostAddr(const std::string& host) {
+  if (host == "localhost" || host == "127.0.0.1" || host == "::1") {
+    return true;
+  }
+  std::array<char, 256> hostname{};
+  if (::gethostname(hostname.data(), hostname.size() - 1) != 0) {
+    return false;
+  }
+  return host == hostname.data();
+}
+#endif
+
 std::unique_ptr<TCPClient> TCPClient::connect(
     const SocketAddress& addr,
     const TCPStoreOptions& opts,
     std::shared_ptr<Backoff> backoff) {
   auto timeout = std::chrono::duration_cast<std::chrono::seconds>(opts.timeout);
+#ifndef _WIN32
+  if (tcpStoreUdsEnabled() && isLocalhostAddr(addr.host)) {
+    try {
+      Socket socket = Socket::connectUnix(tcpStoreUdsPath(addr.port));
+      return std::make_unique<TCPClient>(std::move(socket));
+    } catch (const std::exception& e) {
+      C10D_DEBUG(
+          "The Unix domain socket fast path to ({}, {}) is unavailable, falling back to TCP: {}",
+          addr.host,
+          addr.port,
+          e.what());
+    }
+  }
+#endif
   Socket socket = Socket::connect(
       addr.host,
       addr.port,
@@ -619,6 +649,57 @@ void TCPStore::doWait(
   C10_THROW_ERROR(DistStoreError, "Socket Timeout");
 }
 
+std::vector<std::vector<uint8_t>> TCPStore::doWaitMultiGet(
+    c10::ArrayRef<std::string> keys,
+    std::chrono::milliseconds timeout) {
+  {
+    detail::SendBuffer buffer(*client_, detail::QueryType::WAIT_MULTI_GET);
+    buffer.appendValue(keys.size());
+    for (const std::string& key : keys) {
+      buffer.appendString(key);
+    }
+    buffer.flush();
+  }
+
+  detail::WaitResponseType response;
+  if (client_->receiveValueWithTimeout<detail::WaitResponseType>(
+          response, timeout)) {
+    if (response != detail::WaitResponseType::STOP_WAITING) {
+      TORCH_CHECK(false, "Stop_waiting response is expected");
+    }
+    std::vector<std::vector<uint8_t>> result;
+    result.reserve(keys.size());
+    for (size_t i = 0; i < keys.size(); ++i) {
+      result.emplace_back(client_->receiveBits());
+    }
+    return result;
+  }
+  // this is the cancel wait timeout, once here we expect the server to respond
+  // in a timely fashion
+  {
+    detail::SendBuffer buffer(*client_, detail::QueryType::CANCEL_WAIT);
+    buffer.flush();
+  }
+
+  response = client_->receiveValue<detail::WaitResponseType>();
+  // this can happen if the server responds before we cancel; drain the
+  // pipelined values, then the cancellation ack
+  if (response != detail::WaitResponseType::WAIT_CANCELED) {
+    if (response != detail::WaitResponseType::STOP_WAITING) {
+      TORCH_CHECK(false, "Stop_waiting response is expected");
+    }
+
+    for (size_t i = 0; i < keys.size(); ++i) {
+      client_->receiveBits(); // ignore
+    }
+    response = client_->receiveValue<detail::WaitResponseType>(); // ignore
+    if (response != detail::WaitResponseType::WAIT_CANCELED) {
+      TORCH_CHECK(false, "wait_canceled response is expected");
+    }
+  }
+  C10_THROW_ERROR(DistStoreError, "Socket Timeout");
+}
+
 void TCPStore::append(
     const std::string& key,
     const std::vector<uint8_t>& data) {
@@ -639,6 +720,11 @@ std::vector<std::vector<uint8_t>> TCPStore::multiGet(
   for (const std::string& key : keys) {
     prefixedKeys.emplace_back(keyPrefix_ + key);
   }
+  if (usingLibUv_) {
+    // One round trip: the libuv backend pipelines the values behind the
+    // wait wake-up instead of the wait/multi_get request-reply lockstep.
+    return doWaitMultiGet(prefixedKeys, timeout_);
+  }
   doWait(prefixedKeys, timeout_);
 
   detail::SendBuffer buffer(*client_, detail::QueryType::MULTI_GET);
@@ -151,6 +151,12 @@ class TORCH_API TCPStore : public Store {
       c10::ArrayRef<std::string> keys,
       std::chrono::milliseconds timeout);
 
+  // Fused wait + get for the libuv backend: resolves all keys in a single
+  // round trip (the server pipelines the values behind the wake-up).
+  std::vector<std::vector<uint8_t>> doWaitMultiGet(
+      c10::ArrayRef<std::string> keys,
+      std::chrono::milliseconds timeout);
+
   detail::SocketAddress addr_;
   std::shared_ptr<detail::TCPServer> server_;
   std::unique_ptr<detail::TCPClient> client_;
@@ -15,7 +15,9 @@
 #include <unistd.h>
 #endif
 
+#include <c10/util/env.h>
 #include <c10/util/thread_name.h>
+#include <fmt/format.h>
 #include <torch/csrc/distributed/c10d/TCPStoreBackend.hpp>
 #include <torch/csrc/distributed/c10d/logging.h>
 
@@ -624,4 +626,16 @@ std::unique_ptr<BackgroundThread> create_tcpstore_backend(
   return std::make_unique<TCPStoreMasterDaemon>(std::move(socket));
 }
 
+#ifndef _WIN32
+bool tcpStoreUdsEnabled() {
+  return c10::utils::check_env("TORCH_TCPSTORE_USE_UDS") == true;
+}
+
+std::string tcpStoreUdsPath(std::uint16_t port) {
+  // Keyed by uid so concurrent users on a shared machine cannot collide,
+  // and by port so one process can host several stores.
+  return fmt::format("/tmp/torch-tcpstore-{}-{}.sock", ::getuid(), port);
+}
+#endif
+
 } // namespace c10d::detail
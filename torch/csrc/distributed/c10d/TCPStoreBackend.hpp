@@ -32,6 +32,10 @@ enum class QueryType : uint8_t {
   MULTI_GET,
   MULTI_SET,
   CANCEL_WAIT,
+  // Fused wait + multi_get (libuv backend only): the server pipelines the
+  // values of all requested keys right behind STOP_WAITING, so a batched
+  // get of not-yet-set keys costs a single round trip.
+  WAIT_MULTI_GET,
 };
 
 enum class CheckResponseType : uint8_t { READY, NOT_READY };
@@ -70,4 +74,14 @@ std::unique_ptr<BackgroundThread> create_libuv_tcpstore_backend(
     const TCPStoreOptions& opts);
 bool is_libuv_tcpstore_backend_available();
 
+#ifndef _WIN32
+// Same-host fast path (opt-in via TORCH_TCPSTORE_USE_UDS): the libuv server
+// additionally listens on a Unix domain socket derived from its TCP port,
+// and clients targeting the local host connect to it instead of going
+// through the TCP stack. Cross-host clients keep using TCP; clients fall
+// back to TCP if the Unix domain socket cannot be reached.
+bool tcpStoreUdsEnabled();
+std::string tcpStoreUdsPath(std::uint16_t port);
+#endif
+
 } // namespace c10d::detail
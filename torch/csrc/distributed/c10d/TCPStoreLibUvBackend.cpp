@@ -87,15 +87,16 @@ class UvHandle : public c10::intrusive_ptr_target {
   }
 };
 
-class UvTcpSocket : public UvHandle {
-  uv_tcp_t client{};
-
-  c10::intrusive_ptr<UvTcpSocket> iptr() {
-    return c10::intrusive_ptr<UvTcpSocket>::reclaim_copy(this);
+// Stream-agnostic read machinery shared by the TCP sockets and, on the
+// same-host fast path, the Unix domain pipe sockets. Subclasses own the
+// concrete libuv handle and expose it through unsafeGetStream.
+class UvStream : public UvHandle {
+  c10::intrusive_ptr<UvStream> iptr() {
+    return c10::intrusive_ptr<UvStream>::reclaim_copy(this);
   }
 
-  static c10::intrusive_ptr<UvTcpSocket> borrow(uv_stream_t* handle) {
-    auto h = (UvTcpSocket*)uv_handle_get_data((uv_handle_t*)handle);
+  static c10::intrusive_ptr<UvStream> borrow(uv_stream_t* handle) {
+    auto h = (UvStream*)uv_handle_get_data((uv_handle_t*)handle);
     return h->iptr();
   }
 
@@ -113,7 +114,7 @@ class UvTcpSocket : public UvHandle {
       uv_stream_t* client,
       ssize_t nread,
       const uv_buf_t* buf) {
-    auto uv_socket = UvTcpSocket::borrow(client);
+    auto uv_socket = UvStream::borrow(client);
 
     if (nread < 0) {
       C10D_DEBUG(
@@ -135,17 +136,8 @@ class UvTcpSocket : public UvHandle {
   }
 
  public:
-  explicit UvTcpSocket(uv_loop_t* loop) {
-    uv_tcp_init(loop, &client);
-    if (int err = uv_tcp_nodelay(&client, 1)) {
-      C10D_WARNING(
-          "The no-delay option cannot be enabled for the client socket. err={}",
-          err);
-    }
-  }
-
   void startRead() {
-    int res = uv_read_start((uv_stream_t*)&client, alloc_buffer, read_callback);
+    int res = uv_read_start(unsafeGetStream(), alloc_buffer, read_callback);
     if (res) {
       C10D_WARNING(
           "Failed to setup read callback. client:{} code:{} name:{} desc:{}.",
@@ -158,17 +150,11 @@ class UvTcpSocket : public UvHandle {
   }
 
   uv_handle_t* unsafeGetHandle() override {
-    return (uv_handle_t*)&client;
+    return (uv_handle_t*)unsafeGetStream();
   }
 
  protected:
-  uv_stream_t* unsafeGetStream() {
-    return (uv_stream_t*)&client;
-  }
-
-  uv_tcp_t* unsafeGetSocket() {
-    return &client;
-  }
+  virtual uv_stream_t* unsafeGetStream() = 0;
 
   virtual void processBuf(const uv_buf_t* buf, size_t nread) {
     TORCH_CHECK(
@@ -181,6 +167,47 @@ class UvTcpSocket : public UvHandle {
   }
 };
 
+class UvTcpSocket : public UvStream {
+  uv_tcp_t client{};
+
+ public:
+  explicit UvTcpSocket(uv_loop_t* loop) {
+    uv_tcp_init(loop, &client);
+    if (int err = uv_tcp_nodelay(&client, 1)) {
+      C10D_WARNING(
+          "The no-delay option cannot be enabled for the client socket. err={}",
+          err);
+    }
+  }
+
+ protected:
+  uv_stream_t* unsafeGetStream() override {
+    return (uv_stream_t*)&client;
+  }
+
+  uv_tcp_t* unsafeGetSocket() {
+    return &client;
+  }
+};
+
+class UvPipeSocket : public UvStream {
+  uv_pipe_t pipe{};
+
+ public:
+  explicit UvPipeSocket(uv_loop_t* loop) {
+    uv_pipe_init(loop, &pipe, /*ipc=*/0);
+  }
+
+ protected:
+  uv_stream_t* unsafeGetStream() override {
+    return (uv_stream_t*)&pipe;
+  }
+
+  uv_pipe_t* unsafeGetPipe() {
+    return &pipe;
+  }
+};
+
 class UvTcpServer : public UvTcpSocket {
  public:
   typedef std::function<void(int)> OnConnectCallback;
@@ -342,6 +369,93 @@ class UvTcpServer : public UvTcpSocket {
   }
 };
 
+// Listener for the same-host Unix domain socket fast path. Local clients
+// connecting here speak the same wire protocol as TCP clients.
+class UvPipeServer : public UvPipeSocket {
+ public:
+  typedef std::function<void(int)> OnConnectCallback;
+  explicit UvPipeServer(uv_loop_t* loop)
+      : UvPipeSocket(loop), onConnectCb(missingOnConnect) {}
+
+  static c10::intrusive_ptr<UvPipeServer> makeWithPath(
+      uv_loop_t* loop,
+      const std::string& path) {
+    auto res = c10::make_intrusive<UvPipeServer>(loop);
+    res->handleReady();
+    try {
+      int uv_res = uv_pipe_bind(res->unsafeGetPipe(), path.c_str());
+      TORCH_CHECK(
+          uv_res == 0,
+          "The Unix domain socket has failed to bind. ",
+          "path: ",
+          path,
+          ", code: ",
+          uv_res,
+          ", name: ",
+          uv_err_name(uv_res),
+          ", message: ",
+          uv_strerror(uv_res));
+
+      uv_res =
+          uv_listen(res->unsafeGetStream(), DEFAULT_BACKLOG, on_new_connection);
+      TORCH_CHECK(
+          uv_res == 0,
+          "The Unix domain socket has failed to listen. ",
+          "path: ",
+          path,
+          ", code: ",
+          uv_res,
+          ", name: ",
+          uv_err_name(uv_res),
+          ", message: ",
+          uv_strerror(uv_res));
+    } catch (std::exception& ex) {
+      res->close();
+      throw;
+    }
+
+    return res;
+  }
+
+  void setOnConnectCallback(OnConnectCallback&& callback) {
+    onConnectCb = std::move(callback);
+  }
+
+  void accept(const c10::intrusive_ptr<UvPipeSocket>& socket) {
+    int res =
+        uv_accept(unsafeGetStream(), (uv_stream_t*)socket->unsafeGetHandle());
+    TORCH_CHECK(
+        res == 0,
+        "Failed to accept pipe client. ",
+        "code: ",
+        res,
+        ", name: ",
+        uv_err_name(res),
+        ", message: ",
+        uv_strerror(res));
+  }
+
+ private:
+  OnConnectCallback onConnectCb;
+
+  c10::intrusive_ptr<UvPipeServer> iptr() {
+    return c10::intrusive_ptr<UvPipeServer>::reclaim_copy(this);
+  }
+
+  static c10::intrusive_ptr<UvPipeServer> borrow(uv_stream_t* handle) {
+    auto h = (UvPipeServer*)uv_handle_get_data((uv_handle_t*)handle);
+    return h->iptr();
+  }
+
+  static void missingOnConnect(int status) {
+    TORCH_CHECK(false, "Pipe accepted but onConnect callback missing");
+  }
+
+  static void on_new_connection(uv_stream_t* server, int status) {
+    borrow(server)->onConnectCb(status);
+  }
+};
+
 class WriterPayload : public c10::intrusive_ptr_target {
   static c10::intrusive_ptr<WriterPayload> reclaim(uv_write_t* request) {
     /* This method returns a intrusive_ptr that does not increase the refcount.
@@ -605,6 +719,9 @@ class LibUVStoreDaemon : public BackgroundThread {
   bool waitKeys(
       const std::vector<std::string>& keys,
       const c10::intrusive_ptr<UvHandle>& client);
+  void registerWaitGet(
+      const c10::intrusive_ptr<UvHandle>& client,
+      std::vector<std::string> keys);
   int64_t size();
   int64_t deleteKey(const std::string& key);
   void append(const std::string& key, const std::vector<uint8_t>& value);
@@ -624,6 +741,10 @@ class LibUVStoreDaemon : public BackgroundThread {
  private:
   uv_loop_t loop{};
   c10::intrusive_ptr<UvTcpServer> tcpServer;
+  // Same-host Unix domain socket listener; null unless the fast path is
+  // enabled (see tcpStoreUdsEnabled).
+  c10::intrusive_ptr<UvPipeServer> pipeServer;
+  std::string pipePath_;
 
   uv_async_t exit_handle{};
   std::unordered_map<std::string, std::vector<uint8_t>> tcpStore_;
@@ -632,6 +753,10 @@ class LibUVStoreDaemon : public BackgroundThread {
       waitingSockets_;
   // From socket -> number of keys awaited
   std::unordered_map<c10::intrusive_ptr<UvHandle>, size_t> keysAwaited_;
+  // From socket -> keys whose values should be pipelined behind the wake-up
+  // (for WAIT_MULTI_GET clients)
+  std::unordered_map<c10::intrusive_ptr<UvHandle>, std::vector<std::string>>
+      waitGetKeys_;
   std::unordered_set<c10::intrusive_ptr<UvHandle>> clients_;
   std::unordered_set<c10::intrusive_ptr<UvHandle>> miscellaneousClients_;
   int port_;
@@ -649,6 +774,7 @@ class LibUVStoreDaemon : public BackgroundThread {
   }
 
   void onConnect(int status);
+  void onPipeConnect(int status);
   void onExitRequest();
   void wakeupWaitingClients(const std::string& key);
   // bool tryListen(bool use_ipv6);
@@ -656,7 +782,10 @@ class LibUVStoreDaemon : public BackgroundThread {
   static void print_active_handles(uv_handle_t* handle, void* arg);
 };
 
-class UvClient : public UvTcpSocket {
+// Client connection logic, parameterized over the socket flavor so that TCP
+// and same-host pipe clients share one protocol implementation.
+template <typename SocketT>
+class UvClient : public SocketT {
   ChunkedStream stream;
   LibUVStoreDaemon* store;
 
@@ -726,12 +855,16 @@ class UvClient : public UvTcpSocket {
             if (!parse_cancel_wait_command())
               return;
             break;
+          case QueryType::WAIT_MULTI_GET:
+            if (!parse_wait_multi_get_command())
+              return;
+            break;
           default:
             C10D_DEBUG(
                 "Client sent invalid command. client:{} command:{}",
                 (void*)this,
                 (int)command);
-            close();
+            this->close();
             return;
         }
       }
@@ -963,6 +1096,41 @@ class UvClient : public UvTcpSocket {
     return true;
   }
 
+  bool parse_wait_multi_get_command() {
+    uint64_t key_count = 0;
+    if (!stream.read_value(key_count)) {
+      return false;
+    }
+    TORCH_CHECK(
+        key_count <= MAX_KEY_COUNT,
+        "Too many keys with wait_multi_get. ",
+        "keys: ",
+        key_count,
+        ", max: ",
+        MAX_KEY_COUNT);
+
+    std::vector<std::string> keys(key_count);
+    for (uint64_t i = 0; i < key_count; ++i) {
+      if (!stream.read_key(keys[i]))
+        return false;
+    }
+
+    if (store->waitKeys(keys, iptr())) {
+      StreamWriter sw(iptr());
+      sw.write1((uint8_t)WaitResponseType::STOP_WAITING);
+      for (const auto& key : keys) {
+        sw.write_vector(store->get(key));
+      }
+      sw.send();
+    } else {
+      // The values are pipelined behind STOP_WAITING once the last key is
+      // set; see wakeupWaitingClients.
+      store->registerWaitGet(iptr(), std::move(keys));
+    }
+
+    return true;
+  }
+
   bool parse_cancel_wait_command() {
     store->clearClientWaitState(iptr());
 
@@ -975,7 +1143,7 @@ class UvClient : public UvTcpSocket {
 
  public:
   explicit UvClient(uv_loop_t* loop, LibUVStoreDaemon* store)
-      : UvTcpSocket(loop), store(store) {}
+      : SocketT(loop), store(store) {}
 
   static c10::intrusive_ptr<UvClient> make(
       uv_loop_t* loop,
@@ -991,12 +1159,12 @@ class UvClient : public UvTcpSocket {
 
  protected:
   void onClose() override {
-    store->unregisterClient(iptr());
+    store->unregisterClient(this->iptr());
   }
 };
 
 void LibUVStoreDaemon::onConnect(int status) {
-  auto client = UvClient::make(&loop, this);
+  auto client = UvClient<UvTcpSocket>::make(&loop, this);
   registerClient(client);
   try {
     tcpServer->accept(client);
@@ -1007,6 +1175,18 @@ void LibUVStoreDaemon::onConnect(int status) {
   }
 }
 
+void LibUVStoreDaemon::onPipeConnect(int status) {
+  auto client = UvClient<UvPipeSocket>::make(&loop, this);
+  registerClient(client);
+  try {
+    pipeServer->accept(client);
+    client->startRead();
+  } catch (std::exception& e) {
+    C10D_WARNING("Failed to accept local client due to {}", e.what());
+    client->close();
+  }
+}
+
 void LibUVStoreDaemon::onExitRequest() {
   C10D_DEBUG("Store exit requested\n");
   uv_close((uv_handle_t*)&exit_handle, nullptr);
@@ -1038,6 +1218,29 @@ void LibUVStoreDaemon::init(const TCPStoreOptions& opts) {
       port_,
       ", expected to be bound to port ",
       opts.port);
+
+#ifndef _WIN32
+  if (tcpStoreUdsEnabled()) {
+    auto pipePath = tcpStoreUdsPath(port_);
+    // A socket file left behind by a dead server would fail the bind.
+    ::unlink(pipePath.c_str());
+    try {
+      pipeServer = UvPipeServer::makeWithPath(&loop, pipePath);
+      pipeServer->setOnConnectCallback(
+          [this](auto status) { this->onPipeConnect(status); });
+      pipePath_ = std::move(pipePath);
+      C10D_INFO(
+          "The server is also listening on the Unix domain socket {} for same-host clients.",
+          pipePath_);
+    } catch (std::exception& ex) {
+      C10D_WARNING(
+          "Failed to listen on the Unix domain socket {}, continuing with TCP only. Error: {}",
+          pipePath,
+          ex.what());
+      pipeServer.reset();
+    }
+  }
+#endif
 }
 
 LibUVStoreDaemon::LibUVStoreDaemon(int port) : port_(port) {
@@ -1092,6 +1295,9 @@ void LibUVStoreDaemon::run() {
     client->close();
   }
   tcpServer->close();
+  if (pipeServer) {
+    pipeServer->close();
+  }
 
   if (debug_enabled) {
     C10D_DEBUG("Walking live handles after closing clients");
@@ -1113,6 +1319,11 @@ void LibUVStoreDaemon::run() {
       std::this_thread::sleep_for(std::chrono::milliseconds(500));
     }
   }
+#ifndef _WIN32
+  if (!pipePath_.empty()) {
+    ::unlink(pipePath_.c_str());
+  }
+#endif
   C10D_INFO("uv_loop cleanup finished.");
 }
 
@@ -1157,6 +1368,7 @@ void LibUVStoreDaemon::clearClientWaitState(
     return;
   }
   keysAwaited_.erase(client);
+  waitGetKeys_.erase(client);
   for (auto it = waitingSockets_.begin(); it != waitingSockets_.end();) {
     for (auto vecIt = it->second.begin(); vecIt != it->second.end();) {
       if (*vecIt == client) {
@@ -1256,6 +1468,12 @@ bool LibUVStoreDaemon::waitKeys(
   return false;
 }
 
+void LibUVStoreDaemon::registerWaitGet(
+    const c10::intrusive_ptr<UvHandle>& client,
+    std::vector<std::string> keys) {
+  waitGetKeys_[client] = std::move(keys);
+}
+
 int64_t LibUVStoreDaemon::size() {
   return tcpStore_.size();
 }
@@ -1286,6 +1504,15 @@ void LibUVStoreDaemon::wakeupWaitingClients(const std::string& key) {
       if (--keysAwaited_[client] == 0) {
         StreamWriter sw(client->iptr());
         sw.write1((uint8_t)WaitResponseType::STOP_WAITING);
+        auto waitGet = waitGetKeys_.find(client);
+        if (waitGet != waitGetKeys_.end()) {
+          // WAIT_MULTI_GET client: pipeline the values right behind the
+          // wake-up so no second round trip is needed.
+          for (const auto& waitGetKey : waitGet->second) {
+            sw.write_vector(get(waitGetKey));
+          }
+          waitGetKeys_.erase(waitGet);
+        }
         sw.send();
       }
     }
@@ -1,5 +1,6 @@
 #include <ATen/ThreadLocalState.h>
 
+#include <torch/csrc/distributed/c10d/CollectiveJournal.hpp>
 #include <torch/csrc/distributed/c10d/Work.hpp>
 #include <utility>
 
@@ -36,6 +37,22 @@ Work::Work(
       recordFunctionEndCallback_ = at::wrapPropagateTLSState(end_handler);
     }
   }
+  if (opType != OpType::UNKNOWN) {
+    uint64_t bytes = 0;
+    if (inputTensors) {
+      for (const auto& tensor : *inputTensors) {
+        bytes += tensor.nbytes();
+      }
+    }
+    journalSeq_ = CollectiveJournal::get().recordStart(opType, rank, bytes);
+  }
+}
+
+void Work::markJournalCompleted() {
+  if (journalSeq_ != 0) {
+    CollectiveJournal::get().recordEnd(journalSeq_);
+    journalSeq_ = 0;
+  }
 }
 
 OpType Work::retrieveOpType() const {
@@ -110,6 +127,7 @@ void Work::finish(std::exception_ptr exception) {
     recordFunctionEndCallback_();
     recordFunctionEndCallback_ = nullptr;
   }
+  markJournalCompleted();
   lock.unlock();
   cv_.notify_all();
 }
@@ -122,6 +140,7 @@ void Work::finishAndThrow(std::exception_ptr exception) {
     recordFunctionEndCallback_();
     recordFunctionEndCallback_ = nullptr;
   }
+  markJournalCompleted();
   if (exception_) {
     std::rethrow_exception(exception_);
   }
@@ -114,6 +114,12 @@ class TORCH_API Work : public torch::CustomClassHolder {
 
   OpType retrieveOpType() const;
 
+  // Stamps this work as completed in the process-wide collective journal.
+  // Called automatically by finish()/finishAndThrow(); backends that retire
+  // work without going through finish() (e.g. the NCCL watchdog) call it
+  // directly. Idempotent.
+  void markJournalCompleted();
+
   static c10::intrusive_ptr<Work> create_from_future(
       const c10::intrusive_ptr<c10::ivalue::Future>&);
 
@@ -140,6 +146,10 @@ class TORCH_API Work : public torch::CustomClassHolder {
   // When profiling, the callback to record end of operation event. This
   // callback needs to be called when collective operation is complete.
   std::function<void()> recordFunctionEndCallback_;
+
+  // Sequence number assigned by the collective journal at construction;
+  // 0 when the journal is disabled or completion was already stamped.
+  uint64_t journalSeq_ = 0;
 };
 
 struct TORCH_API WorkInfo {
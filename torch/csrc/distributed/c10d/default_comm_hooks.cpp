@@ -1,13 +1,43 @@
 #include <c10/core/ScalarType.h>
 #include <c10/util/Exception.h>
+#include <c10/util/irange.h>
 #include <torch/csrc/distributed/c10d/default_comm_hooks.hpp>
 
 #include <torch/csrc/distributed/c10d/ProcessGroup.hpp>
 #include <torch/csrc/distributed/c10d/comm.hpp>
 #include <torch/torch.h>
 
+#include <ATen/CPUGeneratorImpl.h>
+
+#include <cmath>
+
 namespace c10d {
 
+namespace {
+
+// Makes the columns of the given 2D tensor orthonormal in place. Uses
+// Gram-Schmidt for very low ranks and reduced-precision dtypes (QR is not
+// supported there), and QR otherwise.
+void orthogonalize(at::Tensor& matrix) {
+  TORCH_INTERNAL_ASSERT_DEBUG_ONLY(matrix.dim() == 2);
+  const auto rank = matrix.size(1);
+  const auto dtype = matrix.scalar_type();
+  if (rank <= 2 || (dtype != at::kFloat && dtype != at::kDouble)) {
+    for (const auto i : c10::irange(rank)) {
+      auto col = matrix.narrow(1, i, 1);
+      col.div_(col.norm());
+      if (i + 1 < rank) {
+        auto rest = matrix.narrow(1, i + 1, rank - i - 1);
+        rest.sub_(col.matmul(col.t().matmul(rest)));
+      }
+    }
+  } else {
+    matrix.copy_(std::get<0>(at::linalg_qr(matrix)));
+  }
+}
+
+} // namespace
+
 c10::intrusive_ptr<c10::ivalue::Future> AllReduceCommHook::runHook(
     GradBucket& bucket) {
   std::vector<at::Tensor> tensors = {bucket.getBufferRef()};
@@ -43,6 +73,125 @@ c10::intrusive_ptr<c10::ivalue::Future> FP16CompressCommHook::runHook(
   return allreduce_fut->then(decompress, allreduce_fut->elementType());
 }
 
+c10::intrusive_ptr<c10::ivalue::Future> BF16CompressCommHook::runHook(
+    GradBucket& bucket) {
+  auto compressed_tensor = bucket.getBufferRef().to(torch::kBFloat16);
+  // Apply the division first to avoid overflow.
+  compressed_tensor /= state_->getSize();
+  std::vector<at::Tensor> tensors = {compressed_tensor};
+
+  auto allreduce_fut = state_->allreduce(tensors)->getFuture();
+  auto decompressed_tensor = bucket.getBufferRef();
+  auto decompress = [decompressed_tensor](c10::ivalue::Future& allreduce_fut) {
+    auto result = allreduce_fut.value();
+    TORCH_INTERNAL_ASSERT(
+        result.isTensorList(),
+        "ProcessGroup::allreduce should return TensorList");
+
+    auto reduce_tensor = result.toTensorVector()[0];
+    TORCH_INTERNAL_ASSERT_DEBUG_ONLY(
+        reduce_tensor.scalar_type() == at::ScalarType::BFloat16,
+        "Expected reduced tensor to be bf16 in BF16CompressHook, but got type ",
+        reduce_tensor.scalar_type());
+    decompressed_tensor.copy_(reduce_tensor);
+    return c10::IValue(decompressed_tensor);
+  };
+
+  return allreduce_fut->then(decompress, allreduce_fut->elementType());
+}
+
+c10::intrusive_ptr<c10::ivalue::Future> PowerSGDCommHook::runHook(
+    GradBucket& bucket) {
+  auto input = bucket.getBufferRef();
+  const auto world_size = state_->getSize();
+
+  // Run vanilla allreduce for the first start_powerSGD_iter iterations;
+  // compressing gradients too early hurts convergence.
+  if (iter_ < options_.start_powerSGD_iter) {
+    if (bucket.isLast()) {
+      ++iter_;
+    }
+    std::vector<at::Tensor> tensors = {input};
+    tensors[0] /= world_size;
+    return state_->allreduce(tensors)->getFuture();
+  }
+  if (bucket.isLast()) {
+    ++iter_;
+  }
+
+  const auto bucket_index = bucket.getIndex();
+  const int64_t total_length = input.numel();
+  // View the flat bucket buffer as a square matrix, padding with zeros.
+  const auto side = static_cast<int64_t>(
+      std::ceil(std::sqrt(static_cast<double>(total_length))));
+  const int64_t padded_length = side * side;
+  const int64_t rank = options_.matrix_approximation_rank;
+
+  input.resize_({padded_length});
+  if (padded_length > total_length) {
+    input.narrow(0, total_length, padded_length - total_length).zero_();
+  }
+
+  // Incorporate the compression error from the previous iteration, and keep
+  // a copy of the uncompressed gradients to compute this iteration's error.
+  at::Tensor input_cp;
+  if (options_.use_error_feedback) {
+    auto it = error_dict_.find(bucket_index);
+    if (it != error_dict_.end()) {
+      input.add_(it->second);
+    } else {
+      error_dict_[bucket_index] = at::zeros({padded_length}, input.options());
+    }
+    input_cp = input.clone().detach();
+  }
+  auto matrix = input.view({side, side});
+
+  if (!options_.warm_start || p_dict_.find(bucket_index) == p_dict_.end()) {
+    p_dict_[bucket_index] = at::empty({side, rank}, input.options());
+    // Q is drawn on the CPU from a per-hook seed sequence. Every rank draws
+    // the same sequence, so the initial factors match across replicas
+    // without a broadcast.
+    auto rng = at::detail::createCPUGenerator(next_q_seed_++);
+    q_dict_[bucket_index] =
+        at::randn({side, rank}, rng, input.options().device(at::kCPU))
+            .to(input.device());
+  }
+  auto q = q_dict_[bucket_index];
+  auto p = p_dict_[bucket_index];
+  orthogonalize(q);
+
+  at::matmul_out(p, matrix, q);
+  std::vector<at::Tensor> p_tensors = {p};
+  auto allreduce_p_fut = state_->allreduce(p_tensors)->getFuture();
+
+  auto compute_q_and_decompress =
+      [this, input, input_cp, matrix, p, q, bucket_index, total_length, world_size](
+          c10::ivalue::Future& /* unused */) mutable {
+        orthogonalize(p);
+        at::matmul_out(q, matrix.t(), p);
+
+        // The second allreduce is waited on inside this callback, so the
+        // future returned to the reducer stays asynchronous end to end.
+        std::vector<at::Tensor> q_tensors = {q};
+        state_->allreduce(q_tensors)->getFuture()->wait();
+        q.div_(world_size);
+
+        at::matmul_out(matrix, p, q.t());
+        if (options_.use_error_feedback) {
+          error_dict_[bucket_index] = input_cp - input;
+        }
+        if (!options_.warm_start) {
+          p_dict_.clear();
+          q_dict_.clear();
+        }
+        input.resize_({total_length});
+        return c10::IValue(input);
+      };
+
+  return allreduce_p_fut->then(
+      compute_q_and_decompress, allreduce_p_fut->elementType());
+}
+
 c10::intrusive_ptr<c10::ivalue::Future> _AllReduceBySumCommHook::runHook(
     GradBucket& bucket) {
   std::vector<at::Tensor> tensors = {bucket.getBufferRef()};
@@ -8,6 +8,8 @@ namespace c10d {
 enum class BuiltinCommHookType : uint8_t {
   ALLREDUCE = 1,
   FP16_COMPRESS = 2,
+  BF16_COMPRESS = 3,
+  POWER_SGD = 4,
 };
 
 class AllReduceCommHook
@@ -32,6 +34,67 @@ class FP16CompressCommHook
   c10::intrusive_ptr<c10::ivalue::Future> runHook(GradBucket& bucket) override;
 };
 
+class BF16CompressCommHook
+    : public CppCommHookInterface<c10::intrusive_ptr<ProcessGroup>> {
+ public:
+  explicit BF16CompressCommHook(const c10::intrusive_ptr<ProcessGroup>& state)
+      : CppCommHookInterface<c10::intrusive_ptr<ProcessGroup>>(state) {}
+
+  ~BF16CompressCommHook() override = default;
+
+  c10::intrusive_ptr<c10::ivalue::Future> runHook(GradBucket& bucket) override;
+};
+
+struct PowerSGDCommHookOptions {
+  // Low-rank approximation rank applied to the square-reshaped bucket
+  // buffer. Rank 1 matches the accuracy recommendation for the batched
+  // variant of the algorithm.
+  int64_t matrix_approximation_rank{1};
+  // Run vanilla allreduce for the first iterations, before compression
+  // kicks in. Mirrors PowerSGDState.start_powerSGD_iter.
+  int64_t start_powerSGD_iter{1000};
+  // Accumulate the compression error locally and add it back into the next
+  // iteration's gradients.
+  bool use_error_feedback{true};
+  // Reuse P and Q across iterations instead of reinitializing them.
+  bool warm_start{true};
+};
+
+// Native implementation of the batched PowerSGD gradient compression
+// described in https://arxiv.org/abs/1905.13727. This is the C++ counterpart
+// of torch.distributed.algorithms.ddp_comm_hooks.powerSGD_hook
+// .batched_powerSGD_hook: the flat bucket buffer is viewed as a zero-padded
+// square matrix and approximated as P Q^T, so only the two low-rank factors
+// are allreduced. Running natively avoids the per-bucket GIL acquisition and
+// GradBucket conversion of the Python hook.
+class TORCH_API PowerSGDCommHook
+    : public CppCommHookInterface<c10::intrusive_ptr<ProcessGroup>> {
+ public:
+  explicit PowerSGDCommHook(
+      const c10::intrusive_ptr<ProcessGroup>& state,
+      PowerSGDCommHookOptions options = {})
+      : CppCommHookInterface<c10::intrusive_ptr<ProcessGroup>>(state),
+        options_(options) {}
+
+  ~PowerSGDCommHook() override = default;
+
+  c10::intrusive_ptr<c10::ivalue::Future> runHook(GradBucket& bucket) override;
+
+ private:
+  PowerSGDCommHookOptions options_;
+  int64_t iter_{0};
+  // Per-bucket error-feedback and low-rank factor memory, keyed by bucket
+  // index. Bucket assignment is fixed once the buckets are rebuilt, so the
+  // cached shapes stay valid across iterations.
+  std::unordered_map<size_t, at::Tensor> error_dict_;
+  std::unordered_map<size_t, at::Tensor> p_dict_;
+  std::unordered_map<size_t, at::Tensor> q_dict_;
+  // Seed counter for initializing Q; the sequence is identical on every
+  // rank, so the random initialization matches across replicas without
+  // extra communication.
+  uint64_t next_q_seed_{0};
+};
+
 // Almost same as AllReduceCommHook, but without division inside the hook.
 // This enables the optimization of fusing copy and division and saves one scan
 // over all the input parameters, when no communication hook is provided by the
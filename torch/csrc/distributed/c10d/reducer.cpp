@@ -3,6 +3,7 @@
 #include <torch/csrc/distributed/c10d/Utils.hpp>
 #include <torch/csrc/distributed/c10d/default_comm_hooks.hpp>
 
+#include <algorithm>
 #include <functional>
 
 #include <c10/core/DeviceGuard.h>
@@ -1054,6 +1055,56 @@ void Reducer::install_futures(
   }
 }
 
+at::Tensor Reducer::allocate_bucket_gradients(
+    const at::TensorOptions& options,
+    int64_t numel) {
+  const auto device = options.device();
+  const auto dtype = c10::typeMetaToScalarType(options.dtype());
+  for (auto it = bucket_storage_slabs_.begin();
+       it != bucket_storage_slabs_.end();
+       ++it) {
+    if (it->device != device || it->dtype != dtype) {
+      continue;
+    }
+    if (it->offset + numel > it->storage.numel()) {
+      // The bucket assignment outgrew the slab, which can only happen if the
+      // parameter set itself changed. Drop the slab and size a fresh one
+      // below.
+      bucket_storage_slabs_.erase(it);
+      break;
+    }
+    auto gradients = it->storage.narrow(0, it->offset, numel);
+    it->offset += numel;
+    return gradients;
+  }
+
+  // First request for this device/dtype: preallocate one slab big enough for
+  // every dense parameter that can be bucketed into it. That total is
+  // invariant across bucket rebuilds, so the slab never has to grow.
+  int64_t total = 0;
+  for (const auto i : c10::irange(params_.size())) {
+    if (expect_sparse_gradients_[i]) {
+      continue;
+    }
+    const auto& param = params_[i];
+    if (param.device() != device) {
+      continue;
+    }
+    // With mixed precision enabled, every dense bucket uses the reduced
+    // dtype regardless of the parameter's own dtype.
+    if (!mixed_precision_param_dtype_ && param.scalar_type() != dtype) {
+      continue;
+    }
+    total += param.numel();
+  }
+  total = std::max(total, numel);
+
+  auto& slab = bucket_storage_slabs_.emplace_back(device, dtype);
+  slab.storage = at::empty({total}, options);
+  slab.offset = numel;
+  return slab.storage.narrow(0, 0, numel);
+}
+
 void Reducer::initialize_buckets(
     std::vector<std::vector<size_t>> bucket_indices) {
   // If initialize_buckets is called inside DDP constructor, then
@@ -1079,6 +1130,35 @@ void Reducer::initialize_buckets(
   buckets_.clear();
   variable_locators_.clear();
 
+  // With persistent bucket slabs, gradients from before a rebuild may alias
+  // the very storage the new buckets are about to be carved from, and the
+  // new bucket layout generally differs from the old one. Move such grads
+  // onto their own storage first, so filling the recarved buckets cannot
+  // clobber gradient data that has yet to be copied in;
+  // initialize_bucket_views re-points the grads at the new views afterwards.
+  if (gradient_as_bucket_view_ && !bucket_storage_slabs_.empty()) {
+    for (auto& variable : params_) {
+      runGradCallbackForVariable(variable, [&](auto& grad) {
+        if (!grad.defined()) {
+          return false;
+        }
+        for (const auto& slab : bucket_storage_slabs_) {
+          if (slab.storage.defined() && grad.is_alias_of(slab.storage)) {
+            grad = grad.clone();
+            return true;
+          }
+        }
+        return false;
+      });
+    }
+  }
+
+  // Recarve the persistent gradient slabs from the beginning; the previous
+  // buckets (and any gradient views into them) were just dropped.
+  for (auto& slab : bucket_storage_slabs_) {
+    slab.offset = 0;
+  }
+
   // Ensure we have a bucket index for every variable.
   variable_locators_.resize(params_.size());
 
@@ -1165,7 +1245,8 @@ void Reducer::initialize_buckets(
       if (mixed_precision_param_dtype_) {
         options = options.dtype(*mixed_precision_param_dtype_);
       }
-      bucket.gradients = at::empty({static_cast<long>(offset)}, options);
+      bucket.gradients = allocate_bucket_gradients(
+          options, static_cast<int64_t>(offset));
 
       // Note:  "Gradient Layout Contract"
       //
@@ -1902,6 +1983,14 @@ void Reducer::register_builtin_comm_hook(
       comm_hook_ = std::make_unique<c10d::FP16CompressCommHook>(process_group_);
       LOG(INFO) << "Built-in communication hook FP16_COMPRESS is registered.";
       break;
+    case c10d::BuiltinCommHookType::BF16_COMPRESS:
+      comm_hook_ = std::make_unique<c10d::BF16CompressCommHook>(process_group_);
+      LOG(INFO) << "Built-in communication hook BF16_COMPRESS is registered.";
+      break;
+    case c10d::BuiltinCommHookType::POWER_SGD:
+      comm_hook_ = std::make_unique<c10d::PowerSGDCommHook>(process_group_);
+      LOG(INFO) << "Built-in communication hook POWER_SGD is registered.";
+      break;
     default:
       TORCH_WARN_ONCE(
           "Unknown built-in DDP comm hook type is provided. No comm hook will be used.");
@@ -400,6 +400,30 @@ class TORCH_API Reducer {
 
   std::vector<Bucket> buckets_;
 
+  // Persistent backing storage for the flat `gradients` tensors, one slab per
+  // (device, dtype). Bucket assignments change when rebuild_buckets() runs,
+  // but the total number of dense gradient elements per device/dtype does
+  // not, so each (re)initialization carves the flat tensors out of the same
+  // preallocated slabs instead of churning fresh allocations through the
+  // caching allocator (which caused a latency spike at the step-2 rebuild).
+  struct BucketStorageSlab {
+    at::Device device;
+    at::ScalarType dtype;
+    at::Tensor storage;
+    // Carve cursor; reset at the start of every initialize_buckets() call.
+    int64_t offset = 0;
+
+    BucketStorageSlab(at::Device device, at::ScalarType dtype)
+        : device(device), dtype(dtype) {}
+  };
+  std::vector<BucketStorageSlab> bucket_storage_slabs_;
+
+  // Returns a `numel`-sized 1-d tensor for a bucket's flattened `gradients`,
+  // backed by the persistent slab for (options.device(), options.dtype()).
+  at::Tensor allocate_bucket_gradients(
+      const at::TensorOptions& options,
+      int64_t numel);
+
   // A variable locator locates a particular variable in the reducer's buckets
   struct VariableLocator {
     // Index of the bucket containing the variable in the `buckets_` vector
@@ -24,6 +24,7 @@
 #include <poll.h>
 #include <sys/socket.h>
 #include <sys/types.h>
+#include <sys/un.h>
 #include <unistd.h>
 #endif
 
@@ -236,6 +237,14 @@ struct formatter<::addrinfo> {
           return fmt::format_to(ctx.out(), "[{}]:{}", ip, psai->sin6_port);
         }
       }
+#ifndef _WIN32
+      if (addr.ai_addr->sa_family == AF_UNIX) {
+        const auto* psun =
+            reinterpret_cast<const struct sockaddr_un*>(addr.ai_addr);
+        return fmt::format_to(
+            ctx.out(), "{}", psun->sun_path[0] != '\0' ? psun->sun_path : "<unix>");
+      }
+#endif
       C10_THROW_ERROR(
           DistNetworkError,
           fmt::format(
@@ -1049,6 +1058,46 @@ Socket Socket::connect(
   return Socket{op.run()};
 }
 
+#ifndef _WIN32
+Socket Socket::connectUnix(const std::string& path) {
+  ::sockaddr_un addr{};
+  addr.sun_family = AF_UNIX;
+  if (path.size() >= sizeof(addr.sun_path)) {
+    C10D_THROW_ERROR(
+        SocketError,
+        fmt::format(
+            "The Unix domain socket path is too long: {}", path));
+  }
+  std::memcpy(addr.sun_path, path.c_str(), path.size() + 1);
+
+  int hnd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+  if (hnd == -1) {
+    C10D_THROW_ERROR(
+        SocketError,
+        fmt::format(
+            "The Unix domain socket cannot be created: {}",
+            std::strerror(errno)));
+  }
+  // The impl takes ownership of the handle and closes it if connect fails.
+  auto impl = std::make_unique<SocketImpl>(hnd);
+  if (::connect(hnd, reinterpret_cast<const ::sockaddr*>(&addr), sizeof(addr)) !=
+      0) {
+    C10D_THROW_ERROR(
+        SocketError,
+        fmt::format(
+            "The connection to the Unix domain socket {} has failed: {}",
+            path,
+            std::strerror(errno)));
+  }
+
+  impl->closeOnExec();
+
+  C10D_DEBUG("The client socket has connected to {}.", path);
+
+  return Socket{std::move(impl)};
+}
+#endif
+
 Socket::Socket(Socket&& other) noexcept = default;
 
 Socket& Socket::operator=(Socket&& other) noexcept = default;
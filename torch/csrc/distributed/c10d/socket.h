@@ -76,6 +76,13 @@ class Socket {
       std::uint16_t port,
       const SocketOptions& opts = {});
 
+#ifndef _WIN32
+  // Connects to the Unix domain socket at `path`. Used for the same-host
+  // TCPStore fast path; throws `SocketError` if the listener cannot be
+  // reached so that callers can fall back to TCP.
+  static Socket connectUnix(const std::string& path);
+#endif
+
   Socket() noexcept = default;
 
   Socket(const Socket& other) = delete;
@@ -12,6 +12,15 @@ CacheEntry::CacheEntry(const py::handle& guarded_code, PyObject* backend) {
   if (py::hasattr(this->check_fn, "root")) {
     this->root_mgr = torch::dynamo::convert_to_root_guard_manager(
         this->check_fn.attr("root"));
+    // Pull out a cheap discriminator so lookup can skip this entry without
+    // running the guards when the leading tensor guard cannot match.
+    PyObject* local_name = nullptr;
+    uint64_t fingerprint = 0;
+    if (torch::dynamo::extract_tensor_discriminator(
+            this->root_mgr, &local_name, &fingerprint)) {
+      this->disc_local_name = py::reinterpret_borrow<py::object>(local_name);
+      this->disc_fingerprint = fingerprint;
+    }
   }
 }
 
@@ -43,6 +43,12 @@ typedef struct VISIBILITY_HIDDEN CacheEntry {
   py::object code;
   // root guard manager if exists
   void* root_mgr{nullptr};
+  // Leading tensor discriminator extracted from the guard tree: the f_locals
+  // key of the first tensor-guarded local and the expected (dtype, rank)
+  // fingerprint. A fingerprint of 0 means no discriminator was found and
+  // lookup always runs the guards for this entry.
+  py::object disc_local_name;
+  uint64_t disc_fingerprint{0};
   // backend used to create this cache entry
   PyObject* backend{nullptr};
   // Reference to owning ExtraState
@@ -89,9 +89,31 @@ PyObject* lookup(
   size_t index = 0;
   CacheEntry* found = nullptr;
   py::handle locals(f_locals);
+  // Cache the runtime fingerprint of the last discriminating local so
+  // consecutive entries guarding the same local cost one dict lookup total.
+  PyObject* disc_cached_name = nullptr;
+  uint64_t disc_cached_fingerprint = 0;
   for (CacheEntry& cache_entry : extra_state->cache_entry_list) {
     // Check backend. Py_False means run only mode.
     bool valid = backend == Py_False || cache_entry.backend == backend;
+    if (valid && cache_entry.disc_fingerprint != 0 &&
+        PyDict_CheckExact(f_locals)) {
+      if (cache_entry.disc_local_name.ptr() != disc_cached_name) {
+        disc_cached_name = cache_entry.disc_local_name.ptr();
+        PyObject* value =
+            PyDict_GetItem(f_locals, disc_cached_name); // borrowed ref
+        disc_cached_fingerprint = value == nullptr
+            ? 0
+            : torch::dynamo::tensor_discriminator_fingerprint(value);
+      }
+      if (disc_cached_fingerprint != 0 &&
+          disc_cached_fingerprint != cache_entry.disc_fingerprint) {
+        // The leading tensor guard of this entry cannot match; skip the
+        // entry without running its guard set.
+        ++index;
+        continue;
+      }
+    }
     if (valid) {
       try {
         // TODO(anijain2305) - Clean this up when enable_cpp_guard_manager is
@@ -1458,6 +1458,10 @@ class GuardAccessor {
     return _accessor_key.equal(key);
   }
 
+  const py::object& get_accessor_key() const {
+    return _accessor_key;
+  }
+
   std::string get_source() {
     return _source;
   }
@@ -2390,6 +2394,14 @@ std::unique_ptr<GuardManager> make_guard_manager(
   return std::make_unique<GuardManager>(root, std::move(source));
 }
 
+// Packs the (dtype, rank) pair used as a cheap cache-entry discriminator by
+// extract_tensor_discriminator. The +1 on the rank keeps any valid
+// fingerprint from being 0, which is reserved for "unknown".
+static uint64_t pack_tensor_fingerprint(at::ScalarType dtype, int64_t dim) {
+  return (static_cast<uint64_t>(static_cast<uint8_t>(dtype)) << 32) |
+      (static_cast<uint64_t>(dim + 1) & 0xffffffff);
+}
+
 class TENSOR_MATCH : public LeafGuard {
  public:
   TENSOR_MATCH(
@@ -2464,6 +2476,16 @@ class TENSOR_MATCH : public LeafGuard {
     return GuardDebugInfo(true, 1);
   }
 
+  // Packed (dtype, rank) of the guarded tensor; a runtime value whose
+  // fingerprint differs can never pass this guard.
+  uint64_t discriminator_fingerprint() const {
+    if (!_tensor_check) {
+      return 0;
+    }
+    return pack_tensor_fingerprint(
+        _tensor_check->expected_dtype(), _tensor_check->expected_dim());
+  }
+
  private:
   std::string _tensor_name;
   std::unique_ptr<TensorCheck> _tensor_check;
@@ -3339,6 +3361,44 @@ bool run_root_guard_manager(void* root, PyObject* f_locals) {
   return ((RootGuardManager*)root)->check_nopybind(f_locals);
 }
 
+bool extract_tensor_discriminator(
+    void* root,
+    PyObject** out_local_name,
+    uint64_t* out_fingerprint) {
+  RootGuardManager* root_mgr = (RootGuardManager*)root;
+  for (GuardAccessor* accessor : root_mgr->get_accessors()) {
+    // Only root-level f_locals entries: DictGetItemGuardAccessor's key is the
+    // name of the local and its child manager guards the local's value.
+    auto* dict_accessor = dynamic_cast<DictGetItemGuardAccessor*>(accessor);
+    if (dict_accessor == nullptr) {
+      continue;
+    }
+    for (LeafGuard* guard :
+         dict_accessor->get_guard_manager()->get_leaf_guards()) {
+      auto* tensor_match = dynamic_cast<TENSOR_MATCH*>(guard);
+      if (tensor_match == nullptr) {
+        continue;
+      }
+      uint64_t fingerprint = tensor_match->discriminator_fingerprint();
+      if (fingerprint == 0) {
+        continue;
+      }
+      *out_local_name = dict_accessor->get_accessor_key().ptr();
+      *out_fingerprint = fingerprint;
+      return true;
+    }
+  }
+  return false;
+}
+
+uint64_t tensor_discriminator_fingerprint(PyObject* value) {
+  if (!THPVariable_CheckExact(value) && !THPVariable_Check(value)) {
+    return 0;
+  }
+  const at::Tensor& tensor = THPVariable_Unpack(value);
+  return pack_tensor_fingerprint(tensor.scalar_type(), tensor.dim());
+}
+
 PyObject* torch_c_dynamo_guards_init() {
   // initialize TensorGuardsType
   TensorGuardsType.tp_name = "torch._C._dynamo.guards.TensorGuards";
@@ -12,6 +12,23 @@ PyObject* torch_c_dynamo_guards_init();
 void* convert_to_root_guard_manager(py::object root);
 bool run_root_guard_manager(void* root, PyObject* f_locals);
 
+// Best-effort extraction of a cheap discriminator from a guard tree: the
+// f_locals key of the first root-level local guarded by TENSOR_MATCH, together
+// with a fingerprint of the guarded dtype and rank. The cache lookup in
+// extra_state.cpp uses this to skip cache entries whose leading tensor guard
+// cannot possibly match without running their full guard set. Returns false
+// (and leaves the outputs untouched) when the tree has no such guard.
+// out_local_name is a borrowed reference owned by the guard tree.
+bool extract_tensor_discriminator(
+    void* root,
+    PyObject** out_local_name,
+    uint64_t* out_fingerprint);
+
+// Fingerprint of a runtime value, comparable against the expected fingerprint
+// from extract_tensor_discriminator. Returns 0 ("unknown") when value is not
+// a tensor; 0 never compares equal to a valid fingerprint.
+uint64_t tensor_discriminator_fingerprint(PyObject* value);
+
 struct LocalState {
   // TLS state that changes operators
   c10::impl::LocalDispatchKeySet dispatch_modifier;
@@ -59,6 +76,13 @@ class TensorCheck {
       const at::Tensor& v,
       const std::string& tensor_name);
 
+  at::ScalarType expected_dtype() const {
+    return dtype_;
+  }
+  int64_t expected_dim() const {
+    return dim_;
+  }
+
   PyTypeObject* pytype;
 
  private:
@@ -316,6 +316,26 @@ struct InputBuffers : public std::unordered_map<Node*, InputBuffer> {
 static PyObject* the_autograd_compiler = nullptr;
 static PyObject* set_autograd_compiler(PyObject* dummy, PyObject* args);
 
+/* Default treatment of size inputs seen during capture.  STATIC specializes
+ * on exact sizes and marks an input dynamic only after observing it change,
+ * which costs one retrace per varying size.  DYNAMIC captures every size
+ * symbolically up front so a single compiled backward is reused across
+ * batch sizes without mid-training recompiles. */
+static SizeInput::DynType default_dyn_type = SizeInput::STATIC;
+
+static PyObject* set_default_dyn_type(PyObject* dummy, PyObject* args) {
+  HANDLE_TH_ERRORS;
+  int dynamic = 0;
+  if (!PyArg_ParseTuple(args, "p", &dynamic)) {
+    return nullptr;
+  }
+  PyObject* prior =
+      default_dyn_type == SizeInput::DYNAMIC ? Py_True : Py_False;
+  default_dyn_type = dynamic ? SizeInput::DYNAMIC : SizeInput::STATIC;
+  return Py_NewRef(prior);
+  END_HANDLE_TH_ERRORS;
+}
+
 static PyObject* clear_cache(PyObject* dummy, PyObject* args) {
   HANDLE_TH_ERRORS;
   CacheNode::root()->clear();
@@ -354,6 +374,7 @@ static PyMethodDef _methods[] = {
     {"clear_cache", clear_cache, METH_NOARGS, nullptr},
     {"is_cache_empty", is_cache_empty, METH_NOARGS, nullptr},
     {"set_verbose_logger", set_verbose_logger, METH_VARARGS, nullptr},
+    {"set_default_dyn_type", set_default_dyn_type, METH_VARARGS, nullptr},
     {nullptr, nullptr, 0, nullptr}};
 
 static struct PyModuleDef _module = {
@@ -422,6 +443,7 @@ CacheNode* _compiled_autograd_impl(
   std::unordered_map<Node*, int>& dependencies = graph_task.dependencies_;
   std::vector<std::shared_ptr<Node>> worklist{graph_root};
   AutogradCompilerCall compiler_call;
+  compiler_call.default_dyn_type = default_dyn_type;
 
   for (const auto i : c10::irange(output_edges.size())) {
     compiler_call.node_calls
@@ -488,6 +488,20 @@ void initFuncTorchBindings(PyObject* module) {
       "Set vmap fallback warnings");
   m.def("_set_vmap_fallback_enabled", &at::functorch::setVmapFallbackEnabled);
   m.def("_is_vmap_fallback_enabled", &at::functorch::isVmapFallbackEnabled);
+  m.def(
+      "_set_vmap_fallback_stats_enabled",
+      &at::functorch::setVmapFallbackStatsEnabled,
+      "Record per-op call counts and time spent in the vmap fallback");
+  m.def("_vmap_fallback_stats", []() {
+    // (operator name, calls, total nanoseconds), most expensive first
+    std::vector<std::tuple<std::string, int64_t, int64_t>> result;
+    for (const auto& stat : at::functorch::getVmapFallbackStats()) {
+      result.emplace_back(stat.op_name, stat.calls, stat.total_ns);
+    }
+    return result;
+  });
+  m.def(
+      "_reset_vmap_fallback_stats", &at::functorch::resetVmapFallbackStats);
   m.def(
       "set_inplace_requires_grad_allowed",
       &at::functorch::setInplaceRequiresGradAllowed);
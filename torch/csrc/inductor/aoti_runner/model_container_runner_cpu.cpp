@@ -13,7 +13,11 @@ AOTIModelContainerRunnerCpu::AOTIModelContainerRunnerCpu(
 AOTIModelContainerRunnerCpu::~AOTIModelContainerRunnerCpu() {}
 
 std::vector<at::Tensor> AOTIModelContainerRunnerCpu::run(
-    std::vector<at::Tensor>& inputs) {
+    std::vector<at::Tensor>& inputs,
+    AOTInductorStreamHandle cuda_stream_handle) {
+  TORCH_CHECK(
+      cuda_stream_handle == nullptr,
+      "AOTIModelContainerRunnerCpu does not accept a CUDA stream");
   return AOTIModelContainerRunner::run(inputs);
 }
 
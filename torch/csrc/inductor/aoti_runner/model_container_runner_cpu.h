@@ -10,9 +10,11 @@ class TORCH_API AOTIModelContainerRunnerCpu : public AOTIModelContainerRunner {
       const std::string& model_so_path,
       size_t num_models = 1);
 
-  ~AOTIModelContainerRunnerCpu();
+  ~AOTIModelContainerRunnerCpu() override;
 
-  std::vector<at::Tensor> run(std::vector<at::Tensor>& inputs);
+  std::vector<at::Tensor> run(
+      std::vector<at::Tensor>& inputs,
+      AOTInductorStreamHandle cuda_stream_handle = nullptr) override;
 };
 
 } // namespace torch::inductor
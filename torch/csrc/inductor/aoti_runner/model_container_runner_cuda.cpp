@@ -17,10 +17,14 @@ AOTIModelContainerRunnerCuda::AOTIModelContainerRunnerCuda(
 AOTIModelContainerRunnerCuda::~AOTIModelContainerRunnerCuda() {}
 
 std::vector<at::Tensor> AOTIModelContainerRunnerCuda::run(
-    std::vector<at::Tensor>& inputs) {
-  at::cuda::CUDAStream cuda_stream = c10::cuda::getCurrentCUDAStream();
-  return AOTIModelContainerRunner::run(
-      inputs, reinterpret_cast<AOTInductorStreamHandle>(cuda_stream.stream()));
+    std::vector<at::Tensor>& inputs,
+    AOTInductorStreamHandle cuda_stream_handle) {
+  if (cuda_stream_handle == nullptr) {
+    at::cuda::CUDAStream cuda_stream = c10::cuda::getCurrentCUDAStream();
+    cuda_stream_handle =
+        reinterpret_cast<AOTInductorStreamHandle>(cuda_stream.stream());
+  }
+  return AOTIModelContainerRunner::run(inputs, cuda_stream_handle);
 }
 
 std::vector<at::Tensor> AOTIModelContainerRunnerCuda::run_with_cuda_stream(
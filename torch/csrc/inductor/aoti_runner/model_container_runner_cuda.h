@@ -17,9 +17,12 @@ class TORCH_API AOTIModelContainerRunnerCuda : public AOTIModelContainerRunner {
       const std::string& device_str = "cuda",
       const std::string& cubin_dir = "");
 
-  ~AOTIModelContainerRunnerCuda();
+  ~AOTIModelContainerRunnerCuda() override;
 
-  std::vector<at::Tensor> run(std::vector<at::Tensor>& inputs);
+  // If no stream handle is given, the current CUDA stream is used.
+  std::vector<at::Tensor> run(
+      std::vector<at::Tensor>& inputs,
+      AOTInductorStreamHandle cuda_stream_handle = nullptr) override;
 
   std::vector<at::Tensor> run_with_cuda_stream(
       std::vector<at::Tensor>& inputs,
@@ -0,0 +1,68 @@
+#if !defined(C10_MOBILE) && !defined(ANDROID)
+#include <torch/csrc/inductor/aoti_runner/model_variants_runner.h>
+
+namespace torch::inductor {
+
+AOTIModelVariantsRunner::AOTIModelVariantsRunner(
+    std::map<int64_t, std::unique_ptr<AOTIModelContainerRunner>> variants,
+    int64_t shape_input_idx,
+    int64_t shape_dim)
+    : variants_(std::move(variants)),
+      shape_input_idx_(shape_input_idx),
+      shape_dim_(shape_dim) {
+  TORCH_CHECK(
+      !variants_.empty(), "AOTIModelVariantsRunner requires at least one variant");
+  for (const auto& variant : variants_) {
+    TORCH_CHECK(
+        variant.second != nullptr,
+        "null runner for bucket capacity ",
+        variant.first);
+  }
+}
+
+AOTIModelVariantsRunner::~AOTIModelVariantsRunner() = default;
+
+int64_t AOTIModelVariantsRunner::select_bucket(int64_t size) const {
+  auto it = variants_.lower_bound(size);
+  TORCH_CHECK(
+      it != variants_.end(),
+      "input selection dimension of size ",
+      size,
+      " exceeds the largest bucket capacity ",
+      variants_.rbegin()->first);
+  return it->first;
+}
+
+std::vector<at::Tensor> AOTIModelVariantsRunner::run(
+    std::vector<at::Tensor>& inputs,
+    AOTInductorStreamHandle cuda_stream_handle) {
+  TORCH_CHECK(
+      shape_input_idx_ >= 0 &&
+          static_cast<size_t>(shape_input_idx_) < inputs.size(),
+      "shape_input_idx ",
+      shape_input_idx_,
+      " out of range for ",
+      inputs.size(),
+      " inputs");
+  const int64_t size = inputs[shape_input_idx_].size(shape_dim_);
+  return variants_.at(select_bucket(size))->run(inputs, cuda_stream_handle);
+}
+
+void AOTIModelVariantsRunner::update_constant_buffer(
+    const TensorConstantMap& const_map,
+    bool use_inactive,
+    bool validate_full_updates) {
+  for (auto& variant : variants_) {
+    variant.second->update_constant_buffer(
+        const_map, use_inactive, validate_full_updates);
+  }
+}
+
+void AOTIModelVariantsRunner::swap_constant_buffer() {
+  for (auto& variant : variants_) {
+    variant.second->swap_constant_buffer();
+  }
+}
+
+} // namespace torch::inductor
+#endif
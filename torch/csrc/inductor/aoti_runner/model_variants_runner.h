@@ -0,0 +1,62 @@
+#if !defined(C10_MOBILE) && !defined(ANDROID)
+#pragma once
+
+#include <torch/csrc/inductor/aoti_runner/model_container_runner.h>
+
+#include <map>
+#include <memory>
+
+namespace torch::inductor {
+
+// NOTICE: Following APIs are subject to change due to active development
+// We provide NO BC guarantee for these APIs
+//
+// Serves one logical model compiled into several shape-specialized AOTI
+// variants (e.g. sequence-length buckets). run() reads the selection
+// dimension of one input and dispatches to the smallest bucket that fits
+// it, so callers hold a single runner instead of one per bucket. Weight
+// updates are broadcast to every variant, which lets all buckets bind the
+// same weight tensors instead of each variant keeping its own copy.
+class TORCH_API AOTIModelVariantsRunner {
+ public:
+  // @param variants: maps bucket capacity to the runner loaded from the .so
+  //     compiled for that bucket. The capacity is compared against
+  //     inputs[shape_input_idx].size(shape_dim) at run time.
+  AOTIModelVariantsRunner(
+      std::map<int64_t, std::unique_ptr<AOTIModelContainerRunner>> variants,
+      int64_t shape_input_idx = 0,
+      int64_t shape_dim = 0);
+
+  AOTIModelVariantsRunner() = delete;
+  AOTIModelVariantsRunner(const AOTIModelVariantsRunner& other) = delete;
+  AOTIModelVariantsRunner(AOTIModelVariantsRunner&& other) = delete;
+  AOTIModelVariantsRunner& operator=(const AOTIModelVariantsRunner& other) =
+      delete;
+  AOTIModelVariantsRunner& operator=(AOTIModelVariantsRunner&& other) = delete;
+  ~AOTIModelVariantsRunner();
+
+  // Runs the variant selected by the input shape. Throws if the selection
+  // dimension is larger than the largest bucket.
+  std::vector<at::Tensor> run(
+      std::vector<at::Tensor>& inputs,
+      AOTInductorStreamHandle cuda_stream_handle = nullptr);
+
+  // Returns the bucket capacity run() would pick for the given size.
+  int64_t select_bucket(int64_t size) const;
+
+  // Applies the same weight tensors to every variant; see
+  // AOTIModelContainerRunner::update_constant_buffer.
+  void update_constant_buffer(
+      const TensorConstantMap& const_map,
+      bool use_inactive,
+      bool validate_full_updates);
+  void swap_constant_buffer();
+
+ private:
+  std::map<int64_t, std::unique_ptr<AOTIModelContainerRunner>> variants_;
+  int64_t shape_input_idx_;
+  int64_t shape_dim_;
+};
+
+} // namespace torch::inductor
+#endif
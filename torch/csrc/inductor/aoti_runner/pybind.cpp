@@ -2,6 +2,9 @@
 #ifdef USE_CUDA
 #include <torch/csrc/inductor/aoti_runner/model_container_runner_cuda.h>
 #endif
+#include <torch/csrc/inductor/aoti_runner/model_variants_runner.h>
+
+#include <map>
 #include <torch/csrc/inductor/aoti_torch/tensor_converter.h>
 #include <torch/csrc/inductor/aoti_torch/utils.h>
 
@@ -15,7 +18,10 @@ void initAOTIRunnerBindings(PyObject* module) {
 
   py::class_<AOTIModelContainerRunnerCpu>(m, "AOTIModelContainerRunnerCpu")
       .def(py::init<const std::string&, int>())
-      .def("run", &AOTIModelContainerRunnerCpu::run)
+      .def(
+          "run",
+          [](AOTIModelContainerRunnerCpu& runner,
+             std::vector<at::Tensor>& inputs) { return runner.run(inputs); })
       .def("get_call_spec", &AOTIModelContainerRunnerCpu::get_call_spec)
       .def(
           "get_constant_names_to_original_fqns",
@@ -33,7 +39,10 @@ void initAOTIRunnerBindings(PyObject* module) {
            int,
            const std::string&,
            const std::string&>())
-      .def("run", &AOTIModelContainerRunnerCuda::run)
+      .def(
+          "run",
+          [](AOTIModelContainerRunnerCuda& runner,
+             std::vector<at::Tensor>& inputs) { return runner.run(inputs); })
       .def("get_call_spec", &AOTIModelContainerRunnerCuda::get_call_spec)
       .def(
           "get_constant_names_to_original_fqns",
@@ -43,6 +52,38 @@ void initAOTIRunnerBindings(PyObject* module) {
           &AOTIModelContainerRunnerCuda::getConstantNamesToDtypes);
 #endif
 
+  py::class_<AOTIModelVariantsRunner>(m, "AOTIModelVariantsRunner")
+      .def(py::init([](const std::map<int64_t, std::string>& variant_so_paths,
+                       const std::string& device_str,
+                       int64_t shape_input_idx,
+                       int64_t shape_dim) {
+        std::map<int64_t, std::unique_ptr<AOTIModelContainerRunner>> variants;
+        for (const auto& entry : variant_so_paths) {
+          if (device_str == "cpu") {
+            variants.emplace(
+                entry.first,
+                std::make_unique<AOTIModelContainerRunnerCpu>(entry.second));
+          } else {
+#ifdef USE_CUDA
+            variants.emplace(
+                entry.first,
+                std::make_unique<AOTIModelContainerRunnerCuda>(
+                    entry.second, 1, device_str));
+#else
+            TORCH_CHECK(
+                false, "AOTIModelVariantsRunner built without CUDA support");
+#endif
+          }
+        }
+        return std::make_unique<AOTIModelVariantsRunner>(
+            std::move(variants), shape_input_idx, shape_dim);
+      }))
+      .def(
+          "run",
+          [](AOTIModelVariantsRunner& runner,
+             std::vector<at::Tensor>& inputs) { return runner.run(inputs); })
+      .def("select_bucket", &AOTIModelVariantsRunner::select_bucket);
+
   m.def(
       "unsafe_alloc_void_ptrs_from_tensors",
       [](std::vector<at::Tensor>& tensors) {
@@ -183,7 +183,11 @@ class AOTInductorModelBase {
     return folded_constants;
   }
 
-  void load_constants() {
+  // When skip_copy is true the device blob handed in via set_constant_blob is
+  // assumed to already hold the weights (e.g. it is shared with another
+  // container created from this .so), so only the tensor handles over that
+  // memory are built and no host-to-device copy takes place.
+  void load_constants(bool skip_copy = false) {
     size_t num_constants = this->num_constants();
     constants_map_->reserve(num_constants);
 
@@ -192,7 +196,9 @@ class AOTInductorModelBase {
       size_t blob_size = 0;
       compute_cuda_constant_blob(blob_size, constants_internal_offset);
 #ifdef USE_CUDA
-      constant_blob_ = RAII_cudaMalloc(blob_size);
+      if (!constant_blob_) {
+        constant_blob_ = RAII_cudaMalloc(blob_size);
+      }
 #endif
     }
 
@@ -212,7 +218,7 @@ class AOTInductorModelBase {
                 constants_internal_offset[i],
                 bytes_read,
                 data_size,
-                from_folded)
+                from_folded || skip_copy)
           : nullptr;
       bytes_read += data_size;
 
@@ -266,8 +272,17 @@ class AOTInductorModelBase {
   }
 
 #ifdef USE_CUDA
-  CUDAPtr&& release_constant_blob() {
-    return std::move(constant_blob_);
+  // Hands the model the device blob its constants should live in. The blob
+  // may be owned elsewhere (the container passes a non-owning handle when the
+  // blob is shared across containers), so it must outlive this model.
+  void set_constant_blob(CUDAPtr&& blob) {
+    constant_blob_ = std::move(blob);
+  }
+
+  // Host-side start of the weights embedded in the .so. Exposed so the
+  // container's constant streaming mode can (re)upload segments on demand.
+  uint8_t* get_constants_start() {
+    return _get_constants_start();
   }
 #endif
 
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <algorithm>
+#include <cstdlib>
 #include <deque>
 #include <future>
 #include <mutex>
@@ -25,12 +26,40 @@ class AOTInductorModelContainer {
     constants_array_ = std::make_shared<std::vector<ConstantHandle>>();
     use_secondary_ = false;
     constant_folded_ = false;
+    // Run admission (opt-in via the AOTI_MAX_CONCURRENT_RUNS env var).
+    // Activations are allocated per run and released when the run has been
+    // submitted, so peak activation memory scales with the number of runs
+    // in flight, not with num_models or with caller threads. Capping
+    // admission keeps that peak at cap * per-run activations: the device
+    // caching allocator then serves every admitted run from the same set
+    // of recycled activation slabs. Admission is FIFO, so a burst of
+    // callers drains in arrival order instead of racing for model
+    // instances.
+    const char* max_runs_env = std::getenv("AOTI_MAX_CONCURRENT_RUNS");
+    max_concurrent_runs_ = max_runs_env != nullptr
+        ? static_cast<size_t>(std::strtoull(max_runs_env, nullptr, 10))
+        : 0;
     models_.reserve(num_models);
     available_models_.reserve(num_models);
-    for (size_t i = 0; i < num_models; ++i) {
-      models_.push_back(AOTInductorModel::Create(
-          constants_map_, constants_array_, device_str, cubin_dir));
-      available_models_.push_back(models_.back().get());
+    // Model instances only touch per-instance state until they are wired up
+    // to the shared constants map below, so they can be created concurrently.
+    // This matters for hosts that construct containers with many model
+    // instances, where serial creation dominates load time.
+    std::vector<std::future<std::unique_ptr<AOTInductorModel>>> create_futures;
+    create_futures.reserve(num_models > 1 ? num_models - 1 : 0);
+    for (size_t i = 1; i < num_models; ++i) {
+      create_futures.push_back(std::async(std::launch::async, [&] {
+        return AOTInductorModel::Create(
+            constants_map_, constants_array_, device_str, cubin_dir);
+      }));
+    }
+    models_.push_back(AOTInductorModel::Create(
+        constants_map_, constants_array_, device_str, cubin_dir));
+    for (auto& create_future : create_futures) {
+      models_.push_back(create_future.get());
+    }
+    for (auto& model : models_) {
+      available_models_.push_back(model.get());
     }
 
     // Note that the all following fields (input_names_, output_names,
@@ -54,11 +83,58 @@ class AOTInductorModelContainer {
       output_names_.push_back(model->output_name(i));
     }
 
-    model->load_constants();
 #ifdef USE_CUDA
-    constant_blob_ = model->release_constant_blob();
     constants_internal_offset_.resize(model->num_constants());
     model->compute_cuda_constant_blob(blob_size_, constants_internal_offset_);
+    // Constant streaming mode: when the configured device-memory budget is
+    // smaller than the weight blob, constants are not pinned for the
+    // container's lifetime. They live in segments that an LRU residency
+    // manager uploads on a side stream before a run and streams back out
+    // once runs complete, so hosts can serve more model bytes than fit in
+    // GPU memory at once.
+    const char* streaming_env = std::getenv("AOTI_CONSTANT_STREAMING_BUDGET");
+    streaming_budget_ = streaming_env != nullptr
+        ? static_cast<size_t>(std::strtoull(streaming_env, nullptr, 10))
+        : 0;
+    if (streaming_budget_ > 0 && streaming_budget_ < blob_size_) {
+      init_constant_streaming(model);
+      in_spec_ = model->get_in_spec();
+      out_spec_ = model->get_out_spec();
+      for (auto& model : models_) {
+        model->update_constants_map(
+            constants_map_, /* remap_constants_array= */ false);
+        model->update_constants_array(constants_array_);
+      }
+      return;
+    }
+    // Every container created from this .so embeds the same weight blob, so
+    // reuse the device copy a live sibling container has already uploaded to
+    // this device instead of paying another cudaMalloc plus host-to-device
+    // copy. The blob is copy-on-write: see prepare_constant_blob_for_update.
+    bool skip_weights_copy = false;
+    {
+      std::lock_guard lk(shared_constant_blob_mutex());
+      auto& registry = shared_constant_blob_registry();
+      auto it = registry.find(model->get_device_idx());
+      if (it != registry.end()) {
+        constant_blob_ = it->second.lock();
+      }
+      if (constant_blob_) {
+        skip_weights_copy = true;
+      } else {
+        constant_blob_ = std::shared_ptr<void>(
+            RAII_cudaMalloc(blob_size_).release(), [](void* ptr) {
+              AOTI_RUNTIME_DEVICE_CHECK(cudaFree(ptr));
+            });
+        registry[model->get_device_idx()] = constant_blob_;
+      }
+    }
+    // The container keeps (shared) ownership; the model gets a non-owning
+    // handle so release never frees memory a sibling container still uses.
+    model->set_constant_blob(CUDAPtr(constant_blob_.get(), [](void*) {}));
+    model->load_constants(skip_weights_copy);
+#else
+    model->load_constants();
 #endif
 
     for (auto& model : models_) {
@@ -69,6 +145,25 @@ class AOTInductorModelContainer {
     out_spec_ = model->get_out_spec();
   }
 
+#ifdef USE_CUDA
+  ~AOTInductorModelContainer() {
+    if (streaming_copy_stream_ != nullptr) {
+      auto code = cudaStreamDestroy(streaming_copy_stream_);
+      if (code != cudaSuccess) {
+        std::cerr << "Failed to destroy constant streaming copy stream: "
+                  << cudaGetErrorString(code) << std::endl;
+      }
+    }
+    if (streaming_upload_done_ != nullptr) {
+      auto code = cudaEventDestroy(streaming_upload_done_);
+      if (code != cudaSuccess) {
+        std::cerr << "Failed to destroy constant streaming upload event: "
+                  << cudaGetErrorString(code) << std::endl;
+      }
+    }
+  }
+#endif // USE_CUDA
+
   void run(
       AtenTensorHandle*
           input_handles, // array of input AtenTensorHandle; handles
@@ -79,9 +174,16 @@ class AOTInductorModelContainer {
                           // borrowed
       DeviceStreamType stream,
       AOTIProxyExecutorHandle proxy_executor) {
+    RunAdmission admission(this);
     std::shared_lock model_lk(model_exec_mutex_);
     auto* model = get_available_model();
 
+#ifdef USE_CUDA
+    if (constant_streaming_enabled_) {
+      stream_in_all_constants(stream);
+    }
+#endif
+
     if (!constant_folded_) {
       // At this point, constant is not ready yet. We need to call constant
       // folding before we execute the model. We obtain a unique lock at this
@@ -115,6 +217,12 @@ class AOTInductorModelContainer {
       pending_models_.push_back(model);
     }
     pending_models_available_.notify_one();
+
+#ifdef USE_CUDA
+    if (constant_streaming_enabled_) {
+      stream_out_constants_over_budget();
+    }
+#endif
   }
 
   size_t num_constants() const {
@@ -163,6 +271,12 @@ class AOTInductorModelContainer {
     std::shared_lock model_lk(model_exec_mutex_);
     auto* model = get_available_model();
 
+#ifdef USE_CUDA
+    if (constant_streaming_enabled_) {
+      stream_in_all_constants(stream);
+    }
+#endif
+
     if (!inactive_buffer) {
       // We would need to acquire a unique lock if we want to run constant
       // folding on the active buffer.
@@ -216,6 +330,12 @@ class AOTInductorModelContainer {
       pending_models_.push_back(model);
     }
     pending_models_available_.notify_one();
+
+#ifdef USE_CUDA
+    if (constant_streaming_enabled_) {
+      stream_out_constants_over_budget();
+    }
+#endif
   }
 
   bool _is_tensor_constant(const std::string& constant_name) const {
@@ -230,6 +350,13 @@ class AOTInductorModelContainer {
     if (this->num_models() == 0) {
       throw std::runtime_error("No model available in container!");
     }
+#ifdef USE_CUDA
+    if (constant_streaming_enabled_ && use_inactive) {
+      throw std::runtime_error(
+          "Updating the inactive constant buffer is not supported in "
+          "constant streaming mode!");
+    }
+#endif
     auto num_constants = models_[0]->num_constants();
 
     if (validate_full_update) {
@@ -273,12 +400,18 @@ class AOTInductorModelContainer {
       } else {
         tensor = it->second;
       }
-      auto* constants_blob_ptr =
-          static_cast<uint8_t*>(get_constant_blob_ptr(use_inactive));
-
-      // Move the data to container handled blob.
-      uint8_t* internal_constants_ptr =
-          constants_blob_ptr + constants_internal_offset_[idx];
+      // Move the data to container handled blob. In streaming mode the
+      // constant lives in its (now pinned) segment rather than in the
+      // monolithic blob.
+      uint8_t* internal_constants_ptr;
+      if (constant_streaming_enabled_) {
+        internal_constants_ptr = streaming_constant_ptr_for_update(idx);
+      } else {
+        auto* constants_blob_ptr =
+            static_cast<uint8_t*>(get_constant_blob_ptr(use_inactive));
+        internal_constants_ptr =
+            constants_blob_ptr + constants_internal_offset_[idx];
+      }
       void* user_constant_ptr;
       int64_t constant_size;
       aoti_torch_get_data_ptr(tensor, &user_constant_ptr);
@@ -386,10 +519,51 @@ class AOTInductorModelContainer {
   const char* out_spec_;
 
 #ifdef USE_CUDA
-  // Holds the blob storage for constants' at::Tensor for CUDA.
-  CUDAPtr constant_blob_;
+  // Holds the blob storage for constants' at::Tensor for CUDA. The primary
+  // blob may be shared with other containers created from this .so until the
+  // first in-place constant update; see prepare_constant_blob_for_update.
+  std::shared_ptr<void> constant_blob_;
   CUDAPtr constant_blob_secondary_;
 
+  // Primary blobs this container detached from on an in-place update.
+  // Constants that were not part of any update still hold tensors over these
+  // blobs, so they must stay alive for the container's lifetime.
+  std::vector<std::shared_ptr<void>> retained_constant_blobs_;
+
+  // Constant streaming (opt-in via the AOTI_CONSTANT_STREAMING_BUDGET env
+  // var, in bytes). Consecutive constants are grouped into fixed segments;
+  // every segment must be resident while a run executes, but once all
+  // submitted runs complete, least-recently-used segments are streamed out
+  // until the budget is met again, letting hosts keep many containers live
+  // on one device. Segments whose contents diverge from the weights embedded
+  // in the .so (folded or updated constants) are pinned since they cannot be
+  // re-read from it.
+  struct ConstantSegment {
+    size_t begin = 0; // first constant index in the segment
+    size_t end = 0; // one past the last constant index
+    size_t host_offset = 0; // offset of the first constant in the weight bin
+    size_t device_offset = 0; // offset of the segment in the blob layout
+    size_t bytes = 0; // aligned device size of the segment
+    CUDAPtr buffer; // device storage; empty while streamed out
+    uint64_t last_use = 0;
+    bool pinned = false;
+  };
+
+  bool constant_streaming_enabled_{false};
+  size_t streaming_budget_{0};
+  size_t streaming_resident_bytes_{0};
+  size_t streaming_inflight_runs_{0};
+  uint64_t streaming_tick_{0};
+  std::vector<ConstantSegment> streaming_segments_;
+  // Offset of each constant in the weight bin embedded in the .so.
+  std::vector<size_t> constants_host_offset_;
+  // Maps a constant index to the segment holding it.
+  std::vector<size_t> constant_segment_index_;
+  cudaStream_t streaming_copy_stream_{nullptr};
+  cudaEvent_t streaming_upload_done_{nullptr};
+  // Serializes residency changes; never held while a run executes.
+  std::mutex streaming_mutex_;
+
   // Let's place this within USE_CUDA at the moment before we fully support
   // update for CPU cases.
   size_t blob_size_;
@@ -432,6 +606,52 @@ class AOTInductorModelContainer {
   // Notified whenever a model is placed onto pending_models_.
   std::condition_variable pending_models_available_;
 
+  // Caps the number of runs in flight (0 means uncapped, i.e. bounded only
+  // by num_models). See the constructor comment on AOTI_MAX_CONCURRENT_RUNS.
+  size_t max_concurrent_runs_{0};
+  // Tickets make admission FIFO: a run may proceed once fewer than
+  // max_concurrent_runs_ earlier tickets are still in flight.
+  uint64_t next_run_ticket_{0};
+  uint64_t finished_run_tickets_{0};
+  std::mutex run_admission_mutex_;
+  std::condition_variable run_admitted_;
+
+  // Scopes one admitted run; the slot is given back even when the run
+  // throws, so a failed run cannot leak admission capacity.
+  class RunAdmission {
+   public:
+    explicit RunAdmission(AOTInductorModelContainer* container)
+        : container_(container) {
+      if (container_->max_concurrent_runs_ == 0) {
+        return;
+      }
+      std::unique_lock lk(container_->run_admission_mutex_);
+      uint64_t ticket = container_->next_run_ticket_++;
+      container_->run_admitted_.wait(lk, [&] {
+        return ticket <
+            container_->finished_run_tickets_ +
+            container_->max_concurrent_runs_;
+      });
+    }
+
+    ~RunAdmission() {
+      if (container_->max_concurrent_runs_ == 0) {
+        return;
+      }
+      {
+        std::lock_guard lk(container_->run_admission_mutex_);
+        container_->finished_run_tickets_++;
+      }
+      container_->run_admitted_.notify_all();
+    }
+
+    RunAdmission(const RunAdmission&) = delete;
+    RunAdmission& operator=(const RunAdmission&) = delete;
+
+   private:
+    AOTInductorModelContainer* container_;
+  };
+
   AOTInductorModel* get_available_model() {
     std::unique_lock lk(models_mutex_);
     if (available_models_.empty()) {
@@ -450,9 +670,218 @@ class AOTInductorModelContainer {
   std::shared_mutex model_exec_mutex_;
 
 #ifdef USE_CUDA
+  // Registry of the initial (unmutated) device weight uploads made by live
+  // containers, keyed by device index. The registry is per model .so since
+  // this header is compiled into each .so; entries are weak so a blob goes
+  // away with the last container using it.
+  static std::mutex& shared_constant_blob_mutex() {
+    static std::mutex mutex;
+    return mutex;
+  }
+
+  static std::unordered_map<int32_t, std::weak_ptr<void>>&
+  shared_constant_blob_registry() {
+    static std::unordered_map<int32_t, std::weak_ptr<void>> registry;
+    return registry;
+  }
+
+  // Called before writing into the active blob in place. The blob is about
+  // to diverge from the weights embedded in the .so, so stop offering it to
+  // future containers, and if other containers currently share it, detach
+  // onto a private copy so they do not observe the update.
+  void prepare_constant_blob_for_update() {
+    std::lock_guard lk(shared_constant_blob_mutex());
+    auto& registry = shared_constant_blob_registry();
+    auto it = registry.find(models_[0]->get_device_idx());
+    if (it != registry.end() && it->second.lock() == constant_blob_) {
+      registry.erase(it);
+    }
+    if (constant_blob_.use_count() > 1) {
+      auto private_blob = std::shared_ptr<void>(
+          RAII_cudaMalloc(blob_size_).release(),
+          [](void* ptr) { AOTI_RUNTIME_DEVICE_CHECK(cudaFree(ptr)); });
+      AOTI_RUNTIME_DEVICE_CHECK(cudaMemcpy(
+          private_blob.get(),
+          constant_blob_.get(),
+          blob_size_,
+          cudaMemcpyDeviceToDevice));
+      // Constants that are not part of the incoming update keep their tensors
+      // over the old blob; retain it so they stay valid even after the other
+      // containers sharing it go away.
+      retained_constant_blobs_.push_back(std::move(constant_blob_));
+      constant_blob_ = std::move(private_blob);
+    }
+  }
+
+  // Splits the constants into segments and sets up the side copy stream.
+  // Called from the constructor instead of load_constants; no weights are
+  // uploaded until the first run needs them.
+  void init_constant_streaming(AOTInductorModel* model) {
+    constant_streaming_enabled_ = true;
+    size_t num_constants = model->num_constants();
+    constants_host_offset_.resize(num_constants);
+    constant_segment_index_.resize(num_constants);
+    size_t bytes_read = 0;
+    for (size_t i = 0; i < num_constants; i++) {
+      constants_host_offset_[i] = bytes_read;
+      bytes_read += model->constant_data_size(i);
+    }
+    // Aim for several segments within the budget so eviction has granularity
+    // without degenerating into per-constant bookkeeping.
+    const size_t target_bytes =
+        std::max(streaming_budget_ / 8, static_cast<size_t>(1) << 20);
+    for (size_t i = 0; i < num_constants;) {
+      ConstantSegment segment;
+      segment.begin = i;
+      segment.device_offset = constants_internal_offset_[i];
+      segment.host_offset = constants_host_offset_[i];
+      size_t segment_end_offset = segment.device_offset;
+      while (i < num_constants) {
+        size_t aligned_end = i + 1 < num_constants
+            ? constants_internal_offset_[i + 1]
+            : blob_size_;
+        if (i > segment.begin &&
+            aligned_end - segment.device_offset > target_bytes) {
+          break;
+        }
+        segment.pinned = segment.pinned || model->constant_from_folded(i);
+        constant_segment_index_[i] = streaming_segments_.size();
+        segment_end_offset = aligned_end;
+        i++;
+      }
+      segment.end = i;
+      segment.bytes = segment_end_offset - segment.device_offset;
+      streaming_segments_.push_back(std::move(segment));
+    }
+    constants_map_->reserve(num_constants);
+    constants_array_->resize(num_constants);
+    AOTI_RUNTIME_DEVICE_CHECK(cudaStreamCreateWithFlags(
+        &streaming_copy_stream_, cudaStreamNonBlocking));
+    AOTI_RUNTIME_DEVICE_CHECK(cudaEventCreateWithFlags(
+        &streaming_upload_done_, cudaEventDisableTiming));
+  }
+
+  // Allocates a segment's device storage, enqueues its upload on the side
+  // copy stream, and rebuilds the constant tensors over the new memory.
+  // Folded constants have no source bytes in the weight bin; their segments
+  // are pinned, so they are only ever uploaded once, before folding runs.
+  void make_segment_resident(ConstantSegment& segment) {
+    auto* model = models_[0].get();
+    segment.buffer = RAII_cudaMalloc(segment.bytes);
+    streaming_resident_bytes_ += segment.bytes;
+    auto* buffer_ptr = static_cast<uint8_t*>(segment.buffer.get());
+    for (size_t i = segment.begin; i < segment.end; i++) {
+      size_t data_size = model->constant_data_size(i);
+      uint8_t* internal_ptr = data_size != 0
+          ? buffer_ptr + constants_internal_offset_[i] - segment.device_offset
+          : nullptr;
+      if (data_size != 0 && !model->constant_from_folded(i)) {
+        AOTI_RUNTIME_DEVICE_CHECK(cudaMemcpyAsync(
+            internal_ptr,
+            model->get_constants_start() + constants_host_offset_[i],
+            data_size,
+            cudaMemcpyHostToDevice,
+            streaming_copy_stream_));
+      }
+      AtenTensorHandle tensor_handle;
+      AOTI_TORCH_ERROR_CODE_CHECK(aoti_torch_create_tensor_from_blob(
+          internal_ptr,
+          model->constant_ndim(i),
+          model->constant_shape(i),
+          model->constant_stride(i),
+          model->constant_offset(i),
+          model->constant_dtype(i),
+          aoti_torch_device_type_cuda(),
+          model->get_device_idx(),
+          &tensor_handle));
+      std::string constant_name = model->constant_name(i);
+      constants_map_->insert_or_assign(std::move(constant_name), tensor_handle);
+      constants_array_->at(i) =
+          ConstantHandle(constants_map_->find(model->constant_name(i))->second);
+    }
+  }
+
+  // Brings every segment into device memory ahead of a run. Uploads are
+  // enqueued on the dedicated copy stream and the compute stream only waits
+  // on the completion event, so (re)uploads overlap with whatever work is
+  // already queued on the device.
+  void stream_in_all_constants(DeviceStreamType stream) {
+    std::lock_guard lk(streaming_mutex_);
+    streaming_inflight_runs_++;
+    streaming_tick_++;
+    bool uploaded = false;
+    for (auto& segment : streaming_segments_) {
+      segment.last_use = streaming_tick_;
+      if (segment.buffer) {
+        continue;
+      }
+      make_segment_resident(segment);
+      uploaded = true;
+    }
+    if (uploaded) {
+      AOTI_RUNTIME_DEVICE_CHECK(
+          cudaEventRecord(streaming_upload_done_, streaming_copy_stream_));
+      AOTI_RUNTIME_DEVICE_CHECK(
+          cudaStreamWaitEvent(stream, streaming_upload_done_, 0));
+    }
+  }
+
+  // Streams least-recently-used unpinned segments back out until the budget
+  // is met. A run needs all segments resident, so the budget is enforced
+  // between runs; the device synchronization makes sure no submitted run
+  // still reads the memory being released.
+  void stream_out_constants_over_budget() {
+    std::lock_guard lk(streaming_mutex_);
+    streaming_inflight_runs_--;
+    if (streaming_resident_bytes_ <= streaming_budget_ ||
+        streaming_inflight_runs_ > 0) {
+      return;
+    }
+    AOTI_RUNTIME_DEVICE_CHECK(cudaDeviceSynchronize());
+    while (streaming_resident_bytes_ > streaming_budget_) {
+      ConstantSegment* victim = nullptr;
+      for (auto& segment : streaming_segments_) {
+        if (!segment.buffer || segment.pinned) {
+          continue;
+        }
+        if (victim == nullptr || segment.last_use < victim->last_use) {
+          victim = &segment;
+        }
+      }
+      if (victim == nullptr) {
+        break; // everything still resident is pinned
+      }
+      for (size_t i = victim->begin; i < victim->end; i++) {
+        constants_map_->erase(models_[0]->constant_name(i));
+        constants_array_->at(i) = ConstantHandle();
+      }
+      victim->buffer.reset();
+      streaming_resident_bytes_ -= victim->bytes;
+    }
+  }
+
+  // Update path: the constant's segment must be resident before the caller
+  // copies the new bytes in, and once written it diverges from the weight
+  // bin, so the segment gets pinned.
+  uint8_t* streaming_constant_ptr_for_update(size_t idx) {
+    std::lock_guard lk(streaming_mutex_);
+    auto& segment = streaming_segments_[constant_segment_index_[idx]];
+    if (!segment.buffer) {
+      make_segment_resident(segment);
+      // The caller copies on the default stream; make sure the segment's
+      // own upload cannot race with it.
+      AOTI_RUNTIME_DEVICE_CHECK(cudaStreamSynchronize(streaming_copy_stream_));
+    }
+    segment.pinned = true;
+    segment.last_use = ++streaming_tick_;
+    return static_cast<uint8_t*>(segment.buffer.get()) +
+        constants_internal_offset_[idx] - segment.device_offset;
+  }
+
   void* get_constant_blob_ptr(bool get_inactive) {
     if ((get_inactive && use_secondary_) ||
         (!get_inactive && !use_secondary_)) {
+      prepare_constant_blob_for_update();
       return constant_blob_.get();
     } else {
       if (!constant_blob_secondary_) {
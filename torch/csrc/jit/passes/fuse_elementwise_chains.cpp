@@ -0,0 +1,211 @@
+#include <torch/csrc/jit/passes/fuse_elementwise_chains.h>
+
+#include <torch/csrc/jit/ir/constants.h>
+#include <torch/csrc/jit/ir/ir.h>
+#include <torch/csrc/jit/jit_log.h>
+#include <torch/csrc/jit/passes/dead_code_elimination.h>
+
+namespace torch {
+namespace jit {
+
+namespace {
+
+c10::optional<IValue> numericConstant(Value* v) {
+  if (v->node()->kind() != prim::Constant) {
+    return c10::nullopt;
+  }
+  auto iv = toIValue(v);
+  if (iv && (iv->isInt() || iv->isDouble())) {
+    return iv;
+  }
+  return c10::nullopt;
+}
+
+double asDouble(const IValue& iv) {
+  return iv.isInt() ? static_cast<double>(iv.toInt()) : iv.toDouble();
+}
+
+// Matches y = x + sign * c for aten::add/aten::sub with a constant scalar
+// and alpha == 1.
+bool matchAddSubScalar(Node* n, IValue& scalar, int64_t& sign) {
+  if (!n->matches(
+          "aten::add(Tensor self, Scalar other, Scalar alpha=1) -> Tensor") &&
+      !n->matches(
+          "aten::sub(Tensor self, Scalar other, Scalar alpha=1) -> Tensor")) {
+    return false;
+  }
+  auto alpha = numericConstant(n->input(2));
+  if (!alpha || asDouble(*alpha) != 1.0) {
+    return false;
+  }
+  auto c = numericConstant(n->input(1));
+  if (!c) {
+    return false;
+  }
+  scalar = *c;
+  sign = n->kind() == aten::sub ? -1 : 1;
+  return true;
+}
+
+bool matchMulScalar(Node* n, IValue& scalar) {
+  if (!n->matches("aten::mul(Tensor self, Scalar other) -> Tensor")) {
+    return false;
+  }
+  auto c = numericConstant(n->input(1));
+  if (!c) {
+    return false;
+  }
+  scalar = *c;
+  return true;
+}
+
+// Reads a clamp min/max argument. Returns false unless the argument is a
+// constant None or numeric scalar; `bound` is empty for None.
+bool clampBound(Value* v, c10::optional<IValue>& bound) {
+  if (v->node()->kind() != prim::Constant) {
+    return false;
+  }
+  auto iv = toIValue(v);
+  if (!iv) {
+    return false;
+  }
+  if (iv->isNone()) {
+    bound = c10::nullopt;
+    return true;
+  }
+  if (iv->isInt() || iv->isDouble()) {
+    bound = *iv;
+    return true;
+  }
+  return false;
+}
+
+// The chain can only be folded when the intermediate result has no other
+// consumer and lives in the same block as the outer op.
+bool singleUseSameBlock(Node* inner, Node* outer) {
+  return inner->owningBlock() == outer->owningBlock() &&
+      inner->output()->uses().size() == 1;
+}
+
+constexpr auto kClampSchema =
+    "aten::clamp(Tensor self, Scalar? min=None, Scalar? max=None) -> Tensor";
+constexpr auto kReluSchema = "aten::relu(Tensor self) -> Tensor";
+
+// Folds `outer` with its producer when both belong to the same scalar chain.
+// Rewrites `outer` in place to consume the chain head; the dead inner op is
+// left for DCE.
+bool tryFoldScalarChain(Node* outer, std::shared_ptr<Graph>& graph) {
+  IValue c2;
+  int64_t s2 = 0;
+  if (matchAddSubScalar(outer, c2, s2)) {
+    Node* inner = outer->input(0)->node();
+    IValue c1;
+    int64_t s1 = 0;
+    if (!matchAddSubScalar(inner, c1, s1) ||
+        !singleUseSameBlock(inner, outer)) {
+      return false;
+    }
+    // out = (x + s1*c1) + s2*c2 = x + net
+    IValue net = (c1.isInt() && c2.isInt())
+        ? IValue(s1 * c1.toInt() + s2 * c2.toInt())
+        : IValue(s1 * asDouble(c1) + s2 * asDouble(c2));
+    if (s2 < 0) {
+      // outer stays an aten::sub: out = x - (-net)
+      net = net.isInt() ? IValue(-net.toInt()) : IValue(-net.toDouble());
+    }
+    WithInsertionPoint guard(outer);
+    outer->replaceInput(0, inner->input(0));
+    outer->replaceInput(1, graph->insertConstant(net));
+    return true;
+  }
+
+  if (matchMulScalar(outer, c2)) {
+    Node* inner = outer->input(0)->node();
+    IValue c1;
+    if (!matchMulScalar(inner, c1) || !singleUseSameBlock(inner, outer)) {
+      return false;
+    }
+    IValue product = (c1.isInt() && c2.isInt())
+        ? IValue(c1.toInt() * c2.toInt())
+        : IValue(asDouble(c1) * asDouble(c2));
+    WithInsertionPoint guard(outer);
+    outer->replaceInput(0, inner->input(0));
+    outer->replaceInput(1, graph->insertConstant(product));
+    return true;
+  }
+
+  if (outer->matches(kClampSchema)) {
+    Node* inner = outer->input(0)->node();
+    if (!inner->matches(kClampSchema) || !singleUseSameBlock(inner, outer)) {
+      return false;
+    }
+    c10::optional<IValue> lo1, hi1, lo2, hi2;
+    if (!clampBound(inner->input(1), lo1) ||
+        !clampBound(inner->input(2), hi1) ||
+        !clampBound(outer->input(1), lo2) ||
+        !clampBound(outer->input(2), hi2)) {
+      return false;
+    }
+    auto mergedLo = !lo1 ? lo2
+        : !lo2           ? lo1
+        : asDouble(*lo1) >= asDouble(*lo2) ? lo1
+                                           : lo2;
+    auto mergedHi = !hi1 ? hi2
+        : !hi2           ? hi1
+        : asDouble(*hi1) <= asDouble(*hi2) ? hi1
+                                           : hi2;
+    if (mergedLo && mergedHi && asDouble(*mergedLo) > asDouble(*mergedHi)) {
+      // Sequential clamps with an empty merged range saturate to the inner
+      // upper bound, which a single clamp cannot express.
+      return false;
+    }
+    WithInsertionPoint guard(outer);
+    outer->replaceInput(0, inner->input(0));
+    outer->replaceInput(1, graph->insertConstant(mergedLo ? *mergedLo : IValue()));
+    outer->replaceInput(2, graph->insertConstant(mergedHi ? *mergedHi : IValue()));
+    return true;
+  }
+
+  return false;
+}
+
+bool fuseElementwiseChainsImpl(Block* block, std::shared_ptr<Graph>& graph) {
+  bool changed = false;
+  for (auto it = block->nodes().begin(); it != block->nodes().end();) {
+    Node* node = *it;
+    ++it;
+    for (Block* sub_block : node->blocks()) {
+      changed |= fuseElementwiseChainsImpl(sub_block, graph);
+    }
+    if (node->matches(kReluSchema) &&
+        node->input(0)->node()->matches(kReluSchema)) {
+      node->output()->replaceAllUsesWith(node->input(0));
+      node->destroy();
+      changed = true;
+      continue;
+    }
+    changed |= tryFoldScalarChain(node, graph);
+  }
+  return changed;
+}
+
+} // namespace
+
+void FuseElementwiseChains(std::shared_ptr<Graph>& graph) {
+  // Nodes are visited in topological order, so a chain of N ops collapses
+  // onto its head in a single walk.
+  if (fuseElementwiseChainsImpl(graph->block(), graph)) {
+    EliminateDeadCode(graph);
+  }
+  GRAPH_DUMP("After FuseElementwiseChains: ", graph);
+}
+
+void FuseElementwiseChains(script::Module& module) {
+  for (const auto& method : module.get_methods()) {
+    auto graph = method.graph();
+    FuseElementwiseChains(graph);
+  }
+}
+
+} // namespace jit
+} // namespace torch
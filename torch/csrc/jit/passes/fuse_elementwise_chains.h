@@ -0,0 +1,24 @@
+#pragma once
+
+#include <torch/csrc/jit/api/module.h>
+#include <torch/csrc/jit/ir/ir.h>
+
+namespace torch {
+namespace jit {
+
+// Collapses chains of scalar elementwise ops at export time so the mobile
+// interpreter dispatches one op where the scripted model had several:
+//   - consecutive aten::add/aten::sub with constant scalars (alpha == 1)
+//     fold into a single op with the accumulated offset
+//   - consecutive aten::mul with constant scalars fold into one mul
+//   - nested aten::clamp merge when the merged range is non-empty
+//   - aten::relu of aten::relu drops the redundant op
+// Constant arithmetic is folded at export time, which can reassociate
+// floating point scalars; results match a hand-fused preprocessing loop
+// rather than the op-by-op chain bit for bit. Opt out with the
+// FUSE_ELEMENTWISE_CHAINS entry of the optimize_for_mobile blocklist.
+TORCH_API void FuseElementwiseChains(script::Module& module);
+TORCH_API void FuseElementwiseChains(std::shared_ptr<Graph>& graph);
+
+} // namespace jit
+} // namespace torch
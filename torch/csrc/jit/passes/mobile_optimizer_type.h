@@ -10,4 +10,5 @@ enum class MobileOptimizerType : int8_t {
   HOIST_CONV_PACKED_PARAMS,
   CONV_1D_TO_2D,
   VULKAN_AUTOMATIC_GPU_TRANSFER,
+  FUSE_ELEMENTWISE_CHAINS,
 };
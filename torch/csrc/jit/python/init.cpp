@@ -42,6 +42,7 @@
 #include <torch/csrc/jit/passes/frozen_linear_folding.h>
 #include <torch/csrc/jit/passes/frozen_linear_transpose.h>
 #include <torch/csrc/jit/passes/frozen_ops_to_mkldnn.h>
+#include <torch/csrc/jit/passes/fuse_elementwise_chains.h>
 #include <torch/csrc/jit/passes/fuse_linear.h>
 #include <torch/csrc/jit/passes/fuse_relu.h>
 #include <torch/csrc/jit/passes/graph_fuser.h>
@@ -429,6 +430,11 @@ void initJITBindings(PyObject* module) {
       .def(
           "_jit_pass_fuse_add_relu",
           [](std::shared_ptr<Graph>& graph) { FuseAddRelu(graph); })
+      .def(
+          "_jit_pass_fuse_elementwise_chains",
+          [](std::shared_ptr<Graph>& graph) {
+            FuseElementwiseChains(graph);
+          })
       .def("_jit_pass_dedup_module_uses", &DedupModuleUses)
       .def("_jit_pass_replicate_dequantize", &ReplicateDeQuant)
       .def(
@@ -1385,6 +1391,11 @@ void initJITBindings(PyObject* module) {
       .def_property_readonly(
           "fallback", [](GraphExecutorState& s) { return s.fallback; });
 
+  py::enum_<caffe2::serialize::CompressionMethod>(m, "FileWriterCompression")
+      .value("STORED", caffe2::serialize::CompressionMethod::Stored)
+      .value("DEFLATE_FAST", caffe2::serialize::CompressionMethod::DeflateFast)
+      .value("DEFLATE", caffe2::serialize::CompressionMethod::Deflate);
+
   py::class_<PyTorchStreamWriter>(m, "PyTorchFileWriter")
       .def(py::init<std::string>())
       .def(py::init([](const py::object& buffer) {
@@ -1448,6 +1459,17 @@ void initJITBindings(PyObject* module) {
             py::gil_scoped_release release;
             return self.writeRecord(name, data_str, size);
           })
+      .def(
+          "write_record",
+          [](PyTorchStreamWriter& self,
+             const std::string& name,
+             py::bytes data,
+             size_t size,
+             caffe2::serialize::CompressionMethod method) {
+            const char* data_str = PyBytes_AsString(data.ptr());
+            py::gil_scoped_release release;
+            return self.writeRecord(name, data_str, size, method);
+          })
       .def(
           "write_record",
           [](PyTorchStreamWriter& self,
@@ -1459,6 +1481,20 @@ void initJITBindings(PyObject* module) {
             return self.writeRecord(
                 name, reinterpret_cast<const char*>(data.data()), size);
           })
+      .def(
+          "write_record",
+          [](PyTorchStreamWriter& self,
+             const std::string& name,
+             c10::Storage data,
+             size_t size,
+             caffe2::serialize::CompressionMethod method) {
+            py::gil_scoped_release release;
+            return self.writeRecord(
+                name,
+                reinterpret_cast<const char*>(data.data()),
+                size,
+                method);
+          })
       .def(
           "write_record",
           [](PyTorchStreamWriter& self,
@@ -1491,7 +1527,10 @@ void initJITBindings(PyObject* module) {
           MobileOptimizerType::HOIST_CONV_PACKED_PARAMS)
       .value(
           "VULKAN_AUTOMATIC_GPU_TRANSFER",
-          MobileOptimizerType::VULKAN_AUTOMATIC_GPU_TRANSFER);
+          MobileOptimizerType::VULKAN_AUTOMATIC_GPU_TRANSFER)
+      .value(
+          "FUSE_ELEMENTWISE_CHAINS",
+          MobileOptimizerType::FUSE_ELEMENTWISE_CHAINS);
 
   // This allows PyTorchStreamReader to read from a Python buffer. It requires
   // that the buffer implement `seek()`, `tell()`, and `read()`.
@@ -1523,6 +1523,27 @@ void initJitScriptBindings(PyObject* module) {
                 .get_executor()
                 .debugFlushCompilationCache();
           })
+      .def(
+          "_export_optimized_plan",
+          [](const StrongFunctionPtr& self) {
+            return toGraphFunction(*self.function_)
+                .get_executor()
+                .exportOptimizedPlan();
+          })
+      .def(
+          "_import_optimized_plan",
+          [](const StrongFunctionPtr& self, const std::string& serialized) {
+            return toGraphFunction(*self.function_)
+                .get_executor()
+                .importOptimizedPlan(serialized);
+          })
+      .def(
+          "_seal_optimized_plan",
+          [](const StrongFunctionPtr& self) {
+            return toGraphFunction(*self.function_)
+                .get_executor()
+                .sealOptimizedPlan();
+          })
       .def_property_readonly(
           "name",
           [](const StrongFunctionPtr& self) { return self.function_->name(); })
@@ -1584,6 +1605,19 @@ void initJitScriptBindings(PyObject* module) {
           [](Method& self) {
             return self.get_executor().debugFlushCompilationCache();
           })
+      .def(
+          "_export_optimized_plan",
+          [](Method& self) {
+            return self.get_executor().exportOptimizedPlan();
+          })
+      .def(
+          "_import_optimized_plan",
+          [](Method& self, const std::string& serialized) {
+            return self.get_executor().importOptimizedPlan(serialized);
+          })
+      .def(
+          "_seal_optimized_plan",
+          [](Method& self) { return self.get_executor().sealOptimizedPlan(); })
       .def_property_readonly(
           "code_with_constants",
           [](Method& self) {
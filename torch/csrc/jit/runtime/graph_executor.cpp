@@ -856,6 +856,30 @@ void GraphExecutor::debugFlushCompilationCache() {
   }
 }
 
+std::string GraphExecutor::exportOptimizedPlan() {
+  if (auto ppImpl =
+          std::dynamic_pointer_cast<ProfilingGraphExecutorImpl>(pImpl)) {
+    return ppImpl->exportOptimizedPlan();
+  }
+  return std::string();
+}
+
+bool GraphExecutor::importOptimizedPlan(const std::string& serialized_graph) {
+  if (auto ppImpl =
+          std::dynamic_pointer_cast<ProfilingGraphExecutorImpl>(pImpl)) {
+    return ppImpl->importOptimizedPlan(serialized_graph);
+  }
+  return false;
+}
+
+bool GraphExecutor::sealOptimizedPlan() {
+  if (auto ppImpl =
+          std::dynamic_pointer_cast<ProfilingGraphExecutorImpl>(pImpl)) {
+    return ppImpl->sealOptimizedPlan();
+  }
+  return false;
+}
+
 bool GraphExecutor::isOptimized() const {
   return pImpl && pImpl->isOptimized();
 }
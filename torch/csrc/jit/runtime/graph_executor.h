@@ -92,6 +92,20 @@ struct TORCH_API GraphExecutor {
 
   void debugFlushCompilationCache();
 
+  // Persistence hooks for the profiling executor: export the steady-state
+  // optimized plan as serialized IR and re-install it on a fresh executor
+  // for the same graph so it can skip profiling warmup. Export returns an
+  // empty string (and import returns false) when the plan can't round-trip
+  // through the IR parser or the legacy executor is in use.
+  std::string exportOptimizedPlan();
+  bool importOptimizedPlan(const std::string& serialized_graph);
+
+  // Seals the optimized plan for fixed-shape serving: guard nodes are
+  // stripped from the plan and inputs are checked once at entry instead,
+  // raising on mismatch rather than deoptimizing. Returns false when there
+  // is no optimized plan yet or it can't be sealed. Profiling executor only.
+  bool sealOptimizedPlan();
+
   bool isOptimized() const;
 
  private:
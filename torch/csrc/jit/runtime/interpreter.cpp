@@ -449,10 +449,10 @@ struct InterpreterStateImpl : c10::intrusive_ptr_target {
           }
           case INST(INTERFACE_CALL): {
             auto _ = instGuard();
-            // note the hash table lookup to find the function
-            // this can be more optimized if necessary, caching parts
-            // of the hashing computation or storing the offset when
-            // the object is turned into an interface
+            // the call site's monomorphic cache skips the string-keyed
+            // method lookup when the receiver class matches the last one
+            // seen at this pc (the common case for interface calls in a
+            // loop or across invocations)
 
             // consider passing
             // `frames.back().function->remaining_bailout_depth_` into
@@ -461,12 +461,10 @@ struct InterpreterStateImpl : c10::intrusive_ptr_target {
             // reduce the number of compilations for too dynamic callers we
             // might miss opportunities where a caller is dynamic but a callee
             // gets stable arguments
-            Function& function =
-                peek(stack, 0, inst.N)
-                    .toObject()
-                    ->type()
-                    ->getMethod(
-                        frame.function->constant_table_[inst.X].toStringRef());
+            Function& function = frame.function->interfaceCallTarget(
+                frame.pc,
+                peek(stack, 0, inst.N).toObject()->type(),
+                frame.function->constant_table_[inst.X].toStringRef());
             callFunction(function, stack);
             continue;
           }
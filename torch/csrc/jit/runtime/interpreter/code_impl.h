@@ -1,6 +1,8 @@
 #pragma once
 
+#include <atomic>
 #include <memory>
+#include <mutex>
 #include <unordered_map>
 #include <vector>
 
@@ -93,6 +95,22 @@ struct CodeImpl {
       std::function<size_t(const std::pair<std::string, int>& p)>>
       operator_table_inv_;
   std::vector<Function*> function_table_;
+  // Monomorphic inline caches for INTERFACE_CALL sites, indexed by pc. Each
+  // site remembers the first receiver class and its resolved method so the
+  // hot path skips the string-keyed method lookup; other receiver classes
+  // at the same site fall back to the lookup. Entries are immutable
+  // once published and owned by interface_call_cache_owner_ (which also
+  // keeps the receiver type alive), so concurrent readers never observe a
+  // torn entry.
+  struct InterfaceCallCacheEntry {
+    c10::ClassTypePtr type;
+    Function* function;
+  };
+  std::vector<std::atomic<const InterfaceCallCacheEntry*>>
+      interface_call_caches_;
+  std::vector<std::unique_ptr<InterfaceCallCacheEntry>>
+      interface_call_cache_owner_;
+  std::mutex interface_call_cache_mutex_;
   std::vector<std::unique_ptr<GraphFunction>> forked_functions_;
   std::vector<std::unique_ptr<GraphFunction>> awaited_functions_;
   std::vector<TypePtr> type_table_;
@@ -172,6 +190,7 @@ struct CodeImpl {
     if (emit_instructions) {
       // NOLINTNEXTLINE(clang-analyzer-optin.cplusplus.VirtualCall)
       run();
+      initInterfaceCallCaches();
     }
   }
 
@@ -216,6 +235,64 @@ struct CodeImpl {
     return instructions_;
   }
 
+  // Called once the instruction stream is final; allocates one cache slot
+  // per instruction when the code contains any INTERFACE_CALL (bailout
+  // blocks may move call sites, so the slots are keyed by final pc).
+  void initInterfaceCallCaches() {
+    bool has_interface_call = false;
+    for (const auto& instruction : instructions_) {
+      if (instruction.op == INTERFACE_CALL) {
+        has_interface_call = true;
+        break;
+      }
+    }
+    if (!has_interface_call) {
+      return;
+    }
+    interface_call_caches_ =
+        std::vector<std::atomic<const InterfaceCallCacheEntry*>>(
+            instructions_.size());
+    for (auto& slot : interface_call_caches_) {
+      slot.store(nullptr, std::memory_order_relaxed);
+    }
+  }
+
+  // Resolves the target of the INTERFACE_CALL at `pc` for a receiver of
+  // class `type`, consulting the per-site monomorphic cache before falling
+  // back to the string-keyed method lookup.
+  Function& interfaceCallTarget(
+      size_t pc,
+      c10::ClassTypePtr type,
+      const std::string& method_name) {
+    if (C10_UNLIKELY(pc >= interface_call_caches_.size())) {
+      return type->getMethod(method_name);
+    }
+    std::atomic<const InterfaceCallCacheEntry*>& slot =
+        interface_call_caches_[pc];
+    const InterfaceCallCacheEntry* entry =
+        slot.load(std::memory_order_acquire);
+    if (entry != nullptr && entry->type.get() == type.get()) {
+      return *entry->function;
+    }
+    Function& function = type->getMethod(method_name);
+    // Publish at most one entry per site: the first receiver class wins and
+    // later mismatches (a polymorphic site) take the lookup above without
+    // touching the slot, so retention stays bounded at one entry per pc.
+    if (entry == nullptr) {
+      auto new_entry = std::make_unique<InterfaceCallCacheEntry>();
+      new_entry->function = &function;
+      new_entry->type = std::move(type);
+      std::lock_guard<std::mutex> guard(interface_call_cache_mutex_);
+      if (slot.load(std::memory_order_relaxed) == nullptr) {
+        interface_call_cache_owner_.emplace_back(std::move(new_entry));
+        slot.store(
+            interface_call_cache_owner_.back().get(),
+            std::memory_order_release);
+      }
+    }
+    return function;
+  }
+
   const std::unordered_map<std::string, size_t>& op_to_num_specified_args()
       const {
     return op_to_num_specified_args_;
@@ -952,6 +1029,7 @@ struct MobileCodeImpl : CodeImpl {
         emit_promoted_ops_(emit_promoted_ops) {
     // NOLINTNEXTLINE(clang-analyzer-optin.cplusplus.VirtualCall)
     run();
+    initInterfaceCallCaches();
   }
 
   void run() override {
@@ -2,6 +2,7 @@
 
 #include <c10/util/Optional.h>
 #include <c10/util/irange.h>
+#include <torch/csrc/jit/ir/irparser.h>
 #include <torch/csrc/jit/jit_log.h>
 #include <torch/csrc/jit/passes/add_if_then_else.h>
 #include <torch/csrc/jit/passes/bailout_graph.h>
@@ -706,6 +707,9 @@ const ExecutionPlan& ProfilingGraphExecutorImpl::getPlanFor(
   // IMPORTANT: This is a hot path of calling a torchscript function. Try not to
   // add any code above this.
   if (optimized_plan_) {
+    if (C10_UNLIKELY(sealed_)) {
+      checkSealedInputs(stack);
+    }
     if (FLAGS_torch_jit_release_profiling_graph_after_optimization &&
         !is_graph_extra_memory_released_) {
       int32_t now = getNowInSecs();
@@ -813,12 +817,161 @@ void ProfilingGraphExecutorImpl::debugFlushCompilationCache() {
   // prevent memory leaks
   fallback_functions_.clear();
   remaining_bailout_depth_.reset();
+  sealed_ = false;
+  sealed_input_types_.clear();
   // TODO - would be nice to have it initialized in subsequent use
   fusion_strategy_ = getFusionStrategy();
   time_optimized_plan_created_ = 0;
   is_graph_extra_memory_released_ = false;
 }
 
+std::string ProfilingGraphExecutorImpl::exportOptimizedPlan() {
+  std::lock_guard<std::mutex> lock(compile_mutex);
+  if (!optimized_plan_) {
+    return std::string();
+  }
+  auto serialized = optimized_plan_->graph->toString();
+  // Plans that call fallback functions (inserted for tensorexpr fusion
+  // groups and by specialize_autogradzero) hold FunctionType constants that
+  // don't round-trip through the IR parser. Validate here so callers only
+  // ever persist plans we can later re-install.
+  try {
+    auto parsed = std::make_shared<Graph>();
+    parseIR(serialized, parsed.get());
+    ExecutionPlan validation{parsed, function_name_};
+  } catch (const std::exception& e) {
+    GRAPH_DEBUG("optimized plan doesn't round-trip: ", e.what());
+    return std::string();
+  }
+  return serialized;
+}
+
+bool ProfilingGraphExecutorImpl::importOptimizedPlan(
+    const std::string& serialized_graph) {
+  std::lock_guard<std::mutex> lock(compile_mutex);
+  // Only seed an executor that hasn't started profiling; otherwise the
+  // in-flight profiling state would disagree with the imported plan.
+  if (optimized_plan_ || pr_ || serialized_graph.empty()) {
+    return false;
+  }
+  try {
+    auto parsed = std::make_shared<Graph>();
+    parseIR(serialized_graph, parsed.get());
+    optimized_plan_ = ExecutionPlan(parsed, function_name_);
+  } catch (const std::exception& e) {
+    GRAPH_DEBUG("failed to import optimized plan: ", e.what());
+    return false;
+  }
+  time_optimized_plan_created_ = getNowInSecs();
+  return true;
+}
+
+namespace {
+
+void gatherGuardNodes(
+    Block* block,
+    std::vector<Node*>& checks,
+    bool& has_unsealable_guard) {
+  for (Node* n : block->nodes()) {
+    if (n->kind() == prim::TypeCheck ||
+        n->kind() == prim::RequiresGradCheck) {
+      checks.push_back(n);
+    } else if (n->kind() == prim::BailOut || n->kind() == prim::Guard) {
+      has_unsealable_guard = true;
+    }
+    for (Block* ib : n->blocks()) {
+      gatherGuardNodes(ib, checks, has_unsealable_guard);
+    }
+  }
+}
+
+} // namespace
+
+bool ProfilingGraphExecutorImpl::sealOptimizedPlan() {
+  std::lock_guard<std::mutex> lock(compile_mutex);
+  if (sealed_) {
+    return true;
+  }
+  if (!optimized_plan_) {
+    return false;
+  }
+  auto copy = optimized_plan_->graph->copy();
+
+  std::vector<Node*> checks;
+  bool has_unsealable_guard = false;
+  gatherGuardNodes(copy->block(), checks, has_unsealable_guard);
+  if (has_unsealable_guard) {
+    GRAPH_DEBUG("plan has legacy bailout guards; not sealing");
+    return false;
+  }
+
+  std::unordered_map<Value*, size_t> input_index;
+  for (const auto i : c10::irange(copy->inputs().size())) {
+    input_index.emplace(copy->inputs()[i], i);
+  }
+  std::vector<c10::TensorTypePtr> input_types(copy->inputs().size(), nullptr);
+
+  // Each check node passes its inputs through and appends a Bool; assume
+  // every guard holds: forward the inputs, constant-fold the Bool to True
+  // and let constant propagation drop the fallback branches. Guards on
+  // graph inputs become the entry check; guards on interior values are
+  // implied by them for a fixed-shape workload, which is the contract of
+  // sealing.
+  WithInsertPoint insert_point(*copy->block()->nodes().begin());
+  Value* true_constant = copy->insertConstant(true);
+  for (Node* n : checks) {
+    for (const auto i : c10::irange(n->inputs().size())) {
+      Value* in = n->input(i);
+      Value* out = n->output(i);
+      auto it = input_index.find(in);
+      if (it != input_index.end()) {
+        if (auto guarded_type = out->type()->cast<TensorType>()) {
+          input_types[it->second] = guarded_type;
+        }
+      }
+      out->replaceAllUsesWith(in);
+    }
+    n->output(n->outputs().size() - 1)->replaceAllUsesWith(true_constant);
+    n->destroy();
+  }
+  ConstantPropagation(copy);
+  EliminateDeadCode(copy);
+  GRAPH_DUMP("Sealed Graph: ", copy);
+
+  sealed_input_types_ = std::move(input_types);
+  optimized_plan_ = ExecutionPlan(copy, function_name_);
+  sealed_ = true;
+  return true;
+}
+
+void ProfilingGraphExecutorImpl::checkSealedInputs(const Stack& stack) const {
+  const size_t num_inputs = sealed_input_types_.size();
+  TORCH_CHECK(
+      stack.size() >= num_inputs,
+      "Sealed function ",
+      function_name_,
+      " expected ",
+      num_inputs,
+      " inputs but received ",
+      stack.size());
+  const size_t offset = stack.size() - num_inputs;
+  for (const auto i : c10::irange(num_inputs)) {
+    const auto& expected = sealed_input_types_[i];
+    if (expected == nullptr) {
+      continue;
+    }
+    const IValue& input = stack[offset + i];
+    TORCH_CHECK(
+        input.isTensor() && expected->matchTensor(input.toTensor()),
+        "Sealed function ",
+        function_name_,
+        " received input ",
+        i,
+        " that does not match the sealed plan; expected ",
+        expected->repr_str());
+  }
+}
+
 void ProfilingGraphExecutorImpl::clearTheGraphCompilationIntermediateGraphs() {
   is_graph_extra_memory_released_ = true;
   profiling_plan_.reset();
@@ -24,6 +24,26 @@ struct TORCH_API ProfilingGraphExecutorImpl : public GraphExecutorImplBase {
 
   void debugFlushCompilationCache();
 
+  // Serializes the steady-state optimized plan so a freshly constructed
+  // executor for the same graph can skip profiling warmup. Plans whose
+  // optimized graph doesn't round-trip through the IR parser (e.g. ones
+  // calling fallback functions inserted for tensorexpr fusion groups) can't
+  // be exported; an empty string is returned in that case.
+  std::string exportOptimizedPlan();
+  // Installs a plan previously produced by exportOptimizedPlan(). Only valid
+  // on an executor that hasn't started profiling yet; returns false if the
+  // plan couldn't be installed.
+  bool importOptimizedPlan(const std::string& serialized_graph);
+
+  // Seals the steady-state optimized plan for fixed-shape serving: strips
+  // the prim::TypeCheck / prim::RequiresGradCheck guards (and with them the
+  // fallback branches) from the optimized graph and instead validates each
+  // call's tensor inputs once at entry against the guarded input types.
+  // Inputs that don't match the sealed plan raise instead of deoptimizing.
+  // Returns false when there is no optimized plan yet or the plan can't be
+  // sealed (e.g. legacy prim::BailOut guards are present).
+  bool sealOptimizedPlan();
+
   bool isOptimized() const override {
     return optimized_plan_.has_value();
   }
@@ -43,6 +63,7 @@ struct TORCH_API ProfilingGraphExecutorImpl : public GraphExecutorImplBase {
       std::shared_ptr<Graph>& graph,
       size_t remaining_bailout_depth);
   void runFinalOptimizations(std::shared_ptr<Graph>& graph);
+  void checkSealedInputs(const Stack& stack) const;
 
   void clearTheGraphCompilationIntermediateGraphs();
 
@@ -64,6 +85,11 @@ struct TORCH_API ProfilingGraphExecutorImpl : public GraphExecutorImplBase {
   // of the GraphExecutor and only shared with InterpreterState
   std::vector<std::unique_ptr<Function>> fallback_functions_;
   std::optional<size_t> remaining_bailout_depth_;
+  // Sealed-mode state; see sealOptimizedPlan(). sealed_input_types_ holds,
+  // per graph input, the guarded type to verify at entry (nullptr for
+  // inputs no stripped guard specialized on).
+  bool sealed_ = false;
+  std::vector<c10::TensorTypePtr> sealed_input_types_;
   // The time the optimized_plan_ is created.
   int32_t time_optimized_plan_created_ = 0;
   // Has the extra memory used by the graph for profiling is released?
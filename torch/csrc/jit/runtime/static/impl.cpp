@@ -296,7 +296,9 @@ std::pair<std::shared_ptr<Graph>, std::optional<Module>> PrepareForStaticModule(
             << opts.manage_output_tensors << ", use_copy_variants "
             << opts.use_copy_variants << ", use_maybe_copy_variants "
             << opts.use_maybe_copy_variants << ", enable_tensorexpr_fusion "
-            << opts.enable_tensorexpr_fusion;
+            << opts.enable_tensorexpr_fusion
+            << ", bucketize_managed_storage_sizes "
+            << opts.bucketize_managed_storage_sizes;
 
   Module module = m.copy();
   if (!is_frozen) {
@@ -565,6 +567,17 @@ StaticModule::StaticModule(
         opts_.enable_out_variant,
         "When optimize_memory is true, enable_out_variant must be set to true");
   }
+  if (opts_.bucketize_managed_storage_sizes) {
+    TORCH_CHECK(
+        opts_.enable_out_variant,
+        "When bucketize_managed_storage_sizes is true, enable_out_variant must be set to true");
+  }
+  if (opts_.share_activation_arena) {
+    TORCH_CHECK(
+        opts_.enable_out_variant,
+        "When share_activation_arena is true, enable_out_variant must be set to true");
+    arena_pool_ = std::make_shared<ArenaPool>();
+  }
 
   // handle schema
   if (module_.has_value()) {
@@ -1076,7 +1089,9 @@ void BlockRunner::create_memory_planner() {
         block_info_,
         static_module_.opts().enable_out_variant,
         manage_output_tensors_enabled_,
-        static_module_.opts().optimize_memory);
+        static_module_.opts().optimize_memory,
+        static_module_.opts().bucketize_managed_storage_sizes,
+        static_module_.arena_pool());
   }
 }
 
@@ -172,6 +172,18 @@ struct TORCH_API StaticModuleOptions {
   bool use_maybe_copy_variants{true};
   // enable TensorExpr fusion of ops at model loading time
   bool enable_tensorexpr_fusion{false};
+  // to round managed tensor storage sizes up to the next power of two when
+  // recording them at the end of an iteration. With variable input shapes,
+  // this keeps tensors drawing from the preplanned buffer instead of raising
+  // the high-water mark (and growing the buffer) each time a slightly larger
+  // shape is seen, at the cost of up to 2x slack per storage group
+  // (enable_out_variant must be true)
+  bool bucketize_managed_storage_sizes{false};
+  // to lease per-request activation arenas from a pool shared by all
+  // runtimes cloned from this StaticModule instead of holding one arena per
+  // runtime instance. Bounds resident activation memory by peak concurrency
+  // rather than by the number of runtimes (enable_out_variant must be true)
+  bool share_activation_arena{false};
 };
 
 /*
@@ -238,6 +250,7 @@ class TORCH_API StaticRuntimeMetadata : public torch::CustomClassHolder {
 ///   pool.push(runtime);
 /// @endcode
 ///
+class ArenaPool;
 class MemoryPlanner;
 class StaticNodeInfo;
 class ProcessedNode;
@@ -441,6 +454,11 @@ class TORCH_API StaticModule {
 
   const StaticModuleOptions& opts() const;
 
+  // nullptr unless opts().share_activation_arena is set.
+  ArenaPool* arena_pool() const {
+    return arena_pool_.get();
+  }
+
   size_t num_inputs() const;
   size_t num_outputs() const;
 
@@ -536,6 +554,9 @@ class TORCH_API StaticModule {
   void prepareForMemoryPlanner();
 
   StaticModuleOptions opts_;
+  // Activation arena pool shared by all runtimes cloned from this module;
+  // only created when opts_.share_activation_arena is set.
+  std::shared_ptr<ArenaPool> arena_pool_;
   // metadata that is stored in IR nodes as attribute
   at::intrusive_ptr<jit::StaticRuntimeMetadata> sr_metadata_;
   std::shared_ptr<torch::jit::Graph> graph_;
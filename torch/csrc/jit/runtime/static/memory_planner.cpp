@@ -1,10 +1,12 @@
 #include <c10/core/alignment.h>
+#include <c10/util/llvmMathExtras.h>
 #include <torch/csrc/jit/runtime/static/memory_planner.h>
 
 #include <ATen/Tensor.h>
 #include <torch/csrc/jit/ir/alias_analysis.h>
 #include <torch/csrc/jit/jit_log.h>
 #include <torch/csrc/jit/runtime/static/impl.h>
+#include <algorithm>
 #include <iterator>
 
 namespace torch::jit {
@@ -61,6 +63,18 @@ size_t compute_aligned_tensor_size(size_t nbytes) {
   return (nbytes + c10::gAlignment - 1) & (~(c10::gAlignment - 1));
 }
 
+// Round the size up to the next power of two. Used for bucketed shape
+// planning: tensors whose sizes fluctuate between runs keep landing in the
+// same bucket instead of raising the group's high-water mark on every new
+// size. Powers of two >= c10::gAlignment are already aligned; smaller sizes
+// fall back to plain alignment.
+size_t compute_bucketed_tensor_size(size_t nbytes) {
+  if (nbytes <= c10::gAlignment) {
+    return compute_aligned_tensor_size(nbytes);
+  }
+  return c10::llvm::PowerOf2Ceil(nbytes);
+}
+
 at::DataPtr allocate_buffer(size_t size) {
   at::Allocator* allocator = c10::GetCPUCachingAllocator();
   return allocator->allocate(size);
@@ -200,11 +214,49 @@ std::vector<std::pair<size_t, at::Tensor*>> assignStorageToOutputTensors(
 
 } // namespace
 
+// Keep at most this many idle slabs pooled; anything beyond it means slabs
+// went stale (e.g. the planned size grew), so the smallest one is dropped.
+constexpr size_t kMaxPooledSlabs = 64;
+
+at::DataPtr ArenaPool::lease(size_t& num_bytes) {
+  {
+    std::lock_guard<std::mutex> guard(mutex_);
+    auto best = free_slabs_.end();
+    for (auto it = free_slabs_.begin(); it != free_slabs_.end(); ++it) {
+      if (it->first >= num_bytes &&
+          (best == free_slabs_.end() || it->first < best->first)) {
+        best = it;
+      }
+    }
+    if (best != free_slabs_.end()) {
+      num_bytes = best->first;
+      at::DataPtr buffer = std::move(best->second);
+      free_slabs_.erase(best);
+      return buffer;
+    }
+  }
+  return allocate_buffer(num_bytes);
+}
+
+void ArenaPool::release(at::DataPtr&& buffer, size_t num_bytes) {
+  std::lock_guard<std::mutex> guard(mutex_);
+  free_slabs_.emplace_back(num_bytes, std::move(buffer));
+  if (free_slabs_.size() > kMaxPooledSlabs) {
+    auto smallest = std::min_element(
+        free_slabs_.begin(),
+        free_slabs_.end(),
+        [](const auto& a, const auto& b) { return a.first < b.first; });
+    free_slabs_.erase(smallest);
+  }
+}
+
 MemoryPlanner::MemoryPlanner(
     BlockRunner* block_runner,
     const BlockInfo& block_info,
     bool enable_out_variant,
-    bool manage_output_tensors) {
+    bool manage_output_tensors,
+    ArenaPool* arena_pool)
+    : arena_pool_(arena_pool) {
   const auto& managed_tensor_values = block_info.managed_tensor_values();
   const auto& managed_output_tensor_values =
       block_info.managed_output_tensor_values();
@@ -273,7 +325,14 @@ MemoryPlanner::MemoryPlanner(
 }
 
 uint8_t* MemoryPlanner::allocateBuffer(size_t num_bytes) {
-  buffer_ = allocate_buffer(num_bytes);
+  buffer_nbytes_ = num_bytes;
+  if (arena_pool_ != nullptr) {
+    // buffer_nbytes_ may grow to the capacity of the reused slab so the
+    // whole slab is returned to the pool on deallocate().
+    buffer_ = arena_pool_->lease(buffer_nbytes_);
+  } else {
+    buffer_ = allocate_buffer(num_bytes);
+  }
   uint8_t* start = static_cast<uint8_t*>(buffer_.get());
   buffer_start_ = start;
   buffer_end_ = start + num_bytes;
@@ -350,6 +409,9 @@ void MemoryPlanner::deallocate() {
   // lower than expected and trigger the debug assertion in
   // ~intrusive_ptr_target.
   deallocateManagedTensors();
+  if (arena_pool_ != nullptr && buffer_) {
+    arena_pool_->release(std::move(buffer_), buffer_nbytes_);
+  }
   buffer_ = {};
 }
 
@@ -374,12 +436,16 @@ StandardMemoryPlanner::StandardMemoryPlanner(
     const BlockInfo& block_info,
     bool enable_out_variant,
     bool manage_output_tensors,
-    bool optimize_memory)
+    bool optimize_memory,
+    bool bucketize_storage_sizes,
+    ArenaPool* arena_pool)
     : MemoryPlanner(
           block_runner,
           block_info,
           enable_out_variant,
-          manage_output_tensors) {
+          manage_output_tensors,
+          arena_pool),
+      bucketize_storage_sizes_(bucketize_storage_sizes) {
   const auto& managed_tensor_values = block_info.managed_tensor_values();
   if (enable_out_variant) {
     const auto tensor_value_to_tensor =
@@ -457,7 +523,9 @@ void StandardMemoryPlanner::deallocateManagedTensors() {
     size_t max = ms.maxTensorSize();
     for (auto& tensor : tensors) {
       const auto& storage = tensor->storage();
-      size_t current_size = compute_aligned_tensor_size(storage.nbytes());
+      size_t current_size = bucketize_storage_sizes_
+          ? compute_bucketed_tensor_size(storage.nbytes())
+          : compute_aligned_tensor_size(storage.nbytes());
       at::StorageImpl* tensorStorageImpl = storage.unsafeGetStorageImpl();
       if (C10_UNLIKELY(first_time)) {
         tensorStorageImpl->reset();
@@ -2,8 +2,32 @@
 
 #include <torch/csrc/jit/runtime/static/impl.h>
 
+#include <mutex>
+
 namespace torch::jit {
 
+// A free list of activation arenas shared by all runtimes cloned from one
+// StaticModule. Each BlockRunner leases a slab for the duration of one
+// request (in allocate()) and returns it on completion (in deallocate()), so
+// resident activation memory is bounded by peak concurrency times the
+// per-request arena size instead of the number of runtime instances. Slabs
+// are reused best-fit; undersized leftovers are dropped once the free list
+// grows past a small cap so repeated re-planning can't accumulate stale
+// slabs.
+class TORCH_API ArenaPool {
+ public:
+  // Returns a buffer of at least `num_bytes`, reusing a pooled slab when one
+  // is big enough. `num_bytes` is updated to the actual slab size.
+  at::DataPtr lease(size_t& num_bytes);
+  void release(at::DataPtr&& buffer, size_t num_bytes);
+
+ private:
+  std::mutex mutex_;
+  // (capacity, buffer), unordered; the free list stays small (at most peak
+  // concurrency entries), so best-fit is a linear scan.
+  std::vector<std::pair<size_t, at::DataPtr>> free_slabs_;
+};
+
 // A StorageGroup represents a collection of tensors that share backing storage.
 class StorageGroup {
  public:
@@ -147,7 +171,8 @@ class MemoryPlanner {
       BlockRunner* block_runner,
       const BlockInfo& block_info,
       bool enable_out_variant,
-      bool manage_output_tensors);
+      bool manage_output_tensors,
+      ArenaPool* arena_pool = nullptr);
 
   // disable copying and moving
   MemoryPlanner(const MemoryPlanner&) = delete;
@@ -264,7 +289,10 @@ class MemoryPlanner {
   std::vector<IValue*> borrowed_ivalues_needing_incref_;
 
   std::vector<std::pair<size_t, at::Tensor*>> managed_output_tensors_{};
-  at::DataPtr buffer_; // allocated each time we call Run()
+  at::DataPtr buffer_; // allocated (or leased) each time we call Run()
+  // when set, buffer_ is leased from this pool instead of allocated fresh
+  ArenaPool* arena_pool_{nullptr};
+  size_t buffer_nbytes_{0};
   uint8_t* buffer_start_{nullptr};
   uint8_t* buffer_end_{nullptr};
   size_t num_managed_tensors_{0};
@@ -286,13 +314,20 @@ class StandardMemoryPlanner : public MemoryPlanner {
       const BlockInfo& block_info,
       bool enable_out_variant,
       bool manage_output_tensors,
-      bool optimize_memory);
+      bool optimize_memory,
+      bool bucketize_storage_sizes = false,
+      ArenaPool* arena_pool = nullptr);
 
  protected:
   void allocateManagedTensors() override;
   void deallocateManagedTensors() override;
 
   std::vector<StorageGroup> managed_tensors_{};
+
+  // If true, recorded storage group sizes are rounded up to the next power
+  // of two so that run-to-run shape variations land in an already-planned
+  // bucket instead of raising the high-water mark on every new size.
+  bool bucketize_storage_sizes_{false};
 };
 
 } // namespace torch::jit
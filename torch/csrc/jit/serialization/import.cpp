@@ -11,7 +11,9 @@
 
 #include <ATen/core/functional.h>
 #include <ATen/core/ivalue_inl.h>
+#include <c10/core/impl/COW.h>
 #include <c10/util/Exception.h>
+#include <c10/util/env.h>
 #include <c10/util/irange.h>
 #include <torch/csrc/jit/frontend/script_type_parser.h>
 #include <torch/csrc/jit/ir/graph_utils.h>
@@ -30,6 +32,8 @@
 #include <ATen/ATen.h>
 #include <fmt/format.h>
 
+#include <cstring>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -104,6 +108,103 @@ c10::intrusive_ptr<c10::ivalue::Object> ObjLoaderFunc(
 
 namespace {
 
+// Note [Dedup of loaded tensor storages]
+// Loading the same weights many times in one process (e.g. a fleet of
+// variants of a base model in a multi-tenant server) materializes one copy
+// of every constant tensor per load. When TORCH_JIT_DEDUP_LOADED_TENSORS is
+// set, freshly deserialized CPU storages are looked up in a process-wide
+// content-addressed registry and byte-identical ones are shared through a
+// copy-on-write clone, so the bytes stay resident once. A later in-place
+// write through any of the sharing modules materializes a private copy, so
+// sharing is not observable; contents are compared with memcmp before
+// sharing, so a storage that was mutated after registration simply stops
+// matching. The registry holds weak references and does not keep storages
+// alive.
+class LoadedStorageRegistry {
+ public:
+  static LoadedStorageRegistry& get() {
+    static LoadedStorageRegistry registry;
+    return registry;
+  }
+
+  // Returns a storage with the same contents as `storage`, backed by a
+  // previously loaded identical storage when one exists. Falls back to
+  // returning `storage` itself (and registering it) when there is no match
+  // or its DataPtr cannot be converted to copy-on-write.
+  c10::Storage dedup(const c10::Storage& storage) {
+    const size_t nbytes = storage.nbytes();
+    const size_t hash = hashBytes(storage.data(), nbytes);
+    std::lock_guard<std::mutex> guard(mutex_);
+    auto& bucket = by_hash_[hash];
+    for (auto it = bucket.begin(); it != bucket.end();) {
+      auto impl = it->lock();
+      if (!impl) {
+        it = bucket.erase(it);
+        continue;
+      }
+      if (impl->nbytes() == nbytes &&
+          std::memcmp(impl->data(), storage.data(), nbytes) == 0) {
+        if (auto shared = c10::impl::cow::lazy_clone_storage(*impl)) {
+          return c10::Storage(std::move(shared));
+        }
+      }
+      ++it;
+    }
+    bucket.emplace_back(storage.getWeakStorageImpl());
+    return storage;
+  }
+
+ private:
+  static size_t hashBytes(const void* data, size_t nbytes) {
+    // FNV-1a. Collisions only cost the memcmp above.
+    const auto* bytes = static_cast<const uint8_t*>(data);
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    for (const auto i : c10::irange(nbytes)) {
+      hash = (hash ^ bytes[i]) * 0x100000001b3ULL;
+    }
+    return static_cast<size_t>(hash);
+  }
+
+  std::mutex mutex_;
+  std::unordered_map<
+      size_t,
+      std::vector<c10::weak_intrusive_ptr<c10::StorageImpl>>>
+      by_hash_;
+};
+
+bool dedupLoadedTensorsEnabled() {
+  return c10::utils::check_env("TORCH_JIT_DEDUP_LOADED_TENSORS") == true;
+}
+
+void dedupLoadedTensors(const IValue& root) {
+  // Views deserialized from one archive share a storage; replace each
+  // StorageImpl at most once so intra-module aliasing is preserved.
+  std::unordered_map<c10::StorageImpl*, c10::Storage> replaced;
+  root.visit([&](const IValue& ivalue) {
+    if (!ivalue.isTensor()) {
+      return false;
+    }
+    const auto& tensor = ivalue.toTensor();
+    if (!tensor.has_storage() || !tensor.device().is_cpu() ||
+        tensor.storage().nbytes() == 0) {
+      return false;
+    }
+    const auto& storage = tensor.storage();
+    auto it = replaced.find(storage.unsafeGetStorageImpl());
+    if (it == replaced.end()) {
+      it = replaced
+               .emplace(
+                   storage.unsafeGetStorageImpl(),
+                   LoadedStorageRegistry::get().dedup(storage))
+               .first;
+    }
+    if (it->second.unsafeGetStorageImpl() != storage.unsafeGetStorageImpl()) {
+      tensor.unsafeGetTensorImpl()->set_storage_keep_dtype(it->second);
+    }
+    return false;
+  });
+}
+
 // This is a deserializer class which loads script modules from pt files.
 // Content of the file is written using PyTorchStreamWriter, for details please
 // check caffe2/serialize/inline_container.h.
@@ -272,6 +373,15 @@ Module ScriptModuleDeserializer::deserialize(
   }
   auto m_ivalue = readArchive("data");
   auto m = Module(m_ivalue.toObject());
+  if (dedupLoadedTensorsEnabled()) {
+    // See Note [Dedup of loaded tensor storages]. Constants referenced from
+    // method code live in the constant table; parameters and buffers hang
+    // off the module object.
+    for (const auto& constant : constants_table_) {
+      dedupLoadedTensors(constant);
+    }
+    dedupLoadedTensors(m_ivalue);
+  }
   rewriteQuantizedConvForBC(m);
   // Checking for and loading saved traced inputs
   if (restore_shapes && reader_->hasRecord("traced_inputs.pkl")) {
@@ -1,6 +1,8 @@
+#include <c10/util/irange.h>
 #include <caffe2/serialize/inline_container.h>
 #include <torch/csrc/jit/serialization/import_read.h>
 
+#include <unordered_map>
 #include <utility>
 
 namespace torch::jit {
@@ -37,8 +39,39 @@ IValue readArchiveAndTensors(
   std::string tensor_dir_path =
       (!tensor_prefix.empty()) ? tensor_prefix : archive_name + "/";
 
+  // Pull all tensor payloads of the archive up front through the batched
+  // reader, which overlaps the record reads across a few threads, instead of
+  // fetching them one by one as the unpickler encounters them. Skipped under
+  // a storage context (torch.package may have some records loaded already).
+  std::unordered_map<std::string, at::DataPtr> prefetched_records;
+  if (storage_context == nullptr) {
+    std::vector<std::string> tensor_record_names;
+    for (auto& record_name : stream_reader.getAllRecords()) {
+      if (record_name.compare(0, tensor_dir_path.size(), tensor_dir_path) ==
+          0) {
+        tensor_record_names.push_back(std::move(record_name));
+      }
+    }
+    if (tensor_record_names.size() > 1) {
+      auto records = stream_reader.getRecords(tensor_record_names);
+      for (const auto i : c10::irange(tensor_record_names.size())) {
+        prefetched_records.emplace(
+            std::move(tensor_record_names[i]),
+            std::move(std::get<0>(records[i])));
+      }
+    }
+  }
+
   auto read_record = [&](const std::string& name) {
     std::string ss = tensor_dir_path + name;
+    auto it = prefetched_records.find(ss);
+    if (it != prefetched_records.end()) {
+      at::DataPtr data = std::move(it->second);
+      // A key is normally requested once; drop the slot so a repeated
+      // request falls back to the reader instead of an empty DataPtr.
+      prefetched_records.erase(it);
+      return data;
+    }
     return std::get<0>(stream_reader.getRecord(ss));
   };
 
@@ -27,6 +27,13 @@ C10_DEFINE_bool(
     false,
     "Use thread pool to schedule backend execution");
 
+C10_DEFINE_bool(
+    torch_lazy_enable_async_shape_inference,
+    false,
+    "Run shape inference functions on the IO thread pool so tracing "
+    "overlaps with shape computation; shape functions must own their "
+    "captures when this is enabled");
+
 C10_DEFINE_bool(
     torch_lazy_enable_device_data_cache,
     true,
@@ -3,6 +3,8 @@
 #include <torch/csrc/lazy/core/config.h>
 #include <torch/csrc/lazy/core/ir.h>
 #include <torch/csrc/lazy/core/ir_metadata.h>
+#include <torch/csrc/lazy/core/metrics.h>
+#include <torch/csrc/lazy/core/thread_pool.h>
 
 // Enables caching on for dynamic shapes (aka disable hash on shapes)
 C10_DEFINE_bool(
@@ -105,29 +107,75 @@ Node::Node(OpKind op, Shape shape, size_t num_outputs) : Node(op, num_outputs) {
   shapes_.push_back(std::move(shape));
 }
 
-Node::~Node() = default;
+Node::~Node() {
+  // Make sure a thread pool closure spawned by addComputedShape is not left
+  // running against a destroyed node.
+  if (deferred_shape_.valid()) {
+    deferred_shape_.wait();
+  }
+}
 
 // Retrieves the full shape of the IR Node.
 c10::ArrayRef<Shape> Node::shapes() const {
+  ApplyDeferredShape();
   return shapes_;
 }
 
 // Retrieves the shape of the output at a given index.
 const Shape& Node::shape(size_t output_index) const {
+  ApplyDeferredShape();
   return shapes_.at(output_index);
 }
 
+using ShapeCache = Cache<hash_t, Shape, HashReducer>;
+
+static ShapeCache* GetShapeCache() {
+  static ShapeCache* cache = new ShapeCache(FLAGS_torch_lazy_shape_cache_size);
+  return cache;
+}
+
 // Add the shape computed by the shape_fn
 
 void Node::addComputedShape(const std::function<Shape()>& shape_fn) {
-  shapes_.push_back(computeShape(shape_fn));
+  if (!FLAGS_torch_lazy_enable_async_shape_inference) {
+    shapes_.push_back(computeShape(shape_fn));
+    return;
+  }
+  auto hash = shapeHash();
+  auto shape = GetShapeCache()->Get(hash);
+  if (shape != nullptr) {
+    shapes_.push_back(*shape);
+    return;
+  }
+  // Cache miss: leave a placeholder and run the shape function on the IO
+  // thread pool so the tracing thread can keep building nodes. The node's
+  // hashes do not depend on the computed shape (they are derived from the
+  // operands and the op), so deferring it is safe; readers synchronize
+  // through ApplyDeferredShape.
+  TORCH_LAZY_COUNTER("DeferredShapeInference", 1);
+  shapes_.emplace_back();
+  deferred_shape_index_ = shapes_.size() - 1;
+  auto task = std::make_shared<std::packaged_task<Shape()>>(shape_fn);
+  deferred_shape_ = task->get_future().share();
+  ScheduleIoClosure([task = std::move(task)]() { (*task)(); });
+}
+
+void Node::ApplyDeferredShape() const {
+  if (!deferred_shape_.valid()) {
+    return;
+  }
+  std::call_once(deferred_shape_applied_, [this]() {
+    auto* mutable_this = const_cast<Node*>(this);
+    mutable_this->shapes_[deferred_shape_index_] = deferred_shape_.get();
+    GetShapeCache()->Add(
+        shapeHash(),
+        std::make_shared<Shape>(shapes_[deferred_shape_index_]));
+  });
 }
 
-using ShapeCache = Cache<hash_t, Shape, HashReducer>;
-
 // Compute the shape using the provided shape_fn.
 Shape Node::computeShape(const std::function<Shape()>& shape_fn) {
-  static ShapeCache* cache = new ShapeCache(FLAGS_torch_lazy_shape_cache_size);
+  auto* cache = GetShapeCache();
 
   auto hash = shapeHash();
   auto shape = cache->Get(hash);
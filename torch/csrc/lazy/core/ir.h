@@ -3,7 +3,9 @@
 #include <ATen/core/symbol.h>
 
 #include <functional>
+#include <future>
 #include <memory>
+#include <mutex>
 #include <set>
 #include <string>
 #include <unordered_map>
@@ -124,7 +126,11 @@ class TORCH_API Node {
 
   virtual const Shape& shape(size_t output_index = 0) const;
 
-  // Add the shape computed by the shape_fn
+  // Add the shape computed by the shape_fn. With
+  // FLAGS_torch_lazy_enable_async_shape_inference set, a shape cache miss
+  // schedules shape_fn on the IO thread pool instead of running it inline;
+  // shapes()/shape() wait for the result, so tracing overlaps with shape
+  // inference until the shape is actually consumed.
   void addComputedShape(const std::function<Shape()>& shape_fn);
 
   // Compute the shape using the provided shape_fn if not previously cached
@@ -160,10 +166,23 @@ class TORCH_API Node {
   virtual std::string ToString() const;
 
  private:
+  // Publishes the result of a shape function that was deferred to the IO
+  // thread pool into shapes_. No-op when nothing was deferred; safe to call
+  // from multiple threads.
+  void ApplyDeferredShape() const;
+
   // The ID of the operation captured by this node.
   OpKind op_;
   size_t num_outputs_ = 1;
 
+  // State for asynchronous shape inference (see addComputedShape): the
+  // placeholder slot in shapes_ being filled, the future produced by the
+  // thread pool closure, and a flag so the result is published exactly once.
+  // A node is immutable once built apart from this write-once slot.
+  size_t deferred_shape_index_ = 0;
+  mutable std::shared_future<Shape> deferred_shape_;
+  mutable std::once_flag deferred_shape_applied_;
+
   // The IR specific metadata attached to the IR node.
   MetaData metadata_;
   // The IR framework user can attach a user defined metadata object deriving
@@ -0,0 +1,149 @@
+#include <torch/csrc/monitor/histogram.h>
+
+#include <chrono>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+
+#include <ATen/record_function.h>
+
+namespace torch {
+namespace monitor {
+
+int64_t Histogram::count() const noexcept {
+  uint64_t total = 0;
+  for (const auto& bucket : buckets_) {
+    total += bucket.load(std::memory_order_relaxed);
+  }
+  return static_cast<int64_t>(total);
+}
+
+int64_t Histogram::percentile(double p) const noexcept {
+  // Snapshot the buckets first so concurrent record() calls can't push the
+  // running total past the snapshot-derived rank.
+  std::array<uint64_t, NUM_HISTOGRAM_BUCKETS> counts{};
+  uint64_t total = 0;
+  for (int i = 0; i < NUM_HISTOGRAM_BUCKETS; i++) {
+    counts[i] = buckets_[i].load(std::memory_order_relaxed);
+    total += counts[i];
+  }
+  if (total == 0) {
+    return 0;
+  }
+  auto rank = static_cast<uint64_t>(p * static_cast<double>(total));
+  if (rank >= total) {
+    rank = total - 1;
+  }
+  uint64_t seen = 0;
+  for (int i = 0; i < NUM_HISTOGRAM_BUCKETS; i++) {
+    seen += counts[i];
+    if (seen > rank) {
+      // Upper bound of bucket i: 2^(i+1) - 1
+      if (i >= 62) {
+        return std::numeric_limits<int64_t>::max();
+      }
+      return (int64_t(1) << (i + 1)) - 1;
+    }
+  }
+  return std::numeric_limits<int64_t>::max();
+}
+
+void Histogram::log() const {
+  Event e;
+  e.name = "torch.monitor.Histogram";
+  e.timestamp = std::chrono::system_clock::now();
+  e.data["name"] = name_;
+  e.data["count"] = count();
+  e.data["p50"] = percentile(0.5);
+  e.data["p90"] = percentile(0.9);
+  e.data["p99"] = percentile(0.99);
+  logEvent(e);
+}
+
+namespace {
+
+struct OpLatencyRegistry {
+  // Reader-heavy: every op completion does a shared-lock lookup; the unique
+  // lock is only taken the first time an operator is seen.
+  std::shared_mutex mu;
+  std::unordered_map<std::string, std::unique_ptr<Histogram>> histograms;
+
+  static OpLatencyRegistry& get() {
+    static auto* registry = new OpLatencyRegistry();
+    return *registry;
+  }
+
+  Histogram& histogramFor(const char* opName) {
+    {
+      std::shared_lock<std::shared_mutex> lock(mu);
+      auto it = histograms.find(opName);
+      if (it != histograms.end()) {
+        return *it->second;
+      }
+    }
+    std::unique_lock<std::shared_mutex> lock(mu);
+    auto& slot = histograms[opName];
+    if (!slot) {
+      slot = std::make_unique<Histogram>(opName);
+    }
+    return *slot;
+  }
+};
+
+struct OpLatencyObserverContext : public at::ObserverContext {
+  std::chrono::steady_clock::time_point start;
+};
+
+std::unique_ptr<at::ObserverContext> onOpStart(const at::RecordFunction&) {
+  auto ctx = std::make_unique<OpLatencyObserverContext>();
+  ctx->start = std::chrono::steady_clock::now();
+  return ctx;
+}
+
+void onOpEnd(const at::RecordFunction& fn, at::ObserverContext* ctxPtr) {
+  auto* ctx = static_cast<OpLatencyObserverContext*>(ctxPtr);
+  if (ctx == nullptr) {
+    return;
+  }
+  auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                     std::chrono::steady_clock::now() - ctx->start)
+                     .count();
+  OpLatencyRegistry::get().histogramFor(fn.name()).record(elapsed);
+}
+
+std::mutex opLatencyCallbackMutex;
+at::CallbackHandle opLatencyCallbackHandle = at::INVALID_CALLBACK_HANDLE;
+
+} // namespace
+
+void enableOperatorLatencyHistograms() {
+  std::lock_guard<std::mutex> guard(opLatencyCallbackMutex);
+  if (opLatencyCallbackHandle != at::INVALID_CALLBACK_HANDLE) {
+    return;
+  }
+  opLatencyCallbackHandle = at::addGlobalCallback(
+      at::RecordFunctionCallback(onOpStart, onOpEnd)
+          .scopes({at::RecordScope::FUNCTION}));
+}
+
+void disableOperatorLatencyHistograms() {
+  std::lock_guard<std::mutex> guard(opLatencyCallbackMutex);
+  if (opLatencyCallbackHandle == at::INVALID_CALLBACK_HANDLE) {
+    return;
+  }
+  at::removeCallback(opLatencyCallbackHandle);
+  opLatencyCallbackHandle = at::INVALID_CALLBACK_HANDLE;
+}
+
+void logOperatorLatencyHistograms() {
+  auto& registry = OpLatencyRegistry::get();
+  std::shared_lock<std::shared_mutex> lock(registry.mu);
+  for (auto& kv : registry.histograms) {
+    kv.second->log();
+  }
+}
+
+} // namespace monitor
+} // namespace torch
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+#include <c10/macros/Macros.h>
+#include <c10/util/llvmMathExtras.h>
+
+#include <torch/csrc/monitor/events.h>
+
+namespace torch {
+namespace monitor {
+
+// One bucket per power of two of the recorded value; bucket i counts values
+// in [2^i, 2^(i+1)), with non-positive values falling into bucket 0. 64
+// buckets cover the full int64_t range, so nanosecond latencies need no
+// configuration.
+constexpr int NUM_HISTOGRAM_BUCKETS = 64;
+
+// Histogram is a fixed-bucket log2-scale histogram designed for hot paths
+// such as per-operator latency tracking: record() is a single relaxed atomic
+// increment with no locks, allocations or clock reads, so it stays well under
+// 100ns and is safe to call concurrently from any thread.
+//
+// Unlike Stat, a Histogram never logs from the recording thread. Counts
+// accumulate monotonically and log() exports a snapshot through the event
+// handlers as a `torch.monitor.Histogram` event carrying the total count and
+// estimated p50/p90/p99, which is what alerting typically keys on.
+class TORCH_API Histogram {
+ public:
+  explicit Histogram(std::string name) : name_(std::move(name)) {}
+
+  Histogram(const Histogram&) = delete;
+  Histogram& operator=(const Histogram&) = delete;
+
+  // record adds a single value. Hot-path safe; see the class comment.
+  void record(int64_t value) noexcept {
+    size_t bucket = value <= 0
+        ? 0
+        : c10::llvm::Log2_64(static_cast<uint64_t>(value));
+    buckets_[bucket].fetch_add(1, std::memory_order_relaxed);
+  }
+
+  // count returns the total number of recorded values.
+  int64_t count() const noexcept;
+
+  // percentile returns an estimate of the p-th percentile (p in [0, 1]) as
+  // the upper bound of the bucket containing it, i.e. it errs on the side of
+  // over-reporting by at most 2x, which is the resolution of the buckets.
+  // Returns 0 if nothing has been recorded.
+  int64_t percentile(double p) const noexcept;
+
+  // log exports the current snapshot as a `torch.monitor.Histogram` event
+  // with the name, count and p50/p90/p99 estimates. Counts are cumulative;
+  // consumers alerting on rates should diff successive events.
+  void log() const;
+
+  const std::string& name() const noexcept {
+    return name_;
+  }
+
+ private:
+  const std::string name_;
+  std::array<std::atomic<uint64_t>, NUM_HISTOGRAM_BUCKETS> buckets_{};
+};
+
+// When enabled, every dispatched operator (RecordFunction FUNCTION scope)
+// records its wall-clock latency in nanoseconds into a Histogram keyed by the
+// operator name. This uses a global RecordFunction callback rather than the
+// profiler, so the per-op overhead is one clock read on each side of the call
+// plus the record() increment, and it is safe to leave on in production.
+TORCH_API void enableOperatorLatencyHistograms();
+TORCH_API void disableOperatorLatencyHistograms();
+
+// Emits one `torch.monitor.Histogram` event per operator observed so far.
+// Typically called periodically from a reporting thread.
+TORCH_API void logOperatorLatencyHistograms();
+
+} // namespace monitor
+} // namespace torch
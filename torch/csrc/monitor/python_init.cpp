@@ -12,6 +12,7 @@
 
 #include <torch/csrc/monitor/counters.h>
 #include <torch/csrc/monitor/events.h>
+#include <torch/csrc/monitor/histogram.h>
 
 namespace pybind11 {
 namespace detail {
@@ -194,6 +195,82 @@ void initMonitorBindings(PyObject* module) {
             once the event has been logged.
           )DOC");
 
+  py::class_<Histogram>(
+      m,
+      "Histogram",
+      R"DOC(
+        Histogram is a fixed-bucket log2-scale histogram designed for hot
+        paths such as per-operator latency tracking: ``record`` is a single
+        atomic increment with no locks or allocations, so it is safe to call
+        at very high frequency and from multiple threads.
+
+        Counts accumulate monotonically; ``log`` exports a snapshot through
+        the registered event handlers as a ``torch.monitor.Histogram`` event
+        carrying the total count and estimated p50/p90/p99.
+      )DOC")
+      .def(
+          py::init<std::string>(),
+          py::arg("name"),
+          R"DOC(
+           Constructs the ``Histogram``.
+          )DOC")
+      .def(
+          "record",
+          &Histogram::record,
+          py::arg("value"),
+          R"DOC(
+            Records a single value into the histogram.
+          )DOC")
+      .def(
+          "percentile",
+          &Histogram::percentile,
+          py::arg("p"),
+          R"DOC(
+            Returns an estimate of the p-th percentile (p in [0, 1]) of the
+            recorded values, as the upper bound of the bucket containing it.
+          )DOC")
+      .def(
+          "log",
+          &Histogram::log,
+          R"DOC(
+            Logs the current snapshot as a ``torch.monitor.Histogram`` event.
+          )DOC")
+      .def_property_readonly(
+          "name",
+          &Histogram::name,
+          R"DOC(
+            The name of the histogram that was set during creation.
+          )DOC")
+      .def_property_readonly(
+          "count",
+          &Histogram::count,
+          R"DOC(
+            Total number of values recorded so far.
+          )DOC");
+
+  m.def(
+      "_enable_op_latency_histograms",
+      &enableOperatorLatencyHistograms,
+      R"DOC(
+        Starts recording the wall-clock latency of every dispatched operator
+        into a per-operator log-scale histogram. Much lighter weight than the
+        profiler; intended to stay enabled in production.
+      )DOC");
+  m.def(
+      "_disable_op_latency_histograms",
+      &disableOperatorLatencyHistograms,
+      R"DOC(
+        Stops recording operator latencies. Already-collected histograms are
+        kept and can still be logged.
+      )DOC");
+  m.def(
+      "_log_op_latency_histograms",
+      &logOperatorLatencyHistograms,
+      R"DOC(
+        Emits one ``torch.monitor.Histogram`` event per operator observed so
+        far. Typically called periodically from a reporting thread.
+      )DOC");
+
   py::class_<Event>(
       m,
       "Event",
@@ -0,0 +1,147 @@
+#include <torch/csrc/multiprocessing/SharedRingBuffer.h>
+
+#include <ATen/Functions.h>
+#include <ATen/MapAllocator.h>
+#include <c10/util/irange.h>
+
+#include <cstring>
+
+namespace torch::multiprocessing {
+
+namespace {
+
+constexpr int64_t kCacheLine = 64;
+
+int64_t aligned_size(int64_t size) {
+  return (size + kCacheLine - 1) / kCacheLine * kCacheLine;
+}
+
+int64_t control_block_bytes() {
+  return aligned_size(sizeof(std::atomic<int64_t>) * 2);
+}
+
+int64_t slot_header_bytes() {
+  return aligned_size(
+      sizeof(int32_t) * 2 + sizeof(int64_t) * SharedRingBuffer::kMaxDims);
+}
+
+int64_t slot_stride(int64_t slot_bytes) {
+  return slot_header_bytes() + aligned_size(slot_bytes);
+}
+
+} // namespace
+
+SharedRingBuffer::SharedRingBuffer(
+    const std::string& filename,
+    int64_t slot_bytes,
+    int64_t num_slots,
+    bool create)
+    : filename_(filename), slot_bytes_(slot_bytes), num_slots_(num_slots) {
+  TORCH_CHECK(slot_bytes > 0, "slot_bytes must be positive, got ", slot_bytes);
+  TORCH_CHECK(num_slots >= 2, "need at least 2 slots, got ", num_slots);
+  static_assert(
+      std::atomic<int64_t>::is_always_lock_free,
+      "shared-memory ring buffer requires lock-free 64-bit atomics");
+
+  const size_t total_size =
+      control_block_bytes() + num_slots * slot_stride(slot_bytes);
+  int flags = at::ALLOCATOR_MAPPED_SHAREDMEM;
+  if (create) {
+    flags |= at::ALLOCATOR_MAPPED_EXCLUSIVE;
+  } else {
+    flags |= at::ALLOCATOR_MAPPED_NOCREATE;
+  }
+  map_ = at::MapAllocator::makeDataPtr(
+      filename, flags, total_size, /*actual_size_out=*/nullptr);
+  if (create) {
+    control()->head.store(0, std::memory_order_relaxed);
+    control()->tail.store(0, std::memory_order_release);
+  }
+}
+
+SharedRingBuffer::ControlBlock* SharedRingBuffer::control() const {
+  return reinterpret_cast<ControlBlock*>(map_.get());
+}
+
+SharedRingBuffer::SlotHeader* SharedRingBuffer::slot_header(
+    int64_t slot) const {
+  return reinterpret_cast<SlotHeader*>(
+      static_cast<char*>(map_.get()) + control_block_bytes() +
+      slot * slot_stride(slot_bytes_));
+}
+
+char* SharedRingBuffer::slot_data(int64_t slot) const {
+  return reinterpret_cast<char*>(slot_header(slot)) + slot_header_bytes();
+}
+
+bool SharedRingBuffer::write(const at::Tensor& tensor) {
+  TORCH_CHECK(
+      tensor.device().is_cpu(),
+      "SharedRingBuffer only transports CPU tensors, got ",
+      tensor.device());
+  TORCH_CHECK(
+      tensor.dim() <= kMaxDims,
+      "tensor has ",
+      tensor.dim(),
+      " dims, the ring buffer supports at most ",
+      kMaxDims);
+  auto src = tensor.contiguous();
+  const int64_t nbytes = static_cast<int64_t>(src.nbytes());
+  TORCH_CHECK(
+      nbytes <= slot_bytes_,
+      "tensor of ",
+      nbytes,
+      " bytes does not fit in a slot of ",
+      slot_bytes_,
+      " bytes");
+
+  const int64_t tail = control()->tail.load(std::memory_order_relaxed);
+  const int64_t head = control()->head.load(std::memory_order_acquire);
+  if ((tail + 1) % num_slots_ == head) {
+    return false; // full
+  }
+
+  SlotHeader* header = slot_header(tail);
+  header->dtype = static_cast<int32_t>(src.scalar_type());
+  header->ndim = static_cast<int32_t>(src.dim());
+  for (const auto d : c10::irange(src.dim())) {
+    header->sizes[d] = src.size(d);
+  }
+  if (nbytes > 0) {
+    std::memcpy(slot_data(tail), src.const_data_ptr(), nbytes);
+  }
+  control()->tail.store((tail + 1) % num_slots_, std::memory_order_release);
+  return true;
+}
+
+std::optional<at::Tensor> SharedRingBuffer::read(
+    const std::shared_ptr<SharedRingBuffer>& keep_alive) {
+  TORCH_INTERNAL_ASSERT(keep_alive.get() == this);
+  const int64_t head = control()->head.load(std::memory_order_relaxed);
+  const int64_t tail = control()->tail.load(std::memory_order_acquire);
+  if (head == tail) {
+    return c10::nullopt; // empty
+  }
+
+  const SlotHeader* header = slot_header(head);
+  const auto dtype = static_cast<at::ScalarType>(header->dtype);
+  std::vector<int64_t> sizes(
+      header->sizes, header->sizes + static_cast<int64_t>(header->ndim));
+  // The deleter pins the mapping (via the buffer handle) for the life of the
+  // view; the slot itself is recycled only on release_read().
+  auto buffer_ref = keep_alive;
+  return at::from_blob(
+      slot_data(head),
+      sizes,
+      [buffer_ref](void*) {},
+      at::TensorOptions().dtype(dtype).device(at::kCPU));
+}
+
+void SharedRingBuffer::release_read() {
+  const int64_t head = control()->head.load(std::memory_order_relaxed);
+  const int64_t tail = control()->tail.load(std::memory_order_acquire);
+  TORCH_CHECK(head != tail, "release_read() called on an empty ring buffer");
+  control()->head.store((head + 1) % num_slots_, std::memory_order_release);
+}
+
+} // namespace torch::multiprocessing
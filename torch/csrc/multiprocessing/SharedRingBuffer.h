@@ -0,0 +1,85 @@
+#pragma once
+
+#include <ATen/core/Tensor.h>
+
+#include <atomic>
+#include <memory>
+#include <optional>
+#include <string>
+
+namespace torch::multiprocessing {
+
+// A single-producer/single-consumer ring buffer of tensor slots living in a
+// shared-memory region backed by at::MapAllocator. A worker process writes a
+// batch tensor into the next free slot (one memcpy, no pickling); the
+// consumer process maps the same region and constructs zero-copy tensor
+// views over the filled slots. Consumers must call release_read() once they
+// are done with a view to hand the slot back to the producer.
+class SharedRingBuffer {
+ public:
+  // Shapes are stored inline in each slot header so the transport does not
+  // need a metadata side channel.
+  static constexpr int64_t kMaxDims = 16;
+
+  // Creates (create == true) or attaches to (create == false) the
+  // shared-memory region named `filename` (a NewProcessWideShmHandle()-style
+  // handle) holding `num_slots` slots of `slot_bytes` payload each.
+  SharedRingBuffer(
+      const std::string& filename,
+      int64_t slot_bytes,
+      int64_t num_slots,
+      bool create);
+
+  SharedRingBuffer(const SharedRingBuffer&) = delete;
+  SharedRingBuffer& operator=(const SharedRingBuffer&) = delete;
+
+  // Copies `tensor` (CPU, dense) into the next free slot. Returns false
+  // without blocking when the ring is full.
+  bool write(const at::Tensor& tensor);
+
+  // Returns a zero-copy view of the oldest unread slot, or nullopt when the
+  // ring is empty. `keep_alive` (the owning handle of this buffer) is
+  // captured by the view's deleter so the mapping outlives the tensor. The
+  // slot stays owned by the consumer until release_read().
+  std::optional<at::Tensor> read(
+      const std::shared_ptr<SharedRingBuffer>& keep_alive);
+
+  // Releases the oldest read slot back to the producer.
+  void release_read();
+
+  const std::string& filename() const {
+    return filename_;
+  }
+  int64_t slot_bytes() const {
+    return slot_bytes_;
+  }
+  int64_t num_slots() const {
+    return num_slots_;
+  }
+
+ private:
+  struct ControlBlock {
+    // head: next slot to read; tail: next slot to write. Equal means empty;
+    // tail + 1 == head (mod num_slots) means full, so one slot is kept idle.
+    std::atomic<int64_t> head;
+    std::atomic<int64_t> tail;
+  };
+
+  struct SlotHeader {
+    int32_t dtype;
+    int32_t ndim;
+    // NOLINTNEXTLINE(*c-arrays*)
+    int64_t sizes[kMaxDims];
+  };
+
+  ControlBlock* control() const;
+  SlotHeader* slot_header(int64_t slot) const;
+  char* slot_data(int64_t slot) const;
+
+  std::string filename_;
+  int64_t slot_bytes_;
+  int64_t num_slots_;
+  at::DataPtr map_;
+};
+
+} // namespace torch::multiprocessing
@@ -1,5 +1,6 @@
 #include <c10/util/thread_name.h>
 #include <torch/csrc/Exceptions.h>
+#include <torch/csrc/multiprocessing/SharedRingBuffer.h>
 #include <torch/csrc/python_headers.h>
 #include <torch/csrc/utils/object_ptr.h>
 #include <torch/csrc/utils/pybind.h>
@@ -36,6 +37,25 @@ PyObject* multiprocessing_init(PyObject* _unused, PyObject* noargs) {
 #endif
   });
 
+  py::class_<SharedRingBuffer, std::shared_ptr<SharedRingBuffer>>(
+      module, "_SharedRingBuffer")
+      .def(
+          py::init<const std::string&, int64_t, int64_t, bool>(),
+          py::arg("filename"),
+          py::arg("slot_bytes"),
+          py::arg("num_slots"),
+          py::arg("create"))
+      .def("write", &SharedRingBuffer::write, py::arg("tensor"))
+      .def(
+          "read",
+          [](const std::shared_ptr<SharedRingBuffer>& self) {
+            return self->read(self);
+          })
+      .def("release_read", &SharedRingBuffer::release_read)
+      .def_property_readonly("filename", &SharedRingBuffer::filename)
+      .def_property_readonly("slot_bytes", &SharedRingBuffer::slot_bytes)
+      .def_property_readonly("num_slots", &SharedRingBuffer::num_slots);
+
   Py_RETURN_TRUE;
 }
 
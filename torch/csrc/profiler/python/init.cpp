@@ -9,6 +9,7 @@
 #include <torch/csrc/profiler/collection.h>
 #include <torch/csrc/profiler/python/combined_traceback.h>
 #include <torch/csrc/profiler/standalone/execution_trace_observer.h>
+#include <torch/csrc/profiler/standalone/trace_diff.h>
 #include <torch/csrc/utils/pybind.h>
 
 struct THPCapturedTraceback {
@@ -588,6 +589,61 @@ void initPythonBindings(PyObject* module) {
       "_set_cuda_sync_enabled_val",
       &torch::profiler::impl::set_cuda_sync_enabled_val);
 
+  // Native trace comparison engine (see standalone/trace_diff.h). Used by
+  // torch.profiler._utils.compare_traces to diff exported trace files.
+  using torch::profiler::impl::TraceDiffReport;
+  using torch::profiler::impl::TraceOpDelta;
+  using torch::profiler::impl::TraceOpSamples;
+  py::class_<TraceOpSamples>(m, "_TraceOpSamples")
+      .def(
+          py::init([](std::string name,
+                      const std::vector<std::string>& frames,
+                      std::vector<double> durations_us) {
+            TraceOpSamples samples;
+            samples.call_path_hash =
+                torch::profiler::impl::callPathHash(name, frames);
+            samples.name = std::move(name);
+            samples.durations_us = std::move(durations_us);
+            return samples;
+          }),
+          py::arg("name"),
+          py::arg("frames"),
+          py::arg("durations_us"))
+      .def_readonly("name", &TraceOpSamples::name)
+      .def_readonly("call_path_hash", &TraceOpSamples::call_path_hash)
+      .def_readonly("durations_us", &TraceOpSamples::durations_us);
+  py::class_<TraceOpDelta>(m, "_TraceOpDelta")
+      .def_readonly("name", &TraceOpDelta::name)
+      .def_readonly("call_path_hash", &TraceOpDelta::call_path_hash)
+      .def_readonly("baseline_count", &TraceOpDelta::baseline_count)
+      .def_readonly("candidate_count", &TraceOpDelta::candidate_count)
+      .def_readonly("baseline_mean_us", &TraceOpDelta::baseline_mean_us)
+      .def_readonly("candidate_mean_us", &TraceOpDelta::candidate_mean_us)
+      .def_readonly("delta_us", &TraceOpDelta::delta_us)
+      .def_readonly("delta_pct", &TraceOpDelta::delta_pct)
+      .def_readonly("t_statistic", &TraceOpDelta::t_statistic)
+      .def_readonly("p_value", &TraceOpDelta::p_value)
+      .def_readonly("significant", &TraceOpDelta::significant);
+  py::class_<TraceDiffReport>(m, "_TraceDiffReport")
+      .def_readonly("deltas", &TraceDiffReport::deltas)
+      .def_readonly("baseline_only", &TraceDiffReport::baseline_only)
+      .def_readonly("candidate_only", &TraceDiffReport::candidate_only)
+      .def(
+          "render",
+          [](const TraceDiffReport& report, size_t top_k) {
+            return torch::profiler::impl::renderTraceDiffReport(report, top_k);
+          },
+          py::arg("top_k") = 20)
+      .def("__str__", [](const TraceDiffReport& report) {
+        return torch::profiler::impl::renderTraceDiffReport(report);
+      });
+  m.def(
+      "_diff_profiler_traces",
+      &torch::profiler::impl::diffTraces,
+      py::arg("baseline"),
+      py::arg("candidate"),
+      py::arg("alpha") = 0.05);
+
   TORCH_CHECK(PyType_Ready(&THPCapturedTracebackType) >= 0);
   PyModule_AddObject(
       m.ptr(), "CapturedTraceback", (PyObject*)&THPCapturedTracebackType);
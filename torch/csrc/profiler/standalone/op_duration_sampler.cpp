@@ -0,0 +1,115 @@
+#include <torch/csrc/profiler/standalone/op_duration_sampler.h>
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+
+#include <ATen/record_function.h>
+#include <c10/util/ApproximateClock.h>
+#include <c10/util/llvmMathExtras.h>
+
+namespace torch::profiler::impl {
+namespace {
+
+// Aggregation is sharded by the hash of the op name so concurrent worker
+// threads rarely contend on the same mutex; a name always lands in
+// exactly one shard. The exit callback holds a shard lock only for a map
+// lookup and a few integer adds.
+constexpr size_t kNumShards = 16;
+
+struct Shard {
+  std::mutex mutex;
+  std::unordered_map<std::string, OpDurationStats> stats;
+};
+
+struct SamplerState {
+  std::array<Shard, kNumShards> shards;
+  std::atomic<at::CallbackHandle> handle{at::INVALID_CALLBACK_HANDLE};
+};
+
+SamplerState& samplerState() {
+  static auto* state = new SamplerState();
+  return *state;
+}
+
+struct OpDurationCtx : public at::ObserverContext {
+  int64_t start_time_ns{0};
+};
+
+std::unique_ptr<at::ObserverContext> onOpEnter(const at::RecordFunction&) {
+  auto ctx = std::make_unique<OpDurationCtx>();
+  ctx->start_time_ns = c10::getTime(/*allow_monotonic=*/true);
+  return ctx;
+}
+
+void onOpExit(const at::RecordFunction& fn, at::ObserverContext* ctx_ptr) {
+  auto* ctx = static_cast<OpDurationCtx*>(ctx_ptr);
+  if (ctx == nullptr) {
+    return;
+  }
+  const auto end_time_ns = c10::getTime(/*allow_monotonic=*/true);
+  const uint64_t duration_ns = end_time_ns > ctx->start_time_ns
+      ? static_cast<uint64_t>(end_time_ns - ctx->start_time_ns)
+      : 0;
+  const size_t bucket = duration_ns == 0
+      ? 0
+      : std::min<size_t>(
+            c10::llvm::Log2_64(duration_ns), kOpDurationBuckets - 1);
+
+  std::string name = fn.name();
+  auto& shard = samplerState()
+                    .shards[std::hash<std::string>()(name) % kNumShards];
+  std::lock_guard<std::mutex> guard(shard.mutex);
+  auto& entry = shard.stats[std::move(name)];
+  entry.calls++;
+  entry.total_ns += duration_ns;
+  entry.buckets[bucket]++;
+}
+
+} // namespace
+
+void enableOpDurationSampler(double sampling_probability) {
+  TORCH_CHECK(
+      sampling_probability > 0.0 && sampling_probability <= 1.0,
+      "enableOpDurationSampler: sampling probability must be in (0, 1], got ",
+      sampling_probability);
+  auto& state = samplerState();
+  TORCH_CHECK(
+      state.handle.load() == at::INVALID_CALLBACK_HANDLE,
+      "enableOpDurationSampler: sampler is already enabled");
+  state.handle.store(at::addGlobalCallback(
+      at::RecordFunctionCallback(&onOpEnter, &onOpExit)
+          .needsInputs(false)
+          .samplingProb(sampling_probability)
+          .scopes({at::RecordScope::FUNCTION})));
+}
+
+void disableOpDurationSampler() {
+  auto& state = samplerState();
+  const auto handle = state.handle.exchange(at::INVALID_CALLBACK_HANDLE);
+  if (handle != at::INVALID_CALLBACK_HANDLE) {
+    at::removeCallback(handle);
+  }
+}
+
+bool opDurationSamplerEnabled() {
+  return samplerState().handle.load() != at::INVALID_CALLBACK_HANDLE;
+}
+
+std::unordered_map<std::string, OpDurationStats> getOpDurationStats() {
+  std::unordered_map<std::string, OpDurationStats> result;
+  for (auto& shard : samplerState().shards) {
+    std::lock_guard<std::mutex> guard(shard.mutex);
+    result.insert(shard.stats.begin(), shard.stats.end());
+  }
+  return result;
+}
+
+void clearOpDurationStats() {
+  for (auto& shard : samplerState().shards) {
+    std::lock_guard<std::mutex> guard(shard.mutex);
+    shard.stats.clear();
+  }
+}
+
+} // namespace torch::profiler::impl
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+
+#include <c10/macros/Export.h>
+
+namespace torch::profiler::impl {
+
+// Number of power-of-two duration buckets: bucket i counts sampled calls
+// whose wall duration fell in [2^i, 2^(i+1)) nanoseconds. Bucket 0 also
+// absorbs sub-nanosecond readings; the last bucket is open-ended. 40
+// buckets cover up to ~18 minutes per call.
+constexpr size_t kOpDurationBuckets = 40;
+
+struct OpDurationStats {
+  uint64_t calls{0};
+  uint64_t total_ns{0};
+  std::array<uint64_t, kOpDurationBuckets> buckets{};
+};
+
+// Always-on sampling collector for per-op duration histograms.
+//
+// Unlike the Kineto/collection.cpp path, which records every event and is
+// too expensive to leave enabled, this registers a single sampled global
+// RecordFunction callback that buckets op wall durations into per-name
+// log2 histograms. At the default 1% sampling rate the overhead is a
+// clock read and a handful of integer adds per sampled op, so production
+// jobs can keep it on and poll getOpDurationStats() periodically.
+TORCH_API void enableOpDurationSampler(double sampling_probability = 0.01);
+TORCH_API void disableOpDurationSampler();
+TORCH_API bool opDurationSamplerEnabled();
+
+// Returns a snapshot of the aggregated histograms keyed by op name.
+TORCH_API std::unordered_map<std::string, OpDurationStats>
+getOpDurationStats();
+TORCH_API void clearOpDurationStats();
+
+} // namespace torch::profiler::impl
@@ -0,0 +1,284 @@
+#include <torch/csrc/profiler/standalone/trace_diff.h>
+
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <sstream>
+#include <unordered_map>
+
+namespace torch::profiler::impl {
+namespace {
+
+// Continued-fraction expansion of the regularized incomplete beta
+// function, evaluated with the modified Lentz algorithm. Converges
+// quickly for x < (a + 1) / (a + b + 2); incompleteBeta() below uses the
+// symmetry relation to stay in that region.
+double betaContinuedFraction(double a, double b, double x) {
+  constexpr int kMaxIterations = 200;
+  constexpr double kEpsilon = 3.0e-12;
+  constexpr double kTiny = 1.0e-30;
+
+  const double qab = a + b;
+  const double qap = a + 1.0;
+  const double qam = a - 1.0;
+  double c = 1.0;
+  double d = 1.0 - qab * x / qap;
+  if (std::fabs(d) < kTiny) {
+    d = kTiny;
+  }
+  d = 1.0 / d;
+  double h = d;
+  for (int m = 1; m <= kMaxIterations; ++m) {
+    const int m2 = 2 * m;
+    double aa = m * (b - m) * x / ((qam + m2) * (a + m2));
+    d = 1.0 + aa * d;
+    if (std::fabs(d) < kTiny) {
+      d = kTiny;
+    }
+    c = 1.0 + aa / c;
+    if (std::fabs(c) < kTiny) {
+      c = kTiny;
+    }
+    d = 1.0 / d;
+    h *= d * c;
+    aa = -(a + m) * (qab + m) * x / ((a + m2) * (qap + m2));
+    d = 1.0 + aa * d;
+    if (std::fabs(d) < kTiny) {
+      d = kTiny;
+    }
+    c = 1.0 + aa / c;
+    if (std::fabs(c) < kTiny) {
+      c = kTiny;
+    }
+    d = 1.0 / d;
+    const double delta = d * c;
+    h *= delta;
+    if (std::fabs(delta - 1.0) < kEpsilon) {
+      break;
+    }
+  }
+  return h;
+}
+
+// Regularized incomplete beta function I_x(a, b).
+double incompleteBeta(double a, double b, double x) {
+  if (x <= 0.0) {
+    return 0.0;
+  }
+  if (x >= 1.0) {
+    return 1.0;
+  }
+  const double log_front = std::lgamma(a + b) - std::lgamma(a) -
+      std::lgamma(b) + a * std::log(x) + b * std::log1p(-x);
+  const double front = std::exp(log_front);
+  if (x < (a + 1.0) / (a + b + 2.0)) {
+    return front * betaContinuedFraction(a, b, x) / a;
+  }
+  return 1.0 - front * betaContinuedFraction(b, a, 1.0 - x) / b;
+}
+
+// Two-sided p-value of Student's t distribution with `df` degrees of
+// freedom: P(|T| >= |t|) = I_{df/(df+t^2)}(df/2, 1/2).
+double studentTTwoSidedP(double t, double df) {
+  if (df <= 0.0 || !std::isfinite(t)) {
+    return std::isfinite(t) ? 1.0 : 0.0;
+  }
+  return incompleteBeta(df / 2.0, 0.5, df / (df + t * t));
+}
+
+struct SampleStats {
+  uint64_t count = 0;
+  double mean = 0;
+  double variance = 0; // unbiased (n - 1) sample variance
+};
+
+SampleStats computeStats(const std::vector<double>& samples) {
+  SampleStats stats;
+  stats.count = samples.size();
+  if (samples.empty()) {
+    return stats;
+  }
+  double sum = 0;
+  for (const double s : samples) {
+    sum += s;
+  }
+  stats.mean = sum / static_cast<double>(stats.count);
+  if (stats.count < 2) {
+    return stats;
+  }
+  double sq_sum = 0;
+  for (const double s : samples) {
+    const double d = s - stats.mean;
+    sq_sum += d * d;
+  }
+  stats.variance = sq_sum / static_cast<double>(stats.count - 1);
+  return stats;
+}
+
+// Merges entries with the same call-path hash into one sample list.
+// Iteration order of the result follows first appearance in the input so
+// reports are deterministic.
+std::vector<TraceOpSamples> mergeByCallPath(
+    const std::vector<TraceOpSamples>& samples) {
+  std::vector<TraceOpSamples> merged;
+  std::unordered_map<uint64_t, size_t> index;
+  for (const auto& sample : samples) {
+    auto [it, inserted] = index.emplace(sample.call_path_hash, merged.size());
+    if (inserted) {
+      merged.push_back(sample);
+    } else {
+      auto& durations = merged[it->second].durations_us;
+      durations.insert(
+          durations.end(),
+          sample.durations_us.begin(),
+          sample.durations_us.end());
+    }
+  }
+  return merged;
+}
+
+} // namespace
+
+uint64_t callPathHash(
+    const std::string& name,
+    const std::vector<std::string>& frames) {
+  // 64-bit FNV-1a. Each string is terminated with a NUL so frame
+  // boundaries contribute to the hash.
+  constexpr uint64_t kOffsetBasis = 0xcbf29ce484222325ULL;
+  constexpr uint64_t kPrime = 0x100000001b3ULL;
+  uint64_t hash = kOffsetBasis;
+  const auto mix = [&hash](const std::string& s) {
+    for (const char c : s) {
+      hash = (hash ^ static_cast<uint8_t>(c)) * kPrime;
+    }
+    hash *= kPrime; // NUL terminator (XOR with 0 is a no-op)
+  };
+  mix(name);
+  for (const auto& frame : frames) {
+    mix(frame);
+  }
+  return hash;
+}
+
+TraceDiffReport diffTraces(
+    const std::vector<TraceOpSamples>& baseline,
+    const std::vector<TraceOpSamples>& candidate,
+    double alpha) {
+  TraceDiffReport report;
+  auto merged_baseline = mergeByCallPath(baseline);
+  auto merged_candidate = mergeByCallPath(candidate);
+
+  std::unordered_map<uint64_t, const TraceOpSamples*> candidate_index;
+  candidate_index.reserve(merged_candidate.size());
+  for (const auto& sample : merged_candidate) {
+    candidate_index.emplace(sample.call_path_hash, &sample);
+  }
+
+  std::unordered_map<uint64_t, bool> matched;
+  for (const auto& base : merged_baseline) {
+    const auto it = candidate_index.find(base.call_path_hash);
+    if (it == candidate_index.end()) {
+      report.baseline_only.push_back(base);
+      continue;
+    }
+    matched.emplace(base.call_path_hash, true);
+    const TraceOpSamples& cand = *it->second;
+
+    const SampleStats base_stats = computeStats(base.durations_us);
+    const SampleStats cand_stats = computeStats(cand.durations_us);
+
+    TraceOpDelta delta;
+    delta.name = base.name;
+    delta.call_path_hash = base.call_path_hash;
+    delta.baseline_count = base_stats.count;
+    delta.candidate_count = cand_stats.count;
+    delta.baseline_mean_us = base_stats.mean;
+    delta.candidate_mean_us = cand_stats.mean;
+    delta.delta_us = cand_stats.mean - base_stats.mean;
+    delta.delta_pct = base_stats.mean != 0.0
+        ? 100.0 * delta.delta_us / base_stats.mean
+        : 0.0;
+
+    if (base_stats.count >= 2 && cand_stats.count >= 2) {
+      // Welch's unequal-variance t-test with Welch-Satterthwaite degrees
+      // of freedom. Zero pooled variance (e.g. constant clock readings)
+      // degenerates to an exact comparison of the means.
+      const double vb = base_stats.variance / base_stats.count;
+      const double vc = cand_stats.variance / cand_stats.count;
+      const double pooled = vb + vc;
+      if (pooled == 0.0) {
+        delta.p_value = delta.delta_us == 0.0 ? 1.0 : 0.0;
+        delta.t_statistic =
+            delta.delta_us == 0.0 ? 0.0 : std::copysign(HUGE_VAL, delta.delta_us);
+      } else {
+        delta.t_statistic = delta.delta_us / std::sqrt(pooled);
+        const double df = pooled * pooled /
+            (vb * vb / (base_stats.count - 1) +
+             vc * vc / (cand_stats.count - 1));
+        delta.p_value = studentTTwoSidedP(delta.t_statistic, df);
+      }
+      delta.significant = delta.p_value < alpha;
+    }
+    report.deltas.push_back(std::move(delta));
+  }
+
+  for (const auto& cand : merged_candidate) {
+    if (matched.find(cand.call_path_hash) == matched.end()) {
+      report.candidate_only.push_back(cand);
+    }
+  }
+
+  std::stable_sort(
+      report.deltas.begin(),
+      report.deltas.end(),
+      [](const TraceOpDelta& a, const TraceOpDelta& b) {
+        if (a.significant != b.significant) {
+          return a.significant;
+        }
+        return std::fabs(a.delta_us) * a.candidate_count >
+            std::fabs(b.delta_us) * b.candidate_count;
+      });
+  return report;
+}
+
+std::string renderTraceDiffReport(
+    const TraceDiffReport& report,
+    size_t top_k) {
+  std::ostringstream out;
+  out << std::left << std::setw(48) << "op (call path)" << std::right
+      << std::setw(10) << "base us" << std::setw(10) << "cand us"
+      << std::setw(10) << "delta us" << std::setw(9) << "delta %"
+      << std::setw(10) << "p-value" << std::setw(12) << "base/cand n"
+      << '\n';
+  out << std::string(109, '-') << '\n';
+  const size_t rows = std::min(top_k, report.deltas.size());
+  for (size_t i = 0; i < rows; ++i) {
+    const auto& d = report.deltas[i];
+    std::string name = d.name;
+    if (name.size() > 46) {
+      name = name.substr(0, 43) + "...";
+    }
+    if (d.significant) {
+      name += " *";
+    }
+    out << std::left << std::setw(48) << name << std::right << std::fixed
+        << std::setprecision(1) << std::setw(10) << d.baseline_mean_us
+        << std::setw(10) << d.candidate_mean_us << std::showpos
+        << std::setw(10) << d.delta_us << std::setw(8) << d.delta_pct
+        << "%" << std::noshowpos << std::setprecision(4) << std::setw(10)
+        << d.p_value << std::setw(6) << d.baseline_count << "/"
+        << std::left << std::setw(5) << d.candidate_count << std::right
+        << '\n';
+  }
+  if (report.deltas.size() > rows) {
+    out << "... " << (report.deltas.size() - rows) << " more matched ops\n";
+  }
+  if (!report.baseline_only.empty() || !report.candidate_only.empty()) {
+    out << report.baseline_only.size() << " ops only in baseline, "
+        << report.candidate_only.size() << " ops only in candidate\n";
+  }
+  out << "* significant at the requested alpha\n";
+  return out.str();
+}
+
+} // namespace torch::profiler::impl
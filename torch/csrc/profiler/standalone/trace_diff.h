@@ -0,0 +1,72 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <c10/macros/Export.h>
+
+namespace torch::profiler::impl {
+
+// Latency samples for one op call site, collected from a profiler trace.
+// Call sites are aligned across traces by `call_path_hash`, a stable hash
+// of the op name plus the frames of its callstack (the "Call stack"
+// metadata that collection.cpp attaches to exported events), so the same
+// source location matches up between runs even when the surrounding
+// schedule or event ordering changes.
+struct TraceOpSamples {
+  std::string name;
+  uint64_t call_path_hash = 0;
+  std::vector<double> durations_us;
+};
+
+// Stable 64-bit hash of an op call path. The same name and frames always
+// produce the same hash, across processes and runs.
+TORCH_API uint64_t callPathHash(
+    const std::string& name,
+    const std::vector<std::string>& frames);
+
+// Per-call-site latency comparison between a baseline and a candidate
+// trace. Deltas are candidate minus baseline, so positive values are
+// regressions.
+struct TraceOpDelta {
+  std::string name;
+  uint64_t call_path_hash = 0;
+  uint64_t baseline_count = 0;
+  uint64_t candidate_count = 0;
+  double baseline_mean_us = 0;
+  double candidate_mean_us = 0;
+  double delta_us = 0;
+  double delta_pct = 0; // 100 * delta_us / baseline_mean_us
+  double t_statistic = 0; // Welch's t; 0 when either side has < 2 samples
+  double p_value = 1.0; // two-sided; 1.0 when the test is not applicable
+  bool significant = false;
+};
+
+struct TraceDiffReport {
+  // Call sites present in both traces. Significant entries come first,
+  // each group sorted by the total wall time the delta moved
+  // (|delta_us| * candidate_count) descending, so the biggest regressions
+  // lead the report.
+  std::vector<TraceOpDelta> deltas;
+  // Call sites seen in only one of the traces (ops removed or added).
+  std::vector<TraceOpSamples> baseline_only;
+  std::vector<TraceOpSamples> candidate_only;
+};
+
+// Aligns the two sample collections by call-path hash (entries with the
+// same hash are merged) and runs Welch's two-sample t-test on every call
+// site present in both. An entry is marked significant when both sides
+// have at least two samples and the two-sided p-value is below `alpha`.
+TORCH_API TraceDiffReport diffTraces(
+    const std::vector<TraceOpSamples>& baseline,
+    const std::vector<TraceOpSamples>& candidate,
+    double alpha = 0.05);
+
+// Renders the report as a fixed-width text table showing at most `top_k`
+// deltas, for terminal triage.
+TORCH_API std::string renderTraceDiffReport(
+    const TraceDiffReport& report,
+    size_t top_k = 20);
+
+} // namespace torch::profiler::impl
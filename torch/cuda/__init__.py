@@ -1523,7 +1523,7 @@ def _register_triton_kernels():
 _lazy_call(_register_triton_kernels)
 
 
-from . import amp, jiterator, nvtx, profiler, sparse, tunable
+from . import amp, gds, jiterator, nvtx, profiler, sparse, tunable
 
 __all__ = [
     # Typed storage and tensors
@@ -1575,6 +1575,7 @@ __all__ = [
     "get_allocator_backend",
     "CUDAPluggableAllocator",
     "change_current_allocator",
+    "gds",
     "get_arch_list",
     "get_device_capability",
     "get_device_name",
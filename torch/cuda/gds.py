@@ -0,0 +1,115 @@
+r"""GPUDirect Storage (GDS) support for reading and writing CUDA storages.
+
+GDS uses cuFile to DMA data between NVMe storage and device memory without
+staging through a host bounce buffer. When the filesystem or driver does not
+support GDS, cuFile transparently falls back to an internal staging path, so
+these APIs are safe to use (if built with ``USE_CUFILE``) on any system.
+"""
+
+import os
+from typing import Optional
+
+import torch
+from torch.types import Storage
+
+__all__ = ["gds_register_buffer", "gds_deregister_buffer", "GdsFile"]
+
+
+def gds_register_buffer(s: Storage) -> None:
+    r"""Registers a CUDA storage with cuFile so reads and writes DMA directly
+    into it. Registration is optional but avoids an internal copy for
+    storages that are read or written repeatedly.
+
+    Args:
+        s (Storage): a CUDA storage to register.
+    """
+    torch._C._gds_register_buffer(s)
+
+
+def gds_deregister_buffer(s: Storage) -> None:
+    r"""Deregisters a CUDA storage previously registered with
+    :func:`gds_register_buffer`.
+
+    Args:
+        s (Storage): the storage to deregister.
+    """
+    torch._C._gds_deregister_buffer(s)
+
+
+class GdsFile:
+    r"""Wrapper around a cuFile handle for a file opened with ``O_DIRECT``.
+
+    Example::
+
+        >>> # xdoctest: +SKIP("requires cuFile")
+        >>> src = torch.randn(1024, device="cuda")
+        >>> f = torch.cuda.gds.GdsFile(filename, os.O_CREAT | os.O_WRONLY)
+        >>> f.save_storage(src.untyped_storage(), offset=0)
+
+    Args:
+        filename (str): name of the file to open.
+        flags (int): flags passed to ``os.open``; ``os.O_DIRECT`` is added
+            automatically as cuFile requires it.
+    """
+
+    def __init__(self, filename: str, flags: int):
+        if not torch.cuda.is_available():
+            raise RuntimeError("GdsFile requires CUDA")
+        self.filename = filename
+        self.flags = flags
+        self.fd: Optional[int] = os.open(filename, flags | os.O_DIRECT)
+        self.handle: Optional[int] = None
+        self.register_handle()
+
+    def __del__(self) -> None:
+        if getattr(self, "fd", None) is not None:
+            self.close()
+
+    def register_handle(self) -> None:
+        r"""Registers the file descriptor with cuFile. Called by the
+        constructor; only needed explicitly after ``deregister_handle``."""
+        assert (
+            self.handle is None
+        ), "Cannot register a handle that is already registered."
+        self.handle = torch._C._gds_register_handle(self.fd)
+
+    def deregister_handle(self) -> None:
+        r"""Deregisters the file descriptor from cuFile."""
+        assert (
+            self.handle is not None
+        ), "Cannot deregister a handle that is not registered."
+        torch._C._gds_deregister_handle(self.handle)
+        self.handle = None
+
+    def load_storage(self, storage: Storage, offset: int = 0) -> None:
+        r"""Reads ``storage.nbytes()`` bytes at ``offset`` in the file
+        straight into the CUDA storage.
+
+        Args:
+            storage (Storage): a CUDA storage to fill.
+            offset (int, optional): byte offset into the file.
+        """
+        assert (
+            self.handle is not None
+        ), "Cannot load a storage from a deregistered file."
+        torch._C._gds_load_storage(self.handle, storage, offset)
+
+    def save_storage(self, storage: Storage, offset: int = 0) -> None:
+        r"""Writes the CUDA storage to the file at ``offset``.
+
+        Args:
+            storage (Storage): a CUDA storage to write out.
+            offset (int, optional): byte offset into the file.
+        """
+        assert (
+            self.handle is not None
+        ), "Cannot save a storage to a deregistered file."
+        torch._C._gds_save_storage(self.handle, storage, offset)
+
+    def close(self) -> None:
+        r"""Deregisters the cuFile handle and closes the file."""
+        if self.handle is not None:
+            self.deregister_handle()
+        if self.fd is not None:
+            os.close(self.fd)
+            self.fd = None
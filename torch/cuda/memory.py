@@ -32,6 +32,7 @@ __all__ = [
     "caching_allocator_delete",
     "set_per_process_memory_fraction",
     "empty_cache",
+    "compact_expandable_segments",
     "memory_stats",
     "memory_stats_as_nested_dict",
     "reset_accumulated_memory_stats",
@@ -50,6 +51,7 @@ __all__ = [
     "mem_get_info",
     "get_allocator_backend",
     "CUDAPluggableAllocator",
+    "CUDAManagedAllocator",
     "change_current_allocator",
 ]
 
@@ -170,6 +172,29 @@ def empty_cache() -> None:
         torch._C._cuda_emptyCache()
 
 
+def compact_expandable_segments(device: Union[Device, int] = None) -> int:
+    r"""Unmap the physical pages backing free blocks inside expandable
+    segments, returning them to the driver so they can be remapped where they
+    are needed, and return the number of bytes reclaimed.
+
+    Long-running workloads using ``expandable_segments:True`` (see
+    :ref:`cuda-memory-management`) can accumulate freed holes inside expanded
+    segments. Unlike :func:`~torch.cuda.empty_cache` this keeps the segments'
+    virtual address ranges and all non-expandable cached segments intact, so
+    it is cheap enough to call at idle points (e.g. between evaluation runs).
+    Synchronizes the streams owning the reclaimed blocks.
+
+    Args:
+        device (torch.device or int, optional): selected device. Reclaims
+            memory for the current device, given by :func:`~torch.cuda.current_device`,
+            if :attr:`device` is ``None`` (default).
+    """
+    if not is_initialized():
+        return 0
+    device = _get_device_index(device, optional=True)
+    return torch._C._cuda_compactExpandableSegments(device)
+
+
 def memory_stats(device: Union[Device, int] = None) -> Dict[str, Any]:
     r"""Return a dictionary of CUDA memory allocator statistics for a given device.
 
@@ -849,6 +874,19 @@ def _dump_snapshot(filename="dump_snapshot.pickle"):
         pickle.dump(s, f)
 
 
+def _collapsed_stacks() -> str:
+    """
+    Return the live bytes currently held by the caching allocator aggregated
+    per allocation-site stack, in collapsed-stack format ("frame;frame bytes"
+    per line) suitable for flamegraph.pl or speedscope.
+
+    Aggregation happens natively, so C++ call sites recorded with
+    `torch.cuda.memory._record_memory_history(stacks="all")` are attributed
+    without replaying Python tracebacks.
+    """
+    return _C._cuda_memoryCollapsedStacks()
+
+
 def _save_segment_usage(filename="output.svg", snapshot=None):
     if snapshot is None:
         snapshot = _snapshot()
@@ -921,6 +959,24 @@ class CUDAPluggableAllocator(_CUDAAllocator):
         self._allocator = torch._C._cuda_customAllocator(alloc_fn, free_fn)
 
 
+class CUDAManagedAllocator(_CUDAAllocator):
+    r"""CUDA memory allocator backed by ``cudaMallocManaged`` (unified memory).
+
+    Allocations prefer GPU residency but the driver can evict pages to host
+    memory under pressure, so working sets larger than VRAM page gracefully
+    instead of raising out-of-memory errors. Stream uses recorded by the
+    caching-allocator machinery are turned into ``cudaMemPrefetchAsync``
+    hints, migrating evicted pages back ahead of the kernels that need them.
+
+    To activate it, pass an instance to
+    :func:`torch.cuda.memory.change_current_allocator` before any CUDA
+    allocation is made.
+    """
+
+    def __init__(self):
+        self._allocator = torch._C._cuda_createManagedAllocator()
+
+
 def change_current_allocator(allocator: _CUDAAllocator) -> None:
     r"""Change the currently used memory allocator to be the one provided.
 
@@ -10,6 +10,7 @@ import logging
 import os
 import pickle
 import sys
+import threading
 import time
 import warnings
 from collections import namedtuple
@@ -1587,6 +1588,70 @@ def _get_split_source(pg):
     return split_from
 
 
+def _eager_connect_all_groups(device_id: Optional[torch.device] = None) -> None:
+    """
+    Eagerly initialize the communicators of every process group this rank belongs to.
+
+    Backends such as NCCL create communicators lazily on the first collective,
+    which can stall training for several seconds the first time a subgroup
+    fires mid-step. Calling this once after all subgroups have been declared
+    (and before the first training step) initializes the outstanding
+    communicators in a batch instead: the default group is connected first so
+    that subgroups can be split off its live communicator (``ncclCommSplit``)
+    where the backend supports it, and the remaining groups are then connected
+    in parallel, one thread per group.
+
+    Args:
+        device_id (:class:`torch.device`, optional): a single, specific device
+            to connect on, e.g. ``torch.device("cuda:0")``. Defaults to the
+            device the default process group was bound to at
+            :func:`init_process_group` time.
+    """
+    default_pg = _get_default_group()
+    device_id = device_id or default_pg.bound_device_id
+    if device_id is None:
+        raise ValueError(
+            "_eager_connect_all_groups requires a specific device; pass "
+            "`device_id` here or to init_process_group()."
+        )
+
+    def _connectable_backend(pg):
+        try:
+            backend = pg._get_backend(device_id)
+        except RuntimeError:
+            # No backend registered for this device type.
+            return None
+        # If necessary, peel process group wrappers as _get_split_source does.
+        while _GLOO_AVAILABLE and isinstance(backend, _ProcessGroupWrapper):
+            backend = backend.wrapped_pg
+        return backend
+
+    # Connect the default group first so that subgroups created with a
+    # `split_from` parent find a live communicator to split from rather than
+    # falling back to a full (and slow) initialization.
+    default_backend = _connectable_backend(default_pg)
+    if default_backend is not None:
+        default_backend.eager_connect_single_device(device_id)
+
+    # Group creation is collective, so `_world.pg_map` holds the groups in the
+    # same order on every rank; connecting them concurrently lets independent
+    # groups overlap their rendezvous instead of serializing on it.
+    threads = []
+    for pg in _world.pg_map:
+        if pg is default_pg:
+            continue
+        backend = _connectable_backend(pg)
+        if backend is None:
+            continue
+        thread = threading.Thread(
+            target=backend.eager_connect_single_device, args=(device_id,)
+        )
+        thread.start()
+        threads.append(thread)
+    for thread in threads:
+        thread.join()
+
+
 def _shutdown_backend(pg):
     """
     Try to shut down the backend of a process group.
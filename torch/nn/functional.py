@@ -5603,16 +5603,18 @@ def _in_projection(
 scaled_dot_product_attention = _add_docstr(
     torch._C._nn.scaled_dot_product_attention,
     r"""
-scaled_dot_product_attention(query, key, value, attn_mask=None, dropout_p=0.0, is_causal=False, scale=None) -> Tensor:
+scaled_dot_product_attention(query, key, value, attn_mask=None, dropout_p=0.0, is_causal=False, scale=None, enable_gqa=False) -> Tensor:
 
 Computes scaled dot product attention on query, key and value tensors, using
 an optional attention mask if passed, and applying dropout if a probability
-greater than 0.0 is specified. The optional scale argument can only be specified as a keyword argument.
+greater than 0.0 is specified. The optional scale and enable_gqa arguments can only be
+specified as keyword arguments.
 
 .. code-block:: python
 
     # Efficient implementation equivalent to the following:
-    def scaled_dot_product_attention(query, key, value, attn_mask=None, dropout_p=0.0, is_causal=False, scale=None) -> torch.Tensor:
+    def scaled_dot_product_attention(query, key, value, attn_mask=None, dropout_p=0.0,
+            is_causal=False, scale=None, enable_gqa=False) -> torch.Tensor:
         L, S = query.size(-2), key.size(-2)
         scale_factor = 1 / math.sqrt(query.size(-1)) if scale is None else scale
         attn_bias = torch.zeros(L, S, dtype=query.dtype)
@@ -5627,6 +5629,11 @@ greater than 0.0 is specified. The optional scale argument can only be specified
                 attn_bias.masked_fill_(attn_mask.logical_not(), float("-inf"))
             else:
                 attn_bias += attn_mask
+
+        if enable_gqa:
+            key = key.repeat_interleave(query.size(-3) // key.size(-3), -3)
+            value = value.repeat_interleave(query.size(-3) // value.size(-3), -3)
+
         attn_weight = query @ key.transpose(-2, -1) * scale_factor
         attn_weight += attn_bias
         attn_weight = torch.softmax(attn_weight, dim=-1)
@@ -5705,6 +5712,11 @@ Args:
         An error is thrown if both attn_mask and is_causal are set.
     scale (optional float, keyword-only): Scaling factor applied prior to softmax. If None, the default value is set
         to :math:`\frac{1}{\sqrt{E}}`.
+    enable_gqa (bool, keyword-only): If set to True, Grouped Query Attention (GQA) is enabled: the number of
+        key/value heads may be smaller than the number of query heads as long as it evenly divides it, and each
+        key/value head serves a group of query heads. Backends with native support map query heads onto key/value
+        heads inside the kernel without materializing repeated key/value tensors. Only dense (non-nested) inputs
+        are supported.
 
 
 Returns:
@@ -5716,6 +5728,8 @@ Shape legend:
     - :math:`L: \text{Target sequence length}`
     - :math:`E: \text{Embedding dimension of the query and key}`
     - :math:`Ev: \text{Embedding dimension of the value}`
+    - :math:`Hq: \text{Number of heads of query}`
+    - :math:`H: \text{Number of heads of key and value}`
 
 Examples:
 
@@ -5726,6 +5740,12 @@ Examples:
     >>> with torch.backends.cuda.sdp_kernel(enable_math=False):
     >>>     F.scaled_dot_product_attention(query,key,value)
 
+    >>> # Sample for GQA: the number of key/value heads divides the number of query heads
+    >>> query = torch.rand(32, 32, 128, 64, dtype=torch.float16, device="cuda")
+    >>> key = torch.rand(32, 8, 128, 64, dtype=torch.float16, device="cuda")
+    >>> value = torch.rand(32, 8, 128, 64, dtype=torch.float16, device="cuda")
+    >>> F.scaled_dot_product_attention(query, key, value, enable_gqa=True)
+
 
 .. _FlashAttention-2\: Faster Attention with Better Parallelism and Work Partitioning:
     https://arxiv.org/abs/2307.08691
@@ -138,7 +138,7 @@ def quantized_hardswish(g: jit_utils.GraphContext, x, op_scale, op_zero_point):
 # aten_scaled_dot_product_attention
 # NOTE: Need op.Trilu
 @_onnx_symbolic("aten::scaled_dot_product_attention")
-@symbolic_helper.parse_args("v", "v", "v", "v", "f", "b", "v")
+@symbolic_helper.parse_args("v", "v", "v", "v", "f", "b", "v", "b")
 @_beartype.beartype
 def scaled_dot_product_attention(
     g: jit_utils.GraphContext,
@@ -149,10 +149,14 @@ def scaled_dot_product_attention(
     dropout_p: float = 0.0,
     is_causal: bool = False,
     scale: Optional[torch._C.Value] = None,
+    enable_gqa: bool = False,
 ):
     assert (not is_causal) or (
         is_causal and symbolic_helper._is_none(attn_mask)
     ), "is_causal and attn_mask cannot be set at the same time"
+    assert not enable_gqa, (
+        "conversion of scaled_dot_product_attention not implemented if enable_gqa is True"
+    )
 
     scale = symbolic_helper._maybe_get_const(scale, "f")
     if symbolic_helper._is_none(scale):
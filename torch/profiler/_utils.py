@@ -383,3 +383,55 @@ def _init_for_cuda_graphs():
 
     with profile():
         pass
+
+
+def _load_trace_op_samples(paths):
+    """Extracts per-call-site latency samples from exported Chrome trace files.
+
+    Ops are keyed by their name plus the "Call stack" metadata emitted when
+    profiling ``with_stack=True``; ops without a callstack fall back to the
+    name alone.
+    """
+    import gzip
+    import json
+
+    from torch._C._profiler import _TraceOpSamples
+
+    if isinstance(paths, str):
+        paths = [paths]
+    samples: Dict[tuple, List[float]] = {}
+    for path in paths:
+        opener = gzip.open if path.endswith(".gz") else open
+        with opener(path, "rt") as f:
+            trace = json.load(f)
+        for event in trace.get("traceEvents", []):
+            if event.get("ph") != "X" or "dur" not in event:
+                continue
+            args = event.get("args") or {}
+            stack = args.get("Call stack", "")
+            frames = tuple(stack.split(";")) if stack else ()
+            samples.setdefault((event["name"], frames), []).append(
+                float(event["dur"])
+            )
+    return [
+        _TraceOpSamples(name, list(frames), durations)
+        for (name, frames), durations in samples.items()
+    ]
+
+
+def compare_traces(baseline, candidate, alpha=0.05):
+    """Diffs two exported trace collections op by op.
+
+    ``baseline`` and ``candidate`` are paths (or lists of paths) to Chrome
+    trace files written by :meth:`torch.profiler.profile.export_chrome_trace`.
+    Ops are aligned across the collections by a stable call-path hash and
+    each matched op gets a latency delta with a Welch's t-test significance
+    verdict, so a regression report is ``print(compare_traces(a, b))`` away.
+    """
+    from torch._C._profiler import _diff_profiler_traces
+
+    return _diff_profiler_traces(
+        _load_trace_op_samples(baseline),
+        _load_trace_op_samples(candidate),
+        alpha,
+    )
@@ -48,6 +48,8 @@ __all__ = [
     "normalize_storage_type",
     "storage_to_tensor_type",
     "save",
+    "async_save",
+    "AsyncSaveHandle",
     "load",
     "StorageType",
     "LoadEndianness",
@@ -526,6 +528,29 @@ def _is_path(name_or_buffer) -> TypeGuard[Union[str, os.PathLike]]:
     return isinstance(name_or_buffer, (str, os.PathLike))
 
 
+def _get_gds_device(map_location, f) -> Optional[torch.device]:
+    """GPUDirect Storage loads are opt-in via ``PYTORCH_LOAD_USE_GDS=1`` and
+    only apply when loading a file path with ``map_location`` naming a single
+    CUDA device; returns that device, or ``None`` for the regular load path."""
+    if os.environ.get("PYTORCH_LOAD_USE_GDS", "0").lower() not in (
+        "1",
+        "y",
+        "yes",
+        "true",
+    ):
+        return None
+    if not _is_path(f):
+        return None
+    if not isinstance(map_location, (str, torch.device)):
+        return None
+    device = torch.device(map_location)
+    if device.type != "cuda" or not torch.cuda.is_available():
+        return None
+    if device.index is None:
+        device = torch.device("cuda", torch.cuda.current_device())
+    return device
+
+
 class _opener:
     def __init__(self, file_like):
         self.file_like = file_like
@@ -762,6 +787,130 @@ def save(
             _legacy_save(obj, opened_file, pickle_module, pickle_protocol)
 
 
+class AsyncSaveHandle:
+    """Handle for a checkpoint started by :func:`torch.serialization.async_save`.
+
+    The snapshot has already been taken when the handle is returned; the
+    handle only tracks the background serialization.
+    """
+
+    def __init__(self, thread):
+        self._thread = thread
+        self._exception: Optional[BaseException] = None
+
+    def done(self) -> bool:
+        """Returns True once background serialization has finished."""
+        return not self._thread.is_alive()
+
+    def wait(self) -> None:
+        """Blocks until serialization finishes, re-raising any error from it."""
+        self._thread.join()
+        if self._exception is not None:
+            raise self._exception
+
+
+def _snapshot_for_async_save(obj):
+    # Builds a point-in-time copy of obj that is safe to serialize while
+    # training keeps mutating the original. Plain strided CPU tensors are
+    # snapshotted with copy-on-write storages (torch._lazy_clone), so no
+    # data is copied unless either side is written afterwards; accelerator
+    # tensors get a device-local clone, which is a stream-ordered memcpy,
+    # not a serialization-length stall. Everything else falls back to an
+    # eager deepcopy for correctness.
+    import copy
+
+    import torch.nn as nn
+
+    if isinstance(obj, torch.Tensor):
+        if obj.layout == torch.strided and type(obj) in (
+            torch.Tensor,
+            nn.Parameter,
+        ):
+            if obj.device.type == "cpu":
+                snapshot = torch._lazy_clone(obj.detach())
+            else:
+                snapshot = obj.detach().clone()
+            if isinstance(obj, nn.Parameter):
+                return nn.Parameter(snapshot, requires_grad=obj.requires_grad)
+            return snapshot.requires_grad_(obj.requires_grad)
+        return copy.deepcopy(obj)
+    if isinstance(obj, dict):
+        return type(obj)(
+            (key, _snapshot_for_async_save(value)) for key, value in obj.items()
+        )
+    if isinstance(obj, tuple) and hasattr(obj, "_fields"):  # namedtuple
+        return type(obj)(*(_snapshot_for_async_save(value) for value in obj))
+    if isinstance(obj, (list, tuple, set)):
+        return type(obj)(_snapshot_for_async_save(value) for value in obj)
+    return obj
+
+
+def async_save(
+    obj: object,
+    f: FILE_LIKE,
+    pickle_module: Any = pickle,
+    pickle_protocol: int = DEFAULT_PROTOCOL,
+    _use_new_zipfile_serialization: bool = True,
+) -> AsyncSaveHandle:
+    """Snapshots ``obj`` immediately and serializes it on a background thread.
+
+    Tensor contents are captured before this function returns: strided CPU
+    tensors through copy-on-write storage snapshots (no data copy unless a
+    subsequent write collides with the snapshot, which materializes just
+    that storage), accelerator tensors through a device-local clone. The
+    caller may therefore resume mutating the model as soon as this returns,
+    while the :func:`torch.save`-format file is written in the background.
+
+    Non-tensor leaves are saved by reference; mutating them before the
+    returned handle reports completion is a race. Containers (dict, list,
+    tuple, set) are traversed; exotic tensor subclasses are deep-copied.
+
+    Args:
+        obj: saved object
+        f: a file-like object (has to implement write and flush) or a string
+            or os.PathLike object containing a file name
+        pickle_module: module used for pickling metadata and objects
+        pickle_protocol: can be specified to override the default protocol
+
+    Returns:
+        An :class:`AsyncSaveHandle`; call ``wait()`` before relying on the
+        file, e.g. before deleting an older checkpoint.
+
+    Example:
+        >>> # xdoctest: +SKIP("makes cwd dirty")
+        >>> handle = torch.serialization.async_save(model.state_dict(), "ckpt.pt")
+        >>> # ... keep training ...
+        >>> handle.wait()
+    """
+    import threading
+
+    torch._C._log_api_usage_once("torch.async_save")
+    _check_dill_version(pickle_module)
+    _check_save_filelike(f)
+
+    snapshot = _snapshot_for_async_save(obj)
+
+    handle_holder: List[AsyncSaveHandle] = []
+
+    def _serialize():
+        try:
+            save(
+                snapshot,
+                f,
+                pickle_module,
+                pickle_protocol,
+                _use_new_zipfile_serialization,
+            )
+        except BaseException as e:  # noqa: B036
+            handle_holder[0]._exception = e
+
+    thread = threading.Thread(target=_serialize, name="torch.async_save")
+    handle = AsyncSaveHandle(thread)
+    handle_holder.append(handle)
+    thread.start()
+    return handle
+
+
 def _legacy_save(obj, f, pickle_module, pickle_protocol) -> None:
     import torch.nn as nn
 
@@ -1190,24 +1339,46 @@ def load(
                     overall_storage = torch.UntypedStorage.from_file(
                         os.fspath(f), shared, size
                     )
-                if weights_only:
+                gds_file = None
+                gds_device = None if mmap else _get_gds_device(map_location, f)
+                if gds_device is not None:
                     try:
-                        return _load(
-                            opened_zipfile,
-                            map_location,
-                            _weights_only_unpickler,
-                            overall_storage=overall_storage,
-                            **pickle_load_args,
+                        gds_file = torch.cuda.gds.GdsFile(os.fspath(f), os.O_RDONLY)
+                    except Exception as e:
+                        warnings.warn(
+                            "PYTORCH_LOAD_USE_GDS was set but GPUDirect Storage is "
+                            f"unavailable, falling back to the regular load path ({e})",
+                            UserWarning,
                         )
-                    except RuntimeError as e:
-                        raise pickle.UnpicklingError(UNSAFE_MESSAGE + str(e)) from None
-                return _load(
-                    opened_zipfile,
-                    map_location,
-                    pickle_module,
-                    overall_storage=overall_storage,
-                    **pickle_load_args,
-                )
+                        gds_device = None
+                try:
+                    if weights_only:
+                        try:
+                            return _load(
+                                opened_zipfile,
+                                map_location,
+                                _weights_only_unpickler,
+                                overall_storage=overall_storage,
+                                gds_file=gds_file,
+                                gds_device=gds_device,
+                                **pickle_load_args,
+                            )
+                        except RuntimeError as e:
+                            raise pickle.UnpicklingError(
+                                UNSAFE_MESSAGE + str(e)
+                            ) from None
+                    return _load(
+                        opened_zipfile,
+                        map_location,
+                        pickle_module,
+                        overall_storage=overall_storage,
+                        gds_file=gds_file,
+                        gds_device=gds_device,
+                        **pickle_load_args,
+                    )
+                finally:
+                    if gds_file is not None:
+                        gds_file.close()
         if mmap:
             f_name = "" if not isinstance(f, str) else f"{f}, "
             raise RuntimeError(
@@ -1562,6 +1733,8 @@ def _load(
     pickle_module,
     pickle_file="data.pkl",
     overall_storage=None,
+    gds_file=None,
+    gds_device=None,
     **pickle_load_args,
 ):
     restore_location = _get_restore_location(map_location)
@@ -1603,6 +1776,15 @@ def _load(
             UserWarning,
         )
 
+    # Byteswapping happens on the host, so records that need it cannot be
+    # DMA'd straight to the device.
+    if (
+        gds_file is not None
+        and byteorderdata is not None
+        and byteorderdata.decode() != sys.byteorder
+    ):
+        gds_file = None
+
     def load_tensor(dtype, numel, key, location):
         name = f"data/{key}"
         if torch._guards.detect_fake_mode(None) is not None:
@@ -1611,6 +1793,13 @@ def _load(
         elif overall_storage is not None:
             storage_offset = zip_file.get_record_offset(name)
             storage = overall_storage[storage_offset : storage_offset + numel]
+        elif gds_file is not None:
+            # DMA the record from disk straight into a freshly allocated
+            # device storage; data records are always stored uncompressed in
+            # the zip container, as the mmap path above also relies on.
+            storage_offset = zip_file.get_record_offset(name)
+            storage = torch.UntypedStorage(numel, device=gds_device)
+            gds_file.load_storage(storage, storage_offset)
         else:
             storage = (
                 zip_file.get_storage_from_record(name, numel, torch.UntypedStorage)
@@ -1622,10 +1811,17 @@ def _load(
             if byteorderdata.decode() != sys.byteorder:
                 storage.byteswap(dtype)
 
+        # GDS reads land directly on the mapped device, so there is nothing
+        # left for restore_location to do.
+        if gds_file is not None and storage.device == gds_device:
+            wrapped_storage = storage
+        else:
+            wrapped_storage = restore_location(storage, location)
+
         # TODO: Once we decide to break serialization FC, we can
         # stop wrapping with TypedStorage
         typed_storage = torch.storage.TypedStorage(
-            wrap_storage=restore_location(storage, location),
+            wrap_storage=wrapped_storage,
             dtype=dtype,
             _internal=True,
         )
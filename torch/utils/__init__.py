@@ -102,3 +102,65 @@ def swap_tensors(t1, t2):
 
     # Swap the at::Tensor they point to
     torch._C._swap_tensor_impl(t1, t2)
+
+
+class SwappableTensorGroup:
+    """
+    Double-buffered storage swapping for a fixed set of tensors.
+
+    This is meant for refreshing the values of a set of long-lived tensors
+    (e.g. the parameters of a serving model) without pausing readers for the
+    duration of the copy. Each registered tensor gets a shadow storage of the
+    same size on the same device. New values are written into the shadow
+    storages with :meth:`stage_`, which is an ordinary copy and may run
+    concurrently with readers of the live values. :meth:`commit_` then points
+    every registered tensor at its shadow storage in a single call, without
+    copying any data.
+
+    Readers that grabbed the live tensors before a commit keep observing a
+    consistent snapshot: storages are reference counted, so the previous
+    storages stay alive (and unmodified) for as long as any view, storage
+    object, or in-flight kernel argument still refers to them. After the
+    commit they are retained as the shadow buffer for the next :meth:`stage_`.
+
+    Note that a commit bumps each tensor's version counter. Running backward
+    through a graph recorded before the commit will therefore raise the usual
+    in-place modification error instead of silently mixing old and new values.
+    """
+
+    def __init__(self, tensors):
+        self._tensors = list(tensors)
+        seen = set()
+        for t in self._tensors:
+            if not isinstance(t, torch.Tensor):
+                raise TypeError(f"expected a sequence of Tensors but found {type(t)}")
+            key = (t.untyped_storage().data_ptr(), t.device)
+            if key in seen:
+                raise ValueError(
+                    "tensors in a SwappableTensorGroup must not share storage; "
+                    "register the base tensor only"
+                )
+            seen.add(key)
+        self._shadow = [
+            torch.UntypedStorage(t.untyped_storage().nbytes(), device=t.device)
+            for t in self._tensors
+        ]
+
+    def stage_(self, new_values):
+        """Copy ``new_values`` into the shadow storages without touching the live tensors."""
+        new_values = list(new_values)
+        if len(new_values) != len(self._tensors):
+            raise ValueError(
+                f"expected {len(self._tensors)} values but got {len(new_values)}"
+            )
+        with torch.no_grad():
+            for t, storage, value in zip(self._tensors, self._shadow, new_values):
+                staging = torch.empty((0,), dtype=t.dtype, device=t.device)
+                staging.set_(storage, t.storage_offset(), t.size(), t.stride())
+                staging.copy_(value)
+
+    def commit_(self):
+        """Atomically point every registered tensor at the values staged by :meth:`stage_`."""
+        previous = [t.untyped_storage() for t in self._tensors]
+        torch._C._swap_tensor_storages(self._tensors, self._shadow)
+        self._shadow = previous
@@ -0,0 +1,103 @@
+"""Streaming top-k over tensors that never fit in memory at once.
+
+The accumulator consumes chunks of a conceptually 1-D stream of scores (for
+example, similarity scores loaded from disk shard by shard) and maintains the
+running top-k ``(values, indices)`` state with bounded memory: at most ``k``
+elements plus one chunk are ever resident. Each update is a single call into
+the native ``_streaming_topk_update`` op, which filters the chunk against the
+current k-th value before merging, so chunks that contribute nothing are
+discarded with one vectorized comparison. Accumulators built on disjoint
+shards (e.g. one per worker thread) can be combined with :meth:`merge`.
+"""
+
+from typing import NamedTuple, Optional
+
+import torch
+from torch import Tensor
+
+__all__ = ["StreamingTopK"]
+
+
+class StreamingTopK:
+    """Running top-k accumulator over a chunked stream of values.
+
+    Example::
+
+        acc = StreamingTopK(k=1024)
+        for chunk in score_chunks():  # 1-D tensors, any sizes
+            acc.update(chunk)
+        values, indices = acc.topk()
+
+    Args:
+        k (int): number of elements to keep.
+        largest (bool, optional): whether to keep the largest or the smallest
+            elements, as in :func:`torch.topk`. Default: ``True``.
+    """
+
+    class TopK(NamedTuple):
+        values: Tensor
+        indices: Tensor
+
+    def __init__(self, k: int, largest: bool = True) -> None:
+        if k <= 0:
+            raise ValueError(f"StreamingTopK requires a positive k, got {k}")
+        self.k = k
+        self.largest = largest
+        self._values: Optional[Tensor] = None
+        self._indices: Optional[Tensor] = None
+        # Number of stream elements consumed so far; used to assign global
+        # indices to chunks when the caller does not pass explicit offsets.
+        self._consumed = 0
+
+    def _state(self, like: Tensor) -> TopK:
+        if self._values is None or self._indices is None:
+            self._values = like.new_empty(0)
+            self._indices = like.new_empty(0, dtype=torch.int64)
+        return StreamingTopK.TopK(self._values, self._indices)
+
+    def update(self, chunk: Tensor, offset: Optional[int] = None) -> None:
+        """Feed the next chunk of the stream into the accumulator.
+
+        Args:
+            chunk (Tensor): 1-D tensor of values.
+            offset (int, optional): global index of the first chunk element.
+                Defaults to the number of elements consumed so far, which is
+                correct when chunks arrive in stream order.
+        """
+        if offset is None:
+            offset = self._consumed
+        chunk = chunk.reshape(-1)
+        indices = torch.arange(
+            offset, offset + chunk.numel(), dtype=torch.int64, device=chunk.device
+        )
+        values, state_indices = self._state(chunk)
+        self._values, self._indices = torch._streaming_topk_update(
+            values, state_indices, chunk, indices, self.k, self.largest
+        )
+        self._consumed = max(self._consumed, offset + chunk.numel())
+
+    def merge(self, other: "StreamingTopK") -> None:
+        """Fold another accumulator (e.g. from a worker thread) into this one."""
+        if other.k != self.k or other.largest != self.largest:
+            raise ValueError(
+                "Cannot merge StreamingTopK accumulators with different "
+                f"configurations: (k={self.k}, largest={self.largest}) vs "
+                f"(k={other.k}, largest={other.largest})"
+            )
+        if other._values is None or other._indices is None:
+            return
+        values, indices = self._state(other._values)
+        self._values, self._indices = torch._streaming_topk_update(
+            values, indices, other._values, other._indices, self.k, self.largest
+        )
+        self._consumed = max(self._consumed, other._consumed)
+
+    def topk(self) -> TopK:
+        """Return the accumulated ``(values, indices)``, sorted like :func:`torch.topk`.
+
+        Fewer than ``k`` elements are returned if the stream was shorter than
+        ``k``.
+        """
+        if self._values is None or self._indices is None:
+            raise RuntimeError("StreamingTopK.topk() called before any update()")
+        return StreamingTopK.TopK(self._values, self._indices)
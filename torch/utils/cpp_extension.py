@@ -1,6 +1,7 @@
 # mypy: allow-untyped-defs
 import copy
 import glob
+import hashlib
 import importlib
 import importlib.abc
 import os
@@ -22,7 +23,7 @@ from .file_baton import FileBaton
 from ._cpp_extension_versioner import ExtensionVersioner
 from .hipify import hipify_python
 from .hipify.hipify_python import GeneratedFileCleaner
-from typing import Dict, List, Optional, Union, Tuple
+from typing import Any, Dict, List, Optional, Union, Tuple
 from torch.torch_version import TorchVersion, Version
 
 from setuptools.command.build_ext import build_ext
@@ -1247,6 +1248,15 @@ def load(name,
     argument to this function is supplied, it overrides the entire path, i.e.
     the library will be compiled into that folder directly.
 
+    Built libraries are additionally stored in a shared, content-addressed
+    compilation cache keyed by a hash of the sources, flags and compiler, so
+    rebuilding the same extension from a fresh build directory (e.g. after a
+    container restart with a temporary ``TORCH_EXTENSIONS_DIR``) reuses the
+    cached library instead of recompiling. The cache lives under the default
+    build root; set ``TORCH_EXTENSIONS_CACHE_DIR`` to relocate it (e.g. onto
+    a persistent volume shared between pods), or to an empty string to
+    disable it.
+
     To compile the sources, the default system compiler (``c++``) is used,
     which can be overridden by setting the ``CXX`` environment variable. To pass
     additional arguments to the compilation process, ``extra_cflags`` or
@@ -1659,6 +1669,101 @@ def load_inline(name,
         keep_intermediates=keep_intermediates)
 
 
+def _get_extension_cache_dir() -> Optional[str]:
+    """Returns the shared compilation cache directory, or ``None`` if disabled.
+
+    Built extension libraries are stored here keyed by a content hash of
+    their sources, flags and compiler, so a fresh build directory (e.g. a
+    new container with a tmpdir ``TORCH_EXTENSIONS_DIR``) can reuse a
+    previously compiled library instead of invoking the compiler. Set
+    ``TORCH_EXTENSIONS_CACHE_DIR`` to relocate the cache (e.g. onto a
+    persistent volume), or to an empty string to disable caching.
+    """
+    cache_dir = os.environ.get('TORCH_EXTENSIONS_CACHE_DIR')
+    if cache_dir is not None:
+        return cache_dir if cache_dir else None
+    return os.path.join(get_default_build_root(), 'cache')
+
+
+def _compute_extension_cache_key(name,
+                                 sources,
+                                 build_arguments,
+                                 with_cuda,
+                                 is_standalone) -> Optional[str]:
+    # Content-addressed key: source bytes, build flags, compiler identity
+    # and the torch/python/CUDA versions baked into the binary. Like the
+    # versioner above, headers pulled in from include paths are not hashed;
+    # the include path strings themselves are part of `build_arguments`.
+    try:
+        hasher = hashlib.sha256()
+
+        def update(tag, value):
+            hasher.update(f'{tag}={value}'.encode())
+            hasher.update(b'\0')
+
+        update('torch', torch.__version__)
+        update('cuda', torch.version.cuda)
+        update('python', sys.version)
+        update('name', name)
+        update('with_cuda', with_cuda)
+        update('is_standalone', is_standalone)
+        compiler = get_cxx_compiler()
+        update('compiler', compiler)
+        update(
+            'compiler_version',
+            subprocess.check_output(
+                [compiler, '--version'], stderr=subprocess.STDOUT))
+        for group in build_arguments:
+            for argument in group or []:
+                update('arg', argument)
+        for source in sources:
+            with open(source, 'rb') as file:
+                hasher.update(file.read())
+            hasher.update(b'\0')
+        return hasher.hexdigest()
+    except (OSError, subprocess.SubprocessError):
+        return None
+
+
+def _fetch_cached_library(cache_dir: str, cache_key: str, artifact: str) -> bool:
+    cached = os.path.join(cache_dir, cache_key + os.path.splitext(artifact)[1])
+    if not os.path.isfile(cached):
+        return False
+    try:
+        if os.path.exists(artifact):
+            os.remove(artifact)
+        try:
+            # Hardlink when the cache shares a filesystem with the build
+            # directory, so a hit costs no I/O proportional to library size.
+            os.link(cached, artifact)
+        except OSError:
+            shutil.copy2(cached, artifact)
+    except OSError:
+        return False
+    return True
+
+
+def _store_cached_library(cache_dir: str, cache_key: str, artifact: str) -> None:
+    cached = os.path.join(cache_dir, cache_key + os.path.splitext(artifact)[1])
+    if os.path.exists(cached):
+        return
+    try:
+        os.makedirs(cache_dir, exist_ok=True)
+        try:
+            os.link(artifact, cached)
+        except FileExistsError:
+            # Another process cached the same build concurrently.
+            pass
+        except OSError:
+            # Cross-device: copy through a temporary file and publish it
+            # atomically so concurrent readers never see a partial library.
+            tmp = f'{cached}.tmp.{os.getpid()}'
+            shutil.copy2(artifact, tmp)
+            os.replace(tmp, cached)
+    except OSError as error:
+        warnings.warn(f'Failed to cache extension library {artifact}: {error}')
+
+
 def _jit_compile(name,
                  sources,
                  extra_cflags,
@@ -1698,38 +1803,60 @@ def _jit_compile(name,
     if baton.try_acquire():
         try:
             if version != old_version:
-                with GeneratedFileCleaner(keep_intermediates=keep_intermediates) as clean_ctx:
-                    if IS_HIP_EXTENSION and (with_cuda or with_cudnn):
-                        hipify_result = hipify_python.hipify(
-                            project_directory=build_directory,
-                            output_directory=build_directory,
-                            header_include_dirs=(extra_include_paths if extra_include_paths is not None else []),
-                            extra_files=[os.path.abspath(s) for s in sources],
-                            ignores=[_join_rocm_home('*'), os.path.join(_TORCH_PATH, '*')],  # no need to hipify ROCm or PyTorch headers
-                            show_detailed=verbose,
-                            show_progress=verbose,
-                            is_pytorch_extension=True,
-                            clean_ctx=clean_ctx
-                        )
-
-                        hipified_sources = set()
-                        for source in sources:
-                            s_abs = os.path.abspath(source)
-                            hipified_sources.add(hipify_result[s_abs].hipified_path if s_abs in hipify_result else s_abs)
-
-                        sources = list(hipified_sources)
-
-                    _write_ninja_file_and_build_library(
-                        name=name,
-                        sources=sources,
-                        extra_cflags=extra_cflags or [],
-                        extra_cuda_cflags=extra_cuda_cflags or [],
-                        extra_ldflags=extra_ldflags or [],
-                        extra_include_paths=extra_include_paths or [],
-                        build_directory=build_directory,
-                        verbose=verbose,
+                artifact = os.path.join(
+                    build_directory,
+                    f'{name}{EXEC_EXT if is_standalone else LIB_EXT}')
+                cache_dir = _get_extension_cache_dir()
+                cache_key = None
+                if cache_dir is not None:
+                    cache_key = _compute_extension_cache_key(
+                        name,
+                        sources,
+                        build_arguments=[extra_cflags, extra_cuda_cflags,
+                                         extra_ldflags, extra_include_paths],
                         with_cuda=with_cuda,
                         is_standalone=is_standalone)
+                cache_hit = cache_key is not None and _fetch_cached_library(
+                    cache_dir, cache_key, artifact)
+                if cache_hit:
+                    if verbose:
+                        print(f'Reusing cached extension library for {name}, '
+                              'skipping build step...', file=sys.stderr)
+                else:
+                    with GeneratedFileCleaner(keep_intermediates=keep_intermediates) as clean_ctx:
+                        if IS_HIP_EXTENSION and (with_cuda or with_cudnn):
+                            hipify_result = hipify_python.hipify(
+                                project_directory=build_directory,
+                                output_directory=build_directory,
+                                header_include_dirs=(extra_include_paths if extra_include_paths is not None else []),
+                                extra_files=[os.path.abspath(s) for s in sources],
+                                ignores=[_join_rocm_home('*'), os.path.join(_TORCH_PATH, '*')],  # no need to hipify ROCm or PyTorch headers
+                                show_detailed=verbose,
+                                show_progress=verbose,
+                                is_pytorch_extension=True,
+                                clean_ctx=clean_ctx
+                            )
+
+                            hipified_sources = set()
+                            for source in sources:
+                                s_abs = os.path.abspath(source)
+                                hipified_sources.add(hipify_result[s_abs].hipified_path if s_abs in hipify_result else s_abs)
+
+                            sources = list(hipified_sources)
+
+                        _write_ninja_file_and_build_library(
+                            name=name,
+                            sources=sources,
+                            extra_cflags=extra_cflags or [],
+                            extra_cuda_cflags=extra_cuda_cflags or [],
+                            extra_ldflags=extra_ldflags or [],
+                            extra_include_paths=extra_include_paths or [],
+                            build_directory=build_directory,
+                            verbose=verbose,
+                            with_cuda=with_cuda,
+                            is_standalone=is_standalone)
+                    if cache_key is not None:
+                        _store_cached_library(cache_dir, cache_key, artifact)
             elif verbose:
                 print('No modifications detected for re-loaded extension '
                       f'module {name}, skipping build step...', file=sys.stderr)
@@ -2132,8 +2259,29 @@ def _get_exec_path(module_name, path):
     return os.path.join(path, f'{module_name}{EXEC_EXT}')
 
 
+# Process-wide table of already-loaded extension libraries, keyed by the
+# content hash of the library file. Loading the same library again (e.g. the
+# same cached build materialized under several build directories) returns
+# the existing module instead of paying a duplicate dlopen and module init.
+_loaded_extension_libraries: Dict[Tuple[str, bool], Any] = {}
+
+
+def _hash_library_file(filepath: str) -> str:
+    hasher = hashlib.sha256()
+    with open(filepath, 'rb') as file:
+        for chunk in iter(lambda: file.read(1024 * 1024), b''):
+            hasher.update(chunk)
+    return hasher.hexdigest()
+
+
 def _import_module_from_library(module_name, path, is_python_module):
     filepath = os.path.join(path, f"{module_name}{LIB_EXT}")
+    try:
+        library_key = (_hash_library_file(filepath), is_python_module)
+    except OSError:
+        library_key = None
+    if library_key is not None and library_key in _loaded_extension_libraries:
+        return _loaded_extension_libraries[library_key]
     if is_python_module:
         # https://stackoverflow.com/questions/67631/how-to-import-a-module-given-the-full-path
         spec = importlib.util.spec_from_file_location(module_name, filepath)
@@ -2141,9 +2289,12 @@ def _import_module_from_library(module_name, path, is_python_module):
         module = importlib.util.module_from_spec(spec)
         assert isinstance(spec.loader, importlib.abc.Loader)
         spec.loader.exec_module(module)
-        return module
     else:
         torch.ops.load_library(filepath)
+        module = None
+    if library_key is not None:
+        _loaded_extension_libraries[library_key] = module
+    return module
 
 
 def _write_ninja_file_to_build_library(path,